@@ -0,0 +1,68 @@
+#pragma once
+
+// Bitmaps as arrays of 64-bit words: bit i is bit i % 64 of word
+// i / 64, which on x86 is also bit i % 8 of byte i / 8.  Shared by
+// the kernel and mkfs, so it only needs uint and uint64_t.
+
+// Bits [lo, hi) of a word, 0 <= lo < hi <= 64.
+static inline uint64_t bmap_mask(uint lo, uint hi) {
+  if (hi - lo == 64)
+    return ~(uint64_t)0;
+  return (((uint64_t)1 << (hi - lo)) - 1) << lo;
+}
+
+// Set bits [start, start+n).
+static inline void bmap_set(void *map, uint start, uint n) {
+  uint64_t *w = map;
+  uint lo, hi;
+
+  for (; n > 0; n -= hi - lo, start += hi - lo) {
+    lo = start % 64;
+    hi = lo + n < 64 ? lo + n : 64;
+    w[start / 64] |= bmap_mask(lo, hi);
+  }
+}
+
+// Clear bits [start, start+n).
+static inline void bmap_clear(void *map, uint start, uint n) {
+  uint64_t *w = map;
+  uint lo, hi;
+
+  for (; n > 0; n -= hi - lo, start += hi - lo) {
+    lo = start % 64;
+    hi = lo + n < 64 ? lo + n : 64;
+    w[start / 64] &= ~bmap_mask(lo, hi);
+  }
+}
+
+// Are all of bits [start, start+n) set?
+static inline int bmap_isset(void *map, uint start, uint n) {
+  uint64_t *w = map, m;
+  uint lo, hi;
+
+  for (; n > 0; n -= hi - lo, start += hi - lo) {
+    lo = start % 64;
+    hi = lo + n < 64 ? lo + n : 64;
+    m = bmap_mask(lo, hi);
+    if ((w[start / 64] & m) != m)
+      return 0;
+  }
+  return 1;
+}
+
+// First bit at or after from, and before nbits, that equals val;
+// nbits if there is none.
+static inline uint bmap_next(void *map, uint from, uint nbits, int val) {
+  uint64_t *w = map, x;
+
+  while (from < nbits) {
+    x = val ? w[from / 64] : ~w[from / 64];
+    x &= ~(uint64_t)0 << (from % 64);
+    if (x) {
+      from = (from & ~63u) + __builtin_ctzll(x);
+      return from < nbits ? from : nbits;
+    }
+    from = (from & ~63u) + 64;
+  }
+  return nbits;
+}
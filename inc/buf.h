@@ -5,10 +5,14 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
+  uint logseq;      // last log transaction holding this block
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash chain
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uchar *data;       // BSIZE bytes in a page owned by the cache
 };
 #define B_VALID 0x2 // buffer has been read from disk
 #define B_DIRTY 0x4 // buffer needs to be written to disk
+#define B_ASYNC 0x8 // read started by bprefetch; nobody waits for it
+#define B_LOGGED 0x10 // pinned by the log until the next checkpoint
@@ -3,8 +3,11 @@
 
 struct buf;
 struct context;
+struct cpage;
 struct extent;
 struct inode;
+struct kmem_cache;
+struct pcifunc;
 struct proc;
 struct rtcdate;
 struct spinlock;
@@ -20,8 +23,12 @@ extern int npages;
 extern int pages_in_use;
 extern int pages_in_swap;
 extern int free_pages;
+extern int free_blocks[];
+extern int heap_unfilled;
 extern int num_page_faults;
 extern int num_disk_reads;
+extern int num_bcache_hits;
+extern int num_bcache_misses;
 
 extern int crashn_enable;
 extern int crashn;
@@ -45,8 +52,16 @@ extern int crashn;
 // bio.c
 void binit(void);
 struct buf *bread(uint, uint);
+struct buf *bgetblk(uint, uint);
 void brelse(struct buf *);
 void bwrite(struct buf *);
+void bwritev(struct buf **, int);
+void bprefetch(uint, uint);
+void bpin(struct buf *);
+void bunpin(struct buf *);
+void biodone(struct buf *);
+void bfill(uint, uint *, int, char *);
+int bshrink(void);
 void print_data_at_block(uint);
 
 // console.c
@@ -55,15 +70,39 @@ void cprintf(char *, ...);
 void consoleintr(int (*)(void));
 noreturn void panic(char *);
 
+// dcache.c
+void dcinit(void);
+int dclookup(uint, uint, char *, uint *);
+void dcenter(uint, uint, char *, uint);
+
 // exec.c
 int exec(char *, char **);
 
+// extalloc.c
+void extinit(void);
+void extfree(uint, uint);
+void extrsvfree(uint, uint, uint);
+uint extalloc(uint, uint *);
+int extallocat(uint, uint);
+uint extgen(void);
+uint extlost(void);
+void extreset(void);
+
+// file.c
+void fileinit(void);
+
 // fs.c
 void readsb(int dev, struct superblock *sb);
 struct inode *dirlookup(struct inode *, char *, uint *);
+int dirlink(struct inode *, char *, uint);
+void dirindex(struct inode *);
+int dirunlink(struct inode *, char *);
 struct inode *rootlookup(char *);
 struct inode *idup(struct inode *);
+uint ialloc(uint, short);
+void iunalloc(uint, uint);
 void iinit(int dev);
+int ishrink(void);
 void irelease(struct inode *);
 void locki(struct inode *);
 void unlocki(struct inode *);
@@ -72,15 +111,22 @@ struct inode *namei(char *);
 struct inode *nameiparent(char *, char *);
 int concurrent_readi(struct inode *, char *, uint, uint);
 int readi(struct inode *, char *, uint, uint);
+void ireadahead(struct inode *, uint, uint);
+char *ipagemap(struct inode *, uint);
 void concurrent_stati(struct inode *, struct stat *);
 void stati(struct inode *, struct stat *);
 int concurrent_writei(struct inode *, char *, uint, uint);
 int writei(struct inode *, char *, uint, uint);
+void begin_op(void);
+void begin_opn(int);
+void end_op(void);
 
 // ide.c
 void ideinit(void);
 void ideintr(void);
 void iderw(struct buf *);
+void iderw_async(struct buf *);
+void iderwv(struct buf **, int);
 
 // ioapic.c
 void ioapicenable(int irq, int cpu);
@@ -92,6 +138,11 @@ struct core_map_entry *pa2page(uint64_t pa);
 void detect_memory(void);
 char *kalloc(void);
 void kfree(char *);
+void kref(char *);
+char *kzalloc(void);
+void kzeroidle(void);
+char *kallocpages(int);
+void kfreepages(char *, int);
 void mem_init(void *);
 void mark_user_mem(uint64_t, uint64_t);
 void mark_kernel_mem(uint64_t);
@@ -123,9 +174,14 @@ void                vspacemarknotpresent(struct vspace *, uint64_t);
 void                vspaceinstall(struct proc *);
 void                vspaceinstallkern(void);
 void                vspacefree(struct vspace *);
+int                 vspacemmap(struct vspace *, struct inode *, uint, uint64_t, short);
+int                 vspacemunmap(struct vspace *, uint64_t);
+int                 vregionfault(struct vspace *, struct vregion *, uint64_t, uint64_t);
 struct vregion*     va2vregion(struct vspace *, uint64_t);
 struct vpage_info*  va2vpage_info(struct vregion *, uint64_t);
 int                 vregioncontains(struct vregion *, uint64_t, int);
+int                 vregionused(struct vregion *);
+int                 vregionunfilled(struct vregion *);
 int                 vspacecopy(struct vspace *, struct vspace *);
 int                 vspaceinitstack(struct vspace *, uint64_t);
 int                 vspacewritetova(struct vspace *, uint64_t, char *, int);
@@ -134,6 +190,19 @@ void                vspacedumpcode(struct vspace *);
 int                 vregionaddmap(struct vregion *, uint64_t, uint64_t, short, short);
 int                 vregiondelmap(struct vregion *, uint64_t, uint64_t);
 
+// pcache.c
+void pcinit(void);
+struct cpage *pcget(uint, uint, uint);
+void pcrelease(struct cpage *);
+void pcwrite(uint, uint, uint, char *, uint);
+void pcinval(uint, uint);
+int pcshrink(void);
+
+// pci.c
+uint pciread(struct pcifunc *, uint);
+void pciwrite(struct pcifunc *, uint, uint);
+int pcifind(uchar, uchar, struct pcifunc *);
+
 // picirq.c
 void picenable(int);
 void picinit(void);
@@ -163,6 +232,7 @@ void getcallerpcs(void *, uint64_t *);
 int holding(struct spinlock *);
 void initlock(struct spinlock *, char *);
 void release(struct spinlock *);
+int tryacquire(struct spinlock *);
 void pushcli(void);
 void popcli(void);
 
@@ -172,6 +242,14 @@ void releasesleep(struct sleeplock *);
 int holdingsleep(struct sleeplock *);
 void initsleeplock(struct sleeplock *, char *);
 
+// slab.c
+void slabinit(void);
+struct kmem_cache *kmem_cache_create(char *, uint, void (*)(void *));
+void *kmem_cache_alloc(struct kmem_cache *);
+void kmem_cache_free(struct kmem_cache *, void *);
+int slabshrink(void);
+void slabdump(void);
+
 // string.c
 int memcmp(const void *, const void *, uint);
 void *memmove(void *, const void *, uint);
@@ -12,11 +12,26 @@ struct inode {
   int ref;   // Reference count
   int valid; // Flag for if node is valid
   struct sleeplock lock;
+  struct inode *hnext; // hash chain
+  struct inode *prev;  // LRU list, while ref is 0
+  struct inode *next;
 
   short type; // copy of disk inode
   short devid;
   uint size;
   struct extent data[MAXEXTENT];
+  uint extroot;
+  uint dirroot;
+
+  uint extsum[MAXEXTENT]; // file block just past each extent in data
+  uint curfblk;  // run of blocks bmap last resolved: first file block,
+  uint curpblk;  //   first disk block
+  uint curlen;   //   and length, 0 if none
+
+  uint rsvstart; // free blocks set aside for the next append,
+  uint rsvlen;   //   not yet marked in the bitmap,
+  uint rsvgen;   //   in this free extent index generation
+  uint rsvwin;   // blocks to set aside next time
 };
 
 // file 
@@ -26,6 +41,9 @@ struct file_info {
   int offset;  // Offset in file
   int mode;     // Modes (eg. O_RDONLY, O_WRONLY, ...)
   int ref;       // Reference count
+  uint ra_off;   // Offset a sequential read would continue from
+  uint ra_next;  // Read-ahead has been issued up to this offset
+  int ra_win;    // Read-ahead window in blocks, 0 if not sequential
   int is_pipe; // if 1 then is pipe otherwise 0 
   struct file_pipe* pipe;
 };
@@ -61,4 +79,5 @@ int filedup(int fd);
 int filestat(int fd, struct stat* fstat);
 int fileclose(int fd);
 int filepipe(int * fds);
+int filemmap(int fd, int off, int n, int prot);
 
@@ -11,7 +11,7 @@
 #define MAXEXTENT 30   // max extents
 
 // Disk layout:
-// [ boot block | super block | free bit map |
+// [ boot block | super block | log | free bit map | inode bit map |
 //                                          inode file | data blocks]
 //
 // mkfs computes the super block and builds an initial file system. The
@@ -19,8 +19,10 @@
 struct superblock {
   uint size;       // Size of file system image (blocks)
   uint nblocks;    // Number of data blocks
-  uint logstart;
+  uint logstart;   // Block number of the log super block
+  uint nlog;       // Number of log blocks, super block included
   uint bmapstart;  // Block number of first free map block
+  uint imapstart;  // Block number of first inode map block
   uint inodestart; // Block number of the start of inode file
 };
 
@@ -30,7 +32,41 @@ struct dinode {
   short devid;        // Device number (T_DEV only)
   uint size;          // Size of file (bytes)
   struct extent data[MAXEXTENT]; // Data blocks of file on disk
-  char pad[8];       // So disk inodes fit contiguosly in a block
+  uint extroot;       // Extent tree holding the extents past data, or 0
+  uint dirroot;       // Hash index of a large directory, or 0
+};
+
+// A file's extents past the MAXEXTENT in its dinode live in a
+// B+-tree of extent blocks keyed by the file block each extent
+// starts at.  Leaves (level 0) hold the extents; index blocks hold
+// the first file block under each child.  Entries are sorted, and
+// since files only grow at the end the tree only grows at its right
+// edge: a full block gets a new right sibling rather than splitting.
+#define EXTMAGIC 0x7865
+#define EXTMAXDEPTH 5 // levels, leaves included
+
+struct extleaf {
+  uint fblk;        // first file block of the extent
+  uint startblkno;
+  uint nblocks;
+};
+
+struct extindex {
+  uint fblk;        // first file block under child
+  uint child;
+};
+
+#define NEXTLEAF ((BSIZE - 8) / sizeof(struct extleaf))
+#define NEXTINDEX ((BSIZE - 8) / sizeof(struct extindex))
+
+struct extblock {
+  ushort magic;
+  ushort level;     // 0 for leaves
+  uint n;           // entries in use
+  union {
+    struct extleaf leaf[NEXTLEAF];
+    struct extindex index[NEXTINDEX];
+  };
 };
 
 // offset of inode in inodefile
@@ -42,6 +78,14 @@ struct dinode {
 // Block of free map containing bit for block b
 #define BBLOCK(b, sb) ((b) / BPB + (sb).bmapstart)
 
+// Free map blocks in the file system
+#define NBITMAP (FSSIZE / BPB + 1)
+
+// Inode map blocks, with a bit set for each inum in use, and the
+// most inodes the file system can hold.  dirent.inum is a ushort.
+#define NIMAP 4
+#define MAXINODE (NIMAP * BPB)
+
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
 
@@ -50,9 +94,62 @@ struct dirent {
   char name[DIRSIZ];
 };
 
-struct commit_block {
-  uint size;
-  uint commit_flag;       // indicates whether we are ready to commit or not
-  uint target[LOGSIZE]; // 30 represents the log size
-  char padding[BSIZE - sizeof(uint) * (LOGSIZE + 2)];
+// A directory that grows to DIRINDEXMIN blocks also gets a hash
+// index, rooted at its dinode's dirroot.  The root splits names by
+// hash into NDIRBUCKET buckets, each a chain of blocks listing (name
+// hash, dirent slot) pairs, and keeps one more chain of free slots.
+// The entries themselves stay authoritative: an index that cannot
+// be updated is dropped, and rebuilt in a transaction of its own
+// after the next create in the directory.
+#define DIRINDEXMIN 8
+#define DIRMAGIC 0x64697278
+#define NDIRBUCKET ((BSIZE - 2 * sizeof(uint)) / sizeof(uint))
+
+struct dirroot {
+  uint magic;
+  uint free;               // chain of free slots
+  uint bucket[NDIRBUCKET]; // chain of each bucket
+};
+
+#define NDIRSLOT ((BSIZE - 2 * sizeof(uint)) / (2 * sizeof(uint)))
+
+struct dirchain {
+  uint next; // next block in the chain, or 0
+  uint n;    // entries in use
+  struct {
+    uint hash;
+    uint slot;
+  } ent[NDIRSLOT];
+};
+
+// Most log blocks building an index of an nblk-block directory can
+// write: the dinode, the root, a block per bucket, the overflow of
+// the chains and the bitmap.
+#define DIRINDEXOPS(nblk)                                                \
+  (2 + NDIRBUCKET + (nblk) * (BSIZE / sizeof(struct dirent)) / NDIRSLOT + \
+   NBITMAP)
+
+// The log is a super block followed by a circular area of
+// nlog - 1 blocks.  Each committed transaction in the area is a run
+// of descriptor blocks, each followed by the data blocks whose home
+// locations it lists.  Replay starts at the transaction named by the
+// log super block and continues while the next one has the following
+// sequence number and a matching checksum.
+#define LOGMAGIC 0x4c4f4721
+
+struct logsuper {
+  uint magic;
+  uint start; // offset in the area of the oldest live transaction
+  uint seq;   // its sequence number
+};
+
+// Block numbers per descriptor
+#define LOGDESCN ((BSIZE - 4 * sizeof(uint)) / sizeof(uint))
+
+struct logdesc {
+  uint magic;
+  uint seq;              // transaction sequence number
+  uint nblocks;          // data blocks in the whole transaction
+  uint checksum;         // over all targets and data of the transaction
+  uint target[LOGDESCN]; // home locations of the data blocks that follow
 };
\ No newline at end of file
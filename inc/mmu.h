@@ -150,12 +150,20 @@ struct segdesc {
         dpl, 1, (uint)(lim) >> 16, 0, 0, 0, 0, (uint)(base) >> 24              \
   }
 
+// core_map_entry states
+#define PG_USED 0 // allocated, or never given to the allocator
+#define PG_FREE 1 // free
+#define PG_ZERO 2 // free, and known to hold zeroes
+
 struct core_map_entry {
-  int available;
+  short state;  // PG_USED, PG_FREE or PG_ZERO
   short user;   // 0 if kernel allocated memory, otherwise is user
   uint64_t va;  // if it is used by kernel only, this field is 0
 
   short ref;    // reference count
+  struct core_map_entry *next; // free list, while free
+  struct core_map_entry *prev;
+  short order;  // order of the free buddy block this page heads, or -1
 };
 
 #endif
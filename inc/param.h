@@ -4,15 +4,15 @@
 #define NPROC 64       // maximum number of processes
 #define NCPU 8         // maximum number of CPUs
 #define NOFILE 16      // open files per process
-#define NFILE 100      // open files per system
-#define NINODE 50      // maximum number of active i-nodes
+#define NINODE 50      // minimum number of cached i-nodes
 #define NDEV 10        // maximum major device number
 #define ROOTDEV 1      // device number of file system root disk
 #define MAXARG 32      // max exec arguments
-#define MAXOPBLOCKS 10 // max # of blocks any FS op writes
+#define MAXOPBLOCKS 10 // max # of blocks most FS ops write
 
-#define LOGSIZE (MAXOPBLOCKS * 3) // max data blocks in on-disk log
-#define NBUF (MAXOPBLOCKS * 3)    // size of disk block cache
+#define LOGSIZE 1024                // max blocks in on-disk log
+#define MAXWRITEOP (LOGSIZE / 4)    // max # of blocks one write() logs at once
+#define NBUF (MAXOPBLOCKS * 3)      // minimum size of disk block cache
 #define FSSIZE 100000             // size of file system in blocks
 #define MAXCODEPAGES 256
 #define MAXPATHLEN 20
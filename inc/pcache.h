@@ -0,0 +1,14 @@
+#pragma once
+
+// A page of file contents in the page cache.
+struct cpage {
+  uint dev;
+  uint inum;          // 0 if the page belongs to no file
+  uint pgno;          // page number in the file
+  int ref;            // users; protected by pcache.lock
+  int valid;          // data has been filled from the file
+  char *data;         // PGSIZE bytes, or 0 if not allocated yet
+  struct cpage *hnext; // hash chain
+  struct cpage *prev;  // LRU list
+  struct cpage *next;
+};
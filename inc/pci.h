@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cdefs.h>
+
+// Configuration space registers.
+#define PCI_ID 0x00       // vendor (low 16 bits), device (high)
+#define PCI_COMMAND 0x04  // command (low 16 bits), status (high)
+#define PCI_CLASS 0x08    // revision, prog if, subclass, class
+#define PCI_HEADER 0x0c   // header type in bits 16-23
+#define PCI_BAR(n) (0x10 + 4 * (n))
+
+#define PCI_COMMAND_IO 0x1     // respond to I/O space accesses
+#define PCI_COMMAND_MASTER 0x4 // allow bus mastering
+
+#define PCI_CLASS_STORAGE 0x01
+#define PCI_SUBCLASS_IDE 0x01
+
+// A function on the PCI bus.
+struct pcifunc {
+  uint bus;
+  uint dev;
+  uint func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;
+};
@@ -1,9 +1,14 @@
 #pragma once
 
+#define NORDER 11 // page allocator block sizes: 2^0 to 2^10 pages
+
 struct sys_info {
   int pages_in_use;
   int pages_in_swap;
   int free_pages;
   int num_page_faults;
   int num_disk_reads;
+  int num_bcache_hits;
+  int num_bcache_misses;
+  int free_blocks[NORDER]; // free page blocks of each size
 };
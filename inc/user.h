@@ -28,6 +28,8 @@ int sleep(int);
 int uptime(void);
 int sysinfo(struct sys_info *);
 int crashn(int);
+char *mmap(int, int, int, int);
+int munmap(char *);
 
 // ulib.c
 int stat(char *, struct stat *);
@@ -3,14 +3,21 @@
 #include <defs.h>
 #include <mmu.h>
 
-#define NREGIONS 3
+#define NMMAP 4
+#define NREGIONS (3 + NMMAP)
 
 enum {
   VR_CODE   = 0,
   VR_HEAP   = 1,
   VR_USTACK = 2,
+  VR_MMAP   = 3, // first of NMMAP file mappings
 };
 
+// File mapping i, if any, lives at MMAPBASE + i * MMAPMAX and is at
+// most MMAPMAX bytes long.  The heap may not grow past MMAPBASE.
+#define MMAPBASE SZ_1G
+#define MMAPMAX  (SZ_1G / 2 / NMMAP)
+
 #define VPI_PRESENT  ((short) 1)
 #define VPI_WRITABLE ((short) 1)
 #define VPI_READONLY ((short) 0)
@@ -47,6 +54,11 @@ struct vregion {
   uint64_t va_base;       // base of the region
   uint64_t size;          // size of region in bytes
   struct vpi_page *pages;  // pointer to array of page_infos
+
+  // file mappings only
+  struct inode *ip;        // mapped file, or 0
+  uint off;                // file offset mapped at va_base
+  short writable;          // private copy of a page made on first write
 };
 
 struct vspace {
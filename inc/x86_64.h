@@ -11,6 +11,13 @@ static inline uchar inb(ushort port) {
   return data;
 }
 
+static inline uint inl(ushort port) {
+  uint data;
+
+  asm volatile("in %1,%0" : "=a"(data) : "d"(port));
+  return data;
+}
+
 static inline void insl(int port, void *addr, int cnt) {
   asm volatile("cld; rep insl"
                : "=D"(addr), "=c"(cnt)
@@ -26,6 +33,10 @@ static inline void outw(ushort port, ushort data) {
   asm volatile("out %0,%1" : : "a"(data), "d"(port));
 }
 
+static inline void outl(ushort port, uint data) {
+  asm volatile("out %0,%1" : : "a"(data), "d"(port));
+}
+
 static inline void outsl(int port, const void *addr, int cnt) {
   asm volatile("cld; rep outsl"
                : "=S"(addr), "=c"(cnt)
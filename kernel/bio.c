@@ -1,9 +1,16 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
-// cached copies of disk block contents.  Caching disk blocks
-// in memory reduces the number of disk reads and also provides
-// a synchronization point for disk blocks used by multiple processes.
+// The buffer cache is a hash table of buf structures holding
+// cached copies of disk block contents, keyed on (dev, blockno).
+// Unused buffers are recycled in least recently used order.
+// Caching disk blocks in memory reduces the number of disk reads
+// and also provides a synchronization point for disk blocks used
+// by multiple processes.
+//
+// Buffers are carved out of kalloc() pages in chunks.  binit sizes
+// the cache from the amount of physical memory; bget grows it while
+// memory is plentiful, and kalloc calls bshrink to take clean chunks
+// back when it runs out of pages.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
@@ -21,6 +28,7 @@
 #include <cdefs.h>
 #include <defs.h>
 #include <fs.h>
+#include <mmu.h>
 #include <param.h>
 #include <sleeplock.h>
 #include <spinlock.h>
@@ -32,79 +40,433 @@ int crashn = 0;
 
 int num_disk_reads = 0;
 
-struct {
+// Number of hash buckets.  Prime, so block numbers spread evenly.
+#define NBUCKET 61
+
+// A hash chain of cached buffers, linked through hnext.
+// The bucket lock protects chain membership and the refcnt of every
+// buffer in the chain.
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
+
+// The cache starts at 1/BCACHE_INITFRAC of physical memory and grows
+// up to 1/BCACHE_MAXFRAC while free memory stays above the initial size.
+#define BCACHE_INITFRAC 16
+#define BCACHE_MAXFRAC 4
+
+// A chunk is a page holding buffer headers plus the data pages
+// backing them.  The cache grows and shrinks one chunk at a time.
+#define BCHUNKPAGES 2
+#define BPERCHUNK (BCHUNKPAGES * PGSIZE / BSIZE)
+
+struct bchunk {
+  struct bchunk *next;
+  char *data[BCHUNKPAGES];
+  struct buf buf[BPERCHUNK];
+};
+static_assert(sizeof(struct bchunk) <= PGSIZE, "bchunk must fit in a page");
+
+// Updated under different bucket locks, so bumped atomically.
+int num_bcache_hits = 0;
+int num_bcache_misses = 0;
+
+struct {
+  struct spinlock lock; // protects the LRU list and chunk list;
+                        // serializes eviction
+  struct bchunk *chunks;
+  int nbuf;   // buffers currently in the cache
+  int maxbuf; // grow on a miss only below this size
+  struct bucket bucket[NBUCKET];
 
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
 } bcache;
 
-void binit(void) {
+static struct bucket *bhash(uint dev, uint blockno) {
+  return &bcache.bucket[(dev * 31 + blockno) % NBUCKET];
+}
+
+// Find the buffer for block on device dev in bkt.
+// Caller must hold bkt->lock.
+static struct buf *blookup(struct bucket *bkt, uint dev, uint blockno) {
+  struct buf *b;
+
+  for (b = bkt->head; b; b = b->hnext)
+    if (b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Remove b from bkt's chain, if it is there.
+// Caller must hold bkt->lock.
+static void bunhash(struct bucket *bkt, struct buf *b) {
+  struct buf **pp;
+
+  for (pp = &bkt->head; *pp; pp = &(*pp)->hnext) {
+    if (*pp == b) {
+      *pp = b->hnext;
+      b->hnext = 0;
+      return;
+    }
+  }
+}
+
+// Move b to the head of the LRU list.
+// Caller must hold bcache.lock.
+static void bmru(struct buf *b) {
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  b->next = bcache.head.next;
+  b->prev = &bcache.head;
+  bcache.head.next->prev = b;
+  bcache.head.next = b;
+}
+
+// Add a chunk of unused buffers at the tail of the LRU list,
+// so they are the first to be recycled.
+// Caller must hold bcache.lock.
+static int bgrow(void) {
+  struct bchunk *c;
+  struct buf *b;
+  int i;
+
+  if ((c = (struct bchunk *)kzalloc()) == 0)
+    return -1;
+  for (i = 0; i < BCHUNKPAGES; i++) {
+    if ((c->data[i] = kalloc()) == 0) {
+      while (--i >= 0)
+        kfree(c->data[i]);
+      kfree((char *)c);
+      return -1;
+    }
+  }
+
+  for (i = 0; i < BPERCHUNK; i++) {
+    b = &c->buf[i];
+    b->data = (uchar *)c->data[i / (PGSIZE / BSIZE)] + (i % (PGSIZE / BSIZE)) * BSIZE;
+    initsleeplock(&b->lock, "buffer");
+    b->prev = bcache.head.prev;
+    b->next = &bcache.head;
+    bcache.head.prev->next = b;
+    bcache.head.prev = b;
+  }
+  c->next = bcache.chunks;
+  bcache.chunks = c;
+  bcache.nbuf += BPERCHUNK;
+  return 0;
+}
+
+// Take every buffer in c out of the hash table and the LRU list.
+// Fails, leaving the buffers it already took out invalid but
+// usable, if any of them is referenced or dirty.
+// Caller must hold bcache.lock.
+static int bdetach(struct bchunk *c) {
+  struct bucket *bkt;
   struct buf *b;
 
+  for (b = c->buf; b < c->buf + BPERCHUNK; b++) {
+    bkt = bhash(b->dev, b->blockno);
+    acquire(&bkt->lock);
+    if (b->refcnt != 0 || (b->flags & B_DIRTY)) {
+      release(&bkt->lock);
+      return -1;
+    }
+    bunhash(bkt, b);
+    b->dev = 0;
+    b->blockno = 0;
+    b->flags = 0;
+    release(&bkt->lock);
+  }
+
+  for (b = c->buf; b < c->buf + BPERCHUNK; b++) {
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+  }
+  return 0;
+}
+
+// Give one unused chunk of buffers back to the page allocator.
+// Called by kalloc when it runs out of pages.
+// Returns the number of pages freed.
+int bshrink(void) {
+  struct bchunk *c, **pp;
+  int i;
+
+  // The holder may be in bgrow, or in kalloc waiting on a lock this
+  // CPU holds; back off rather than spin.
+  if (!tryacquire(&bcache.lock))
+    return 0;
+
+  for (pp = &bcache.chunks; (c = *pp) != 0; pp = &c->next) {
+    if (bcache.nbuf - BPERCHUNK < NBUF)
+      break;
+    if (bdetach(c) == 0) {
+      *pp = c->next;
+      bcache.nbuf -= BPERCHUNK;
+      release(&bcache.lock);
+      for (i = 0; i < BCHUNKPAGES; i++)
+        kfree(c->data[i]);
+      kfree((char *)c);
+      return BCHUNKPAGES + 1;
+    }
+  }
+  release(&bcache.lock);
+  return 0;
+}
+
+void binit(void) {
+  struct bucket *bkt;
+  int nbuf;
+
   initlock(&bcache.lock, "bcache");
+  for (bkt = bcache.bucket; bkt < bcache.bucket + NBUCKET; bkt++) {
+    initlock(&bkt->lock, "bcache.bucket");
+    bkt->head = 0;
+  }
 
   // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for (b = bcache.buf; b < bcache.buf + NBUF; b++) {
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+
+  nbuf = max(NBUF, npages / BCACHE_INITFRAC * (PGSIZE / BSIZE));
+  bcache.maxbuf = max(nbuf, npages / BCACHE_MAXFRAC * (PGSIZE / BSIZE));
+  acquire(&bcache.lock);
+  while (bcache.nbuf < nbuf) {
+    if (bgrow() < 0) {
+      if (bcache.nbuf < NBUF)
+        panic("binit: no memory for buffers");
+      break;
+    }
   }
+  release(&bcache.lock);
+  cprintf("bcache: %d buffers, max %d\n", bcache.nbuf, bcache.maxbuf);
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
+// Look up the block on device dev in the hash table.
+// If not found, recycle the least recently used unused buffer.
 // In either case, return locked buffer.
-static struct buf *bget(uint dev, uint blockno) {
+// With prefetch set, return 0 instead if the block is already
+// cached or no buffer is free.
+static struct buf *bget(uint dev, uint blockno, int prefetch) {
+  struct bucket *bkt, *old;
   struct buf *b;
 
-  acquire(&bcache.lock);
+  bkt = bhash(dev, blockno);
 
   // Is the block already cached?
-  for (b = bcache.head.next; b != &bcache.head; b = b->next) {
-    if (b->dev == dev && b->blockno == blockno) {
-      b->refcnt++;
+  acquire(&bkt->lock);
+  if ((b = blookup(bkt, dev, blockno)) != 0) {
+    if (prefetch) {
+      release(&bkt->lock);
+      return 0;
+    }
+    b->refcnt++;
+    __sync_fetch_and_add(&num_bcache_hits, 1);
+    release(&bkt->lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+  release(&bkt->lock);
+
+  // Not cached.  Holding bcache.lock keeps anyone else from
+  // recycling a buffer for this block, so look once more
+  // before picking a victim.
+  acquire(&bcache.lock);
+  acquire(&bkt->lock);
+  if ((b = blookup(bkt, dev, blockno)) != 0) {
+    if (prefetch) {
+      release(&bkt->lock);
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      return 0;
     }
+    b->refcnt++;
+    __sync_fetch_and_add(&num_bcache_hits, 1);
+    release(&bkt->lock);
+    release(&bcache.lock);
+    acquiresleep(&b->lock);
+    return b;
   }
 
-  // Not cached; recycle some unused buffer and clean buffer
+  // Grow the cache rather than evict while memory is plentiful.
+  if (bcache.nbuf < bcache.maxbuf && free_pages > npages / BCACHE_INITFRAC)
+    bgrow();
+
+  // Recycle the least recently used unused and clean buffer.
   // "clean" because B_DIRTY and not locked means log.c
   // hasn't yet committed the changes to the buffer.
+  // If every buffer is in use, grow past the limit.
+retry:
   for (b = bcache.head.prev; b != &bcache.head; b = b->prev) {
+    old = bhash(b->dev, b->blockno);
+    if (old != bkt)
+      acquire(&old->lock);
     if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+      bunhash(old, b);
+      if (old != bkt)
+        release(&old->lock);
       b->dev = dev;
       b->blockno = blockno;
       b->flags = 0;
       b->refcnt = 1;
+      b->hnext = bkt->head;
+      bkt->head = b;
+      __sync_fetch_and_add(&num_bcache_misses, 1);
+      release(&bkt->lock);
+      bmru(b);
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
     }
+    if (old != bkt)
+      release(&old->lock);
   }
+  if (prefetch) {
+    release(&bkt->lock);
+    release(&bcache.lock);
+    return 0;
+  }
+  if (bgrow() == 0)
+    goto retry;
   panic("bget: no buffers");
 }
 
+// Drop a reference to an unlocked buffer.
+static void bunref(struct buf *b) {
+  struct bucket *bkt;
+  int unused;
+
+  // We still hold a reference, so b cannot be recycled
+  // and its bucket cannot change underneath us.
+  bkt = bhash(b->dev, b->blockno);
+  acquire(&bkt->lock);
+  b->refcnt--;
+  unused = (b->refcnt == 0);
+  release(&bkt->lock);
+
+  if (unused) {
+    // no one is waiting for it.  The LRU order is only a hint,
+    // so it is fine if b was reused before we got here.
+    acquire(&bcache.lock);
+    bmru(b);
+    release(&bcache.lock);
+  }
+}
+
 // Return a locked buf with the contents of the indicated block.
 struct buf *bread(uint dev, uint blockno) {
   num_disk_reads += 1;
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if (!(b->flags & B_VALID)) {
     iderw(b);
   }
   return b;
 }
 
+// Keep b in the cache until the matching bunpin, even after it is
+// released.  Used by the log for blocks whose home copy is stale.
+// Caller must hold b's lock.
+void bpin(struct buf *b) {
+  struct bucket *bkt;
+
+  if (!holdingsleep(&b->lock))
+    panic("bpin");
+  bkt = bhash(b->dev, b->blockno);
+  acquire(&bkt->lock);
+  b->refcnt++;
+  release(&bkt->lock);
+}
+
+void bunpin(struct buf *b) { bunref(b); }
+
+// Start reading the indicated block into the cache without
+// waiting for it.  Does nothing if the block is already cached
+// or every buffer is in use.
+void bprefetch(uint dev, uint blockno) {
+  struct buf *b;
+
+  if ((b = bget(dev, blockno, 1)) == 0)
+    return;
+
+  // Someone may have found the new buffer and read it
+  // before we got the lock.
+  if (b->flags & B_VALID) {
+    brelse(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderw_async(b);
+}
+
+// Called by the disk driver when an asynchronous read of b
+// completes.  Drops the lock and reference taken by bprefetch.
+// May run in an interrupt handler.
+void biodone(struct buf *b) {
+  releasesleep(&b->lock);
+  bunref(b);
+}
+
+// Return a locked buffer for the indicated block without reading
+// it from disk.  The caller must overwrite all of b->data.
+struct buf *bgetblk(uint dev, uint blockno) {
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Fill dst with blocks blks[0..n) of dev, BSIZE bytes apiece, for
+// the page cache.  Blocks in the buffer cache, whose copies may be
+// newer than the disk's, are copied from there; the rest are read by
+// the disk straight into dst in one batch, without passing through
+// the cache.  A block number of 0 reads as zeroes.
+void bfill(uint dev, uint *blks, int n, char *dst) {
+  struct buf raw[PGSIZE / BSIZE], *rawp[PGSIZE / BSIZE];
+  struct bucket *bkt;
+  struct buf *b;
+  int i, nraw;
+
+  if (n > PGSIZE / BSIZE)
+    panic("bfill");
+
+  nraw = 0;
+  for (i = 0; i < n; i++, dst += BSIZE) {
+    if (blks[i] == 0) {
+      memset(dst, 0, BSIZE);
+      continue;
+    }
+    bkt = bhash(dev, blks[i]);
+    acquire(&bkt->lock);
+    if ((b = blookup(bkt, dev, blks[i])) != 0 && (b->flags & B_VALID)) {
+      b->refcnt++;
+      release(&bkt->lock);
+      acquiresleep(&b->lock);
+      memmove(dst, b->data, BSIZE);
+      brelse(b);
+      continue;
+    }
+    release(&bkt->lock);
+
+    b = &raw[nraw];
+    memset(b, 0, sizeof(*b));
+    initsleeplock(&b->lock, "rawbuf");
+    acquiresleep(&b->lock);
+    b->dev = dev;
+    b->blockno = blks[i];
+    b->data = (uchar *)dst;
+    rawp[nraw++] = b;
+  }
+  if (nraw > 0)
+    iderwv(rawp, nraw);
+  for (i = 0; i < nraw; i++)
+    releasesleep(&raw[i].lock);
+}
+
 // Write b's contents to disk.  Must be locked.
 void bwrite(struct buf *b) {
   if (crashn_enable) {
@@ -118,6 +480,27 @@ void bwrite(struct buf *b) {
   iderw(b);
 }
 
+// Write n locked buffers to disk together, so that the driver can
+// merge adjacent blocks into one command.
+void bwritev(struct buf **bs, int n) {
+  int i;
+
+  for (i = 0; i < n; i++) {
+    if (!holdingsleep(&bs[i]->lock))
+      panic("bwritev");
+    bs[i]->flags |= B_DIRTY;
+  }
+  if (crashn_enable) {
+    if (crashn < n) {
+      // Only the first crashn writes reach the disk.
+      iderwv(bs, crashn > 0 ? crashn : 0);
+      reboot();
+    }
+    crashn -= n;
+  }
+  iderwv(bs, n);
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void brelse(struct buf *b) {
@@ -125,20 +508,7 @@ void brelse(struct buf *b) {
     panic("brelse");
 
   releasesleep(&b->lock);
-
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-
-  release(&bcache.lock);
+  bunref(b);
 }
 
 // Print the data at the given block.
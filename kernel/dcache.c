@@ -0,0 +1,124 @@
+// Directory entry cache, used by dirlookup() in fs.c so that looking
+// up a hot path does not scan its directories.  Maps (dev, directory
+// inum, name) to the inum the name refers to, or to 0 for a name
+// known not to be there.  createi and fileunlink keep it coherent by
+// entering the names they add and remove.
+//
+// Entries live in a fixed table, hashed on (dev, directory inum,
+// name) and recycled in least recently used order.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <fs.h>
+#include <param.h>
+#include <spinlock.h>
+
+// Number of cached names, and of hash buckets.
+#define NDENTRY 128
+#define NDHASH 31
+
+struct dentry {
+  uint dev;
+  uint dir;             // inum of the directory, 0 if unused
+  char name[DIRSIZ];
+  uint inum;            // 0 for a negative entry
+  struct dentry *hnext; // hash chain
+  struct dentry *prev;  // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDENTRY];
+  struct dentry *hash[NDHASH];
+
+  // All entries, through prev/next.  head.next is most recently used.
+  struct dentry head;
+} dcache;
+
+static struct dentry **dchash(uint dev, uint dir, char *name) {
+  uint h;
+  int i;
+
+  h = dev * 31 + dir;
+  for (i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + (uchar)name[i];
+  return &dcache.hash[h % NDHASH];
+}
+
+// Caller must hold dcache.lock.
+static struct dentry *dcfind(uint dev, uint dir, char *name) {
+  struct dentry *d;
+
+  for (d = *dchash(dev, dir, name); d; d = d->hnext)
+    if (d->dev == dev && d->dir == dir && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Move d to the head of the LRU list.
+// Caller must hold dcache.lock.
+static void dcmru(struct dentry *d) {
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+}
+
+void dcinit(void) {
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.head.prev = &dcache.head;
+  dcache.head.next = &dcache.head;
+  for (d = dcache.dentry; d < dcache.dentry + NDENTRY; d++) {
+    d->next = dcache.head.next;
+    d->prev = &dcache.head;
+    dcache.head.next->prev = d;
+    dcache.head.next = d;
+  }
+}
+
+// Look up name in directory dir.  Returns 1 and sets *inum, to 0 if
+// the name is known to be absent, on a hit, and 0 on a miss.
+int dclookup(uint dev, uint dir, char *name, uint *inum) {
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if ((d = dcfind(dev, dir, name)) == 0) {
+    release(&dcache.lock);
+    return 0;
+  }
+  dcmru(d);
+  *inum = d->inum;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Record that name in directory dir refers to inum, or to nothing
+// if inum is 0.
+void dcenter(uint dev, uint dir, char *name, uint inum) {
+  struct dentry *d, **pp;
+
+  acquire(&dcache.lock);
+  if ((d = dcfind(dev, dir, name)) == 0) {
+    // Recycle the least recently used entry.
+    d = dcache.head.prev;
+    if (d->dir != 0) {
+      for (pp = dchash(d->dev, d->dir, d->name); *pp != d; pp = &(*pp)->hnext)
+        ;
+      *pp = d->hnext;
+    }
+    d->dev = dev;
+    d->dir = dir;
+    strncpy(d->name, name, DIRSIZ);
+    pp = dchash(dev, dir, name);
+    d->hnext = *pp;
+    *pp = d;
+  }
+  d->inum = inum;
+  dcmru(d);
+  release(&dcache.lock);
+}
@@ -0,0 +1,322 @@
+// Index of free disk extents, used by balloc() and bfree() in fs.c
+// so that allocation does not scan the bitmap.  The on-disk bitmap
+// stays authoritative; iinit rebuilds this index from it at mount.
+//
+// Every free run of blocks is one node, kept in two treaps at once:
+// one ordered by start block, to find the neighbours a freed run
+// merges with, and one ordered by (length, start), to find the
+// smallest run that satisfies a request.  Both take O(log n)
+// expected time per operation.  Nodes are carved out of kalloc'd
+// pages and recycled through a free list.
+//
+// A run freed when no node can be had is counted in nlost instead;
+// fs.c rebuilds the index from the bitmap once it needs those blocks.
+// A rebuild bumps gen, which voids the reservations handed out before
+// it: their blocks are free in the bitmap, so they are back in the
+// index already.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <mmu.h>
+#include <param.h>
+#include <spinlock.h>
+
+#define BYSTART 0
+#define BYSIZE 1
+
+struct extnode {
+  uint start;
+  uint len;
+  uint prio;
+  struct extnode *left[2]; // children in each treap
+  struct extnode *right[2];
+};
+
+struct {
+  struct spinlock lock;
+  struct extnode *root[2];
+  struct extnode *free; // unused nodes, chained through left[0]
+  uint seed;
+  uint nfree;           // free blocks in the index
+  uint nlost;           // free blocks left out of it, for want of nodes
+  uint gen;             // rebuilds so far
+} ext;
+
+static uint64_t extkey(int t, struct extnode *x) {
+  if (t == BYSTART)
+    return x->start;
+  return ((uint64_t)x->len << 32) | x->start;
+}
+
+// Split treap x into keys < key (*lo) and keys >= key (*hi).
+static void extsplit(int t, struct extnode *x, uint64_t key,
+                     struct extnode **lo, struct extnode **hi) {
+  if (x == 0) {
+    *lo = *hi = 0;
+  } else if (extkey(t, x) < key) {
+    extsplit(t, x->right[t], key, &x->right[t], hi);
+    *lo = x;
+  } else {
+    extsplit(t, x->left[t], key, lo, &x->left[t]);
+    *hi = x;
+  }
+}
+
+// Join treaps a and b, where every key in a is below every key in b.
+static struct extnode *extmerge(int t, struct extnode *a, struct extnode *b) {
+  if (a == 0)
+    return b;
+  if (b == 0)
+    return a;
+  if (a->prio > b->prio) {
+    a->right[t] = extmerge(t, a->right[t], b);
+    return a;
+  }
+  b->left[t] = extmerge(t, a, b->left[t]);
+  return b;
+}
+
+static void extinsert(int t, struct extnode *x) {
+  struct extnode *lo, *hi;
+
+  x->left[t] = x->right[t] = 0;
+  extsplit(t, ext.root[t], extkey(t, x), &lo, &hi);
+  ext.root[t] = extmerge(t, extmerge(t, lo, x), hi);
+}
+
+static void extremove(int t, struct extnode *x) {
+  struct extnode *lo, *mid, *hi;
+  uint64_t key = extkey(t, x);
+
+  extsplit(t, ext.root[t], key, &lo, &hi);
+  extsplit(t, hi, key + 1, &mid, &hi);
+  if (mid != x)
+    panic("extremove");
+  ext.root[t] = extmerge(t, lo, hi);
+}
+
+// Smallest node with key >= key, or 0.
+static struct extnode *extceil(int t, uint64_t key) {
+  struct extnode *x, *best = 0;
+
+  for (x = ext.root[t]; x;) {
+    if (extkey(t, x) >= key) {
+      best = x;
+      x = x->left[t];
+    } else {
+      x = x->right[t];
+    }
+  }
+  return best;
+}
+
+// Largest node with key < key, or 0.
+static struct extnode *extfloor(int t, uint64_t key) {
+  struct extnode *x, *best = 0;
+
+  for (x = ext.root[t]; x;) {
+    if (extkey(t, x) < key) {
+      best = x;
+      x = x->right[t];
+    } else {
+      x = x->left[t];
+    }
+  }
+  return best;
+}
+
+static struct extnode *extnodealloc(void) {
+  struct extnode *x;
+  char *p;
+  int i;
+
+  if (ext.free == 0) {
+    if ((p = kalloc()) == 0)
+      return 0;
+    for (i = 0; i + sizeof(*x) <= PGSIZE; i += sizeof(*x)) {
+      x = (struct extnode *)(p + i);
+      x->left[0] = ext.free;
+      ext.free = x;
+    }
+  }
+  x = ext.free;
+  ext.free = x->left[0];
+  ext.seed = ext.seed * 1103515245 + 12345;
+  x->prio = ext.seed >> 8;
+  return x;
+}
+
+static void extnodefree(struct extnode *x) {
+  x->left[0] = ext.free;
+  ext.free = x;
+}
+
+void extinit(void) {
+  initlock(&ext.lock, "extalloc");
+  ext.seed = 1;
+}
+
+// Add the free run [start, start+n) to the index, merging it with
+// the runs on either side.
+// Caller must hold ext.lock.
+static void extadd(uint start, uint n) {
+  struct extnode *prev, *next, *x;
+
+  prev = extfloor(BYSTART, start);
+  next = extceil(BYSTART, start);
+  if ((prev && prev->start + prev->len > start) ||
+      (next && start + n > next->start))
+    panic("extfree: freeing free block");
+
+  if (prev && prev->start + prev->len == start) {
+    extremove(BYSIZE, prev);
+    prev->len += n;
+    x = prev;
+  } else if (next && start + n == next->start) {
+    // Nothing lies between prev and next, so next keeps its place
+    // by start.
+    extremove(BYSIZE, next);
+    next->start = start;
+    next->len += n;
+    extinsert(BYSIZE, next);
+    ext.nfree += n;
+    return;
+  } else {
+    if ((x = extnodealloc()) == 0) {
+      // Out of memory: leave the run for the next rebuild.
+      ext.nlost += n;
+      return;
+    }
+    x->start = start;
+    x->len = n;
+    extinsert(BYSTART, x);
+  }
+  if (next && x->start + x->len == next->start) {
+    extremove(BYSIZE, next);
+    extremove(BYSTART, next);
+    x->len += next->len;
+    extnodefree(next);
+  }
+  extinsert(BYSIZE, x);
+  ext.nfree += n;
+}
+
+void extfree(uint start, uint n) {
+  if (n == 0)
+    return;
+
+  acquire(&ext.lock);
+  extadd(start, n);
+  release(&ext.lock);
+}
+
+// Give back a reservation taken out of the index in generation gen,
+// unless a rebuild has voided it since.
+void extrsvfree(uint start, uint n, uint gen) {
+  if (n == 0)
+    return;
+
+  acquire(&ext.lock);
+  if (gen == ext.gen)
+    extadd(start, n);
+  release(&ext.lock);
+}
+
+uint extgen(void) {
+  return ext.gen;
+}
+
+// Free blocks the index has lost track of.
+uint extlost(void) {
+  return ext.nlost;
+}
+
+static void extdrop(struct extnode *x) {
+  if (x == 0)
+    return;
+  extdrop(x->left[BYSTART]);
+  extdrop(x->right[BYSTART]);
+  extnodefree(x);
+}
+
+// Empty the index and start a new generation, to be refilled from
+// the bitmap.
+void extreset(void) {
+  acquire(&ext.lock);
+  extdrop(ext.root[BYSTART]);
+  ext.root[BYSTART] = ext.root[BYSIZE] = 0;
+  ext.nfree = 0;
+  ext.nlost = 0;
+  ext.gen++;
+  release(&ext.lock);
+}
+
+// Take n blocks from the smallest free run that holds them.  If no
+// run is that long, take all of the longest one instead.  Sets *start
+// and returns the number of blocks taken, 0 if there are none free.
+uint extalloc(uint n, uint *start) {
+  struct extnode *x;
+
+  acquire(&ext.lock);
+  if ((x = extceil(BYSIZE, (uint64_t)n << 32)) == 0 &&
+      (x = extfloor(BYSIZE, ~(uint64_t)0)) == 0) {
+    release(&ext.lock);
+    return 0;
+  }
+  extremove(BYSIZE, x);
+  if (n > x->len)
+    n = x->len;
+  *start = x->start;
+  if (n == x->len) {
+    extremove(BYSTART, x);
+    extnodefree(x);
+  } else {
+    // Still in the same place by start.
+    x->start += n;
+    x->len -= n;
+    extinsert(BYSIZE, x);
+  }
+  ext.nfree -= n;
+  release(&ext.lock);
+  return n;
+}
+
+// Take exactly the blocks [start, start+n), if they are all free.
+// Returns 0 on success, -1 otherwise.
+int extallocat(uint start, uint n) {
+  struct extnode *x, *rest;
+  uint end;
+
+  if (n == 0)
+    return -1;
+
+  acquire(&ext.lock);
+  x = extfloor(BYSTART, (uint64_t)start + 1);
+  if (x == 0 || (uint64_t)start + n > (uint64_t)x->start + x->len) {
+    release(&ext.lock);
+    return -1;
+  }
+  if (start + n < x->start + x->len && (rest = extnodealloc()) == 0) {
+    release(&ext.lock);
+    return -1;
+  }
+
+  end = x->start + x->len;
+  extremove(BYSIZE, x);
+  if (x->start < start) {
+    x->len = start - x->start;
+    extinsert(BYSIZE, x);
+  } else {
+    extremove(BYSTART, x);
+    extnodefree(x);
+  }
+  if (start + n < end) {
+    rest->start = start + n;
+    rest->len = end - rest->start;
+    extinsert(BYSTART, rest);
+    extinsert(BYSIZE, rest);
+  }
+  ext.nfree -= n;
+  release(&ext.lock);
+  return 0;
+}
@@ -13,14 +13,37 @@
 #include <spinlock.h>
 
 struct devsw devsw[NDEV];
-struct file_info file_table[NFILE];
 
-static int find_free_fd(int i, struct proc *proc);
-extern struct {
-  struct spinlock lock;
-  struct inode inode[NINODE];
-  struct inode inodefile;
-} icache;
+// Open files and pipe buffers come from these caches, so the number
+// of open files is limited only by memory.
+static struct kmem_cache *filecache;
+static struct kmem_cache *pipecache;
+
+// Read-ahead window bounds, in blocks.
+#define RA_MINWIN 4
+#define RA_MAXWIN 32
+
+static int find_free_fd(struct file_info *f, struct proc *proc);
+static int createi(char *path);
+
+// A free file_info is zeroed, apart from its lock.
+static void filector(void *p) {
+  struct file_info *f = p;
+
+  memset(f, 0, sizeof(*f));
+  initsleeplock(&f->lock, "file");
+}
+
+static void pipector(void *p) {
+  struct file_pipe *pipe = p;
+
+  initlock(&pipe->lock, "pipe");
+}
+
+void fileinit(void) {
+  filecache = kmem_cache_create("file", sizeof(struct file_info), filector);
+  pipecache = kmem_cache_create("pipe", sizeof(struct file_pipe), pipector);
+}
 
 // Finds an open spot in the process open file table and has it point the global open file table entry.
 // Finds an open entry in the global open file table and allocates a new file_info struct
@@ -39,13 +62,16 @@ int fileopen(char *path, int mode)
   }
   if (mode == (O_CREATE|O_RDONLY)) {
       mode = O_RDONLY;
-      createi(path);
+      if (createi(path) < 0)
+        return -1;
   } else if (mode == (O_CREATE|O_RDWR)) {
       mode = O_RDWR;
-      createi(path);
+      if (createi(path) < 0)
+        return -1;
   } else if (mode == (O_CREATE|O_WRONLY)) {
       mode = O_WRONLY;
-      createi(path);
+      if (createi(path) < 0)
+        return -1;
   }
   struct inode *inode = namei(path); // returns pointer to inode
   struct proc *proc = myproc();
@@ -60,39 +86,25 @@ int fileopen(char *path, int mode)
     return -1;
   }
 
-  int i = 0;
-  int fd = 0;
-  while (i < NFILE)
+  // no memory for another open file
+  struct file_info *f = kmem_cache_alloc(filecache);
+  if (f == NULL)
   {
-    if (file_table[i].inode_ptr == 0x0 &&
-        file_table[i].mode == 0 &&
-        file_table[i].offset == 0 &&
-        file_table[i].ref == 0)
-    {
-      initsleeplock(&file_table[i].lock, "file");
-      acquiresleep(&file_table[i].lock);
-      file_table[i].inode_ptr = inode;
-      file_table[i].mode = mode;
-      file_table[i].offset = 0;
-      file_table[i].ref = 1;
-      fd = find_free_fd(i, proc);
-      if (fd == -1)
-      {
-        unlocki(inode);
-        releasesleep(&file_table[i].lock);
-        return -1;
-      }
-      releasesleep(&file_table[i].lock);
-      break;
-    }
-    releasesleep(&file_table[i].lock);
-    i++;
+    unlocki(inode);
+    return -1;
   }
 
-  // no more file table space left
-  if (i == NFILE)
+  f->inode_ptr = inode;
+  f->mode = mode;
+  f->ref = 1;
+  int fd = find_free_fd(f, proc);
+  if (fd == -1)
   {
     unlocki(inode);
+    f->inode_ptr = NULL;
+    f->mode = 0;
+    f->ref = 0;
+    kmem_cache_free(filecache, f);
     return -1;
   }
 
@@ -100,7 +112,7 @@ int fileopen(char *path, int mode)
   return fd;
 }
 
-static int find_free_fd(int i, struct proc *proc)
+static int find_free_fd(struct file_info *f, struct proc *proc)
 {
   int j;
   j = 0;
@@ -108,7 +120,7 @@ static int find_free_fd(int i, struct proc *proc)
   {
     if (proc->fd_table[j] == NULL)
     {
-      proc->fd_table[j] = &file_table[i];
+      proc->fd_table[j] = f;
       break;
     }
     j++;
@@ -120,50 +132,77 @@ static int find_free_fd(int i, struct proc *proc)
   return j;
 }
 
-void createi(char *path) {
+// Create the file path if it does not exist yet.
+// Returns -1 if there is no inode or disk space left for it.
+static int createi(char *path) {
+  char name[DIRSIZ];
+  int r, build, unindexed;
   struct inode * inode = namei(path);
   if (inode != NULL) {
-    inode->ref -= 1;
-    return;
+    irelease(inode);
+    return 0;
   }
-  struct dinode di;
-  struct dirent de;
-  struct inode* dir = &icache.inode[0];
-  struct inode* inodefile = &icache.inodefile;
-  locki(inodefile);
+  struct inode* dir = nameiparent(path, name);
+  if (dir == NULL)
+    return -1;
+  // the inode map block, the new dinode and dirent, and updating
+  // the directory's index; the dirent that brings the directory to
+  // DIRINDEXMIN blocks builds the index too
   locki(dir);
-  int inum = 2;
-  for(inum; INODEOFF(inum) <= inodefile->size; inum++) {
-    if (INODEOFF(inum) != inodefile->size) {
-      readi(inodefile, (char *)&di, INODEOFF(inum), sizeof(di));
-    }
-    if ((di.size == 0 && di.type == 0) || INODEOFF(inum) == inodefile->size) {
-      di.size = 0;
-      di.devid = ROOTDEV;// T_DEV?
-      di.type = T_FILE;
-      for (int i = 0; i < MAXEXTENT; i++) {
-        di.data[i].nblocks = 0;
-        di.data[i].startblkno = 0;
-      }
-      // write the dinode to the file
-      writei(inodefile, (char*)&di, INODEOFF(inum), sizeof(di));
-      for (int off = 0; off <= dir->size; off+=sizeof(de)) {
-        if (off != dir->size) {
-          readi(dir, (char *)&de, off, sizeof(de));
-        }
-        if (de.inum == 0 || off==dir->size) {
-          de.inum = inum;
-          strncpy(de.name, path, strlen(path));
-          de.name[strlen(path)] = '\0';
-          writei(dir, (char*)&de, off, sizeof(de));
-          break;
-        }
-      }
+  for (;;) {
+    build = dir->size + sizeof(struct dirent) == DIRINDEXMIN * BSIZE;
+    unlocki(dir);
+    begin_opn(MAXOPBLOCKS + (build ? DIRINDEXOPS(DIRINDEXMIN) : 0));
+    locki(dir);
+    if (build || dir->size + sizeof(struct dirent) != DIRINDEXMIN * BSIZE)
       break;
-    }
+    // dir grew to the build size while unlocked
+    unlocki(dir);
+    end_op();
+    locki(dir);
+  }
+  r = -1;
+  unindexed = 0;
+  uint inum = ialloc(dir->dev, T_FILE);
+  if (inum != 0) {
+    r = dirlink(dir, name, inum);
+    // no room for the dirent: give the inode back
+    if (r < 0)
+      iunalloc(dir->dev, inum);
+    unindexed = dir->dirroot == 0 && dir->size >= DIRINDEXMIN * BSIZE;
   }
-  unlocki(inodefile);
   unlocki(dir);
+  end_op();
+  // its index was dropped; build another
+  if (unindexed)
+    dirindex(dir);
+  irelease(dir);
+  return r;
+}
+
+// Reads that pick up where the previous one ended double the
+// read-ahead window; anything else turns read-ahead off until
+// the access pattern is sequential again.
+// Caller must hold f->lock and ip->lock.
+static void filereadahead(struct file_info *f, struct inode *ip, uint off, int n)
+{
+  uint start, end;
+
+  if (off != f->ra_off) {
+    f->ra_win = 0;
+    f->ra_next = 0;
+    f->ra_off = off + n;
+    return;
+  }
+  f->ra_win = min(max(f->ra_win * 2, RA_MINWIN), RA_MAXWIN);
+  f->ra_off = off + n;
+
+  start = max(f->ra_off, f->ra_next);
+  end = f->ra_off + f->ra_win * BSIZE;
+  if (start < end) {
+    ireadahead(ip, start, end - start);
+    f->ra_next = end;
+  }
 }
 
 int fileread(char *src, int fd, int n)
@@ -206,7 +245,11 @@ int fileread(char *src, int fd, int n)
       return -1;
     }
     int off = fpointer->offset;
-    ret = concurrent_readi(ip, src, off, n);
+    locki(ip);
+    ret = readi(ip, src, off, n);
+    if (ret > 0)
+      filereadahead(fpointer, ip, off, ret);
+    unlocki(ip);
     fpointer->offset += ret;
     releasesleep(&fpointer -> lock);
   }
@@ -258,9 +301,29 @@ int filewrite(char *src, int fd, int n)
       releasesleep(&fpointer -> lock);
       return -1;
     }
-    int off = fpointer->offset;
-    ret = concurrent_writei(ip, src, off, n);
-    fpointer->offset += ret;
+    // Each transaction logs the data, plus up to two partial blocks
+    // at the ends, the dinode block, the bitmap blocks of however
+    // many free runs the new blocks come from, and the extent tree
+    // blocks: its rightmost path, a new block per level and a new
+    // leaf per NEXTLEAF extents added.  Only writes larger than
+    // MAXWRITEOP blocks are split.
+    int max = (MAXWRITEOP - 3 - NBITMAP - 4 * EXTMAXDEPTH) * BSIZE;
+    while (ret < n) {
+      int n1 = min(n - ret, max);
+      begin_opn(n1 / BSIZE + 3 + NBITMAP +
+                2 * EXTMAXDEPTH + 1 + n1 / BSIZE / NEXTLEAF);
+      int r = concurrent_writei(ip, src + ret, fpointer->offset, n1);
+      end_op();
+      if (r < 0) {
+        if (ret == 0)
+          ret = -1;
+        break;
+      }
+      fpointer->offset += r;
+      ret += r;
+      if (r != n1)
+        break;
+    }
     releasesleep(&fpointer -> lock);
   }
   return ret;
@@ -287,7 +350,7 @@ int fileclose(int fd)
     }
     if (fpointer->pipe->reader == 0 && fpointer->pipe->writer == 0) {
       release(&fpointer->pipe->lock);
-      kfree((char *)fpointer->pipe->buffer);
+      kmem_cache_free(pipecache, fpointer->pipe);
       fpointer -> pipe = NULL;
     } else {
       if (fpointer->pipe->writer == 0) {
@@ -309,8 +372,15 @@ int fileclose(int fd)
     fpointer -> inode_ptr = NULL;
     fpointer -> mode = 0;
     fpointer -> offset = 0;
+    fpointer -> ra_off = 0;
+    fpointer -> ra_next = 0;
+    fpointer -> ra_win = 0;
   }
+  int unused = fpointer -> ref <= 0;
   releasesleep(&fpointer -> lock);
+  if (unused) {
+    kmem_cache_free(filecache, fpointer);
+  }
   cur->fd_table[fd] = NULL;
   return 0;
 }
@@ -367,8 +437,7 @@ int filestat(int fd, struct stat* fstat)
 int filepipe(int* fds) {
   struct proc *cur = myproc();
   struct file_pipe* pipe;
-  int reader_fd = -1;
-  int writer_fd = -1;
+  struct file_info *reader, *writer;
   // get file descriptor
   int counter = 0;
   for (int i = 0; i < NOFILE; i++) {
@@ -385,32 +454,23 @@ int filepipe(int* fds) {
   if (counter <= 1) {
     return -1;
   }
-  for (int i = 0; i < NFILE; i++) {
-    if (file_table[i].ref == 0) {
-      acquiresleep(&file_table[i].lock);
-      if (reader_fd == -1) {
-        reader_fd = i;
-      } else {
-        writer_fd = i;
-        break;
-      }
+  // check if there is enough space in kernel for the open files
+  // and the pipe
+  reader = kmem_cache_alloc(filecache);
+  writer = kmem_cache_alloc(filecache);
+  pipe = kmem_cache_alloc(pipecache);
+  if (reader == NULL || writer == NULL || pipe == NULL) {
+    if (reader != NULL) {
+      kmem_cache_free(filecache, reader);
     }
-  }
-  // reutrn -1 if there are not enough fd avaliable
-  if (reader_fd == -1 || writer_fd == -1) {
-    // release the lock if there is reader but no writer opening
-    if (reader_fd != -1) {
-      releasesleep(&file_table[reader_fd].lock);
+    if (writer != NULL) {
+      kmem_cache_free(filecache, writer);
+    }
+    if (pipe != NULL) {
+      kmem_cache_free(pipecache, pipe);
     }
     return -1;
   }
-  // check if there is enough space in kernel to allocate the pipe
-  if (!(pipe = (struct file_pipe*)kalloc())) {
-    releasesleep(&file_table[reader_fd].lock);
-    releasesleep(&file_table[writer_fd].lock);
-    return -1;
-  }  
-  initlock(&pipe->lock, "pipe"); 
   acquire(&pipe->lock);
   // int buffer_size = 4096 -  6 * sizeof(int) - sizeof(struct spinlock);
   pipe -> reader = 1;
@@ -420,19 +480,17 @@ int filepipe(int* fds) {
   pipe -> full = 0;                           
   pipe -> empty = 1;
   // initilize reader
-  cur->fd_table[fds[0]] = &file_table[reader_fd];
-  file_table[reader_fd].is_pipe = 1;
-  file_table[reader_fd].mode = O_RDONLY;
-  file_table[reader_fd].ref = 1;
-  file_table[reader_fd].pipe = pipe;
+  cur->fd_table[fds[0]] = reader;
+  reader->is_pipe = 1;
+  reader->mode = O_RDONLY;
+  reader->ref = 1;
+  reader->pipe = pipe;
   // initilize writer
-  cur->fd_table[fds[1]] = &file_table[writer_fd];
-  file_table[writer_fd].is_pipe = 1;
-  file_table[writer_fd].mode = O_WRONLY;
-  file_table[writer_fd].ref = 1;
-  file_table[writer_fd].pipe = pipe;
-  releasesleep(&file_table[reader_fd].lock);
-  releasesleep(&file_table[writer_fd].lock);
+  cur->fd_table[fds[1]] = writer;
+  writer->is_pipe = 1;
+  writer->mode = O_WRONLY;
+  writer->ref = 1;
+  writer->pipe = pipe;
   release(&pipe->lock);
   return 0;
 }
@@ -475,4 +533,30 @@ int filepipe(int* fds) {
 //   }
 //   unlocki(inode);
 //   return 0;
-// }
\ No newline at end of file
+// }
+// Maps n bytes of the file open at fd, from offset off, into the
+// calling process; see vspacemmap. prot must include PROT_READ, and
+// PROT_WRITE makes a private writable mapping.
+// Returns the address of the mapping, or -1 on failure.
+int filemmap(int fd, int off, int n, int prot)
+{
+  struct proc *cur = myproc();
+  struct file_info *fpointer = cur->fd_table[fd];
+  struct inode *ip;
+  int ret;
+
+  if (fpointer == NULL || fpointer->is_pipe == 1 || fpointer->mode == O_WRONLY)
+    return -1;
+  if (off < 0 || n <= 0 || !(prot & PROT_READ))
+    return -1;
+
+  acquiresleep(&fpointer->lock);
+  ip = fpointer->inode_ptr;
+  if (ip == NULL || ip->type != T_FILE) {
+    releasesleep(&fpointer->lock);
+    return -1;
+  }
+  ret = vspacemmap(&cur->vspace, ip, off, n, (prot & PROT_WRITE) != 0);
+  releasesleep(&fpointer->lock);
+  return ret;
+}
@@ -12,6 +12,7 @@
 #include <defs.h>
 #include <file.h>
 #include <fs.h>
+#include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
 #include <proc.h>
@@ -19,65 +20,332 @@
 #include <spinlock.h>
 #include <stat.h>
 
+#include <bitmap.h>
 #include <buf.h>
+#include <pcache.h>
 
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb;
+static struct sleeplock bmaplock; // see "Blocks" below
 
-// in memory version of commit_block
-struct commit_block in_mem_cb;
+static_assert(sizeof(struct logdesc) == BSIZE, "logdesc must fill a block");
 
-struct sleeplock fslock;
+// File system calls run their writes inside begin_op()/end_op().
+// Transactions are committed in groups: the end_op() that leaves
+// no transaction outstanding writes the whole group to the log as
+// one transaction.  Logged blocks stay pinned in the buffer cache
+// and only go to their home locations at a checkpoint, once the log
+// has no room for the next transaction.  A block is copied into the
+// log once per group however often it was written.
+struct {
+  struct spinlock lock; // protects everything but io
+  int outstanding;      // transactions between begin_op and end_op
+  int committing;       // in commit or checkpoint, don't start new ones
+  uint reserved;        // blocks reserved by the open group
+  uint size;            // blocks in the circular area
+  uint head;            // area offset of the oldest transaction kept
+  uint used;            // blocks from head to the end of the last commit
+  uint seq;             // sequence number of the open group
+  uint n;               // distinct blocks written by the open group
+  struct buf *group[LOGSIZE];  // ...and their cached copies
+  uint npinned;                // blocks logged since the last checkpoint
+  struct buf *pinned[LOGSIZE]; // ...and their cached copies
+  struct buf *io[LOGSIZE];     // log area buffers being written
+} log;
+
+// Block number of area offset pos.
+#define LOGBLK(pos) (sb.logstart + 1 + (pos) % log.size)
+
+// Area blocks taken by a transaction of n data blocks.
+static uint logspace(uint n) { return n + (n + LOGDESCN - 1) / LOGDESCN; }
+
+static uint log_cksum(uint h, void *p, int n) {
+  uint *w = p;
+
+  for (; n > 0; n -= sizeof(uint))
+    h = (h ^ *w++) * 16777619; // FNV-1a over words
+  return h;
+}
 
-void log_apply() {
-  struct buf *commit_buf = bread(ROOTDEV, sb.logstart);
-  struct commit_block commit_block;
-  memmove(&commit_block, commit_buf->data, BSIZE);
-  brelse(commit_buf);
-
-  if (commit_block.commit_flag == 1) {
-    for (int i = 0; i < commit_block.size; i++) {
-      // write to block
-      struct buf* src = bread(ROOTDEV, sb.logstart + 1 + i);
-      struct buf* dst = bread(ROOTDEV, commit_block.target[i]);
+// Write the log super block: replay starts at log.head.
+static void log_write_super(void) {
+  struct buf *b;
+  struct logsuper *ls;
+
+  b = bgetblk(ROOTDEV, sb.logstart);
+  memset(b->data, 0, BSIZE);
+  ls = (struct logsuper *)b->data;
+  ls->magic = LOGMAGIC;
+  ls->start = log.head;
+  ls->seq = log.seq;
+  bwrite(b);
+  brelse(b);
+}
+
+// Record that b holds the latest copy of its block until the next
+// checkpoint.  Caller must hold b and log.lock.
+static void log_pin(struct buf *b) {
+  if (b->flags & B_LOGGED)
+    return;
+  b->flags |= B_LOGGED;
+  bpin(b);
+  log.pinned[log.npinned++] = b;
+}
+
+// Write every block logged since the last checkpoint home from its
+// pinned cache copy, then let the log area be reused.  Caller must
+// have set log.committing, and no transaction may be outstanding.
+static void log_checkpoint(void) {
+  uint i, n;
+
+  n = log.npinned;
+  for (i = 0; i < n; i++)
+    bread(log.pinned[i]->dev, log.pinned[i]->blockno); // the pinned copy
+  bwritev(log.pinned, n);
+  for (i = 0; i < n; i++)
+    log.pinned[i]->flags &= ~B_LOGGED;
+
+  acquire(&log.lock);
+  log.head = (log.head + log.used) % log.size;
+  log.used = 0;
+  log.npinned = 0;
+  release(&log.lock);
+  log_write_super();
+
+  for (i = 0; i < n; i++) {
+    brelse(log.pinned[i]);
+    bunpin(log.pinned[i]);
+  }
+}
+
+// Look at the transaction at the end of the log and compute its
+// checksum.  If apply is set, also copy its blocks into the cache as
+// if it had just committed.  Returns the area blocks it takes, or 0
+// if there is no complete transaction with sequence number log.seq.
+static uint log_scan(int apply) {
+  struct buf *db, *src, *dst;
+  struct logdesc *d;
+  uint pos, n, i, len, want, cksum;
+
+  pos = log.head + log.used;
+  db = bread(ROOTDEV, LOGBLK(pos));
+  d = (struct logdesc *)db->data;
+  n = d->nblocks;
+  want = d->checksum;
+  len = logspace(n);
+  if (d->magic != LOGMAGIC || d->seq != log.seq || n == 0 ||
+      n > log.size || len > log.size - log.used) {
+    brelse(db);
+    return 0;
+  }
+  brelse(db);
+
+  if (!apply) {
+    for (i = 0; i < len; i++)
+      bprefetch(ROOTDEV, LOGBLK(pos + i));
+  }
+
+  db = 0;
+  d = 0;
+  cksum = 0;
+  for (i = 0; i < n; i++) {
+    if (i % LOGDESCN == 0) {
+      if (db)
+        brelse(db);
+      db = bread(ROOTDEV, LOGBLK(pos++));
+      d = (struct logdesc *)db->data;
+      if (d->magic != LOGMAGIC || d->seq != log.seq || d->nblocks != n) {
+        brelse(db);
+        return 0;
+      }
+    }
+    src = bread(ROOTDEV, LOGBLK(pos++));
+    cksum = log_cksum(cksum, &d->target[i % LOGDESCN], sizeof(uint));
+    cksum = log_cksum(cksum, src->data, BSIZE);
+    if (apply) {
+      dst = bgetblk(ROOTDEV, d->target[i % LOGDESCN]);
       memmove(dst->data, src->data, BSIZE);
-      bwrite(dst);
+      log_pin(dst);
       brelse(dst);
-      brelse(src);
     }
+    brelse(src);
   }
+  brelse(db);
 
-  commit_buf = bread(ROOTDEV, sb.logstart);
-  memset(commit_buf->data, 0, BSIZE);
-  bwrite(commit_buf);
-  brelse(commit_buf);
-  memset(&in_mem_cb, 0, sizeof(commit_block));
-
+  if (cksum != want)
+    return 0;
+  return len;
 }
 
+// Replay the committed transactions in the log, oldest first, and
+// checkpoint them.  Run once at boot to recover from a crash.
+void log_apply() {
+  struct buf *b;
+  struct logsuper ls;
+  uint len;
 
-void log_commit_tx() {
-  acquiresleep(&fslock);
-  struct buf* commit_b = bread(ROOTDEV, sb.logstart);
-  in_mem_cb.commit_flag = 1;
-  memmove(commit_b->data, &in_mem_cb, sizeof(struct commit_block));
+  if (sb.nlog < 2 || sb.nlog > LOGSIZE)
+    panic("log_apply: bad log size");
+  log.size = sb.nlog - 1;
+  if (logspace(MAXWRITEOP) > log.size)
+    panic("log_apply: log too small");
 
-  bwrite(commit_b);
-  brelse(commit_b);
-  releasesleep(&fslock);
-  log_apply();
+  b = bread(ROOTDEV, sb.logstart);
+  memmove(&ls, b->data, sizeof(ls));
+  brelse(b);
+  if (ls.magic != LOGMAGIC) {
+    ls.start = 0;
+    ls.seq = 1;
+  }
+  log.head = ls.start % log.size;
+  log.seq = ls.seq;
+  log.used = 0;
+
+  // A transaction is replayed only if all of it reached the disk.
+  while ((len = log_scan(0)) != 0) {
+    log_scan(1);
+    log.used += len;
+    log.seq++;
+  }
+  if (log.used > 0)
+    cprintf("log: recovered through transaction %d\n", log.seq - 1);
+  log_checkpoint();
 }
 
-// finished (needs to call log_recover())
+// Write the open group to the log as one transaction.  Caller must
+// have set log.committing, and no transaction may be outstanding.
+static void log_commit_tx(void) {
+  struct logdesc *d;
+  struct buf *b, *lb;
+  uint i, pos, nio, cksum;
+
+  if (log.n == 0)
+    return;
+
+  // Copy each block into its slot, with a descriptor in front of
+  // every LOGDESCN of them.
+  pos = log.head + log.used;
+  nio = 0;
+  cksum = 0;
+  d = 0;
+  for (i = 0; i < log.n; i++) {
+    if (i % LOGDESCN == 0) {
+      lb = bgetblk(ROOTDEV, LOGBLK(pos++));
+      memset(lb->data, 0, BSIZE);
+      d = (struct logdesc *)lb->data;
+      d->magic = LOGMAGIC;
+      d->seq = log.seq;
+      d->nblocks = log.n;
+      log.io[nio++] = lb;
+    }
+    b = bread(ROOTDEV, log.group[i]->blockno); // the pinned copy
+    lb = bgetblk(ROOTDEV, LOGBLK(pos++));
+    memmove(lb->data, b->data, BSIZE);
+    brelse(b);
+    d->target[i % LOGDESCN] = log.group[i]->blockno;
+    cksum = log_cksum(cksum, &d->target[i % LOGDESCN], sizeof(uint));
+    cksum = log_cksum(cksum, lb->data, BSIZE);
+    log.io[nio++] = lb;
+  }
+  for (i = 0; i < nio; i += LOGDESCN + 1)
+    ((struct logdesc *)log.io[i]->data)->checksum = cksum;
+
+  // The transaction is committed once all of it is on disk.
+  bwritev(log.io, nio);
+  for (i = 0; i < nio; i++)
+    brelse(log.io[i]);
+
+  acquire(&log.lock);
+  log.used += nio;
+  log.seq++;
+  log.n = 0;
+  release(&log.lock);
+}
+
+// Note that buf belongs to the open group and pin it in the cache
+// until the next checkpoint.  Nothing is written until commit, so a
+// block modified several times before then is logged once.
+// Caller must hold buf and be inside a transaction.
 void log_write(struct buf* buf) {
-  acquiresleep(&fslock);
-  uint blocknom_orig = buf->blockno;
-  buf->blockno = sb.logstart + 1 + in_mem_cb.size;
-  bwrite(buf);
-  buf->blockno = blocknom_orig;
-  in_mem_cb.size++;
-  releasesleep(&fslock);
+  acquire(&log.lock);
+  if (log.outstanding < 1)
+    panic("log_write outside of trans");
+
+  if (!(buf->flags & B_LOGGED) || buf->logseq != log.seq) {
+    if (log.n >= log.reserved)
+      panic("log_write: too big a transaction");
+    buf->logseq = log.seq;
+    log.group[log.n++] = buf;
+    log_pin(buf);
+  }
+  release(&log.lock);
+}
+
+// Called at the start of each file system call that writes.
+// Reserves log space for n blocks, waiting for commits or
+// checkpointing the log to make room.
+void begin_opn(int n) {
+  if (n < 1 || n > MAXWRITEOP)
+    panic("begin_op");
+
+  acquire(&log.lock);
+  while (1) {
+    if (log.committing) {
+      sleep(&log, &log.lock);
+    } else if (logspace(log.reserved + n) > log.size - log.used) {
+      if (log.outstanding > 0) {
+        // this op might exhaust log space; wait for commit.
+        sleep(&log, &log.lock);
+        continue;
+      }
+      // Only committed transactions hold the space; reclaim it.
+      log.committing = 1;
+      release(&log.lock);
+      log_checkpoint();
+      acquire(&log.lock);
+      log.committing = 0;
+      wakeup(&log);
+    } else {
+      log.outstanding += 1;
+      log.reserved += n;
+      release(&log.lock);
+      break;
+    }
+  }
+}
+
+void begin_op(void) { begin_opn(MAXOPBLOCKS); }
+
+// Called at the end of each file system call that writes.
+// Commits if this was the last outstanding transaction.
+void end_op(void) {
+  int do_commit = 0;
+
+  acquire(&log.lock);
+  log.outstanding -= 1;
+  if (log.committing)
+    panic("log.committing");
+  if (log.outstanding == 0) {
+    do_commit = 1;
+    log.committing = 1;
+  } else {
+    // begin_op() may be waiting for log space, and decrementing
+    // log.outstanding has decreased the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+
+  if (do_commit) {
+    // call commit w/o holding locks, since not allowed
+    // to sleep with locks.
+    log_commit_tx();
+    acquire(&log.lock);
+    log.reserved = 0;
+    log.committing = 0;
+    wakeup(&log);
+    release(&log.lock);
+  }
 }
 
 // Read the super block.
@@ -89,73 +357,538 @@ void readsb(int dev, struct superblock *sb) {
   brelse(bp);
 }
 
-// mark [start, end] bit in bp->data to 1 if used is true, else 0
-static void bmark(struct buf *bp, uint start, uint end, bool used)
+// mark the bits of blocks [b, b+n) to 1 if used is true, else 0,
+// logging each bitmap block touched
+static void bmark(uint dev, uint b, uint n, bool used)
 {
-  int m, bi;
-  for (bi = start; bi <= end; bi++) {
-    m = 1 << (bi % 8);
+  struct buf *bp;
+  uint bi, m;
+
+  while (n > 0) {
+    bp = bread(dev, BBLOCK(b, sb));
+    bi = b % BPB;
+    m = min(n, (uint)BPB - bi);
     if (used) {
-      bp->data[bi/8] |= m;  // Mark block in use.
+      bmap_set(bp->data, bi, m);  // Mark blocks in use.
     } else {
-      if((bp->data[bi/8] & m) == 0)
+      if (!bmap_isset(bp->data, bi, m))
         panic("freeing free block");
-      bp->data[bi/8] &= ~m; // Mark block as free.
+      bmap_clear(bp->data, bi, m); // Mark blocks as free.
     }
+    bp->flags |= B_DIRTY; // mark our update
+    log_write(bp);
+    brelse(bp);
+    b += m;
+    n -= m;
   }
-  bp->flags |= B_DIRTY; // mark our update
-  log_write(bp);
-  log_commit_tx();
-  bp->flags |= B_DIRTY; // clear our update
 }
 
-// Blocks.
-
-// Allocate n disk blocks, no promise on content of allocated disk blocks
-// Returns the beginning block number of a consecutive chunk of n blocks
-static uint balloc(uint dev, uint n)
+// Build the free extent index from the on-disk bitmap.
+static void bmapinit(uint dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi, end, nbits, start;
+  int inrun;
 
-  bp = 0;
+  inrun = 0;
+  start = 0;
   for (b = 0; b < sb.size; b += BPB) {
-    bp = bread(dev, BBLOCK(b, sb)); // look through each bitmap sector
-
-    uint sz = 0;
-    uint i = 0;
-    for (bi = 0; bi < BPB && b + bi < sb.size; bi++) {
-      m = 1 << (bi % 8);
-      if ((bp->data[bi/8] & m) == 0) {  // Is block free?
-        sz++;
-        if (sz == 1) // reset starting blk
-          i = bi;
-        if (sz == n) { // found n blks
-          bmark(bp, i, bi, true); // mark data block as used
-          brelse(bp);
-          return b+i;
-        }
-      } else { // reset search
-        sz = 0;
-        i =0;
+    bp = bread(dev, BBLOCK(b, sb));
+    nbits = min((uint)BPB, sb.size - b);
+    // Alternate between the next free block and the next used one.
+    for (bi = 0; bi < nbits; bi = end) {
+      end = bmap_next(bp->data, bi, nbits, inrun);
+      if (!inrun && end < nbits) {
+        start = b + end;
+        inrun = 1;
+      } else if (inrun && end < nbits) {
+        extfree(start, b + end - start);
+        inrun = 0;
       }
     }
     brelse(bp);
   }
-  panic("balloc: can't allocate contiguous blocks");
+  if (inrun)
+    extfree(start, sb.size - start);
+}
+
+// Empty the free extent index and fill it again from the bitmap, to
+// find the runs it lost for want of memory.  Voids every reservation.
+// Caller must hold bmaplock.
+static void bmaprebuild(uint dev)
+{
+  extreset();
+  bmapinit(dev);
+}
+
+// Blocks.
+//
+// bmaplock makes each change to the bitmap and the matching change to
+// the free extent index one step, so that bmaprebuild never sees a
+// block that is marked in one and not yet in the other.
+
+#define RSVMIN 8   // blocks set aside for a file's first append
+#define RSVMAX 128 // most blocks set aside for one file
+
+// Give ip's unused reservation back to the free extent index.
+static void brsvdrop(struct inode *ip)
+{
+  extrsvfree(ip->rsvstart, ip->rsvlen, ip->rsvgen);
+  ip->rsvlen = 0;
+}
+
+// Take up to n blocks from the free extent index, rebuilding it first
+// if it is out of blocks but lost some.
+// Caller must hold bmaplock.
+static uint bextalloc(uint dev, uint n, uint *start)
+{
+  uint got;
+
+  if ((got = extalloc(n, start)) == 0 && extlost() > 0) {
+    bmaprebuild(dev);
+    got = extalloc(n, start);
+  }
+  return got;
+}
+
+// Allocate up to n disk blocks for ip, no promise on content of
+// allocated disk blocks.  Returns the beginning block number of a
+// consecutive chunk and sets *got to its length: n if any free run is
+// that long, else the longest free run there is, or 0 if the disk is
+// full.
+//
+// goal is the block after ip's last extent, so that a file that keeps
+// growing stays in one extent.  Each time the file needs fresh space,
+// a window of blocks past the ones returned is set aside in memory
+// for its next append, twice as large as the last up to RSVMAX.
+// Caller must hold ip->lock.
+static uint balloc(struct inode *ip, uint goal, uint n, uint *got)
+{
+  uint start, total;
+
+  acquiresleep(&bmaplock);
+  if (ip->rsvlen > 0 && ip->rsvgen == extgen() && ip->rsvstart == goal) {
+    *got = min(n, ip->rsvlen);
+    ip->rsvstart += *got;
+    ip->rsvlen -= *got;
+    bmark(ip->dev, goal, *got, true);
+    releasesleep(&bmaplock);
+    return goal;
+  }
+  brsvdrop(ip);
+
+  ip->rsvwin = ip->rsvwin ? min(ip->rsvwin * 2, (uint)RSVMAX) : RSVMIN;
+  if (goal != 0 && extallocat(goal, n + ip->rsvwin) == 0) {
+    start = goal;
+    total = n + ip->rsvwin;
+  } else if (goal != 0 && extallocat(goal, n) == 0) {
+    start = goal;
+    total = n;
+  } else if ((total = bextalloc(ip->dev, n + ip->rsvwin, &start)) == 0) {
+    releasesleep(&bmaplock);
+    *got = 0;
+    return 0;
+  }
+  *got = min(n, total);
+  ip->rsvstart = start + *got;
+  ip->rsvlen = total - *got;
+  ip->rsvgen = extgen();
+  bmark(ip->dev, start, *got, true);
+  releasesleep(&bmaplock);
+  return start;
 }
 
 // Free n disk blocks starting from b
 static void bfree(int dev, uint b, uint n)
+{
+  assertm(n >= 1, "freeing less than 1 block");
+
+  acquiresleep(&bmaplock);
+  bmark(dev, b, n, false);
+  extfree(b, n);
+  releasesleep(&bmaplock);
+}
+
+// Allocate a zeroed block for an extent tree, or return 0 if the
+// disk is full.  Must be called inside a transaction.
+static uint bzalloc(uint dev)
 {
   struct buf *bp;
+  uint b;
 
-  assertm(n >= 1, "freeing less than 1 block");
-  assertm(BBLOCK(b, sb) == BBLOCK(b+n-1, sb), "returned blocks live in different bitmap sectors");
+  acquiresleep(&bmaplock);
+  if (bextalloc(dev, 1, &b) == 0) {
+    releasesleep(&bmaplock);
+    return 0;
+  }
+  bmark(dev, b, 1, true);
+  releasesleep(&bmaplock);
+  bp = bgetblk(dev, b);
+  memset(bp->data, 0, BSIZE);
+  log_write(bp);
+  brelse(bp);
+  return b;
+}
+
+// Extent trees.
+//
+// See struct extblock in fs.h for the format.  Lookups binary search
+// one block per level; appends only ever touch the rightmost path.
+
+static uint extkeyat(struct extblock *e, int i)
+{
+  return e->level == 0 ? e->leaf[i].fblk : e->index[i].fblk;
+}
+
+// Index of the last entry in e whose key is <= fblk, or 0.
+static int extsearch(struct extblock *e, uint fblk)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = e->n - 1;
+  while (lo < hi) {
+    mid = (lo + hi + 1) / 2;
+    if (extkeyat(e, mid) <= fblk)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+static struct extblock *extread(struct buf *bp)
+{
+  struct extblock *e = (struct extblock *)bp->data;
+
+  if (e->magic != EXTMAGIC || e->n == 0)
+    panic("extent tree");
+  return e;
+}
+
+// Map file block fblk through the tree rooted at root.  Returns the
+// disk block, or 0 if the tree does not cover fblk, and sets *run to
+// the blocks left in the extent from there.
+static uint exttreemap(uint dev, uint root, uint fblk, uint *run)
+{
+  struct buf *bp;
+  struct extblock *e;
+  struct extleaf *l;
+  uint b, pblk;
+  int i;
+
+  pblk = 0;
+  for (b = root; b != 0;) {
+    bp = bread(dev, b);
+    e = extread(bp);
+    i = extsearch(e, fblk);
+    if (e->level > 0) {
+      b = e->index[i].child;
+      brelse(bp);
+      continue;
+    }
+    l = &e->leaf[i];
+    if (fblk >= l->fblk && fblk - l->fblk < l->nblocks) {
+      pblk = l->startblkno + (fblk - l->fblk);
+      *run = l->nblocks - (fblk - l->fblk);
+    }
+    brelse(bp);
+    break;
+  }
+  return pblk;
+}
+
+// Fill path[] with the blocks from the root down to the rightmost
+// leaf.  Returns the depth.
+static int exttail(uint dev, uint root, uint *path)
+{
+  struct buf *bp;
+  struct extblock *e;
+  int d;
+
+  for (d = 0;; d++) {
+    if (d == EXTMAXDEPTH)
+      panic("exttail: too deep");
+    path[d] = root;
+    bp = bread(dev, root);
+    e = extread(bp);
+    if (e->level == 0) {
+      brelse(bp);
+      return d + 1;
+    }
+    root = e->index[e->n - 1].child;
+    brelse(bp);
+  }
+}
+
+// Start a new extent block at level holding the single entry
+// (fblk, a, b): an extent (fblk, a, b) for a leaf, or child a.
+static void extnew(uint dev, uint blk, int level, uint fblk, uint a, uint b)
+{
+  struct buf *bp;
+  struct extblock *e;
+
+  bp = bread(dev, blk);
+  e = (struct extblock *)bp->data;
+  e->magic = EXTMAGIC;
+  e->level = level;
+  e->n = 1;
+  if (level == 0) {
+    e->leaf[0].fblk = fblk;
+    e->leaf[0].startblkno = a;
+    e->leaf[0].nblocks = b;
+  } else {
+    e->index[0].fblk = fblk;
+    e->index[0].child = a;
+  }
+  log_write(bp);
+  brelse(bp);
+}
+
+// Append extent (start, n) for file block fblk to ip's tree.
+// Returns -1 if the disk has no room for the blocks it needs.
+// Caller must hold ip->lock and be inside a transaction.
+static int exttreeappend(struct inode *ip, uint fblk, uint start, uint n)
+{
+  uint path[EXTMAXDEPTH], fresh[EXTMAXDEPTH + 1], target;
+  struct buf *bp;
+  struct extblock *e;
+  int d, full, i, level, cap;
+
+  if (ip->extroot == 0) {
+    if ((ip->extroot = bzalloc(ip->dev)) == 0)
+      return -1;
+    extnew(ip->dev, ip->extroot, 0, fblk, start, n);
+    return 0;
+  }
+
+  // Count the full blocks above the leaf, and allocate a sibling for
+  // each, plus a new root if the whole path is full, before changing
+  // anything.
+  d = exttail(ip->dev, ip->extroot, path);
+  for (full = 0; full < d; full++) {
+    bp = bread(ip->dev, path[d - 1 - full]);
+    e = extread(bp);
+    cap = e->level == 0 ? NEXTLEAF : NEXTINDEX;
+    i = e->n;
+    brelse(bp);
+    if (i < cap)
+      break;
+  }
+  if (full == d && d == EXTMAXDEPTH)
+    return -1;
+  for (i = 0; i < full + (full == d); i++) {
+    if ((fresh[i] = bzalloc(ip->dev)) == 0) {
+      while (--i >= 0)
+        bfree(ip->dev, fresh[i], 1);
+      return -1;
+    }
+  }
+
+  for (level = 0; level < full; level++)
+    extnew(ip->dev, fresh[level], level, fblk,
+           level == 0 ? start : fresh[level - 1], n);
+  if (full == d) {
+    bp = bread(ip->dev, ip->extroot);
+    e = extread(bp);
+    extnew(ip->dev, fresh[d], d, extkeyat(e, 0), ip->extroot, 0);
+    brelse(bp);
+    target = ip->extroot = fresh[d];
+  } else {
+    target = path[d - 1 - full];
+  }
+
+  // Add the entry, or the new sibling below it, to the lowest block
+  // that has room.
+  bp = bread(ip->dev, target);
+  e = extread(bp);
+  if (full == 0) {
+    e->leaf[e->n].fblk = fblk;
+    e->leaf[e->n].startblkno = start;
+    e->leaf[e->n].nblocks = n;
+  } else {
+    e->index[e->n].fblk = fblk;
+    e->index[e->n].child = fresh[full - 1];
+  }
+  e->n++;
+  log_write(bp);
+  brelse(bp);
+  return 0;
+}
+
+// The last extent in the tree rooted at root.  Returns the file block
+// just past it, and if grow is nonzero lengthens it by grow blocks.
+static uint exttreelast(uint dev, uint root, struct extent *last, uint grow)
+{
+  uint path[EXTMAXDEPTH];
+  struct buf *bp;
+  struct extblock *e;
+  struct extleaf *l;
+  uint end;
+
+  bp = bread(dev, path[exttail(dev, root, path) - 1]);
+  e = extread(bp);
+  l = &e->leaf[e->n - 1];
+  if (grow) {
+    l->nblocks += grow;
+    log_write(bp);
+  }
+  last->startblkno = l->startblkno;
+  last->nblocks = l->nblocks;
+  end = l->fblk + l->nblocks;
+  brelse(bp);
+  return end;
+}
 
-  bp = bread(dev, BBLOCK(b, sb));
-  bmark(bp, b % BPB, (b+n-1) % BPB, false);
+// Free every extent in the tree rooted at b, and the tree itself.
+static void exttreefree(uint dev, uint b)
+{
+  struct buf *bp;
+  struct extblock *e;
+  int i;
+
+  bp = bread(dev, b);
+  e = extread(bp);
+  for (i = 0; i < e->n; i++) {
+    if (e->level > 0)
+      exttreefree(dev, e->index[i].child);
+    else
+      bfree(dev, e->leaf[i].startblkno, e->leaf[i].nblocks);
+  }
   brelse(bp);
+  bfree(dev, b, 1);
+}
+
+// Recompute ip->extsum from ip->data and forget the bmap cursor.
+static void iextsums(struct inode *ip)
+{
+  uint end;
+  int i;
+
+  end = 0;
+  for (i = 0; i < MAXEXTENT; i++) {
+    end += ip->data[i].nblocks;
+    ip->extsum[i] = end;
+  }
+  ip->curlen = 0;
+}
+
+// Map file block fblk of ip without the cursor: the in-inode
+// extents are binary searched by their prefix sums, where unused
+// slots repeat the total so the search needs no count, and the rest
+// come from the tree.  Sets *fstart, *run to the run of file blocks
+// found and returns its first disk block, or returns 0.
+// Caller must hold ip->lock.
+static uint bmaplookup(struct inode *ip, uint fblk, uint *fstart, uint *run)
+{
+  uint pblk;
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = MAXEXTENT;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (ip->extsum[mid] > fblk)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  if (lo < MAXEXTENT) {
+    *fstart = lo ? ip->extsum[lo - 1] : 0;
+    *run = ip->data[lo].nblocks;
+    return ip->data[lo].startblkno;
+  }
+  if (ip->extroot != 0 &&
+      (pblk = exttreemap(ip->dev, ip->extroot, fblk, run)) != 0) {
+    *fstart = fblk;
+    return pblk;
+  }
+  return 0;
+}
+
+// Return the disk block holding file block fblk of ip, or 0 if ip
+// has none there.  Sets *run to the number of blocks from there to
+// the end of its extent, which are contiguous on disk.
+//
+// Sequential access stays within the extent resolved last, which is
+// kept in the inode.
+// Caller must hold ip->lock.
+static uint bmap(struct inode *ip, uint fblk, uint *run)
+{
+  uint pblk, fstart, n;
+
+  if (ip->curlen == 0 || fblk - ip->curfblk >= ip->curlen) {
+    if ((pblk = bmaplookup(ip, fblk, &fstart, &n)) == 0)
+      return 0;
+    ip->curfblk = fstart;
+    ip->curpblk = pblk;
+    ip->curlen = n;
+  }
+  *run = ip->curlen - (fblk - ip->curfblk);
+  return ip->curpblk + (fblk - ip->curfblk);
+}
+
+// Number of file blocks ip's extents map.  Sets *last to its last
+// extent, or to zero if it has none.
+// Caller must hold ip->lock.
+static uint iextlast(struct inode *ip, struct extent *last)
+{
+  uint end;
+  int i;
+
+  if (ip->extroot != 0)
+    return exttreelast(ip->dev, ip->extroot, last, 0);
+  last->startblkno = last->nblocks = 0;
+  end = 0;
+  for (i = 0; i < MAXEXTENT && ip->data[i].nblocks != 0; i++) {
+    *last = ip->data[i];
+    end += ip->data[i].nblocks;
+  }
+  return end;
+}
+
+// Lengthen ip's last extent by n blocks.
+// Caller must hold ip->lock and be inside a transaction.
+static void iextgrow(struct inode *ip, uint n)
+{
+  struct extent last;
+  int i;
+
+  if (ip->extroot != 0) {
+    exttreelast(ip->dev, ip->extroot, &last, n);
+    return;
+  }
+  for (i = MAXEXTENT - 1; i >= 0; i--) {
+    if (ip->data[i].nblocks != 0) {
+      ip->data[i].nblocks += n;
+      for (; i < MAXEXTENT; i++)
+        ip->extsum[i] += n;
+      return;
+    }
+  }
+  panic("iextgrow");
+}
+
+// Append extent (start, n), mapping file blocks from fblk on, to ip:
+// in the inode while it has room and in its extent tree after that.
+// Returns -1 if the tree needed a block and the disk is full.
+// Caller must hold ip->lock and be inside a transaction.
+static int iextappend(struct inode *ip, uint fblk, uint start, uint n)
+{
+  int i;
+
+  if (ip->extroot == 0) {
+    for (i = 0; i < MAXEXTENT; i++) {
+      if (ip->data[i].nblocks == 0) {
+        ip->data[i].startblkno = start;
+        ip->data[i].nblocks = n;
+        for (; i < MAXEXTENT; i++)
+          ip->extsum[i] += n;
+        return 0;
+      }
+    }
+  }
+  return exttreeappend(ip, fblk, start, n);
 }
 
 // Inodes.
@@ -176,6 +909,14 @@ static void bfree(int dev, uint b, uint n)
 // inodes include book-keeping information that is
 // not stored on disk: ip->ref and ip->flags.
 //
+// The cache is a hash table keyed on (dev, inum).  An inode whose
+// last reference is dropped stays cached and valid on an LRU list,
+// so opening it again does not read the inode file; iget recycles
+// the least recently released one only when the cache is at its
+// size limit or out of memory.  Inodes are carved out of kalloc'd
+// pages, and kalloc calls ishrink to take back pages whose inodes
+// are all unreferenced when it runs out.
+//
 // Since there is no writing to the file system there is no need
 // for the callers to worry about coherence between the disk
 // and the in memory copy, although that will become important
@@ -189,12 +930,131 @@ static void bfree(int dev, uint b, uint n)
 
 
 
+// Number of hash buckets.
+#define NIHASH 31
+
+// The cache grows up to 1/ICACHE_MAXFRAC of physical memory.
+#define ICACHE_MAXFRAC 64
+
+#define IPERCHUNK ((PGSIZE - sizeof(struct ichunk *)) / sizeof(struct inode))
+
+struct ichunk {
+  struct ichunk *next;
+  struct inode inode[IPERCHUNK];
+};
+static_assert(IPERCHUNK > 0, "an inode must fit in a page");
+
+static struct inode *iget(uint dev, uint inum);
+
 struct {
-  struct spinlock lock;
-  struct inode inode[NINODE];
+  struct spinlock lock; // protects the hash table, the LRU list and
+                        // every ip->ref
   struct inode inodefile;
+  struct inode *root;   // the root directory, never released
+  struct ichunk *chunks;
+  int ninode;   // inodes currently in the cache
+  int maxinode; // grow on a miss only below this size
+  struct inode *hash[NIHASH];
+
+  // Unreferenced inodes, through prev/next.
+  // lru.next is the most recently released.
+  struct inode lru;
 } icache;
 
+struct {
+  struct spinlock lock;
+  uint hint;  // no free inum below this; see ialloc
+  uint nfree; // ifree calls so far
+} imap;
+
+static struct inode **ihash(uint dev, uint inum) {
+  return &icache.hash[(dev * 31 + inum) % NIHASH];
+}
+
+// Remove ip from the hash table, if it is there.
+// Caller must hold icache.lock.
+static void iunhash(struct inode *ip) {
+  struct inode **pp;
+
+  for (pp = ihash(ip->dev, ip->inum); *pp; pp = &(*pp)->hnext) {
+    if (*pp == ip) {
+      *pp = ip->hnext;
+      ip->hnext = 0;
+      return;
+    }
+  }
+}
+
+// Caller must hold icache.lock.
+static void ilruremove(struct inode *ip) {
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+}
+
+// Put ip at the head of the LRU list, or the tail if it holds
+// nothing worth keeping.
+// Caller must hold icache.lock.
+static void ilruadd(struct inode *ip, int tail) {
+  struct inode *at = tail ? icache.lru.prev : &icache.lru;
+
+  ip->prev = at;
+  ip->next = at->next;
+  at->next->prev = ip;
+  at->next = ip;
+}
+
+// Add a page of unused inodes at the tail of the LRU list.
+// Caller must hold icache.lock.
+static int igrow(void) {
+  struct ichunk *c;
+  struct inode *ip;
+
+  if ((c = (struct ichunk *)kzalloc()) == 0)
+    return -1;
+  for (ip = c->inode; ip < c->inode + IPERCHUNK; ip++) {
+    initsleeplock(&ip->lock, "inode");
+    ilruadd(ip, 1);
+  }
+  c->next = icache.chunks;
+  icache.chunks = c;
+  icache.ninode += IPERCHUNK;
+  return 0;
+}
+
+// Give one page of unreferenced inodes back to the page allocator.
+// Called by kalloc when it runs out of pages.
+// Returns the number of pages freed.
+int ishrink(void) {
+  struct ichunk *c, **pp;
+  struct inode *ip;
+
+  // The holder may be in igrow, or in kalloc waiting on a lock this
+  // CPU holds; back off rather than spin.
+  if (!tryacquire(&icache.lock))
+    return 0;
+
+  for (pp = &icache.chunks; (c = *pp) != 0; pp = &c->next) {
+    if (icache.ninode - (int)IPERCHUNK < NINODE)
+      break;
+    for (ip = c->inode; ip < c->inode + IPERCHUNK; ip++)
+      if (ip->ref != 0)
+        break;
+    if (ip < c->inode + IPERCHUNK)
+      continue;
+    for (ip = c->inode; ip < c->inode + IPERCHUNK; ip++) {
+      iunhash(ip);
+      ilruremove(ip);
+    }
+    *pp = c->next;
+    icache.ninode -= IPERCHUNK;
+    release(&icache.lock);
+    kfree((char *)c);
+    return 1;
+  }
+  release(&icache.lock);
+  return 0;
+}
+
 // Find the inode file on the disk and load it into memory
 // should only be called once, but is idempotent.
 static void init_inodefile(int dev) {
@@ -213,43 +1073,98 @@ static void init_inodefile(int dev) {
   icache.inodefile.devid = di.devid;
   icache.inodefile.size = di.size;
   memmove(icache.inodefile.data, di.data, MAXEXTENT * sizeof(struct extent));
+  icache.inodefile.extroot = di.extroot;
+  icache.inodefile.dirroot = di.dirroot;
+  iextsums(&icache.inodefile);
   // icache.inodefile.data = di.data;
   brelse(b);
 }
 
 void iinit(int dev) {
-  int i;
-
   initlock(&icache.lock, "icache");
-  for (i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  initlock(&imap.lock, "imap");
+  dcinit();
+  pcinit();
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+  icache.maxinode = max(NINODE, npages / ICACHE_MAXFRAC * (int)IPERCHUNK);
+  acquire(&icache.lock);
+  while (icache.ninode < NINODE)
+    if (igrow() < 0)
+      panic("iinit: no memory for inodes");
+  release(&icache.lock);
   initsleeplock(&icache.inodefile.lock, "inodefile");
-  initsleeplock(&fslock, "log");
+  initlock(&log.lock, "log");
 
   readsb(dev, &sb);
-  cprintf("sb: size %d nblocks %d bmap start %d inodestart %d\n", sb.size,
-          sb.nblocks, sb.bmapstart, sb.inodestart);
+  cprintf("sb: size %d nblocks %d bmap start %d imap start %d inodestart %d\n",
+          sb.size, sb.nblocks, sb.bmapstart, sb.imapstart, sb.inodestart);
   log_apply();
+  extinit();
+  initsleeplock(&bmaplock, "bmap");
+  bmapinit(dev);
   init_inodefile(dev);
+  icache.root = iget(dev, ROOTINO);
 }
 
 
-// Reads the dinode with the passed inum from the inode file.
-// Threadsafe, will acquire sleeplock on inodefile inode if not held.
-static void read_dinode(uint inum, struct dinode *dip) {
-  int holding_inodefile_lock = holdingsleep(&icache.inodefile.lock);
+// Return the locked buffer holding the dinode with the passed inum,
+// or 0 if it lies past the end of the inode file.
+//
+// Dinodes never span blocks, so the buffer lock is all a dinode
+// needs: reads and updates of dinodes in different blocks run in
+// parallel.  Only finding the block takes the inode file's lock, as
+// writei may be growing the file: it sets size before the extents
+// that cover it are in place.
+static struct buf *dinode_buf(uint inum) {
+  struct inode *ifp = &icache.inodefile;
+  uint off, fstart, run, b;
+  int holding_inodefile_lock;
+
+  off = INODEOFF(inum);
+  holding_inodefile_lock = holdingsleep(&ifp->lock);
   if (!holding_inodefile_lock)
-    locki(&icache.inodefile);
+    locki(ifp);
+  b = 0;
+  if (off + sizeof(struct dinode) <= ifp->size) {
+    if ((b = bmaplookup(ifp, off / BSIZE, &fstart, &run)) == 0)
+      panic("dinode_buf");
+    b += off / BSIZE - fstart;
+  }
+  if (!holding_inodefile_lock)
+    unlocki(ifp);
 
-  readi(&icache.inodefile, (char *)dip, INODEOFF(inum), sizeof(*dip));
+  if (b == 0)
+    return 0;
+  return bread(ifp->dev, b);
+}
 
-  if (!holding_inodefile_lock)
-    unlocki(&icache.inodefile);
+// Reads the dinode with the passed inum from the inode file.
+// Threadsafe.
+static void read_dinode(uint inum, struct dinode *dip) {
+  struct buf *bp;
+
+  if ((bp = dinode_buf(inum)) == 0)
+    panic("read_dinode");
+  memmove(dip, bp->data + INODEOFF(inum) % BSIZE, sizeof(*dip));
+  brelse(bp);
 }
 
+// Writes the dinode with the passed inum to the inode file, growing
+// it if inum is the next one past its end.
+// Threadsafe, must be called inside a transaction.
 static void write_dinode(uint inum, struct dinode *dip) {
-  int holding_inodefile_lock = holdingsleep(&icache.inodefile.lock);
+  struct buf *bp;
+  int holding_inodefile_lock;
+
+  if ((bp = dinode_buf(inum)) != 0) {
+    memmove(bp->data + INODEOFF(inum) % BSIZE, dip, sizeof(*dip));
+    log_write(bp);
+    brelse(bp);
+    return;
+  }
+
+  holding_inodefile_lock = holdingsleep(&icache.inodefile.lock);
   if (!holding_inodefile_lock)
     locki(&icache.inodefile);
 
@@ -259,33 +1174,141 @@ static void write_dinode(uint inum, struct dinode *dip) {
     unlocki(&icache.inodefile);
 }
 
+// Copy a modified in-memory inode to disk.
+// Caller must hold ip->lock and be inside a transaction.
+static void iupdate(struct inode *ip) {
+  struct dinode dip;
+
+  dip.devid = ip->devid;
+  dip.size = ip->size;
+  dip.type = ip->type;
+  memmove(dip.data, ip->data, MAXEXTENT*sizeof(struct extent));
+  dip.extroot = ip->extroot;
+  dip.dirroot = ip->dirroot;
+  write_dinode(ip->inum, &dip);
+}
+
+// Inode allocation.
+//
+// The inode map has a bit per inum, set while its dinode is in use.
+// Every inum below imap.hint is known to be in use, so ialloc starts
+// looking there; it only ever finds the lowest free inum, which keeps
+// the inode file dense.
+
+// Allocate an inode of the given type on dev and write its empty
+// dinode.  Returns its inum, or 0 if there are none left.
+// Must be called inside a transaction.
+uint ialloc(uint dev, short type) {
+  struct buf *bp;
+  struct dinode di;
+  uint from, nfree, inum, b, bi;
+
+  acquire(&imap.lock);
+  from = imap.hint;
+  nfree = imap.nfree;
+  release(&imap.lock);
+
+  for (inum = 0, b = from - from % BPB; inum == 0 && b < MAXINODE; b += BPB) {
+    bp = bread(dev, sb.imapstart + b / BPB);
+    bi = bmap_next(bp->data, b < from ? from - b : 0, BPB, 0);
+    if (bi < BPB) {
+      bmap_set(bp->data, bi, 1);
+      log_write(bp);
+      inum = b + bi;
+    }
+    brelse(bp);
+  }
+  if (inum == 0)
+    return 0;
+
+  // Nothing in [from, inum) was free when we looked; unless an ifree
+  // ran since, the hint can skip past them.  An ifree at or above
+  // from leaves the hint alone, so checking the hint is not enough.
+  acquire(&imap.lock);
+  if (imap.nfree == nfree && imap.hint == from)
+    imap.hint = inum + 1;
+  release(&imap.lock);
+
+  memset(&di, 0, sizeof(di));
+  if (INODEOFF(inum) > icache.inodefile.size) {
+    // A concurrent ialloc holds the lower inums of a gap at the end
+    // of the inode file; write empty dinodes until the file reaches
+    // this one.  Theirs are rewritten by their own write_dinode.
+    locki(&icache.inodefile);
+    while (icache.inodefile.size < INODEOFF(inum))
+      write_dinode(icache.inodefile.size / sizeof(di), &di);
+    unlocki(&icache.inodefile);
+  }
+  di.type = type;
+  write_dinode(inum, &di);
+  return inum;
+}
+
+// Mark inum free in the inode map.
+// Must be called inside a transaction.
+static void ifree(uint dev, uint inum) {
+  struct buf *bp;
+
+  bp = bread(dev, sb.imapstart + inum / BPB);
+  if (!bmap_isset(bp->data, inum % BPB, 1))
+    panic("ifree: freeing free inode");
+  bmap_clear(bp->data, inum % BPB, 1);
+  log_write(bp);
+  brelse(bp);
+
+  acquire(&imap.lock);
+  imap.nfree++;
+  if (inum < imap.hint)
+    imap.hint = inum;
+  release(&imap.lock);
+}
+
+// Undo an ialloc whose inode never got a directory entry: clear its
+// dinode and free its inum.
+// Must be called inside a transaction.
+void iunalloc(uint dev, uint inum) {
+  struct dinode di;
+
+  memset(&di, 0, sizeof(di));
+  write_dinode(inum, &di);
+  ifree(dev, inum);
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not read
 // the inode from from disk.
 static struct inode *iget(uint dev, uint inum) {
-  struct inode *ip, *empty;
+  struct inode *ip, **bkt;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
-    if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
-      ip->ref++;
+  bkt = ihash(dev, inum);
+  for (ip = *bkt; ip; ip = ip->hnext) {
+    if (ip->dev == dev && ip->inum == inum) {
+      if (ip->ref++ == 0)
+        ilruremove(ip);
       release(&icache.lock);
       return ip;
     }
-    if (empty == 0 && ip->ref == 0) // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if (empty == 0)
+  // Recycle the least recently released inode, growing the cache
+  // first if it may and memory is plentiful.
+  if (icache.ninode < icache.maxinode && free_pages > npages / ICACHE_MAXFRAC)
+    igrow();
+  ip = icache.lru.prev;
+  if (ip == &icache.lru)
     panic("iget: no inodes");
+  ilruremove(ip);
+  iunhash(ip);
 
-  ip = empty;
+  ip->hnext = *bkt;
+  *bkt = ip;
   ip->ref = 1;
   ip->valid = 0;
+  ip->rsvlen = 0;
+  ip->rsvwin = 0;
   ip->dev = dev;
   ip->inum = inum;
 
@@ -304,13 +1327,15 @@ struct inode *idup(struct inode *ip) {
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode stays cached until
+// iget recycles it.
 void irelease(struct inode *ip) {
   acquire(&icache.lock);
   // inode has no other references release
-  if (ip->ref == 1)
-    ip->type = 0;
+  if (ip->ref == 1) {
+    brsvdrop(ip);
+    ilruadd(ip, !ip->valid);
+  }
   ip->ref--;
   release(&icache.lock);
 }
@@ -326,18 +1351,16 @@ void locki(struct inode *ip) {
   acquiresleep(&ip->lock);
 
   if (ip->valid == 0) {
-
-    if (ip != &icache.inodefile)
-      locki(&icache.inodefile);
     read_dinode(ip->inum, &dip);
-    if (ip != &icache.inodefile)
-      unlocki(&icache.inodefile);
 
     ip->type = dip.type;
     ip->devid = dip.devid;
 
     ip->size = dip.size;
     memmove(ip->data, dip.data, sizeof(dip.data));
+    ip->extroot = dip.extroot;
+    ip->dirroot = dip.dirroot;
+    iextsums(ip);
     ip->valid = 1;
 
     if (ip->type == 0)
@@ -384,12 +1407,58 @@ int concurrent_readi(struct inode *ip, char *dst, uint off, uint n) {
   return retval;
 }
 
+// Fill page pg of ip from disk.  Bytes past the end of the file
+// read as zeroes.
+// Caller must hold ip->lock.
+static void ipagefill(struct inode *ip, struct cpage *pg) {
+  uint blks[PGSIZE / BSIZE], fblk, run;
+  int i;
+
+  fblk = pg->pgno * (PGSIZE / BSIZE);
+  for (i = 0; i < PGSIZE / BSIZE; i++, fblk++)
+    blks[i] = fblk * BSIZE < ip->size ? bmap(ip, fblk, &run) : 0;
+  bfill(ip->dev, blks, PGSIZE / BSIZE, pg->data);
+  pg->valid = 1;
+}
+
+// Return a frame holding page pgno of ip, to be mapped into a
+// process.  It is the page cache's own frame, so every process that
+// maps the page shares it and sees what writei writes to the file;
+// it stays cached while mapped.  If the page cache has no page to
+// spare, it is a private copy instead.  Either way the caller owns a
+// reference to the frame and drops it with kfree.
+// Returns 0 if out of memory.
+char *ipagemap(struct inode *ip, uint pgno) {
+  struct cpage *pg;
+  char *mem;
+  uint off;
+
+  locki(ip);
+  if ((pg = pcget(ip->dev, ip->inum, pgno)) != 0) {
+    if (!pg->valid)
+      ipagefill(ip, pg);
+    mem = pg->data;
+    kref(mem);
+    pcrelease(pg);
+  } else if ((mem = kzalloc()) != 0) {
+    off = pgno * PGSIZE;
+    if (off < ip->size)
+      readi(ip, mem, off, min(ip->size - off, (uint)PGSIZE));
+  }
+  unlocki(ip);
+  return mem;
+}
+
 // Read data from inode.
 // Returns number of bytes read.
+// File data comes from the page cache, falling back to the buffer
+// cache if no page can be had; the inode file, whose dinodes are
+// updated in place in the buffer cache, always uses the latter.
 // Caller must hold ip->lock.
 int readi(struct inode *ip, char *dst, uint off, uint n) {
-  uint tot, m;
+  uint tot, m, run;
   struct buf *bp;
+  struct cpage *pg;
 
   if (!holdingsleep(&ip->lock))
     panic("not holding lock");
@@ -405,32 +1474,48 @@ int readi(struct inode *ip, char *dst, uint off, uint n) {
   if (off + n > ip->size)
     n = ip->size - off;
 
-  int extentnum = 0;
-  int nblocks = off / BSIZE;
-  // get current extent and block
-  for (int i = 0; i < MAXEXTENT; i++) {
-    int curblock = ip->data[i].nblocks;
-    if ((nblocks - curblock) < 0) {
-      extentnum = i; 
-      break;
-    } else {
-      nblocks -= curblock;
+  tot = 0;
+  if (ip != &icache.inodefile) {
+    for (; tot < n; tot += m, off += m, dst += m) {
+      if ((pg = pcget(ip->dev, ip->inum, off / PGSIZE)) == 0)
+        break;
+      if (!pg->valid)
+        ipagefill(ip, pg);
+      m = min(n - tot, PGSIZE - off % PGSIZE);
+      memmove(dst, pg->data + off % PGSIZE, m);
+      pcrelease(pg);
     }
   }
-  for (tot = 0; tot < n; tot += m, off += m, dst += m) {
-    bp = bread(ip->dev, ip->data[extentnum].startblkno + nblocks);
+  for (; tot < n; tot += m, off += m, dst += m) {
+    bp = bread(ip->dev, bmap(ip, off / BSIZE, &run));
     m = min(n - tot, BSIZE - off % BSIZE);
     memmove(dst, bp->data + off % BSIZE, m);
     brelse(bp);
-    nblocks += 1;
-    if (nblocks >= ip->data[extentnum].nblocks) {
-      extentnum += 1;
-      nblocks = 0;
-    }
   }
   return n;
 }
 
+// Start asynchronous reads of the blocks holding [off, off+n) of ip,
+// stopping at the end of the extent that holds off.
+// Caller must hold ip->lock.
+void ireadahead(struct inode *ip, uint off, uint n) {
+  uint b, run, nb;
+
+  if (!holdingsleep(&ip->lock))
+    panic("not holding lock");
+
+  if (ip->type != T_FILE || off >= ip->size || n == 0)
+    return;
+  if (off + n > ip->size || off + n < off)
+    n = ip->size - off;
+
+  if ((b = bmap(ip, off / BSIZE, &run)) == 0)
+    return;
+  nb = min((off + n - 1) / BSIZE - off / BSIZE + 1, run);
+  for (; nb > 0; nb--, b++)
+    bprefetch(ip->dev, b);
+}
+
 // threadsafe writei.
 int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
   int retval;
@@ -444,9 +1529,9 @@ int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
 
 // Write data to inode.
 // Returns number of bytes written.
-// Caller must hold ip->lock.
+// Caller must hold ip->lock and be inside a transaction.
 int writei(struct inode *ip, char *src, uint off, uint n) {
-  uint tot, m;
+  uint tot, m, run;
   struct buf *bp;
 
   if (!holdingsleep(&ip->lock))
@@ -459,60 +1544,52 @@ int writei(struct inode *ip, char *src, uint off, uint n) {
   }
   if (off > ip->size || off + n < off)
     return -1;
-  int actualblocks = 0;
-  int blockstoa = (off + n) / BSIZE + ((off + n) % BSIZE == 0 ? 0 : 1);
-  int extentnum = 0;
-  int nblocks = off/BSIZE;
-  for (int i = 0; i < MAXEXTENT; i++) {
-    if (ip->data[i].nblocks == 0) {
-      extentnum = i;
-      break;
-    } else {
-      actualblocks += ip->data[i].nblocks;
-    }
-  }
+  uint blockstoa = (off + n) / BSIZE + ((off + n) % BSIZE == 0 ? 0 : 1);
   // add extents an allocate more blocks to account for bigger write
   if (off + n > ip->size) {
-    if (blockstoa - actualblocks > 0) {
-      ip->data[extentnum].startblkno = balloc(ip->dev, (blockstoa - actualblocks));
-      ip->data[extentnum].nblocks = (blockstoa - actualblocks);
+    // One extent per free run used.  If the disk runs out, the write
+    // stops at the last block allocated.
+    struct extent last;
+    uint have = iextlast(ip, &last);
+    uint need = blockstoa > have ? blockstoa - have : 0;
+    uint got;
+    while (need > 0) {
+      uint goal = last.nblocks ? last.startblkno + last.nblocks : 0;
+      uint start = balloc(ip, goal, need, &got);
+      if (got == 0)
+        break;
+      if (goal != 0 && start == goal) {
+        iextgrow(ip, got); // grew in place
+        last.nblocks += got;
+      } else if (iextappend(ip, have, start, got) == 0) {
+        last.startblkno = start;
+        last.nblocks = got;
+      } else {
+        bfree(ip->dev, start, got);
+        break;
+      }
+      have += got;
+      need -= got;
     }
-    ip->size = off + n;
-    struct dinode dip;
-    dip.devid = ip->devid;
-    dip.size = ip->size;
-    dip.type = ip->type;
-    memmove(dip.data, ip->data, MAXEXTENT*sizeof(struct extent));
-    write_dinode(ip->inum, &dip);
-  }
-  // get current extent and block
-  for (int i = 0; i < MAXEXTENT; i++) {
-    int curblock = ip->data[i].nblocks;
-    if (nblocks-curblock < 0) {
-      extentnum = i;
-      break;
-    } else {
-      nblocks -= curblock;
+    if (need > 0) {
+      uint avail = (blockstoa - need) * BSIZE;
+      n = avail > off ? avail - off : 0;
     }
+    if (off + n > ip->size)
+      ip->size = off + n;
+    iupdate(ip);
+    if (n == 0)
+      return -1;
   }
-
   for (tot = 0; tot < n; tot += m, off += m, src += m) {
-    bp = bread(ip->dev, ip->data[extentnum].startblkno + nblocks);
+    bp = bread(ip->dev, bmap(ip, off / BSIZE, &run));
     m = min(n - tot, BSIZE - off % BSIZE);
     memmove(bp->data + off % BSIZE, src, m);
     log_write(bp);
     //bwrite(bp);
     brelse(bp);
-    nblocks += 1;
-    if (nblocks >= ip->data[extentnum].nblocks) {
-      extentnum += 1;
-      nblocks = 0;
-      if (extentnum > MAXEXTENT - 1) {
-        return tot + m;
-      }
-    }
+    pcwrite(ip->dev, ip->inum, off, src, m);
   }
-  log_commit_tx();
 
   // read-only fs, writing to inode is an error
   return n;
@@ -523,32 +1600,343 @@ int writei(struct inode *ip, char *src, uint off, uint n) {
 int namecmp(const char *s, const char *t) { return strncmp(s, t, DIRSIZ); }
 
 struct inode *rootlookup(char *name) {
-  return dirlookup(namei("/"), name, 0);
+  return dirlookup(icache.root, name, 0);
+}
+
+static uint dirhash(char *name) {
+  uint h;
+  int i;
+
+  h = 2166136261;
+  for (i = 0; i < DIRSIZ && name[i]; i++) {
+    h ^= (uchar)name[i];
+    h *= 16777619;
+  }
+  return h;
+}
+
+// Scan dp a block at a time for the first entry named name, or the
+// first free entry if name is 0.  Copies it to *de and returns its
+// slot, or returns -1.
+// Caller must hold dp->lock.
+static int dirscan(struct inode *dp, char *name, struct dirent *de) {
+  struct buf *bp;
+  struct dirent *d;
+  uint off, end, run;
+
+  for (off = 0; off < dp->size; off = end) {
+    end = min(dp->size, (off / BSIZE + 1) * BSIZE);
+    bp = bread(dp->dev, bmap(dp, off / BSIZE, &run));
+    for (; off < end; off += sizeof(*d)) {
+      d = (struct dirent *)(bp->data + off % BSIZE);
+      if (name ? d->inum != 0 && namecmp(name, d->name) == 0 : d->inum == 0) {
+        *de = *d;
+        brelse(bp);
+        return off / sizeof(*d);
+      }
+    }
+    brelse(bp);
+  }
+  return -1;
+}
+
+// Add (hash, slot) to the index chain whose head is *head, a field
+// of the index root held in rb.  Returns -1 if the disk is full.
+static int dirchainadd(struct inode *dp, struct buf *rb, uint *head,
+                       uint hash, uint slot) {
+  struct buf *bp;
+  struct dirchain *c;
+  uint b;
+
+  if (*head != 0) {
+    bp = bread(dp->dev, *head);
+    c = (struct dirchain *)bp->data;
+    if (c->n < NDIRSLOT) {
+      c->ent[c->n].hash = hash;
+      c->ent[c->n].slot = slot;
+      c->n++;
+      log_write(bp);
+      brelse(bp);
+      return 0;
+    }
+    brelse(bp);
+  }
+  if ((b = bzalloc(dp->dev)) == 0)
+    return -1;
+  bp = bread(dp->dev, b);
+  c = (struct dirchain *)bp->data;
+  c->next = *head;
+  c->n = 1;
+  c->ent[0].hash = hash;
+  c->ent[0].slot = slot;
+  log_write(bp);
+  brelse(bp);
+  *head = b;
+  log_write(rb);
+  return 0;
+}
+
+// Take slot out of the index chain starting at head.
+static void dirchainremove(struct inode *dp, uint head, uint slot) {
+  struct buf *bp;
+  struct dirchain *c;
+  int i;
+
+  while (head != 0) {
+    bp = bread(dp->dev, head);
+    c = (struct dirchain *)bp->data;
+    for (i = 0; i < c->n; i++) {
+      if (c->ent[i].slot == slot) {
+        c->ent[i] = c->ent[--c->n];
+        log_write(bp);
+        brelse(bp);
+        return;
+      }
+    }
+    head = c->next;
+    brelse(bp);
+  }
+  panic("dirchainremove");
+}
+
+// Free the index of dp; lookups fall back to scanning.
+static void dirindexdrop(struct inode *dp) {
+  struct buf *rb, *bp;
+  struct dirroot *root;
+  uint b, next;
+  int i;
+
+  rb = bread(dp->dev, dp->dirroot);
+  root = (struct dirroot *)rb->data;
+  for (i = -1; i < (int)NDIRBUCKET; i++) {
+    for (b = i < 0 ? root->free : root->bucket[i]; b != 0; b = next) {
+      bp = bread(dp->dev, b);
+      next = ((struct dirchain *)bp->data)->next;
+      brelse(bp);
+      bfree(dp->dev, b, 1);
+    }
+  }
+  brelse(rb);
+  bfree(dp->dev, dp->dirroot, 1);
+  dp->dirroot = 0;
+  iupdate(dp);
+}
+
+// Index every entry of dp.  Gives up quietly if the disk is full.
+// Caller must hold dp->lock and be inside a transaction.
+static void dirindexbuild(struct inode *dp) {
+  struct buf *rb, *bp;
+  struct dirroot *root;
+  struct dirent *d;
+  uint off, end, run, *head;
+  int ok;
+
+  if ((dp->dirroot = bzalloc(dp->dev)) == 0)
+    return;
+  rb = bread(dp->dev, dp->dirroot);
+  root = (struct dirroot *)rb->data;
+  root->magic = DIRMAGIC;
+  log_write(rb);
+
+  ok = 1;
+  for (off = 0; ok && off < dp->size; off = end) {
+    end = min(dp->size, (off / BSIZE + 1) * BSIZE);
+    bp = bread(dp->dev, bmap(dp, off / BSIZE, &run));
+    for (; ok && off < end; off += sizeof(*d)) {
+      d = (struct dirent *)(bp->data + off % BSIZE);
+      head = d->inum ? &root->bucket[dirhash(d->name) % NDIRBUCKET] : &root->free;
+      ok = dirchainadd(dp, rb, head, d->inum ? dirhash(d->name) : 0,
+                       off / sizeof(*d)) == 0;
+    }
+    brelse(bp);
+  }
+  brelse(rb);
+  iupdate(dp);
+  if (!ok)
+    dirindexdrop(dp);
+}
+
+// Find the entry named name through dp's index.  Copies it to *de
+// and returns its slot, or returns -1.
+static int dirindexfind(struct inode *dp, char *name, struct dirent *de) {
+  struct buf *rb, *bp;
+  struct dirroot *root;
+  struct dirchain *c;
+  uint h, b;
+  int i, slot;
+
+  h = dirhash(name);
+  rb = bread(dp->dev, dp->dirroot);
+  root = (struct dirroot *)rb->data;
+  if (root->magic != DIRMAGIC)
+    panic("dirindexfind");
+  b = root->bucket[h % NDIRBUCKET];
+  brelse(rb);
+
+  for (slot = -1; slot < 0 && b != 0;) {
+    bp = bread(dp->dev, b);
+    c = (struct dirchain *)bp->data;
+    for (i = 0; slot < 0 && i < c->n; i++) {
+      if (c->ent[i].hash != h)
+        continue;
+      if (readi(dp, (char *)de, c->ent[i].slot * sizeof(*de), sizeof(*de)) !=
+          sizeof(*de))
+        panic("dirindexfind read");
+      if (de->inum != 0 && namecmp(name, de->name) == 0)
+        slot = c->ent[i].slot;
+    }
+    b = c->next;
+    brelse(bp);
+  }
+  return slot;
+}
+
+static int dirfind(struct inode *dp, char *name, struct dirent *de) {
+  if (dp->dirroot != 0)
+    return dirindexfind(dp, name, de);
+  return dirscan(dp, name, de);
 }
 
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Callers that need no offset are answered from the dcache when
+// it has the name.
 struct inode *dirlookup(struct inode *dp, char *name, uint *poff) {
-  uint off, inum;
+  uint inum;
+  int slot;
   struct dirent de;
 
   if (dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for (off = 0; off < dp->size; off += sizeof(de)) {
-    if (readi(dp, (char *)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if (de.inum == 0)
-      continue;
-    if (namecmp(name, de.name) == 0) {
-      // entry matches path element
-      if (poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+  if (poff == 0 && dclookup(dp->dev, dp->inum, name, &inum))
+    return inum ? iget(dp->dev, inum) : 0;
+
+  if ((slot = dirfind(dp, name, &de)) >= 0) {
+    // entry matches path element
+    if (poff)
+      *poff = slot * sizeof(de);
+    inum = de.inum;
+    dcenter(dp->dev, dp->inum, name, inum);
+    return iget(dp->dev, inum);
+  }
+
+  dcenter(dp->dev, dp->inum, name, 0);
+  return 0;
+}
+
+// Write a new directory entry (name, inum) into dp, reusing a free
+// slot if there is one.  Returns -1 if the disk is full.
+// Caller must hold dp->lock and be inside a transaction.
+int dirlink(struct inode *dp, char *name, uint inum) {
+  struct buf *rb, *bp;
+  struct dirroot *root;
+  struct dirchain *c;
+  struct dirent de;
+  uint b;
+  int slot, ok, append;
+
+  rb = 0;
+  root = 0;
+  slot = -1;
+  if (dp->dirroot != 0) {
+    // Take a slot off the free chain.
+    rb = bread(dp->dev, dp->dirroot);
+    root = (struct dirroot *)rb->data;
+    if ((b = root->free) != 0) {
+      bp = bread(dp->dev, b);
+      c = (struct dirchain *)bp->data;
+      if (c->n > 0)
+        slot = c->ent[--c->n].slot;
+      if (c->n == 0) {
+        root->free = c->next;
+        log_write(rb);
+        brelse(bp);
+        bfree(dp->dev, b, 1);
+      } else {
+        log_write(bp);
+        brelse(bp);
+      }
     }
+  } else {
+    slot = dirscan(dp, 0, &de);
+  }
+  if ((append = slot < 0))
+    slot = dp->size / sizeof(de);
+
+  memset(&de, 0, sizeof(de));
+  de.inum = inum;
+  strncpy(de.name, name, DIRSIZ);
+  if (writei(dp, (char *)&de, slot * sizeof(de), sizeof(de)) != sizeof(de)) {
+    if (rb)
+      brelse(rb);
+    return -1;
+  }
+  dcenter(dp->dev, dp->inum, name, inum);
+
+  if (rb) {
+    b = dirhash(name);
+    ok = dirchainadd(dp, rb, &root->bucket[b % NDIRBUCKET], b, slot) == 0;
+    brelse(rb);
+    if (!ok)
+      dirindexdrop(dp);
+  } else if (append && dp->size == DIRINDEXMIN * BSIZE) {
+    // Only the create that appends the last dirent of DIRINDEXMIN
+    // blocks reserves DIRINDEXOPS(DIRINDEXMIN) for the build; other
+    // unindexed directories are left to dirindex.
+    dirindexbuild(dp);
   }
+  return 0;
+}
+
+// Index dp if it is past DIRINDEXMIN blocks without an index, as
+// after one was dropped, in a transaction of its own.  Directories
+// too big to index in one transaction are left to be scanned.
+// Caller must not hold dp->lock or be inside a transaction.
+void dirindex(struct inode *dp) {
+  uint nblk;
+
+  locki(dp);
+  nblk = (dp->size + BSIZE - 1) / BSIZE;
+  unlocki(dp);
+  if (nblk < DIRINDEXMIN || DIRINDEXOPS(nblk) > MAXWRITEOP)
+    return;
+
+  begin_opn(DIRINDEXOPS(nblk));
+  locki(dp);
+  // dp may have been indexed or grown while unlocked.
+  if (dp->dirroot == 0 && dp->size <= nblk * BSIZE)
+    dirindexbuild(dp);
+  unlocki(dp);
+  end_op();
+}
+
+// Remove the entry named name from dp.  Returns -1 if there is none.
+// Caller must hold dp->lock and be inside a transaction.
+int dirunlink(struct inode *dp, char *name) {
+  struct buf *rb;
+  struct dirroot *root;
+  struct dirent de;
+  uint h;
+  int slot, ok;
 
+  if ((slot = dirfind(dp, name, &de)) < 0)
+    return -1;
+  memset(&de, 0, sizeof(de));
+  if (writei(dp, (char *)&de, slot * sizeof(de), sizeof(de)) != sizeof(de))
+    panic("dirunlink");
+  dcenter(dp->dev, dp->inum, name, 0);
+
+  if (dp->dirroot != 0) {
+    h = dirhash(name);
+    rb = bread(dp->dev, dp->dirroot);
+    root = (struct dirroot *)rb->data;
+    dirchainremove(dp, root->bucket[h % NDIRBUCKET], slot);
+    ok = dirchainadd(dp, rb, &root->free, 0, slot) == 0;
+    brelse(rb);
+    if (!ok)
+      dirindexdrop(dp);
+  }
   return 0;
 }
 
@@ -599,7 +1987,7 @@ static struct inode *namex(char *path, int nameiparent, char *name) {
   if (*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(namei("/"));
+    ip = idup(icache.root);
 
   while ((path = skipelem(path, name)) != 0) {
     locki(ip);
@@ -643,31 +2031,40 @@ struct inode *nameiparent(char *path, char *name) {
 }
 
 int fileunlink(char* path) {
+  char name[DIRSIZ];
   struct inode * inode = namei(path);
   if (inode == NULL) {
     return -1;
-  } else if (inode->type == T_DEV || inode->type == T_DIR) {
-    inode->ref -= 1;
+  } else if (inode->type == T_DEV || inode->type == T_DIR ||
+             inode->ref > 1) {
+    irelease(inode);
     return -1;
   }
-  inode->ref -= 1;
-  if (inode->ref > 0) {
+  struct inode* dir = nameiparent(path, name);
+  if (dir == NULL) {
+    irelease(inode);
     return -1;
   }
-  inode->ref += 1;
+  // any of the bitmap blocks, the inode map block, the dinode, the
+  // dirent, the directory index root and chains, and the directory's
+  // dinode should the index have to be dropped
+  begin_opn(NBITMAP + 7);
   locki(inode);
-  struct inode* dir = &icache.inode[0];
-  struct inode* inodefile = &icache.inodefile;
   struct dinode di;
-  struct dirent de;
   // de.inum = 0;
   // concurrent_readi(inodefile, &di, INODEOFF(inode->inum), sizeof(di));
+  brsvdrop(inode);
   for (int i = 0; i < MAXEXTENT; i++) {
     if (inode->data[i].nblocks == 0) {
       break;
     }
     bfree(inode->dev, inode->data[i].startblkno, inode->data[i].nblocks);
   }
+  if (inode->extroot != 0)
+    exttreefree(inode->dev, inode->extroot);
+  inode->extroot = 0;
+  memset(inode->data, 0, sizeof(inode->data));
+  iextsums(inode);
   di.size = 0;
   di.devid = 0;
   di.type = 0;
@@ -675,22 +2072,25 @@ int fileunlink(char* path) {
     di.data[i].nblocks = 0;
     di.data[i].startblkno = 0;
   } 
-  concurrent_writei(inodefile, &di, INODEOFF(inode->inum), sizeof(di));
-  for (int off = 0; off < dir->size; off+=sizeof(de)) {
-    concurrent_readi(dir, &de, off, sizeof(de));
-    if (de.inum == inode->inum) {
-      de.inum = 0;
-      memmove(de.name, 0, DIRSIZ);
-      concurrent_writei(dir, &de, off, sizeof(de));
-    }
-  }
+  di.extroot = 0;
+  di.dirroot = 0;
+  write_dinode(inode->inum, &di);
+  ifree(inode->dev, inode->inum);
+  pcinval(inode->dev, inode->inum);
+  locki(dir);
+  dirunlink(dir, name);
+  unlocki(dir);
   // inode->dev=0;
   // inode->inum = 0;
   // inode->size = 0;
   // inode->valid =0;
   // inode->type=0;
 
+  // The inum may be handed out again; make the next locki reread it.
+  inode->valid = 0;
   unlocki(inode);
-  inode->ref -= 1;
+  end_op();
+  irelease(inode);
+  irelease(dir);
   return 0;
 }
@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Uses bus-master DMA through the PCI IDE
+// controller when there is one, and PIO otherwise.
 
 #include <cdefs.h>
 #include <defs.h>
@@ -6,6 +7,7 @@
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
+#include <pci.h>
 #include <proc.h>
 #include <sleeplock.h>
 #include <spinlock.h>
@@ -24,15 +26,53 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMULT 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// Bus master registers, relative to BAR4 of the controller.
+#define BM_CMD 0
+#define BM_STATUS 2
+#define BM_PRDT 4
+
+#define BM_CMD_START 0x01
+#define BM_CMD_READ 0x08 // device to memory
+#define BM_STATUS_ERR 0x02
+#define BM_STATUS_INTR 0x04
+
+// Physical region descriptor: one contiguous piece of memory
+// in a DMA transfer.
+struct prd {
+  uint addr;
+  ushort count; // bytes; 0 means 64KB
+  ushort flags;
+};
+#define PRD_EOT 0x8000 // last descriptor in the table
+
+// Sectors per DRQ block for READ/WRITE MULTIPLE.
+#define IDE_MULT 16
+// Most blocks moved by one command.
+#define IDE_MAXRUN 64
+
+// idequeue holds every buf waiting for the disk.  The first idenrun
+// bufs are the run the disk is working on: consecutive blocks on one
+// device, all reads or all writes, moved by a single command.  The rest
+// wait in C-SCAN order: ascending block numbers from idehead, then
+// wrapping around to the lowest.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenrun;         // bufs in the active run
+static int idexfer;         // bufs of the active run whose data has moved
+static struct buf *idenext; // next buf of the active run to move data for
+static uint idehead;        // block after the last one started
 
 static int havedisk1;
+static int idemult;        // sectors per DRQ block; 0 if SET MULTIPLE failed
+static int idedma;         // bus master DMA in use
+static ushort idebm;       // bus master I/O base
+static struct prd *ideprd; // descriptor table, IDE_MAXRUN entries
 static void idestart(struct buf *);
 
 // Wait for IDE disk to become ready.
@@ -46,6 +86,42 @@ static int idewait(int checkerr) {
   return 0;
 }
 
+// Ask disk to transfer IDE_MULT sectors per interrupt.
+// Interrupts from the disk must be masked.
+static int idesetmult(int disk) {
+  outb(0x1f6, 0xe0 | (disk << 4));
+  idewait(0);
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f7, IDE_CMD_SETMULT);
+  return idewait(1);
+}
+
+// Look for a bus-master PCI IDE controller whose primary channel
+// is the legacy one at 0x1f0 and set it up for DMA.
+static void idedmainit(void) {
+  struct pcifunc f;
+  uint bar;
+
+  if (pcifind(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &f) < 0)
+    return;
+  // Bit 7: bus master capable.  Bit 0: primary in native mode.
+  if (!(f.progif & 0x80) || (f.progif & 0x01))
+    return;
+  bar = pciread(&f, PCI_BAR(4));
+  if (!(bar & 1))
+    return;
+  if ((ideprd = (struct prd *)kalloc()) == 0)
+    return;
+
+  pciwrite(&f, PCI_COMMAND,
+           pciread(&f, PCI_COMMAND) | PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+  idebm = bar & ~3;
+  outb(idebm + BM_CMD, 0);
+  outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INTR);
+  idedma = 1;
+  cprintf("ide: dma via pci %x:%x.%x\n", f.bus, f.dev, f.func);
+}
+
 void ideinit(void) {
   int i;
 
@@ -63,34 +139,121 @@ void ideinit(void) {
     }
   }
 
+  // Use multiple mode only if every disk present accepts it.
+  outb(0x3f6, 2); // no interrupts
+  idemult = IDE_MULT;
+  if (idesetmult(0) < 0 || (havedisk1 && idesetmult(1) < 0))
+    idemult = 0;
+  if (BSIZE / SECTOR_SIZE > 1 && idemult % (BSIZE / SECTOR_SIZE) != 0)
+    panic("ideinit: block size");
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0 << 4));
+
+  idedmainit();
+}
+
+// Bufs moved per interrupt.
+static int idechunk(void) {
+  if (idemult == 0)
+    return 1;
+  return idemult / (BSIZE / SECTOR_SIZE);
+}
+
+// Move the data for the next chunk of the active run between the
+// bufs and the disk.
+static void idexferchunk(void) {
+  int i, n;
+
+  n = idenrun - idexfer;
+  if (n > idechunk())
+    n = idechunk();
+  for (i = 0; i < n; i++) {
+    if (idenext->flags & B_DIRTY)
+      outsl(0x1f0, idenext->data, BSIZE / 4);
+    else
+      insl(0x1f0, idenext->data, BSIZE / 4);
+    idenext = idenext->qnext;
+  }
+  idexfer += n;
+}
+
+// Point the bus master at the bufs of the active run.
+static void idedmaprep(struct buf *b, int n) {
+  uint64_t pa;
+  int i, k, write;
+
+  write = b->flags & B_DIRTY;
+  k = -1;
+  for (i = 0; i < n; i++, b = b->qnext) {
+    pa = V2P(b->data);
+    if (pa + BSIZE > 0x100000000ull)
+      panic("idedmaprep");
+    // Physically adjacent bufs share a descriptor.
+    if (k >= 0 && ideprd[k].addr + ideprd[k].count == pa &&
+        ideprd[k].count + BSIZE < 0x10000 && (pa & 0xffff) != 0) {
+      ideprd[k].count += BSIZE;
+      continue;
+    }
+    k++;
+    ideprd[k].addr = pa;
+    ideprd[k].count = BSIZE;
+    ideprd[k].flags = 0;
+  }
+  ideprd[k].flags = PRD_EOT;
+
+  outl(idebm + BM_PRDT, V2P(ideprd));
+  outb(idebm + BM_CMD, write ? 0 : BM_CMD_READ);
+  outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INTR);
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the run beginning at b, the head of idequeue, taking in
+// every following buf that continues it.  Caller must hold idelock.
 static void idestart(struct buf *b) {
-  if (b == 0)
+  struct buf *p;
+
+  if (b == 0 || b != idequeue)
     panic("idestart");
   if (b->blockno >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block = BSIZE / SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int read_cmd = idemult ? IDE_CMD_RDMUL : IDE_CMD_READ;
+  int write_cmd = idemult ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+  if (idedma) {
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+  }
 
-  if (sector_per_block > 7)
+  if (sector_per_block > 7 || (sector_per_block > 1 && !idemult))
     panic("idestart");
 
+  idenrun = 1;
+  for (p = b; p->qnext && idenrun < IDE_MAXRUN; p = p->qnext, idenrun++) {
+    if (p->qnext->dev != b->dev || p->qnext->blockno != p->blockno + 1 ||
+        (p->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+  }
+  idexfer = 0;
+  idenext = b;
+  idehead = b->blockno + idenrun;
+
+  if (idedma)
+    idedmaprep(b, idenrun);
+
   idewait(0);
-  outb(0x3f6, 0);                // generate interrupt
-  outb(0x1f2, sector_per_block); // number of sectors
+  outb(0x3f6, 0); // generate interrupt
+  outb(0x1f2, (idenrun * sector_per_block) & 0xff); // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
-  if (b->flags & B_DIRTY) {
+  if (idedma) {
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_CMD_START);
+  } else if (b->flags & B_DIRTY) {
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE / 4);
+    idexferchunk();
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -100,36 +263,85 @@ static void idestart(struct buf *b) {
 void ideintr(void) {
   struct buf *b;
 
-  // First queued buffer is the active request.
+  // The first idenrun queued buffers are the active request.
   acquire(&idelock);
   if ((b = idequeue) == 0) {
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if (!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE / 4);
+  if (idedma) {
+    // The whole run has moved, or the transfer failed.
+    uchar st = inb(idebm + BM_STATUS);
+    if (!(st & BM_STATUS_INTR)) {
+      release(&idelock);
+      return;
+    }
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_STATUS_ERR | BM_STATUS_INTR);
+    if ((st & BM_STATUS_ERR) || idewait(1) < 0) {
+      cprintf("ide: dma failed, falling back to pio\n");
+      idedma = 0;
+      idestart(b);
+      release(&idelock);
+      return;
+    }
+    idexfer = idenrun;
+  } else if (!(b->flags & B_DIRTY)) {
+    // A chunk of the read is ready.  On error give up on the run;
+    // like the single-sector driver, the bufs are marked valid anyway.
+    if (idewait(1) >= 0)
+      idexferchunk();
+    else
+      idexfer = idenrun;
+  } else if (idexfer < idenrun) {
+    // The disk has taken the last chunk; hand it the next one.
+    idexferchunk();
+    release(&idelock);
+    return;
+  }
+  if (idexfer < idenrun) {
+    release(&idelock);
+    return;
+  }
+
+  // The run is done.
+  for (; idenrun > 0; idenrun--) {
+    b = idequeue;
+    idequeue = b->qnext;
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Nobody is waiting for a read-ahead; hand it back to the cache.
+    if (b->flags & B_ASYNC) {
+      b->flags &= ~B_ASYNC;
+      biodone(b);
+    }
+  }
 
-  // Start disk on next buf in queue.
+  // Start disk on next run in queue.
   if (idequeue != 0)
     idestart(idequeue);
 
   release(&idelock);
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void iderw(struct buf *b) {
+// Position of b in the C-SCAN sweep that continues from idehead.
+static uint64_t idekey(struct buf *b) {
+  return ((uint64_t)(b->blockno < idehead) << 40) |
+         ((uint64_t)(b->dev & 1) << 32) | b->blockno;
+}
+
+// Insert b into idequeue behind the active run.  Does not start
+// the disk; see idekick.  Caller must hold idelock.
+static void idequeueadd(struct buf *b) {
   struct buf **pp;
+  uint64_t key;
+  int i;
 
   if (!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -138,22 +350,56 @@ void iderw(struct buf *b) {
   if (b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock); // DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for (pp = &idequeue; *pp; pp = &(*pp)->qnext) // DOC:insert-queue
+  pp = &idequeue;
+  for (i = 0; i < idenrun; i++)
+    pp = &(*pp)->qnext;
+  key = idekey(b);
+  for (; *pp && idekey(*pp) <= key; pp = &(*pp)->qnext) // DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+}
+
+// Start disk if it is idle.  Caller must hold idelock.
+static void idekick(void) {
+  if (idenrun == 0 && idequeue != 0)
+    idestart(idequeue);
+}
+
+// Start reading b from disk and return without waiting.
+// b must have B_ASYNC set; ideintr calls biodone when the read
+// completes, which releases b.
+void iderw_async(struct buf *b) {
+  if (!(b->flags & B_ASYNC) || (b->flags & B_DIRTY))
+    panic("iderw_async");
+
+  acquire(&idelock);
+  idequeueadd(b);
+  idekick();
+  release(&idelock);
+}
+
+// Sync n bufs with disk, as iderw does for one.  The requests are
+// queued together so that adjacent blocks go out as one command.
+void iderwv(struct buf **bs, int n) {
+  int i;
+
+  acquire(&idelock); // DOC:acquire-lock
 
-  // Start disk if necessary.
-  if (idequeue == b)
-    idestart(b);
+  for (i = 0; i < n; i++)
+    idequeueadd(bs[i]);
+  idekick();
 
-  // Wait for request to finish.
-  while ((b->flags & (B_VALID | B_DIRTY)) != B_VALID) {
-    sleep(b, &idelock);
+  // Wait for requests to finish.
+  for (i = 0; i < n; i++) {
+    while ((bs[i]->flags & (B_VALID | B_DIRTY)) != B_VALID)
+      sleep(bs[i], &idelock);
   }
 
   release(&idelock);
 }
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void iderw(struct buf *b) { iderwv(&b, 1); }
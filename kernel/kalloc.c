@@ -1,6 +1,29 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Free pages are kept by a binary buddy allocator: every free page
+// belongs to one free block of 2^k pages, k < NORDER, aligned to 2^k
+// pages and chained through its first page's core_map entry.
+// kallocpages splits a larger block when no block of the order asked
+// for is free, and kfreepages merges a block with its buddy for as
+// long as the buddy is free too.
+//
+// Single pages rarely touch the buddy lists: each CPU keeps a small
+// cache of free pages that kalloc and kfree use under a lock of its
+// own, and that moves pages to and from the buddy allocator, under
+// kmem.lock, KBATCH at a time.  Only a CPU that runs out of memory
+// takes another CPU's lock, to drain its cache.  Page reference counts are
+// changed atomically, so that kfree need not take a lock just to
+// drop a reference.
+//
+// The scheduler's idle loop zeroes free pages into a pool of up to
+// NZERO pages, from which kzalloc hands out pages that must start
+// out zeroed.  A page's core_map state records whether it is in use,
+// free, or free and known to hold zeroes, so kzalloc can skip the
+// memset for such a page even when the pool is empty.  Building with
+// KALLOC_DEBUG=1 fills freed pages with junk to catch dangling refs,
+// and checks on allocation that no free page was written to.
 
 #include <cdefs.h>
 #include <defs.h>
@@ -8,12 +31,15 @@
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
+#include <proc.h>
 #include <spinlock.h>
+#include <sysinfo.h>
 
 int npages = 0;
 int pages_in_use;
 int pages_in_swap;
 int free_pages;
+int free_blocks[NORDER]; // free buddy blocks of each order
 
 struct core_map_entry *core_map = NULL;
 
@@ -54,11 +80,28 @@ void detect_memory(void) {
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Pages a CPU cache takes from or gives back to the buddy allocator
+// at once.  A CPU caches at most 2 * KBATCH pages.
+#define KBATCH 32
+
+// Most pages the idle loop keeps zeroed for kzalloc.
+#define NZERO 32
+
 struct {
   struct spinlock lock;
   int use_lock;
+  struct core_map_entry *free[NORDER]; // free blocks of each order
+  struct core_map_entry *zero;         // pool of zeroed pages
+  int nzero;
 } kmem;
 
+// Free pages cached by each CPU.
+struct kcpu {
+  struct spinlock lock;
+  struct core_map_entry *free;
+  int n;
+} kcpu[NCPU];
+
 static void setrand(unsigned int);
 
 // Initialization happens in two phases.
@@ -69,9 +112,15 @@ static void setrand(unsigned int);
 void mem_init(void *vstart) {
   void *vend;
 
+  int i;
+
   core_map = vstart;
   memset(vstart, 0, PGROUNDUP(npages * sizeof(struct core_map_entry)));
   vstart += PGROUNDUP(npages * sizeof(struct core_map_entry));
+  for (i = 0; i < npages; i++)
+    core_map[i].order = -1;
+  for (i = 0; i < NCPU; i++)
+    initlock(&kcpu[i].lock, "kcpu");
 
   initlock(&kmem.lock, "kmem");
   kmem.use_lock = 0;
@@ -85,6 +134,149 @@ void mem_init(void *vstart) {
   setrand(1);
 }
 
+// Add r to the free list of order k.
+// Caller must hold kmem.lock.
+static void buddypush(struct core_map_entry *r, int k) {
+  r->order = k;
+  r->prev = 0;
+  r->next = kmem.free[k];
+  if (r->next)
+    r->next->prev = r;
+  kmem.free[k] = r;
+  free_blocks[k]++;
+}
+
+// Take r off its free list.
+// Caller must hold kmem.lock.
+static void buddyunlink(struct core_map_entry *r) {
+  if (r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[r->order] = r->next;
+  if (r->next)
+    r->next->prev = r->prev;
+  free_blocks[r->order]--;
+  r->order = -1;
+  r->next = r->prev = 0;
+}
+
+// Take a free block of order k, splitting a larger one if there is
+// none.  Returns 0 if no block is large enough.
+// Caller must hold kmem.lock.
+static struct core_map_entry *buddyalloc(int k) {
+  struct core_map_entry *r;
+  int j;
+
+  for (j = k; j < NORDER && kmem.free[j] == 0; j++)
+    ;
+  if (j == NORDER)
+    return 0;
+  r = kmem.free[j];
+  buddyunlink(r);
+  while (j > k) {
+    j--;
+    buddypush(r + (1 << j), j);
+  }
+  return r;
+}
+
+// Free block r of order k, merging it with its buddy for as long
+// as the buddy is a free block of the same order.
+// Caller must hold kmem.lock.
+static void buddyfree(struct core_map_entry *r, int k) {
+  struct core_map_entry *b;
+  uint64_t i;
+
+  for (; k < NORDER - 1; k++) {
+    i = (r - core_map) ^ ((uint64_t)1 << k);
+    if (i + ((uint64_t)1 << k) > npages)
+      break;
+    b = &core_map[i];
+    if (b->order != k)
+      break;
+    buddyunlink(b);
+    if (b < r)
+      r = b;
+  }
+  buddypush(r, k);
+}
+
+// Take a page from the zero pool, or 0 if it is empty.
+// Caller must hold kmem.lock.
+static struct core_map_entry *kzeropop(void) {
+  struct core_map_entry *r;
+
+  if ((r = kmem.zero) != 0) {
+    kmem.zero = r->next;
+    r->next = 0;
+    kmem.nzero--;
+  }
+  return r;
+}
+
+#if KALLOC_DEBUG
+// Panic if free page r was written to since it was freed or zeroed.
+static void kcheck(struct core_map_entry *r) {
+  char *v = P2V(page2pa(r));
+  char junk = r->state == PG_ZERO ? 0 : 2;
+  int i;
+
+  for (i = 0; i < PGSIZE; i++)
+    if (v[i] != junk)
+      panic("kalloc: free page modified");
+}
+#endif
+
+// Move up to KBATCH pages from the buddy allocator to c.
+// Caller must hold c->lock.
+static void krefill(struct kcpu *c) {
+  struct core_map_entry *r;
+
+  if (kmem.use_lock)
+    acquire(&kmem.lock);
+  while (c->n < KBATCH &&
+         ((r = buddyalloc(0)) != 0 || (r = kzeropop()) != 0)) {
+    r->next = c->free;
+    c->free = r;
+    c->n++;
+  }
+  if (kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Move n pages from c back to the buddy allocator.
+// Caller must hold c->lock.
+static void kdrain(struct kcpu *c, int n) {
+  struct core_map_entry *r;
+  int i;
+
+  if (kmem.use_lock)
+    acquire(&kmem.lock);
+  for (i = 0; i < n && (r = c->free) != 0; i++) {
+    c->free = r->next;
+    c->n--;
+    buddyfree(r, 0);
+  }
+  if (kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Move the pages every CPU caches back to the buddy allocator.
+// Returns the number of pages moved.
+static int kdrainall(void) {
+  struct kcpu *c;
+  int n;
+
+  n = 0;
+  for (c = kcpu; c < &kcpu[NCPU]; c++) {
+    acquire(&c->lock);
+    n += c->n;
+    kdrain(c, c->n);
+    release(&c->lock);
+  }
+  return n;
+}
+
 void freerange(void *vstart, void *vend) {
   char *p;
   p = (char *)PGROUNDUP((uint64_t)vstart);
@@ -98,30 +290,45 @@ void freerange(void *vstart, void *vend) {
 // initializing the allocator; see kinit above.)
 void kfree(char *v) {
   struct core_map_entry *r;
+  struct kcpu *c;
 
   if ((uint64_t)v % PGSIZE || v < _end || V2P(v) >= (uint64_t)(npages * PGSIZE))
     panic("kfree");
 
-  if (kmem.use_lock)
-    acquire(&kmem.lock);
-
   r = (struct core_map_entry *)pa2page(V2P(v));
 
-  r->ref--;
-  if (r->ref <= 0) {
-    pages_in_use--;
-    free_pages++;
+  if (__sync_sub_and_fetch(&r->ref, 1) > 0)
+    return;
+  if (r->state != PG_USED)
+    panic("kfree: page already free");
 
-    // Fill with junk to catch dangling refs.
-    memset(v, 2, PGSIZE);
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(v, 2, PGSIZE);
+#endif
 
-    r->available = 1;
-    r->user = 0;
-    r->va = 0;
-    r->ref = 0;
-  }
-  if (kmem.use_lock)
-    release(&kmem.lock);
+  r->state = PG_FREE;
+  r->user = 0;
+  r->va = 0;
+  r->ref = 0;
+  __sync_fetch_and_sub(&pages_in_use, 1);
+  __sync_fetch_and_add(&free_pages, 1);
+
+  pushcli();
+  c = &kcpu[mycpu() - cpus];
+  acquire(&c->lock);
+  r->next = c->free;
+  c->free = r;
+  if (++c->n > 2 * KBATCH)
+    kdrain(c, KBATCH);
+  release(&c->lock);
+  popcli();
+}
+
+// Take another reference to the page v, which must be in use.
+void kref(char *v) {
+  if (__sync_fetch_and_add(&pa2page(V2P(v))->ref, 1) <= 0)
+    panic("kref");
 }
 
 void
@@ -144,29 +351,192 @@ mark_kernel_mem(uint64_t pa)
   r->va = 0;
 }
 
+// Take a free page for kalloc or kzalloc and mark it in use,
+// leaving its state as it was while free.
+static struct core_map_entry *kget(void) {
+  struct core_map_entry *r;
+  struct kcpu *c;
+
+retry:
+  pushcli();
+  c = &kcpu[mycpu() - cpus];
+  acquire(&c->lock);
+  if (c->n == 0)
+    krefill(c);
+  if ((r = c->free) != 0) {
+    c->free = r->next;
+    c->n--;
+  }
+  release(&c->lock);
+  popcli();
+
+  if (r == 0) {
+    // Out of pages; take back those other CPUs cache, then some
+    // from the file caches.  The caches call kalloc with their own
+    // locks held, so each shrinker skips a cache whose lock is busy
+    // instead of waiting for it.
+    if (kdrainall() > 0 || pcshrink() > 0 || bshrink() > 0 ||
+        ishrink() > 0 || slabshrink() > 0)
+      goto retry;
+    return 0;
+  }
+
+#if KALLOC_DEBUG
+  kcheck(r);
+#endif
+  r->next = 0;
+  r->ref = 1;
+  __sync_fetch_and_add(&pages_in_use, 1);
+  __sync_fetch_and_sub(&free_pages, 1);
+  return r;
+}
+
 char *kalloc(void) {
+  struct core_map_entry *r;
 
-  int i;
+  if ((r = kget()) == 0)
+    return 0;
+  r->state = PG_USED;
+  return P2V(page2pa(r));
+}
+
+// Allocate a page filled with zeroes.  It comes from the pool the
+// idle loop keeps, if there is one there.
+char *kzalloc(void) {
+  struct core_map_entry *r;
+  char *v;
 
   if (kmem.use_lock)
     acquire(&kmem.lock);
+  r = kzeropop();
+  if (kmem.use_lock)
+    release(&kmem.lock);
 
-  for (i = 0; i < npages; i++) {
-    if (core_map[i].available == 1) {
-      core_map[i].available = 0;
-      pages_in_use++;
-      free_pages--;
-      core_map[i].ref = 1;
-      if (kmem.use_lock)
-        release(&kmem.lock);
-      return P2V(page2pa(&core_map[i]));
-    }
+  if (r != 0) {
+#if KALLOC_DEBUG
+    kcheck(r);
+#endif
+    r->ref = 1;
+    __sync_fetch_and_add(&pages_in_use, 1);
+    __sync_fetch_and_sub(&free_pages, 1);
+  } else if ((r = kget()) == 0) {
+    return 0;
+  }
+
+  v = P2V(page2pa(r));
+  if (r->state != PG_ZERO)
+    memset(v, 0, PGSIZE);
+  r->state = PG_USED;
+  return v;
+}
+
+// Zero one free page into the pool for kzalloc, unless it is full.
+// Called by the scheduler when it has nothing to run.
+void kzeroidle(void) {
+  struct core_map_entry *r;
+
+  if (kmem.nzero >= NZERO)
+    return;
+
+  acquire(&kmem.lock);
+  r = buddyalloc(0);
+  release(&kmem.lock);
+  if (r == 0)
+    return;
+
+  if (r->state != PG_ZERO) {
+    memset(P2V(page2pa(r)), 0, PGSIZE);
+    r->state = PG_ZERO;
   }
 
+  acquire(&kmem.lock);
+  r->next = kmem.zero;
+  kmem.zero = r;
+  kmem.nzero++;
+  release(&kmem.lock);
+}
+
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Free them with kfreepages.
+// Returns 0 if no block that large can be had.
+char *kallocpages(int order) {
+  struct core_map_entry *r, *z;
+  int i, drained;
+
+  if (order == 0)
+    return kalloc();
+  if (order < 0 || order >= NORDER)
+    return 0;
+
+retry:
+  if (kmem.use_lock)
+    acquire(&kmem.lock);
+  r = buddyalloc(order);
   if (kmem.use_lock)
     release(&kmem.lock);
 
-  return 0;
+  if (r == 0) {
+    // Pages in a CPU cache or the zero pool cannot merge with their
+    // buddies, so hand them back before taking pages from the file
+    // caches.
+    drained = kdrainall();
+    acquire(&kmem.lock);
+    for (; (z = kzeropop()) != 0; drained++)
+      buddyfree(z, 0);
+    release(&kmem.lock);
+    if (drained > 0 || pcshrink() > 0 || bshrink() > 0 || ishrink() > 0 ||
+        slabshrink() > 0)
+      goto retry;
+    return 0;
+  }
+
+  for (i = 0; i < 1 << order; i++) {
+#if KALLOC_DEBUG
+    kcheck(&r[i]);
+#endif
+    r[i].state = PG_USED;
+    r[i].ref = 1;
+  }
+  __sync_fetch_and_add(&pages_in_use, 1 << order);
+  __sync_fetch_and_sub(&free_pages, 1 << order);
+  return P2V(page2pa(r));
+}
+
+// Free the 2^order pages at v, which kallocpages returned.
+void kfreepages(char *v, int order) {
+  struct core_map_entry *r;
+  int i;
+
+  if (order == 0) {
+    kfree(v);
+    return;
+  }
+  if (order < 0 || order >= NORDER ||
+      (uint64_t)v % (PGSIZE << order) || v < _end ||
+      V2P(v) + (PGSIZE << order) > (uint64_t)(npages * PGSIZE))
+    panic("kfreepages");
+
+  r = pa2page(V2P(v));
+  for (i = 0; i < 1 << order; i++) {
+    if (r[i].state != PG_USED)
+      panic("kfreepages: page already free");
+    r[i].state = PG_FREE;
+    r[i].user = 0;
+    r[i].va = 0;
+    r[i].ref = 0;
+  }
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(v, 2, PGSIZE << order);
+#endif
+  __sync_fetch_and_sub(&pages_in_use, 1 << order);
+  __sync_fetch_and_add(&free_pages, 1 << order);
+
+  if (kmem.use_lock)
+    acquire(&kmem.lock);
+  buddyfree(r, order);
+  if (kmem.use_lock)
+    release(&kmem.lock);
 }
 
 
@@ -194,14 +564,3 @@ struct core_map_entry * get_random_user_page() {
   }
   panic("Tried 100 random indices for random user page, all failed");
 }
-
-void acquire_map_lock() {
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-}
-
-void release_map_lock() {
-  if(kmem.use_lock){
-    release(&kmem.lock);
-  }
-}
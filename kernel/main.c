@@ -12,6 +12,7 @@ int main(uint64_t addr) {
   e820_init(addr);
   detect_memory();
   mem_init(_end); // phys page allocator
+  slabinit();     // kernel object caches
   vspacebootinit();
   mpinit();
   lapicinit();
@@ -26,6 +27,7 @@ int main(uint64_t addr) {
   pinit();
   tvinit();   // trap vectors
   binit();    // buffer cache
+  fileinit(); // file table
   ideinit();  // disk
   userinit(); // first user process
   mpmain();
@@ -53,3 +53,22 @@ void iderw(struct buf *b) {
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk has no latency to hide; read b now
+// and hand it back to the cache.
+void iderw_async(struct buf *b) {
+  if (!(b->flags & B_ASYNC) || (b->flags & B_DIRTY))
+    panic("iderw_async");
+
+  iderw(b);
+  b->flags &= ~B_ASYNC;
+  biodone(b);
+}
+
+// Sync n bufs with disk, as iderw does for one.
+void iderwv(struct buf **bs, int n) {
+  int i;
+
+  for (i = 0; i < n; i++)
+    iderw(bs[i]);
+}
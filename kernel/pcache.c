@@ -0,0 +1,206 @@
+// Page cache.
+//
+// Caches file contents a page at a time, keyed on (dev, inum, page
+// number).  readi copies file data straight out of cached pages, and
+// fills a missing page with one batch of disk reads into the page
+// itself, rather than copying through 512-byte buffers.
+//
+// Writes still go through the buffer cache and the log so that they
+// stay crash safe; writei copies what it writes into any cached page
+// it covers with pcwrite, so the two caches never disagree.  Callers
+// serialize access to a file's pages with its inode lock, so a page
+// needs no lock of its own, only a ref to keep it from being
+// recycled while in use.
+//
+// A page whose frame is also mapped into a process (its core_map
+// ref is above 1) is never recycled, so that mappings keep sharing it.
+// Frames are kalloc'd on first use, and kalloc calls pcshrink to take
+// back unused ones when it runs out.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <spinlock.h>
+
+#include <pcache.h>
+
+// Most pages cached, and number of hash buckets.
+#define NPCPAGE 256
+#define NPCHASH 61
+
+struct {
+  struct spinlock lock;
+  struct cpage page[NPCPAGE];
+  struct cpage *hash[NPCHASH];
+
+  // All pages, through prev/next.  head.next is most recently used.
+  struct cpage head;
+} pcache;
+
+static struct cpage **pchash(uint dev, uint inum, uint pgno) {
+  return &pcache.hash[((dev * 31 + inum) * 31 + pgno) % NPCHASH];
+}
+
+// Caller must hold pcache.lock.
+static struct cpage *pcfind(uint dev, uint inum, uint pgno) {
+  struct cpage *p;
+
+  for (p = *pchash(dev, inum, pgno); p; p = p->hnext)
+    if (p->inum == inum && p->dev == dev && p->pgno == pgno)
+      return p;
+  return 0;
+}
+
+// Take p out of the hash table and forget its file.
+// Caller must hold pcache.lock.
+static void pcunhash(struct cpage *p) {
+  struct cpage **pp;
+
+  if (p->inum == 0)
+    return;
+  for (pp = pchash(p->dev, p->inum, p->pgno); *pp != p; pp = &(*pp)->hnext)
+    ;
+  *pp = p->hnext;
+  p->hnext = 0;
+  p->inum = 0;
+  p->valid = 0;
+}
+
+// Move p to the head of the LRU list, or the tail if tail is set.
+// Caller must hold pcache.lock.
+static void pcmove(struct cpage *p, int tail) {
+  struct cpage *at = tail ? pcache.head.prev : &pcache.head;
+
+  if (at == p)
+    return;
+  p->next->prev = p->prev;
+  p->prev->next = p->next;
+  p->prev = at;
+  p->next = at->next;
+  at->next->prev = p;
+  at->next = p;
+}
+
+// Is p's frame mapped into some process?
+static int pcmapped(struct cpage *p) {
+  return p->data != 0 && pa2page(V2P(p->data))->ref > 1;
+}
+
+void pcinit(void) {
+  struct cpage *p;
+
+  initlock(&pcache.lock, "pcache");
+  pcache.head.prev = &pcache.head;
+  pcache.head.next = &pcache.head;
+  for (p = pcache.page; p < pcache.page + NPCPAGE; p++) {
+    p->next = pcache.head.next;
+    p->prev = &pcache.head;
+    pcache.head.next->prev = p;
+    pcache.head.next = p;
+  }
+}
+
+// Return page pgno of file (dev, inum) with a reference held.  If
+// p->valid is not set, the caller must fill p->data and set it.
+// Returns 0 if no page can be had.
+struct cpage *pcget(uint dev, uint inum, uint pgno) {
+  struct cpage *p;
+
+  acquire(&pcache.lock);
+  if ((p = pcfind(dev, inum, pgno)) != 0) {
+    p->ref++;
+    pcmove(p, 0);
+    release(&pcache.lock);
+    return p;
+  }
+
+  // Recycle the least recently used page nobody is using.
+  for (p = pcache.head.prev; p != &pcache.head; p = p->prev)
+    if (p->ref == 0 && !pcmapped(p))
+      break;
+  if (p == &pcache.head ||
+      (p->data == 0 && (p->data = kalloc()) == 0)) {
+    release(&pcache.lock);
+    return 0;
+  }
+  pcunhash(p);
+  p->dev = dev;
+  p->inum = inum;
+  p->pgno = pgno;
+  p->ref = 1;
+  p->hnext = *pchash(dev, inum, pgno);
+  *pchash(dev, inum, pgno) = p;
+  pcmove(p, 0);
+  release(&pcache.lock);
+  return p;
+}
+
+void pcrelease(struct cpage *p) {
+  acquire(&pcache.lock);
+  if (p->ref < 1)
+    panic("pcrelease");
+  p->ref--;
+  release(&pcache.lock);
+}
+
+// Copy n bytes written at file offset off, within one page, into
+// the cached page if there is one.
+void pcwrite(uint dev, uint inum, uint off, char *src, uint n) {
+  struct cpage *p;
+
+  acquire(&pcache.lock);
+  p = pcfind(dev, inum, off / PGSIZE);
+  if (p && p->valid)
+    memmove(p->data + off % PGSIZE, src, n);
+  release(&pcache.lock);
+}
+
+// Forget every cached page of file (dev, inum), which is going
+// away.  Processes that have its pages mapped keep their frames.
+void pcinval(uint dev, uint inum) {
+  struct cpage *p;
+
+  acquire(&pcache.lock);
+  for (p = pcache.page; p < pcache.page + NPCPAGE; p++) {
+    if (p->inum != inum || p->dev != dev)
+      continue;
+    if (p->ref != 0)
+      panic("pcinval: page in use");
+    pcunhash(p);
+    if (pcmapped(p)) {
+      kfree(p->data);
+      p->data = 0;
+    }
+    pcmove(p, 1);
+  }
+  release(&pcache.lock);
+}
+
+// Give one cached page back to the page allocator.
+// Called by kalloc when it runs out of pages.
+// Returns the number of pages freed.
+int pcshrink(void) {
+  struct cpage *p;
+  char *data;
+
+  // The holder may be in pcget, or in kalloc waiting on a lock this
+  // CPU holds; back off rather than spin.
+  if (!tryacquire(&pcache.lock))
+    return 0;
+
+  for (p = pcache.head.prev; p != &pcache.head; p = p->prev) {
+    if (p->data != 0 && p->ref == 0 && !pcmapped(p)) {
+      pcunhash(p);
+      data = p->data;
+      p->data = 0;
+      pcmove(p, 1);
+      release(&pcache.lock);
+      kfree(data);
+      return 1;
+    }
+  }
+  release(&pcache.lock);
+  return 0;
+}
@@ -0,0 +1,64 @@
+// PCI configuration space access through the legacy
+// 0xcf8/0xcfc I/O ports.  Enough to find a device by class
+// and read and program its registers.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <pci.h>
+#include <x86_64.h>
+
+#define PCI_CONFADDR 0xcf8
+#define PCI_CONFDATA 0xcfc
+
+static uint pciaddr(uint bus, uint dev, uint func, uint off) {
+  return (1u << 31) | (bus << 16) | (dev << 11) | (func << 8) | (off & 0xfc);
+}
+
+static uint pciconfread(uint bus, uint dev, uint func, uint off) {
+  outl(PCI_CONFADDR, pciaddr(bus, dev, func, off));
+  return inl(PCI_CONFDATA);
+}
+
+// Read the 32-bit configuration register at off.
+uint pciread(struct pcifunc *f, uint off) {
+  return pciconfread(f->bus, f->dev, f->func, off);
+}
+
+// Write the 32-bit configuration register at off.
+void pciwrite(struct pcifunc *f, uint off, uint val) {
+  outl(PCI_CONFADDR, pciaddr(f->bus, f->dev, f->func, off));
+  outl(PCI_CONFDATA, val);
+}
+
+// Find the first function with the given class and subclass.
+// Returns 0 and fills in *f if there is one, -1 otherwise.
+int pcifind(uchar class, uchar subclass, struct pcifunc *f) {
+  uint bus, dev, func, nfunc, id, cl;
+
+  for (bus = 0; bus < 256; bus++) {
+    for (dev = 0; dev < 32; dev++) {
+      nfunc = 1;
+      for (func = 0; func < nfunc; func++) {
+        id = pciconfread(bus, dev, func, PCI_ID);
+        if ((id & 0xffff) == 0xffff)
+          continue;
+        // Only multi-function devices have functions past 0.
+        if (func == 0 && (pciconfread(bus, dev, 0, PCI_HEADER) & 0x800000))
+          nfunc = 8;
+        cl = pciconfread(bus, dev, func, PCI_CLASS);
+        if ((cl >> 24) != class || ((cl >> 16) & 0xff) != subclass)
+          continue;
+        f->bus = bus;
+        f->dev = dev;
+        f->func = func;
+        f->vendor = id & 0xffff;
+        f->device = id >> 16;
+        f->class = cl >> 24;
+        f->subclass = (cl >> 16) & 0xff;
+        f->progif = (cl >> 8) & 0xff;
+        return 0;
+      }
+    }
+  }
+  return -1;
+}
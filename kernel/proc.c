@@ -231,22 +231,34 @@ int sbrk(int n) {
   uint64_t base = vr -> va_base;
   uint64_t size = vr -> size;
   uint64_t bound = base + size;
+  int unfilled;
   if (n >= 0) {
-    if (vregionaddmap(vr, bound, n, VPI_PRESENT, VPI_WRITABLE) < 0) {
+    // Pages are filled with zeroes on first touch (see vregionfault),
+    // so only move the bound, unless the free pages could not fill
+    // these along with every other untouched heap page.
+    int grow = (PGROUNDUP(bound + n) - PGROUNDUP(bound)) / PGSIZE;
+    if (bound + n > MMAPBASE || heap_unfilled + grow > free_pages) {
       release(&ptable.lock);
       return -1;
     }
+    __sync_fetch_and_add(&heap_unfilled, grow);
+    vr -> size += n;
+    release(&ptable.lock);
+    return bound;
   } else if (-n > size) {
     release(&ptable.lock);
     return bound;
   } else {
+    unfilled = vregionunfilled(vr);
     if (vregiondelmap(vr, bound, -n) < 0) {
       release(&ptable.lock);
       return -1;
     }
   }
   vr -> size += n;
+  __sync_fetch_and_sub(&heap_unfilled, unfilled - vregionunfilled(vr));
   vspaceinvalidate(vs);
+  vspaceinstall(myproc());
   release(&ptable.lock);
   return bound;
 }
@@ -260,16 +272,19 @@ int sbrk(int n) {
 //      via swtch back to the scheduler.
 void scheduler(void) {
   struct proc *p;
+  int ran;
 
   for (;;) {
     // Enable interrupts on this processor.
     sti();
 
     // Loop over process table looking for process to run.
+    ran = 0;
     acquire(&ptable.lock);
     for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
       if (p->state != RUNNABLE)
         continue;
+      ran = 1;
 
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
@@ -285,6 +300,10 @@ void scheduler(void) {
       mycpu()->proc = 0;
     }
     release(&ptable.lock);
+
+    // Nothing to run; zero a free page for kzalloc meanwhile.
+    if (!ran)
+      kzeroidle();
   }
 }
 
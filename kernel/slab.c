@@ -0,0 +1,308 @@
+// Slab allocator for kernel objects.
+//
+// A cache hands out objects of one size, carved out of slabs: blocks
+// of 2^order pages from kallocpages.  Blocks are aligned to their
+// size, so an object's slab is found by rounding its address down.
+// Each slab starts with a header and the links of its free list,
+// kept outside the objects so that a free object keeps the state
+// its cache's constructor gave it.  The constructor runs once per
+// object, when its slab is made, and callers must hand objects back
+// in that state.
+//
+// Each CPU keeps a magazine of up to NMAG free objects per cache,
+// which kmem_cache_alloc and kmem_cache_free use with interrupts off
+// and no lock.  A magazine refills from and drains to the slabs,
+// under the cache lock, NMAG / 2 objects at a time.  kalloc calls
+// slabshrink to take back empty slabs when it runs out of pages.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+
+#define NCACHE 16        // most caches
+#define NMAG 16          // objects in a full magazine
+#define SLABMAXORDER 3   // largest slab is 2^SLABMAXORDER pages
+#define SLABEND 0xffff   // end of a slab's free list
+
+struct slab {
+  struct kmem_cache *cache;
+  struct slab *next;    // on one of the cache's lists
+  struct slab *prev;
+  char *obj;            // first object
+  ushort free;          // first free object, or SLABEND
+  ushort inuse;         // objects taken from the slab
+  ushort link[];        // free object after each free object
+};
+
+struct kmag {
+  int n;
+  void *obj[NMAG];
+};
+
+struct kmem_cache {
+  char name[16];
+  uint size;            // object size, rounded up to 8 bytes
+  void (*ctor)(void *);
+  int order;            // slabs are 2^order pages
+  uint perslab;         // objects per slab
+  struct spinlock lock;
+  struct slab *partial; // slabs with free and used objects
+  struct slab *full;    // slabs with no free objects
+  struct slab *empty;   // slabs with no used objects
+  struct kmag mag[NCPU];
+
+  // statistics
+  uint nslab;           // slabs held; protected by lock
+  int nactive;          // objects held by callers
+  uint64_t nalloc;      // successful allocations
+  uint64_t nfail;       // failed allocations
+};
+
+struct {
+  struct spinlock lock;
+  struct kmem_cache cache[NCACHE];
+  int n;
+} slabs;
+
+void slabinit(void) {
+  initlock(&slabs.lock, "slabs");
+}
+
+// Objects that fit in a slab of 2^order pages, and where in the slab
+// the first one starts.
+static uint slabfit(uint size, int order, uint *start) {
+  uint bytes = PGSIZE << order;
+  uint n;
+
+  n = (bytes - sizeof(struct slab)) / (size + sizeof(ushort));
+  for (; n > 0; n--) {
+    *start = (sizeof(struct slab) + n * sizeof(ushort) + 7) & ~7;
+    if (*start + n * size <= bytes)
+      break;
+  }
+  return n;
+}
+
+// Make a cache of size-byte objects named name, each set up by
+// ctor, if it is not 0, before it is first handed out.
+struct kmem_cache *kmem_cache_create(char *name, uint size,
+                                     void (*ctor)(void *)) {
+  struct kmem_cache *c;
+  uint start, n;
+  int order;
+
+  size = (size + 7) & ~7;
+
+  // The smallest slab that wastes no more than an eighth of itself.
+  for (order = 0; order <= SLABMAXORDER; order++) {
+    n = slabfit(size, order, &start);
+    if (n > 0 && (PGSIZE << order) - start - n * size <= (PGSIZE << order) / 8)
+      break;
+  }
+  if (order > SLABMAXORDER)
+    order = SLABMAXORDER;
+  if ((n = slabfit(size, order, &start)) == 0)
+    panic("kmem_cache_create: object too large");
+
+  acquire(&slabs.lock);
+  if (slabs.n == NCACHE)
+    panic("kmem_cache_create: too many caches");
+  c = &slabs.cache[slabs.n++];
+  release(&slabs.lock);
+
+  safestrcpy(c->name, name, sizeof(c->name));
+  c->size = size;
+  c->ctor = ctor;
+  c->order = order;
+  c->perslab = n;
+  initlock(&c->lock, c->name);
+  return c;
+}
+
+static void slabunlink(struct slab **head, struct slab *s) {
+  if (s->prev)
+    s->prev->next = s->next;
+  else
+    *head = s->next;
+  if (s->next)
+    s->next->prev = s->prev;
+}
+
+static void slabpush(struct slab **head, struct slab *s) {
+  s->prev = 0;
+  s->next = *head;
+  if (s->next)
+    s->next->prev = s;
+  *head = s;
+}
+
+// The list s belongs on.
+static struct slab **slablist(struct kmem_cache *c, struct slab *s) {
+  if (s->inuse == 0)
+    return &c->empty;
+  if (s->inuse == c->perslab)
+    return &c->full;
+  return &c->partial;
+}
+
+// Make a new slab of constructed objects and put it on c->empty.
+// Returns 0 if out of memory.
+// Caller must hold c->lock.
+static struct slab *slabgrow(struct kmem_cache *c) {
+  struct slab *s;
+  uint start, i;
+
+  if ((s = (struct slab *)kallocpages(c->order)) == 0)
+    return 0;
+  slabfit(c->size, c->order, &start);
+  s->cache = c;
+  s->obj = (char *)s + start;
+  s->inuse = 0;
+  s->free = 0;
+  for (i = 0; i < c->perslab; i++) {
+    s->link[i] = i + 1 < c->perslab ? i + 1 : SLABEND;
+    if (c->ctor)
+      c->ctor(s->obj + i * c->size);
+  }
+  slabpush(&c->empty, s);
+  c->nslab++;
+  return s;
+}
+
+// Take a free object out of a slab, making a slab if none has one.
+// Returns 0 if out of memory.
+// Caller must hold c->lock.
+static void *slabget(struct kmem_cache *c) {
+  struct slab *s;
+  char *obj;
+
+  if ((s = c->partial) == 0 && (s = c->empty) == 0 &&
+      (s = slabgrow(c)) == 0)
+    return 0;
+  slabunlink(slablist(c, s), s);
+  obj = s->obj + s->free * c->size;
+  s->free = s->link[s->free];
+  s->inuse++;
+  slabpush(slablist(c, s), s);
+  return obj;
+}
+
+// Put obj back in its slab.
+// Caller must hold c->lock.
+static void slabput(struct kmem_cache *c, void *obj) {
+  struct slab *s;
+  uint i;
+
+  s = (struct slab *)((uint64_t)obj & ~((uint64_t)(PGSIZE << c->order) - 1));
+  if (s->cache != c)
+    panic("kmem_cache_free: object not from this cache");
+  i = ((char *)obj - s->obj) / c->size;
+  slabunlink(slablist(c, s), s);
+  s->link[i] = s->free;
+  s->free = i;
+  s->inuse--;
+  slabpush(slablist(c, s), s);
+}
+
+// Refill m with up to NMAG / 2 objects.
+// Caller must have interrupts off.
+static void magfill(struct kmem_cache *c, struct kmag *m) {
+  void *obj;
+
+  acquire(&c->lock);
+  while (m->n < NMAG / 2 && (obj = slabget(c)) != 0)
+    m->obj[m->n++] = obj;
+  release(&c->lock);
+}
+
+// Return n objects from m to their slabs.
+// Caller must have interrupts off.
+static void magdrain(struct kmem_cache *c, struct kmag *m, int n) {
+  acquire(&c->lock);
+  while (n-- > 0 && m->n > 0)
+    slabput(c, m->obj[--m->n]);
+  release(&c->lock);
+}
+
+// Allocate an object from c, in the state its constructor left it.
+// Returns 0 if out of memory.
+void *kmem_cache_alloc(struct kmem_cache *c) {
+  struct kmag *m;
+  void *obj;
+
+  pushcli();
+  m = &c->mag[mycpu() - cpus];
+  if (m->n == 0)
+    magfill(c, m);
+  obj = m->n > 0 ? m->obj[--m->n] : 0;
+  popcli();
+
+  if (obj == 0) {
+    __sync_fetch_and_add(&c->nfail, 1);
+    return 0;
+  }
+  __sync_fetch_and_add(&c->nalloc, 1);
+  __sync_fetch_and_add(&c->nactive, 1);
+  return obj;
+}
+
+// Give obj back to c, the cache it came from.
+void kmem_cache_free(struct kmem_cache *c, void *obj) {
+  struct kmag *m;
+
+  pushcli();
+  m = &c->mag[mycpu() - cpus];
+  if (m->n == NMAG)
+    magdrain(c, m, NMAG / 2);
+  m->obj[m->n++] = obj;
+  popcli();
+  __sync_fetch_and_sub(&c->nactive, 1);
+}
+
+// Give one empty slab back to the page allocator, after emptying
+// this CPU's magazines into the slabs.
+// Called by kalloc when it runs out of pages.
+// Returns the number of pages freed.
+int slabshrink(void) {
+  struct kmem_cache *c;
+  struct kmag *m;
+  struct slab *s;
+
+  for (c = slabs.cache; c < slabs.cache + slabs.n; c++) {
+    // The holder may be growing this cache, or in kalloc waiting on
+    // a lock this CPU holds; skip it rather than spin.
+    pushcli();
+    if (!tryacquire(&c->lock)) {
+      popcli();
+      continue;
+    }
+    m = &c->mag[mycpu() - cpus];
+    while (m->n > 0)
+      slabput(c, m->obj[--m->n]);
+    popcli();
+
+    if ((s = c->empty) != 0) {
+      slabunlink(&c->empty, s);
+      c->nslab--;
+      release(&c->lock);
+      kfreepages((char *)s, c->order);
+      return 1 << c->order;
+    }
+    release(&c->lock);
+  }
+  return 0;
+}
+
+// Print usage of each cache.  Runs when user types ^P on console.
+void slabdump(void) {
+  struct kmem_cache *c;
+
+  for (c = slabs.cache; c < slabs.cache + slabs.n; c++)
+    cprintf("%s: size %d, %d per slab, %d slabs, %d active, "
+            "%d allocs, %d failed\n",
+            c->name, c->size, c->perslab, c->nslab, c->nactive,
+            (int)c->nalloc, (int)c->nfail);
+}
@@ -38,6 +38,21 @@ void acquire(struct spinlock *lk) {
   getcallerpcs(&lk, lk->pcs);
 }
 
+// Acquire the lock if it is free, without spinning.
+// Returns 1 if it was acquired, 0 if someone holds it.
+int tryacquire(struct spinlock *lk) {
+  pushcli();
+  if (holding(lk) || xchg(&lk->locked, 1) != 0) {
+    popcli();
+    return 0;
+  }
+  __sync_synchronize();
+
+  lk->cpu = mycpu();
+  getcallerpcs(&lk, lk->pcs);
+  return 1;
+}
+
 // Release the lock.
 void release(struct spinlock *lk) {
   if (!holding(lk))
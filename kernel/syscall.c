@@ -25,6 +25,8 @@
     v = &myproc()->vspace; \
     for (r = v->regions; r < &v->regions[NREGIONS]; r++) { \
       if (vregioncontains(r, addr, sizeof(type))) { \
+        if (vregionfault(v, r, addr, sizeof(type)) < 0) \
+          return -1; \
         *ip = *(type *)(addr); \
         return 0; \
       } \
@@ -57,6 +59,10 @@ fetchstr(uint64_t addr, char **pp)
       *pp = (char*)addr;
       ep = (char *)VRTOP(r);
       for(s = *pp; s < ep; s++) {
+        // fill each page before reading it, as argptr does
+        if ((s == *pp || (uint64_t)s % PGSIZE == 0) &&
+            vregionfault(v, r, (uint64_t)s, 1) < 0)
+          return -1;
         if(*s == 0)
           return s - *pp;
       }
@@ -111,6 +117,9 @@ int argptr(int n, char **pp, int size) {
   v = &myproc()->vspace;
   for (r = v->regions; r < &v->regions[NREGIONS]; r++) {
     if (vregioncontains(r, i, size)) {
+      // fill heap and file pages now, so the kernel never faults on them
+      if (vregionfault(v, r, i, size) < 0)
+        return -1;
       *pp = (char*)i;
       return 0;
     }
@@ -148,6 +157,8 @@ extern int sys_uptime(void);
 extern int sys_sysinfo(void);
 extern int sys_crashn(void);
 extern int sys_unlink(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
 
 static int (*syscalls[])(void) = {
     [SYS_fork] = sys_fork,       [SYS_exit] = sys_exit,
@@ -159,7 +170,8 @@ static int (*syscalls[])(void) = {
     [SYS_uptime] = sys_uptime,   [SYS_open] = sys_open,
     [SYS_write] = sys_write,     [SYS_close] = sys_close,
     [SYS_sysinfo] = sys_sysinfo, [SYS_crashn] = sys_crashn,
-    [SYS_unlink] = sys_unlink,
+    [SYS_unlink] = sys_unlink,   [SYS_mmap] = sys_mmap,
+    [SYS_munmap] = sys_munmap,
 };
 
 void syscall(void) {
@@ -177,7 +189,7 @@ void syscall(void) {
 int sys_sysinfo(void) {
   struct sys_info *info;
 
-  if (argptr(0, (void *)&info, sizeof(info)) < 0)
+  if (argptr(0, (void *)&info, sizeof(*info)) < 0)
     return -1;
 
   info->pages_in_use = pages_in_use;
@@ -185,6 +197,9 @@ int sys_sysinfo(void) {
   info->free_pages = free_pages;
   info->num_page_faults = num_page_faults;
   info->num_disk_reads = num_disk_reads;
+  info->num_bcache_hits = num_bcache_hits;
+  info->num_bcache_misses = num_bcache_misses;
+  memmove(info->free_blocks, free_blocks, sizeof(info->free_blocks));
 
   return 0;
 }
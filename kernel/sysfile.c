@@ -170,4 +170,43 @@ int sys_unlink(void)
     return -1;
   }
   return fileunlink(path);
-}
\ No newline at end of file
+}
+/*
+ * arg0: int [file descriptor]
+ * arg1: int [offset in the file, a multiple of the page size]
+ * arg2: int [number of bytes to map]
+ * arg3: int [PROT_READ, optionally or'd with PROT_WRITE]
+ *
+ * Maps part of an open file into the caller's address space. Pages
+ * are read in when first touched, and processes mapping the same
+ * page share it. Writes to a PROT_WRITE mapping are private to the
+ * process and do not change the file.
+ *
+ * returns the address of the mapping, or -1 on error
+ */
+int sys_mmap(void)
+{
+  int fd, off, n, prot;
+
+  if (argint(0, &fd) < 0 || argfd(0, &fd) < 0 || argint(1, &off) < 0 ||
+      argint(2, &n) < 0 || argint(3, &prot) < 0)
+    return -1;
+  return filemmap(fd, off, n, prot);
+}
+
+/*
+ * arg0: char * [address returned by mmap]
+ *
+ * Removes the whole mapping that starts at arg0.
+ *
+ * returns 0 on success, -1 on error
+ */
+int sys_munmap(void)
+{
+  int64_t addr;
+
+  if (argint64(0, &addr) < 0 || vspacemunmap(&myproc()->vspace, addr) < 0)
+    return -1;
+  vspaceinstall(myproc());
+  return 0;
+}
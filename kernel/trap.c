@@ -94,6 +94,18 @@ void trap(struct trap_frame *tf) {
       vreg = va2vregion(&myproc()->vspace, addr);
 
       if(vreg != 0){
+        // first touch of a heap or file mapping page
+        int filled = vregionfault(&myproc()->vspace, vreg, addr, 1);
+        if (filled > 0)
+          break;
+        if (filled < 0) {
+          // No memory to fill the page. The kernel fills pages before
+          // it touches them (see argptr), so this faulted in user mode.
+          cprintf("pid %d %s: no memory for page at 0x%x\n",
+                  myproc()->pid, myproc()->name, addr);
+          goto bad;
+        }
+
         vpi = va2vpage_info(vreg, addr);
 
         struct core_map_entry* map = (struct core_map_entry *)pa2page(vpi->ppn<<PT_SHIFT);
@@ -105,9 +117,8 @@ void trap(struct trap_frame *tf) {
           char* new_frame = kalloc();
           if (kmem_3.use_lock)
             acquire(&kmem_3.lock);
-          memset(new_frame, 0, PGSIZE);
           memmove(new_frame, P2V(vpi->ppn << PT_SHIFT), PGSIZE);
-          map->ref--;
+          kfree(P2V(vpi->ppn << PT_SHIFT));
           vpi->used = 1;
           vpi->ppn = PGNUM(V2P(new_frame));
           vpi->present = 1;
@@ -151,8 +162,7 @@ void trap(struct trap_frame *tf) {
       }
     }
 
-    
-
+bad:
     if (myproc() == 0 || (tf->cs & 3) == 0) {
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d rip %lx (cr2=0x%x)\n",
@@ -7,6 +7,10 @@
 #include <x86_64.h>
 #include <x86_64vm.h>
 
+// Heap pages sbrk has granted that no process has touched yet. sbrk
+// only grants more while this stays within free_pages.
+int heap_unfilled;
+
 // given a virtual address and the vregion struct
 // returns the phsical page index
 static int
@@ -66,6 +70,8 @@ vspaceinit(struct vspace *vs)
   vs->regions[VR_CODE].dir   = VRDIR_UP;
   vs->regions[VR_HEAP].dir   = VRDIR_UP;
   vs->regions[VR_USTACK].dir = VRDIR_DOWN;
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[VR_MMAP + NMMAP]; vr++)
+    vr->dir = VRDIR_UP;
 
   return 0;
 }
@@ -89,10 +95,9 @@ vregionaddmap(struct vregion *vr, uint64_t from_va, uint64_t sz, short present,
     if (!(vpi = va2vpage_info(vr, a)))
       goto addmap_failure;
 
-    mem = kalloc();
+    mem = kzalloc();
     if (!mem)
       goto addmap_failure;
-    memset(mem, 0, PGSIZE);
 
     vpi->used = 1;
     vpi->present = present;
@@ -286,8 +291,9 @@ vspaceinvalidate(struct vspace *vs)
 {
   uint i;
   struct vregion *vr;
+  struct vpi_page *page;
   struct vpage_info *vpi;
-  uint64_t start, end;
+  uint64_t idx, npg, va;
 
   // First free the user entries (not the pages they point to)
   for (i = 0; i <= PML4_INDEX(SZ_4G); i++) {
@@ -298,16 +304,25 @@ vspaceinvalidate(struct vspace *vs)
     }
   }
 
-  // Then rebuild the user virtual address space
+  // Then rebuild the user virtual address space. Walk the page infos
+  // a region has rather than looking each page up: heaps and file
+  // mappings may span far more pages than were ever touched.
   for (vr = vs->regions; vr < &vs->regions[NREGIONS]; vr++) {
-    start = VRBOT(vr);
-    end = VRTOP(vr);
-
-    assert(start % PGSIZE == 0);
-
-    for (; start < end; start += PGSIZE) {
-      vpi = va2vpage_info(vr, start);
-      mappages(vs->pgtbl, start >> PT_SHIFT, 1, vpi->ppn, x86perms(vpi), 0);
+    assert(VRBOT(vr) % PGSIZE == 0);
+
+    npg = PGROUNDUP(vr->size) / PGSIZE;
+    idx = 0;
+    for (page = vr->pages; page && idx < npg; page = page->next) {
+      for (i = 0; i < VPIPPAGE && idx < npg; i++, idx++) {
+        vpi = &page->infos[i];
+        if (!vpi->used)
+          continue;
+        if (vr->dir == VRDIR_UP)
+          va = vr->va_base + idx * PGSIZE;
+        else
+          va = vr->va_base - (idx + 1) * PGSIZE;
+        mappages(vs->pgtbl, va >> PT_SHIFT, 1, vpi->ppn, x86perms(vpi), 0);
+      }
     }
   }
 }
@@ -390,14 +405,131 @@ vspacefree(struct vspace *vs)
 {
   struct vregion *vr;
 
+  __sync_fetch_and_sub(&heap_unfilled, vregionunfilled(&vs->regions[VR_HEAP]));
   for (vr = &vs->regions[0]; vr < &vs->regions[NREGIONS]; vr++) {
     free_page_desc_list(vr->pages);
+    if (vr->ip)
+      irelease(vr->ip);
     memset(vr, 0, sizeof(struct vregion));
   }
 
   freevm(vs->pgtbl);
 }
 
+// maps sz bytes of the file ip, starting at file offset off, into a
+// free file mapping region of vs. No pages are read here; each is
+// filled by vregionfault the first time it is touched. A writable
+// mapping is private: writes go to a copy of the page and never
+// reach the file. The region holds its own reference to ip.
+//
+// returns the address of the mapping, or -1 if off is not page
+// aligned, sz is too large, or every file mapping region is in use
+int
+vspacemmap(struct vspace *vs, struct inode *ip, uint off, uint64_t sz, short writable)
+{
+  struct vregion *vr;
+
+  if (off % PGSIZE != 0 || sz == 0 || sz > MMAPMAX)
+    return -1;
+
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[VR_MMAP + NMMAP]; vr++) {
+    if (!vr->ip) {
+      vr->va_base = MMAPBASE + (vr - &vs->regions[VR_MMAP]) * MMAPMAX;
+      vr->size = PGROUNDUP(sz);
+      vr->ip = idup(ip);
+      vr->off = off;
+      vr->writable = writable;
+      return vr->va_base;
+    }
+  }
+  return -1;
+}
+
+// removes the file mapping that starts at va from vs, dropping the
+// pages it has filled. The caller must reinstall vs if it is live.
+//
+// returns 0 on success, -1 if no mapping starts at va
+int
+vspacemunmap(struct vspace *vs, uint64_t va)
+{
+  struct vregion *vr;
+  struct vpi_page *page;
+  int i;
+
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[VR_MMAP + NMMAP]; vr++)
+    if (vr->ip && vr->va_base == va)
+      break;
+  if (vr == &vs->regions[VR_MMAP + NMMAP])
+    return -1;
+
+  for (page = vr->pages; page; page = page->next)
+    for (i = 0; i < VPIPPAGE; i++)
+      if (page->infos[i].used)
+        kfree(P2V(page->infos[i].ppn << PT_SHIFT));
+
+  free_page_desc_list(vr->pages);
+  irelease(vr->ip);
+  memset(vr, 0, sizeof(struct vregion));
+  vr->dir = VRDIR_UP;
+
+  vspaceinvalidate(vs);
+  return 0;
+}
+
+// fills the pages of vr that hold [va, va + sz) and have not been
+// touched yet, and maps them in vs. Only the heap and file mappings
+// are filled on demand; other regions have all their pages mapped up
+// front, so nothing is done for them.
+//
+// A heap page is a fresh page of zeroes. A file mapping page is the
+// page cache's own frame, shared by every process that maps it (see
+// ipagemap), so it is mapped read-only; in a writable mapping it is
+// marked copy-on-write.
+//
+// returns the number of pages filled, or -1 if va is outside vr or
+// memory runs out
+int
+vregionfault(struct vspace *vs, struct vregion *vr, uint64_t va, uint64_t sz)
+{
+  struct vpage_info *vpi;
+  uint64_t a;
+  char *mem;
+  int n;
+
+  if (!vr->ip && vr != &vs->regions[VR_HEAP])
+    return 0;
+  if (va < vr->va_base || va + sz > vr->va_base + vr->size)
+    return -1;
+
+  n = 0;
+  for (a = PGROUNDDOWN(va); a < va + sz; a += PGSIZE) {
+    if (!(vpi = va2vpage_info(vr, a)))
+      return -1;
+    if (vpi->used)
+      continue;
+
+    if (vr->ip) {
+      if (!(mem = ipagemap(vr->ip, (vr->off + a - vr->va_base) / PGSIZE)))
+        return -1;
+      vpi->writable = VPI_READONLY;
+      vpi->copy_on_write = vr->writable;
+    } else {
+      if (!(mem = kzalloc()))
+        return -1;
+      __sync_fetch_and_sub(&heap_unfilled, 1);
+      vpi->writable = VPI_WRITABLE;
+      vpi->copy_on_write = 0;
+    }
+    vpi->used = 1;
+    vpi->present = VPI_PRESENT;
+    vpi->ppn = PGNUM(V2P(mem));
+    // the page was not present, so no stale TLB entry can exist
+    mappages(vs->pgtbl, a >> PT_SHIFT, 1, vpi->ppn, x86perms(vpi), 0);
+    n++;
+  }
+  return n;
+}
+
 // returns the region that a given virtual address exists
 // in for the given vspace. 0 is returned if there is no
 // vregion found
@@ -427,8 +559,7 @@ va2vpage_info(struct vregion *vr, uint64_t va)
   struct vpi_page *info;
 
   if (!vr->pages) {
-    vr->pages = (struct vpi_page *)kalloc();
-    memset(vr->pages, 0, PGSIZE);
+    vr->pages = (struct vpi_page *)kzalloc();
   }
 
   idx = va2vpi_idx(vr, va);
@@ -437,10 +568,9 @@ va2vpage_info(struct vregion *vr, uint64_t va)
   while (idx >= VPIPPAGE) {
     assertm(info, "idx was out of bounds");
     if (!info->next) {
-      info->next = (struct vpi_page *)kalloc();
+      info->next = (struct vpi_page *)kzalloc();
       if (!info->next)
         return 0;
-      memset(info->next, 0, PGSIZE);
     }
     info = info->next;
     idx -= VPIPPAGE;
@@ -461,6 +591,28 @@ vregioncontains(struct vregion *vr, uint64_t va, int size)
 }
 
 
+// returns the number of pages of the heap vr that were never touched
+int
+vregionunfilled(struct vregion *vr)
+{
+  return PGROUNDUP(vr->size) / PGSIZE - vregionused(vr);
+}
+
+// returns the number of pages of vr that are in use
+int
+vregionused(struct vregion *vr)
+{
+  struct vpi_page *page;
+  int i, n;
+
+  n = 0;
+  for (page = vr->pages; page; page = page->next)
+    for (i = 0; i < VPIPPAGE; i++)
+      if (page->infos[i].used)
+        n++;
+  return n;
+}
+
 // Tests if a vspace contains [va, va + size).
 int
 vspacecontains(struct vspace *vs, uint64_t va, int size)
@@ -487,11 +639,9 @@ copy_vpi_page(struct vpi_page **dst, struct vpi_page *src)
     return 0;
   }
 
-  if (!(*dst = (struct vpi_page *)kalloc()))
+  if (!(*dst = (struct vpi_page *)kzalloc()))
     return -1;
 
-  memset(*dst, 0, sizeof(struct vpi_page));
-
   for (i = 0; i < VPIPPAGE; i++) {
     srcvpi = &src->infos[i];
     dstvpi = &(*dst)->infos[i];
@@ -511,11 +661,7 @@ copy_vpi_page(struct vpi_page **dst, struct vpi_page *src)
         srcvpi->copy_on_write = 0;
       }
 
-      struct core_map_entry* frame = (struct core_map_entry *)pa2page(srcvpi->ppn<<PT_SHIFT);
-
-      acquire_map_lock();
-      frame->ref++;
-      release_map_lock();
+      kref(P2V(srcvpi->ppn << PT_SHIFT));
     }
   }
 
@@ -530,9 +676,16 @@ vspacecopy(struct vspace *dst, struct vspace *src)
 
   memmove(dst->regions, src->regions, sizeof(struct vregion) * NREGIONS);
 
-  for (vr = dst->regions; vr < &dst->regions[NREGIONS]; vr++)
+  for (vr = dst->regions; vr < &dst->regions[NREGIONS]; vr++) {
+    if (vr->ip)
+      idup(vr->ip);
     if (copy_vpi_page(&vr->pages, vr->pages) < 0)
       return -1;
+  }
+  // The child gets its own claim on the untouched heap. Nothing
+  // checks it against free_pages, so if memory runs out one of the
+  // two is killed when it touches a page (see trap).
+  __sync_fetch_and_add(&heap_unfilled, vregionunfilled(&dst->regions[VR_HEAP]));
 
   vspaceinvalidate(dst);
   vspaceinvalidate(src);
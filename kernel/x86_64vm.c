@@ -68,9 +68,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pml4e & PTE_P) {
     pdpt = (pdpte_t*)P2V(PDPT_ADDR(*pml4e));
   } else {
-    if(!alloc || (pdpt = (pdpte_t*)kalloc()) == 0)
+    if(!alloc || (pdpt = (pdpte_t*)kzalloc()) == 0)
       return 0;
-    memset(pdpt, 0, PGSIZE);
     *pml4e = V2P(pdpt) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -79,9 +78,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pdpte & PTE_P) {
     pgdir = (pde_t*)P2V(PDE_ADDR(*pdpte));
   } else {
-    if(!alloc || (pgdir = (pde_t*)kalloc()) == 0)
+    if(!alloc || (pgdir = (pde_t*)kzalloc()) == 0)
       return 0;
-    memset(pgdir, 0, PGSIZE);
     *pdpte = V2P(pgdir) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -90,9 +88,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pde & PTE_P) {
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
       return 0;
-    memset(pgtab, 0, PGSIZE);
     *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -136,9 +133,8 @@ setupkvm(void)
   pml4e_t *pml4;
   struct kmap *k;
 
-  if((pml4 = (pml4e_t*)kalloc()) == 0)
+  if((pml4 = (pml4e_t*)kzalloc()) == 0)
     return 0;
-  memset(pml4, 0, PGSIZE);
 
   struct kmap {
     void *virt;
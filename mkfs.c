@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <fcntl.h>
 #include <string.h>
+#include <stdint.h>
 
 typedef unsigned long  ulong;
 typedef unsigned int   uint;
@@ -14,6 +15,7 @@ typedef unsigned char  uchar;
 #include <inc/fs.h>
 #include <inc/stat.h>
 #include <inc/param.h>
+#include <inc/bitmap.h>
 
 #ifndef static_assert
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
@@ -23,10 +25,13 @@ typedef unsigned char  uchar;
 #define CONSOLE 1
 
 // Disk layout:
-// [ boot block | sb block | free bit map | inode file start | data blocks ]
+// [ boot block | sb block | log | free bit map | inode bit map |
+//                                      inode file start | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
+int nbitmap = NBITMAP;
+int nimap = NIMAP;
+int nlog = LOGSIZE;
+int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmaps)
 int nblocks;  // Number of data blocks
 
 int fsfd;
@@ -37,6 +42,7 @@ uint freeblock;
 
 
 void balloc(int);
+void imapwrite(int);
 void wsect(uint, void*);
 void winode(uint, struct dinode*);
 void rinode(uint inum, struct dinode *ip);
@@ -80,6 +86,7 @@ main(int argc, char *argv[])
   char buf[BSIZE];
   struct dinode din;
   struct dinode *root;
+  struct logsuper ls;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -99,19 +106,19 @@ main(int argc, char *argv[])
   }
 
   // 1 fs block = 1 disk sector
-  nmeta = 2 + nbitmap + LOGSIZE + 1;
+  nmeta = 2 + nlog + nbitmap + nimap;
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
   sb.logstart =  xint(2);
-  sb.bmapstart = xint(3 + LOGSIZE);
-  sb.inodestart = xint(3 + nbitmap + LOGSIZE);
-  // sb.bmapstart =  xint(2);
-  // sb.inodestart = xint(2 + nbitmap);
+  sb.nlog = xint(nlog);
+  sb.bmapstart = xint(2 + nlog);
+  sb.imapstart = xint(2 + nlog + nbitmap);
+  sb.inodestart = xint(2 + nlog + nbitmap + nimap);
 
-  printf("nmeta %d (boot, super, bitmap blocks %u) blocks %d total %d\n",
-       nmeta, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u, bitmap blocks %u, inode map blocks %u) blocks %d total %d\n",
+       nmeta, nlog, nbitmap, nimap, nblocks, FSSIZE);
   freeblock = nmeta;     // the first free block that we can allocate
 
   for(i = 0; i < FSSIZE; i++)
@@ -121,6 +128,14 @@ main(int argc, char *argv[])
   memmove(buf, &sb, sizeof(sb));
   wsect(1, buf);
 
+  // empty log; the first transaction goes at the start of the area
+  memset(buf, 0, sizeof(buf));
+  ls.magic = xint(LOGMAGIC);
+  ls.start = xint(0);
+  ls.seq = xint(1);
+  memmove(buf, &ls, sizeof(ls));
+  wsect(xint(sb.logstart), buf);
+
   inum_count = argc + 1; // argc - 2 files + 1 inode file + 1 root dir + console
   printf("inum_count %d\n", inum_count);
 
@@ -226,6 +241,7 @@ main(int argc, char *argv[])
       inum,xint(din.size), xint(din.data[0].startblkno), xint(din.data[0].nblocks));
 
   balloc(freeblock);
+  imapwrite(freeinode);
 
   exit(0);
 }
@@ -301,18 +317,15 @@ ialloc(ushort type)
 void
 balloc(int used)
 {
-  uchar buf[BSIZE];
+  uint64_t buf[BSIZE / sizeof(uint64_t)];
   int nbuf = 0;
-  int i;
   int remaining = used;
 
   printf("balloc: first %d blocks have been allocated\n", used);
 
   while (remaining > 0) {
     bzero(buf, BSIZE);
-    for(i = 0; i < min(remaining, BSIZE*8); i++){
-      buf[i/8] = buf[i/8] | (0x1 << (i%8));
-    }
+    bmap_set(buf, 0, min(remaining, BPB));
     printf("balloc: write bitmap block at sector %d\n", sb.bmapstart + nbuf);
     wsect(sb.bmapstart + nbuf, buf);
     nbuf ++;
@@ -320,6 +333,18 @@ balloc(int used)
   }
 }
 
+// Mark the first used inums allocated in the inode map.
+void
+imapwrite(int used)
+{
+  uint64_t buf[BSIZE / sizeof(uint64_t)];
+
+  assert(used <= BPB);
+  bzero(buf, BSIZE);
+  bmap_set(buf, 0, used);
+  wsect(sb.imapstart, buf);
+}
+
 void
 iallocblocks(uint inum, int start, int numblks) {
   struct dinode din;
@@ -0,0 +1,231 @@
+
+out/bootblock.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+    7c00:	fa                   	cli
+    7c01:	31 c0                	xor    %eax,%eax
+    7c03:	8e d8                	mov    %eax,%ds
+    7c05:	8e c0                	mov    %eax,%es
+    7c07:	8e d0                	mov    %eax,%ss
+
+00007c09 <seta20.1>:
+    7c09:	e4 64                	in     $0x64,%al
+    7c0b:	a8 02                	test   $0x2,%al
+    7c0d:	75 fa                	jne    7c09 <seta20.1>
+    7c0f:	b0 d1                	mov    $0xd1,%al
+    7c11:	e6 64                	out    %al,$0x64
+
+00007c13 <seta20.2>:
+    7c13:	e4 64                	in     $0x64,%al
+    7c15:	a8 02                	test   $0x2,%al
+    7c17:	75 fa                	jne    7c13 <seta20.2>
+    7c19:	b0 df                	mov    $0xdf,%al
+    7c1b:	e6 60                	out    %al,$0x60
+
+00007c1d <e820_start>:
+    7c1d:	66 31 db             	xor    %bx,%bx
+    7c20:	bf                   	.byte 0xbf
+    7c21:	00                   	.byte 0x0
+    7c22:	90                   	nop
+
+00007c23 <e820_loop>:
+    7c23:	66 c7 05 14 00 00 00 	movw   $0xc783,0x14
+    7c2a:	83 c7 
+    7c2c:	04 66                	add    $0x66,%al
+    7c2e:	ba 50 41 4d 53       	mov    $0x534d4150,%edx
+    7c33:	66 b8 20 e8          	mov    $0xe820,%ax
+    7c37:	00 00                	add    %al,(%eax)
+    7c39:	b9 14 00 cd 15       	mov    $0x15cd0014,%ecx
+    7c3e:	72 0d                	jb     7c4d <e820_end>
+    7c40:	83 f9 14             	cmp    $0x14,%ecx
+    7c43:	7f 03                	jg     7c48 <e820_skip>
+
+00007c45 <e820_next>:
+    7c45:	83 c7 14             	add    $0x14,%edi
+
+00007c48 <e820_skip>:
+    7c48:	66 85 db             	test   %bx,%bx
+    7c4b:	75 d6                	jne    7c23 <e820_loop>
+
+00007c4d <e820_end>:
+    7c4d:	66 89 3e             	mov    %di,(%esi)
+    7c50:	54                   	push   %esp
+    7c51:	7e 0f                	jle    7c62 <e820_end+0x15>
+    7c53:	01 16                	add    %edx,(%esi)
+    7c55:	ac                   	lods   %ds:(%esi),%al
+    7c56:	7c 0f                	jl     7c67 <start32+0x1>
+    7c58:	20 c0                	and    %al,%al
+    7c5a:	66 83 c8 01          	or     $0x1,%ax
+    7c5e:	0f 22 c0             	mov    %eax,%cr0
+    7c61:	ea                   	.byte 0xea
+    7c62:	66 7c 08             	data16 jl 7c6d <start32+0x7>
+	...
+
+00007c66 <start32>:
+    7c66:	66 b8 10 00          	mov    $0x10,%ax
+    7c6a:	8e d8                	mov    %eax,%ds
+    7c6c:	8e c0                	mov    %eax,%es
+    7c6e:	8e d0                	mov    %eax,%ss
+    7c70:	66 b8 00 00          	mov    $0x0,%ax
+    7c74:	8e e0                	mov    %eax,%fs
+    7c76:	8e e8                	mov    %eax,%gs
+    7c78:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+    7c7d:	e8 9f 00 00 00       	call   7d21 <bootmain>
+    7c82:	66 b8 00 8a          	mov    $0x8a00,%ax
+    7c86:	66 89 c2             	mov    %ax,%dx
+    7c89:	66 ef                	out    %ax,(%dx)
+    7c8b:	66 b8 e0 8a          	mov    $0x8ae0,%ax
+    7c8f:	66 ef                	out    %ax,(%dx)
+
+00007c91 <spin>:
+    7c91:	eb fe                	jmp    7c91 <spin>
+    7c93:	90                   	nop
+
+00007c94 <gdt>:
+	...
+    7c9c:	ff                   	(bad)
+    7c9d:	ff 00                	incl   (%eax)
+    7c9f:	00 00                	add    %al,(%eax)
+    7ca1:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7ca8:	00                   	.byte 0x0
+    7ca9:	92                   	xchg   %eax,%edx
+    7caa:	cf                   	iret
+	...
+
+00007cac <gdtdesc>:
+    7cac:	17                   	pop    %ss
+    7cad:	00                   	.byte 0x0
+    7cae:	94                   	xchg   %eax,%esp
+    7caf:	7c 00                	jl     7cb1 <gdtdesc+0x5>
+	...
+
+00007cb2 <readsect>:
+    7cb2:	55                   	push   %ebp
+    7cb3:	89 e5                	mov    %esp,%ebp
+    7cb5:	57                   	push   %edi
+    7cb6:	bf f7 01 00 00       	mov    $0x1f7,%edi
+    7cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    7cbe:	89 fa                	mov    %edi,%edx
+    7cc0:	ec                   	in     (%dx),%al
+    7cc1:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cc4:	3c 40                	cmp    $0x40,%al
+    7cc6:	75 f6                	jne    7cbe <readsect+0xc>
+    7cc8:	b0 01                	mov    $0x1,%al
+    7cca:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7ccf:	ee                   	out    %al,(%dx)
+    7cd0:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cd5:	89 c8                	mov    %ecx,%eax
+    7cd7:	ee                   	out    %al,(%dx)
+    7cd8:	89 c8                	mov    %ecx,%eax
+    7cda:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cdf:	c1 e8 08             	shr    $0x8,%eax
+    7ce2:	ee                   	out    %al,(%dx)
+    7ce3:	89 c8                	mov    %ecx,%eax
+    7ce5:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cea:	c1 e8 10             	shr    $0x10,%eax
+    7ced:	ee                   	out    %al,(%dx)
+    7cee:	89 c8                	mov    %ecx,%eax
+    7cf0:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cf5:	c1 e8 18             	shr    $0x18,%eax
+    7cf8:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cfb:	ee                   	out    %al,(%dx)
+    7cfc:	b0 20                	mov    $0x20,%al
+    7cfe:	89 fa                	mov    %edi,%edx
+    7d00:	ee                   	out    %al,(%dx)
+    7d01:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d06:	ec                   	in     (%dx),%al
+    7d07:	83 e0 c0             	and    $0xffffffc0,%eax
+    7d0a:	3c 40                	cmp    $0x40,%al
+    7d0c:	75 f8                	jne    7d06 <readsect+0x54>
+    7d0e:	8b 7d 08             	mov    0x8(%ebp),%edi
+    7d11:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d16:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d1b:	fc                   	cld
+    7d1c:	f3 6d                	rep insl (%dx),%es:(%edi)
+    7d1e:	5f                   	pop    %edi
+    7d1f:	5d                   	pop    %ebp
+    7d20:	c3                   	ret
+
+00007d21 <bootmain>:
+    7d21:	55                   	push   %ebp
+    7d22:	89 e5                	mov    %esp,%ebp
+    7d24:	57                   	push   %edi
+    7d25:	56                   	push   %esi
+    7d26:	53                   	push   %ebx
+    7d27:	bb 01 00 00 00       	mov    $0x1,%ebx
+    7d2c:	83 ec 1c             	sub    $0x1c,%esp
+    7d2f:	89 d8                	mov    %ebx,%eax
+    7d31:	52                   	push   %edx
+    7d32:	c1 e0 09             	shl    $0x9,%eax
+    7d35:	52                   	push   %edx
+    7d36:	05 00 fe 00 00       	add    $0xfe00,%eax
+    7d3b:	53                   	push   %ebx
+    7d3c:	43                   	inc    %ebx
+    7d3d:	50                   	push   %eax
+    7d3e:	e8 6f ff ff ff       	call   7cb2 <readsect>
+    7d43:	83 c4 10             	add    $0x10,%esp
+    7d46:	83 fb 11             	cmp    $0x11,%ebx
+    7d49:	75 e4                	jne    7d2f <bootmain+0xe>
+    7d4b:	31 c0                	xor    %eax,%eax
+    7d4d:	81 b8 00 00 01 00 02 	cmpl   $0x1badb002,0x10000(%eax)
+    7d54:	b0 ad 1b 
+    7d57:	8d b0 00 00 01 00    	lea    0x10000(%eax),%esi
+    7d5d:	75 4d                	jne    7dac <bootmain+0x8b>
+    7d5f:	8b 7e 10             	mov    0x10(%esi),%edi
+    7d62:	8b 56 14             	mov    0x14(%esi),%edx
+    7d65:	01 f8                	add    %edi,%eax
+    7d67:	2b 46 0c             	sub    0xc(%esi),%eax
+    7d6a:	89 c1                	mov    %eax,%ecx
+    7d6c:	c1 e8 09             	shr    $0x9,%eax
+    7d6f:	81 e1 ff 01 00 00    	and    $0x1ff,%ecx
+    7d75:	8d 58 01             	lea    0x1(%eax),%ebx
+    7d78:	29 cf                	sub    %ecx,%edi
+    7d7a:	39 d7                	cmp    %edx,%edi
+    7d7c:	73 1b                	jae    7d99 <bootmain+0x78>
+    7d7e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    7d81:	50                   	push   %eax
+    7d82:	50                   	push   %eax
+    7d83:	53                   	push   %ebx
+    7d84:	43                   	inc    %ebx
+    7d85:	57                   	push   %edi
+    7d86:	81 c7 00 02 00 00    	add    $0x200,%edi
+    7d8c:	e8 21 ff ff ff       	call   7cb2 <readsect>
+    7d91:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    7d94:	83 c4 10             	add    $0x10,%esp
+    7d97:	eb e1                	jmp    7d7a <bootmain+0x59>
+    7d99:	8b 4e 18             	mov    0x18(%esi),%ecx
+    7d9c:	8b 7e 14             	mov    0x14(%esi),%edi
+    7d9f:	39 cf                	cmp    %ecx,%edi
+    7da1:	73 15                	jae    7db8 <bootmain+0x97>
+    7da3:	29 f9                	sub    %edi,%ecx
+    7da5:	31 c0                	xor    %eax,%eax
+    7da7:	fc                   	cld
+    7da8:	f3 aa                	rep stos %al,%es:(%edi)
+    7daa:	eb 0c                	jmp    7db8 <bootmain+0x97>
+    7dac:	83 c0 04             	add    $0x4,%eax
+    7daf:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    7db4:	75 97                	jne    7d4d <bootmain+0x2c>
+    7db6:	eb 2b                	jmp    7de3 <bootmain+0xc2>
+    7db8:	8b 15 54 7e 00 00    	mov    0x7e54,%edx
+    7dbe:	8b 76 1c             	mov    0x1c(%esi),%esi
+    7dc1:	89 d0                	mov    %edx,%eax
+    7dc3:	89 d1                	mov    %edx,%ecx
+    7dc5:	c7 02 40 00 00 00    	movl   $0x40,(%edx)
+    7dcb:	25 ff 0f 00 00       	and    $0xfff,%eax
+    7dd0:	29 c1                	sub    %eax,%ecx
+    7dd2:	89 42 2c             	mov    %eax,0x2c(%edx)
+    7dd5:	89 4a 30             	mov    %ecx,0x30(%edx)
+    7dd8:	b9 02 b0 ad 2b       	mov    $0x2badb002,%ecx
+    7ddd:	89 c8                	mov    %ecx,%eax
+    7ddf:	89 d3                	mov    %edx,%ebx
+    7de1:	56                   	push   %esi
+    7de2:	c3                   	ret
+    7de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7de6:	5b                   	pop    %ebx
+    7de7:	5e                   	pop    %esi
+    7de8:	5f                   	pop    %edi
+    7de9:	5d                   	pop    %ebp
+    7dea:	c3                   	ret
@@ -0,0 +1,1299 @@
+
+out/user/_echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  for (i = 1; i < argc; i++)
+   f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  16:	eb 53                	jmp    6b <main+0x6b>
+    printf(1, "%s%s", argv[i], i + 1 < argc ? " " : "\n");
+  18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  1b:	83 c0 01             	add    $0x1,%eax
+  1e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  21:	7e 09                	jle    2c <main+0x2c>
+  23:	48 8d 05 20 0b 00 00 	lea    0xb20(%rip),%rax        # b4a <malloc+0x115>
+  2a:	eb 07                	jmp    33 <main+0x33>
+  2c:	48 8d 05 19 0b 00 00 	lea    0xb19(%rip),%rax        # b4c <malloc+0x117>
+  33:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  36:	48 63 d2             	movslq %edx,%rdx
+  39:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+  40:	00 
+  41:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  45:	48 01 ca             	add    %rcx,%rdx
+  48:	48 8b 12             	mov    (%rdx),%rdx
+  4b:	48 89 c1             	mov    %rax,%rcx
+  4e:	48 8d 05 f9 0a 00 00 	lea    0xaf9(%rip),%rax        # b4e <malloc+0x119>
+  55:	48 89 c6             	mov    %rax,%rsi
+  58:	bf 01 00 00 00       	mov    $0x1,%edi
+  5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  62:	e8 d3 01 00 00       	call   23a <printf>
+  for (i = 1; i < argc; i++)
+  67:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  6e:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  71:	7c a5                	jl     18 <main+0x18>
+  exit();
+  73:	e8 69 07 00 00       	call   7e1 <exit>
+
+0000000000000078 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+  78:	55                   	push   %rbp
+  79:	48 89 e5             	mov    %rsp,%rbp
+  7c:	48 83 ec 10          	sub    $0x10,%rsp
+  80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  83:	89 f0                	mov    %esi,%eax
+  85:	88 45 f8             	mov    %al,-0x8(%rbp)
+  88:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8f:	ba 01 00 00 00       	mov    $0x1,%edx
+  94:	48 89 ce             	mov    %rcx,%rsi
+  97:	89 c7                	mov    %eax,%edi
+  99:	e8 63 07 00 00       	call   801 <write>
+  9e:	90                   	nop
+  9f:	c9                   	leave
+  a0:	c3                   	ret
+
+00000000000000a1 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+  a1:	55                   	push   %rbp
+  a2:	48 89 e5             	mov    %rsp,%rbp
+  a5:	48 83 ec 40          	sub    $0x40,%rsp
+  a9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  ac:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  af:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  b2:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+  b5:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  b9:	74 1f                	je     da <printint64+0x39>
+  bb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  be:	c1 e8 1f             	shr    $0x1f,%eax
+  c1:	0f b6 c0             	movzbl %al,%eax
+  c4:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  c7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  cb:	74 0d                	je     da <printint64+0x39>
+    x = -xx;
+  cd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  d0:	f7 d8                	neg    %eax
+  d2:	48 98                	cltq
+  d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  d8:	eb 09                	jmp    e3 <printint64+0x42>
+  else
+    x = xx;
+  da:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  dd:	48 98                	cltq
+  df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+  e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+  ea:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  ed:	48 63 c8             	movslq %eax,%rcx
+  f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  f9:	48 f7 f1             	div    %rcx
+  fc:	48 89 d1             	mov    %rdx,%rcx
+  ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 102:	8d 50 01             	lea    0x1(%rax),%edx
+ 105:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 108:	48 8d 15 b1 0c 00 00 	lea    0xcb1(%rip),%rdx        # dc0 <digits.1>
+ 10f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 113:	48 98                	cltq
+ 115:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 119:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 11c:	48 63 f0             	movslq %eax,%rsi
+ 11f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 123:	ba 00 00 00 00       	mov    $0x0,%edx
+ 128:	48 f7 f6             	div    %rsi
+ 12b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 12f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 134:	75 b4                	jne    ea <printint64+0x49>
+
+  if (sgn)
+ 136:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 13a:	74 2b                	je     167 <printint64+0xc6>
+    buf[i++] = '-';
+ 13c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 13f:	8d 50 01             	lea    0x1(%rax),%edx
+ 142:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 145:	48 98                	cltq
+ 147:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 14c:	eb 19                	jmp    167 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 14e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 151:	48 98                	cltq
+ 153:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 158:	0f be d0             	movsbl %al,%edx
+ 15b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 15e:	89 d6                	mov    %edx,%esi
+ 160:	89 c7                	mov    %eax,%edi
+ 162:	e8 11 ff ff ff       	call   78 <putc>
+  while (--i >= 0)
+ 167:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 16b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 16f:	79 dd                	jns    14e <printint64+0xad>
+}
+ 171:	90                   	nop
+ 172:	90                   	nop
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+
+0000000000000175 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 175:	55                   	push   %rbp
+ 176:	48 89 e5             	mov    %rsp,%rbp
+ 179:	48 83 ec 30          	sub    $0x30,%rsp
+ 17d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 180:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 183:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 186:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 189:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 190:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 194:	74 17                	je     1ad <printint+0x38>
+ 196:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 19a:	79 11                	jns    1ad <printint+0x38>
+    neg = 1;
+ 19c:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1a3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1a6:	f7 d8                	neg    %eax
+ 1a8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1ab:	eb 06                	jmp    1b3 <printint+0x3e>
+  } else {
+    x = xx;
+ 1ad:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1b0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1ba:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1c5:	f7 f1                	div    %ecx
+ 1c7:	89 d1                	mov    %edx,%ecx
+ 1c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1cc:	8d 50 01             	lea    0x1(%rax),%edx
+ 1cf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1d2:	89 c9                	mov    %ecx,%ecx
+ 1d4:	48 8d 15 05 0c 00 00 	lea    0xc05(%rip),%rdx        # de0 <digits.0>
+ 1db:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1df:	48 98                	cltq
+ 1e1:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 1e5:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 1e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1eb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1f0:	f7 f6                	div    %esi
+ 1f2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 1f9:	75 bf                	jne    1ba <printint+0x45>
+  if (neg)
+ 1fb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 1ff:	74 2b                	je     22c <printint+0xb7>
+    buf[i++] = '-';
+ 201:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 204:	8d 50 01             	lea    0x1(%rax),%edx
+ 207:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 20a:	48 98                	cltq
+ 20c:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 211:	eb 19                	jmp    22c <printint+0xb7>
+    putc(fd, buf[i]);
+ 213:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 216:	48 98                	cltq
+ 218:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 21d:	0f be d0             	movsbl %al,%edx
+ 220:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 223:	89 d6                	mov    %edx,%esi
+ 225:	89 c7                	mov    %eax,%edi
+ 227:	e8 4c fe ff ff       	call   78 <putc>
+  while (--i >= 0)
+ 22c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 230:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 234:	79 dd                	jns    213 <printint+0x9e>
+}
+ 236:	90                   	nop
+ 237:	90                   	nop
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+
+000000000000023a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 23a:	55                   	push   %rbp
+ 23b:	48 89 e5             	mov    %rsp,%rbp
+ 23e:	48 83 ec 70          	sub    $0x70,%rsp
+ 242:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 245:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 249:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 24d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 251:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 255:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 259:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 260:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 264:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 268:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 26c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 270:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 277:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 27e:	e9 6b 02 00 00       	jmp    4ee <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 283:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 286:	48 63 d0             	movslq %eax,%rdx
+ 289:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 28d:	48 01 d0             	add    %rdx,%rax
+ 290:	0f b6 00             	movzbl (%rax),%eax
+ 293:	0f be c0             	movsbl %al,%eax
+ 296:	25 ff 00 00 00       	and    $0xff,%eax
+ 29b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 29e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2a2:	75 30                	jne    2d4 <printf+0x9a>
+      if (c == '%') {
+ 2a4:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2a8:	75 13                	jne    2bd <printf+0x83>
+        state = '%';
+ 2aa:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2b1:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2b8:	e9 2d 02 00 00       	jmp    4ea <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2c0:	0f be d0             	movsbl %al,%edx
+ 2c3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2c6:	89 d6                	mov    %edx,%esi
+ 2c8:	89 c7                	mov    %eax,%edi
+ 2ca:	e8 a9 fd ff ff       	call   78 <putc>
+ 2cf:	e9 16 02 00 00       	jmp    4ea <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 2d4:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 2d8:	0f 85 0c 02 00 00    	jne    4ea <printf+0x2b0>
+      if (c == 'l') {
+ 2de:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 2e2:	75 0c                	jne    2f0 <printf+0xb6>
+        lflag = 1;
+ 2e4:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 2eb:	e9 fa 01 00 00       	jmp    4ea <printf+0x2b0>
+      } else if (c == 'd') {
+ 2f0:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 2f4:	0f 85 95 00 00 00    	jne    38f <printf+0x155>
+        if (lflag == 1)
+ 2fa:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 2fe:	75 49                	jne    349 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 300:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 303:	83 f8 2f             	cmp    $0x2f,%eax
+ 306:	77 17                	ja     31f <printf+0xe5>
+ 308:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 30c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 30f:	89 d2                	mov    %edx,%edx
+ 311:	48 01 d0             	add    %rdx,%rax
+ 314:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 317:	83 c2 08             	add    $0x8,%edx
+ 31a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 31d:	eb 0c                	jmp    32b <printf+0xf1>
+ 31f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 323:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 327:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 32b:	48 8b 00             	mov    (%rax),%rax
+ 32e:	89 c6                	mov    %eax,%esi
+ 330:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 333:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 338:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 33d:	89 c7                	mov    %eax,%edi
+ 33f:	e8 5d fd ff ff       	call   a1 <printint64>
+ 344:	e9 9a 01 00 00       	jmp    4e3 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 349:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 34c:	83 f8 2f             	cmp    $0x2f,%eax
+ 34f:	77 17                	ja     368 <printf+0x12e>
+ 351:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 355:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 358:	89 d2                	mov    %edx,%edx
+ 35a:	48 01 d0             	add    %rdx,%rax
+ 35d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 360:	83 c2 08             	add    $0x8,%edx
+ 363:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 366:	eb 0c                	jmp    374 <printf+0x13a>
+ 368:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 36c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 370:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 374:	8b 30                	mov    (%rax),%esi
+ 376:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 379:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 37e:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 383:	89 c7                	mov    %eax,%edi
+ 385:	e8 eb fd ff ff       	call   175 <printint>
+ 38a:	e9 54 01 00 00       	jmp    4e3 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 38f:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 393:	74 0a                	je     39f <printf+0x165>
+ 395:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 399:	0f 85 95 00 00 00    	jne    434 <printf+0x1fa>
+        if (lflag == 1)
+ 39f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3a3:	75 49                	jne    3ee <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3a5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3a8:	83 f8 2f             	cmp    $0x2f,%eax
+ 3ab:	77 17                	ja     3c4 <printf+0x18a>
+ 3ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3b4:	89 d2                	mov    %edx,%edx
+ 3b6:	48 01 d0             	add    %rdx,%rax
+ 3b9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3bc:	83 c2 08             	add    $0x8,%edx
+ 3bf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3c2:	eb 0c                	jmp    3d0 <printf+0x196>
+ 3c4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3c8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3d0:	48 8b 00             	mov    (%rax),%rax
+ 3d3:	89 c6                	mov    %eax,%esi
+ 3d5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 3dd:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3e2:	89 c7                	mov    %eax,%edi
+ 3e4:	e8 b8 fc ff ff       	call   a1 <printint64>
+        if (lflag == 1)
+ 3e9:	e9 f5 00 00 00       	jmp    4e3 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 3ee:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3f1:	83 f8 2f             	cmp    $0x2f,%eax
+ 3f4:	77 17                	ja     40d <printf+0x1d3>
+ 3f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3fd:	89 d2                	mov    %edx,%edx
+ 3ff:	48 01 d0             	add    %rdx,%rax
+ 402:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 405:	83 c2 08             	add    $0x8,%edx
+ 408:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 40b:	eb 0c                	jmp    419 <printf+0x1df>
+ 40d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 411:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 415:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 419:	8b 30                	mov    (%rax),%esi
+ 41b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 41e:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 423:	ba 10 00 00 00       	mov    $0x10,%edx
+ 428:	89 c7                	mov    %eax,%edi
+ 42a:	e8 46 fd ff ff       	call   175 <printint>
+        if (lflag == 1)
+ 42f:	e9 af 00 00 00       	jmp    4e3 <printf+0x2a9>
+      } else if (c == 's') {
+ 434:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 438:	75 6e                	jne    4a8 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 43a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 43d:	83 f8 2f             	cmp    $0x2f,%eax
+ 440:	77 17                	ja     459 <printf+0x21f>
+ 442:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 446:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 449:	89 d2                	mov    %edx,%edx
+ 44b:	48 01 d0             	add    %rdx,%rax
+ 44e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 451:	83 c2 08             	add    $0x8,%edx
+ 454:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 457:	eb 0c                	jmp    465 <printf+0x22b>
+ 459:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 45d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 461:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 465:	48 8b 00             	mov    (%rax),%rax
+ 468:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 46c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 471:	75 28                	jne    49b <printf+0x261>
+          s = "(null)";
+ 473:	48 8d 05 d9 06 00 00 	lea    0x6d9(%rip),%rax        # b53 <malloc+0x11e>
+ 47a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 47e:	eb 1b                	jmp    49b <printf+0x261>
+          putc(fd, *s);
+ 480:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 484:	0f b6 00             	movzbl (%rax),%eax
+ 487:	0f be d0             	movsbl %al,%edx
+ 48a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 48d:	89 d6                	mov    %edx,%esi
+ 48f:	89 c7                	mov    %eax,%edi
+ 491:	e8 e2 fb ff ff       	call   78 <putc>
+        for (; *s; s++)
+ 496:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 49b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 49f:	0f b6 00             	movzbl (%rax),%eax
+ 4a2:	84 c0                	test   %al,%al
+ 4a4:	75 da                	jne    480 <printf+0x246>
+ 4a6:	eb 3b                	jmp    4e3 <printf+0x2a9>
+      } else if (c == '%') {
+ 4a8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4ac:	75 14                	jne    4c2 <printf+0x288>
+        putc(fd, c);
+ 4ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4b1:	0f be d0             	movsbl %al,%edx
+ 4b4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4b7:	89 d6                	mov    %edx,%esi
+ 4b9:	89 c7                	mov    %eax,%edi
+ 4bb:	e8 b8 fb ff ff       	call   78 <putc>
+ 4c0:	eb 21                	jmp    4e3 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4c2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4c5:	be 25 00 00 00       	mov    $0x25,%esi
+ 4ca:	89 c7                	mov    %eax,%edi
+ 4cc:	e8 a7 fb ff ff       	call   78 <putc>
+        putc(fd, c);
+ 4d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4d4:	0f be d0             	movsbl %al,%edx
+ 4d7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4da:	89 d6                	mov    %edx,%esi
+ 4dc:	89 c7                	mov    %eax,%edi
+ 4de:	e8 95 fb ff ff       	call   78 <putc>
+      }
+      state = 0;
+ 4e3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 4ea:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 4ee:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 4f1:	48 63 d0             	movslq %eax,%rdx
+ 4f4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 4f8:	48 01 d0             	add    %rdx,%rax
+ 4fb:	0f b6 00             	movzbl (%rax),%eax
+ 4fe:	84 c0                	test   %al,%al
+ 500:	0f 85 7d fd ff ff    	jne    283 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 506:	90                   	nop
+ 507:	90                   	nop
+ 508:	c9                   	leave
+ 509:	c3                   	ret
+
+000000000000050a <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+ 50a:	55                   	push   %rbp
+ 50b:	48 89 e5             	mov    %rsp,%rbp
+ 50e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 512:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 515:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+ 518:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 51c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 51f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 522:	48 89 ce             	mov    %rcx,%rsi
+ 525:	48 89 f7             	mov    %rsi,%rdi
+ 528:	89 d1                	mov    %edx,%ecx
+ 52a:	fc                   	cld
+ 52b:	f3 aa                	rep stos %al,%es:(%rdi)
+ 52d:	89 ca                	mov    %ecx,%edx
+ 52f:	48 89 fe             	mov    %rdi,%rsi
+ 532:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 536:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+ 539:	90                   	nop
+ 53a:	5d                   	pop    %rbp
+ 53b:	c3                   	ret
+
+000000000000053c <strcpy>:
+char *strcpy(char *s, char *t) {
+ 53c:	55                   	push   %rbp
+ 53d:	48 89 e5             	mov    %rsp,%rbp
+ 540:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 544:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 548:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 54c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 550:	90                   	nop
+ 551:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 555:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 559:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 55d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 561:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 565:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 569:	0f b6 12             	movzbl (%rdx),%edx
+ 56c:	88 10                	mov    %dl,(%rax)
+ 56e:	0f b6 00             	movzbl (%rax),%eax
+ 571:	84 c0                	test   %al,%al
+ 573:	75 dc                	jne    551 <strcpy+0x15>
+  return os;
+ 575:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 579:	5d                   	pop    %rbp
+ 57a:	c3                   	ret
+
+000000000000057b <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 57b:	55                   	push   %rbp
+ 57c:	48 89 e5             	mov    %rsp,%rbp
+ 57f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 583:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 587:	eb 0a                	jmp    593 <strcmp+0x18>
+    p++, q++;
+ 589:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 58e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 597:	0f b6 00             	movzbl (%rax),%eax
+ 59a:	84 c0                	test   %al,%al
+ 59c:	74 12                	je     5b0 <strcmp+0x35>
+ 59e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5a2:	0f b6 10             	movzbl (%rax),%edx
+ 5a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5a9:	0f b6 00             	movzbl (%rax),%eax
+ 5ac:	38 c2                	cmp    %al,%dl
+ 5ae:	74 d9                	je     589 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5b4:	0f b6 00             	movzbl (%rax),%eax
+ 5b7:	0f b6 d0             	movzbl %al,%edx
+ 5ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5be:	0f b6 00             	movzbl (%rax),%eax
+ 5c1:	0f b6 c0             	movzbl %al,%eax
+ 5c4:	29 c2                	sub    %eax,%edx
+ 5c6:	89 d0                	mov    %edx,%eax
+}
+ 5c8:	5d                   	pop    %rbp
+ 5c9:	c3                   	ret
+
+00000000000005ca <strlen>:
+uint strlen(char *s) {
+ 5ca:	55                   	push   %rbp
+ 5cb:	48 89 e5             	mov    %rsp,%rbp
+ 5ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 5d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 5d9:	eb 04                	jmp    5df <strlen+0x15>
+ 5db:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 5df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 5e2:	48 63 d0             	movslq %eax,%rdx
+ 5e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 5e9:	48 01 d0             	add    %rdx,%rax
+ 5ec:	0f b6 00             	movzbl (%rax),%eax
+ 5ef:	84 c0                	test   %al,%al
+ 5f1:	75 e8                	jne    5db <strlen+0x11>
+  return n;
+ 5f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 5f6:	5d                   	pop    %rbp
+ 5f7:	c3                   	ret
+
+00000000000005f8 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 5f8:	55                   	push   %rbp
+ 5f9:	48 89 e5             	mov    %rsp,%rbp
+ 5fc:	48 83 ec 10          	sub    $0x10,%rsp
+ 600:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 604:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 607:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 60a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 60d:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 614:	89 ce                	mov    %ecx,%esi
+ 616:	48 89 c7             	mov    %rax,%rdi
+ 619:	e8 ec fe ff ff       	call   50a <stosb>
+  return dst;
+ 61e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 622:	c9                   	leave
+ 623:	c3                   	ret
+
+0000000000000624 <strchr>:
+char *strchr(const char *s, char c) {
+ 624:	55                   	push   %rbp
+ 625:	48 89 e5             	mov    %rsp,%rbp
+ 628:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 62c:	89 f0                	mov    %esi,%eax
+ 62e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 631:	eb 17                	jmp    64a <strchr+0x26>
+    if (*s == c)
+ 633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 637:	0f b6 00             	movzbl (%rax),%eax
+ 63a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 63d:	75 06                	jne    645 <strchr+0x21>
+      return (char *)s;
+ 63f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 643:	eb 15                	jmp    65a <strchr+0x36>
+  for (; *s; s++)
+ 645:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 64a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 64e:	0f b6 00             	movzbl (%rax),%eax
+ 651:	84 c0                	test   %al,%al
+ 653:	75 de                	jne    633 <strchr+0xf>
+  return 0;
+ 655:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 65a:	5d                   	pop    %rbp
+ 65b:	c3                   	ret
+
+000000000000065c <gets>:
+char *gets(char *buf, int max) {
+ 65c:	55                   	push   %rbp
+ 65d:	48 89 e5             	mov    %rsp,%rbp
+ 660:	48 83 ec 20          	sub    $0x20,%rsp
+ 664:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 668:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 66b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 672:	eb 48                	jmp    6bc <gets+0x60>
+    cc = read(0, &c, 1);
+ 674:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 678:	ba 01 00 00 00       	mov    $0x1,%edx
+ 67d:	48 89 c6             	mov    %rax,%rsi
+ 680:	bf 00 00 00 00       	mov    $0x0,%edi
+ 685:	e8 6f 01 00 00       	call   7f9 <read>
+ 68a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 68d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 691:	7e 36                	jle    6c9 <gets+0x6d>
+    buf[i++] = c;
+ 693:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 696:	8d 50 01             	lea    0x1(%rax),%edx
+ 699:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 69c:	48 63 d0             	movslq %eax,%rdx
+ 69f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6a3:	48 01 c2             	add    %rax,%rdx
+ 6a6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6aa:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 6ac:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6b0:	3c 0a                	cmp    $0xa,%al
+ 6b2:	74 16                	je     6ca <gets+0x6e>
+ 6b4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6b8:	3c 0d                	cmp    $0xd,%al
+ 6ba:	74 0e                	je     6ca <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 6bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6bf:	83 c0 01             	add    $0x1,%eax
+ 6c2:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6c5:	7f ad                	jg     674 <gets+0x18>
+ 6c7:	eb 01                	jmp    6ca <gets+0x6e>
+      break;
+ 6c9:	90                   	nop
+  }
+  buf[i] = '\0';
+ 6ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6cd:	48 63 d0             	movslq %eax,%rdx
+ 6d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d4:	48 01 d0             	add    %rdx,%rax
+ 6d7:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 6da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 6de:	c9                   	leave
+ 6df:	c3                   	ret
+
+00000000000006e0 <stat>:
+
+int stat(char *n, struct stat *st) {
+ 6e0:	55                   	push   %rbp
+ 6e1:	48 89 e5             	mov    %rsp,%rbp
+ 6e4:	48 83 ec 20          	sub    $0x20,%rsp
+ 6e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 6ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6f4:	be 00 00 00 00       	mov    $0x0,%esi
+ 6f9:	48 89 c7             	mov    %rax,%rdi
+ 6fc:	e8 20 01 00 00       	call   821 <open>
+ 701:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 704:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 708:	79 07                	jns    711 <stat+0x31>
+    return -1;
+ 70a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 70f:	eb 21                	jmp    732 <stat+0x52>
+  r = fstat(fd, st);
+ 711:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 715:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 718:	48 89 d6             	mov    %rdx,%rsi
+ 71b:	89 c7                	mov    %eax,%edi
+ 71d:	e8 17 01 00 00       	call   839 <fstat>
+ 722:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 725:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 728:	89 c7                	mov    %eax,%edi
+ 72a:	e8 da 00 00 00       	call   809 <close>
+  return r;
+ 72f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 732:	c9                   	leave
+ 733:	c3                   	ret
+
+0000000000000734 <atoi>:
+
+int atoi(const char *s) {
+ 734:	55                   	push   %rbp
+ 735:	48 89 e5             	mov    %rsp,%rbp
+ 738:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 73c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 743:	eb 28                	jmp    76d <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 745:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 748:	89 d0                	mov    %edx,%eax
+ 74a:	c1 e0 02             	shl    $0x2,%eax
+ 74d:	01 d0                	add    %edx,%eax
+ 74f:	01 c0                	add    %eax,%eax
+ 751:	89 c1                	mov    %eax,%ecx
+ 753:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 757:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 75b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 75f:	0f b6 00             	movzbl (%rax),%eax
+ 762:	0f be c0             	movsbl %al,%eax
+ 765:	01 c8                	add    %ecx,%eax
+ 767:	83 e8 30             	sub    $0x30,%eax
+ 76a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 76d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 771:	0f b6 00             	movzbl (%rax),%eax
+ 774:	3c 2f                	cmp    $0x2f,%al
+ 776:	7e 0b                	jle    783 <atoi+0x4f>
+ 778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 77c:	0f b6 00             	movzbl (%rax),%eax
+ 77f:	3c 39                	cmp    $0x39,%al
+ 781:	7e c2                	jle    745 <atoi+0x11>
+  return n;
+ 783:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 786:	5d                   	pop    %rbp
+ 787:	c3                   	ret
+
+0000000000000788 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 788:	55                   	push   %rbp
+ 789:	48 89 e5             	mov    %rsp,%rbp
+ 78c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 790:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 794:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 797:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 79b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 79f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 7a7:	eb 1d                	jmp    7c6 <memmove+0x3e>
+    *dst++ = *src++;
+ 7a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7ad:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7b9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7bd:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7c1:	0f b6 12             	movzbl (%rdx),%edx
+ 7c4:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 7c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7c9:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7cc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7cf:	85 c0                	test   %eax,%eax
+ 7d1:	7f d6                	jg     7a9 <memmove+0x21>
+  return vdst;
+ 7d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7d7:	5d                   	pop    %rbp
+ 7d8:	c3                   	ret
+
+00000000000007d9 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 7d9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7de:	cd 40                	int    $0x40
+ 7e0:	c3                   	ret
+
+00000000000007e1 <exit>:
+SYSCALL(exit)
+ 7e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+00000000000007e9 <wait>:
+SYSCALL(wait)
+ 7e9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+00000000000007f1 <pipe>:
+SYSCALL(pipe)
+ 7f1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+00000000000007f9 <read>:
+SYSCALL(read)
+ 7f9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+0000000000000801 <write>:
+SYSCALL(write)
+ 801:	b8 10 00 00 00       	mov    $0x10,%eax
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+0000000000000809 <close>:
+SYSCALL(close)
+ 809:	b8 15 00 00 00       	mov    $0x15,%eax
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+0000000000000811 <kill>:
+SYSCALL(kill)
+ 811:	b8 06 00 00 00       	mov    $0x6,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+0000000000000819 <exec>:
+SYSCALL(exec)
+ 819:	b8 07 00 00 00       	mov    $0x7,%eax
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+0000000000000821 <open>:
+SYSCALL(open)
+ 821:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+
+0000000000000829 <mknod>:
+SYSCALL(mknod)
+ 829:	b8 11 00 00 00       	mov    $0x11,%eax
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+0000000000000831 <unlink>:
+SYSCALL(unlink)
+ 831:	b8 12 00 00 00       	mov    $0x12,%eax
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+0000000000000839 <fstat>:
+SYSCALL(fstat)
+ 839:	b8 08 00 00 00       	mov    $0x8,%eax
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+0000000000000841 <link>:
+SYSCALL(link)
+ 841:	b8 13 00 00 00       	mov    $0x13,%eax
+ 846:	cd 40                	int    $0x40
+ 848:	c3                   	ret
+
+0000000000000849 <mkdir>:
+SYSCALL(mkdir)
+ 849:	b8 14 00 00 00       	mov    $0x14,%eax
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+0000000000000851 <chdir>:
+SYSCALL(chdir)
+ 851:	b8 09 00 00 00       	mov    $0x9,%eax
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+0000000000000859 <dup>:
+SYSCALL(dup)
+ 859:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+0000000000000861 <getpid>:
+SYSCALL(getpid)
+ 861:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+0000000000000869 <sbrk>:
+SYSCALL(sbrk)
+ 869:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 86e:	cd 40                	int    $0x40
+ 870:	c3                   	ret
+
+0000000000000871 <sleep>:
+SYSCALL(sleep)
+ 871:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+0000000000000879 <uptime>:
+SYSCALL(uptime)
+ 879:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+0000000000000881 <sysinfo>:
+SYSCALL(sysinfo)
+ 881:	b8 16 00 00 00       	mov    $0x16,%eax
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+0000000000000889 <crashn>:
+SYSCALL(crashn)
+ 889:	b8 17 00 00 00       	mov    $0x17,%eax
+ 88e:	cd 40                	int    $0x40
+ 890:	c3                   	ret
+
+0000000000000891 <mmap>:
+SYSCALL(mmap)
+ 891:	b8 18 00 00 00       	mov    $0x18,%eax
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+0000000000000899 <munmap>:
+SYSCALL(munmap)
+ 899:	b8 19 00 00 00       	mov    $0x19,%eax
+ 89e:	cd 40                	int    $0x40
+ 8a0:	c3                   	ret
+
+00000000000008a1 <preface>:
+.globl preface
+preface:
+    call main
+ 8a1:	e8 5a f7 ff ff       	call   0 <main>
+    mov %rax, %rdi
+ 8a6:	48 89 c7             	mov    %rax,%rdi
+    call exit
+ 8a9:	e8 33 ff ff ff       	call   7e1 <exit>
+
+00000000000008ae <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 8ae:	55                   	push   %rbp
+ 8af:	48 89 e5             	mov    %rsp,%rbp
+ 8b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 8b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8ba:	48 83 e8 10          	sub    $0x10,%rax
+ 8be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c2:	48 8b 05 47 05 00 00 	mov    0x547(%rip),%rax        # e10 <freep>
+ 8c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8cd:	eb 2f                	jmp    8fe <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8d3:	48 8b 00             	mov    (%rax),%rax
+ 8d6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8da:	72 17                	jb     8f3 <free+0x45>
+ 8dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8e0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 8e4:	72 2f                	jb     915 <free+0x67>
+ 8e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8ea:	48 8b 00             	mov    (%rax),%rax
+ 8ed:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 8f1:	72 22                	jb     915 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8f7:	48 8b 00             	mov    (%rax),%rax
+ 8fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 8fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 902:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 906:	73 c7                	jae    8cf <free+0x21>
+ 908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 90c:	48 8b 00             	mov    (%rax),%rax
+ 90f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 913:	73 ba                	jae    8cf <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 915:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 919:	8b 40 08             	mov    0x8(%rax),%eax
+ 91c:	89 c0                	mov    %eax,%eax
+ 91e:	48 c1 e0 04          	shl    $0x4,%rax
+ 922:	48 89 c2             	mov    %rax,%rdx
+ 925:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 929:	48 01 c2             	add    %rax,%rdx
+ 92c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 930:	48 8b 00             	mov    (%rax),%rax
+ 933:	48 39 c2             	cmp    %rax,%rdx
+ 936:	75 2d                	jne    965 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 93c:	8b 50 08             	mov    0x8(%rax),%edx
+ 93f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 943:	48 8b 00             	mov    (%rax),%rax
+ 946:	8b 40 08             	mov    0x8(%rax),%eax
+ 949:	01 c2                	add    %eax,%edx
+ 94b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 94f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 956:	48 8b 00             	mov    (%rax),%rax
+ 959:	48 8b 10             	mov    (%rax),%rdx
+ 95c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 960:	48 89 10             	mov    %rdx,(%rax)
+ 963:	eb 0e                	jmp    973 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 965:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 969:	48 8b 10             	mov    (%rax),%rdx
+ 96c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 970:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ 973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 977:	8b 40 08             	mov    0x8(%rax),%eax
+ 97a:	89 c0                	mov    %eax,%eax
+ 97c:	48 c1 e0 04          	shl    $0x4,%rax
+ 980:	48 89 c2             	mov    %rax,%rdx
+ 983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 987:	48 01 d0             	add    %rdx,%rax
+ 98a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 98e:	75 27                	jne    9b7 <free+0x109>
+    p->s.size += bp->s.size;
+ 990:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 994:	8b 50 08             	mov    0x8(%rax),%edx
+ 997:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 99b:	8b 40 08             	mov    0x8(%rax),%eax
+ 99e:	01 c2                	add    %eax,%edx
+ 9a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a4:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ 9a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ab:	48 8b 10             	mov    (%rax),%rdx
+ 9ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b2:	48 89 10             	mov    %rdx,(%rax)
+ 9b5:	eb 0b                	jmp    9c2 <free+0x114>
+  } else
+    p->s.ptr = bp;
+ 9b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 9bf:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ 9c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9c6:	48 89 05 43 04 00 00 	mov    %rax,0x443(%rip)        # e10 <freep>
+}
+ 9cd:	90                   	nop
+ 9ce:	5d                   	pop    %rbp
+ 9cf:	c3                   	ret
+
+00000000000009d0 <morecore>:
+
+static Header *morecore(uint nu) {
+ 9d0:	55                   	push   %rbp
+ 9d1:	48 89 e5             	mov    %rsp,%rbp
+ 9d4:	48 83 ec 20          	sub    $0x20,%rsp
+ 9d8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ 9db:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ 9e2:	77 07                	ja     9eb <morecore+0x1b>
+    nu = 4096;
+ 9e4:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ 9eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ 9ee:	c1 e0 04             	shl    $0x4,%eax
+ 9f1:	89 c7                	mov    %eax,%edi
+ 9f3:	e8 71 fe ff ff       	call   869 <sbrk>
+ 9f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ 9fc:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ a01:	75 07                	jne    a0a <morecore+0x3a>
+    return 0;
+ a03:	b8 00 00 00 00       	mov    $0x0,%eax
+ a08:	eb 29                	jmp    a33 <morecore+0x63>
+  hp = (Header *)p;
+ a0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a16:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ a19:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ a1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a20:	48 83 c0 10          	add    $0x10,%rax
+ a24:	48 89 c7             	mov    %rax,%rdi
+ a27:	e8 82 fe ff ff       	call   8ae <free>
+  return freep;
+ a2c:	48 8b 05 dd 03 00 00 	mov    0x3dd(%rip),%rax        # e10 <freep>
+}
+ a33:	c9                   	leave
+ a34:	c3                   	ret
+
+0000000000000a35 <malloc>:
+
+void *malloc(uint nbytes) {
+ a35:	55                   	push   %rbp
+ a36:	48 89 e5             	mov    %rsp,%rbp
+ a39:	48 83 ec 30          	sub    $0x30,%rsp
+ a3d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ a40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ a43:	48 83 c0 0f          	add    $0xf,%rax
+ a47:	48 c1 e8 04          	shr    $0x4,%rax
+ a4b:	83 c0 01             	add    $0x1,%eax
+ a4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ a51:	48 8b 05 b8 03 00 00 	mov    0x3b8(%rip),%rax        # e10 <freep>
+ a58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a5c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ a61:	75 2e                	jne    a91 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ a63:	48 8d 05 96 03 00 00 	lea    0x396(%rip),%rax        # e00 <base>
+ a6a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ a6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a72:	48 89 05 97 03 00 00 	mov    %rax,0x397(%rip)        # e10 <freep>
+ a79:	48 8b 05 90 03 00 00 	mov    0x390(%rip),%rax        # e10 <freep>
+ a80:	48 89 05 79 03 00 00 	mov    %rax,0x379(%rip)        # e00 <base>
+    base.s.size = 0;
+ a87:	c7 05 77 03 00 00 00 	movl   $0x0,0x377(%rip)        # e08 <base+0x8>
+ a8e:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ a91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a95:	48 8b 00             	mov    (%rax),%rax
+ a98:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ a9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aa0:	8b 40 08             	mov    0x8(%rax),%eax
+ aa3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ aa6:	72 5f                	jb     b07 <malloc+0xd2>
+      if (p->s.size == nunits)
+ aa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aac:	8b 40 08             	mov    0x8(%rax),%eax
+ aaf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ab2:	75 10                	jne    ac4 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ ab4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab8:	48 8b 10             	mov    (%rax),%rdx
+ abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ abf:	48 89 10             	mov    %rdx,(%rax)
+ ac2:	eb 2e                	jmp    af2 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac8:	8b 40 08             	mov    0x8(%rax),%eax
+ acb:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ ace:	89 c2                	mov    %eax,%edx
+ ad0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad4:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ ad7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ adb:	8b 40 08             	mov    0x8(%rax),%eax
+ ade:	89 c0                	mov    %eax,%eax
+ ae0:	48 c1 e0 04          	shl    $0x4,%rax
+ ae4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ ae8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aec:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ aef:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ af2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ af6:	48 89 05 13 03 00 00 	mov    %rax,0x313(%rip)        # e10 <freep>
+      return (void *)(p + 1);
+ afd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b01:	48 83 c0 10          	add    $0x10,%rax
+ b05:	eb 41                	jmp    b48 <malloc+0x113>
+    }
+    if (p == freep)
+ b07:	48 8b 05 02 03 00 00 	mov    0x302(%rip),%rax        # e10 <freep>
+ b0e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ b12:	75 1c                	jne    b30 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ b14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b17:	89 c7                	mov    %eax,%edi
+ b19:	e8 b2 fe ff ff       	call   9d0 <morecore>
+ b1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ b22:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ b27:	75 07                	jne    b30 <malloc+0xfb>
+        return 0;
+ b29:	b8 00 00 00 00       	mov    $0x0,%eax
+ b2e:	eb 18                	jmp    b48 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b3c:	48 8b 00             	mov    (%rax),%rax
+ b3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b43:	e9 54 ff ff ff       	jmp    a9c <malloc+0x67>
+  }
+ b48:	c9                   	leave
+ b49:	c3                   	ret
@@ -0,0 +1,3153 @@
+
+out/user/_lab1test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void testinvalidargs(void);
+void smallfilereadtest(void);
+void duptest(void);
+void nofilestest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+
+  if(open("console", O_RDWR) < 0){
+       4:	be 02 00 00 00       	mov    $0x2,%esi
+       9:	48 8d 05 e8 24 00 00 	lea    0x24e8(%rip),%rax        # 24f8 <malloc+0x117>
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 b5 21 00 00       	call   21cd <open>
+      18:	85 c0                	test   %eax,%eax
+      1a:	79 07                	jns    23 <main+0x23>
+    return -1;
+      1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      21:	eb 6a                	jmp    8d <main+0x8d>
+  }
+  dup(0);     // stdout
+      23:	bf 00 00 00 00       	mov    $0x0,%edi
+      28:	e8 d8 21 00 00       	call   2205 <dup>
+  dup(0);     // stderr
+      2d:	bf 00 00 00 00       	mov    $0x0,%edi
+      32:	e8 ce 21 00 00       	call   2205 <dup>
+
+  printf(stdout, "hello world\n");
+      37:	8b 05 b3 32 00 00    	mov    0x32b3(%rip),%eax        # 32f0 <stdout>
+      3d:	48 8d 15 bc 24 00 00 	lea    0x24bc(%rip),%rdx        # 2500 <malloc+0x11f>
+      44:	48 89 d6             	mov    %rdx,%rsi
+      47:	89 c7                	mov    %eax,%edi
+      49:	b8 00 00 00 00       	mov    $0x0,%eax
+      4e:	e8 93 1b 00 00       	call   1be6 <printf>
+
+  // while (1);
+
+  testopen();
+      53:	e8 37 00 00 00       	call   8f <testopen>
+  testinvalidargs();
+      58:	e8 43 03 00 00       	call   3a0 <testinvalidargs>
+  smallfilereadtest();
+      5d:	e8 b9 0a 00 00       	call   b1b <smallfilereadtest>
+  duptest();
+      62:	e8 67 10 00 00       	call   10ce <duptest>
+  nofilestest();
+      67:	e8 f0 16 00 00       	call   175c <nofilestest>
+
+  printf(stdout, "lab1 tests passed!\n");
+      6c:	8b 05 7e 32 00 00    	mov    0x327e(%rip),%eax        # 32f0 <stdout>
+      72:	48 8d 15 94 24 00 00 	lea    0x2494(%rip),%rdx        # 250d <malloc+0x12c>
+      79:	48 89 d6             	mov    %rdx,%rsi
+      7c:	89 c7                	mov    %eax,%edi
+      7e:	b8 00 00 00 00       	mov    $0x0,%eax
+      83:	e8 5e 1b 00 00       	call   1be6 <printf>
+  return 0;
+      88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      8d:	5d                   	pop    %rbp
+      8e:	c3                   	ret
+
+000000000000008f <testopen>:
+
+void testopen(void) {
+      8f:	55                   	push   %rbp
+      90:	48 89 e5             	mov    %rsp,%rbp
+      93:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, fd2;
+
+  // test invalid open arguments.
+  if (open("/other.txt", O_CREATE) != -1)
+      97:	be 00 02 00 00       	mov    $0x200,%esi
+      9c:	48 8d 05 7e 24 00 00 	lea    0x247e(%rip),%rax        # 2521 <malloc+0x140>
+      a3:	48 89 c7             	mov    %rax,%rdi
+      a6:	e8 22 21 00 00       	call   21cd <open>
+      ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+      ae:	74 5c                	je     10c <testopen+0x7d>
+    error("created file in read only file system");
+      b0:	8b 05 3a 32 00 00    	mov    0x323a(%rip),%eax        # 32f0 <stdout>
+      b6:	ba 3f 00 00 00       	mov    $0x3f,%edx
+      bb:	48 8d 0d 6a 24 00 00 	lea    0x246a(%rip),%rcx        # 252c <malloc+0x14b>
+      c2:	48 89 ce             	mov    %rcx,%rsi
+      c5:	89 c7                	mov    %eax,%edi
+      c7:	b8 00 00 00 00       	mov    $0x0,%eax
+      cc:	e8 15 1b 00 00       	call   1be6 <printf>
+      d1:	8b 05 19 32 00 00    	mov    0x3219(%rip),%eax        # 32f0 <stdout>
+      d7:	48 8d 15 62 24 00 00 	lea    0x2462(%rip),%rdx        # 2540 <malloc+0x15f>
+      de:	48 89 d6             	mov    %rdx,%rsi
+      e1:	89 c7                	mov    %eax,%edi
+      e3:	b8 00 00 00 00       	mov    $0x0,%eax
+      e8:	e8 f9 1a 00 00       	call   1be6 <printf>
+      ed:	8b 05 fd 31 00 00    	mov    0x31fd(%rip),%eax        # 32f0 <stdout>
+      f3:	48 8d 15 6c 24 00 00 	lea    0x246c(%rip),%rdx        # 2566 <malloc+0x185>
+      fa:	48 89 d6             	mov    %rdx,%rsi
+      fd:	89 c7                	mov    %eax,%edi
+      ff:	b8 00 00 00 00       	mov    $0x0,%eax
+     104:	e8 dd 1a 00 00       	call   1be6 <printf>
+     109:	90                   	nop
+     10a:	eb fd                	jmp    109 <testopen+0x7a>
+
+  if (open("/small.txt", O_RDWR) != -1 || open("/small.txt", O_WRONLY) != -1)
+     10c:	be 02 00 00 00       	mov    $0x2,%esi
+     111:	48 8d 05 50 24 00 00 	lea    0x2450(%rip),%rax        # 2568 <malloc+0x187>
+     118:	48 89 c7             	mov    %rax,%rdi
+     11b:	e8 ad 20 00 00       	call   21cd <open>
+     120:	83 f8 ff             	cmp    $0xffffffff,%eax
+     123:	75 19                	jne    13e <testopen+0xaf>
+     125:	be 01 00 00 00       	mov    $0x1,%esi
+     12a:	48 8d 05 37 24 00 00 	lea    0x2437(%rip),%rax        # 2568 <malloc+0x187>
+     131:	48 89 c7             	mov    %rax,%rdi
+     134:	e8 94 20 00 00       	call   21cd <open>
+     139:	83 f8 ff             	cmp    $0xffffffff,%eax
+     13c:	74 5c                	je     19a <testopen+0x10b>
+    error("tried to open a file for writing in read only fs");
+     13e:	8b 05 ac 31 00 00    	mov    0x31ac(%rip),%eax        # 32f0 <stdout>
+     144:	ba 42 00 00 00       	mov    $0x42,%edx
+     149:	48 8d 0d dc 23 00 00 	lea    0x23dc(%rip),%rcx        # 252c <malloc+0x14b>
+     150:	48 89 ce             	mov    %rcx,%rsi
+     153:	89 c7                	mov    %eax,%edi
+     155:	b8 00 00 00 00       	mov    $0x0,%eax
+     15a:	e8 87 1a 00 00       	call   1be6 <printf>
+     15f:	8b 05 8b 31 00 00    	mov    0x318b(%rip),%eax        # 32f0 <stdout>
+     165:	48 8d 15 0c 24 00 00 	lea    0x240c(%rip),%rdx        # 2578 <malloc+0x197>
+     16c:	48 89 d6             	mov    %rdx,%rsi
+     16f:	89 c7                	mov    %eax,%edi
+     171:	b8 00 00 00 00       	mov    $0x0,%eax
+     176:	e8 6b 1a 00 00       	call   1be6 <printf>
+     17b:	8b 05 6f 31 00 00    	mov    0x316f(%rip),%eax        # 32f0 <stdout>
+     181:	48 8d 15 de 23 00 00 	lea    0x23de(%rip),%rdx        # 2566 <malloc+0x185>
+     188:	48 89 d6             	mov    %rdx,%rsi
+     18b:	89 c7                	mov    %eax,%edi
+     18d:	b8 00 00 00 00       	mov    $0x0,%eax
+     192:	e8 4f 1a 00 00       	call   1be6 <printf>
+     197:	90                   	nop
+     198:	eb fd                	jmp    197 <testopen+0x108>
+
+  if (open("/other.txt", O_RDONLY) != -1)
+     19a:	be 00 00 00 00       	mov    $0x0,%esi
+     19f:	48 8d 05 7b 23 00 00 	lea    0x237b(%rip),%rax        # 2521 <malloc+0x140>
+     1a6:	48 89 c7             	mov    %rax,%rdi
+     1a9:	e8 1f 20 00 00       	call   21cd <open>
+     1ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1b1:	74 5c                	je     20f <testopen+0x180>
+    error("opened a file that doesn't exist");
+     1b3:	8b 05 37 31 00 00    	mov    0x3137(%rip),%eax        # 32f0 <stdout>
+     1b9:	ba 45 00 00 00       	mov    $0x45,%edx
+     1be:	48 8d 0d 67 23 00 00 	lea    0x2367(%rip),%rcx        # 252c <malloc+0x14b>
+     1c5:	48 89 ce             	mov    %rcx,%rsi
+     1c8:	89 c7                	mov    %eax,%edi
+     1ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     1cf:	e8 12 1a 00 00       	call   1be6 <printf>
+     1d4:	8b 05 16 31 00 00    	mov    0x3116(%rip),%eax        # 32f0 <stdout>
+     1da:	48 8d 15 cf 23 00 00 	lea    0x23cf(%rip),%rdx        # 25b0 <malloc+0x1cf>
+     1e1:	48 89 d6             	mov    %rdx,%rsi
+     1e4:	89 c7                	mov    %eax,%edi
+     1e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1eb:	e8 f6 19 00 00       	call   1be6 <printf>
+     1f0:	8b 05 fa 30 00 00    	mov    0x30fa(%rip),%eax        # 32f0 <stdout>
+     1f6:	48 8d 15 69 23 00 00 	lea    0x2369(%rip),%rdx        # 2566 <malloc+0x185>
+     1fd:	48 89 d6             	mov    %rdx,%rsi
+     200:	89 c7                	mov    %eax,%edi
+     202:	b8 00 00 00 00       	mov    $0x0,%eax
+     207:	e8 da 19 00 00       	call   1be6 <printf>
+     20c:	90                   	nop
+     20d:	eb fd                	jmp    20c <testopen+0x17d>
+
+  fd = open("/small.txt", O_RDONLY);
+     20f:	be 00 00 00 00       	mov    $0x0,%esi
+     214:	48 8d 05 4d 23 00 00 	lea    0x234d(%rip),%rax        # 2568 <malloc+0x187>
+     21b:	48 89 c7             	mov    %rax,%rdi
+     21e:	e8 aa 1f 00 00       	call   21cd <open>
+     223:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd == -1)
+     226:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     22a:	75 5c                	jne    288 <testopen+0x1f9>
+    error("cannot open small.txt");
+     22c:	8b 05 be 30 00 00    	mov    0x30be(%rip),%eax        # 32f0 <stdout>
+     232:	ba 49 00 00 00       	mov    $0x49,%edx
+     237:	48 8d 0d ee 22 00 00 	lea    0x22ee(%rip),%rcx        # 252c <malloc+0x14b>
+     23e:	48 89 ce             	mov    %rcx,%rsi
+     241:	89 c7                	mov    %eax,%edi
+     243:	b8 00 00 00 00       	mov    $0x0,%eax
+     248:	e8 99 19 00 00       	call   1be6 <printf>
+     24d:	8b 05 9d 30 00 00    	mov    0x309d(%rip),%eax        # 32f0 <stdout>
+     253:	48 8d 15 77 23 00 00 	lea    0x2377(%rip),%rdx        # 25d1 <malloc+0x1f0>
+     25a:	48 89 d6             	mov    %rdx,%rsi
+     25d:	89 c7                	mov    %eax,%edi
+     25f:	b8 00 00 00 00       	mov    $0x0,%eax
+     264:	e8 7d 19 00 00       	call   1be6 <printf>
+     269:	8b 05 81 30 00 00    	mov    0x3081(%rip),%eax        # 32f0 <stdout>
+     26f:	48 8d 15 f0 22 00 00 	lea    0x22f0(%rip),%rdx        # 2566 <malloc+0x185>
+     276:	48 89 d6             	mov    %rdx,%rsi
+     279:	89 c7                	mov    %eax,%edi
+     27b:	b8 00 00 00 00       	mov    $0x0,%eax
+     280:	e8 61 19 00 00       	call   1be6 <printf>
+     285:	90                   	nop
+     286:	eb fd                	jmp    285 <testopen+0x1f6>
+
+  printf(stdout, "passed argument checking for open\n");
+     288:	8b 05 62 30 00 00    	mov    0x3062(%rip),%eax        # 32f0 <stdout>
+     28e:	48 8d 15 53 23 00 00 	lea    0x2353(%rip),%rdx        # 25e8 <malloc+0x207>
+     295:	48 89 d6             	mov    %rdx,%rsi
+     298:	89 c7                	mov    %eax,%edi
+     29a:	b8 00 00 00 00       	mov    $0x0,%eax
+     29f:	e8 42 19 00 00       	call   1be6 <printf>
+
+  // ensure opening the same file results with a
+  // different file descriptor.
+  fd2 = open("/small.txt", O_RDONLY);
+     2a4:	be 00 00 00 00       	mov    $0x0,%esi
+     2a9:	48 8d 05 b8 22 00 00 	lea    0x22b8(%rip),%rax        # 2568 <malloc+0x187>
+     2b0:	48 89 c7             	mov    %rax,%rdi
+     2b3:	e8 15 1f 00 00       	call   21cd <open>
+     2b8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (fd2 == -1)
+     2bb:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     2bf:	75 5c                	jne    31d <testopen+0x28e>
+    error("cannot open small.txt on 2nd try");
+     2c1:	8b 05 29 30 00 00    	mov    0x3029(%rip),%eax        # 32f0 <stdout>
+     2c7:	ba 51 00 00 00       	mov    $0x51,%edx
+     2cc:	48 8d 0d 59 22 00 00 	lea    0x2259(%rip),%rcx        # 252c <malloc+0x14b>
+     2d3:	48 89 ce             	mov    %rcx,%rsi
+     2d6:	89 c7                	mov    %eax,%edi
+     2d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2dd:	e8 04 19 00 00       	call   1be6 <printf>
+     2e2:	8b 05 08 30 00 00    	mov    0x3008(%rip),%eax        # 32f0 <stdout>
+     2e8:	48 8d 15 21 23 00 00 	lea    0x2321(%rip),%rdx        # 2610 <malloc+0x22f>
+     2ef:	48 89 d6             	mov    %rdx,%rsi
+     2f2:	89 c7                	mov    %eax,%edi
+     2f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f9:	e8 e8 18 00 00       	call   1be6 <printf>
+     2fe:	8b 05 ec 2f 00 00    	mov    0x2fec(%rip),%eax        # 32f0 <stdout>
+     304:	48 8d 15 5b 22 00 00 	lea    0x225b(%rip),%rdx        # 2566 <malloc+0x185>
+     30b:	48 89 d6             	mov    %rdx,%rsi
+     30e:	89 c7                	mov    %eax,%edi
+     310:	b8 00 00 00 00       	mov    $0x0,%eax
+     315:	e8 cc 18 00 00       	call   1be6 <printf>
+     31a:	90                   	nop
+     31b:	eb fd                	jmp    31a <testopen+0x28b>
+  if (fd == fd2)
+     31d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     320:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     323:	75 5c                	jne    381 <testopen+0x2f2>
+    error("opening same file results with same file descriptor");
+     325:	8b 05 c5 2f 00 00    	mov    0x2fc5(%rip),%eax        # 32f0 <stdout>
+     32b:	ba 53 00 00 00       	mov    $0x53,%edx
+     330:	48 8d 0d f5 21 00 00 	lea    0x21f5(%rip),%rcx        # 252c <malloc+0x14b>
+     337:	48 89 ce             	mov    %rcx,%rsi
+     33a:	89 c7                	mov    %eax,%edi
+     33c:	b8 00 00 00 00       	mov    $0x0,%eax
+     341:	e8 a0 18 00 00       	call   1be6 <printf>
+     346:	8b 05 a4 2f 00 00    	mov    0x2fa4(%rip),%eax        # 32f0 <stdout>
+     34c:	48 8d 15 e5 22 00 00 	lea    0x22e5(%rip),%rdx        # 2638 <malloc+0x257>
+     353:	48 89 d6             	mov    %rdx,%rsi
+     356:	89 c7                	mov    %eax,%edi
+     358:	b8 00 00 00 00       	mov    $0x0,%eax
+     35d:	e8 84 18 00 00       	call   1be6 <printf>
+     362:	8b 05 88 2f 00 00    	mov    0x2f88(%rip),%eax        # 32f0 <stdout>
+     368:	48 8d 15 f7 21 00 00 	lea    0x21f7(%rip),%rdx        # 2566 <malloc+0x185>
+     36f:	48 89 d6             	mov    %rdx,%rsi
+     372:	89 c7                	mov    %eax,%edi
+     374:	b8 00 00 00 00       	mov    $0x0,%eax
+     379:	e8 68 18 00 00       	call   1be6 <printf>
+     37e:	90                   	nop
+     37f:	eb fd                	jmp    37e <testopen+0x2ef>
+
+  printf(stdout, "passed opening same file twice.\n");
+     381:	8b 05 69 2f 00 00    	mov    0x2f69(%rip),%eax        # 32f0 <stdout>
+     387:	48 8d 15 e2 22 00 00 	lea    0x22e2(%rip),%rdx        # 2670 <malloc+0x28f>
+     38e:	48 89 d6             	mov    %rdx,%rsi
+     391:	89 c7                	mov    %eax,%edi
+     393:	b8 00 00 00 00       	mov    $0x0,%eax
+     398:	e8 49 18 00 00       	call   1be6 <printf>
+
+}
+     39d:	90                   	nop
+     39e:	c9                   	leave
+     39f:	c3                   	ret
+
+00000000000003a0 <testinvalidargs>:
+
+void testinvalidargs(void) {
+     3a0:	55                   	push   %rbp
+     3a1:	48 89 e5             	mov    %rsp,%rbp
+     3a4:	48 83 ec 30          	sub    $0x30,%rsp
+  char buf[11];
+  struct stat st;
+
+
+  // read
+  if (read(15, buf, 11) != -1)
+     3a8:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     3ac:	ba 0b 00 00 00       	mov    $0xb,%edx
+     3b1:	48 89 c6             	mov    %rax,%rsi
+     3b4:	bf 0f 00 00 00       	mov    $0xf,%edi
+     3b9:	e8 e7 1d 00 00       	call   21a5 <read>
+     3be:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3c1:	74 5c                	je     41f <testinvalidargs+0x7f>
+    error("read on a non existent file descriptor");
+     3c3:	8b 05 27 2f 00 00    	mov    0x2f27(%rip),%eax        # 32f0 <stdout>
+     3c9:	ba 61 00 00 00       	mov    $0x61,%edx
+     3ce:	48 8d 0d 57 21 00 00 	lea    0x2157(%rip),%rcx        # 252c <malloc+0x14b>
+     3d5:	48 89 ce             	mov    %rcx,%rsi
+     3d8:	89 c7                	mov    %eax,%edi
+     3da:	b8 00 00 00 00       	mov    $0x0,%eax
+     3df:	e8 02 18 00 00       	call   1be6 <printf>
+     3e4:	8b 05 06 2f 00 00    	mov    0x2f06(%rip),%eax        # 32f0 <stdout>
+     3ea:	48 8d 15 a7 22 00 00 	lea    0x22a7(%rip),%rdx        # 2698 <malloc+0x2b7>
+     3f1:	48 89 d6             	mov    %rdx,%rsi
+     3f4:	89 c7                	mov    %eax,%edi
+     3f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     3fb:	e8 e6 17 00 00       	call   1be6 <printf>
+     400:	8b 05 ea 2e 00 00    	mov    0x2eea(%rip),%eax        # 32f0 <stdout>
+     406:	48 8d 15 59 21 00 00 	lea    0x2159(%rip),%rdx        # 2566 <malloc+0x185>
+     40d:	48 89 d6             	mov    %rdx,%rsi
+     410:	89 c7                	mov    %eax,%edi
+     412:	b8 00 00 00 00       	mov    $0x0,%eax
+     417:	e8 ca 17 00 00       	call   1be6 <printf>
+     41c:	90                   	nop
+     41d:	eb fd                	jmp    41c <testinvalidargs+0x7c>
+
+  fd = open("console", O_WRONLY);
+     41f:	be 01 00 00 00       	mov    $0x1,%esi
+     424:	48 8d 05 cd 20 00 00 	lea    0x20cd(%rip),%rax        # 24f8 <malloc+0x117>
+     42b:	48 89 c7             	mov    %rax,%rdi
+     42e:	e8 9a 1d 00 00       	call   21cd <open>
+     433:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  assert(fd != -1);
+     436:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     43a:	75 2b                	jne    467 <testinvalidargs+0xc7>
+     43c:	8b 05 ae 2e 00 00    	mov    0x2eae(%rip),%eax        # 32f0 <stdout>
+     442:	48 8d 15 76 22 00 00 	lea    0x2276(%rip),%rdx        # 26bf <malloc+0x2de>
+     449:	48 89 d1             	mov    %rdx,%rcx
+     44c:	ba 64 00 00 00       	mov    $0x64,%edx
+     451:	48 8d 35 70 22 00 00 	lea    0x2270(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     458:	89 c7                	mov    %eax,%edi
+     45a:	b8 00 00 00 00       	mov    $0x0,%eax
+     45f:	e8 82 17 00 00       	call   1be6 <printf>
+     464:	90                   	nop
+     465:	eb fd                	jmp    464 <testinvalidargs+0xc4>
+
+  if (read(fd, buf, 10) != -1)
+     467:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     46b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     46e:	ba 0a 00 00 00       	mov    $0xa,%edx
+     473:	48 89 ce             	mov    %rcx,%rsi
+     476:	89 c7                	mov    %eax,%edi
+     478:	e8 28 1d 00 00       	call   21a5 <read>
+     47d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     480:	74 5c                	je     4de <testinvalidargs+0x13e>
+    // NOTE: If the test hangs here it's because you're trying to read from
+    // stdin (hint: shouldn't happen).
+    error("able to read from a write only console");
+     482:	8b 05 68 2e 00 00    	mov    0x2e68(%rip),%eax        # 32f0 <stdout>
+     488:	ba 69 00 00 00       	mov    $0x69,%edx
+     48d:	48 8d 0d 98 20 00 00 	lea    0x2098(%rip),%rcx        # 252c <malloc+0x14b>
+     494:	48 89 ce             	mov    %rcx,%rsi
+     497:	89 c7                	mov    %eax,%edi
+     499:	b8 00 00 00 00       	mov    $0x0,%eax
+     49e:	e8 43 17 00 00       	call   1be6 <printf>
+     4a3:	8b 05 47 2e 00 00    	mov    0x2e47(%rip),%eax        # 32f0 <stdout>
+     4a9:	48 8d 15 38 22 00 00 	lea    0x2238(%rip),%rdx        # 26e8 <malloc+0x307>
+     4b0:	48 89 d6             	mov    %rdx,%rsi
+     4b3:	89 c7                	mov    %eax,%edi
+     4b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ba:	e8 27 17 00 00       	call   1be6 <printf>
+     4bf:	8b 05 2b 2e 00 00    	mov    0x2e2b(%rip),%eax        # 32f0 <stdout>
+     4c5:	48 8d 15 9a 20 00 00 	lea    0x209a(%rip),%rdx        # 2566 <malloc+0x185>
+     4cc:	48 89 d6             	mov    %rdx,%rsi
+     4cf:	89 c7                	mov    %eax,%edi
+     4d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d6:	e8 0b 17 00 00       	call   1be6 <printf>
+     4db:	90                   	nop
+     4dc:	eb fd                	jmp    4db <testinvalidargs+0x13b>
+  assert(close(fd) == 0);
+     4de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4e1:	89 c7                	mov    %eax,%edi
+     4e3:	e8 cd 1c 00 00       	call   21b5 <close>
+     4e8:	85 c0                	test   %eax,%eax
+     4ea:	74 2b                	je     517 <testinvalidargs+0x177>
+     4ec:	8b 05 fe 2d 00 00    	mov    0x2dfe(%rip),%eax        # 32f0 <stdout>
+     4f2:	48 8d 15 16 22 00 00 	lea    0x2216(%rip),%rdx        # 270f <malloc+0x32e>
+     4f9:	48 89 d1             	mov    %rdx,%rcx
+     4fc:	ba 6a 00 00 00       	mov    $0x6a,%edx
+     501:	48 8d 35 c0 21 00 00 	lea    0x21c0(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     508:	89 c7                	mov    %eax,%edi
+     50a:	b8 00 00 00 00       	mov    $0x0,%eax
+     50f:	e8 d2 16 00 00       	call   1be6 <printf>
+     514:	90                   	nop
+     515:	eb fd                	jmp    514 <testinvalidargs+0x174>
+
+  fd = open("/small.txt", O_RDONLY);
+     517:	be 00 00 00 00       	mov    $0x0,%esi
+     51c:	48 8d 05 45 20 00 00 	lea    0x2045(%rip),%rax        # 2568 <malloc+0x187>
+     523:	48 89 c7             	mov    %rax,%rdi
+     526:	e8 a2 1c 00 00       	call   21cd <open>
+     52b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if ((i = read(fd, buf, -100)) != -1)
+     52e:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     532:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     535:	ba 9c ff ff ff       	mov    $0xffffff9c,%edx
+     53a:	48 89 ce             	mov    %rcx,%rsi
+     53d:	89 c7                	mov    %eax,%edi
+     53f:	e8 61 1c 00 00       	call   21a5 <read>
+     544:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     547:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     54b:	74 5f                	je     5ac <testinvalidargs+0x20c>
+    error("negative n didn't return error, return value was '%d'", i);
+     54d:	8b 05 9d 2d 00 00    	mov    0x2d9d(%rip),%eax        # 32f0 <stdout>
+     553:	ba 6f 00 00 00       	mov    $0x6f,%edx
+     558:	48 8d 0d cd 1f 00 00 	lea    0x1fcd(%rip),%rcx        # 252c <malloc+0x14b>
+     55f:	48 89 ce             	mov    %rcx,%rsi
+     562:	89 c7                	mov    %eax,%edi
+     564:	b8 00 00 00 00       	mov    $0x0,%eax
+     569:	e8 78 16 00 00       	call   1be6 <printf>
+     56e:	8b 05 7c 2d 00 00    	mov    0x2d7c(%rip),%eax        # 32f0 <stdout>
+     574:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     577:	48 8d 0d a2 21 00 00 	lea    0x21a2(%rip),%rcx        # 2720 <malloc+0x33f>
+     57e:	48 89 ce             	mov    %rcx,%rsi
+     581:	89 c7                	mov    %eax,%edi
+     583:	b8 00 00 00 00       	mov    $0x0,%eax
+     588:	e8 59 16 00 00       	call   1be6 <printf>
+     58d:	8b 05 5d 2d 00 00    	mov    0x2d5d(%rip),%eax        # 32f0 <stdout>
+     593:	48 8d 15 cc 1f 00 00 	lea    0x1fcc(%rip),%rdx        # 2566 <malloc+0x185>
+     59a:	48 89 d6             	mov    %rdx,%rsi
+     59d:	89 c7                	mov    %eax,%edi
+     59f:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a4:	e8 3d 16 00 00       	call   1be6 <printf>
+     5a9:	90                   	nop
+     5aa:	eb fd                	jmp    5a9 <testinvalidargs+0x209>
+
+  if (read(fd, (char *)0xffffff00, 10) != -1)
+     5ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5af:	ba 0a 00 00 00       	mov    $0xa,%edx
+     5b4:	b9 00 ff ff ff       	mov    $0xffffff00,%ecx
+     5b9:	48 89 ce             	mov    %rcx,%rsi
+     5bc:	89 c7                	mov    %eax,%edi
+     5be:	e8 e2 1b 00 00       	call   21a5 <read>
+     5c3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5c6:	74 5c                	je     624 <testinvalidargs+0x284>
+    error("able to read to a buffer not in my memory region");
+     5c8:	8b 05 22 2d 00 00    	mov    0x2d22(%rip),%eax        # 32f0 <stdout>
+     5ce:	ba 72 00 00 00       	mov    $0x72,%edx
+     5d3:	48 8d 0d 52 1f 00 00 	lea    0x1f52(%rip),%rcx        # 252c <malloc+0x14b>
+     5da:	48 89 ce             	mov    %rcx,%rsi
+     5dd:	89 c7                	mov    %eax,%edi
+     5df:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e4:	e8 fd 15 00 00       	call   1be6 <printf>
+     5e9:	8b 05 01 2d 00 00    	mov    0x2d01(%rip),%eax        # 32f0 <stdout>
+     5ef:	48 8d 15 62 21 00 00 	lea    0x2162(%rip),%rdx        # 2758 <malloc+0x377>
+     5f6:	48 89 d6             	mov    %rdx,%rsi
+     5f9:	89 c7                	mov    %eax,%edi
+     5fb:	b8 00 00 00 00       	mov    $0x0,%eax
+     600:	e8 e1 15 00 00       	call   1be6 <printf>
+     605:	8b 05 e5 2c 00 00    	mov    0x2ce5(%rip),%eax        # 32f0 <stdout>
+     60b:	48 8d 15 54 1f 00 00 	lea    0x1f54(%rip),%rdx        # 2566 <malloc+0x185>
+     612:	48 89 d6             	mov    %rdx,%rsi
+     615:	89 c7                	mov    %eax,%edi
+     617:	b8 00 00 00 00       	mov    $0x0,%eax
+     61c:	e8 c5 15 00 00       	call   1be6 <printf>
+     621:	90                   	nop
+     622:	eb fd                	jmp    621 <testinvalidargs+0x281>
+
+  printf(stdout, "passed argument checking for read\n");
+     624:	8b 05 c6 2c 00 00    	mov    0x2cc6(%rip),%eax        # 32f0 <stdout>
+     62a:	48 8d 15 5f 21 00 00 	lea    0x215f(%rip),%rdx        # 2790 <malloc+0x3af>
+     631:	48 89 d6             	mov    %rdx,%rsi
+     634:	89 c7                	mov    %eax,%edi
+     636:	b8 00 00 00 00       	mov    $0x0,%eax
+     63b:	e8 a6 15 00 00       	call   1be6 <printf>
+
+  // write
+  if (write(15, buf, 11) != -1)
+     640:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     644:	ba 0b 00 00 00       	mov    $0xb,%edx
+     649:	48 89 c6             	mov    %rax,%rsi
+     64c:	bf 0f 00 00 00       	mov    $0xf,%edi
+     651:	e8 57 1b 00 00       	call   21ad <write>
+     656:	83 f8 ff             	cmp    $0xffffffff,%eax
+     659:	74 5c                	je     6b7 <testinvalidargs+0x317>
+    error("write on a non existent file descriptor");
+     65b:	8b 05 8f 2c 00 00    	mov    0x2c8f(%rip),%eax        # 32f0 <stdout>
+     661:	ba 78 00 00 00       	mov    $0x78,%edx
+     666:	48 8d 0d bf 1e 00 00 	lea    0x1ebf(%rip),%rcx        # 252c <malloc+0x14b>
+     66d:	48 89 ce             	mov    %rcx,%rsi
+     670:	89 c7                	mov    %eax,%edi
+     672:	b8 00 00 00 00       	mov    $0x0,%eax
+     677:	e8 6a 15 00 00       	call   1be6 <printf>
+     67c:	8b 05 6e 2c 00 00    	mov    0x2c6e(%rip),%eax        # 32f0 <stdout>
+     682:	48 8d 15 2f 21 00 00 	lea    0x212f(%rip),%rdx        # 27b8 <malloc+0x3d7>
+     689:	48 89 d6             	mov    %rdx,%rsi
+     68c:	89 c7                	mov    %eax,%edi
+     68e:	b8 00 00 00 00       	mov    $0x0,%eax
+     693:	e8 4e 15 00 00       	call   1be6 <printf>
+     698:	8b 05 52 2c 00 00    	mov    0x2c52(%rip),%eax        # 32f0 <stdout>
+     69e:	48 8d 15 c1 1e 00 00 	lea    0x1ec1(%rip),%rdx        # 2566 <malloc+0x185>
+     6a5:	48 89 d6             	mov    %rdx,%rsi
+     6a8:	89 c7                	mov    %eax,%edi
+     6aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     6af:	e8 32 15 00 00       	call   1be6 <printf>
+     6b4:	90                   	nop
+     6b5:	eb fd                	jmp    6b4 <testinvalidargs+0x314>
+
+  if (write(fd, buf, 11) != -1)
+     6b7:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     6bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6be:	ba 0b 00 00 00       	mov    $0xb,%edx
+     6c3:	48 89 ce             	mov    %rcx,%rsi
+     6c6:	89 c7                	mov    %eax,%edi
+     6c8:	e8 e0 1a 00 00       	call   21ad <write>
+     6cd:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6d0:	74 5c                	je     72e <testinvalidargs+0x38e>
+    error("able to write to a file in read only fs");
+     6d2:	8b 05 18 2c 00 00    	mov    0x2c18(%rip),%eax        # 32f0 <stdout>
+     6d8:	ba 7b 00 00 00       	mov    $0x7b,%edx
+     6dd:	48 8d 0d 48 1e 00 00 	lea    0x1e48(%rip),%rcx        # 252c <malloc+0x14b>
+     6e4:	48 89 ce             	mov    %rcx,%rsi
+     6e7:	89 c7                	mov    %eax,%edi
+     6e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ee:	e8 f3 14 00 00       	call   1be6 <printf>
+     6f3:	8b 05 f7 2b 00 00    	mov    0x2bf7(%rip),%eax        # 32f0 <stdout>
+     6f9:	48 8d 15 e0 20 00 00 	lea    0x20e0(%rip),%rdx        # 27e0 <malloc+0x3ff>
+     700:	48 89 d6             	mov    %rdx,%rsi
+     703:	89 c7                	mov    %eax,%edi
+     705:	b8 00 00 00 00       	mov    $0x0,%eax
+     70a:	e8 d7 14 00 00       	call   1be6 <printf>
+     70f:	8b 05 db 2b 00 00    	mov    0x2bdb(%rip),%eax        # 32f0 <stdout>
+     715:	48 8d 15 4a 1e 00 00 	lea    0x1e4a(%rip),%rdx        # 2566 <malloc+0x185>
+     71c:	48 89 d6             	mov    %rdx,%rsi
+     71f:	89 c7                	mov    %eax,%edi
+     721:	b8 00 00 00 00       	mov    $0x0,%eax
+     726:	e8 bb 14 00 00       	call   1be6 <printf>
+     72b:	90                   	nop
+     72c:	eb fd                	jmp    72b <testinvalidargs+0x38b>
+
+  printf(stdout, "passed argument checking for write\n");
+     72e:	8b 05 bc 2b 00 00    	mov    0x2bbc(%rip),%eax        # 32f0 <stdout>
+     734:	48 8d 15 cd 20 00 00 	lea    0x20cd(%rip),%rdx        # 2808 <malloc+0x427>
+     73b:	48 89 d6             	mov    %rdx,%rsi
+     73e:	89 c7                	mov    %eax,%edi
+     740:	b8 00 00 00 00       	mov    $0x0,%eax
+     745:	e8 9c 14 00 00       	call   1be6 <printf>
+
+  // stat
+  if (fstat(15, &st) != -1)
+     74a:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     74e:	48 89 c6             	mov    %rax,%rsi
+     751:	bf 0f 00 00 00       	mov    $0xf,%edi
+     756:	e8 8a 1a 00 00       	call   21e5 <fstat>
+     75b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     75e:	74 5c                	je     7bc <testinvalidargs+0x41c>
+    error("tried to fstat on a non existent file descriptor");
+     760:	8b 05 8a 2b 00 00    	mov    0x2b8a(%rip),%eax        # 32f0 <stdout>
+     766:	ba 81 00 00 00       	mov    $0x81,%edx
+     76b:	48 8d 0d ba 1d 00 00 	lea    0x1dba(%rip),%rcx        # 252c <malloc+0x14b>
+     772:	48 89 ce             	mov    %rcx,%rsi
+     775:	89 c7                	mov    %eax,%edi
+     777:	b8 00 00 00 00       	mov    $0x0,%eax
+     77c:	e8 65 14 00 00       	call   1be6 <printf>
+     781:	8b 05 69 2b 00 00    	mov    0x2b69(%rip),%eax        # 32f0 <stdout>
+     787:	48 8d 15 a2 20 00 00 	lea    0x20a2(%rip),%rdx        # 2830 <malloc+0x44f>
+     78e:	48 89 d6             	mov    %rdx,%rsi
+     791:	89 c7                	mov    %eax,%edi
+     793:	b8 00 00 00 00       	mov    $0x0,%eax
+     798:	e8 49 14 00 00       	call   1be6 <printf>
+     79d:	8b 05 4d 2b 00 00    	mov    0x2b4d(%rip),%eax        # 32f0 <stdout>
+     7a3:	48 8d 15 bc 1d 00 00 	lea    0x1dbc(%rip),%rdx        # 2566 <malloc+0x185>
+     7aa:	48 89 d6             	mov    %rdx,%rsi
+     7ad:	89 c7                	mov    %eax,%edi
+     7af:	b8 00 00 00 00       	mov    $0x0,%eax
+     7b4:	e8 2d 14 00 00       	call   1be6 <printf>
+     7b9:	90                   	nop
+     7ba:	eb fd                	jmp    7b9 <testinvalidargs+0x419>
+
+  if (fstat(stdout, &st) != 0) error("couldn't fstat on stdout");
+     7bc:	8b 05 2e 2b 00 00    	mov    0x2b2e(%rip),%eax        # 32f0 <stdout>
+     7c2:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+     7c6:	48 89 d6             	mov    %rdx,%rsi
+     7c9:	89 c7                	mov    %eax,%edi
+     7cb:	e8 15 1a 00 00       	call   21e5 <fstat>
+     7d0:	85 c0                	test   %eax,%eax
+     7d2:	74 5c                	je     830 <testinvalidargs+0x490>
+     7d4:	8b 05 16 2b 00 00    	mov    0x2b16(%rip),%eax        # 32f0 <stdout>
+     7da:	ba 83 00 00 00       	mov    $0x83,%edx
+     7df:	48 8d 0d 46 1d 00 00 	lea    0x1d46(%rip),%rcx        # 252c <malloc+0x14b>
+     7e6:	48 89 ce             	mov    %rcx,%rsi
+     7e9:	89 c7                	mov    %eax,%edi
+     7eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f0:	e8 f1 13 00 00       	call   1be6 <printf>
+     7f5:	8b 05 f5 2a 00 00    	mov    0x2af5(%rip),%eax        # 32f0 <stdout>
+     7fb:	48 8d 15 5f 20 00 00 	lea    0x205f(%rip),%rdx        # 2861 <malloc+0x480>
+     802:	48 89 d6             	mov    %rdx,%rsi
+     805:	89 c7                	mov    %eax,%edi
+     807:	b8 00 00 00 00       	mov    $0x0,%eax
+     80c:	e8 d5 13 00 00       	call   1be6 <printf>
+     811:	8b 05 d9 2a 00 00    	mov    0x2ad9(%rip),%eax        # 32f0 <stdout>
+     817:	48 8d 15 48 1d 00 00 	lea    0x1d48(%rip),%rdx        # 2566 <malloc+0x185>
+     81e:	48 89 d6             	mov    %rdx,%rsi
+     821:	89 c7                	mov    %eax,%edi
+     823:	b8 00 00 00 00       	mov    $0x0,%eax
+     828:	e8 b9 13 00 00       	call   1be6 <printf>
+     82d:	90                   	nop
+     82e:	eb fd                	jmp    82d <testinvalidargs+0x48d>
+
+  assert(st.type == T_DEV);
+     830:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     834:	66 83 f8 03          	cmp    $0x3,%ax
+     838:	74 2b                	je     865 <testinvalidargs+0x4c5>
+     83a:	8b 05 b0 2a 00 00    	mov    0x2ab0(%rip),%eax        # 32f0 <stdout>
+     840:	48 8d 15 33 20 00 00 	lea    0x2033(%rip),%rdx        # 287a <malloc+0x499>
+     847:	48 89 d1             	mov    %rdx,%rcx
+     84a:	ba 85 00 00 00       	mov    $0x85,%edx
+     84f:	48 8d 35 72 1e 00 00 	lea    0x1e72(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     856:	89 c7                	mov    %eax,%edi
+     858:	b8 00 00 00 00       	mov    $0x0,%eax
+     85d:	e8 84 13 00 00       	call   1be6 <printf>
+     862:	90                   	nop
+     863:	eb fd                	jmp    862 <testinvalidargs+0x4c2>
+  assert(st.size == 0);
+     865:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     868:	85 c0                	test   %eax,%eax
+     86a:	74 2b                	je     897 <testinvalidargs+0x4f7>
+     86c:	8b 05 7e 2a 00 00    	mov    0x2a7e(%rip),%eax        # 32f0 <stdout>
+     872:	48 8d 15 12 20 00 00 	lea    0x2012(%rip),%rdx        # 288b <malloc+0x4aa>
+     879:	48 89 d1             	mov    %rdx,%rcx
+     87c:	ba 86 00 00 00       	mov    $0x86,%edx
+     881:	48 8d 35 40 1e 00 00 	lea    0x1e40(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     888:	89 c7                	mov    %eax,%edi
+     88a:	b8 00 00 00 00       	mov    $0x0,%eax
+     88f:	e8 52 13 00 00       	call   1be6 <printf>
+     894:	90                   	nop
+     895:	eb fd                	jmp    894 <testinvalidargs+0x4f4>
+
+  if (stat("/small.txt", &st) != 0) error("couldn't stat on '/small.txt'");
+     897:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     89b:	48 89 c6             	mov    %rax,%rsi
+     89e:	48 8d 05 c3 1c 00 00 	lea    0x1cc3(%rip),%rax        # 2568 <malloc+0x187>
+     8a5:	48 89 c7             	mov    %rax,%rdi
+     8a8:	e8 df 17 00 00       	call   208c <stat>
+     8ad:	85 c0                	test   %eax,%eax
+     8af:	74 5c                	je     90d <testinvalidargs+0x56d>
+     8b1:	8b 05 39 2a 00 00    	mov    0x2a39(%rip),%eax        # 32f0 <stdout>
+     8b7:	ba 88 00 00 00       	mov    $0x88,%edx
+     8bc:	48 8d 0d 69 1c 00 00 	lea    0x1c69(%rip),%rcx        # 252c <malloc+0x14b>
+     8c3:	48 89 ce             	mov    %rcx,%rsi
+     8c6:	89 c7                	mov    %eax,%edi
+     8c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8cd:	e8 14 13 00 00       	call   1be6 <printf>
+     8d2:	8b 05 18 2a 00 00    	mov    0x2a18(%rip),%eax        # 32f0 <stdout>
+     8d8:	48 8d 15 b9 1f 00 00 	lea    0x1fb9(%rip),%rdx        # 2898 <malloc+0x4b7>
+     8df:	48 89 d6             	mov    %rdx,%rsi
+     8e2:	89 c7                	mov    %eax,%edi
+     8e4:	b8 00 00 00 00       	mov    $0x0,%eax
+     8e9:	e8 f8 12 00 00       	call   1be6 <printf>
+     8ee:	8b 05 fc 29 00 00    	mov    0x29fc(%rip),%eax        # 32f0 <stdout>
+     8f4:	48 8d 15 6b 1c 00 00 	lea    0x1c6b(%rip),%rdx        # 2566 <malloc+0x185>
+     8fb:	48 89 d6             	mov    %rdx,%rsi
+     8fe:	89 c7                	mov    %eax,%edi
+     900:	b8 00 00 00 00       	mov    $0x0,%eax
+     905:	e8 dc 12 00 00       	call   1be6 <printf>
+     90a:	90                   	nop
+     90b:	eb fd                	jmp    90a <testinvalidargs+0x56a>
+
+  assert(st.type == T_FILE);
+     90d:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     911:	66 83 f8 02          	cmp    $0x2,%ax
+     915:	74 2b                	je     942 <testinvalidargs+0x5a2>
+     917:	8b 05 d3 29 00 00    	mov    0x29d3(%rip),%eax        # 32f0 <stdout>
+     91d:	48 8d 15 92 1f 00 00 	lea    0x1f92(%rip),%rdx        # 28b6 <malloc+0x4d5>
+     924:	48 89 d1             	mov    %rdx,%rcx
+     927:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     92c:	48 8d 35 95 1d 00 00 	lea    0x1d95(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     933:	89 c7                	mov    %eax,%edi
+     935:	b8 00 00 00 00       	mov    $0x0,%eax
+     93a:	e8 a7 12 00 00       	call   1be6 <printf>
+     93f:	90                   	nop
+     940:	eb fd                	jmp    93f <testinvalidargs+0x59f>
+  assert(st.size == 26);
+     942:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     945:	83 f8 1a             	cmp    $0x1a,%eax
+     948:	74 2b                	je     975 <testinvalidargs+0x5d5>
+     94a:	8b 05 a0 29 00 00    	mov    0x29a0(%rip),%eax        # 32f0 <stdout>
+     950:	48 8d 15 71 1f 00 00 	lea    0x1f71(%rip),%rdx        # 28c8 <malloc+0x4e7>
+     957:	48 89 d1             	mov    %rdx,%rcx
+     95a:	ba 8b 00 00 00       	mov    $0x8b,%edx
+     95f:	48 8d 35 62 1d 00 00 	lea    0x1d62(%rip),%rsi        # 26c8 <malloc+0x2e7>
+     966:	89 c7                	mov    %eax,%edi
+     968:	b8 00 00 00 00       	mov    $0x0,%eax
+     96d:	e8 74 12 00 00       	call   1be6 <printf>
+     972:	90                   	nop
+     973:	eb fd                	jmp    972 <testinvalidargs+0x5d2>
+
+  printf(stdout, "passed argument checking for fstat\n");
+     975:	8b 05 75 29 00 00    	mov    0x2975(%rip),%eax        # 32f0 <stdout>
+     97b:	48 8d 15 56 1f 00 00 	lea    0x1f56(%rip),%rdx        # 28d8 <malloc+0x4f7>
+     982:	48 89 d6             	mov    %rdx,%rsi
+     985:	89 c7                	mov    %eax,%edi
+     987:	b8 00 00 00 00       	mov    $0x0,%eax
+     98c:	e8 55 12 00 00       	call   1be6 <printf>
+
+  // dup
+  if (dup(15) != -1)
+     991:	bf 0f 00 00 00       	mov    $0xf,%edi
+     996:	e8 6a 18 00 00       	call   2205 <dup>
+     99b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     99e:	74 5c                	je     9fc <testinvalidargs+0x65c>
+    error("able to duplicated a non open file");
+     9a0:	8b 05 4a 29 00 00    	mov    0x294a(%rip),%eax        # 32f0 <stdout>
+     9a6:	ba 91 00 00 00       	mov    $0x91,%edx
+     9ab:	48 8d 0d 7a 1b 00 00 	lea    0x1b7a(%rip),%rcx        # 252c <malloc+0x14b>
+     9b2:	48 89 ce             	mov    %rcx,%rsi
+     9b5:	89 c7                	mov    %eax,%edi
+     9b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9bc:	e8 25 12 00 00       	call   1be6 <printf>
+     9c1:	8b 05 29 29 00 00    	mov    0x2929(%rip),%eax        # 32f0 <stdout>
+     9c7:	48 8d 15 32 1f 00 00 	lea    0x1f32(%rip),%rdx        # 2900 <malloc+0x51f>
+     9ce:	48 89 d6             	mov    %rdx,%rsi
+     9d1:	89 c7                	mov    %eax,%edi
+     9d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d8:	e8 09 12 00 00       	call   1be6 <printf>
+     9dd:	8b 05 0d 29 00 00    	mov    0x290d(%rip),%eax        # 32f0 <stdout>
+     9e3:	48 8d 15 7c 1b 00 00 	lea    0x1b7c(%rip),%rdx        # 2566 <malloc+0x185>
+     9ea:	48 89 d6             	mov    %rdx,%rsi
+     9ed:	89 c7                	mov    %eax,%edi
+     9ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f4:	e8 ed 11 00 00       	call   1be6 <printf>
+     9f9:	90                   	nop
+     9fa:	eb fd                	jmp    9f9 <testinvalidargs+0x659>
+
+  printf(stdout, "passed argument checking for dup\n");
+     9fc:	8b 05 ee 28 00 00    	mov    0x28ee(%rip),%eax        # 32f0 <stdout>
+     a02:	48 8d 15 1f 1f 00 00 	lea    0x1f1f(%rip),%rdx        # 2928 <malloc+0x547>
+     a09:	48 89 d6             	mov    %rdx,%rsi
+     a0c:	89 c7                	mov    %eax,%edi
+     a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a13:	e8 ce 11 00 00       	call   1be6 <printf>
+
+  // close
+  if (close(15) != -1)
+     a18:	bf 0f 00 00 00       	mov    $0xf,%edi
+     a1d:	e8 93 17 00 00       	call   21b5 <close>
+     a22:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a25:	74 5c                	je     a83 <testinvalidargs+0x6e3>
+    error("able to close non open file");
+     a27:	8b 05 c3 28 00 00    	mov    0x28c3(%rip),%eax        # 32f0 <stdout>
+     a2d:	ba 97 00 00 00       	mov    $0x97,%edx
+     a32:	48 8d 0d f3 1a 00 00 	lea    0x1af3(%rip),%rcx        # 252c <malloc+0x14b>
+     a39:	48 89 ce             	mov    %rcx,%rsi
+     a3c:	89 c7                	mov    %eax,%edi
+     a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a43:	e8 9e 11 00 00       	call   1be6 <printf>
+     a48:	8b 05 a2 28 00 00    	mov    0x28a2(%rip),%eax        # 32f0 <stdout>
+     a4e:	48 8d 15 f5 1e 00 00 	lea    0x1ef5(%rip),%rdx        # 294a <malloc+0x569>
+     a55:	48 89 d6             	mov    %rdx,%rsi
+     a58:	89 c7                	mov    %eax,%edi
+     a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     a5f:	e8 82 11 00 00       	call   1be6 <printf>
+     a64:	8b 05 86 28 00 00    	mov    0x2886(%rip),%eax        # 32f0 <stdout>
+     a6a:	48 8d 15 f5 1a 00 00 	lea    0x1af5(%rip),%rdx        # 2566 <malloc+0x185>
+     a71:	48 89 d6             	mov    %rdx,%rsi
+     a74:	89 c7                	mov    %eax,%edi
+     a76:	b8 00 00 00 00       	mov    $0x0,%eax
+     a7b:	e8 66 11 00 00       	call   1be6 <printf>
+     a80:	90                   	nop
+     a81:	eb fd                	jmp    a80 <testinvalidargs+0x6e0>
+
+  if (close(fd) > 0 && close(fd) != -1)
+     a83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a86:	89 c7                	mov    %eax,%edi
+     a88:	e8 28 17 00 00       	call   21b5 <close>
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	7e 6b                	jle    afc <testinvalidargs+0x75c>
+     a91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a94:	89 c7                	mov    %eax,%edi
+     a96:	e8 1a 17 00 00       	call   21b5 <close>
+     a9b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a9e:	74 5c                	je     afc <testinvalidargs+0x75c>
+    error("able to close same file twice");
+     aa0:	8b 05 4a 28 00 00    	mov    0x284a(%rip),%eax        # 32f0 <stdout>
+     aa6:	ba 9a 00 00 00       	mov    $0x9a,%edx
+     aab:	48 8d 0d 7a 1a 00 00 	lea    0x1a7a(%rip),%rcx        # 252c <malloc+0x14b>
+     ab2:	48 89 ce             	mov    %rcx,%rsi
+     ab5:	89 c7                	mov    %eax,%edi
+     ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+     abc:	e8 25 11 00 00       	call   1be6 <printf>
+     ac1:	8b 05 29 28 00 00    	mov    0x2829(%rip),%eax        # 32f0 <stdout>
+     ac7:	48 8d 15 98 1e 00 00 	lea    0x1e98(%rip),%rdx        # 2966 <malloc+0x585>
+     ace:	48 89 d6             	mov    %rdx,%rsi
+     ad1:	89 c7                	mov    %eax,%edi
+     ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad8:	e8 09 11 00 00       	call   1be6 <printf>
+     add:	8b 05 0d 28 00 00    	mov    0x280d(%rip),%eax        # 32f0 <stdout>
+     ae3:	48 8d 15 7c 1a 00 00 	lea    0x1a7c(%rip),%rdx        # 2566 <malloc+0x185>
+     aea:	48 89 d6             	mov    %rdx,%rsi
+     aed:	89 c7                	mov    %eax,%edi
+     aef:	b8 00 00 00 00       	mov    $0x0,%eax
+     af4:	e8 ed 10 00 00       	call   1be6 <printf>
+     af9:	90                   	nop
+     afa:	eb fd                	jmp    af9 <testinvalidargs+0x759>
+
+  printf(stdout, "passed argument checking for close\n");
+     afc:	8b 05 ee 27 00 00    	mov    0x27ee(%rip),%eax        # 32f0 <stdout>
+     b02:	48 8d 15 7f 1e 00 00 	lea    0x1e7f(%rip),%rdx        # 2988 <malloc+0x5a7>
+     b09:	48 89 d6             	mov    %rdx,%rsi
+     b0c:	89 c7                	mov    %eax,%edi
+     b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b13:	e8 ce 10 00 00       	call   1be6 <printf>
+}
+     b18:	90                   	nop
+     b19:	c9                   	leave
+     b1a:	c3                   	ret
+
+0000000000000b1b <smallfilereadtest>:
+
+void smallfilereadtest(void) {
+     b1b:	55                   	push   %rbp
+     b1c:	48 89 e5             	mov    %rsp,%rbp
+     b1f:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i;
+  char buf[11];
+
+  printf(stdout, "small file test\n");
+     b23:	8b 05 c7 27 00 00    	mov    0x27c7(%rip),%eax        # 32f0 <stdout>
+     b29:	48 8d 15 7c 1e 00 00 	lea    0x1e7c(%rip),%rdx        # 29ac <malloc+0x5cb>
+     b30:	48 89 d6             	mov    %rdx,%rsi
+     b33:	89 c7                	mov    %eax,%edi
+     b35:	b8 00 00 00 00       	mov    $0x0,%eax
+     b3a:	e8 a7 10 00 00       	call   1be6 <printf>
+  // Test read only funcionality
+  fd = open("/small.txt", O_RDONLY);
+     b3f:	be 00 00 00 00       	mov    $0x0,%esi
+     b44:	48 8d 05 1d 1a 00 00 	lea    0x1a1d(%rip),%rax        # 2568 <malloc+0x187>
+     b4b:	48 89 c7             	mov    %rax,%rdi
+     b4e:	e8 7a 16 00 00       	call   21cd <open>
+     b53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+     b56:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b5a:	79 5c                	jns    bb8 <smallfilereadtest+0x9d>
+    error("unable to open small file");
+     b5c:	8b 05 8e 27 00 00    	mov    0x278e(%rip),%eax        # 32f0 <stdout>
+     b62:	ba a7 00 00 00       	mov    $0xa7,%edx
+     b67:	48 8d 0d be 19 00 00 	lea    0x19be(%rip),%rcx        # 252c <malloc+0x14b>
+     b6e:	48 89 ce             	mov    %rcx,%rsi
+     b71:	89 c7                	mov    %eax,%edi
+     b73:	b8 00 00 00 00       	mov    $0x0,%eax
+     b78:	e8 69 10 00 00       	call   1be6 <printf>
+     b7d:	8b 05 6d 27 00 00    	mov    0x276d(%rip),%eax        # 32f0 <stdout>
+     b83:	48 8d 15 33 1e 00 00 	lea    0x1e33(%rip),%rdx        # 29bd <malloc+0x5dc>
+     b8a:	48 89 d6             	mov    %rdx,%rsi
+     b8d:	89 c7                	mov    %eax,%edi
+     b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b94:	e8 4d 10 00 00       	call   1be6 <printf>
+     b99:	8b 05 51 27 00 00    	mov    0x2751(%rip),%eax        # 32f0 <stdout>
+     b9f:	48 8d 15 c0 19 00 00 	lea    0x19c0(%rip),%rdx        # 2566 <malloc+0x185>
+     ba6:	48 89 d6             	mov    %rdx,%rsi
+     ba9:	89 c7                	mov    %eax,%edi
+     bab:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb0:	e8 31 10 00 00       	call   1be6 <printf>
+     bb5:	90                   	nop
+     bb6:	eb fd                	jmp    bb5 <smallfilereadtest+0x9a>
+
+  printf(stdout, "open small file succeeded; ok\n");
+     bb8:	8b 05 32 27 00 00    	mov    0x2732(%rip),%eax        # 32f0 <stdout>
+     bbe:	48 8d 15 13 1e 00 00 	lea    0x1e13(%rip),%rdx        # 29d8 <malloc+0x5f7>
+     bc5:	48 89 d6             	mov    %rdx,%rsi
+     bc8:	89 c7                	mov    %eax,%edi
+     bca:	b8 00 00 00 00       	mov    $0x0,%eax
+     bcf:	e8 12 10 00 00       	call   1be6 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     bd4:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     bd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bdb:	ba 0a 00 00 00       	mov    $0xa,%edx
+     be0:	48 89 ce             	mov    %rcx,%rsi
+     be3:	89 c7                	mov    %eax,%edi
+     be5:	e8 bb 15 00 00       	call   21a5 <read>
+     bea:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     bed:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     bf1:	74 5f                	je     c52 <smallfilereadtest+0x137>
+    error("read of first 10 bytes unsucessful was %d bytes", i);
+     bf3:	8b 05 f7 26 00 00    	mov    0x26f7(%rip),%eax        # 32f0 <stdout>
+     bf9:	ba ac 00 00 00       	mov    $0xac,%edx
+     bfe:	48 8d 0d 27 19 00 00 	lea    0x1927(%rip),%rcx        # 252c <malloc+0x14b>
+     c05:	48 89 ce             	mov    %rcx,%rsi
+     c08:	89 c7                	mov    %eax,%edi
+     c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c0f:	e8 d2 0f 00 00       	call   1be6 <printf>
+     c14:	8b 05 d6 26 00 00    	mov    0x26d6(%rip),%eax        # 32f0 <stdout>
+     c1a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     c1d:	48 8d 0d d4 1d 00 00 	lea    0x1dd4(%rip),%rcx        # 29f8 <malloc+0x617>
+     c24:	48 89 ce             	mov    %rcx,%rsi
+     c27:	89 c7                	mov    %eax,%edi
+     c29:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2e:	e8 b3 0f 00 00       	call   1be6 <printf>
+     c33:	8b 05 b7 26 00 00    	mov    0x26b7(%rip),%eax        # 32f0 <stdout>
+     c39:	48 8d 15 26 19 00 00 	lea    0x1926(%rip),%rdx        # 2566 <malloc+0x185>
+     c40:	48 89 d6             	mov    %rdx,%rsi
+     c43:	89 c7                	mov    %eax,%edi
+     c45:	b8 00 00 00 00       	mov    $0x0,%eax
+     c4a:	e8 97 0f 00 00       	call   1be6 <printf>
+     c4f:	90                   	nop
+     c50:	eb fd                	jmp    c4f <smallfilereadtest+0x134>
+
+  buf[10] = 0;
+     c52:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+     c56:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     c5a:	48 8d 15 c7 1d 00 00 	lea    0x1dc7(%rip),%rdx        # 2a28 <malloc+0x647>
+     c61:	48 89 d6             	mov    %rdx,%rsi
+     c64:	48 89 c7             	mov    %rax,%rdi
+     c67:	e8 bb 12 00 00       	call   1f27 <strcmp>
+     c6c:	85 c0                	test   %eax,%eax
+     c6e:	74 60                	je     cd0 <smallfilereadtest+0x1b5>
+    error("buf was not 10 a's, was: '%s'", buf);
+     c70:	8b 05 7a 26 00 00    	mov    0x267a(%rip),%eax        # 32f0 <stdout>
+     c76:	ba b0 00 00 00       	mov    $0xb0,%edx
+     c7b:	48 8d 0d aa 18 00 00 	lea    0x18aa(%rip),%rcx        # 252c <malloc+0x14b>
+     c82:	48 89 ce             	mov    %rcx,%rsi
+     c85:	89 c7                	mov    %eax,%edi
+     c87:	b8 00 00 00 00       	mov    $0x0,%eax
+     c8c:	e8 55 0f 00 00       	call   1be6 <printf>
+     c91:	8b 05 59 26 00 00    	mov    0x2659(%rip),%eax        # 32f0 <stdout>
+     c97:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     c9b:	48 8d 0d 91 1d 00 00 	lea    0x1d91(%rip),%rcx        # 2a33 <malloc+0x652>
+     ca2:	48 89 ce             	mov    %rcx,%rsi
+     ca5:	89 c7                	mov    %eax,%edi
+     ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cac:	e8 35 0f 00 00       	call   1be6 <printf>
+     cb1:	8b 05 39 26 00 00    	mov    0x2639(%rip),%eax        # 32f0 <stdout>
+     cb7:	48 8d 15 a8 18 00 00 	lea    0x18a8(%rip),%rdx        # 2566 <malloc+0x185>
+     cbe:	48 89 d6             	mov    %rdx,%rsi
+     cc1:	89 c7                	mov    %eax,%edi
+     cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc8:	e8 19 0f 00 00       	call   1be6 <printf>
+     ccd:	90                   	nop
+     cce:	eb fd                	jmp    ccd <smallfilereadtest+0x1b2>
+  printf(stdout, "read of first 10 bytes sucessful\n");
+     cd0:	8b 05 1a 26 00 00    	mov    0x261a(%rip),%eax        # 32f0 <stdout>
+     cd6:	48 8d 15 7b 1d 00 00 	lea    0x1d7b(%rip),%rdx        # 2a58 <malloc+0x677>
+     cdd:	48 89 d6             	mov    %rdx,%rsi
+     ce0:	89 c7                	mov    %eax,%edi
+     ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce7:	e8 fa 0e 00 00       	call   1be6 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     cec:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     cf0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cf3:	ba 0a 00 00 00       	mov    $0xa,%edx
+     cf8:	48 89 ce             	mov    %rcx,%rsi
+     cfb:	89 c7                	mov    %eax,%edi
+     cfd:	e8 a3 14 00 00       	call   21a5 <read>
+     d02:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     d05:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     d09:	74 5f                	je     d6a <smallfilereadtest+0x24f>
+    error("read of second 10 bytes unsucessful was %d bytes", i);
+     d0b:	8b 05 df 25 00 00    	mov    0x25df(%rip),%eax        # 32f0 <stdout>
+     d11:	ba b4 00 00 00       	mov    $0xb4,%edx
+     d16:	48 8d 0d 0f 18 00 00 	lea    0x180f(%rip),%rcx        # 252c <malloc+0x14b>
+     d1d:	48 89 ce             	mov    %rcx,%rsi
+     d20:	89 c7                	mov    %eax,%edi
+     d22:	b8 00 00 00 00       	mov    $0x0,%eax
+     d27:	e8 ba 0e 00 00       	call   1be6 <printf>
+     d2c:	8b 05 be 25 00 00    	mov    0x25be(%rip),%eax        # 32f0 <stdout>
+     d32:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     d35:	48 8d 0d 44 1d 00 00 	lea    0x1d44(%rip),%rcx        # 2a80 <malloc+0x69f>
+     d3c:	48 89 ce             	mov    %rcx,%rsi
+     d3f:	89 c7                	mov    %eax,%edi
+     d41:	b8 00 00 00 00       	mov    $0x0,%eax
+     d46:	e8 9b 0e 00 00       	call   1be6 <printf>
+     d4b:	8b 05 9f 25 00 00    	mov    0x259f(%rip),%eax        # 32f0 <stdout>
+     d51:	48 8d 15 0e 18 00 00 	lea    0x180e(%rip),%rdx        # 2566 <malloc+0x185>
+     d58:	48 89 d6             	mov    %rdx,%rsi
+     d5b:	89 c7                	mov    %eax,%edi
+     d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d62:	e8 7f 0e 00 00       	call   1be6 <printf>
+     d67:	90                   	nop
+     d68:	eb fd                	jmp    d67 <smallfilereadtest+0x24c>
+
+  buf[10] = 0;
+     d6a:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+     d6e:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     d72:	48 8d 15 38 1d 00 00 	lea    0x1d38(%rip),%rdx        # 2ab1 <malloc+0x6d0>
+     d79:	48 89 d6             	mov    %rdx,%rsi
+     d7c:	48 89 c7             	mov    %rax,%rdi
+     d7f:	e8 a3 11 00 00       	call   1f27 <strcmp>
+     d84:	85 c0                	test   %eax,%eax
+     d86:	74 60                	je     de8 <smallfilereadtest+0x2cd>
+    error("buf was not 10 b's, was: '%s'", buf);
+     d88:	8b 05 62 25 00 00    	mov    0x2562(%rip),%eax        # 32f0 <stdout>
+     d8e:	ba b8 00 00 00       	mov    $0xb8,%edx
+     d93:	48 8d 0d 92 17 00 00 	lea    0x1792(%rip),%rcx        # 252c <malloc+0x14b>
+     d9a:	48 89 ce             	mov    %rcx,%rsi
+     d9d:	89 c7                	mov    %eax,%edi
+     d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+     da4:	e8 3d 0e 00 00       	call   1be6 <printf>
+     da9:	8b 05 41 25 00 00    	mov    0x2541(%rip),%eax        # 32f0 <stdout>
+     daf:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     db3:	48 8d 0d 02 1d 00 00 	lea    0x1d02(%rip),%rcx        # 2abc <malloc+0x6db>
+     dba:	48 89 ce             	mov    %rcx,%rsi
+     dbd:	89 c7                	mov    %eax,%edi
+     dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc4:	e8 1d 0e 00 00       	call   1be6 <printf>
+     dc9:	8b 05 21 25 00 00    	mov    0x2521(%rip),%eax        # 32f0 <stdout>
+     dcf:	48 8d 15 90 17 00 00 	lea    0x1790(%rip),%rdx        # 2566 <malloc+0x185>
+     dd6:	48 89 d6             	mov    %rdx,%rsi
+     dd9:	89 c7                	mov    %eax,%edi
+     ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+     de0:	e8 01 0e 00 00       	call   1be6 <printf>
+     de5:	90                   	nop
+     de6:	eb fd                	jmp    de5 <smallfilereadtest+0x2ca>
+  printf(stdout, "read of second 10 bytes sucessful\n");
+     de8:	8b 05 02 25 00 00    	mov    0x2502(%rip),%eax        # 32f0 <stdout>
+     dee:	48 8d 15 eb 1c 00 00 	lea    0x1ceb(%rip),%rdx        # 2ae0 <malloc+0x6ff>
+     df5:	48 89 d6             	mov    %rdx,%rsi
+     df8:	89 c7                	mov    %eax,%edi
+     dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+     dff:	e8 e2 0d 00 00       	call   1be6 <printf>
+
+  // only 25 byte file
+  if ((i = read(fd, buf, 10)) != 6)
+     e04:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     e08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e0b:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e10:	48 89 ce             	mov    %rcx,%rsi
+     e13:	89 c7                	mov    %eax,%edi
+     e15:	e8 8b 13 00 00       	call   21a5 <read>
+     e1a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     e1d:	83 7d f8 06          	cmpl   $0x6,-0x8(%rbp)
+     e21:	74 5f                	je     e82 <smallfilereadtest+0x367>
+    error("read of last 6 bytes unsucessful was %d bytes", i);
+     e23:	8b 05 c7 24 00 00    	mov    0x24c7(%rip),%eax        # 32f0 <stdout>
+     e29:	ba bd 00 00 00       	mov    $0xbd,%edx
+     e2e:	48 8d 0d f7 16 00 00 	lea    0x16f7(%rip),%rcx        # 252c <malloc+0x14b>
+     e35:	48 89 ce             	mov    %rcx,%rsi
+     e38:	89 c7                	mov    %eax,%edi
+     e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e3f:	e8 a2 0d 00 00       	call   1be6 <printf>
+     e44:	8b 05 a6 24 00 00    	mov    0x24a6(%rip),%eax        # 32f0 <stdout>
+     e4a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     e4d:	48 8d 0d b4 1c 00 00 	lea    0x1cb4(%rip),%rcx        # 2b08 <malloc+0x727>
+     e54:	48 89 ce             	mov    %rcx,%rsi
+     e57:	89 c7                	mov    %eax,%edi
+     e59:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5e:	e8 83 0d 00 00       	call   1be6 <printf>
+     e63:	8b 05 87 24 00 00    	mov    0x2487(%rip),%eax        # 32f0 <stdout>
+     e69:	48 8d 15 f6 16 00 00 	lea    0x16f6(%rip),%rdx        # 2566 <malloc+0x185>
+     e70:	48 89 d6             	mov    %rdx,%rsi
+     e73:	89 c7                	mov    %eax,%edi
+     e75:	b8 00 00 00 00       	mov    $0x0,%eax
+     e7a:	e8 67 0d 00 00       	call   1be6 <printf>
+     e7f:	90                   	nop
+     e80:	eb fd                	jmp    e7f <smallfilereadtest+0x364>
+
+  buf[6] = 0;
+     e82:	c6 45 f3 00          	movb   $0x0,-0xd(%rbp)
+  if (strcmp(buf, "ccccc\n") != 0)
+     e86:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     e8a:	48 8d 15 a5 1c 00 00 	lea    0x1ca5(%rip),%rdx        # 2b36 <malloc+0x755>
+     e91:	48 89 d6             	mov    %rdx,%rsi
+     e94:	48 89 c7             	mov    %rax,%rdi
+     e97:	e8 8b 10 00 00       	call   1f27 <strcmp>
+     e9c:	85 c0                	test   %eax,%eax
+     e9e:	74 60                	je     f00 <smallfilereadtest+0x3e5>
+    error("buf was not 5 c's (and a newline), was: '%s'", buf);
+     ea0:	8b 05 4a 24 00 00    	mov    0x244a(%rip),%eax        # 32f0 <stdout>
+     ea6:	ba c1 00 00 00       	mov    $0xc1,%edx
+     eab:	48 8d 0d 7a 16 00 00 	lea    0x167a(%rip),%rcx        # 252c <malloc+0x14b>
+     eb2:	48 89 ce             	mov    %rcx,%rsi
+     eb5:	89 c7                	mov    %eax,%edi
+     eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebc:	e8 25 0d 00 00       	call   1be6 <printf>
+     ec1:	8b 05 29 24 00 00    	mov    0x2429(%rip),%eax        # 32f0 <stdout>
+     ec7:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     ecb:	48 8d 0d 6e 1c 00 00 	lea    0x1c6e(%rip),%rcx        # 2b40 <malloc+0x75f>
+     ed2:	48 89 ce             	mov    %rcx,%rsi
+     ed5:	89 c7                	mov    %eax,%edi
+     ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+     edc:	e8 05 0d 00 00       	call   1be6 <printf>
+     ee1:	8b 05 09 24 00 00    	mov    0x2409(%rip),%eax        # 32f0 <stdout>
+     ee7:	48 8d 15 78 16 00 00 	lea    0x1678(%rip),%rdx        # 2566 <malloc+0x185>
+     eee:	48 89 d6             	mov    %rdx,%rsi
+     ef1:	89 c7                	mov    %eax,%edi
+     ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef8:	e8 e9 0c 00 00       	call   1be6 <printf>
+     efd:	90                   	nop
+     efe:	eb fd                	jmp    efd <smallfilereadtest+0x3e2>
+
+  printf(stdout, "read of last 5 bytes sucessful\n");
+     f00:	8b 05 ea 23 00 00    	mov    0x23ea(%rip),%eax        # 32f0 <stdout>
+     f06:	48 8d 15 63 1c 00 00 	lea    0x1c63(%rip),%rdx        # 2b70 <malloc+0x78f>
+     f0d:	48 89 d6             	mov    %rdx,%rsi
+     f10:	89 c7                	mov    %eax,%edi
+     f12:	b8 00 00 00 00       	mov    $0x0,%eax
+     f17:	e8 ca 0c 00 00       	call   1be6 <printf>
+
+  if (read(fd, buf, 10) != 0)
+     f1c:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     f20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f23:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f28:	48 89 ce             	mov    %rcx,%rsi
+     f2b:	89 c7                	mov    %eax,%edi
+     f2d:	e8 73 12 00 00       	call   21a5 <read>
+     f32:	85 c0                	test   %eax,%eax
+     f34:	74 5c                	je     f92 <smallfilereadtest+0x477>
+    error("read more bytes than should be possible");
+     f36:	8b 05 b4 23 00 00    	mov    0x23b4(%rip),%eax        # 32f0 <stdout>
+     f3c:	ba c6 00 00 00       	mov    $0xc6,%edx
+     f41:	48 8d 0d e4 15 00 00 	lea    0x15e4(%rip),%rcx        # 252c <malloc+0x14b>
+     f48:	48 89 ce             	mov    %rcx,%rsi
+     f4b:	89 c7                	mov    %eax,%edi
+     f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f52:	e8 8f 0c 00 00       	call   1be6 <printf>
+     f57:	8b 05 93 23 00 00    	mov    0x2393(%rip),%eax        # 32f0 <stdout>
+     f5d:	48 8d 15 2c 1c 00 00 	lea    0x1c2c(%rip),%rdx        # 2b90 <malloc+0x7af>
+     f64:	48 89 d6             	mov    %rdx,%rsi
+     f67:	89 c7                	mov    %eax,%edi
+     f69:	b8 00 00 00 00       	mov    $0x0,%eax
+     f6e:	e8 73 0c 00 00       	call   1be6 <printf>
+     f73:	8b 05 77 23 00 00    	mov    0x2377(%rip),%eax        # 32f0 <stdout>
+     f79:	48 8d 15 e6 15 00 00 	lea    0x15e6(%rip),%rdx        # 2566 <malloc+0x185>
+     f80:	48 89 d6             	mov    %rdx,%rsi
+     f83:	89 c7                	mov    %eax,%edi
+     f85:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8a:	e8 57 0c 00 00       	call   1be6 <printf>
+     f8f:	90                   	nop
+     f90:	eb fd                	jmp    f8f <smallfilereadtest+0x474>
+
+  strcpy(buf, "stdout\n");
+     f92:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     f96:	48 8d 15 1b 1c 00 00 	lea    0x1c1b(%rip),%rdx        # 2bb8 <malloc+0x7d7>
+     f9d:	48 89 d6             	mov    %rdx,%rsi
+     fa0:	48 89 c7             	mov    %rax,%rdi
+     fa3:	e8 40 0f 00 00       	call   1ee8 <strcpy>
+
+  if ((i = write(stdout, buf, 7)) != 7)
+     fa8:	8b 05 42 23 00 00    	mov    0x2342(%rip),%eax        # 32f0 <stdout>
+     fae:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     fb2:	ba 07 00 00 00       	mov    $0x7,%edx
+     fb7:	48 89 ce             	mov    %rcx,%rsi
+     fba:	89 c7                	mov    %eax,%edi
+     fbc:	e8 ec 11 00 00       	call   21ad <write>
+     fc1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     fc4:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+     fc8:	74 5f                	je     1029 <smallfilereadtest+0x50e>
+    error("wasn't able to write to stdout, return value was '%d'", i);
+     fca:	8b 05 20 23 00 00    	mov    0x2320(%rip),%eax        # 32f0 <stdout>
+     fd0:	ba cb 00 00 00       	mov    $0xcb,%edx
+     fd5:	48 8d 0d 50 15 00 00 	lea    0x1550(%rip),%rcx        # 252c <malloc+0x14b>
+     fdc:	48 89 ce             	mov    %rcx,%rsi
+     fdf:	89 c7                	mov    %eax,%edi
+     fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe6:	e8 fb 0b 00 00       	call   1be6 <printf>
+     feb:	8b 05 ff 22 00 00    	mov    0x22ff(%rip),%eax        # 32f0 <stdout>
+     ff1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     ff4:	48 8d 0d c5 1b 00 00 	lea    0x1bc5(%rip),%rcx        # 2bc0 <malloc+0x7df>
+     ffb:	48 89 ce             	mov    %rcx,%rsi
+     ffe:	89 c7                	mov    %eax,%edi
+    1000:	b8 00 00 00 00       	mov    $0x0,%eax
+    1005:	e8 dc 0b 00 00       	call   1be6 <printf>
+    100a:	8b 05 e0 22 00 00    	mov    0x22e0(%rip),%eax        # 32f0 <stdout>
+    1010:	48 8d 15 4f 15 00 00 	lea    0x154f(%rip),%rdx        # 2566 <malloc+0x185>
+    1017:	48 89 d6             	mov    %rdx,%rsi
+    101a:	89 c7                	mov    %eax,%edi
+    101c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1021:	e8 c0 0b 00 00       	call   1be6 <printf>
+    1026:	90                   	nop
+    1027:	eb fd                	jmp    1026 <smallfilereadtest+0x50b>
+
+  printf(stdout, "write to stdout directly ok\n");
+    1029:	8b 05 c1 22 00 00    	mov    0x22c1(%rip),%eax        # 32f0 <stdout>
+    102f:	48 8d 15 c0 1b 00 00 	lea    0x1bc0(%rip),%rdx        # 2bf6 <malloc+0x815>
+    1036:	48 89 d6             	mov    %rdx,%rsi
+    1039:	89 c7                	mov    %eax,%edi
+    103b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1040:	e8 a1 0b 00 00       	call   1be6 <printf>
+
+  if (close(fd) != 0)
+    1045:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1048:	89 c7                	mov    %eax,%edi
+    104a:	e8 66 11 00 00       	call   21b5 <close>
+    104f:	85 c0                	test   %eax,%eax
+    1051:	74 5c                	je     10af <smallfilereadtest+0x594>
+    error("error closing fd");
+    1053:	8b 05 97 22 00 00    	mov    0x2297(%rip),%eax        # 32f0 <stdout>
+    1059:	ba d0 00 00 00       	mov    $0xd0,%edx
+    105e:	48 8d 0d c7 14 00 00 	lea    0x14c7(%rip),%rcx        # 252c <malloc+0x14b>
+    1065:	48 89 ce             	mov    %rcx,%rsi
+    1068:	89 c7                	mov    %eax,%edi
+    106a:	b8 00 00 00 00       	mov    $0x0,%eax
+    106f:	e8 72 0b 00 00       	call   1be6 <printf>
+    1074:	8b 05 76 22 00 00    	mov    0x2276(%rip),%eax        # 32f0 <stdout>
+    107a:	48 8d 15 92 1b 00 00 	lea    0x1b92(%rip),%rdx        # 2c13 <malloc+0x832>
+    1081:	48 89 d6             	mov    %rdx,%rsi
+    1084:	89 c7                	mov    %eax,%edi
+    1086:	b8 00 00 00 00       	mov    $0x0,%eax
+    108b:	e8 56 0b 00 00       	call   1be6 <printf>
+    1090:	8b 05 5a 22 00 00    	mov    0x225a(%rip),%eax        # 32f0 <stdout>
+    1096:	48 8d 15 c9 14 00 00 	lea    0x14c9(%rip),%rdx        # 2566 <malloc+0x185>
+    109d:	48 89 d6             	mov    %rdx,%rsi
+    10a0:	89 c7                	mov    %eax,%edi
+    10a2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10a7:	e8 3a 0b 00 00       	call   1be6 <printf>
+    10ac:	90                   	nop
+    10ad:	eb fd                	jmp    10ac <smallfilereadtest+0x591>
+
+  printf(stdout, "small file test ok\n");
+    10af:	8b 05 3b 22 00 00    	mov    0x223b(%rip),%eax        # 32f0 <stdout>
+    10b5:	48 8d 15 68 1b 00 00 	lea    0x1b68(%rip),%rdx        # 2c24 <malloc+0x843>
+    10bc:	48 89 d6             	mov    %rdx,%rsi
+    10bf:	89 c7                	mov    %eax,%edi
+    10c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c6:	e8 1b 0b 00 00       	call   1be6 <printf>
+}
+    10cb:	90                   	nop
+    10cc:	c9                   	leave
+    10cd:	c3                   	ret
+
+00000000000010ce <duptest>:
+
+void duptest(void) {
+    10ce:	55                   	push   %rbp
+    10cf:	48 89 e5             	mov    %rsp,%rbp
+    10d2:	53                   	push   %rbx
+    10d3:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  int fd1, fd2, stdout_cpy;
+  char buf[100];
+
+  printf(stdout, "dup test\n");
+    10da:	8b 05 10 22 00 00    	mov    0x2210(%rip),%eax        # 32f0 <stdout>
+    10e0:	48 8d 15 51 1b 00 00 	lea    0x1b51(%rip),%rdx        # 2c38 <malloc+0x857>
+    10e7:	48 89 d6             	mov    %rdx,%rsi
+    10ea:	89 c7                	mov    %eax,%edi
+    10ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f1:	e8 f0 0a 00 00       	call   1be6 <printf>
+  // Test read only funcionality
+  fd1 = open("/small.txt", O_RDONLY);
+    10f6:	be 00 00 00 00       	mov    $0x0,%esi
+    10fb:	48 8d 05 66 14 00 00 	lea    0x1466(%rip),%rax        # 2568 <malloc+0x187>
+    1102:	48 89 c7             	mov    %rax,%rdi
+    1105:	e8 c3 10 00 00       	call   21cd <open>
+    110a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd1 < 0)
+    110d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1111:	79 5c                	jns    116f <duptest+0xa1>
+    error("unable to open small file");
+    1113:	8b 05 d7 21 00 00    	mov    0x21d7(%rip),%eax        # 32f0 <stdout>
+    1119:	ba dd 00 00 00       	mov    $0xdd,%edx
+    111e:	48 8d 0d 07 14 00 00 	lea    0x1407(%rip),%rcx        # 252c <malloc+0x14b>
+    1125:	48 89 ce             	mov    %rcx,%rsi
+    1128:	89 c7                	mov    %eax,%edi
+    112a:	b8 00 00 00 00       	mov    $0x0,%eax
+    112f:	e8 b2 0a 00 00       	call   1be6 <printf>
+    1134:	8b 05 b6 21 00 00    	mov    0x21b6(%rip),%eax        # 32f0 <stdout>
+    113a:	48 8d 15 7c 18 00 00 	lea    0x187c(%rip),%rdx        # 29bd <malloc+0x5dc>
+    1141:	48 89 d6             	mov    %rdx,%rsi
+    1144:	89 c7                	mov    %eax,%edi
+    1146:	b8 00 00 00 00       	mov    $0x0,%eax
+    114b:	e8 96 0a 00 00       	call   1be6 <printf>
+    1150:	8b 05 9a 21 00 00    	mov    0x219a(%rip),%eax        # 32f0 <stdout>
+    1156:	48 8d 15 09 14 00 00 	lea    0x1409(%rip),%rdx        # 2566 <malloc+0x185>
+    115d:	48 89 d6             	mov    %rdx,%rsi
+    1160:	89 c7                	mov    %eax,%edi
+    1162:	b8 00 00 00 00       	mov    $0x0,%eax
+    1167:	e8 7a 0a 00 00       	call   1be6 <printf>
+    116c:	90                   	nop
+    116d:	eb fd                	jmp    116c <duptest+0x9e>
+
+  if ((fd2 = dup(fd1)) != fd1 + 1)
+    116f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1172:	89 c7                	mov    %eax,%edi
+    1174:	e8 8c 10 00 00       	call   2205 <dup>
+    1179:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    117c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    117f:	83 c0 01             	add    $0x1,%eax
+    1182:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+    1185:	74 5f                	je     11e6 <duptest+0x118>
+    error("returned fd from dup was not the smallest free fd, was '%d'", fd2);
+    1187:	8b 05 63 21 00 00    	mov    0x2163(%rip),%eax        # 32f0 <stdout>
+    118d:	ba e0 00 00 00       	mov    $0xe0,%edx
+    1192:	48 8d 0d 93 13 00 00 	lea    0x1393(%rip),%rcx        # 252c <malloc+0x14b>
+    1199:	48 89 ce             	mov    %rcx,%rsi
+    119c:	89 c7                	mov    %eax,%edi
+    119e:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a3:	e8 3e 0a 00 00       	call   1be6 <printf>
+    11a8:	8b 05 42 21 00 00    	mov    0x2142(%rip),%eax        # 32f0 <stdout>
+    11ae:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    11b1:	48 8d 0d 90 1a 00 00 	lea    0x1a90(%rip),%rcx        # 2c48 <malloc+0x867>
+    11b8:	48 89 ce             	mov    %rcx,%rsi
+    11bb:	89 c7                	mov    %eax,%edi
+    11bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c2:	e8 1f 0a 00 00       	call   1be6 <printf>
+    11c7:	8b 05 23 21 00 00    	mov    0x2123(%rip),%eax        # 32f0 <stdout>
+    11cd:	48 8d 15 92 13 00 00 	lea    0x1392(%rip),%rdx        # 2566 <malloc+0x185>
+    11d4:	48 89 d6             	mov    %rdx,%rsi
+    11d7:	89 c7                	mov    %eax,%edi
+    11d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    11de:	e8 03 0a 00 00       	call   1be6 <printf>
+    11e3:	90                   	nop
+    11e4:	eb fd                	jmp    11e3 <duptest+0x115>
+
+  // test offsets are respected in dupped files
+  assert(read(fd1, buf, 10) == 10);
+    11e6:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    11ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11f0:	ba 0a 00 00 00       	mov    $0xa,%edx
+    11f5:	48 89 ce             	mov    %rcx,%rsi
+    11f8:	89 c7                	mov    %eax,%edi
+    11fa:	e8 a6 0f 00 00       	call   21a5 <read>
+    11ff:	83 f8 0a             	cmp    $0xa,%eax
+    1202:	74 2b                	je     122f <duptest+0x161>
+    1204:	8b 05 e6 20 00 00    	mov    0x20e6(%rip),%eax        # 32f0 <stdout>
+    120a:	48 8d 15 73 1a 00 00 	lea    0x1a73(%rip),%rdx        # 2c84 <malloc+0x8a3>
+    1211:	48 89 d1             	mov    %rdx,%rcx
+    1214:	ba e3 00 00 00       	mov    $0xe3,%edx
+    1219:	48 8d 35 a8 14 00 00 	lea    0x14a8(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    1220:	89 c7                	mov    %eax,%edi
+    1222:	b8 00 00 00 00       	mov    $0x0,%eax
+    1227:	e8 ba 09 00 00       	call   1be6 <printf>
+    122c:	90                   	nop
+    122d:	eb fd                	jmp    122c <duptest+0x15e>
+  buf[10] = 0;
+    122f:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+    1236:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    123d:	48 8d 15 e4 17 00 00 	lea    0x17e4(%rip),%rdx        # 2a28 <malloc+0x647>
+    1244:	48 89 d6             	mov    %rdx,%rsi
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 d8 0c 00 00       	call   1f27 <strcmp>
+    124f:	85 c0                	test   %eax,%eax
+    1251:	74 5c                	je     12af <duptest+0x1e1>
+    error("couldn't read from original fd after dup");
+    1253:	8b 05 97 20 00 00    	mov    0x2097(%rip),%eax        # 32f0 <stdout>
+    1259:	ba e7 00 00 00       	mov    $0xe7,%edx
+    125e:	48 8d 0d c7 12 00 00 	lea    0x12c7(%rip),%rcx        # 252c <malloc+0x14b>
+    1265:	48 89 ce             	mov    %rcx,%rsi
+    1268:	89 c7                	mov    %eax,%edi
+    126a:	b8 00 00 00 00       	mov    $0x0,%eax
+    126f:	e8 72 09 00 00       	call   1be6 <printf>
+    1274:	8b 05 76 20 00 00    	mov    0x2076(%rip),%eax        # 32f0 <stdout>
+    127a:	48 8d 15 1f 1a 00 00 	lea    0x1a1f(%rip),%rdx        # 2ca0 <malloc+0x8bf>
+    1281:	48 89 d6             	mov    %rdx,%rsi
+    1284:	89 c7                	mov    %eax,%edi
+    1286:	b8 00 00 00 00       	mov    $0x0,%eax
+    128b:	e8 56 09 00 00       	call   1be6 <printf>
+    1290:	8b 05 5a 20 00 00    	mov    0x205a(%rip),%eax        # 32f0 <stdout>
+    1296:	48 8d 15 c9 12 00 00 	lea    0x12c9(%rip),%rdx        # 2566 <malloc+0x185>
+    129d:	48 89 d6             	mov    %rdx,%rsi
+    12a0:	89 c7                	mov    %eax,%edi
+    12a2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a7:	e8 3a 09 00 00       	call   1be6 <printf>
+    12ac:	90                   	nop
+    12ad:	eb fd                	jmp    12ac <duptest+0x1de>
+
+  if (read(fd2, buf, 10) != 10)
+    12af:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    12b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    12b9:	ba 0a 00 00 00       	mov    $0xa,%edx
+    12be:	48 89 ce             	mov    %rcx,%rsi
+    12c1:	89 c7                	mov    %eax,%edi
+    12c3:	e8 dd 0e 00 00       	call   21a5 <read>
+    12c8:	83 f8 0a             	cmp    $0xa,%eax
+    12cb:	74 5c                	je     1329 <duptest+0x25b>
+    error("coudn't read from the dupped fd");
+    12cd:	8b 05 1d 20 00 00    	mov    0x201d(%rip),%eax        # 32f0 <stdout>
+    12d3:	ba ea 00 00 00       	mov    $0xea,%edx
+    12d8:	48 8d 0d 4d 12 00 00 	lea    0x124d(%rip),%rcx        # 252c <malloc+0x14b>
+    12df:	48 89 ce             	mov    %rcx,%rsi
+    12e2:	89 c7                	mov    %eax,%edi
+    12e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e9:	e8 f8 08 00 00       	call   1be6 <printf>
+    12ee:	8b 05 fc 1f 00 00    	mov    0x1ffc(%rip),%eax        # 32f0 <stdout>
+    12f4:	48 8d 15 d5 19 00 00 	lea    0x19d5(%rip),%rdx        # 2cd0 <malloc+0x8ef>
+    12fb:	48 89 d6             	mov    %rdx,%rsi
+    12fe:	89 c7                	mov    %eax,%edi
+    1300:	b8 00 00 00 00       	mov    $0x0,%eax
+    1305:	e8 dc 08 00 00       	call   1be6 <printf>
+    130a:	8b 05 e0 1f 00 00    	mov    0x1fe0(%rip),%eax        # 32f0 <stdout>
+    1310:	48 8d 15 4f 12 00 00 	lea    0x124f(%rip),%rdx        # 2566 <malloc+0x185>
+    1317:	48 89 d6             	mov    %rdx,%rsi
+    131a:	89 c7                	mov    %eax,%edi
+    131c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1321:	e8 c0 08 00 00       	call   1be6 <printf>
+    1326:	90                   	nop
+    1327:	eb fd                	jmp    1326 <duptest+0x258>
+  buf[10] = 0;
+    1329:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") == 0)
+    1330:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1337:	48 8d 15 ea 16 00 00 	lea    0x16ea(%rip),%rdx        # 2a28 <malloc+0x647>
+    133e:	48 89 d6             	mov    %rdx,%rsi
+    1341:	48 89 c7             	mov    %rax,%rdi
+    1344:	e8 de 0b 00 00       	call   1f27 <strcmp>
+    1349:	85 c0                	test   %eax,%eax
+    134b:	75 5c                	jne    13a9 <duptest+0x2db>
+    error("the duped fd didn't respect the read offset from the other file.");
+    134d:	8b 05 9d 1f 00 00    	mov    0x1f9d(%rip),%eax        # 32f0 <stdout>
+    1353:	ba ee 00 00 00       	mov    $0xee,%edx
+    1358:	48 8d 0d cd 11 00 00 	lea    0x11cd(%rip),%rcx        # 252c <malloc+0x14b>
+    135f:	48 89 ce             	mov    %rcx,%rsi
+    1362:	89 c7                	mov    %eax,%edi
+    1364:	b8 00 00 00 00       	mov    $0x0,%eax
+    1369:	e8 78 08 00 00       	call   1be6 <printf>
+    136e:	8b 05 7c 1f 00 00    	mov    0x1f7c(%rip),%eax        # 32f0 <stdout>
+    1374:	48 8d 15 75 19 00 00 	lea    0x1975(%rip),%rdx        # 2cf0 <malloc+0x90f>
+    137b:	48 89 d6             	mov    %rdx,%rsi
+    137e:	89 c7                	mov    %eax,%edi
+    1380:	b8 00 00 00 00       	mov    $0x0,%eax
+    1385:	e8 5c 08 00 00       	call   1be6 <printf>
+    138a:	8b 05 60 1f 00 00    	mov    0x1f60(%rip),%eax        # 32f0 <stdout>
+    1390:	48 8d 15 cf 11 00 00 	lea    0x11cf(%rip),%rdx        # 2566 <malloc+0x185>
+    1397:	48 89 d6             	mov    %rdx,%rsi
+    139a:	89 c7                	mov    %eax,%edi
+    139c:	b8 00 00 00 00       	mov    $0x0,%eax
+    13a1:	e8 40 08 00 00       	call   1be6 <printf>
+    13a6:	90                   	nop
+    13a7:	eb fd                	jmp    13a6 <duptest+0x2d8>
+
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+    13a9:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    13b0:	48 8d 15 fa 16 00 00 	lea    0x16fa(%rip),%rdx        # 2ab1 <malloc+0x6d0>
+    13b7:	48 89 d6             	mov    %rdx,%rsi
+    13ba:	48 89 c7             	mov    %rax,%rdi
+    13bd:	e8 65 0b 00 00       	call   1f27 <strcmp>
+    13c2:	85 c0                	test   %eax,%eax
+    13c4:	74 5c                	je     1422 <duptest+0x354>
+    error(
+    13c6:	8b 05 24 1f 00 00    	mov    0x1f24(%rip),%eax        # 32f0 <stdout>
+    13cc:	ba f1 00 00 00       	mov    $0xf1,%edx
+    13d1:	48 8d 0d 54 11 00 00 	lea    0x1154(%rip),%rcx        # 252c <malloc+0x14b>
+    13d8:	48 89 ce             	mov    %rcx,%rsi
+    13db:	89 c7                	mov    %eax,%edi
+    13dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e2:	e8 ff 07 00 00       	call   1be6 <printf>
+    13e7:	8b 05 03 1f 00 00    	mov    0x1f03(%rip),%eax        # 32f0 <stdout>
+    13ed:	48 8d 15 44 19 00 00 	lea    0x1944(%rip),%rdx        # 2d38 <malloc+0x957>
+    13f4:	48 89 d6             	mov    %rdx,%rsi
+    13f7:	89 c7                	mov    %eax,%edi
+    13f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fe:	e8 e3 07 00 00       	call   1be6 <printf>
+    1403:	8b 05 e7 1e 00 00    	mov    0x1ee7(%rip),%eax        # 32f0 <stdout>
+    1409:	48 8d 15 56 11 00 00 	lea    0x1156(%rip),%rdx        # 2566 <malloc+0x185>
+    1410:	48 89 d6             	mov    %rdx,%rsi
+    1413:	89 c7                	mov    %eax,%edi
+    1415:	b8 00 00 00 00       	mov    $0x0,%eax
+    141a:	e8 c7 07 00 00       	call   1be6 <printf>
+    141f:	90                   	nop
+    1420:	eb fd                	jmp    141f <duptest+0x351>
+        "the duped fd didn't read the correct 10 bytes at the 10 byte offset");
+
+  if (close(fd1) != 0)
+    1422:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1425:	89 c7                	mov    %eax,%edi
+    1427:	e8 89 0d 00 00       	call   21b5 <close>
+    142c:	85 c0                	test   %eax,%eax
+    142e:	74 5c                	je     148c <duptest+0x3be>
+    error("closing the original file");
+    1430:	8b 05 ba 1e 00 00    	mov    0x1eba(%rip),%eax        # 32f0 <stdout>
+    1436:	ba f5 00 00 00       	mov    $0xf5,%edx
+    143b:	48 8d 0d ea 10 00 00 	lea    0x10ea(%rip),%rcx        # 252c <malloc+0x14b>
+    1442:	48 89 ce             	mov    %rcx,%rsi
+    1445:	89 c7                	mov    %eax,%edi
+    1447:	b8 00 00 00 00       	mov    $0x0,%eax
+    144c:	e8 95 07 00 00       	call   1be6 <printf>
+    1451:	8b 05 99 1e 00 00    	mov    0x1e99(%rip),%eax        # 32f0 <stdout>
+    1457:	48 8d 15 1e 19 00 00 	lea    0x191e(%rip),%rdx        # 2d7c <malloc+0x99b>
+    145e:	48 89 d6             	mov    %rdx,%rsi
+    1461:	89 c7                	mov    %eax,%edi
+    1463:	b8 00 00 00 00       	mov    $0x0,%eax
+    1468:	e8 79 07 00 00       	call   1be6 <printf>
+    146d:	8b 05 7d 1e 00 00    	mov    0x1e7d(%rip),%eax        # 32f0 <stdout>
+    1473:	48 8d 15 ec 10 00 00 	lea    0x10ec(%rip),%rdx        # 2566 <malloc+0x185>
+    147a:	48 89 d6             	mov    %rdx,%rsi
+    147d:	89 c7                	mov    %eax,%edi
+    147f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1484:	e8 5d 07 00 00       	call   1be6 <printf>
+    1489:	90                   	nop
+    148a:	eb fd                	jmp    1489 <duptest+0x3bb>
+
+  if (read(fd2, buf, 5) != 5)
+    148c:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    1493:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1496:	ba 05 00 00 00       	mov    $0x5,%edx
+    149b:	48 89 ce             	mov    %rcx,%rsi
+    149e:	89 c7                	mov    %eax,%edi
+    14a0:	e8 00 0d 00 00       	call   21a5 <read>
+    14a5:	83 f8 05             	cmp    $0x5,%eax
+    14a8:	74 5c                	je     1506 <duptest+0x438>
+    error("wasn't able to read from the duped file after the original file was "
+    14aa:	8b 05 40 1e 00 00    	mov    0x1e40(%rip),%eax        # 32f0 <stdout>
+    14b0:	ba f8 00 00 00       	mov    $0xf8,%edx
+    14b5:	48 8d 0d 70 10 00 00 	lea    0x1070(%rip),%rcx        # 252c <malloc+0x14b>
+    14bc:	48 89 ce             	mov    %rcx,%rsi
+    14bf:	89 c7                	mov    %eax,%edi
+    14c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    14c6:	e8 1b 07 00 00       	call   1be6 <printf>
+    14cb:	8b 05 1f 1e 00 00    	mov    0x1e1f(%rip),%eax        # 32f0 <stdout>
+    14d1:	48 8d 15 c0 18 00 00 	lea    0x18c0(%rip),%rdx        # 2d98 <malloc+0x9b7>
+    14d8:	48 89 d6             	mov    %rdx,%rsi
+    14db:	89 c7                	mov    %eax,%edi
+    14dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    14e2:	e8 ff 06 00 00       	call   1be6 <printf>
+    14e7:	8b 05 03 1e 00 00    	mov    0x1e03(%rip),%eax        # 32f0 <stdout>
+    14ed:	48 8d 15 72 10 00 00 	lea    0x1072(%rip),%rdx        # 2566 <malloc+0x185>
+    14f4:	48 89 d6             	mov    %rdx,%rsi
+    14f7:	89 c7                	mov    %eax,%edi
+    14f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    14fe:	e8 e3 06 00 00       	call   1be6 <printf>
+    1503:	90                   	nop
+    1504:	eb fd                	jmp    1503 <duptest+0x435>
+          "closed");
+
+  buf[5] = 0;
+    1506:	c6 85 79 ff ff ff 00 	movb   $0x0,-0x87(%rbp)
+  assert(strcmp(buf, "ccccc") == 0);
+    150d:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1514:	48 8d 15 c8 18 00 00 	lea    0x18c8(%rip),%rdx        # 2de3 <malloc+0xa02>
+    151b:	48 89 d6             	mov    %rdx,%rsi
+    151e:	48 89 c7             	mov    %rax,%rdi
+    1521:	e8 01 0a 00 00       	call   1f27 <strcmp>
+    1526:	85 c0                	test   %eax,%eax
+    1528:	74 2b                	je     1555 <duptest+0x487>
+    152a:	8b 05 c0 1d 00 00    	mov    0x1dc0(%rip),%eax        # 32f0 <stdout>
+    1530:	48 8d 15 b2 18 00 00 	lea    0x18b2(%rip),%rdx        # 2de9 <malloc+0xa08>
+    1537:	48 89 d1             	mov    %rdx,%rcx
+    153a:	ba fc 00 00 00       	mov    $0xfc,%edx
+    153f:	48 8d 35 82 11 00 00 	lea    0x1182(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    1546:	89 c7                	mov    %eax,%edi
+    1548:	b8 00 00 00 00       	mov    $0x0,%eax
+    154d:	e8 94 06 00 00       	call   1be6 <printf>
+    1552:	90                   	nop
+    1553:	eb fd                	jmp    1552 <duptest+0x484>
+
+  printf(stdout, "dup read offsets ok\n");
+    1555:	8b 05 95 1d 00 00    	mov    0x1d95(%rip),%eax        # 32f0 <stdout>
+    155b:	48 8d 15 a1 18 00 00 	lea    0x18a1(%rip),%rdx        # 2e03 <malloc+0xa22>
+    1562:	48 89 d6             	mov    %rdx,%rsi
+    1565:	89 c7                	mov    %eax,%edi
+    1567:	b8 00 00 00 00       	mov    $0x0,%eax
+    156c:	e8 75 06 00 00       	call   1be6 <printf>
+
+  if (close(fd2) != 0)
+    1571:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1574:	89 c7                	mov    %eax,%edi
+    1576:	e8 3a 0c 00 00       	call   21b5 <close>
+    157b:	85 c0                	test   %eax,%eax
+    157d:	74 5c                	je     15db <duptest+0x50d>
+    error("closing the duped file");
+    157f:	8b 05 6b 1d 00 00    	mov    0x1d6b(%rip),%eax        # 32f0 <stdout>
+    1585:	ba 01 01 00 00       	mov    $0x101,%edx
+    158a:	48 8d 0d 9b 0f 00 00 	lea    0xf9b(%rip),%rcx        # 252c <malloc+0x14b>
+    1591:	48 89 ce             	mov    %rcx,%rsi
+    1594:	89 c7                	mov    %eax,%edi
+    1596:	b8 00 00 00 00       	mov    $0x0,%eax
+    159b:	e8 46 06 00 00       	call   1be6 <printf>
+    15a0:	8b 05 4a 1d 00 00    	mov    0x1d4a(%rip),%eax        # 32f0 <stdout>
+    15a6:	48 8d 15 6b 18 00 00 	lea    0x186b(%rip),%rdx        # 2e18 <malloc+0xa37>
+    15ad:	48 89 d6             	mov    %rdx,%rsi
+    15b0:	89 c7                	mov    %eax,%edi
+    15b2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15b7:	e8 2a 06 00 00       	call   1be6 <printf>
+    15bc:	8b 05 2e 1d 00 00    	mov    0x1d2e(%rip),%eax        # 32f0 <stdout>
+    15c2:	48 8d 15 9d 0f 00 00 	lea    0xf9d(%rip),%rdx        # 2566 <malloc+0x185>
+    15c9:	48 89 d6             	mov    %rdx,%rsi
+    15cc:	89 c7                	mov    %eax,%edi
+    15ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    15d3:	e8 0e 06 00 00       	call   1be6 <printf>
+    15d8:	90                   	nop
+    15d9:	eb fd                	jmp    15d8 <duptest+0x50a>
+
+  // test duping of stdout
+  // should be fd1, because that is the first file I opened (and closed) earlier
+  if ((stdout_cpy = dup(stdout)) != fd1)
+    15db:	8b 05 0f 1d 00 00    	mov    0x1d0f(%rip),%eax        # 32f0 <stdout>
+    15e1:	89 c7                	mov    %eax,%edi
+    15e3:	e8 1d 0c 00 00       	call   2205 <dup>
+    15e8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    15eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    15ee:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    15f1:	74 5f                	je     1652 <duptest+0x584>
+    error("returned fd from dup that was not the smallest free fd, was '%d'",
+    15f3:	8b 05 f7 1c 00 00    	mov    0x1cf7(%rip),%eax        # 32f0 <stdout>
+    15f9:	ba 06 01 00 00       	mov    $0x106,%edx
+    15fe:	48 8d 0d 27 0f 00 00 	lea    0xf27(%rip),%rcx        # 252c <malloc+0x14b>
+    1605:	48 89 ce             	mov    %rcx,%rsi
+    1608:	89 c7                	mov    %eax,%edi
+    160a:	b8 00 00 00 00       	mov    $0x0,%eax
+    160f:	e8 d2 05 00 00       	call   1be6 <printf>
+    1614:	8b 05 d6 1c 00 00    	mov    0x1cd6(%rip),%eax        # 32f0 <stdout>
+    161a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    161d:	48 8d 0d 0c 18 00 00 	lea    0x180c(%rip),%rcx        # 2e30 <malloc+0xa4f>
+    1624:	48 89 ce             	mov    %rcx,%rsi
+    1627:	89 c7                	mov    %eax,%edi
+    1629:	b8 00 00 00 00       	mov    $0x0,%eax
+    162e:	e8 b3 05 00 00       	call   1be6 <printf>
+    1633:	8b 05 b7 1c 00 00    	mov    0x1cb7(%rip),%eax        # 32f0 <stdout>
+    1639:	48 8d 15 26 0f 00 00 	lea    0xf26(%rip),%rdx        # 2566 <malloc+0x185>
+    1640:	48 89 d6             	mov    %rdx,%rsi
+    1643:	89 c7                	mov    %eax,%edi
+    1645:	b8 00 00 00 00       	mov    $0x0,%eax
+    164a:	e8 97 05 00 00       	call   1be6 <printf>
+    164f:	90                   	nop
+    1650:	eb fd                	jmp    164f <duptest+0x581>
+          stdout_cpy);
+
+  char *consolestr = "print to console directly from write\n";
+    1652:	48 8d 05 1f 18 00 00 	lea    0x181f(%rip),%rax        # 2e78 <malloc+0xa97>
+    1659:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  strcpy(buf, consolestr);
+    165d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1661:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1668:	48 89 d6             	mov    %rdx,%rsi
+    166b:	48 89 c7             	mov    %rax,%rdi
+    166e:	e8 75 08 00 00       	call   1ee8 <strcpy>
+
+  if (write(stdout_cpy, consolestr, strlen(consolestr)) != strlen(consolestr))
+    1673:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1677:	48 89 c7             	mov    %rax,%rdi
+    167a:	e8 f7 08 00 00       	call   1f76 <strlen>
+    167f:	89 c2                	mov    %eax,%edx
+    1681:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1685:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1688:	48 89 ce             	mov    %rcx,%rsi
+    168b:	89 c7                	mov    %eax,%edi
+    168d:	e8 1b 0b 00 00       	call   21ad <write>
+    1692:	89 c3                	mov    %eax,%ebx
+    1694:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1698:	48 89 c7             	mov    %rax,%rdi
+    169b:	e8 d6 08 00 00       	call   1f76 <strlen>
+    16a0:	39 c3                	cmp    %eax,%ebx
+    16a2:	74 5c                	je     1700 <duptest+0x632>
+    error("couldn't write to console from duped fd");
+    16a4:	8b 05 46 1c 00 00    	mov    0x1c46(%rip),%eax        # 32f0 <stdout>
+    16aa:	ba 0d 01 00 00       	mov    $0x10d,%edx
+    16af:	48 8d 0d 76 0e 00 00 	lea    0xe76(%rip),%rcx        # 252c <malloc+0x14b>
+    16b6:	48 89 ce             	mov    %rcx,%rsi
+    16b9:	89 c7                	mov    %eax,%edi
+    16bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    16c0:	e8 21 05 00 00       	call   1be6 <printf>
+    16c5:	8b 05 25 1c 00 00    	mov    0x1c25(%rip),%eax        # 32f0 <stdout>
+    16cb:	48 8d 15 ce 17 00 00 	lea    0x17ce(%rip),%rdx        # 2ea0 <malloc+0xabf>
+    16d2:	48 89 d6             	mov    %rdx,%rsi
+    16d5:	89 c7                	mov    %eax,%edi
+    16d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    16dc:	e8 05 05 00 00       	call   1be6 <printf>
+    16e1:	8b 05 09 1c 00 00    	mov    0x1c09(%rip),%eax        # 32f0 <stdout>
+    16e7:	48 8d 15 78 0e 00 00 	lea    0xe78(%rip),%rdx        # 2566 <malloc+0x185>
+    16ee:	48 89 d6             	mov    %rdx,%rsi
+    16f1:	89 c7                	mov    %eax,%edi
+    16f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f8:	e8 e9 04 00 00       	call   1be6 <printf>
+    16fd:	90                   	nop
+    16fe:	eb fd                	jmp    16fd <duptest+0x62f>
+
+  assert(close(stdout_cpy) == 0);
+    1700:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1703:	89 c7                	mov    %eax,%edi
+    1705:	e8 ab 0a 00 00       	call   21b5 <close>
+    170a:	85 c0                	test   %eax,%eax
+    170c:	74 2b                	je     1739 <duptest+0x66b>
+    170e:	8b 05 dc 1b 00 00    	mov    0x1bdc(%rip),%eax        # 32f0 <stdout>
+    1714:	48 8d 15 ad 17 00 00 	lea    0x17ad(%rip),%rdx        # 2ec8 <malloc+0xae7>
+    171b:	48 89 d1             	mov    %rdx,%rcx
+    171e:	ba 0f 01 00 00       	mov    $0x10f,%edx
+    1723:	48 8d 35 9e 0f 00 00 	lea    0xf9e(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    172a:	89 c7                	mov    %eax,%edi
+    172c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1731:	e8 b0 04 00 00       	call   1be6 <printf>
+    1736:	90                   	nop
+    1737:	eb fd                	jmp    1736 <duptest+0x668>
+
+  printf(stdout, "dup test ok\n");
+    1739:	8b 05 b1 1b 00 00    	mov    0x1bb1(%rip),%eax        # 32f0 <stdout>
+    173f:	48 8d 15 99 17 00 00 	lea    0x1799(%rip),%rdx        # 2edf <malloc+0xafe>
+    1746:	48 89 d6             	mov    %rdx,%rsi
+    1749:	89 c7                	mov    %eax,%edi
+    174b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1750:	e8 91 04 00 00       	call   1be6 <printf>
+}
+    1755:	90                   	nop
+    1756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    175a:	c9                   	leave
+    175b:	c3                   	ret
+
+000000000000175c <nofilestest>:
+
+void nofilestest() {
+    175c:	55                   	push   %rbp
+    175d:	48 89 e5             	mov    %rsp,%rbp
+    1760:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, tmpfd;
+
+  printf(stdout, "nofiles test\n");
+    1764:	8b 05 86 1b 00 00    	mov    0x1b86(%rip),%eax        # 32f0 <stdout>
+    176a:	48 8d 15 7b 17 00 00 	lea    0x177b(%rip),%rdx        # 2eec <malloc+0xb0b>
+    1771:	48 89 d6             	mov    %rdx,%rsi
+    1774:	89 c7                	mov    %eax,%edi
+    1776:	b8 00 00 00 00       	mov    $0x0,%eax
+    177b:	e8 66 04 00 00       	call   1be6 <printf>
+  fd = open("/small.txt", O_RDONLY);
+    1780:	be 00 00 00 00       	mov    $0x0,%esi
+    1785:	48 8d 05 dc 0d 00 00 	lea    0xddc(%rip),%rax        # 2568 <malloc+0x187>
+    178c:	48 89 c7             	mov    %rax,%rdi
+    178f:	e8 39 0a 00 00       	call   21cd <open>
+    1794:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  assert(fd != -1);
+    1797:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+    179b:	75 2b                	jne    17c8 <nofilestest+0x6c>
+    179d:	8b 05 4d 1b 00 00    	mov    0x1b4d(%rip),%eax        # 32f0 <stdout>
+    17a3:	48 8d 15 15 0f 00 00 	lea    0xf15(%rip),%rdx        # 26bf <malloc+0x2de>
+    17aa:	48 89 d1             	mov    %rdx,%rcx
+    17ad:	ba 19 01 00 00       	mov    $0x119,%edx
+    17b2:	48 8d 35 0f 0f 00 00 	lea    0xf0f(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    17b9:	89 c7                	mov    %eax,%edi
+    17bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    17c0:	e8 21 04 00 00       	call   1be6 <printf>
+    17c5:	90                   	nop
+    17c6:	eb fd                	jmp    17c5 <nofilestest+0x69>
+
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    17c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    17cb:	83 c0 01             	add    $0x1,%eax
+    17ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    17d1:	e9 82 00 00 00       	jmp    1858 <nofilestest+0xfc>
+    int newfd = open("/small.txt", O_RDONLY);
+    17d6:	be 00 00 00 00       	mov    $0x0,%esi
+    17db:	48 8d 05 86 0d 00 00 	lea    0xd86(%rip),%rax        # 2568 <malloc+0x187>
+    17e2:	48 89 c7             	mov    %rax,%rdi
+    17e5:	e8 e3 09 00 00       	call   21cd <open>
+    17ea:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (newfd != tmpfd)
+    17ed:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    17f0:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+    17f3:	74 5f                	je     1854 <nofilestest+0xf8>
+      error("returned fd from open was not the smallest free fd, was '%d'",
+    17f5:	8b 05 f5 1a 00 00    	mov    0x1af5(%rip),%eax        # 32f0 <stdout>
+    17fb:	ba 1e 01 00 00       	mov    $0x11e,%edx
+    1800:	48 8d 0d 25 0d 00 00 	lea    0xd25(%rip),%rcx        # 252c <malloc+0x14b>
+    1807:	48 89 ce             	mov    %rcx,%rsi
+    180a:	89 c7                	mov    %eax,%edi
+    180c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1811:	e8 d0 03 00 00       	call   1be6 <printf>
+    1816:	8b 05 d4 1a 00 00    	mov    0x1ad4(%rip),%eax        # 32f0 <stdout>
+    181c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    181f:	48 8d 0d da 16 00 00 	lea    0x16da(%rip),%rcx        # 2f00 <malloc+0xb1f>
+    1826:	48 89 ce             	mov    %rcx,%rsi
+    1829:	89 c7                	mov    %eax,%edi
+    182b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1830:	e8 b1 03 00 00       	call   1be6 <printf>
+    1835:	8b 05 b5 1a 00 00    	mov    0x1ab5(%rip),%eax        # 32f0 <stdout>
+    183b:	48 8d 15 24 0d 00 00 	lea    0xd24(%rip),%rdx        # 2566 <malloc+0x185>
+    1842:	48 89 d6             	mov    %rdx,%rsi
+    1845:	89 c7                	mov    %eax,%edi
+    1847:	b8 00 00 00 00       	mov    $0x0,%eax
+    184c:	e8 95 03 00 00       	call   1be6 <printf>
+    1851:	90                   	nop
+    1852:	eb fd                	jmp    1851 <nofilestest+0xf5>
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    1854:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1858:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    185c:	0f 8e 74 ff ff ff    	jle    17d6 <nofilestest+0x7a>
+            newfd);
+  }
+
+  // Opening should fail as we have reached the NOFILE limit
+  if (open("/small.txt", O_RDONLY) != -1)
+    1862:	be 00 00 00 00       	mov    $0x0,%esi
+    1867:	48 8d 05 fa 0c 00 00 	lea    0xcfa(%rip),%rax        # 2568 <malloc+0x187>
+    186e:	48 89 c7             	mov    %rax,%rdi
+    1871:	e8 57 09 00 00       	call   21cd <open>
+    1876:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1879:	74 5c                	je     18d7 <nofilestest+0x17b>
+    error("opened more files than allowed");
+    187b:	8b 05 6f 1a 00 00    	mov    0x1a6f(%rip),%eax        # 32f0 <stdout>
+    1881:	ba 24 01 00 00       	mov    $0x124,%edx
+    1886:	48 8d 0d 9f 0c 00 00 	lea    0xc9f(%rip),%rcx        # 252c <malloc+0x14b>
+    188d:	48 89 ce             	mov    %rcx,%rsi
+    1890:	89 c7                	mov    %eax,%edi
+    1892:	b8 00 00 00 00       	mov    $0x0,%eax
+    1897:	e8 4a 03 00 00       	call   1be6 <printf>
+    189c:	8b 05 4e 1a 00 00    	mov    0x1a4e(%rip),%eax        # 32f0 <stdout>
+    18a2:	48 8d 15 97 16 00 00 	lea    0x1697(%rip),%rdx        # 2f40 <malloc+0xb5f>
+    18a9:	48 89 d6             	mov    %rdx,%rsi
+    18ac:	89 c7                	mov    %eax,%edi
+    18ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    18b3:	e8 2e 03 00 00       	call   1be6 <printf>
+    18b8:	8b 05 32 1a 00 00    	mov    0x1a32(%rip),%eax        # 32f0 <stdout>
+    18be:	48 8d 15 a1 0c 00 00 	lea    0xca1(%rip),%rdx        # 2566 <malloc+0x185>
+    18c5:	48 89 d6             	mov    %rdx,%rsi
+    18c8:	89 c7                	mov    %eax,%edi
+    18ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    18cf:	e8 12 03 00 00       	call   1be6 <printf>
+    18d4:	90                   	nop
+    18d5:	eb fd                	jmp    18d4 <nofilestest+0x178>
+
+  assert(close(NOFILE - 1) == 0);
+    18d7:	bf 0f 00 00 00       	mov    $0xf,%edi
+    18dc:	e8 d4 08 00 00       	call   21b5 <close>
+    18e1:	85 c0                	test   %eax,%eax
+    18e3:	74 2b                	je     1910 <nofilestest+0x1b4>
+    18e5:	8b 05 05 1a 00 00    	mov    0x1a05(%rip),%eax        # 32f0 <stdout>
+    18eb:	48 8d 15 6d 16 00 00 	lea    0x166d(%rip),%rdx        # 2f5f <malloc+0xb7e>
+    18f2:	48 89 d1             	mov    %rdx,%rcx
+    18f5:	ba 26 01 00 00       	mov    $0x126,%edx
+    18fa:	48 8d 35 c7 0d 00 00 	lea    0xdc7(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    1901:	89 c7                	mov    %eax,%edi
+    1903:	b8 00 00 00 00       	mov    $0x0,%eax
+    1908:	e8 d9 02 00 00       	call   1be6 <printf>
+    190d:	90                   	nop
+    190e:	eb fd                	jmp    190d <nofilestest+0x1b1>
+
+  // Opening should work once there is a fd available
+  int fd2 = open("/small.txt", O_RDONLY);
+    1910:	be 00 00 00 00       	mov    $0x0,%esi
+    1915:	48 8d 05 4c 0c 00 00 	lea    0xc4c(%rip),%rax        # 2568 <malloc+0x187>
+    191c:	48 89 c7             	mov    %rax,%rdi
+    191f:	e8 a9 08 00 00       	call   21cd <open>
+    1924:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd2 == -1) error("unable to open file after an fd is available");
+    1927:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%rbp)
+    192b:	75 5c                	jne    1989 <nofilestest+0x22d>
+    192d:	8b 05 bd 19 00 00    	mov    0x19bd(%rip),%eax        # 32f0 <stdout>
+    1933:	ba 2a 01 00 00       	mov    $0x12a,%edx
+    1938:	48 8d 0d ed 0b 00 00 	lea    0xbed(%rip),%rcx        # 252c <malloc+0x14b>
+    193f:	48 89 ce             	mov    %rcx,%rsi
+    1942:	89 c7                	mov    %eax,%edi
+    1944:	b8 00 00 00 00       	mov    $0x0,%eax
+    1949:	e8 98 02 00 00       	call   1be6 <printf>
+    194e:	8b 05 9c 19 00 00    	mov    0x199c(%rip),%eax        # 32f0 <stdout>
+    1954:	48 8d 15 1d 16 00 00 	lea    0x161d(%rip),%rdx        # 2f78 <malloc+0xb97>
+    195b:	48 89 d6             	mov    %rdx,%rsi
+    195e:	89 c7                	mov    %eax,%edi
+    1960:	b8 00 00 00 00       	mov    $0x0,%eax
+    1965:	e8 7c 02 00 00       	call   1be6 <printf>
+    196a:	8b 05 80 19 00 00    	mov    0x1980(%rip),%eax        # 32f0 <stdout>
+    1970:	48 8d 15 ef 0b 00 00 	lea    0xbef(%rip),%rdx        # 2566 <malloc+0x185>
+    1977:	48 89 d6             	mov    %rdx,%rsi
+    197a:	89 c7                	mov    %eax,%edi
+    197c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1981:	e8 60 02 00 00       	call   1be6 <printf>
+    1986:	90                   	nop
+    1987:	eb fd                	jmp    1986 <nofilestest+0x22a>
+
+  assert(fd2 == NOFILE - 1);
+    1989:	83 7d f4 0f          	cmpl   $0xf,-0xc(%rbp)
+    198d:	74 2b                	je     19ba <nofilestest+0x25e>
+    198f:	8b 05 5b 19 00 00    	mov    0x195b(%rip),%eax        # 32f0 <stdout>
+    1995:	48 8d 15 09 16 00 00 	lea    0x1609(%rip),%rdx        # 2fa5 <malloc+0xbc4>
+    199c:	48 89 d1             	mov    %rdx,%rcx
+    199f:	ba 2c 01 00 00       	mov    $0x12c,%edx
+    19a4:	48 8d 35 1d 0d 00 00 	lea    0xd1d(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    19ab:	89 c7                	mov    %eax,%edi
+    19ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    19b2:	e8 2f 02 00 00       	call   1be6 <printf>
+    19b7:	90                   	nop
+    19b8:	eb fd                	jmp    19b7 <nofilestest+0x25b>
+
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    19ba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    19bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    19c0:	eb 3d                	jmp    19ff <nofilestest+0x2a3>
+    assert(close(tmpfd) == 0);
+    19c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19c5:	89 c7                	mov    %eax,%edi
+    19c7:	e8 e9 07 00 00       	call   21b5 <close>
+    19cc:	85 c0                	test   %eax,%eax
+    19ce:	74 2b                	je     19fb <nofilestest+0x29f>
+    19d0:	8b 05 1a 19 00 00    	mov    0x191a(%rip),%eax        # 32f0 <stdout>
+    19d6:	48 8d 15 da 15 00 00 	lea    0x15da(%rip),%rdx        # 2fb7 <malloc+0xbd6>
+    19dd:	48 89 d1             	mov    %rdx,%rcx
+    19e0:	ba 2f 01 00 00       	mov    $0x12f,%edx
+    19e5:	48 8d 35 dc 0c 00 00 	lea    0xcdc(%rip),%rsi        # 26c8 <malloc+0x2e7>
+    19ec:	89 c7                	mov    %eax,%edi
+    19ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    19f3:	e8 ee 01 00 00       	call   1be6 <printf>
+    19f8:	90                   	nop
+    19f9:	eb fd                	jmp    19f8 <nofilestest+0x29c>
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    19fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    19ff:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1a03:	7e bd                	jle    19c2 <nofilestest+0x266>
+  }
+
+  printf(stdout, "nofiles test ok\n");
+    1a05:	8b 05 e5 18 00 00    	mov    0x18e5(%rip),%eax        # 32f0 <stdout>
+    1a0b:	48 8d 15 b7 15 00 00 	lea    0x15b7(%rip),%rdx        # 2fc9 <malloc+0xbe8>
+    1a12:	48 89 d6             	mov    %rdx,%rsi
+    1a15:	89 c7                	mov    %eax,%edi
+    1a17:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a1c:	e8 c5 01 00 00       	call   1be6 <printf>
+}
+    1a21:	90                   	nop
+    1a22:	c9                   	leave
+    1a23:	c3                   	ret
+
+0000000000001a24 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    1a24:	55                   	push   %rbp
+    1a25:	48 89 e5             	mov    %rsp,%rbp
+    1a28:	48 83 ec 10          	sub    $0x10,%rsp
+    1a2c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1a2f:	89 f0                	mov    %esi,%eax
+    1a31:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1a34:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1a38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a3b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a40:	48 89 ce             	mov    %rcx,%rsi
+    1a43:	89 c7                	mov    %eax,%edi
+    1a45:	e8 63 07 00 00       	call   21ad <write>
+    1a4a:	90                   	nop
+    1a4b:	c9                   	leave
+    1a4c:	c3                   	ret
+
+0000000000001a4d <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1a4d:	55                   	push   %rbp
+    1a4e:	48 89 e5             	mov    %rsp,%rbp
+    1a51:	48 83 ec 40          	sub    $0x40,%rsp
+    1a55:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1a58:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1a5b:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1a5e:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1a61:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1a65:	74 1f                	je     1a86 <printint64+0x39>
+    1a67:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a6a:	c1 e8 1f             	shr    $0x1f,%eax
+    1a6d:	0f b6 c0             	movzbl %al,%eax
+    1a70:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1a73:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1a77:	74 0d                	je     1a86 <printint64+0x39>
+    x = -xx;
+    1a79:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a7c:	f7 d8                	neg    %eax
+    1a7e:	48 98                	cltq
+    1a80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a84:	eb 09                	jmp    1a8f <printint64+0x42>
+  else
+    x = xx;
+    1a86:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a89:	48 98                	cltq
+    1a8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1a8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1a96:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1a99:	48 63 c8             	movslq %eax,%rcx
+    1a9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+    1aa5:	48 f7 f1             	div    %rcx
+    1aa8:	48 89 d1             	mov    %rdx,%rcx
+    1aab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aae:	8d 50 01             	lea    0x1(%rax),%edx
+    1ab1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ab4:	48 8d 15 45 18 00 00 	lea    0x1845(%rip),%rdx        # 3300 <digits.1>
+    1abb:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1abf:	48 98                	cltq
+    1ac1:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1ac5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1ac8:	48 63 f0             	movslq %eax,%rsi
+    1acb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1acf:	ba 00 00 00 00       	mov    $0x0,%edx
+    1ad4:	48 f7 f6             	div    %rsi
+    1ad7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1adb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ae0:	75 b4                	jne    1a96 <printint64+0x49>
+
+  if (sgn)
+    1ae2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1ae6:	74 2b                	je     1b13 <printint64+0xc6>
+    buf[i++] = '-';
+    1ae8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aeb:	8d 50 01             	lea    0x1(%rax),%edx
+    1aee:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1af1:	48 98                	cltq
+    1af3:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1af8:	eb 19                	jmp    1b13 <printint64+0xc6>
+    putc(fd, buf[i]);
+    1afa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1afd:	48 98                	cltq
+    1aff:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1b04:	0f be d0             	movsbl %al,%edx
+    1b07:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1b0a:	89 d6                	mov    %edx,%esi
+    1b0c:	89 c7                	mov    %eax,%edi
+    1b0e:	e8 11 ff ff ff       	call   1a24 <putc>
+  while (--i >= 0)
+    1b13:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1b17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1b1b:	79 dd                	jns    1afa <printint64+0xad>
+}
+    1b1d:	90                   	nop
+    1b1e:	90                   	nop
+    1b1f:	c9                   	leave
+    1b20:	c3                   	ret
+
+0000000000001b21 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1b21:	55                   	push   %rbp
+    1b22:	48 89 e5             	mov    %rsp,%rbp
+    1b25:	48 83 ec 30          	sub    $0x30,%rsp
+    1b29:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1b2c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1b2f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1b32:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1b35:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1b3c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1b40:	74 17                	je     1b59 <printint+0x38>
+    1b42:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1b46:	79 11                	jns    1b59 <printint+0x38>
+    neg = 1;
+    1b48:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1b4f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b52:	f7 d8                	neg    %eax
+    1b54:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b57:	eb 06                	jmp    1b5f <printint+0x3e>
+  } else {
+    x = xx;
+    1b59:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b5c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1b5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1b66:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1b69:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b71:	f7 f1                	div    %ecx
+    1b73:	89 d1                	mov    %edx,%ecx
+    1b75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b78:	8d 50 01             	lea    0x1(%rax),%edx
+    1b7b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1b7e:	89 c9                	mov    %ecx,%ecx
+    1b80:	48 8d 15 99 17 00 00 	lea    0x1799(%rip),%rdx        # 3320 <digits.0>
+    1b87:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1b8b:	48 98                	cltq
+    1b8d:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1b91:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1b94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b97:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b9c:	f7 f6                	div    %esi
+    1b9e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1ba1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1ba5:	75 bf                	jne    1b66 <printint+0x45>
+  if (neg)
+    1ba7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1bab:	74 2b                	je     1bd8 <printint+0xb7>
+    buf[i++] = '-';
+    1bad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bb0:	8d 50 01             	lea    0x1(%rax),%edx
+    1bb3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1bb6:	48 98                	cltq
+    1bb8:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1bbd:	eb 19                	jmp    1bd8 <printint+0xb7>
+    putc(fd, buf[i]);
+    1bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bc2:	48 98                	cltq
+    1bc4:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1bc9:	0f be d0             	movsbl %al,%edx
+    1bcc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bcf:	89 d6                	mov    %edx,%esi
+    1bd1:	89 c7                	mov    %eax,%edi
+    1bd3:	e8 4c fe ff ff       	call   1a24 <putc>
+  while (--i >= 0)
+    1bd8:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1bdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1be0:	79 dd                	jns    1bbf <printint+0x9e>
+}
+    1be2:	90                   	nop
+    1be3:	90                   	nop
+    1be4:	c9                   	leave
+    1be5:	c3                   	ret
+
+0000000000001be6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1be6:	55                   	push   %rbp
+    1be7:	48 89 e5             	mov    %rsp,%rbp
+    1bea:	48 83 ec 70          	sub    $0x70,%rsp
+    1bee:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1bf1:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1bf5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1bf9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1bfd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1c01:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1c05:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1c0c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1c10:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1c14:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1c18:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1c1c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1c23:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1c2a:	e9 6b 02 00 00       	jmp    1e9a <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1c2f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1c32:	48 63 d0             	movslq %eax,%rdx
+    1c35:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1c39:	48 01 d0             	add    %rdx,%rax
+    1c3c:	0f b6 00             	movzbl (%rax),%eax
+    1c3f:	0f be c0             	movsbl %al,%eax
+    1c42:	25 ff 00 00 00       	and    $0xff,%eax
+    1c47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1c4a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1c4e:	75 30                	jne    1c80 <printf+0x9a>
+      if (c == '%') {
+    1c50:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1c54:	75 13                	jne    1c69 <printf+0x83>
+        state = '%';
+    1c56:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1c5d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1c64:	e9 2d 02 00 00       	jmp    1e96 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1c6c:	0f be d0             	movsbl %al,%edx
+    1c6f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1c72:	89 d6                	mov    %edx,%esi
+    1c74:	89 c7                	mov    %eax,%edi
+    1c76:	e8 a9 fd ff ff       	call   1a24 <putc>
+    1c7b:	e9 16 02 00 00       	jmp    1e96 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1c80:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1c84:	0f 85 0c 02 00 00    	jne    1e96 <printf+0x2b0>
+      if (c == 'l') {
+    1c8a:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1c8e:	75 0c                	jne    1c9c <printf+0xb6>
+        lflag = 1;
+    1c90:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1c97:	e9 fa 01 00 00       	jmp    1e96 <printf+0x2b0>
+      } else if (c == 'd') {
+    1c9c:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1ca0:	0f 85 95 00 00 00    	jne    1d3b <printf+0x155>
+        if (lflag == 1)
+    1ca6:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1caa:	75 49                	jne    1cf5 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1cac:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1caf:	83 f8 2f             	cmp    $0x2f,%eax
+    1cb2:	77 17                	ja     1ccb <printf+0xe5>
+    1cb4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1cb8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cbb:	89 d2                	mov    %edx,%edx
+    1cbd:	48 01 d0             	add    %rdx,%rax
+    1cc0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cc3:	83 c2 08             	add    $0x8,%edx
+    1cc6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1cc9:	eb 0c                	jmp    1cd7 <printf+0xf1>
+    1ccb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ccf:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1cd3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1cd7:	48 8b 00             	mov    (%rax),%rax
+    1cda:	89 c6                	mov    %eax,%esi
+    1cdc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1cdf:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1ce4:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1ce9:	89 c7                	mov    %eax,%edi
+    1ceb:	e8 5d fd ff ff       	call   1a4d <printint64>
+    1cf0:	e9 9a 01 00 00       	jmp    1e8f <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1cf5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1cf8:	83 f8 2f             	cmp    $0x2f,%eax
+    1cfb:	77 17                	ja     1d14 <printf+0x12e>
+    1cfd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d01:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d04:	89 d2                	mov    %edx,%edx
+    1d06:	48 01 d0             	add    %rdx,%rax
+    1d09:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d0c:	83 c2 08             	add    $0x8,%edx
+    1d0f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d12:	eb 0c                	jmp    1d20 <printf+0x13a>
+    1d14:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d18:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d1c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d20:	8b 30                	mov    (%rax),%esi
+    1d22:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d25:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1d2a:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1d2f:	89 c7                	mov    %eax,%edi
+    1d31:	e8 eb fd ff ff       	call   1b21 <printint>
+    1d36:	e9 54 01 00 00       	jmp    1e8f <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    1d3b:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1d3f:	74 0a                	je     1d4b <printf+0x165>
+    1d41:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1d45:	0f 85 95 00 00 00    	jne    1de0 <printf+0x1fa>
+        if (lflag == 1)
+    1d4b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1d4f:	75 49                	jne    1d9a <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1d51:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d54:	83 f8 2f             	cmp    $0x2f,%eax
+    1d57:	77 17                	ja     1d70 <printf+0x18a>
+    1d59:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d5d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d60:	89 d2                	mov    %edx,%edx
+    1d62:	48 01 d0             	add    %rdx,%rax
+    1d65:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d68:	83 c2 08             	add    $0x8,%edx
+    1d6b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d6e:	eb 0c                	jmp    1d7c <printf+0x196>
+    1d70:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d74:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d78:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d7c:	48 8b 00             	mov    (%rax),%rax
+    1d7f:	89 c6                	mov    %eax,%esi
+    1d81:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1d89:	ba 10 00 00 00       	mov    $0x10,%edx
+    1d8e:	89 c7                	mov    %eax,%edi
+    1d90:	e8 b8 fc ff ff       	call   1a4d <printint64>
+        if (lflag == 1)
+    1d95:	e9 f5 00 00 00       	jmp    1e8f <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1d9a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d9d:	83 f8 2f             	cmp    $0x2f,%eax
+    1da0:	77 17                	ja     1db9 <printf+0x1d3>
+    1da2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1da6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1da9:	89 d2                	mov    %edx,%edx
+    1dab:	48 01 d0             	add    %rdx,%rax
+    1dae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1db1:	83 c2 08             	add    $0x8,%edx
+    1db4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1db7:	eb 0c                	jmp    1dc5 <printf+0x1df>
+    1db9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1dbd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1dc1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1dc5:	8b 30                	mov    (%rax),%esi
+    1dc7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1dca:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1dcf:	ba 10 00 00 00       	mov    $0x10,%edx
+    1dd4:	89 c7                	mov    %eax,%edi
+    1dd6:	e8 46 fd ff ff       	call   1b21 <printint>
+        if (lflag == 1)
+    1ddb:	e9 af 00 00 00       	jmp    1e8f <printf+0x2a9>
+      } else if (c == 's') {
+    1de0:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1de4:	75 6e                	jne    1e54 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1de6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1de9:	83 f8 2f             	cmp    $0x2f,%eax
+    1dec:	77 17                	ja     1e05 <printf+0x21f>
+    1dee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1df2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1df5:	89 d2                	mov    %edx,%edx
+    1df7:	48 01 d0             	add    %rdx,%rax
+    1dfa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1dfd:	83 c2 08             	add    $0x8,%edx
+    1e00:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1e03:	eb 0c                	jmp    1e11 <printf+0x22b>
+    1e05:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1e09:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1e0d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1e11:	48 8b 00             	mov    (%rax),%rax
+    1e14:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1e18:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1e1d:	75 28                	jne    1e47 <printf+0x261>
+          s = "(null)";
+    1e1f:	48 8d 05 b4 11 00 00 	lea    0x11b4(%rip),%rax        # 2fda <malloc+0xbf9>
+    1e26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1e2a:	eb 1b                	jmp    1e47 <printf+0x261>
+          putc(fd, *s);
+    1e2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e30:	0f b6 00             	movzbl (%rax),%eax
+    1e33:	0f be d0             	movsbl %al,%edx
+    1e36:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e39:	89 d6                	mov    %edx,%esi
+    1e3b:	89 c7                	mov    %eax,%edi
+    1e3d:	e8 e2 fb ff ff       	call   1a24 <putc>
+        for (; *s; s++)
+    1e42:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1e47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e4b:	0f b6 00             	movzbl (%rax),%eax
+    1e4e:	84 c0                	test   %al,%al
+    1e50:	75 da                	jne    1e2c <printf+0x246>
+    1e52:	eb 3b                	jmp    1e8f <printf+0x2a9>
+      } else if (c == '%') {
+    1e54:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1e58:	75 14                	jne    1e6e <printf+0x288>
+        putc(fd, c);
+    1e5a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e5d:	0f be d0             	movsbl %al,%edx
+    1e60:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e63:	89 d6                	mov    %edx,%esi
+    1e65:	89 c7                	mov    %eax,%edi
+    1e67:	e8 b8 fb ff ff       	call   1a24 <putc>
+    1e6c:	eb 21                	jmp    1e8f <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1e6e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e71:	be 25 00 00 00       	mov    $0x25,%esi
+    1e76:	89 c7                	mov    %eax,%edi
+    1e78:	e8 a7 fb ff ff       	call   1a24 <putc>
+        putc(fd, c);
+    1e7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e80:	0f be d0             	movsbl %al,%edx
+    1e83:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e86:	89 d6                	mov    %edx,%esi
+    1e88:	89 c7                	mov    %eax,%edi
+    1e8a:	e8 95 fb ff ff       	call   1a24 <putc>
+      }
+      state = 0;
+    1e8f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1e96:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1e9a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1e9d:	48 63 d0             	movslq %eax,%rdx
+    1ea0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1ea4:	48 01 d0             	add    %rdx,%rax
+    1ea7:	0f b6 00             	movzbl (%rax),%eax
+    1eaa:	84 c0                	test   %al,%al
+    1eac:	0f 85 7d fd ff ff    	jne    1c2f <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1eb2:	90                   	nop
+    1eb3:	90                   	nop
+    1eb4:	c9                   	leave
+    1eb5:	c3                   	ret
+
+0000000000001eb6 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+    1eb6:	55                   	push   %rbp
+    1eb7:	48 89 e5             	mov    %rsp,%rbp
+    1eba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ebe:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1ec1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+    1ec4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1ec8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1ecb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1ece:	48 89 ce             	mov    %rcx,%rsi
+    1ed1:	48 89 f7             	mov    %rsi,%rdi
+    1ed4:	89 d1                	mov    %edx,%ecx
+    1ed6:	fc                   	cld
+    1ed7:	f3 aa                	rep stos %al,%es:(%rdi)
+    1ed9:	89 ca                	mov    %ecx,%edx
+    1edb:	48 89 fe             	mov    %rdi,%rsi
+    1ede:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1ee2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+    1ee5:	90                   	nop
+    1ee6:	5d                   	pop    %rbp
+    1ee7:	c3                   	ret
+
+0000000000001ee8 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1ee8:	55                   	push   %rbp
+    1ee9:	48 89 e5             	mov    %rsp,%rbp
+    1eec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ef0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1ef4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ef8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1efc:	90                   	nop
+    1efd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1f01:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1f05:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1f09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f0d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1f11:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1f15:	0f b6 12             	movzbl (%rdx),%edx
+    1f18:	88 10                	mov    %dl,(%rax)
+    1f1a:	0f b6 00             	movzbl (%rax),%eax
+    1f1d:	84 c0                	test   %al,%al
+    1f1f:	75 dc                	jne    1efd <strcpy+0x15>
+  return os;
+    1f21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f25:	5d                   	pop    %rbp
+    1f26:	c3                   	ret
+
+0000000000001f27 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1f27:	55                   	push   %rbp
+    1f28:	48 89 e5             	mov    %rsp,%rbp
+    1f2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1f33:	eb 0a                	jmp    1f3f <strcmp+0x18>
+    p++, q++;
+    1f35:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1f3a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f43:	0f b6 00             	movzbl (%rax),%eax
+    1f46:	84 c0                	test   %al,%al
+    1f48:	74 12                	je     1f5c <strcmp+0x35>
+    1f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f4e:	0f b6 10             	movzbl (%rax),%edx
+    1f51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f55:	0f b6 00             	movzbl (%rax),%eax
+    1f58:	38 c2                	cmp    %al,%dl
+    1f5a:	74 d9                	je     1f35 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1f5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f60:	0f b6 00             	movzbl (%rax),%eax
+    1f63:	0f b6 d0             	movzbl %al,%edx
+    1f66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f6a:	0f b6 00             	movzbl (%rax),%eax
+    1f6d:	0f b6 c0             	movzbl %al,%eax
+    1f70:	29 c2                	sub    %eax,%edx
+    1f72:	89 d0                	mov    %edx,%eax
+}
+    1f74:	5d                   	pop    %rbp
+    1f75:	c3                   	ret
+
+0000000000001f76 <strlen>:
+uint strlen(char *s) {
+    1f76:	55                   	push   %rbp
+    1f77:	48 89 e5             	mov    %rsp,%rbp
+    1f7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1f7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1f85:	eb 04                	jmp    1f8b <strlen+0x15>
+    1f87:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f8e:	48 63 d0             	movslq %eax,%rdx
+    1f91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f95:	48 01 d0             	add    %rdx,%rax
+    1f98:	0f b6 00             	movzbl (%rax),%eax
+    1f9b:	84 c0                	test   %al,%al
+    1f9d:	75 e8                	jne    1f87 <strlen+0x11>
+  return n;
+    1f9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1fa2:	5d                   	pop    %rbp
+    1fa3:	c3                   	ret
+
+0000000000001fa4 <memset>:
+void *memset(void *dst, int c, uint n) {
+    1fa4:	55                   	push   %rbp
+    1fa5:	48 89 e5             	mov    %rsp,%rbp
+    1fa8:	48 83 ec 10          	sub    $0x10,%rsp
+    1fac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fb0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1fb3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1fb6:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1fb9:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1fbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fc0:	89 ce                	mov    %ecx,%esi
+    1fc2:	48 89 c7             	mov    %rax,%rdi
+    1fc5:	e8 ec fe ff ff       	call   1eb6 <stosb>
+  return dst;
+    1fca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fce:	c9                   	leave
+    1fcf:	c3                   	ret
+
+0000000000001fd0 <strchr>:
+char *strchr(const char *s, char c) {
+    1fd0:	55                   	push   %rbp
+    1fd1:	48 89 e5             	mov    %rsp,%rbp
+    1fd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fd8:	89 f0                	mov    %esi,%eax
+    1fda:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1fdd:	eb 17                	jmp    1ff6 <strchr+0x26>
+    if (*s == c)
+    1fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe3:	0f b6 00             	movzbl (%rax),%eax
+    1fe6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1fe9:	75 06                	jne    1ff1 <strchr+0x21>
+      return (char *)s;
+    1feb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fef:	eb 15                	jmp    2006 <strchr+0x36>
+  for (; *s; s++)
+    1ff1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1ff6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ffa:	0f b6 00             	movzbl (%rax),%eax
+    1ffd:	84 c0                	test   %al,%al
+    1fff:	75 de                	jne    1fdf <strchr+0xf>
+  return 0;
+    2001:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2006:	5d                   	pop    %rbp
+    2007:	c3                   	ret
+
+0000000000002008 <gets>:
+char *gets(char *buf, int max) {
+    2008:	55                   	push   %rbp
+    2009:	48 89 e5             	mov    %rsp,%rbp
+    200c:	48 83 ec 20          	sub    $0x20,%rsp
+    2010:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2014:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    2017:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    201e:	eb 48                	jmp    2068 <gets+0x60>
+    cc = read(0, &c, 1);
+    2020:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    2024:	ba 01 00 00 00       	mov    $0x1,%edx
+    2029:	48 89 c6             	mov    %rax,%rsi
+    202c:	bf 00 00 00 00       	mov    $0x0,%edi
+    2031:	e8 6f 01 00 00       	call   21a5 <read>
+    2036:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2039:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    203d:	7e 36                	jle    2075 <gets+0x6d>
+    buf[i++] = c;
+    203f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2042:	8d 50 01             	lea    0x1(%rax),%edx
+    2045:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2048:	48 63 d0             	movslq %eax,%rdx
+    204b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    204f:	48 01 c2             	add    %rax,%rdx
+    2052:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2056:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2058:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    205c:	3c 0a                	cmp    $0xa,%al
+    205e:	74 16                	je     2076 <gets+0x6e>
+    2060:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2064:	3c 0d                	cmp    $0xd,%al
+    2066:	74 0e                	je     2076 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2068:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    206b:	83 c0 01             	add    $0x1,%eax
+    206e:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2071:	7f ad                	jg     2020 <gets+0x18>
+    2073:	eb 01                	jmp    2076 <gets+0x6e>
+      break;
+    2075:	90                   	nop
+  }
+  buf[i] = '\0';
+    2076:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2079:	48 63 d0             	movslq %eax,%rdx
+    207c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2080:	48 01 d0             	add    %rdx,%rax
+    2083:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2086:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    208a:	c9                   	leave
+    208b:	c3                   	ret
+
+000000000000208c <stat>:
+
+int stat(char *n, struct stat *st) {
+    208c:	55                   	push   %rbp
+    208d:	48 89 e5             	mov    %rsp,%rbp
+    2090:	48 83 ec 20          	sub    $0x20,%rsp
+    2094:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2098:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    209c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20a0:	be 00 00 00 00       	mov    $0x0,%esi
+    20a5:	48 89 c7             	mov    %rax,%rdi
+    20a8:	e8 20 01 00 00       	call   21cd <open>
+    20ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    20b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    20b4:	79 07                	jns    20bd <stat+0x31>
+    return -1;
+    20b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    20bb:	eb 21                	jmp    20de <stat+0x52>
+  r = fstat(fd, st);
+    20bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    20c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20c4:	48 89 d6             	mov    %rdx,%rsi
+    20c7:	89 c7                	mov    %eax,%edi
+    20c9:	e8 17 01 00 00       	call   21e5 <fstat>
+    20ce:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    20d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20d4:	89 c7                	mov    %eax,%edi
+    20d6:	e8 da 00 00 00       	call   21b5 <close>
+  return r;
+    20db:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    20de:	c9                   	leave
+    20df:	c3                   	ret
+
+00000000000020e0 <atoi>:
+
+int atoi(const char *s) {
+    20e0:	55                   	push   %rbp
+    20e1:	48 89 e5             	mov    %rsp,%rbp
+    20e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    20e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    20ef:	eb 28                	jmp    2119 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    20f1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    20f4:	89 d0                	mov    %edx,%eax
+    20f6:	c1 e0 02             	shl    $0x2,%eax
+    20f9:	01 d0                	add    %edx,%eax
+    20fb:	01 c0                	add    %eax,%eax
+    20fd:	89 c1                	mov    %eax,%ecx
+    20ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2103:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    2107:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    210b:	0f b6 00             	movzbl (%rax),%eax
+    210e:	0f be c0             	movsbl %al,%eax
+    2111:	01 c8                	add    %ecx,%eax
+    2113:	83 e8 30             	sub    $0x30,%eax
+    2116:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2119:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    211d:	0f b6 00             	movzbl (%rax),%eax
+    2120:	3c 2f                	cmp    $0x2f,%al
+    2122:	7e 0b                	jle    212f <atoi+0x4f>
+    2124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2128:	0f b6 00             	movzbl (%rax),%eax
+    212b:	3c 39                	cmp    $0x39,%al
+    212d:	7e c2                	jle    20f1 <atoi+0x11>
+  return n;
+    212f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2132:	5d                   	pop    %rbp
+    2133:	c3                   	ret
+
+0000000000002134 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    2134:	55                   	push   %rbp
+    2135:	48 89 e5             	mov    %rsp,%rbp
+    2138:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    213c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2140:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2143:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2147:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    214b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    214f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    2153:	eb 1d                	jmp    2172 <memmove+0x3e>
+    *dst++ = *src++;
+    2155:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2159:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    215d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2165:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2169:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    216d:	0f b6 12             	movzbl (%rdx),%edx
+    2170:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    2172:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2175:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2178:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    217b:	85 c0                	test   %eax,%eax
+    217d:	7f d6                	jg     2155 <memmove+0x21>
+  return vdst;
+    217f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2183:	5d                   	pop    %rbp
+    2184:	c3                   	ret
+
+0000000000002185 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    2185:	b8 01 00 00 00       	mov    $0x1,%eax
+    218a:	cd 40                	int    $0x40
+    218c:	c3                   	ret
+
+000000000000218d <exit>:
+SYSCALL(exit)
+    218d:	b8 02 00 00 00       	mov    $0x2,%eax
+    2192:	cd 40                	int    $0x40
+    2194:	c3                   	ret
+
+0000000000002195 <wait>:
+SYSCALL(wait)
+    2195:	b8 03 00 00 00       	mov    $0x3,%eax
+    219a:	cd 40                	int    $0x40
+    219c:	c3                   	ret
+
+000000000000219d <pipe>:
+SYSCALL(pipe)
+    219d:	b8 04 00 00 00       	mov    $0x4,%eax
+    21a2:	cd 40                	int    $0x40
+    21a4:	c3                   	ret
+
+00000000000021a5 <read>:
+SYSCALL(read)
+    21a5:	b8 05 00 00 00       	mov    $0x5,%eax
+    21aa:	cd 40                	int    $0x40
+    21ac:	c3                   	ret
+
+00000000000021ad <write>:
+SYSCALL(write)
+    21ad:	b8 10 00 00 00       	mov    $0x10,%eax
+    21b2:	cd 40                	int    $0x40
+    21b4:	c3                   	ret
+
+00000000000021b5 <close>:
+SYSCALL(close)
+    21b5:	b8 15 00 00 00       	mov    $0x15,%eax
+    21ba:	cd 40                	int    $0x40
+    21bc:	c3                   	ret
+
+00000000000021bd <kill>:
+SYSCALL(kill)
+    21bd:	b8 06 00 00 00       	mov    $0x6,%eax
+    21c2:	cd 40                	int    $0x40
+    21c4:	c3                   	ret
+
+00000000000021c5 <exec>:
+SYSCALL(exec)
+    21c5:	b8 07 00 00 00       	mov    $0x7,%eax
+    21ca:	cd 40                	int    $0x40
+    21cc:	c3                   	ret
+
+00000000000021cd <open>:
+SYSCALL(open)
+    21cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+    21d2:	cd 40                	int    $0x40
+    21d4:	c3                   	ret
+
+00000000000021d5 <mknod>:
+SYSCALL(mknod)
+    21d5:	b8 11 00 00 00       	mov    $0x11,%eax
+    21da:	cd 40                	int    $0x40
+    21dc:	c3                   	ret
+
+00000000000021dd <unlink>:
+SYSCALL(unlink)
+    21dd:	b8 12 00 00 00       	mov    $0x12,%eax
+    21e2:	cd 40                	int    $0x40
+    21e4:	c3                   	ret
+
+00000000000021e5 <fstat>:
+SYSCALL(fstat)
+    21e5:	b8 08 00 00 00       	mov    $0x8,%eax
+    21ea:	cd 40                	int    $0x40
+    21ec:	c3                   	ret
+
+00000000000021ed <link>:
+SYSCALL(link)
+    21ed:	b8 13 00 00 00       	mov    $0x13,%eax
+    21f2:	cd 40                	int    $0x40
+    21f4:	c3                   	ret
+
+00000000000021f5 <mkdir>:
+SYSCALL(mkdir)
+    21f5:	b8 14 00 00 00       	mov    $0x14,%eax
+    21fa:	cd 40                	int    $0x40
+    21fc:	c3                   	ret
+
+00000000000021fd <chdir>:
+SYSCALL(chdir)
+    21fd:	b8 09 00 00 00       	mov    $0x9,%eax
+    2202:	cd 40                	int    $0x40
+    2204:	c3                   	ret
+
+0000000000002205 <dup>:
+SYSCALL(dup)
+    2205:	b8 0a 00 00 00       	mov    $0xa,%eax
+    220a:	cd 40                	int    $0x40
+    220c:	c3                   	ret
+
+000000000000220d <getpid>:
+SYSCALL(getpid)
+    220d:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2212:	cd 40                	int    $0x40
+    2214:	c3                   	ret
+
+0000000000002215 <sbrk>:
+SYSCALL(sbrk)
+    2215:	b8 0c 00 00 00       	mov    $0xc,%eax
+    221a:	cd 40                	int    $0x40
+    221c:	c3                   	ret
+
+000000000000221d <sleep>:
+SYSCALL(sleep)
+    221d:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2222:	cd 40                	int    $0x40
+    2224:	c3                   	ret
+
+0000000000002225 <uptime>:
+SYSCALL(uptime)
+    2225:	b8 0e 00 00 00       	mov    $0xe,%eax
+    222a:	cd 40                	int    $0x40
+    222c:	c3                   	ret
+
+000000000000222d <sysinfo>:
+SYSCALL(sysinfo)
+    222d:	b8 16 00 00 00       	mov    $0x16,%eax
+    2232:	cd 40                	int    $0x40
+    2234:	c3                   	ret
+
+0000000000002235 <crashn>:
+SYSCALL(crashn)
+    2235:	b8 17 00 00 00       	mov    $0x17,%eax
+    223a:	cd 40                	int    $0x40
+    223c:	c3                   	ret
+
+000000000000223d <mmap>:
+SYSCALL(mmap)
+    223d:	b8 18 00 00 00       	mov    $0x18,%eax
+    2242:	cd 40                	int    $0x40
+    2244:	c3                   	ret
+
+0000000000002245 <munmap>:
+SYSCALL(munmap)
+    2245:	b8 19 00 00 00       	mov    $0x19,%eax
+    224a:	cd 40                	int    $0x40
+    224c:	c3                   	ret
+
+000000000000224d <preface>:
+.globl preface
+preface:
+    call main
+    224d:	e8 ae dd ff ff       	call   0 <main>
+    mov %rax, %rdi
+    2252:	48 89 c7             	mov    %rax,%rdi
+    call exit
+    2255:	e8 33 ff ff ff       	call   218d <exit>
+
+000000000000225a <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    225a:	55                   	push   %rbp
+    225b:	48 89 e5             	mov    %rsp,%rbp
+    225e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    2262:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2266:	48 83 e8 10          	sub    $0x10,%rax
+    226a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    226e:	48 8b 05 db 10 00 00 	mov    0x10db(%rip),%rax        # 3350 <freep>
+    2275:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2279:	eb 2f                	jmp    22aa <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    227b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    227f:	48 8b 00             	mov    (%rax),%rax
+    2282:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2286:	72 17                	jb     229f <free+0x45>
+    2288:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    228c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2290:	72 2f                	jb     22c1 <free+0x67>
+    2292:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2296:	48 8b 00             	mov    (%rax),%rax
+    2299:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    229d:	72 22                	jb     22c1 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    229f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a3:	48 8b 00             	mov    (%rax),%rax
+    22a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    22aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22ae:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    22b2:	73 c7                	jae    227b <free+0x21>
+    22b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22b8:	48 8b 00             	mov    (%rax),%rax
+    22bb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    22bf:	73 ba                	jae    227b <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    22c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22c5:	8b 40 08             	mov    0x8(%rax),%eax
+    22c8:	89 c0                	mov    %eax,%eax
+    22ca:	48 c1 e0 04          	shl    $0x4,%rax
+    22ce:	48 89 c2             	mov    %rax,%rdx
+    22d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22d5:	48 01 c2             	add    %rax,%rdx
+    22d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22dc:	48 8b 00             	mov    (%rax),%rax
+    22df:	48 39 c2             	cmp    %rax,%rdx
+    22e2:	75 2d                	jne    2311 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    22e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22e8:	8b 50 08             	mov    0x8(%rax),%edx
+    22eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ef:	48 8b 00             	mov    (%rax),%rax
+    22f2:	8b 40 08             	mov    0x8(%rax),%eax
+    22f5:	01 c2                	add    %eax,%edx
+    22f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22fb:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    22fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2302:	48 8b 00             	mov    (%rax),%rax
+    2305:	48 8b 10             	mov    (%rax),%rdx
+    2308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    230c:	48 89 10             	mov    %rdx,(%rax)
+    230f:	eb 0e                	jmp    231f <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    2311:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2315:	48 8b 10             	mov    (%rax),%rdx
+    2318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    231c:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    231f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2323:	8b 40 08             	mov    0x8(%rax),%eax
+    2326:	89 c0                	mov    %eax,%eax
+    2328:	48 c1 e0 04          	shl    $0x4,%rax
+    232c:	48 89 c2             	mov    %rax,%rdx
+    232f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2333:	48 01 d0             	add    %rdx,%rax
+    2336:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    233a:	75 27                	jne    2363 <free+0x109>
+    p->s.size += bp->s.size;
+    233c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2340:	8b 50 08             	mov    0x8(%rax),%edx
+    2343:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2347:	8b 40 08             	mov    0x8(%rax),%eax
+    234a:	01 c2                	add    %eax,%edx
+    234c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2350:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2353:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2357:	48 8b 10             	mov    (%rax),%rdx
+    235a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    235e:	48 89 10             	mov    %rdx,(%rax)
+    2361:	eb 0b                	jmp    236e <free+0x114>
+  } else
+    p->s.ptr = bp;
+    2363:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2367:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    236b:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    236e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2372:	48 89 05 d7 0f 00 00 	mov    %rax,0xfd7(%rip)        # 3350 <freep>
+}
+    2379:	90                   	nop
+    237a:	5d                   	pop    %rbp
+    237b:	c3                   	ret
+
+000000000000237c <morecore>:
+
+static Header *morecore(uint nu) {
+    237c:	55                   	push   %rbp
+    237d:	48 89 e5             	mov    %rsp,%rbp
+    2380:	48 83 ec 20          	sub    $0x20,%rsp
+    2384:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    2387:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    238e:	77 07                	ja     2397 <morecore+0x1b>
+    nu = 4096;
+    2390:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    2397:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    239a:	c1 e0 04             	shl    $0x4,%eax
+    239d:	89 c7                	mov    %eax,%edi
+    239f:	e8 71 fe ff ff       	call   2215 <sbrk>
+    23a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    23a8:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    23ad:	75 07                	jne    23b6 <morecore+0x3a>
+    return 0;
+    23af:	b8 00 00 00 00       	mov    $0x0,%eax
+    23b4:	eb 29                	jmp    23df <morecore+0x63>
+  hp = (Header *)p;
+    23b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    23be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23c2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    23c5:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    23c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23cc:	48 83 c0 10          	add    $0x10,%rax
+    23d0:	48 89 c7             	mov    %rax,%rdi
+    23d3:	e8 82 fe ff ff       	call   225a <free>
+  return freep;
+    23d8:	48 8b 05 71 0f 00 00 	mov    0xf71(%rip),%rax        # 3350 <freep>
+}
+    23df:	c9                   	leave
+    23e0:	c3                   	ret
+
+00000000000023e1 <malloc>:
+
+void *malloc(uint nbytes) {
+    23e1:	55                   	push   %rbp
+    23e2:	48 89 e5             	mov    %rsp,%rbp
+    23e5:	48 83 ec 30          	sub    $0x30,%rsp
+    23e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    23ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    23ef:	48 83 c0 0f          	add    $0xf,%rax
+    23f3:	48 c1 e8 04          	shr    $0x4,%rax
+    23f7:	83 c0 01             	add    $0x1,%eax
+    23fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    23fd:	48 8b 05 4c 0f 00 00 	mov    0xf4c(%rip),%rax        # 3350 <freep>
+    2404:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2408:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    240d:	75 2e                	jne    243d <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    240f:	48 8d 05 2a 0f 00 00 	lea    0xf2a(%rip),%rax        # 3340 <base>
+    2416:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    241a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    241e:	48 89 05 2b 0f 00 00 	mov    %rax,0xf2b(%rip)        # 3350 <freep>
+    2425:	48 8b 05 24 0f 00 00 	mov    0xf24(%rip),%rax        # 3350 <freep>
+    242c:	48 89 05 0d 0f 00 00 	mov    %rax,0xf0d(%rip)        # 3340 <base>
+    base.s.size = 0;
+    2433:	c7 05 0b 0f 00 00 00 	movl   $0x0,0xf0b(%rip)        # 3348 <base+0x8>
+    243a:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    243d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2441:	48 8b 00             	mov    (%rax),%rax
+    2444:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    244c:	8b 40 08             	mov    0x8(%rax),%eax
+    244f:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    2452:	72 5f                	jb     24b3 <malloc+0xd2>
+      if (p->s.size == nunits)
+    2454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2458:	8b 40 08             	mov    0x8(%rax),%eax
+    245b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    245e:	75 10                	jne    2470 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    2460:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2464:	48 8b 10             	mov    (%rax),%rdx
+    2467:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    246b:	48 89 10             	mov    %rdx,(%rax)
+    246e:	eb 2e                	jmp    249e <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    2470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2474:	8b 40 08             	mov    0x8(%rax),%eax
+    2477:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    247a:	89 c2                	mov    %eax,%edx
+    247c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2480:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    2483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2487:	8b 40 08             	mov    0x8(%rax),%eax
+    248a:	89 c0                	mov    %eax,%eax
+    248c:	48 c1 e0 04          	shl    $0x4,%rax
+    2490:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    2494:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2498:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    249b:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    249e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24a2:	48 89 05 a7 0e 00 00 	mov    %rax,0xea7(%rip)        # 3350 <freep>
+      return (void *)(p + 1);
+    24a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24ad:	48 83 c0 10          	add    $0x10,%rax
+    24b1:	eb 41                	jmp    24f4 <malloc+0x113>
+    }
+    if (p == freep)
+    24b3:	48 8b 05 96 0e 00 00 	mov    0xe96(%rip),%rax        # 3350 <freep>
+    24ba:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    24be:	75 1c                	jne    24dc <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    24c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    24c3:	89 c7                	mov    %eax,%edi
+    24c5:	e8 b2 fe ff ff       	call   237c <morecore>
+    24ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    24ce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    24d3:	75 07                	jne    24dc <malloc+0xfb>
+        return 0;
+    24d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    24da:	eb 18                	jmp    24f4 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    24dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    24e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e8:	48 8b 00             	mov    (%rax),%rax
+    24eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    24ef:	e9 54 ff ff ff       	jmp    2448 <malloc+0x67>
+  }
+    24f4:	c9                   	leave
+    24f5:	c3                   	ret
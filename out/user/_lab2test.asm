@@ -0,0 +1,3536 @@
+
+out/user/_lab2test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void fdesctest(void);
+void racetest(void);
+void childpidtest(void);
+void exectest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+
+  if (open("console", O_RDWR) < 0) {
+       8:	be 02 00 00 00       	mov    $0x2,%esi
+       d:	48 8d 05 14 28 00 00 	lea    0x2814(%rip),%rax        # 2828 <malloc+0x11c>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 dc 24 00 00       	call   24f8 <open>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	79 5c                	jns    7c <main+0x7c>
+    error("main: failed to open console file\n");
+      20:	8b 05 da 33 00 00    	mov    0x33da(%rip),%eax        # 3400 <stdout>
+      26:	ba 29 00 00 00       	mov    $0x29,%edx
+      2b:	48 8d 0d fe 27 00 00 	lea    0x27fe(%rip),%rcx        # 2830 <malloc+0x124>
+      32:	48 89 ce             	mov    %rcx,%rsi
+      35:	89 c7                	mov    %eax,%edi
+      37:	b8 00 00 00 00       	mov    $0x0,%eax
+      3c:	e8 d0 1e 00 00       	call   1f11 <printf>
+      41:	8b 05 b9 33 00 00    	mov    0x33b9(%rip),%eax        # 3400 <stdout>
+      47:	48 8d 15 fa 27 00 00 	lea    0x27fa(%rip),%rdx        # 2848 <malloc+0x13c>
+      4e:	48 89 d6             	mov    %rdx,%rsi
+      51:	89 c7                	mov    %eax,%edi
+      53:	b8 00 00 00 00       	mov    $0x0,%eax
+      58:	e8 b4 1e 00 00       	call   1f11 <printf>
+      5d:	8b 05 9d 33 00 00    	mov    0x339d(%rip),%eax        # 3400 <stdout>
+      63:	48 8d 15 01 28 00 00 	lea    0x2801(%rip),%rdx        # 286b <malloc+0x15f>
+      6a:	48 89 d6             	mov    %rdx,%rsi
+      6d:	89 c7                	mov    %eax,%edi
+      6f:	b8 00 00 00 00       	mov    $0x0,%eax
+      74:	e8 98 1e 00 00       	call   1f11 <printf>
+      79:	90                   	nop
+      7a:	eb fd                	jmp    79 <main+0x79>
+  }
+  dup(0); // stdout
+      7c:	bf 00 00 00 00       	mov    $0x0,%edi
+      81:	e8 aa 24 00 00       	call   2530 <dup>
+  dup(0); // stderr
+      86:	bf 00 00 00 00       	mov    $0x0,%edi
+      8b:	e8 a0 24 00 00       	call   2530 <dup>
+
+  pid = fork();
+      90:	e8 1b 24 00 00       	call   24b0 <fork>
+      95:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid < 0) {
+      98:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      9c:	79 1e                	jns    bc <main+0xbc>
+    printf(1, "fork failed\n");
+      9e:	48 8d 05 c8 27 00 00 	lea    0x27c8(%rip),%rax        # 286d <malloc+0x161>
+      a5:	48 89 c6             	mov    %rax,%rsi
+      a8:	bf 01 00 00 00       	mov    $0x1,%edi
+      ad:	b8 00 00 00 00       	mov    $0x0,%eax
+      b2:	e8 5a 1e 00 00       	call   1f11 <printf>
+    exit();
+      b7:	e8 fc 23 00 00       	call   24b8 <exit>
+  }
+
+  if (pid == 0) {
+      bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      c0:	75 5d                	jne    11f <main+0x11f>
+    forktest();
+      c2:	e8 73 00 00 00       	call   13a <forktest>
+    racetest();
+      c7:	e8 03 0d 00 00       	call   dcf <racetest>
+    fdesctest();
+      cc:	e8 17 0e 00 00       	call   ee8 <fdesctest>
+    pipetest();
+      d1:	e8 19 02 00 00       	call   2ef <pipetest>
+    extendedpipetest();
+      d6:	e8 8c 05 00 00       	call   667 <extendedpipetest>
+    childpidtest();
+      db:	e8 3e 15 00 00       	call   161e <childpidtest>
+    exectest();
+      e0:	e8 7c 15 00 00       	call   1661 <exectest>
+    pkilltest();
+      e5:	e8 ed 0a 00 00       	call   bd7 <pkilltest>
+
+    printf(1, "lab2 tests passed!!\n");
+      ea:	48 8d 05 89 27 00 00 	lea    0x2789(%rip),%rax        # 287a <malloc+0x16e>
+      f1:	48 89 c6             	mov    %rax,%rsi
+      f4:	bf 01 00 00 00       	mov    $0x1,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 0e 1e 00 00       	call   1f11 <printf>
+
+    while (1)
+     103:	90                   	nop
+     104:	eb fd                	jmp    103 <main+0x103>
+      ;
+  }
+
+  while ((wpid = wait()) >= 0 && wpid != pid)
+    printf(1, "zombie!\n");
+     106:	48 8d 05 82 27 00 00 	lea    0x2782(%rip),%rax        # 288f <malloc+0x183>
+     10d:	48 89 c6             	mov    %rax,%rsi
+     110:	bf 01 00 00 00       	mov    $0x1,%edi
+     115:	b8 00 00 00 00       	mov    $0x0,%eax
+     11a:	e8 f2 1d 00 00       	call   1f11 <printf>
+  while ((wpid = wait()) >= 0 && wpid != pid)
+     11f:	e8 9c 23 00 00       	call   24c0 <wait>
+     124:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     127:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     12b:	78 08                	js     135 <main+0x135>
+     12d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     130:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+     133:	75 d1                	jne    106 <main+0x106>
+
+  exit();
+     135:	e8 7e 23 00 00       	call   24b8 <exit>
+
+000000000000013a <forktest>:
+  return 0;
+}
+
+void forktest(void) {
+     13a:	55                   	push   %rbp
+     13b:	48 89 e5             	mov    %rsp,%rbp
+     13e:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, pid;
+  int nproc = 6;
+     142:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+
+  printf(1, "forktest\n");
+     149:	48 8d 05 48 27 00 00 	lea    0x2748(%rip),%rax        # 2898 <malloc+0x18c>
+     150:	48 89 c6             	mov    %rax,%rsi
+     153:	bf 01 00 00 00       	mov    $0x1,%edi
+     158:	b8 00 00 00 00       	mov    $0x0,%eax
+     15d:	e8 af 1d 00 00       	call   1f11 <printf>
+
+  for (n = 0; n < nproc; n++) {
+     162:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     169:	eb 1d                	jmp    188 <forktest+0x4e>
+    pid = fork();
+     16b:	e8 40 23 00 00       	call   24b0 <fork>
+     170:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (pid < 0)
+     173:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     177:	78 19                	js     192 <forktest+0x58>
+      break;
+    if (pid == 0) {
+     179:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     17d:	75 05                	jne    184 <forktest+0x4a>
+      exit();
+     17f:	e8 34 23 00 00       	call   24b8 <exit>
+  for (n = 0; n < nproc; n++) {
+     184:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     188:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     18b:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     18e:	7c db                	jl     16b <forktest+0x31>
+     190:	eb 01                	jmp    193 <forktest+0x59>
+      break;
+     192:	90                   	nop
+      error("forktest: exit failed to destroy this process");
+    }
+  }
+
+  if (n != nproc) {
+     193:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     196:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     199:	0f 84 c8 00 00 00    	je     267 <forktest+0x12d>
+    error("forktest: fork claimed to work %d times! but only %d\n", nproc, n);
+     19f:	8b 05 5b 32 00 00    	mov    0x325b(%rip),%eax        # 3400 <stdout>
+     1a5:	ba 5c 00 00 00       	mov    $0x5c,%edx
+     1aa:	48 8d 0d 7f 26 00 00 	lea    0x267f(%rip),%rcx        # 2830 <malloc+0x124>
+     1b1:	48 89 ce             	mov    %rcx,%rsi
+     1b4:	89 c7                	mov    %eax,%edi
+     1b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1bb:	e8 51 1d 00 00       	call   1f11 <printf>
+     1c0:	8b 05 3a 32 00 00    	mov    0x323a(%rip),%eax        # 3400 <stdout>
+     1c6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     1c9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     1cc:	48 8d 35 d5 26 00 00 	lea    0x26d5(%rip),%rsi        # 28a8 <malloc+0x19c>
+     1d3:	89 c7                	mov    %eax,%edi
+     1d5:	b8 00 00 00 00       	mov    $0x0,%eax
+     1da:	e8 32 1d 00 00       	call   1f11 <printf>
+     1df:	8b 05 1b 32 00 00    	mov    0x321b(%rip),%eax        # 3400 <stdout>
+     1e5:	48 8d 15 7f 26 00 00 	lea    0x267f(%rip),%rdx        # 286b <malloc+0x15f>
+     1ec:	48 89 d6             	mov    %rdx,%rsi
+     1ef:	89 c7                	mov    %eax,%edi
+     1f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f6:	e8 16 1d 00 00       	call   1f11 <printf>
+     1fb:	90                   	nop
+     1fc:	eb fd                	jmp    1fb <forktest+0xc1>
+  }
+
+  for (; n > 0; n--) {
+    if (wait() < 0) {
+     1fe:	e8 bd 22 00 00       	call   24c0 <wait>
+     203:	85 c0                	test   %eax,%eax
+     205:	79 5c                	jns    263 <forktest+0x129>
+      error("forktest: wait stopped early\n");
+     207:	8b 05 f3 31 00 00    	mov    0x31f3(%rip),%eax        # 3400 <stdout>
+     20d:	ba 61 00 00 00       	mov    $0x61,%edx
+     212:	48 8d 0d 17 26 00 00 	lea    0x2617(%rip),%rcx        # 2830 <malloc+0x124>
+     219:	48 89 ce             	mov    %rcx,%rsi
+     21c:	89 c7                	mov    %eax,%edi
+     21e:	b8 00 00 00 00       	mov    $0x0,%eax
+     223:	e8 e9 1c 00 00       	call   1f11 <printf>
+     228:	8b 05 d2 31 00 00    	mov    0x31d2(%rip),%eax        # 3400 <stdout>
+     22e:	48 8d 15 a9 26 00 00 	lea    0x26a9(%rip),%rdx        # 28de <malloc+0x1d2>
+     235:	48 89 d6             	mov    %rdx,%rsi
+     238:	89 c7                	mov    %eax,%edi
+     23a:	b8 00 00 00 00       	mov    $0x0,%eax
+     23f:	e8 cd 1c 00 00       	call   1f11 <printf>
+     244:	8b 05 b6 31 00 00    	mov    0x31b6(%rip),%eax        # 3400 <stdout>
+     24a:	48 8d 15 1a 26 00 00 	lea    0x261a(%rip),%rdx        # 286b <malloc+0x15f>
+     251:	48 89 d6             	mov    %rdx,%rsi
+     254:	89 c7                	mov    %eax,%edi
+     256:	b8 00 00 00 00       	mov    $0x0,%eax
+     25b:	e8 b1 1c 00 00       	call   1f11 <printf>
+     260:	90                   	nop
+     261:	eb fd                	jmp    260 <forktest+0x126>
+  for (; n > 0; n--) {
+     263:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     267:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     26b:	7f 91                	jg     1fe <forktest+0xc4>
+    }
+  }
+
+  if (wait() != -1) {
+     26d:	e8 4e 22 00 00       	call   24c0 <wait>
+     272:	83 f8 ff             	cmp    $0xffffffff,%eax
+     275:	74 5c                	je     2d3 <forktest+0x199>
+    error("forktest: wait got too many\n");
+     277:	8b 05 83 31 00 00    	mov    0x3183(%rip),%eax        # 3400 <stdout>
+     27d:	ba 66 00 00 00       	mov    $0x66,%edx
+     282:	48 8d 0d a7 25 00 00 	lea    0x25a7(%rip),%rcx        # 2830 <malloc+0x124>
+     289:	48 89 ce             	mov    %rcx,%rsi
+     28c:	89 c7                	mov    %eax,%edi
+     28e:	b8 00 00 00 00       	mov    $0x0,%eax
+     293:	e8 79 1c 00 00       	call   1f11 <printf>
+     298:	8b 05 62 31 00 00    	mov    0x3162(%rip),%eax        # 3400 <stdout>
+     29e:	48 8d 15 57 26 00 00 	lea    0x2657(%rip),%rdx        # 28fc <malloc+0x1f0>
+     2a5:	48 89 d6             	mov    %rdx,%rsi
+     2a8:	89 c7                	mov    %eax,%edi
+     2aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     2af:	e8 5d 1c 00 00       	call   1f11 <printf>
+     2b4:	8b 05 46 31 00 00    	mov    0x3146(%rip),%eax        # 3400 <stdout>
+     2ba:	48 8d 15 aa 25 00 00 	lea    0x25aa(%rip),%rdx        # 286b <malloc+0x15f>
+     2c1:	48 89 d6             	mov    %rdx,%rsi
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cb:	e8 41 1c 00 00       	call   1f11 <printf>
+     2d0:	90                   	nop
+     2d1:	eb fd                	jmp    2d0 <forktest+0x196>
+  }
+
+  printf(1, "forktest: ok\n");
+     2d3:	48 8d 05 3f 26 00 00 	lea    0x263f(%rip),%rax        # 2919 <malloc+0x20d>
+     2da:	48 89 c6             	mov    %rax,%rsi
+     2dd:	bf 01 00 00 00       	mov    $0x1,%edi
+     2e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e7:	e8 25 1c 00 00       	call   1f11 <printf>
+}
+     2ec:	90                   	nop
+     2ed:	c9                   	leave
+     2ee:	c3                   	ret
+
+00000000000002ef <pipetest>:
+
+void pipetest(void) {
+     2ef:	55                   	push   %rbp
+     2f0:	48 89 e5             	mov    %rsp,%rbp
+     2f3:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  char buf[500];
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  printf(1, "pipetest\n");
+     2fa:	48 8d 05 26 26 00 00 	lea    0x2626(%rip),%rax        # 2927 <malloc+0x21b>
+     301:	48 89 c6             	mov    %rax,%rsi
+     304:	bf 01 00 00 00       	mov    $0x1,%edi
+     309:	b8 00 00 00 00       	mov    $0x0,%eax
+     30e:	e8 fe 1b 00 00       	call   1f11 <printf>
+
+  if (pipe(fds) != 0) {
+     313:	48 8d 85 ec fd ff ff 	lea    -0x214(%rbp),%rax
+     31a:	48 89 c7             	mov    %rax,%rdi
+     31d:	e8 a6 21 00 00       	call   24c8 <pipe>
+     322:	85 c0                	test   %eax,%eax
+     324:	74 5c                	je     382 <pipetest+0x93>
+    error("pipetest: pipe() failed\n");
+     326:	8b 05 d4 30 00 00    	mov    0x30d4(%rip),%eax        # 3400 <stdout>
+     32c:	ba 74 00 00 00       	mov    $0x74,%edx
+     331:	48 8d 0d f8 24 00 00 	lea    0x24f8(%rip),%rcx        # 2830 <malloc+0x124>
+     338:	48 89 ce             	mov    %rcx,%rsi
+     33b:	89 c7                	mov    %eax,%edi
+     33d:	b8 00 00 00 00       	mov    $0x0,%eax
+     342:	e8 ca 1b 00 00       	call   1f11 <printf>
+     347:	8b 05 b3 30 00 00    	mov    0x30b3(%rip),%eax        # 3400 <stdout>
+     34d:	48 8d 15 dd 25 00 00 	lea    0x25dd(%rip),%rdx        # 2931 <malloc+0x225>
+     354:	48 89 d6             	mov    %rdx,%rsi
+     357:	89 c7                	mov    %eax,%edi
+     359:	b8 00 00 00 00       	mov    $0x0,%eax
+     35e:	e8 ae 1b 00 00       	call   1f11 <printf>
+     363:	8b 05 97 30 00 00    	mov    0x3097(%rip),%eax        # 3400 <stdout>
+     369:	48 8d 15 fb 24 00 00 	lea    0x24fb(%rip),%rdx        # 286b <malloc+0x15f>
+     370:	48 89 d6             	mov    %rdx,%rsi
+     373:	89 c7                	mov    %eax,%edi
+     375:	b8 00 00 00 00       	mov    $0x0,%eax
+     37a:	e8 92 1b 00 00       	call   1f11 <printf>
+     37f:	90                   	nop
+     380:	eb fd                	jmp    37f <pipetest+0x90>
+  }
+  pid = fork();
+     382:	e8 29 21 00 00       	call   24b0 <fork>
+     387:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  seq = 0;
+     38a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (pid == 0) {
+     391:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     395:	0f 85 d3 00 00 00    	jne    46e <pipetest+0x17f>
+    close(fds[0]);
+     39b:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     3a1:	89 c7                	mov    %eax,%edi
+     3a3:	e8 38 21 00 00       	call   24e0 <close>
+    for (n = 0; n < 5; n++) {
+     3a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     3af:	e9 ab 00 00 00       	jmp    45f <pipetest+0x170>
+      for (i = 0; i < 95; i++)
+     3b4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     3bb:	eb 1b                	jmp    3d8 <pipetest+0xe9>
+        buf[i] = seq++;
+     3bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3c0:	8d 50 01             	lea    0x1(%rax),%edx
+     3c3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3c6:	89 c2                	mov    %eax,%edx
+     3c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3cb:	48 98                	cltq
+     3cd:	88 94 05 f4 fd ff ff 	mov    %dl,-0x20c(%rbp,%rax,1)
+      for (i = 0; i < 95; i++)
+     3d4:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     3d8:	83 7d f8 5e          	cmpl   $0x5e,-0x8(%rbp)
+     3dc:	7e df                	jle    3bd <pipetest+0xce>
+      if (write(fds[1], buf, 95) != 95) {
+     3de:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     3e4:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     3eb:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     3f0:	48 89 ce             	mov    %rcx,%rsi
+     3f3:	89 c7                	mov    %eax,%edi
+     3f5:	e8 de 20 00 00       	call   24d8 <write>
+     3fa:	83 f8 5f             	cmp    $0x5f,%eax
+     3fd:	74 5c                	je     45b <pipetest+0x16c>
+        error("pipetest: oops 1\n");
+     3ff:	8b 05 fb 2f 00 00    	mov    0x2ffb(%rip),%eax        # 3400 <stdout>
+     405:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     40a:	48 8d 0d 1f 24 00 00 	lea    0x241f(%rip),%rcx        # 2830 <malloc+0x124>
+     411:	48 89 ce             	mov    %rcx,%rsi
+     414:	89 c7                	mov    %eax,%edi
+     416:	b8 00 00 00 00       	mov    $0x0,%eax
+     41b:	e8 f1 1a 00 00       	call   1f11 <printf>
+     420:	8b 05 da 2f 00 00    	mov    0x2fda(%rip),%eax        # 3400 <stdout>
+     426:	48 8d 15 1d 25 00 00 	lea    0x251d(%rip),%rdx        # 294a <malloc+0x23e>
+     42d:	48 89 d6             	mov    %rdx,%rsi
+     430:	89 c7                	mov    %eax,%edi
+     432:	b8 00 00 00 00       	mov    $0x0,%eax
+     437:	e8 d5 1a 00 00       	call   1f11 <printf>
+     43c:	8b 05 be 2f 00 00    	mov    0x2fbe(%rip),%eax        # 3400 <stdout>
+     442:	48 8d 15 22 24 00 00 	lea    0x2422(%rip),%rdx        # 286b <malloc+0x15f>
+     449:	48 89 d6             	mov    %rdx,%rsi
+     44c:	89 c7                	mov    %eax,%edi
+     44e:	b8 00 00 00 00       	mov    $0x0,%eax
+     453:	e8 b9 1a 00 00       	call   1f11 <printf>
+     458:	90                   	nop
+     459:	eb fd                	jmp    458 <pipetest+0x169>
+    for (n = 0; n < 5; n++) {
+     45b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     45f:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+     463:	0f 8e 4b ff ff ff    	jle    3b4 <pipetest+0xc5>
+      }
+    }
+    exit();
+     469:	e8 4a 20 00 00       	call   24b8 <exit>
+  } else if (pid > 0) {
+     46e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     472:	0f 8e 77 01 00 00    	jle    5ef <pipetest+0x300>
+    close(fds[1]);
+     478:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     47e:	89 c7                	mov    %eax,%edi
+     480:	e8 5b 20 00 00       	call   24e0 <close>
+    total = 0;
+     485:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    cc = 1;
+     48c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     493:	e9 b4 00 00 00       	jmp    54c <pipetest+0x25d>
+      for (i = 0; i < n; i++) {
+     498:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     49f:	e9 82 00 00 00       	jmp    526 <pipetest+0x237>
+        if ((buf[i] & 0xff) != (seq++ & 0xff)) {
+     4a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4a7:	48 98                	cltq
+     4a9:	0f b6 84 05 f4 fd ff 	movzbl -0x20c(%rbp,%rax,1),%eax
+     4b0:	ff 
+     4b1:	0f be c8             	movsbl %al,%ecx
+     4b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4b7:	8d 50 01             	lea    0x1(%rax),%edx
+     4ba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4bd:	31 c8                	xor    %ecx,%eax
+     4bf:	0f b6 c0             	movzbl %al,%eax
+     4c2:	85 c0                	test   %eax,%eax
+     4c4:	74 5c                	je     522 <pipetest+0x233>
+          error("pipetest: oops 2\n");
+     4c6:	8b 05 34 2f 00 00    	mov    0x2f34(%rip),%eax        # 3400 <stdout>
+     4cc:	ba 89 00 00 00       	mov    $0x89,%edx
+     4d1:	48 8d 0d 58 23 00 00 	lea    0x2358(%rip),%rcx        # 2830 <malloc+0x124>
+     4d8:	48 89 ce             	mov    %rcx,%rsi
+     4db:	89 c7                	mov    %eax,%edi
+     4dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e2:	e8 2a 1a 00 00       	call   1f11 <printf>
+     4e7:	8b 05 13 2f 00 00    	mov    0x2f13(%rip),%eax        # 3400 <stdout>
+     4ed:	48 8d 15 68 24 00 00 	lea    0x2468(%rip),%rdx        # 295c <malloc+0x250>
+     4f4:	48 89 d6             	mov    %rdx,%rsi
+     4f7:	89 c7                	mov    %eax,%edi
+     4f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fe:	e8 0e 1a 00 00       	call   1f11 <printf>
+     503:	8b 05 f7 2e 00 00    	mov    0x2ef7(%rip),%eax        # 3400 <stdout>
+     509:	48 8d 15 5b 23 00 00 	lea    0x235b(%rip),%rdx        # 286b <malloc+0x15f>
+     510:	48 89 d6             	mov    %rdx,%rsi
+     513:	89 c7                	mov    %eax,%edi
+     515:	b8 00 00 00 00       	mov    $0x0,%eax
+     51a:	e8 f2 19 00 00       	call   1f11 <printf>
+     51f:	90                   	nop
+     520:	eb fd                	jmp    51f <pipetest+0x230>
+      for (i = 0; i < n; i++) {
+     522:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     526:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     529:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     52c:	0f 8c 72 ff ff ff    	jl     4a4 <pipetest+0x1b5>
+        }
+      }
+      total += n;
+     532:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     535:	01 45 ec             	add    %eax,-0x14(%rbp)
+      cc = cc * 2;
+     538:	d1 65 f0             	shll   -0x10(%rbp)
+      if (cc > sizeof(buf))
+     53b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     53e:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     543:	76 07                	jbe    54c <pipetest+0x25d>
+        cc = sizeof(buf);
+     545:	c7 45 f0 f4 01 00 00 	movl   $0x1f4,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     54c:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     552:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     555:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     55c:	48 89 ce             	mov    %rcx,%rsi
+     55f:	89 c7                	mov    %eax,%edi
+     561:	e8 6a 1f 00 00       	call   24d0 <read>
+     566:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     569:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     56d:	0f 8f 25 ff ff ff    	jg     498 <pipetest+0x1a9>
+    }
+    if (total != 5 * 95) {
+     573:	81 7d ec db 01 00 00 	cmpl   $0x1db,-0x14(%rbp)
+     57a:	74 5f                	je     5db <pipetest+0x2ec>
+      error("pipetest: oops 3 total %d\n", total);
+     57c:	8b 05 7e 2e 00 00    	mov    0x2e7e(%rip),%eax        # 3400 <stdout>
+     582:	ba 92 00 00 00       	mov    $0x92,%edx
+     587:	48 8d 0d a2 22 00 00 	lea    0x22a2(%rip),%rcx        # 2830 <malloc+0x124>
+     58e:	48 89 ce             	mov    %rcx,%rsi
+     591:	89 c7                	mov    %eax,%edi
+     593:	b8 00 00 00 00       	mov    $0x0,%eax
+     598:	e8 74 19 00 00       	call   1f11 <printf>
+     59d:	8b 05 5d 2e 00 00    	mov    0x2e5d(%rip),%eax        # 3400 <stdout>
+     5a3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     5a6:	48 8d 0d c1 23 00 00 	lea    0x23c1(%rip),%rcx        # 296e <malloc+0x262>
+     5ad:	48 89 ce             	mov    %rcx,%rsi
+     5b0:	89 c7                	mov    %eax,%edi
+     5b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     5b7:	e8 55 19 00 00       	call   1f11 <printf>
+     5bc:	8b 05 3e 2e 00 00    	mov    0x2e3e(%rip),%eax        # 3400 <stdout>
+     5c2:	48 8d 15 a2 22 00 00 	lea    0x22a2(%rip),%rdx        # 286b <malloc+0x15f>
+     5c9:	48 89 d6             	mov    %rdx,%rsi
+     5cc:	89 c7                	mov    %eax,%edi
+     5ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     5d3:	e8 39 19 00 00       	call   1f11 <printf>
+     5d8:	90                   	nop
+     5d9:	eb fd                	jmp    5d8 <pipetest+0x2e9>
+    }
+    close(fds[0]);
+     5db:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     5e1:	89 c7                	mov    %eax,%edi
+     5e3:	e8 f8 1e 00 00       	call   24e0 <close>
+    wait();
+     5e8:	e8 d3 1e 00 00       	call   24c0 <wait>
+     5ed:	eb 5c                	jmp    64b <pipetest+0x35c>
+  } else {
+    error("pipetest: fork() failed\n");
+     5ef:	8b 05 0b 2e 00 00    	mov    0x2e0b(%rip),%eax        # 3400 <stdout>
+     5f5:	ba 97 00 00 00       	mov    $0x97,%edx
+     5fa:	48 8d 0d 2f 22 00 00 	lea    0x222f(%rip),%rcx        # 2830 <malloc+0x124>
+     601:	48 89 ce             	mov    %rcx,%rsi
+     604:	89 c7                	mov    %eax,%edi
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	e8 01 19 00 00       	call   1f11 <printf>
+     610:	8b 05 ea 2d 00 00    	mov    0x2dea(%rip),%eax        # 3400 <stdout>
+     616:	48 8d 15 6c 23 00 00 	lea    0x236c(%rip),%rdx        # 2989 <malloc+0x27d>
+     61d:	48 89 d6             	mov    %rdx,%rsi
+     620:	89 c7                	mov    %eax,%edi
+     622:	b8 00 00 00 00       	mov    $0x0,%eax
+     627:	e8 e5 18 00 00       	call   1f11 <printf>
+     62c:	8b 05 ce 2d 00 00    	mov    0x2dce(%rip),%eax        # 3400 <stdout>
+     632:	48 8d 15 32 22 00 00 	lea    0x2232(%rip),%rdx        # 286b <malloc+0x15f>
+     639:	48 89 d6             	mov    %rdx,%rsi
+     63c:	89 c7                	mov    %eax,%edi
+     63e:	b8 00 00 00 00       	mov    $0x0,%eax
+     643:	e8 c9 18 00 00       	call   1f11 <printf>
+     648:	90                   	nop
+     649:	eb fd                	jmp    648 <pipetest+0x359>
+  }
+  printf(1, "pipetest: ok\n");
+     64b:	48 8d 05 50 23 00 00 	lea    0x2350(%rip),%rax        # 29a2 <malloc+0x296>
+     652:	48 89 c6             	mov    %rax,%rsi
+     655:	bf 01 00 00 00       	mov    $0x1,%edi
+     65a:	b8 00 00 00 00       	mov    $0x0,%eax
+     65f:	e8 ad 18 00 00       	call   1f11 <printf>
+}
+     664:	90                   	nop
+     665:	c9                   	leave
+     666:	c3                   	ret
+
+0000000000000667 <extendedpipetest>:
+
+void extendedpipetest(void) {
+     667:	55                   	push   %rbp
+     668:	48 89 e5             	mov    %rsp,%rbp
+     66b:	48 83 ec 30          	sub    $0x30,%rsp
+  // read return remaining bytes when write-end is closed,
+  // then return 0 at EOF
+  int pid;
+  int fds[2];
+  char *buf = "pipetestwrite";
+     66f:	48 8d 05 3a 23 00 00 	lea    0x233a(%rip),%rax        # 29b0 <malloc+0x2a4>
+     676:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  printf(1, "extendedpipetest\n");
+     67a:	48 8d 05 3d 23 00 00 	lea    0x233d(%rip),%rax        # 29be <malloc+0x2b2>
+     681:	48 89 c6             	mov    %rax,%rsi
+     684:	bf 01 00 00 00       	mov    $0x1,%edi
+     689:	b8 00 00 00 00       	mov    $0x0,%eax
+     68e:	e8 7e 18 00 00       	call   1f11 <printf>
+  if (pipe(fds) != 0) {
+     693:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     697:	48 89 c7             	mov    %rax,%rdi
+     69a:	e8 29 1e 00 00       	call   24c8 <pipe>
+     69f:	85 c0                	test   %eax,%eax
+     6a1:	74 5c                	je     6ff <extendedpipetest+0x98>
+    error("extended pipe test: pipe() failed\n");
+     6a3:	8b 05 57 2d 00 00    	mov    0x2d57(%rip),%eax        # 3400 <stdout>
+     6a9:	ba a5 00 00 00       	mov    $0xa5,%edx
+     6ae:	48 8d 0d 7b 21 00 00 	lea    0x217b(%rip),%rcx        # 2830 <malloc+0x124>
+     6b5:	48 89 ce             	mov    %rcx,%rsi
+     6b8:	89 c7                	mov    %eax,%edi
+     6ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     6bf:	e8 4d 18 00 00       	call   1f11 <printf>
+     6c4:	8b 05 36 2d 00 00    	mov    0x2d36(%rip),%eax        # 3400 <stdout>
+     6ca:	48 8d 15 ff 22 00 00 	lea    0x22ff(%rip),%rdx        # 29d0 <malloc+0x2c4>
+     6d1:	48 89 d6             	mov    %rdx,%rsi
+     6d4:	89 c7                	mov    %eax,%edi
+     6d6:	b8 00 00 00 00       	mov    $0x0,%eax
+     6db:	e8 31 18 00 00       	call   1f11 <printf>
+     6e0:	8b 05 1a 2d 00 00    	mov    0x2d1a(%rip),%eax        # 3400 <stdout>
+     6e6:	48 8d 15 7e 21 00 00 	lea    0x217e(%rip),%rdx        # 286b <malloc+0x15f>
+     6ed:	48 89 d6             	mov    %rdx,%rsi
+     6f0:	89 c7                	mov    %eax,%edi
+     6f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f7:	e8 15 18 00 00       	call   1f11 <printf>
+     6fc:	90                   	nop
+     6fd:	eb fd                	jmp    6fc <extendedpipetest+0x95>
+  }
+  pid = fork();
+     6ff:	e8 ac 1d 00 00       	call   24b0 <fork>
+     704:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (pid == 0) {
+     707:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     70b:	0f 85 86 00 00 00    	jne    797 <extendedpipetest+0x130>
+    sleep(100);
+     711:	bf 64 00 00 00       	mov    $0x64,%edi
+     716:	e8 2d 1e 00 00       	call   2548 <sleep>
+    if (write(fds[1], buf, 14) != 14) {
+     71b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     71e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     722:	ba 0e 00 00 00       	mov    $0xe,%edx
+     727:	48 89 ce             	mov    %rcx,%rsi
+     72a:	89 c7                	mov    %eax,%edi
+     72c:	e8 a7 1d 00 00       	call   24d8 <write>
+     731:	83 f8 0e             	cmp    $0xe,%eax
+     734:	74 5c                	je     792 <extendedpipetest+0x12b>
+      error("extended pipe test: oops 1\n");
+     736:	8b 05 c4 2c 00 00    	mov    0x2cc4(%rip),%eax        # 3400 <stdout>
+     73c:	ba ab 00 00 00       	mov    $0xab,%edx
+     741:	48 8d 0d e8 20 00 00 	lea    0x20e8(%rip),%rcx        # 2830 <malloc+0x124>
+     748:	48 89 ce             	mov    %rcx,%rsi
+     74b:	89 c7                	mov    %eax,%edi
+     74d:	b8 00 00 00 00       	mov    $0x0,%eax
+     752:	e8 ba 17 00 00       	call   1f11 <printf>
+     757:	8b 05 a3 2c 00 00    	mov    0x2ca3(%rip),%eax        # 3400 <stdout>
+     75d:	48 8d 15 8f 22 00 00 	lea    0x228f(%rip),%rdx        # 29f3 <malloc+0x2e7>
+     764:	48 89 d6             	mov    %rdx,%rsi
+     767:	89 c7                	mov    %eax,%edi
+     769:	b8 00 00 00 00       	mov    $0x0,%eax
+     76e:	e8 9e 17 00 00       	call   1f11 <printf>
+     773:	8b 05 87 2c 00 00    	mov    0x2c87(%rip),%eax        # 3400 <stdout>
+     779:	48 8d 15 eb 20 00 00 	lea    0x20eb(%rip),%rdx        # 286b <malloc+0x15f>
+     780:	48 89 d6             	mov    %rdx,%rsi
+     783:	89 c7                	mov    %eax,%edi
+     785:	b8 00 00 00 00       	mov    $0x0,%eax
+     78a:	e8 82 17 00 00       	call   1f11 <printf>
+     78f:	90                   	nop
+     790:	eb fd                	jmp    78f <extendedpipetest+0x128>
+    }
+    exit();
+     792:	e8 21 1d 00 00       	call   24b8 <exit>
+  } else if (pid > 0) {
+     797:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     79b:	0f 8e 5d 02 00 00    	jle    9fe <extendedpipetest+0x397>
+    close(fds[1]);
+     7a1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7a4:	89 c7                	mov    %eax,%edi
+     7a6:	e8 35 1d 00 00       	call   24e0 <close>
+    if (wait() != pid) {
+     7ab:	e8 10 1d 00 00       	call   24c0 <wait>
+     7b0:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     7b3:	74 5c                	je     811 <extendedpipetest+0x1aa>
+      error("extended pipe test: wait() failed\n");
+     7b5:	8b 05 45 2c 00 00    	mov    0x2c45(%rip),%eax        # 3400 <stdout>
+     7bb:	ba b1 00 00 00       	mov    $0xb1,%edx
+     7c0:	48 8d 0d 69 20 00 00 	lea    0x2069(%rip),%rcx        # 2830 <malloc+0x124>
+     7c7:	48 89 ce             	mov    %rcx,%rsi
+     7ca:	89 c7                	mov    %eax,%edi
+     7cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d1:	e8 3b 17 00 00       	call   1f11 <printf>
+     7d6:	8b 05 24 2c 00 00    	mov    0x2c24(%rip),%eax        # 3400 <stdout>
+     7dc:	48 8d 15 2d 22 00 00 	lea    0x222d(%rip),%rdx        # 2a10 <malloc+0x304>
+     7e3:	48 89 d6             	mov    %rdx,%rsi
+     7e6:	89 c7                	mov    %eax,%edi
+     7e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ed:	e8 1f 17 00 00       	call   1f11 <printf>
+     7f2:	8b 05 08 2c 00 00    	mov    0x2c08(%rip),%eax        # 3400 <stdout>
+     7f8:	48 8d 15 6c 20 00 00 	lea    0x206c(%rip),%rdx        # 286b <malloc+0x15f>
+     7ff:	48 89 d6             	mov    %rdx,%rsi
+     802:	89 c7                	mov    %eax,%edi
+     804:	b8 00 00 00 00       	mov    $0x0,%eax
+     809:	e8 03 17 00 00       	call   1f11 <printf>
+     80e:	90                   	nop
+     80f:	eb fd                	jmp    80e <extendedpipetest+0x1a7>
+    }
+
+    int bytes_to_read = 14;
+     811:	c7 45 fc 0e 00 00 00 	movl   $0xe,-0x4(%rbp)
+    int n = 0;
+     818:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    char buf2[14];
+    while(bytes_to_read > 0) {
+     81f:	e9 8e 00 00 00       	jmp    8b2 <extendedpipetest+0x24b>
+      int retval = read(fds[0], buf2 + n, bytes_to_read);
+     824:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     827:	48 98                	cltq
+     829:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     82d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     831:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     834:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     837:	48 89 ce             	mov    %rcx,%rsi
+     83a:	89 c7                	mov    %eax,%edi
+     83c:	e8 8f 1c 00 00       	call   24d0 <read>
+     841:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      if (retval <= 0) {
+     844:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     848:	7f 5c                	jg     8a6 <extendedpipetest+0x23f>
+        error("extended pipe test: read() failed\n");
+     84a:	8b 05 b0 2b 00 00    	mov    0x2bb0(%rip),%eax        # 3400 <stdout>
+     850:	ba ba 00 00 00       	mov    $0xba,%edx
+     855:	48 8d 0d d4 1f 00 00 	lea    0x1fd4(%rip),%rcx        # 2830 <malloc+0x124>
+     85c:	48 89 ce             	mov    %rcx,%rsi
+     85f:	89 c7                	mov    %eax,%edi
+     861:	b8 00 00 00 00       	mov    $0x0,%eax
+     866:	e8 a6 16 00 00       	call   1f11 <printf>
+     86b:	8b 05 8f 2b 00 00    	mov    0x2b8f(%rip),%eax        # 3400 <stdout>
+     871:	48 8d 15 c0 21 00 00 	lea    0x21c0(%rip),%rdx        # 2a38 <malloc+0x32c>
+     878:	48 89 d6             	mov    %rdx,%rsi
+     87b:	89 c7                	mov    %eax,%edi
+     87d:	b8 00 00 00 00       	mov    $0x0,%eax
+     882:	e8 8a 16 00 00       	call   1f11 <printf>
+     887:	8b 05 73 2b 00 00    	mov    0x2b73(%rip),%eax        # 3400 <stdout>
+     88d:	48 8d 15 d7 1f 00 00 	lea    0x1fd7(%rip),%rdx        # 286b <malloc+0x15f>
+     894:	48 89 d6             	mov    %rdx,%rsi
+     897:	89 c7                	mov    %eax,%edi
+     899:	b8 00 00 00 00       	mov    $0x0,%eax
+     89e:	e8 6e 16 00 00       	call   1f11 <printf>
+     8a3:	90                   	nop
+     8a4:	eb fd                	jmp    8a3 <extendedpipetest+0x23c>
+      }
+      n += retval;
+     8a6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8a9:	01 45 f8             	add    %eax,-0x8(%rbp)
+      bytes_to_read -= retval;
+     8ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8af:	29 45 fc             	sub    %eax,-0x4(%rbp)
+    while(bytes_to_read > 0) {
+     8b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8b6:	0f 8f 68 ff ff ff    	jg     824 <extendedpipetest+0x1bd>
+    }
+
+    if (read(fds[0], buf, 1) != 0) {
+     8bc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     8bf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8c3:	ba 01 00 00 00       	mov    $0x1,%edx
+     8c8:	48 89 ce             	mov    %rcx,%rsi
+     8cb:	89 c7                	mov    %eax,%edi
+     8cd:	e8 fe 1b 00 00       	call   24d0 <read>
+     8d2:	85 c0                	test   %eax,%eax
+     8d4:	74 5c                	je     932 <extendedpipetest+0x2cb>
+      error("pipe tet: read() returns non-zero at EOF\n");
+     8d6:	8b 05 24 2b 00 00    	mov    0x2b24(%rip),%eax        # 3400 <stdout>
+     8dc:	ba c1 00 00 00       	mov    $0xc1,%edx
+     8e1:	48 8d 0d 48 1f 00 00 	lea    0x1f48(%rip),%rcx        # 2830 <malloc+0x124>
+     8e8:	48 89 ce             	mov    %rcx,%rsi
+     8eb:	89 c7                	mov    %eax,%edi
+     8ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f2:	e8 1a 16 00 00       	call   1f11 <printf>
+     8f7:	8b 05 03 2b 00 00    	mov    0x2b03(%rip),%eax        # 3400 <stdout>
+     8fd:	48 8d 15 5c 21 00 00 	lea    0x215c(%rip),%rdx        # 2a60 <malloc+0x354>
+     904:	48 89 d6             	mov    %rdx,%rsi
+     907:	89 c7                	mov    %eax,%edi
+     909:	b8 00 00 00 00       	mov    $0x0,%eax
+     90e:	e8 fe 15 00 00       	call   1f11 <printf>
+     913:	8b 05 e7 2a 00 00    	mov    0x2ae7(%rip),%eax        # 3400 <stdout>
+     919:	48 8d 15 4b 1f 00 00 	lea    0x1f4b(%rip),%rdx        # 286b <malloc+0x15f>
+     920:	48 89 d6             	mov    %rdx,%rsi
+     923:	89 c7                	mov    %eax,%edi
+     925:	b8 00 00 00 00       	mov    $0x0,%eax
+     92a:	e8 e2 15 00 00       	call   1f11 <printf>
+     92f:	90                   	nop
+     930:	eb fd                	jmp    92f <extendedpipetest+0x2c8>
+    }
+
+    if (strcmp(buf, buf2) != 0) {
+     932:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     936:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     93a:	48 89 d6             	mov    %rdx,%rsi
+     93d:	48 89 c7             	mov    %rax,%rdi
+     940:	e8 0d 19 00 00       	call   2252 <strcmp>
+     945:	85 c0                	test   %eax,%eax
+     947:	0f 84 91 00 00 00    	je     9de <extendedpipetest+0x377>
+      printf(stdout, "extended pipe test: bad output:\n");
+     94d:	8b 05 ad 2a 00 00    	mov    0x2aad(%rip),%eax        # 3400 <stdout>
+     953:	48 8d 15 36 21 00 00 	lea    0x2136(%rip),%rdx        # 2a90 <malloc+0x384>
+     95a:	48 89 d6             	mov    %rdx,%rsi
+     95d:	89 c7                	mov    %eax,%edi
+     95f:	b8 00 00 00 00       	mov    $0x0,%eax
+     964:	e8 a8 15 00 00       	call   1f11 <printf>
+      printf(stdout, buf2);
+     969:	8b 05 91 2a 00 00    	mov    0x2a91(%rip),%eax        # 3400 <stdout>
+     96f:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     973:	48 89 d6             	mov    %rdx,%rsi
+     976:	89 c7                	mov    %eax,%edi
+     978:	b8 00 00 00 00       	mov    $0x0,%eax
+     97d:	e8 8f 15 00 00       	call   1f11 <printf>
+      error("extended pipe test: output test failed");
+     982:	8b 05 78 2a 00 00    	mov    0x2a78(%rip),%eax        # 3400 <stdout>
+     988:	ba c7 00 00 00       	mov    $0xc7,%edx
+     98d:	48 8d 0d 9c 1e 00 00 	lea    0x1e9c(%rip),%rcx        # 2830 <malloc+0x124>
+     994:	48 89 ce             	mov    %rcx,%rsi
+     997:	89 c7                	mov    %eax,%edi
+     999:	b8 00 00 00 00       	mov    $0x0,%eax
+     99e:	e8 6e 15 00 00       	call   1f11 <printf>
+     9a3:	8b 05 57 2a 00 00    	mov    0x2a57(%rip),%eax        # 3400 <stdout>
+     9a9:	48 8d 15 08 21 00 00 	lea    0x2108(%rip),%rdx        # 2ab8 <malloc+0x3ac>
+     9b0:	48 89 d6             	mov    %rdx,%rsi
+     9b3:	89 c7                	mov    %eax,%edi
+     9b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ba:	e8 52 15 00 00       	call   1f11 <printf>
+     9bf:	8b 05 3b 2a 00 00    	mov    0x2a3b(%rip),%eax        # 3400 <stdout>
+     9c5:	48 8d 15 9f 1e 00 00 	lea    0x1e9f(%rip),%rdx        # 286b <malloc+0x15f>
+     9cc:	48 89 d6             	mov    %rdx,%rsi
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 36 15 00 00       	call   1f11 <printf>
+     9db:	90                   	nop
+     9dc:	eb fd                	jmp    9db <extendedpipetest+0x374>
+    }
+    close(fds[0]);
+     9de:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     9e1:	89 c7                	mov    %eax,%edi
+     9e3:	e8 f8 1a 00 00       	call   24e0 <close>
+  } else {
+    error("extended pipe test: fork() failed\n");
+  }
+
+  // write return -1 when read-end is closed
+  if (pipe(fds) != 0) {
+     9e8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     9ec:	48 89 c7             	mov    %rax,%rdi
+     9ef:	e8 d4 1a 00 00       	call   24c8 <pipe>
+     9f4:	85 c0                	test   %eax,%eax
+     9f6:	0f 84 ba 00 00 00    	je     ab6 <extendedpipetest+0x44f>
+     9fc:	eb 5c                	jmp    a5a <extendedpipetest+0x3f3>
+    error("extended pipe test: fork() failed\n");
+     9fe:	8b 05 fc 29 00 00    	mov    0x29fc(%rip),%eax        # 3400 <stdout>
+     a04:	ba cb 00 00 00       	mov    $0xcb,%edx
+     a09:	48 8d 0d 20 1e 00 00 	lea    0x1e20(%rip),%rcx        # 2830 <malloc+0x124>
+     a10:	48 89 ce             	mov    %rcx,%rsi
+     a13:	89 c7                	mov    %eax,%edi
+     a15:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1a:	e8 f2 14 00 00       	call   1f11 <printf>
+     a1f:	8b 05 db 29 00 00    	mov    0x29db(%rip),%eax        # 3400 <stdout>
+     a25:	48 8d 15 b4 20 00 00 	lea    0x20b4(%rip),%rdx        # 2ae0 <malloc+0x3d4>
+     a2c:	48 89 d6             	mov    %rdx,%rsi
+     a2f:	89 c7                	mov    %eax,%edi
+     a31:	b8 00 00 00 00       	mov    $0x0,%eax
+     a36:	e8 d6 14 00 00       	call   1f11 <printf>
+     a3b:	8b 05 bf 29 00 00    	mov    0x29bf(%rip),%eax        # 3400 <stdout>
+     a41:	48 8d 15 23 1e 00 00 	lea    0x1e23(%rip),%rdx        # 286b <malloc+0x15f>
+     a48:	48 89 d6             	mov    %rdx,%rsi
+     a4b:	89 c7                	mov    %eax,%edi
+     a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a52:	e8 ba 14 00 00       	call   1f11 <printf>
+     a57:	90                   	nop
+     a58:	eb fd                	jmp    a57 <extendedpipetest+0x3f0>
+    error("extended pipe test: pipe() failed\n");
+     a5a:	8b 05 a0 29 00 00    	mov    0x29a0(%rip),%eax        # 3400 <stdout>
+     a60:	ba d0 00 00 00       	mov    $0xd0,%edx
+     a65:	48 8d 0d c4 1d 00 00 	lea    0x1dc4(%rip),%rcx        # 2830 <malloc+0x124>
+     a6c:	48 89 ce             	mov    %rcx,%rsi
+     a6f:	89 c7                	mov    %eax,%edi
+     a71:	b8 00 00 00 00       	mov    $0x0,%eax
+     a76:	e8 96 14 00 00       	call   1f11 <printf>
+     a7b:	8b 05 7f 29 00 00    	mov    0x297f(%rip),%eax        # 3400 <stdout>
+     a81:	48 8d 15 48 1f 00 00 	lea    0x1f48(%rip),%rdx        # 29d0 <malloc+0x2c4>
+     a88:	48 89 d6             	mov    %rdx,%rsi
+     a8b:	89 c7                	mov    %eax,%edi
+     a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a92:	e8 7a 14 00 00       	call   1f11 <printf>
+     a97:	8b 05 63 29 00 00    	mov    0x2963(%rip),%eax        # 3400 <stdout>
+     a9d:	48 8d 15 c7 1d 00 00 	lea    0x1dc7(%rip),%rdx        # 286b <malloc+0x15f>
+     aa4:	48 89 d6             	mov    %rdx,%rsi
+     aa7:	89 c7                	mov    %eax,%edi
+     aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+     aae:	e8 5e 14 00 00       	call   1f11 <printf>
+     ab3:	90                   	nop
+     ab4:	eb fd                	jmp    ab3 <extendedpipetest+0x44c>
+  }
+  if (write(fds[1], buf, 14) != 14) {
+     ab6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ab9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     abd:	ba 0e 00 00 00       	mov    $0xe,%edx
+     ac2:	48 89 ce             	mov    %rcx,%rsi
+     ac5:	89 c7                	mov    %eax,%edi
+     ac7:	e8 0c 1a 00 00       	call   24d8 <write>
+     acc:	83 f8 0e             	cmp    $0xe,%eax
+     acf:	74 5c                	je     b2d <extendedpipetest+0x4c6>
+      error("extended pipe test: oops 1\n");
+     ad1:	8b 05 29 29 00 00    	mov    0x2929(%rip),%eax        # 3400 <stdout>
+     ad7:	ba d3 00 00 00       	mov    $0xd3,%edx
+     adc:	48 8d 0d 4d 1d 00 00 	lea    0x1d4d(%rip),%rcx        # 2830 <malloc+0x124>
+     ae3:	48 89 ce             	mov    %rcx,%rsi
+     ae6:	89 c7                	mov    %eax,%edi
+     ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+     aed:	e8 1f 14 00 00       	call   1f11 <printf>
+     af2:	8b 05 08 29 00 00    	mov    0x2908(%rip),%eax        # 3400 <stdout>
+     af8:	48 8d 15 f4 1e 00 00 	lea    0x1ef4(%rip),%rdx        # 29f3 <malloc+0x2e7>
+     aff:	48 89 d6             	mov    %rdx,%rsi
+     b02:	89 c7                	mov    %eax,%edi
+     b04:	b8 00 00 00 00       	mov    $0x0,%eax
+     b09:	e8 03 14 00 00       	call   1f11 <printf>
+     b0e:	8b 05 ec 28 00 00    	mov    0x28ec(%rip),%eax        # 3400 <stdout>
+     b14:	48 8d 15 50 1d 00 00 	lea    0x1d50(%rip),%rdx        # 286b <malloc+0x15f>
+     b1b:	48 89 d6             	mov    %rdx,%rsi
+     b1e:	89 c7                	mov    %eax,%edi
+     b20:	b8 00 00 00 00       	mov    $0x0,%eax
+     b25:	e8 e7 13 00 00       	call   1f11 <printf>
+     b2a:	90                   	nop
+     b2b:	eb fd                	jmp    b2a <extendedpipetest+0x4c3>
+    }
+  close(fds[0]);
+     b2d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     b30:	89 c7                	mov    %eax,%edi
+     b32:	e8 a9 19 00 00       	call   24e0 <close>
+  if (write(fds[1], buf, 14) != -1) {
+     b37:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b3a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     b3e:	ba 0e 00 00 00       	mov    $0xe,%edx
+     b43:	48 89 ce             	mov    %rcx,%rsi
+     b46:	89 c7                	mov    %eax,%edi
+     b48:	e8 8b 19 00 00       	call   24d8 <write>
+     b4d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b50:	74 5c                	je     bae <extendedpipetest+0x547>
+    error("extended pipe test: not returning -1 when read-end is closed\n");
+     b52:	8b 05 a8 28 00 00    	mov    0x28a8(%rip),%eax        # 3400 <stdout>
+     b58:	ba d7 00 00 00       	mov    $0xd7,%edx
+     b5d:	48 8d 0d cc 1c 00 00 	lea    0x1ccc(%rip),%rcx        # 2830 <malloc+0x124>
+     b64:	48 89 ce             	mov    %rcx,%rsi
+     b67:	89 c7                	mov    %eax,%edi
+     b69:	b8 00 00 00 00       	mov    $0x0,%eax
+     b6e:	e8 9e 13 00 00       	call   1f11 <printf>
+     b73:	8b 05 87 28 00 00    	mov    0x2887(%rip),%eax        # 3400 <stdout>
+     b79:	48 8d 15 88 1f 00 00 	lea    0x1f88(%rip),%rdx        # 2b08 <malloc+0x3fc>
+     b80:	48 89 d6             	mov    %rdx,%rsi
+     b83:	89 c7                	mov    %eax,%edi
+     b85:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8a:	e8 82 13 00 00       	call   1f11 <printf>
+     b8f:	8b 05 6b 28 00 00    	mov    0x286b(%rip),%eax        # 3400 <stdout>
+     b95:	48 8d 15 cf 1c 00 00 	lea    0x1ccf(%rip),%rdx        # 286b <malloc+0x15f>
+     b9c:	48 89 d6             	mov    %rdx,%rsi
+     b9f:	89 c7                	mov    %eax,%edi
+     ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ba6:	e8 66 13 00 00       	call   1f11 <printf>
+     bab:	90                   	nop
+     bac:	eb fd                	jmp    bab <extendedpipetest+0x544>
+  }
+  close(fds[1]);
+     bae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bb1:	89 c7                	mov    %eax,%edi
+     bb3:	e8 28 19 00 00       	call   24e0 <close>
+
+  printf(stdout, "extendedpipetest: ok\n");
+     bb8:	8b 05 42 28 00 00    	mov    0x2842(%rip),%eax        # 3400 <stdout>
+     bbe:	48 8d 15 81 1f 00 00 	lea    0x1f81(%rip),%rdx        # 2b46 <malloc+0x43a>
+     bc5:	48 89 d6             	mov    %rdx,%rsi
+     bc8:	89 c7                	mov    %eax,%edi
+     bca:	b8 00 00 00 00       	mov    $0x0,%eax
+     bcf:	e8 3d 13 00 00       	call   1f11 <printf>
+}
+     bd4:	90                   	nop
+     bd5:	c9                   	leave
+     bd6:	c3                   	ret
+
+0000000000000bd7 <pkilltest>:
+
+void pkilltest(void) {
+     bd7:	55                   	push   %rbp
+     bd8:	48 89 e5             	mov    %rsp,%rbp
+     bdb:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[11];
+
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     bdf:	48 8d 05 76 1f 00 00 	lea    0x1f76(%rip),%rax        # 2b5c <malloc+0x450>
+     be6:	48 89 c6             	mov    %rax,%rsi
+     be9:	bf 01 00 00 00       	mov    $0x1,%edi
+     bee:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf3:	e8 19 13 00 00       	call   1f11 <printf>
+  pid1 = fork();
+     bf8:	e8 b3 18 00 00       	call   24b0 <fork>
+     bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid1 == 0)
+     c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c04:	75 03                	jne    c09 <pkilltest+0x32>
+    for (;;)
+     c06:	90                   	nop
+     c07:	eb fd                	jmp    c06 <pkilltest+0x2f>
+      ;
+
+  pid2 = fork();
+     c09:	e8 a2 18 00 00       	call   24b0 <fork>
+     c0e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (pid2 == 0)
+     c11:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c15:	75 03                	jne    c1a <pkilltest+0x43>
+    for (;;)
+     c17:	90                   	nop
+     c18:	eb fd                	jmp    c17 <pkilltest+0x40>
+      ;
+
+  pipe(pfds);
+     c1a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     c1e:	48 89 c7             	mov    %rax,%rdi
+     c21:	e8 a2 18 00 00       	call   24c8 <pipe>
+  pid3 = fork();
+     c26:	e8 85 18 00 00       	call   24b0 <fork>
+     c2b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid3 == 0) {
+     c2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     c32:	0f 85 91 00 00 00    	jne    cc9 <pkilltest+0xf2>
+    close(pfds[0]);
+     c38:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     c3b:	89 c7                	mov    %eax,%edi
+     c3d:	e8 9e 18 00 00       	call   24e0 <close>
+    if (write(pfds[1], "x", 1) != 1)
+     c42:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c45:	ba 01 00 00 00       	mov    $0x1,%edx
+     c4a:	48 8d 0d 15 1f 00 00 	lea    0x1f15(%rip),%rcx        # 2b66 <malloc+0x45a>
+     c51:	48 89 ce             	mov    %rcx,%rsi
+     c54:	89 c7                	mov    %eax,%edi
+     c56:	e8 7d 18 00 00       	call   24d8 <write>
+     c5b:	83 f8 01             	cmp    $0x1,%eax
+     c5e:	74 5c                	je     cbc <pkilltest+0xe5>
+      error("pkilltest: write error");
+     c60:	8b 05 9a 27 00 00    	mov    0x279a(%rip),%eax        # 3400 <stdout>
+     c66:	ba f4 00 00 00       	mov    $0xf4,%edx
+     c6b:	48 8d 0d be 1b 00 00 	lea    0x1bbe(%rip),%rcx        # 2830 <malloc+0x124>
+     c72:	48 89 ce             	mov    %rcx,%rsi
+     c75:	89 c7                	mov    %eax,%edi
+     c77:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7c:	e8 90 12 00 00       	call   1f11 <printf>
+     c81:	8b 05 79 27 00 00    	mov    0x2779(%rip),%eax        # 3400 <stdout>
+     c87:	48 8d 15 da 1e 00 00 	lea    0x1eda(%rip),%rdx        # 2b68 <malloc+0x45c>
+     c8e:	48 89 d6             	mov    %rdx,%rsi
+     c91:	89 c7                	mov    %eax,%edi
+     c93:	b8 00 00 00 00       	mov    $0x0,%eax
+     c98:	e8 74 12 00 00       	call   1f11 <printf>
+     c9d:	8b 05 5d 27 00 00    	mov    0x275d(%rip),%eax        # 3400 <stdout>
+     ca3:	48 8d 15 c1 1b 00 00 	lea    0x1bc1(%rip),%rdx        # 286b <malloc+0x15f>
+     caa:	48 89 d6             	mov    %rdx,%rsi
+     cad:	89 c7                	mov    %eax,%edi
+     caf:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb4:	e8 58 12 00 00       	call   1f11 <printf>
+     cb9:	90                   	nop
+     cba:	eb fd                	jmp    cb9 <pkilltest+0xe2>
+    close(pfds[1]);
+     cbc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     cbf:	89 c7                	mov    %eax,%edi
+     cc1:	e8 1a 18 00 00       	call   24e0 <close>
+    for (;;)
+     cc6:	90                   	nop
+     cc7:	eb fd                	jmp    cc6 <pkilltest+0xef>
+      ;
+  }
+
+  close(pfds[1]);
+     cc9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ccc:	89 c7                	mov    %eax,%edi
+     cce:	e8 0d 18 00 00       	call   24e0 <close>
+  if (read(pfds[0], buf, sizeof(buf)) != 1) {
+     cd3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     cd6:	48 8d 4d e9          	lea    -0x17(%rbp),%rcx
+     cda:	ba 0b 00 00 00       	mov    $0xb,%edx
+     cdf:	48 89 ce             	mov    %rcx,%rsi
+     ce2:	89 c7                	mov    %eax,%edi
+     ce4:	e8 e7 17 00 00       	call   24d0 <read>
+     ce9:	83 f8 01             	cmp    $0x1,%eax
+     cec:	74 5c                	je     d4a <pkilltest+0x173>
+    error("pkilltest: read error");
+     cee:	8b 05 0c 27 00 00    	mov    0x270c(%rip),%eax        # 3400 <stdout>
+     cf4:	ba fc 00 00 00       	mov    $0xfc,%edx
+     cf9:	48 8d 0d 30 1b 00 00 	lea    0x1b30(%rip),%rcx        # 2830 <malloc+0x124>
+     d00:	48 89 ce             	mov    %rcx,%rsi
+     d03:	89 c7                	mov    %eax,%edi
+     d05:	b8 00 00 00 00       	mov    $0x0,%eax
+     d0a:	e8 02 12 00 00       	call   1f11 <printf>
+     d0f:	8b 05 eb 26 00 00    	mov    0x26eb(%rip),%eax        # 3400 <stdout>
+     d15:	48 8d 15 63 1e 00 00 	lea    0x1e63(%rip),%rdx        # 2b7f <malloc+0x473>
+     d1c:	48 89 d6             	mov    %rdx,%rsi
+     d1f:	89 c7                	mov    %eax,%edi
+     d21:	b8 00 00 00 00       	mov    $0x0,%eax
+     d26:	e8 e6 11 00 00       	call   1f11 <printf>
+     d2b:	8b 05 cf 26 00 00    	mov    0x26cf(%rip),%eax        # 3400 <stdout>
+     d31:	48 8d 15 33 1b 00 00 	lea    0x1b33(%rip),%rdx        # 286b <malloc+0x15f>
+     d38:	48 89 d6             	mov    %rdx,%rsi
+     d3b:	89 c7                	mov    %eax,%edi
+     d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d42:	e8 ca 11 00 00       	call   1f11 <printf>
+     d47:	90                   	nop
+     d48:	eb fd                	jmp    d47 <pkilltest+0x170>
+  }
+  close(pfds[0]);
+     d4a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     d4d:	89 c7                	mov    %eax,%edi
+     d4f:	e8 8c 17 00 00       	call   24e0 <close>
+  printf(1, "kill... ");
+     d54:	48 8d 05 3a 1e 00 00 	lea    0x1e3a(%rip),%rax        # 2b95 <malloc+0x489>
+     d5b:	48 89 c6             	mov    %rax,%rsi
+     d5e:	bf 01 00 00 00       	mov    $0x1,%edi
+     d63:	b8 00 00 00 00       	mov    $0x0,%eax
+     d68:	e8 a4 11 00 00       	call   1f11 <printf>
+  kill(pid1);
+     d6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d70:	89 c7                	mov    %eax,%edi
+     d72:	e8 71 17 00 00       	call   24e8 <kill>
+  kill(pid2);
+     d77:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d7a:	89 c7                	mov    %eax,%edi
+     d7c:	e8 67 17 00 00       	call   24e8 <kill>
+  kill(pid3);
+     d81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d84:	89 c7                	mov    %eax,%edi
+     d86:	e8 5d 17 00 00       	call   24e8 <kill>
+  printf(1, "wait... ");
+     d8b:	48 8d 05 0c 1e 00 00 	lea    0x1e0c(%rip),%rax        # 2b9e <malloc+0x492>
+     d92:	48 89 c6             	mov    %rax,%rsi
+     d95:	bf 01 00 00 00       	mov    $0x1,%edi
+     d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d9f:	e8 6d 11 00 00       	call   1f11 <printf>
+  wait();
+     da4:	e8 17 17 00 00       	call   24c0 <wait>
+  wait();
+     da9:	e8 12 17 00 00       	call   24c0 <wait>
+  wait();
+     dae:	e8 0d 17 00 00       	call   24c0 <wait>
+  printf(1, "pkilltest: ok\n");
+     db3:	48 8d 05 ed 1d 00 00 	lea    0x1ded(%rip),%rax        # 2ba7 <malloc+0x49b>
+     dba:	48 89 c6             	mov    %rax,%rsi
+     dbd:	bf 01 00 00 00       	mov    $0x1,%edi
+     dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc7:	e8 45 11 00 00       	call   1f11 <printf>
+}
+     dcc:	90                   	nop
+     dcd:	c9                   	leave
+     dce:	c3                   	ret
+
+0000000000000dcf <racetest>:
+
+void racetest(void) {
+     dcf:	55                   	push   %rbp
+     dd0:	48 89 e5             	mov    %rsp,%rbp
+     dd3:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, pid;
+
+  for (i = 0; i < 100; i++) {
+     dd7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     dde:	e9 df 00 00 00       	jmp    ec2 <racetest+0xf3>
+    pid = fork();
+     de3:	e8 c8 16 00 00       	call   24b0 <fork>
+     de8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (pid < 0) {
+     deb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     def:	79 5c                	jns    e4d <racetest+0x7e>
+      error("racetest: fork failed\n");
+     df1:	8b 05 09 26 00 00    	mov    0x2609(%rip),%eax        # 3400 <stdout>
+     df7:	ba 10 01 00 00       	mov    $0x110,%edx
+     dfc:	48 8d 0d 2d 1a 00 00 	lea    0x1a2d(%rip),%rcx        # 2830 <malloc+0x124>
+     e03:	48 89 ce             	mov    %rcx,%rsi
+     e06:	89 c7                	mov    %eax,%edi
+     e08:	b8 00 00 00 00       	mov    $0x0,%eax
+     e0d:	e8 ff 10 00 00       	call   1f11 <printf>
+     e12:	8b 05 e8 25 00 00    	mov    0x25e8(%rip),%eax        # 3400 <stdout>
+     e18:	48 8d 15 97 1d 00 00 	lea    0x1d97(%rip),%rdx        # 2bb6 <malloc+0x4aa>
+     e1f:	48 89 d6             	mov    %rdx,%rsi
+     e22:	89 c7                	mov    %eax,%edi
+     e24:	b8 00 00 00 00       	mov    $0x0,%eax
+     e29:	e8 e3 10 00 00       	call   1f11 <printf>
+     e2e:	8b 05 cc 25 00 00    	mov    0x25cc(%rip),%eax        # 3400 <stdout>
+     e34:	48 8d 15 30 1a 00 00 	lea    0x1a30(%rip),%rdx        # 286b <malloc+0x15f>
+     e3b:	48 89 d6             	mov    %rdx,%rsi
+     e3e:	89 c7                	mov    %eax,%edi
+     e40:	b8 00 00 00 00       	mov    $0x0,%eax
+     e45:	e8 c7 10 00 00       	call   1f11 <printf>
+     e4a:	90                   	nop
+     e4b:	eb fd                	jmp    e4a <racetest+0x7b>
+    }
+    if (pid) {
+     e4d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e51:	74 66                	je     eb9 <racetest+0xea>
+      if (wait() != pid) {
+     e53:	e8 68 16 00 00       	call   24c0 <wait>
+     e58:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     e5b:	74 61                	je     ebe <racetest+0xef>
+        error("racetest: wait wrong pid\n");
+     e5d:	8b 05 9d 25 00 00    	mov    0x259d(%rip),%eax        # 3400 <stdout>
+     e63:	ba 14 01 00 00       	mov    $0x114,%edx
+     e68:	48 8d 0d c1 19 00 00 	lea    0x19c1(%rip),%rcx        # 2830 <malloc+0x124>
+     e6f:	48 89 ce             	mov    %rcx,%rsi
+     e72:	89 c7                	mov    %eax,%edi
+     e74:	b8 00 00 00 00       	mov    $0x0,%eax
+     e79:	e8 93 10 00 00       	call   1f11 <printf>
+     e7e:	8b 05 7c 25 00 00    	mov    0x257c(%rip),%eax        # 3400 <stdout>
+     e84:	48 8d 15 42 1d 00 00 	lea    0x1d42(%rip),%rdx        # 2bcd <malloc+0x4c1>
+     e8b:	48 89 d6             	mov    %rdx,%rsi
+     e8e:	89 c7                	mov    %eax,%edi
+     e90:	b8 00 00 00 00       	mov    $0x0,%eax
+     e95:	e8 77 10 00 00       	call   1f11 <printf>
+     e9a:	8b 05 60 25 00 00    	mov    0x2560(%rip),%eax        # 3400 <stdout>
+     ea0:	48 8d 15 c4 19 00 00 	lea    0x19c4(%rip),%rdx        # 286b <malloc+0x15f>
+     ea7:	48 89 d6             	mov    %rdx,%rsi
+     eaa:	89 c7                	mov    %eax,%edi
+     eac:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb1:	e8 5b 10 00 00       	call   1f11 <printf>
+     eb6:	90                   	nop
+     eb7:	eb fd                	jmp    eb6 <racetest+0xe7>
+      }
+    } else {
+      exit();
+     eb9:	e8 fa 15 00 00       	call   24b8 <exit>
+  for (i = 0; i < 100; i++) {
+     ebe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ec2:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     ec6:	0f 8e 17 ff ff ff    	jle    de3 <racetest+0x14>
+    }
+  }
+  printf(1, "racetest: ok\n");
+     ecc:	48 8d 05 14 1d 00 00 	lea    0x1d14(%rip),%rax        # 2be7 <malloc+0x4db>
+     ed3:	48 89 c6             	mov    %rax,%rsi
+     ed6:	bf 01 00 00 00       	mov    $0x1,%edi
+     edb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee0:	e8 2c 10 00 00       	call   1f11 <printf>
+}
+     ee5:	90                   	nop
+     ee6:	c9                   	leave
+     ee7:	c3                   	ret
+
+0000000000000ee8 <fdesctest>:
+
+void fdesctest(void) {
+     ee8:	55                   	push   %rbp
+     ee9:	48 89 e5             	mov    %rsp,%rbp
+     eec:	48 83 ec 20          	sub    $0x20,%rsp
+  printf(1, "fdesctest\n");
+     ef0:	48 8d 05 fe 1c 00 00 	lea    0x1cfe(%rip),%rax        # 2bf5 <malloc+0x4e9>
+     ef7:	48 89 c6             	mov    %rax,%rsi
+     efa:	bf 01 00 00 00       	mov    $0x1,%edi
+     eff:	b8 00 00 00 00       	mov    $0x0,%eax
+     f04:	e8 08 10 00 00       	call   1f11 <printf>
+  int fd1;
+  char buf[11] = {0};
+     f09:	48 c7 45 e1 00 00 00 	movq   $0x0,-0x1f(%rbp)
+     f10:	00 
+     f11:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+
+  // Make sure offsets are shared
+  assert((fd1 = open("l2_share.txt", O_RDONLY)) > -1);
+     f18:	be 00 00 00 00       	mov    $0x0,%esi
+     f1d:	48 8d 05 dc 1c 00 00 	lea    0x1cdc(%rip),%rax        # 2c00 <malloc+0x4f4>
+     f24:	48 89 c7             	mov    %rax,%rdi
+     f27:	e8 cc 15 00 00       	call   24f8 <open>
+     f2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     f2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f33:	79 2b                	jns    f60 <fdesctest+0x78>
+     f35:	8b 05 c5 24 00 00    	mov    0x24c5(%rip),%eax        # 3400 <stdout>
+     f3b:	48 8d 15 ce 1c 00 00 	lea    0x1cce(%rip),%rdx        # 2c10 <malloc+0x504>
+     f42:	48 89 d1             	mov    %rdx,%rcx
+     f45:	ba 23 01 00 00       	mov    $0x123,%edx
+     f4a:	48 8d 35 ef 1c 00 00 	lea    0x1cef(%rip),%rsi        # 2c40 <malloc+0x534>
+     f51:	89 c7                	mov    %eax,%edi
+     f53:	b8 00 00 00 00       	mov    $0x0,%eax
+     f58:	e8 b4 0f 00 00       	call   1f11 <printf>
+     f5d:	90                   	nop
+     f5e:	eb fd                	jmp    f5d <fdesctest+0x75>
+
+  if (!fork()) {
+     f60:	e8 4b 15 00 00       	call   24b0 <fork>
+     f65:	85 c0                	test   %eax,%eax
+     f67:	0f 85 f6 00 00 00    	jne    1063 <fdesctest+0x17b>
+    if (read(fd1, buf, 10) != 10)
+     f6d:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+     f71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f74:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f79:	48 89 ce             	mov    %rcx,%rsi
+     f7c:	89 c7                	mov    %eax,%edi
+     f7e:	e8 4d 15 00 00       	call   24d0 <read>
+     f83:	83 f8 0a             	cmp    $0xa,%eax
+     f86:	74 5c                	je     fe4 <fdesctest+0xfc>
+      error("tried to read 10 bytes from fd1");
+     f88:	8b 05 72 24 00 00    	mov    0x2472(%rip),%eax        # 3400 <stdout>
+     f8e:	ba 27 01 00 00       	mov    $0x127,%edx
+     f93:	48 8d 0d 96 18 00 00 	lea    0x1896(%rip),%rcx        # 2830 <malloc+0x124>
+     f9a:	48 89 ce             	mov    %rcx,%rsi
+     f9d:	89 c7                	mov    %eax,%edi
+     f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+     fa4:	e8 68 0f 00 00       	call   1f11 <printf>
+     fa9:	8b 05 51 24 00 00    	mov    0x2451(%rip),%eax        # 3400 <stdout>
+     faf:	48 8d 15 aa 1c 00 00 	lea    0x1caa(%rip),%rdx        # 2c60 <malloc+0x554>
+     fb6:	48 89 d6             	mov    %rdx,%rsi
+     fb9:	89 c7                	mov    %eax,%edi
+     fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+     fc0:	e8 4c 0f 00 00       	call   1f11 <printf>
+     fc5:	8b 05 35 24 00 00    	mov    0x2435(%rip),%eax        # 3400 <stdout>
+     fcb:	48 8d 15 99 18 00 00 	lea    0x1899(%rip),%rdx        # 286b <malloc+0x15f>
+     fd2:	48 89 d6             	mov    %rdx,%rsi
+     fd5:	89 c7                	mov    %eax,%edi
+     fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+     fdc:	e8 30 0f 00 00       	call   1f11 <printf>
+     fe1:	90                   	nop
+     fe2:	eb fd                	jmp    fe1 <fdesctest+0xf9>
+
+    if (strcmp("cccccccccc", buf))
+     fe4:	48 8d 45 e1          	lea    -0x1f(%rbp),%rax
+     fe8:	48 89 c6             	mov    %rax,%rsi
+     feb:	48 8d 05 8e 1c 00 00 	lea    0x1c8e(%rip),%rax        # 2c80 <malloc+0x574>
+     ff2:	48 89 c7             	mov    %rax,%rdi
+     ff5:	e8 58 12 00 00       	call   2252 <strcmp>
+     ffa:	85 c0                	test   %eax,%eax
+     ffc:	74 60                	je     105e <fdesctest+0x176>
+      error("should have reead 10 c's, instead: '%s'", buf);
+     ffe:	8b 05 fc 23 00 00    	mov    0x23fc(%rip),%eax        # 3400 <stdout>
+    1004:	ba 2a 01 00 00       	mov    $0x12a,%edx
+    1009:	48 8d 0d 20 18 00 00 	lea    0x1820(%rip),%rcx        # 2830 <malloc+0x124>
+    1010:	48 89 ce             	mov    %rcx,%rsi
+    1013:	89 c7                	mov    %eax,%edi
+    1015:	b8 00 00 00 00       	mov    $0x0,%eax
+    101a:	e8 f2 0e 00 00       	call   1f11 <printf>
+    101f:	8b 05 db 23 00 00    	mov    0x23db(%rip),%eax        # 3400 <stdout>
+    1025:	48 8d 55 e1          	lea    -0x1f(%rbp),%rdx
+    1029:	48 8d 0d 60 1c 00 00 	lea    0x1c60(%rip),%rcx        # 2c90 <malloc+0x584>
+    1030:	48 89 ce             	mov    %rcx,%rsi
+    1033:	89 c7                	mov    %eax,%edi
+    1035:	b8 00 00 00 00       	mov    $0x0,%eax
+    103a:	e8 d2 0e 00 00       	call   1f11 <printf>
+    103f:	8b 05 bb 23 00 00    	mov    0x23bb(%rip),%eax        # 3400 <stdout>
+    1045:	48 8d 15 1f 18 00 00 	lea    0x181f(%rip),%rdx        # 286b <malloc+0x15f>
+    104c:	48 89 d6             	mov    %rdx,%rsi
+    104f:	89 c7                	mov    %eax,%edi
+    1051:	b8 00 00 00 00       	mov    $0x0,%eax
+    1056:	e8 b6 0e 00 00       	call   1f11 <printf>
+    105b:	90                   	nop
+    105c:	eb fd                	jmp    105b <fdesctest+0x173>
+    exit();
+    105e:	e8 55 14 00 00       	call   24b8 <exit>
+  } else {
+    wait();
+    1063:	e8 58 14 00 00       	call   24c0 <wait>
+  }
+
+  if (read(fd1, buf, 10) != 10)
+    1068:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    106c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    106f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1074:	48 89 ce             	mov    %rcx,%rsi
+    1077:	89 c7                	mov    %eax,%edi
+    1079:	e8 52 14 00 00       	call   24d0 <read>
+    107e:	83 f8 0a             	cmp    $0xa,%eax
+    1081:	74 5c                	je     10df <fdesctest+0x1f7>
+    error("tried to read 10 bytes from fd1");
+    1083:	8b 05 77 23 00 00    	mov    0x2377(%rip),%eax        # 3400 <stdout>
+    1089:	ba 31 01 00 00       	mov    $0x131,%edx
+    108e:	48 8d 0d 9b 17 00 00 	lea    0x179b(%rip),%rcx        # 2830 <malloc+0x124>
+    1095:	48 89 ce             	mov    %rcx,%rsi
+    1098:	89 c7                	mov    %eax,%edi
+    109a:	b8 00 00 00 00       	mov    $0x0,%eax
+    109f:	e8 6d 0e 00 00       	call   1f11 <printf>
+    10a4:	8b 05 56 23 00 00    	mov    0x2356(%rip),%eax        # 3400 <stdout>
+    10aa:	48 8d 15 af 1b 00 00 	lea    0x1baf(%rip),%rdx        # 2c60 <malloc+0x554>
+    10b1:	48 89 d6             	mov    %rdx,%rsi
+    10b4:	89 c7                	mov    %eax,%edi
+    10b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bb:	e8 51 0e 00 00       	call   1f11 <printf>
+    10c0:	8b 05 3a 23 00 00    	mov    0x233a(%rip),%eax        # 3400 <stdout>
+    10c6:	48 8d 15 9e 17 00 00 	lea    0x179e(%rip),%rdx        # 286b <malloc+0x15f>
+    10cd:	48 89 d6             	mov    %rdx,%rsi
+    10d0:	89 c7                	mov    %eax,%edi
+    10d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d7:	e8 35 0e 00 00       	call   1f11 <printf>
+    10dc:	90                   	nop
+    10dd:	eb fd                	jmp    10dc <fdesctest+0x1f4>
+
+  if (strcmp("ppppppppp\n", buf))
+    10df:	48 8d 45 e1          	lea    -0x1f(%rbp),%rax
+    10e3:	48 89 c6             	mov    %rax,%rsi
+    10e6:	48 8d 05 cb 1b 00 00 	lea    0x1bcb(%rip),%rax        # 2cb8 <malloc+0x5ac>
+    10ed:	48 89 c7             	mov    %rax,%rdi
+    10f0:	e8 5d 11 00 00       	call   2252 <strcmp>
+    10f5:	85 c0                	test   %eax,%eax
+    10f7:	74 60                	je     1159 <fdesctest+0x271>
+    error("should have reead 9 p's (and a newline), instead: '%s'", buf);
+    10f9:	8b 05 01 23 00 00    	mov    0x2301(%rip),%eax        # 3400 <stdout>
+    10ff:	ba 34 01 00 00       	mov    $0x134,%edx
+    1104:	48 8d 0d 25 17 00 00 	lea    0x1725(%rip),%rcx        # 2830 <malloc+0x124>
+    110b:	48 89 ce             	mov    %rcx,%rsi
+    110e:	89 c7                	mov    %eax,%edi
+    1110:	b8 00 00 00 00       	mov    $0x0,%eax
+    1115:	e8 f7 0d 00 00       	call   1f11 <printf>
+    111a:	8b 05 e0 22 00 00    	mov    0x22e0(%rip),%eax        # 3400 <stdout>
+    1120:	48 8d 55 e1          	lea    -0x1f(%rbp),%rdx
+    1124:	48 8d 0d 9d 1b 00 00 	lea    0x1b9d(%rip),%rcx        # 2cc8 <malloc+0x5bc>
+    112b:	48 89 ce             	mov    %rcx,%rsi
+    112e:	89 c7                	mov    %eax,%edi
+    1130:	b8 00 00 00 00       	mov    $0x0,%eax
+    1135:	e8 d7 0d 00 00       	call   1f11 <printf>
+    113a:	8b 05 c0 22 00 00    	mov    0x22c0(%rip),%eax        # 3400 <stdout>
+    1140:	48 8d 15 24 17 00 00 	lea    0x1724(%rip),%rdx        # 286b <malloc+0x15f>
+    1147:	48 89 d6             	mov    %rdx,%rsi
+    114a:	89 c7                	mov    %eax,%edi
+    114c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1151:	e8 bb 0d 00 00       	call   1f11 <printf>
+    1156:	90                   	nop
+    1157:	eb fd                	jmp    1156 <fdesctest+0x26e>
+
+  close(fd1);
+    1159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    115c:	89 c7                	mov    %eax,%edi
+    115e:	e8 7d 13 00 00       	call   24e0 <close>
+
+  // Make sure the correct file descriptor ints are maintained
+  
+  int fd2, fd3, fd4, fd5;
+  assert((fd2 = open("l2_share.txt", O_RDONLY)) > -1);
+    1163:	be 00 00 00 00       	mov    $0x0,%esi
+    1168:	48 8d 05 91 1a 00 00 	lea    0x1a91(%rip),%rax        # 2c00 <malloc+0x4f4>
+    116f:	48 89 c7             	mov    %rax,%rdi
+    1172:	e8 81 13 00 00       	call   24f8 <open>
+    1177:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    117a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    117e:	79 2b                	jns    11ab <fdesctest+0x2c3>
+    1180:	8b 05 7a 22 00 00    	mov    0x227a(%rip),%eax        # 3400 <stdout>
+    1186:	48 8d 15 73 1b 00 00 	lea    0x1b73(%rip),%rdx        # 2d00 <malloc+0x5f4>
+    118d:	48 89 d1             	mov    %rdx,%rcx
+    1190:	ba 3b 01 00 00       	mov    $0x13b,%edx
+    1195:	48 8d 35 a4 1a 00 00 	lea    0x1aa4(%rip),%rsi        # 2c40 <malloc+0x534>
+    119c:	89 c7                	mov    %eax,%edi
+    119e:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a3:	e8 69 0d 00 00       	call   1f11 <printf>
+    11a8:	90                   	nop
+    11a9:	eb fd                	jmp    11a8 <fdesctest+0x2c0>
+  assert((fd3 = open("l2_share.txt", O_RDONLY)) > -1);
+    11ab:	be 00 00 00 00       	mov    $0x0,%esi
+    11b0:	48 8d 05 49 1a 00 00 	lea    0x1a49(%rip),%rax        # 2c00 <malloc+0x4f4>
+    11b7:	48 89 c7             	mov    %rax,%rdi
+    11ba:	e8 39 13 00 00       	call   24f8 <open>
+    11bf:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    11c6:	79 2b                	jns    11f3 <fdesctest+0x30b>
+    11c8:	8b 05 32 22 00 00    	mov    0x2232(%rip),%eax        # 3400 <stdout>
+    11ce:	48 8d 15 5b 1b 00 00 	lea    0x1b5b(%rip),%rdx        # 2d30 <malloc+0x624>
+    11d5:	48 89 d1             	mov    %rdx,%rcx
+    11d8:	ba 3c 01 00 00       	mov    $0x13c,%edx
+    11dd:	48 8d 35 5c 1a 00 00 	lea    0x1a5c(%rip),%rsi        # 2c40 <malloc+0x534>
+    11e4:	89 c7                	mov    %eax,%edi
+    11e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11eb:	e8 21 0d 00 00       	call   1f11 <printf>
+    11f0:	90                   	nop
+    11f1:	eb fd                	jmp    11f0 <fdesctest+0x308>
+  assert((fd4 = open("l2_share.txt", O_RDONLY)) > -1);
+    11f3:	be 00 00 00 00       	mov    $0x0,%esi
+    11f8:	48 8d 05 01 1a 00 00 	lea    0x1a01(%rip),%rax        # 2c00 <malloc+0x4f4>
+    11ff:	48 89 c7             	mov    %rax,%rdi
+    1202:	e8 f1 12 00 00       	call   24f8 <open>
+    1207:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    120a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    120e:	79 2b                	jns    123b <fdesctest+0x353>
+    1210:	8b 05 ea 21 00 00    	mov    0x21ea(%rip),%eax        # 3400 <stdout>
+    1216:	48 8d 15 43 1b 00 00 	lea    0x1b43(%rip),%rdx        # 2d60 <malloc+0x654>
+    121d:	48 89 d1             	mov    %rdx,%rcx
+    1220:	ba 3d 01 00 00       	mov    $0x13d,%edx
+    1225:	48 8d 35 14 1a 00 00 	lea    0x1a14(%rip),%rsi        # 2c40 <malloc+0x534>
+    122c:	89 c7                	mov    %eax,%edi
+    122e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1233:	e8 d9 0c 00 00       	call   1f11 <printf>
+    1238:	90                   	nop
+    1239:	eb fd                	jmp    1238 <fdesctest+0x350>
+  assert((fd5 = open("l2_share.txt", O_RDONLY)) > -1);
+    123b:	be 00 00 00 00       	mov    $0x0,%esi
+    1240:	48 8d 05 b9 19 00 00 	lea    0x19b9(%rip),%rax        # 2c00 <malloc+0x4f4>
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 a9 12 00 00       	call   24f8 <open>
+    124f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1252:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1256:	79 2b                	jns    1283 <fdesctest+0x39b>
+    1258:	8b 05 a2 21 00 00    	mov    0x21a2(%rip),%eax        # 3400 <stdout>
+    125e:	48 8d 15 2b 1b 00 00 	lea    0x1b2b(%rip),%rdx        # 2d90 <malloc+0x684>
+    1265:	48 89 d1             	mov    %rdx,%rcx
+    1268:	ba 3e 01 00 00       	mov    $0x13e,%edx
+    126d:	48 8d 35 cc 19 00 00 	lea    0x19cc(%rip),%rsi        # 2c40 <malloc+0x534>
+    1274:	89 c7                	mov    %eax,%edi
+    1276:	b8 00 00 00 00       	mov    $0x0,%eax
+    127b:	e8 91 0c 00 00       	call   1f11 <printf>
+    1280:	90                   	nop
+    1281:	eb fd                	jmp    1280 <fdesctest+0x398>
+
+  assert(close(fd3) != -1);
+    1283:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1286:	89 c7                	mov    %eax,%edi
+    1288:	e8 53 12 00 00       	call   24e0 <close>
+    128d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1290:	75 2b                	jne    12bd <fdesctest+0x3d5>
+    1292:	8b 05 68 21 00 00    	mov    0x2168(%rip),%eax        # 3400 <stdout>
+    1298:	48 8d 15 1d 1b 00 00 	lea    0x1b1d(%rip),%rdx        # 2dbc <malloc+0x6b0>
+    129f:	48 89 d1             	mov    %rdx,%rcx
+    12a2:	ba 40 01 00 00       	mov    $0x140,%edx
+    12a7:	48 8d 35 92 19 00 00 	lea    0x1992(%rip),%rsi        # 2c40 <malloc+0x534>
+    12ae:	89 c7                	mov    %eax,%edi
+    12b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b5:	e8 57 0c 00 00       	call   1f11 <printf>
+    12ba:	90                   	nop
+    12bb:	eb fd                	jmp    12ba <fdesctest+0x3d2>
+  assert(close(fd4) != -1);
+    12bd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    12c0:	89 c7                	mov    %eax,%edi
+    12c2:	e8 19 12 00 00       	call   24e0 <close>
+    12c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12ca:	75 2b                	jne    12f7 <fdesctest+0x40f>
+    12cc:	8b 05 2e 21 00 00    	mov    0x212e(%rip),%eax        # 3400 <stdout>
+    12d2:	48 8d 15 f4 1a 00 00 	lea    0x1af4(%rip),%rdx        # 2dcd <malloc+0x6c1>
+    12d9:	48 89 d1             	mov    %rdx,%rcx
+    12dc:	ba 41 01 00 00       	mov    $0x141,%edx
+    12e1:	48 8d 35 58 19 00 00 	lea    0x1958(%rip),%rsi        # 2c40 <malloc+0x534>
+    12e8:	89 c7                	mov    %eax,%edi
+    12ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    12ef:	e8 1d 0c 00 00       	call   1f11 <printf>
+    12f4:	90                   	nop
+    12f5:	eb fd                	jmp    12f4 <fdesctest+0x40c>
+
+  if (!fork()) {
+    12f7:	e8 b4 11 00 00       	call   24b0 <fork>
+    12fc:	85 c0                	test   %eax,%eax
+    12fe:	0f 85 1d 01 00 00    	jne    1421 <fdesctest+0x539>
+    assert(read(fd2, buf, 10) == 10);
+    1304:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    1308:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    130b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1310:	48 89 ce             	mov    %rcx,%rsi
+    1313:	89 c7                	mov    %eax,%edi
+    1315:	e8 b6 11 00 00       	call   24d0 <read>
+    131a:	83 f8 0a             	cmp    $0xa,%eax
+    131d:	74 2b                	je     134a <fdesctest+0x462>
+    131f:	8b 05 db 20 00 00    	mov    0x20db(%rip),%eax        # 3400 <stdout>
+    1325:	48 8d 15 b2 1a 00 00 	lea    0x1ab2(%rip),%rdx        # 2dde <malloc+0x6d2>
+    132c:	48 89 d1             	mov    %rdx,%rcx
+    132f:	ba 44 01 00 00       	mov    $0x144,%edx
+    1334:	48 8d 35 05 19 00 00 	lea    0x1905(%rip),%rsi        # 2c40 <malloc+0x534>
+    133b:	89 c7                	mov    %eax,%edi
+    133d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1342:	e8 ca 0b 00 00       	call   1f11 <printf>
+    1347:	90                   	nop
+    1348:	eb fd                	jmp    1347 <fdesctest+0x45f>
+    assert(read(fd3, buf, 10) == -1); // this fd shouldn't be open
+    134a:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    134e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1351:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1356:	48 89 ce             	mov    %rcx,%rsi
+    1359:	89 c7                	mov    %eax,%edi
+    135b:	e8 70 11 00 00       	call   24d0 <read>
+    1360:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1363:	74 2b                	je     1390 <fdesctest+0x4a8>
+    1365:	8b 05 95 20 00 00    	mov    0x2095(%rip),%eax        # 3400 <stdout>
+    136b:	48 8d 15 85 1a 00 00 	lea    0x1a85(%rip),%rdx        # 2df7 <malloc+0x6eb>
+    1372:	48 89 d1             	mov    %rdx,%rcx
+    1375:	ba 45 01 00 00       	mov    $0x145,%edx
+    137a:	48 8d 35 bf 18 00 00 	lea    0x18bf(%rip),%rsi        # 2c40 <malloc+0x534>
+    1381:	89 c7                	mov    %eax,%edi
+    1383:	b8 00 00 00 00       	mov    $0x0,%eax
+    1388:	e8 84 0b 00 00       	call   1f11 <printf>
+    138d:	90                   	nop
+    138e:	eb fd                	jmp    138d <fdesctest+0x4a5>
+    assert(read(fd4, buf, 10) == -1); // this fd shouldn't be open
+    1390:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    1394:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1397:	ba 0a 00 00 00       	mov    $0xa,%edx
+    139c:	48 89 ce             	mov    %rcx,%rsi
+    139f:	89 c7                	mov    %eax,%edi
+    13a1:	e8 2a 11 00 00       	call   24d0 <read>
+    13a6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13a9:	74 2b                	je     13d6 <fdesctest+0x4ee>
+    13ab:	8b 05 4f 20 00 00    	mov    0x204f(%rip),%eax        # 3400 <stdout>
+    13b1:	48 8d 15 58 1a 00 00 	lea    0x1a58(%rip),%rdx        # 2e10 <malloc+0x704>
+    13b8:	48 89 d1             	mov    %rdx,%rcx
+    13bb:	ba 46 01 00 00       	mov    $0x146,%edx
+    13c0:	48 8d 35 79 18 00 00 	lea    0x1879(%rip),%rsi        # 2c40 <malloc+0x534>
+    13c7:	89 c7                	mov    %eax,%edi
+    13c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    13ce:	e8 3e 0b 00 00       	call   1f11 <printf>
+    13d3:	90                   	nop
+    13d4:	eb fd                	jmp    13d3 <fdesctest+0x4eb>
+    assert(read(fd5, buf, 10) == 10);
+    13d6:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    13da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    13dd:	ba 0a 00 00 00       	mov    $0xa,%edx
+    13e2:	48 89 ce             	mov    %rcx,%rsi
+    13e5:	89 c7                	mov    %eax,%edi
+    13e7:	e8 e4 10 00 00       	call   24d0 <read>
+    13ec:	83 f8 0a             	cmp    $0xa,%eax
+    13ef:	74 2b                	je     141c <fdesctest+0x534>
+    13f1:	8b 05 09 20 00 00    	mov    0x2009(%rip),%eax        # 3400 <stdout>
+    13f7:	48 8d 15 2b 1a 00 00 	lea    0x1a2b(%rip),%rdx        # 2e29 <malloc+0x71d>
+    13fe:	48 89 d1             	mov    %rdx,%rcx
+    1401:	ba 47 01 00 00       	mov    $0x147,%edx
+    1406:	48 8d 35 33 18 00 00 	lea    0x1833(%rip),%rsi        # 2c40 <malloc+0x534>
+    140d:	89 c7                	mov    %eax,%edi
+    140f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1414:	e8 f8 0a 00 00       	call   1f11 <printf>
+    1419:	90                   	nop
+    141a:	eb fd                	jmp    1419 <fdesctest+0x531>
+    exit();
+    141c:	e8 97 10 00 00       	call   24b8 <exit>
+  } else {
+    wait();
+    1421:	e8 9a 10 00 00       	call   24c0 <wait>
+  }
+
+  printf(1, "fdesctest: ok\n");
+    1426:	48 8d 05 15 1a 00 00 	lea    0x1a15(%rip),%rax        # 2e42 <malloc+0x736>
+    142d:	48 89 c6             	mov    %rax,%rsi
+    1430:	bf 01 00 00 00       	mov    $0x1,%edi
+    1435:	b8 00 00 00 00       	mov    $0x0,%eax
+    143a:	e8 d2 0a 00 00       	call   1f11 <printf>
+}
+    143f:	90                   	nop
+    1440:	c9                   	leave
+    1441:	c3                   	ret
+
+0000000000001442 <childpidtesthelper>:
+
+static void childpidtesthelper(int depth) {
+    1442:	55                   	push   %rbp
+    1443:	48 89 e5             	mov    %rsp,%rbp
+    1446:	48 83 ec 30          	sub    $0x30,%rsp
+    144a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  int pids[3];
+  int i, j, p;
+
+  if (depth == 0)
+    144d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1451:	0f 84 c4 01 00 00    	je     161b <childpidtesthelper+0x1d9>
+    return;
+
+  for (i = 0; i < 3; i++) {
+    1457:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    145e:	eb 6a                	jmp    14ca <childpidtesthelper+0x88>
+    pids[i] = fork();
+    1460:	e8 4b 10 00 00       	call   24b0 <fork>
+    1465:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1468:	48 63 d2             	movslq %edx,%rdx
+    146b:	89 44 95 e8          	mov    %eax,-0x18(%rbp,%rdx,4)
+    assert(pids[i] >= 0);
+    146f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1472:	48 98                	cltq
+    1474:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    1478:	85 c0                	test   %eax,%eax
+    147a:	79 2b                	jns    14a7 <childpidtesthelper+0x65>
+    147c:	8b 05 7e 1f 00 00    	mov    0x1f7e(%rip),%eax        # 3400 <stdout>
+    1482:	48 8d 15 c8 19 00 00 	lea    0x19c8(%rip),%rdx        # 2e51 <malloc+0x745>
+    1489:	48 89 d1             	mov    %rdx,%rcx
+    148c:	ba 59 01 00 00       	mov    $0x159,%edx
+    1491:	48 8d 35 a8 17 00 00 	lea    0x17a8(%rip),%rsi        # 2c40 <malloc+0x534>
+    1498:	89 c7                	mov    %eax,%edi
+    149a:	b8 00 00 00 00       	mov    $0x0,%eax
+    149f:	e8 6d 0a 00 00       	call   1f11 <printf>
+    14a4:	90                   	nop
+    14a5:	eb fd                	jmp    14a4 <childpidtesthelper+0x62>
+    if (!pids[i]) {
+    14a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14aa:	48 98                	cltq
+    14ac:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    14b0:	85 c0                	test   %eax,%eax
+    14b2:	75 12                	jne    14c6 <childpidtesthelper+0x84>
+      childpidtesthelper(depth - 1);
+    14b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    14b7:	83 e8 01             	sub    $0x1,%eax
+    14ba:	89 c7                	mov    %eax,%edi
+    14bc:	e8 81 ff ff ff       	call   1442 <childpidtesthelper>
+      exit();
+    14c1:	e8 f2 0f 00 00       	call   24b8 <exit>
+  for (i = 0; i < 3; i++) {
+    14c6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    14ca:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    14ce:	7e 90                	jle    1460 <childpidtesthelper+0x1e>
+    }
+  }
+
+  for (i = 0; i < 3; i++) {
+    14d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    14d7:	e9 cf 00 00 00       	jmp    15ab <childpidtesthelper+0x169>
+    p = wait();
+    14dc:	e8 df 0f 00 00       	call   24c0 <wait>
+    14e1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    assert(p > 0);
+    14e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    14e8:	7f 2b                	jg     1515 <childpidtesthelper+0xd3>
+    14ea:	8b 05 10 1f 00 00    	mov    0x1f10(%rip),%eax        # 3400 <stdout>
+    14f0:	48 8d 15 67 19 00 00 	lea    0x1967(%rip),%rdx        # 2e5e <malloc+0x752>
+    14f7:	48 89 d1             	mov    %rdx,%rcx
+    14fa:	ba 62 01 00 00       	mov    $0x162,%edx
+    14ff:	48 8d 35 3a 17 00 00 	lea    0x173a(%rip),%rsi        # 2c40 <malloc+0x534>
+    1506:	89 c7                	mov    %eax,%edi
+    1508:	b8 00 00 00 00       	mov    $0x0,%eax
+    150d:	e8 ff 09 00 00       	call   1f11 <printf>
+    1512:	90                   	nop
+    1513:	eb fd                	jmp    1512 <childpidtesthelper+0xd0>
+    for (j = 0; j < 3; j++) {
+    1515:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    151c:	eb 21                	jmp    153f <childpidtesthelper+0xfd>
+      if (p == pids[j]) {
+    151e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1521:	48 98                	cltq
+    1523:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    1527:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    152a:	75 0f                	jne    153b <childpidtesthelper+0xf9>
+        pids[j] = -1; // make sure duplicates are not returned
+    152c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    152f:	48 98                	cltq
+    1531:	c7 44 85 e8 ff ff ff 	movl   $0xffffffff,-0x18(%rbp,%rax,4)
+    1538:	ff 
+        break;
+    1539:	eb 0a                	jmp    1545 <childpidtesthelper+0x103>
+    for (j = 0; j < 3; j++) {
+    153b:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    153f:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+    1543:	7e d9                	jle    151e <childpidtesthelper+0xdc>
+      }
+    }
+    if (j == 3)
+    1545:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+    1549:	75 5c                	jne    15a7 <childpidtesthelper+0x165>
+      error("returned pid was not a child");
+    154b:	8b 05 af 1e 00 00    	mov    0x1eaf(%rip),%eax        # 3400 <stdout>
+    1551:	ba 6a 01 00 00       	mov    $0x16a,%edx
+    1556:	48 8d 0d d3 12 00 00 	lea    0x12d3(%rip),%rcx        # 2830 <malloc+0x124>
+    155d:	48 89 ce             	mov    %rcx,%rsi
+    1560:	89 c7                	mov    %eax,%edi
+    1562:	b8 00 00 00 00       	mov    $0x0,%eax
+    1567:	e8 a5 09 00 00       	call   1f11 <printf>
+    156c:	8b 05 8e 1e 00 00    	mov    0x1e8e(%rip),%eax        # 3400 <stdout>
+    1572:	48 8d 15 eb 18 00 00 	lea    0x18eb(%rip),%rdx        # 2e64 <malloc+0x758>
+    1579:	48 89 d6             	mov    %rdx,%rsi
+    157c:	89 c7                	mov    %eax,%edi
+    157e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1583:	e8 89 09 00 00       	call   1f11 <printf>
+    1588:	8b 05 72 1e 00 00    	mov    0x1e72(%rip),%eax        # 3400 <stdout>
+    158e:	48 8d 15 d6 12 00 00 	lea    0x12d6(%rip),%rdx        # 286b <malloc+0x15f>
+    1595:	48 89 d6             	mov    %rdx,%rsi
+    1598:	89 c7                	mov    %eax,%edi
+    159a:	b8 00 00 00 00       	mov    $0x0,%eax
+    159f:	e8 6d 09 00 00       	call   1f11 <printf>
+    15a4:	90                   	nop
+    15a5:	eb fd                	jmp    15a4 <childpidtesthelper+0x162>
+  for (i = 0; i < 3; i++) {
+    15a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15ab:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    15af:	0f 8e 27 ff ff ff    	jle    14dc <childpidtesthelper+0x9a>
+  }
+
+  // No more children
+  if (wait() != -1)
+    15b5:	e8 06 0f 00 00       	call   24c0 <wait>
+    15ba:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15bd:	74 5d                	je     161c <childpidtesthelper+0x1da>
+    error("there should be no more children");
+    15bf:	8b 05 3b 1e 00 00    	mov    0x1e3b(%rip),%eax        # 3400 <stdout>
+    15c5:	ba 6f 01 00 00       	mov    $0x16f,%edx
+    15ca:	48 8d 0d 5f 12 00 00 	lea    0x125f(%rip),%rcx        # 2830 <malloc+0x124>
+    15d1:	48 89 ce             	mov    %rcx,%rsi
+    15d4:	89 c7                	mov    %eax,%edi
+    15d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    15db:	e8 31 09 00 00       	call   1f11 <printf>
+    15e0:	8b 05 1a 1e 00 00    	mov    0x1e1a(%rip),%eax        # 3400 <stdout>
+    15e6:	48 8d 15 9b 18 00 00 	lea    0x189b(%rip),%rdx        # 2e88 <malloc+0x77c>
+    15ed:	48 89 d6             	mov    %rdx,%rsi
+    15f0:	89 c7                	mov    %eax,%edi
+    15f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15f7:	e8 15 09 00 00       	call   1f11 <printf>
+    15fc:	8b 05 fe 1d 00 00    	mov    0x1dfe(%rip),%eax        # 3400 <stdout>
+    1602:	48 8d 15 62 12 00 00 	lea    0x1262(%rip),%rdx        # 286b <malloc+0x15f>
+    1609:	48 89 d6             	mov    %rdx,%rsi
+    160c:	89 c7                	mov    %eax,%edi
+    160e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1613:	e8 f9 08 00 00       	call   1f11 <printf>
+    1618:	90                   	nop
+    1619:	eb fd                	jmp    1618 <childpidtesthelper+0x1d6>
+    return;
+    161b:	90                   	nop
+}
+    161c:	c9                   	leave
+    161d:	c3                   	ret
+
+000000000000161e <childpidtest>:
+
+void childpidtest() {
+    161e:	55                   	push   %rbp
+    161f:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "childpidtest\n");
+    1622:	48 8d 05 80 18 00 00 	lea    0x1880(%rip),%rax        # 2ea9 <malloc+0x79d>
+    1629:	48 89 c6             	mov    %rax,%rsi
+    162c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1631:	b8 00 00 00 00       	mov    $0x0,%eax
+    1636:	e8 d6 08 00 00       	call   1f11 <printf>
+  childpidtesthelper(2);
+    163b:	bf 02 00 00 00       	mov    $0x2,%edi
+    1640:	e8 fd fd ff ff       	call   1442 <childpidtesthelper>
+  printf(1, "childpidtest: ok\n");
+    1645:	48 8d 05 6b 18 00 00 	lea    0x186b(%rip),%rax        # 2eb7 <malloc+0x7ab>
+    164c:	48 89 c6             	mov    %rax,%rsi
+    164f:	bf 01 00 00 00       	mov    $0x1,%edi
+    1654:	b8 00 00 00 00       	mov    $0x0,%eax
+    1659:	e8 b3 08 00 00       	call   1f11 <printf>
+}
+    165e:	90                   	nop
+    165f:	5d                   	pop    %rbp
+    1660:	c3                   	ret
+
+0000000000001661 <exectest>:
+
+void exectest(void) {
+    1661:	55                   	push   %rbp
+    1662:	48 89 e5             	mov    %rsp,%rbp
+    1665:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  printf(1, "exectest\n");
+    166c:	48 8d 05 56 18 00 00 	lea    0x1856(%rip),%rax        # 2ec9 <malloc+0x7bd>
+    1673:	48 89 c6             	mov    %rax,%rsi
+    1676:	bf 01 00 00 00       	mov    $0x1,%edi
+    167b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1680:	e8 8c 08 00 00       	call   1f11 <printf>
+  // exectest arg checking
+  int pid = fork();
+    1685:	e8 26 0e 00 00       	call   24b0 <fork>
+    168a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    168d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1691:	79 5c                	jns    16ef <exectest+0x8e>
+    error("exectest: fork failed\n");
+    1693:	8b 05 67 1d 00 00    	mov    0x1d67(%rip),%eax        # 3400 <stdout>
+    1699:	ba 7d 01 00 00       	mov    $0x17d,%edx
+    169e:	48 8d 0d 8b 11 00 00 	lea    0x118b(%rip),%rcx        # 2830 <malloc+0x124>
+    16a5:	48 89 ce             	mov    %rcx,%rsi
+    16a8:	89 c7                	mov    %eax,%edi
+    16aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    16af:	e8 5d 08 00 00       	call   1f11 <printf>
+    16b4:	8b 05 46 1d 00 00    	mov    0x1d46(%rip),%eax        # 3400 <stdout>
+    16ba:	48 8d 15 12 18 00 00 	lea    0x1812(%rip),%rdx        # 2ed3 <malloc+0x7c7>
+    16c1:	48 89 d6             	mov    %rdx,%rsi
+    16c4:	89 c7                	mov    %eax,%edi
+    16c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    16cb:	e8 41 08 00 00       	call   1f11 <printf>
+    16d0:	8b 05 2a 1d 00 00    	mov    0x1d2a(%rip),%eax        # 3400 <stdout>
+    16d6:	48 8d 15 8e 11 00 00 	lea    0x118e(%rip),%rdx        # 286b <malloc+0x15f>
+    16dd:	48 89 d6             	mov    %rdx,%rsi
+    16e0:	89 c7                	mov    %eax,%edi
+    16e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e7:	e8 25 08 00 00       	call   1f11 <printf>
+    16ec:	90                   	nop
+    16ed:	eb fd                	jmp    16ec <exectest+0x8b>
+  }
+  if (pid == 0) {
+    16ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    16f3:	0f 85 18 01 00 00    	jne    1811 <exectest+0x1b0>
+    // test for invalid argv
+    char **argv1 = (char **)0xf00df00d;
+    16f9:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    16fe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (exec("ls", argv1) != -1)
+    1702:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1706:	48 89 c6             	mov    %rax,%rsi
+    1709:	48 8d 05 da 17 00 00 	lea    0x17da(%rip),%rax        # 2eea <malloc+0x7de>
+    1710:	48 89 c7             	mov    %rax,%rdi
+    1713:	e8 d8 0d 00 00       	call   24f0 <exec>
+    1718:	83 f8 ff             	cmp    $0xffffffff,%eax
+    171b:	74 5c                	je     1779 <exectest+0x118>
+      error("exec test: invalid argv\n");
+    171d:	8b 05 dd 1c 00 00    	mov    0x1cdd(%rip),%eax        # 3400 <stdout>
+    1723:	ba 83 01 00 00       	mov    $0x183,%edx
+    1728:	48 8d 0d 01 11 00 00 	lea    0x1101(%rip),%rcx        # 2830 <malloc+0x124>
+    172f:	48 89 ce             	mov    %rcx,%rsi
+    1732:	89 c7                	mov    %eax,%edi
+    1734:	b8 00 00 00 00       	mov    $0x0,%eax
+    1739:	e8 d3 07 00 00       	call   1f11 <printf>
+    173e:	8b 05 bc 1c 00 00    	mov    0x1cbc(%rip),%eax        # 3400 <stdout>
+    1744:	48 8d 15 a2 17 00 00 	lea    0x17a2(%rip),%rdx        # 2eed <malloc+0x7e1>
+    174b:	48 89 d6             	mov    %rdx,%rsi
+    174e:	89 c7                	mov    %eax,%edi
+    1750:	b8 00 00 00 00       	mov    $0x0,%eax
+    1755:	e8 b7 07 00 00       	call   1f11 <printf>
+    175a:	8b 05 a0 1c 00 00    	mov    0x1ca0(%rip),%eax        # 3400 <stdout>
+    1760:	48 8d 15 04 11 00 00 	lea    0x1104(%rip),%rdx        # 286b <malloc+0x15f>
+    1767:	48 89 d6             	mov    %rdx,%rsi
+    176a:	89 c7                	mov    %eax,%edi
+    176c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1771:	e8 9b 07 00 00       	call   1f11 <printf>
+    1776:	90                   	nop
+    1777:	eb fd                	jmp    1776 <exectest+0x115>
+
+    // test for invalid argv[1]
+    char *argv3[] = { "ls", (char *) 0xf00df00d, 0 };
+    1779:	48 8d 05 6a 17 00 00 	lea    0x176a(%rip),%rax        # 2eea <malloc+0x7de>
+    1780:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+    1784:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    1789:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    178d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+    1794:	00 
+    if (exec("ls", argv3) != -1)
+    1795:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+    1799:	48 89 c6             	mov    %rax,%rsi
+    179c:	48 8d 05 47 17 00 00 	lea    0x1747(%rip),%rax        # 2eea <malloc+0x7de>
+    17a3:	48 89 c7             	mov    %rax,%rdi
+    17a6:	e8 45 0d 00 00       	call   24f0 <exec>
+    17ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17ae:	74 5c                	je     180c <exectest+0x1ab>
+      error("exec test: argv[1] out of stack\n");
+    17b0:	8b 05 4a 1c 00 00    	mov    0x1c4a(%rip),%eax        # 3400 <stdout>
+    17b6:	ba 88 01 00 00       	mov    $0x188,%edx
+    17bb:	48 8d 0d 6e 10 00 00 	lea    0x106e(%rip),%rcx        # 2830 <malloc+0x124>
+    17c2:	48 89 ce             	mov    %rcx,%rsi
+    17c5:	89 c7                	mov    %eax,%edi
+    17c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    17cc:	e8 40 07 00 00       	call   1f11 <printf>
+    17d1:	8b 05 29 1c 00 00    	mov    0x1c29(%rip),%eax        # 3400 <stdout>
+    17d7:	48 8d 15 2a 17 00 00 	lea    0x172a(%rip),%rdx        # 2f08 <malloc+0x7fc>
+    17de:	48 89 d6             	mov    %rdx,%rsi
+    17e1:	89 c7                	mov    %eax,%edi
+    17e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    17e8:	e8 24 07 00 00       	call   1f11 <printf>
+    17ed:	8b 05 0d 1c 00 00    	mov    0x1c0d(%rip),%eax        # 3400 <stdout>
+    17f3:	48 8d 15 71 10 00 00 	lea    0x1071(%rip),%rdx        # 286b <malloc+0x15f>
+    17fa:	48 89 d6             	mov    %rdx,%rsi
+    17fd:	89 c7                	mov    %eax,%edi
+    17ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1804:	e8 08 07 00 00       	call   1f11 <printf>
+    1809:	90                   	nop
+    180a:	eb fd                	jmp    1809 <exectest+0x1a8>
+
+    exit();
+    180c:	e8 a7 0c 00 00       	call   24b8 <exit>
+  } else {
+    if (wait() != pid) {
+    1811:	e8 aa 0c 00 00       	call   24c0 <wait>
+    1816:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1819:	74 5c                	je     1877 <exectest+0x216>
+      error("exec test: wait wrong pid");
+    181b:	8b 05 df 1b 00 00    	mov    0x1bdf(%rip),%eax        # 3400 <stdout>
+    1821:	ba 8d 01 00 00       	mov    $0x18d,%edx
+    1826:	48 8d 0d 03 10 00 00 	lea    0x1003(%rip),%rcx        # 2830 <malloc+0x124>
+    182d:	48 89 ce             	mov    %rcx,%rsi
+    1830:	89 c7                	mov    %eax,%edi
+    1832:	b8 00 00 00 00       	mov    $0x0,%eax
+    1837:	e8 d5 06 00 00       	call   1f11 <printf>
+    183c:	8b 05 be 1b 00 00    	mov    0x1bbe(%rip),%eax        # 3400 <stdout>
+    1842:	48 8d 15 e0 16 00 00 	lea    0x16e0(%rip),%rdx        # 2f29 <malloc+0x81d>
+    1849:	48 89 d6             	mov    %rdx,%rsi
+    184c:	89 c7                	mov    %eax,%edi
+    184e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1853:	e8 b9 06 00 00       	call   1f11 <printf>
+    1858:	8b 05 a2 1b 00 00    	mov    0x1ba2(%rip),%eax        # 3400 <stdout>
+    185e:	48 8d 15 06 10 00 00 	lea    0x1006(%rip),%rdx        # 286b <malloc+0x15f>
+    1865:	48 89 d6             	mov    %rdx,%rsi
+    1868:	89 c7                	mov    %eax,%edi
+    186a:	b8 00 00 00 00       	mov    $0x0,%eax
+    186f:	e8 9d 06 00 00       	call   1f11 <printf>
+    1874:	90                   	nop
+    1875:	eb fd                	jmp    1874 <exectest+0x213>
+    }
+  }
+	printf(1, "exectest: testing ls\n");
+    1877:	48 8d 05 c5 16 00 00 	lea    0x16c5(%rip),%rax        # 2f43 <malloc+0x837>
+    187e:	48 89 c6             	mov    %rax,%rsi
+    1881:	bf 01 00 00 00       	mov    $0x1,%edi
+    1886:	b8 00 00 00 00       	mov    $0x0,%eax
+    188b:	e8 81 06 00 00       	call   1f11 <printf>
+  pid = fork();
+    1890:	e8 1b 0c 00 00       	call   24b0 <fork>
+    1895:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    1898:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    189c:	79 5c                	jns    18fa <exectest+0x299>
+    error("exectest: fork failed\n");
+    189e:	8b 05 5c 1b 00 00    	mov    0x1b5c(%rip),%eax        # 3400 <stdout>
+    18a4:	ba 93 01 00 00       	mov    $0x193,%edx
+    18a9:	48 8d 0d 80 0f 00 00 	lea    0xf80(%rip),%rcx        # 2830 <malloc+0x124>
+    18b0:	48 89 ce             	mov    %rcx,%rsi
+    18b3:	89 c7                	mov    %eax,%edi
+    18b5:	b8 00 00 00 00       	mov    $0x0,%eax
+    18ba:	e8 52 06 00 00       	call   1f11 <printf>
+    18bf:	8b 05 3b 1b 00 00    	mov    0x1b3b(%rip),%eax        # 3400 <stdout>
+    18c5:	48 8d 15 07 16 00 00 	lea    0x1607(%rip),%rdx        # 2ed3 <malloc+0x7c7>
+    18cc:	48 89 d6             	mov    %rdx,%rsi
+    18cf:	89 c7                	mov    %eax,%edi
+    18d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    18d6:	e8 36 06 00 00       	call   1f11 <printf>
+    18db:	8b 05 1f 1b 00 00    	mov    0x1b1f(%rip),%eax        # 3400 <stdout>
+    18e1:	48 8d 15 83 0f 00 00 	lea    0xf83(%rip),%rdx        # 286b <malloc+0x15f>
+    18e8:	48 89 d6             	mov    %rdx,%rsi
+    18eb:	89 c7                	mov    %eax,%edi
+    18ed:	b8 00 00 00 00       	mov    $0x0,%eax
+    18f2:	e8 1a 06 00 00       	call   1f11 <printf>
+    18f7:	90                   	nop
+    18f8:	eb fd                	jmp    18f7 <exectest+0x296>
+  }
+  char *argv[] = {"ls", 0};
+    18fa:	48 8d 05 e9 15 00 00 	lea    0x15e9(%rip),%rax        # 2eea <malloc+0x7de>
+    1901:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1905:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+    190c:	00 
+
+  if (pid == 0) {
+    190d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1911:	75 72                	jne    1985 <exectest+0x324>
+    exec("ls", argv);
+    1913:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    1917:	48 89 c6             	mov    %rax,%rsi
+    191a:	48 8d 05 c9 15 00 00 	lea    0x15c9(%rip),%rax        # 2eea <malloc+0x7de>
+    1921:	48 89 c7             	mov    %rax,%rdi
+    1924:	e8 c7 0b 00 00       	call   24f0 <exec>
+    error("exectest: exec ls failed\n");
+    1929:	8b 05 d1 1a 00 00    	mov    0x1ad1(%rip),%eax        # 3400 <stdout>
+    192f:	ba 99 01 00 00       	mov    $0x199,%edx
+    1934:	48 8d 0d f5 0e 00 00 	lea    0xef5(%rip),%rcx        # 2830 <malloc+0x124>
+    193b:	48 89 ce             	mov    %rcx,%rsi
+    193e:	89 c7                	mov    %eax,%edi
+    1940:	b8 00 00 00 00       	mov    $0x0,%eax
+    1945:	e8 c7 05 00 00       	call   1f11 <printf>
+    194a:	8b 05 b0 1a 00 00    	mov    0x1ab0(%rip),%eax        # 3400 <stdout>
+    1950:	48 8d 15 02 16 00 00 	lea    0x1602(%rip),%rdx        # 2f59 <malloc+0x84d>
+    1957:	48 89 d6             	mov    %rdx,%rsi
+    195a:	89 c7                	mov    %eax,%edi
+    195c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1961:	e8 ab 05 00 00       	call   1f11 <printf>
+    1966:	8b 05 94 1a 00 00    	mov    0x1a94(%rip),%eax        # 3400 <stdout>
+    196c:	48 8d 15 f8 0e 00 00 	lea    0xef8(%rip),%rdx        # 286b <malloc+0x15f>
+    1973:	48 89 d6             	mov    %rdx,%rsi
+    1976:	89 c7                	mov    %eax,%edi
+    1978:	b8 00 00 00 00       	mov    $0x0,%eax
+    197d:	e8 8f 05 00 00       	call   1f11 <printf>
+    1982:	90                   	nop
+    1983:	eb fd                	jmp    1982 <exectest+0x321>
+  } else {
+    pid = wait();
+    1985:	e8 36 0b 00 00       	call   24c0 <wait>
+    198a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  char *echoargv[] = {"echo", "echotest", "ok", 0};
+    198d:	48 8d 05 df 15 00 00 	lea    0x15df(%rip),%rax        # 2f73 <malloc+0x867>
+    1994:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1998:	48 8d 05 d9 15 00 00 	lea    0x15d9(%rip),%rax        # 2f78 <malloc+0x86c>
+    199f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    19a3:	48 8d 05 d7 15 00 00 	lea    0x15d7(%rip),%rax        # 2f81 <malloc+0x875>
+    19aa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    19ae:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    19b5:	00 
+  printf(stdout, "exectest: test argument\n");
+    19b6:	8b 05 44 1a 00 00    	mov    0x1a44(%rip),%eax        # 3400 <stdout>
+    19bc:	48 8d 15 c1 15 00 00 	lea    0x15c1(%rip),%rdx        # 2f84 <malloc+0x878>
+    19c3:	48 89 d6             	mov    %rdx,%rsi
+    19c6:	89 c7                	mov    %eax,%edi
+    19c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    19cd:	e8 3f 05 00 00       	call   1f11 <printf>
+
+  int fds[2];
+  assert(pipe(fds) == 0);
+    19d2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    19d6:	48 89 c7             	mov    %rax,%rdi
+    19d9:	e8 ea 0a 00 00       	call   24c8 <pipe>
+    19de:	85 c0                	test   %eax,%eax
+    19e0:	74 2b                	je     1a0d <exectest+0x3ac>
+    19e2:	8b 05 18 1a 00 00    	mov    0x1a18(%rip),%eax        # 3400 <stdout>
+    19e8:	48 8d 15 ae 15 00 00 	lea    0x15ae(%rip),%rdx        # 2f9d <malloc+0x891>
+    19ef:	48 89 d1             	mov    %rdx,%rcx
+    19f2:	ba a2 01 00 00       	mov    $0x1a2,%edx
+    19f7:	48 8d 35 42 12 00 00 	lea    0x1242(%rip),%rsi        # 2c40 <malloc+0x534>
+    19fe:	89 c7                	mov    %eax,%edi
+    1a00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a05:	e8 07 05 00 00       	call   1f11 <printf>
+    1a0a:	90                   	nop
+    1a0b:	eb fd                	jmp    1a0a <exectest+0x3a9>
+
+  pid = fork();
+    1a0d:	e8 9e 0a 00 00       	call   24b0 <fork>
+    1a12:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    1a15:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1a19:	79 5c                	jns    1a77 <exectest+0x416>
+    error("exectest: fork failed\n");
+    1a1b:	8b 05 df 19 00 00    	mov    0x19df(%rip),%eax        # 3400 <stdout>
+    1a21:	ba a6 01 00 00       	mov    $0x1a6,%edx
+    1a26:	48 8d 0d 03 0e 00 00 	lea    0xe03(%rip),%rcx        # 2830 <malloc+0x124>
+    1a2d:	48 89 ce             	mov    %rcx,%rsi
+    1a30:	89 c7                	mov    %eax,%edi
+    1a32:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a37:	e8 d5 04 00 00       	call   1f11 <printf>
+    1a3c:	8b 05 be 19 00 00    	mov    0x19be(%rip),%eax        # 3400 <stdout>
+    1a42:	48 8d 15 8a 14 00 00 	lea    0x148a(%rip),%rdx        # 2ed3 <malloc+0x7c7>
+    1a49:	48 89 d6             	mov    %rdx,%rsi
+    1a4c:	89 c7                	mov    %eax,%edi
+    1a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a53:	e8 b9 04 00 00       	call   1f11 <printf>
+    1a58:	8b 05 a2 19 00 00    	mov    0x19a2(%rip),%eax        # 3400 <stdout>
+    1a5e:	48 8d 15 06 0e 00 00 	lea    0xe06(%rip),%rdx        # 286b <malloc+0x15f>
+    1a65:	48 89 d6             	mov    %rdx,%rsi
+    1a68:	89 c7                	mov    %eax,%edi
+    1a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a6f:	e8 9d 04 00 00       	call   1f11 <printf>
+    1a74:	90                   	nop
+    1a75:	eb fd                	jmp    1a74 <exectest+0x413>
+  }
+
+  if (pid == 0) {
+    1a77:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1a7b:	0f 85 c0 00 00 00    	jne    1b41 <exectest+0x4e0>
+    // send output to parent.
+    close(stdout);
+    1a81:	8b 05 79 19 00 00    	mov    0x1979(%rip),%eax        # 3400 <stdout>
+    1a87:	89 c7                	mov    %eax,%edi
+    1a89:	e8 52 0a 00 00       	call   24e0 <close>
+    assert(dup(fds[1]) == stdout);
+    1a8e:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1a91:	89 c7                	mov    %eax,%edi
+    1a93:	e8 98 0a 00 00       	call   2530 <dup>
+    1a98:	89 c2                	mov    %eax,%edx
+    1a9a:	8b 05 60 19 00 00    	mov    0x1960(%rip),%eax        # 3400 <stdout>
+    1aa0:	39 c2                	cmp    %eax,%edx
+    1aa2:	74 2b                	je     1acf <exectest+0x46e>
+    1aa4:	8b 05 56 19 00 00    	mov    0x1956(%rip),%eax        # 3400 <stdout>
+    1aaa:	48 8d 15 fb 14 00 00 	lea    0x14fb(%rip),%rdx        # 2fac <malloc+0x8a0>
+    1ab1:	48 89 d1             	mov    %rdx,%rcx
+    1ab4:	ba ac 01 00 00       	mov    $0x1ac,%edx
+    1ab9:	48 8d 35 80 11 00 00 	lea    0x1180(%rip),%rsi        # 2c40 <malloc+0x534>
+    1ac0:	89 c7                	mov    %eax,%edi
+    1ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ac7:	e8 45 04 00 00       	call   1f11 <printf>
+    1acc:	90                   	nop
+    1acd:	eb fd                	jmp    1acc <exectest+0x46b>
+    exec("echo", echoargv);
+    1acf:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+    1ad3:	48 89 c6             	mov    %rax,%rsi
+    1ad6:	48 8d 05 96 14 00 00 	lea    0x1496(%rip),%rax        # 2f73 <malloc+0x867>
+    1add:	48 89 c7             	mov    %rax,%rdi
+    1ae0:	e8 0b 0a 00 00       	call   24f0 <exec>
+    error("exectest: exec echo failed\n");
+    1ae5:	8b 05 15 19 00 00    	mov    0x1915(%rip),%eax        # 3400 <stdout>
+    1aeb:	ba ae 01 00 00       	mov    $0x1ae,%edx
+    1af0:	48 8d 0d 39 0d 00 00 	lea    0xd39(%rip),%rcx        # 2830 <malloc+0x124>
+    1af7:	48 89 ce             	mov    %rcx,%rsi
+    1afa:	89 c7                	mov    %eax,%edi
+    1afc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b01:	e8 0b 04 00 00       	call   1f11 <printf>
+    1b06:	8b 05 f4 18 00 00    	mov    0x18f4(%rip),%eax        # 3400 <stdout>
+    1b0c:	48 8d 15 af 14 00 00 	lea    0x14af(%rip),%rdx        # 2fc2 <malloc+0x8b6>
+    1b13:	48 89 d6             	mov    %rdx,%rsi
+    1b16:	89 c7                	mov    %eax,%edi
+    1b18:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b1d:	e8 ef 03 00 00       	call   1f11 <printf>
+    1b22:	8b 05 d8 18 00 00    	mov    0x18d8(%rip),%eax        # 3400 <stdout>
+    1b28:	48 8d 15 3c 0d 00 00 	lea    0xd3c(%rip),%rdx        # 286b <malloc+0x15f>
+    1b2f:	48 89 d6             	mov    %rdx,%rsi
+    1b32:	89 c7                	mov    %eax,%edi
+    1b34:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b39:	e8 d3 03 00 00       	call   1f11 <printf>
+    1b3e:	90                   	nop
+    1b3f:	eb fd                	jmp    1b3e <exectest+0x4dd>
+  } else {
+    assert(wait() == pid);
+    1b41:	e8 7a 09 00 00       	call   24c0 <wait>
+    1b46:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1b49:	74 2b                	je     1b76 <exectest+0x515>
+    1b4b:	8b 05 af 18 00 00    	mov    0x18af(%rip),%eax        # 3400 <stdout>
+    1b51:	48 8d 15 86 14 00 00 	lea    0x1486(%rip),%rdx        # 2fde <malloc+0x8d2>
+    1b58:	48 89 d1             	mov    %rdx,%rcx
+    1b5b:	ba b0 01 00 00       	mov    $0x1b0,%edx
+    1b60:	48 8d 35 d9 10 00 00 	lea    0x10d9(%rip),%rsi        # 2c40 <malloc+0x534>
+    1b67:	89 c7                	mov    %eax,%edi
+    1b69:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b6e:	e8 9e 03 00 00       	call   1f11 <printf>
+    1b73:	90                   	nop
+    1b74:	eb fd                	jmp    1b73 <exectest+0x512>
+
+    // read output from child.
+    printf(stdout, "exectest: test output\n");
+    1b76:	8b 05 84 18 00 00    	mov    0x1884(%rip),%eax        # 3400 <stdout>
+    1b7c:	48 8d 15 69 14 00 00 	lea    0x1469(%rip),%rdx        # 2fec <malloc+0x8e0>
+    1b83:	48 89 d6             	mov    %rdx,%rsi
+    1b86:	89 c7                	mov    %eax,%edi
+    1b88:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b8d:	e8 7f 03 00 00       	call   1f11 <printf>
+    close(fds[1]); // close write end, read until EOF
+    1b92:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1b95:	89 c7                	mov    %eax,%edi
+    1b97:	e8 44 09 00 00       	call   24e0 <close>
+    char buf[16];
+    char *expected = "echotest ok\n";
+    1b9c:	48 8d 05 60 14 00 00 	lea    0x1460(%rip),%rax        # 3003 <malloc+0x8f7>
+    1ba3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+    int byte_to_read = 15;
+    1ba7:	c7 45 fc 0f 00 00 00 	movl   $0xf,-0x4(%rbp)
+    int count = 0;
+    1bae:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    while (count < 12) {
+    1bb5:	e9 97 00 00 00       	jmp    1c51 <exectest+0x5f0>
+      int ret = read(fds[0], buf + count, byte_to_read);
+    1bba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1bbd:	48 98                	cltq
+    1bbf:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1bc6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1bca:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1bcd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1bd0:	48 89 ce             	mov    %rcx,%rsi
+    1bd3:	89 c7                	mov    %eax,%edi
+    1bd5:	e8 f6 08 00 00       	call   24d0 <read>
+    1bda:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+      if (ret == 0 || ret == -1)
+    1bdd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    1be1:	74 06                	je     1be9 <exectest+0x588>
+    1be3:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%rbp)
+    1be7:	75 5c                	jne    1c45 <exectest+0x5e4>
+        error("exectest: exec echotest no output");
+    1be9:	8b 05 11 18 00 00    	mov    0x1811(%rip),%eax        # 3400 <stdout>
+    1bef:	ba bd 01 00 00       	mov    $0x1bd,%edx
+    1bf4:	48 8d 0d 35 0c 00 00 	lea    0xc35(%rip),%rcx        # 2830 <malloc+0x124>
+    1bfb:	48 89 ce             	mov    %rcx,%rsi
+    1bfe:	89 c7                	mov    %eax,%edi
+    1c00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c05:	e8 07 03 00 00       	call   1f11 <printf>
+    1c0a:	8b 05 f0 17 00 00    	mov    0x17f0(%rip),%eax        # 3400 <stdout>
+    1c10:	48 8d 15 f9 13 00 00 	lea    0x13f9(%rip),%rdx        # 3010 <malloc+0x904>
+    1c17:	48 89 d6             	mov    %rdx,%rsi
+    1c1a:	89 c7                	mov    %eax,%edi
+    1c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c21:	e8 eb 02 00 00       	call   1f11 <printf>
+    1c26:	8b 05 d4 17 00 00    	mov    0x17d4(%rip),%eax        # 3400 <stdout>
+    1c2c:	48 8d 15 38 0c 00 00 	lea    0xc38(%rip),%rdx        # 286b <malloc+0x15f>
+    1c33:	48 89 d6             	mov    %rdx,%rsi
+    1c36:	89 c7                	mov    %eax,%edi
+    1c38:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c3d:	e8 cf 02 00 00       	call   1f11 <printf>
+    1c42:	90                   	nop
+    1c43:	eb fd                	jmp    1c42 <exectest+0x5e1>
+      byte_to_read -= ret;
+    1c45:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1c48:	29 45 fc             	sub    %eax,-0x4(%rbp)
+      count += ret;
+    1c4b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1c4e:	01 45 f8             	add    %eax,-0x8(%rbp)
+    while (count < 12) {
+    1c51:	83 7d f8 0b          	cmpl   $0xb,-0x8(%rbp)
+    1c55:	0f 8e 5f ff ff ff    	jle    1bba <exectest+0x559>
+    }
+
+    buf[count] = 0;
+    1c5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1c5e:	48 98                	cltq
+    1c60:	c6 84 05 78 ff ff ff 	movb   $0x0,-0x88(%rbp,%rax,1)
+    1c67:	00 
+    if (strcmp(buf, expected) != 0) {
+    1c68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c6c:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+    1c73:	48 89 d6             	mov    %rdx,%rsi
+    1c76:	48 89 c7             	mov    %rax,%rdi
+    1c79:	e8 d4 05 00 00       	call   2252 <strcmp>
+    1c7e:	85 c0                	test   %eax,%eax
+    1c80:	0f 84 94 00 00 00    	je     1d1a <exectest+0x6b9>
+      printf(stdout, "exectest: bad output:\n");
+    1c86:	8b 05 74 17 00 00    	mov    0x1774(%rip),%eax        # 3400 <stdout>
+    1c8c:	48 8d 15 9f 13 00 00 	lea    0x139f(%rip),%rdx        # 3032 <malloc+0x926>
+    1c93:	48 89 d6             	mov    %rdx,%rsi
+    1c96:	89 c7                	mov    %eax,%edi
+    1c98:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c9d:	e8 6f 02 00 00       	call   1f11 <printf>
+      printf(stdout, buf);
+    1ca2:	8b 05 58 17 00 00    	mov    0x1758(%rip),%eax        # 3400 <stdout>
+    1ca8:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1caf:	48 89 d6             	mov    %rdx,%rsi
+    1cb2:	89 c7                	mov    %eax,%edi
+    1cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cb9:	e8 53 02 00 00       	call   1f11 <printf>
+      error("exectest: output test failed");
+    1cbe:	8b 05 3c 17 00 00    	mov    0x173c(%rip),%eax        # 3400 <stdout>
+    1cc4:	ba c6 01 00 00       	mov    $0x1c6,%edx
+    1cc9:	48 8d 0d 60 0b 00 00 	lea    0xb60(%rip),%rcx        # 2830 <malloc+0x124>
+    1cd0:	48 89 ce             	mov    %rcx,%rsi
+    1cd3:	89 c7                	mov    %eax,%edi
+    1cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cda:	e8 32 02 00 00       	call   1f11 <printf>
+    1cdf:	8b 05 1b 17 00 00    	mov    0x171b(%rip),%eax        # 3400 <stdout>
+    1ce5:	48 8d 15 5d 13 00 00 	lea    0x135d(%rip),%rdx        # 3049 <malloc+0x93d>
+    1cec:	48 89 d6             	mov    %rdx,%rsi
+    1cef:	89 c7                	mov    %eax,%edi
+    1cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cf6:	e8 16 02 00 00       	call   1f11 <printf>
+    1cfb:	8b 05 ff 16 00 00    	mov    0x16ff(%rip),%eax        # 3400 <stdout>
+    1d01:	48 8d 15 63 0b 00 00 	lea    0xb63(%rip),%rdx        # 286b <malloc+0x15f>
+    1d08:	48 89 d6             	mov    %rdx,%rsi
+    1d0b:	89 c7                	mov    %eax,%edi
+    1d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d12:	e8 fa 01 00 00       	call   1f11 <printf>
+    1d17:	90                   	nop
+    1d18:	eb fd                	jmp    1d17 <exectest+0x6b6>
+    }
+    printf(stdout, expected);
+    1d1a:	8b 05 e0 16 00 00    	mov    0x16e0(%rip),%eax        # 3400 <stdout>
+    1d20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d24:	48 89 d6             	mov    %rdx,%rsi
+    1d27:	89 c7                	mov    %eax,%edi
+    1d29:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d2e:	e8 de 01 00 00       	call   1f11 <printf>
+  }
+
+  printf(1, "exectest: ok\n");
+    1d33:	48 8d 05 2c 13 00 00 	lea    0x132c(%rip),%rax        # 3066 <malloc+0x95a>
+    1d3a:	48 89 c6             	mov    %rax,%rsi
+    1d3d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d42:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d47:	e8 c5 01 00 00       	call   1f11 <printf>
+}
+    1d4c:	90                   	nop
+    1d4d:	c9                   	leave
+    1d4e:	c3                   	ret
+
+0000000000001d4f <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    1d4f:	55                   	push   %rbp
+    1d50:	48 89 e5             	mov    %rsp,%rbp
+    1d53:	48 83 ec 10          	sub    $0x10,%rsp
+    1d57:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1d5a:	89 f0                	mov    %esi,%eax
+    1d5c:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1d5f:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1d63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d66:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d6b:	48 89 ce             	mov    %rcx,%rsi
+    1d6e:	89 c7                	mov    %eax,%edi
+    1d70:	e8 63 07 00 00       	call   24d8 <write>
+    1d75:	90                   	nop
+    1d76:	c9                   	leave
+    1d77:	c3                   	ret
+
+0000000000001d78 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1d78:	55                   	push   %rbp
+    1d79:	48 89 e5             	mov    %rsp,%rbp
+    1d7c:	48 83 ec 40          	sub    $0x40,%rsp
+    1d80:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1d83:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1d86:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1d89:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1d8c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1d90:	74 1f                	je     1db1 <printint64+0x39>
+    1d92:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1d95:	c1 e8 1f             	shr    $0x1f,%eax
+    1d98:	0f b6 c0             	movzbl %al,%eax
+    1d9b:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1d9e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1da2:	74 0d                	je     1db1 <printint64+0x39>
+    x = -xx;
+    1da4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1da7:	f7 d8                	neg    %eax
+    1da9:	48 98                	cltq
+    1dab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1daf:	eb 09                	jmp    1dba <printint64+0x42>
+  else
+    x = xx;
+    1db1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1db4:	48 98                	cltq
+    1db6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1dba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1dc1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1dc4:	48 63 c8             	movslq %eax,%rcx
+    1dc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+    1dd0:	48 f7 f1             	div    %rcx
+    1dd3:	48 89 d1             	mov    %rdx,%rcx
+    1dd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dd9:	8d 50 01             	lea    0x1(%rax),%edx
+    1ddc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ddf:	48 8d 15 2a 16 00 00 	lea    0x162a(%rip),%rdx        # 3410 <digits.1>
+    1de6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1dea:	48 98                	cltq
+    1dec:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1df0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1df3:	48 63 f0             	movslq %eax,%rsi
+    1df6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+    1dff:	48 f7 f6             	div    %rsi
+    1e02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e06:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1e0b:	75 b4                	jne    1dc1 <printint64+0x49>
+
+  if (sgn)
+    1e0d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1e11:	74 2b                	je     1e3e <printint64+0xc6>
+    buf[i++] = '-';
+    1e13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e16:	8d 50 01             	lea    0x1(%rax),%edx
+    1e19:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1e1c:	48 98                	cltq
+    1e1e:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1e23:	eb 19                	jmp    1e3e <printint64+0xc6>
+    putc(fd, buf[i]);
+    1e25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e28:	48 98                	cltq
+    1e2a:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1e2f:	0f be d0             	movsbl %al,%edx
+    1e32:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1e35:	89 d6                	mov    %edx,%esi
+    1e37:	89 c7                	mov    %eax,%edi
+    1e39:	e8 11 ff ff ff       	call   1d4f <putc>
+  while (--i >= 0)
+    1e3e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1e42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1e46:	79 dd                	jns    1e25 <printint64+0xad>
+}
+    1e48:	90                   	nop
+    1e49:	90                   	nop
+    1e4a:	c9                   	leave
+    1e4b:	c3                   	ret
+
+0000000000001e4c <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1e4c:	55                   	push   %rbp
+    1e4d:	48 89 e5             	mov    %rsp,%rbp
+    1e50:	48 83 ec 30          	sub    $0x30,%rsp
+    1e54:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1e57:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1e5a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1e5d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1e60:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1e67:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1e6b:	74 17                	je     1e84 <printint+0x38>
+    1e6d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1e71:	79 11                	jns    1e84 <printint+0x38>
+    neg = 1;
+    1e73:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1e7a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e7d:	f7 d8                	neg    %eax
+    1e7f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1e82:	eb 06                	jmp    1e8a <printint+0x3e>
+  } else {
+    x = xx;
+    1e84:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e87:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1e8a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1e91:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1e94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1e97:	ba 00 00 00 00       	mov    $0x0,%edx
+    1e9c:	f7 f1                	div    %ecx
+    1e9e:	89 d1                	mov    %edx,%ecx
+    1ea0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ea3:	8d 50 01             	lea    0x1(%rax),%edx
+    1ea6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ea9:	89 c9                	mov    %ecx,%ecx
+    1eab:	48 8d 15 7e 15 00 00 	lea    0x157e(%rip),%rdx        # 3430 <digits.0>
+    1eb2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1eb6:	48 98                	cltq
+    1eb8:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1ebc:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1ebf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1ec2:	ba 00 00 00 00       	mov    $0x0,%edx
+    1ec7:	f7 f6                	div    %esi
+    1ec9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1ecc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1ed0:	75 bf                	jne    1e91 <printint+0x45>
+  if (neg)
+    1ed2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1ed6:	74 2b                	je     1f03 <printint+0xb7>
+    buf[i++] = '-';
+    1ed8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1edb:	8d 50 01             	lea    0x1(%rax),%edx
+    1ede:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ee1:	48 98                	cltq
+    1ee3:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1ee8:	eb 19                	jmp    1f03 <printint+0xb7>
+    putc(fd, buf[i]);
+    1eea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1eed:	48 98                	cltq
+    1eef:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1ef4:	0f be d0             	movsbl %al,%edx
+    1ef7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1efa:	89 d6                	mov    %edx,%esi
+    1efc:	89 c7                	mov    %eax,%edi
+    1efe:	e8 4c fe ff ff       	call   1d4f <putc>
+  while (--i >= 0)
+    1f03:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1f07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1f0b:	79 dd                	jns    1eea <printint+0x9e>
+}
+    1f0d:	90                   	nop
+    1f0e:	90                   	nop
+    1f0f:	c9                   	leave
+    1f10:	c3                   	ret
+
+0000000000001f11 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1f11:	55                   	push   %rbp
+    1f12:	48 89 e5             	mov    %rsp,%rbp
+    1f15:	48 83 ec 70          	sub    $0x70,%rsp
+    1f19:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1f1c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1f20:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1f24:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1f28:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1f2c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1f30:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1f37:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1f3b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1f3f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1f43:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1f47:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1f4e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1f55:	e9 6b 02 00 00       	jmp    21c5 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1f5a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1f5d:	48 63 d0             	movslq %eax,%rdx
+    1f60:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1f64:	48 01 d0             	add    %rdx,%rax
+    1f67:	0f b6 00             	movzbl (%rax),%eax
+    1f6a:	0f be c0             	movsbl %al,%eax
+    1f6d:	25 ff 00 00 00       	and    $0xff,%eax
+    1f72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1f75:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1f79:	75 30                	jne    1fab <printf+0x9a>
+      if (c == '%') {
+    1f7b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1f7f:	75 13                	jne    1f94 <printf+0x83>
+        state = '%';
+    1f81:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1f88:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1f8f:	e9 2d 02 00 00       	jmp    21c1 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1f97:	0f be d0             	movsbl %al,%edx
+    1f9a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1f9d:	89 d6                	mov    %edx,%esi
+    1f9f:	89 c7                	mov    %eax,%edi
+    1fa1:	e8 a9 fd ff ff       	call   1d4f <putc>
+    1fa6:	e9 16 02 00 00       	jmp    21c1 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1fab:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1faf:	0f 85 0c 02 00 00    	jne    21c1 <printf+0x2b0>
+      if (c == 'l') {
+    1fb5:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1fb9:	75 0c                	jne    1fc7 <printf+0xb6>
+        lflag = 1;
+    1fbb:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1fc2:	e9 fa 01 00 00       	jmp    21c1 <printf+0x2b0>
+      } else if (c == 'd') {
+    1fc7:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1fcb:	0f 85 95 00 00 00    	jne    2066 <printf+0x155>
+        if (lflag == 1)
+    1fd1:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1fd5:	75 49                	jne    2020 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1fd7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1fda:	83 f8 2f             	cmp    $0x2f,%eax
+    1fdd:	77 17                	ja     1ff6 <printf+0xe5>
+    1fdf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1fe3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fe6:	89 d2                	mov    %edx,%edx
+    1fe8:	48 01 d0             	add    %rdx,%rax
+    1feb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fee:	83 c2 08             	add    $0x8,%edx
+    1ff1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1ff4:	eb 0c                	jmp    2002 <printf+0xf1>
+    1ff6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ffa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ffe:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2002:	48 8b 00             	mov    (%rax),%rax
+    2005:	89 c6                	mov    %eax,%esi
+    2007:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    200a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    200f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2014:	89 c7                	mov    %eax,%edi
+    2016:	e8 5d fd ff ff       	call   1d78 <printint64>
+    201b:	e9 9a 01 00 00       	jmp    21ba <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    2020:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2023:	83 f8 2f             	cmp    $0x2f,%eax
+    2026:	77 17                	ja     203f <printf+0x12e>
+    2028:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    202c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    202f:	89 d2                	mov    %edx,%edx
+    2031:	48 01 d0             	add    %rdx,%rax
+    2034:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2037:	83 c2 08             	add    $0x8,%edx
+    203a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    203d:	eb 0c                	jmp    204b <printf+0x13a>
+    203f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2043:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2047:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    204b:	8b 30                	mov    (%rax),%esi
+    204d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2050:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2055:	ba 0a 00 00 00       	mov    $0xa,%edx
+    205a:	89 c7                	mov    %eax,%edi
+    205c:	e8 eb fd ff ff       	call   1e4c <printint>
+    2061:	e9 54 01 00 00       	jmp    21ba <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    2066:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    206a:	74 0a                	je     2076 <printf+0x165>
+    206c:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    2070:	0f 85 95 00 00 00    	jne    210b <printf+0x1fa>
+        if (lflag == 1)
+    2076:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    207a:	75 49                	jne    20c5 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    207c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    207f:	83 f8 2f             	cmp    $0x2f,%eax
+    2082:	77 17                	ja     209b <printf+0x18a>
+    2084:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2088:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    208b:	89 d2                	mov    %edx,%edx
+    208d:	48 01 d0             	add    %rdx,%rax
+    2090:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2093:	83 c2 08             	add    $0x8,%edx
+    2096:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2099:	eb 0c                	jmp    20a7 <printf+0x196>
+    209b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    209f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20a3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20a7:	48 8b 00             	mov    (%rax),%rax
+    20aa:	89 c6                	mov    %eax,%esi
+    20ac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    20af:	b9 00 00 00 00       	mov    $0x0,%ecx
+    20b4:	ba 10 00 00 00       	mov    $0x10,%edx
+    20b9:	89 c7                	mov    %eax,%edi
+    20bb:	e8 b8 fc ff ff       	call   1d78 <printint64>
+        if (lflag == 1)
+    20c0:	e9 f5 00 00 00       	jmp    21ba <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    20c5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    20c8:	83 f8 2f             	cmp    $0x2f,%eax
+    20cb:	77 17                	ja     20e4 <printf+0x1d3>
+    20cd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    20d1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20d4:	89 d2                	mov    %edx,%edx
+    20d6:	48 01 d0             	add    %rdx,%rax
+    20d9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20dc:	83 c2 08             	add    $0x8,%edx
+    20df:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    20e2:	eb 0c                	jmp    20f0 <printf+0x1df>
+    20e4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    20e8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20ec:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20f0:	8b 30                	mov    (%rax),%esi
+    20f2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    20f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    20fa:	ba 10 00 00 00       	mov    $0x10,%edx
+    20ff:	89 c7                	mov    %eax,%edi
+    2101:	e8 46 fd ff ff       	call   1e4c <printint>
+        if (lflag == 1)
+    2106:	e9 af 00 00 00       	jmp    21ba <printf+0x2a9>
+      } else if (c == 's') {
+    210b:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    210f:	75 6e                	jne    217f <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    2111:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2114:	83 f8 2f             	cmp    $0x2f,%eax
+    2117:	77 17                	ja     2130 <printf+0x21f>
+    2119:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    211d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2120:	89 d2                	mov    %edx,%edx
+    2122:	48 01 d0             	add    %rdx,%rax
+    2125:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2128:	83 c2 08             	add    $0x8,%edx
+    212b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    212e:	eb 0c                	jmp    213c <printf+0x22b>
+    2130:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2134:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2138:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    213c:	48 8b 00             	mov    (%rax),%rax
+    213f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    2143:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2148:	75 28                	jne    2172 <printf+0x261>
+          s = "(null)";
+    214a:	48 8d 05 23 0f 00 00 	lea    0xf23(%rip),%rax        # 3074 <malloc+0x968>
+    2151:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    2155:	eb 1b                	jmp    2172 <printf+0x261>
+          putc(fd, *s);
+    2157:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    215b:	0f b6 00             	movzbl (%rax),%eax
+    215e:	0f be d0             	movsbl %al,%edx
+    2161:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2164:	89 d6                	mov    %edx,%esi
+    2166:	89 c7                	mov    %eax,%edi
+    2168:	e8 e2 fb ff ff       	call   1d4f <putc>
+        for (; *s; s++)
+    216d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    2172:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2176:	0f b6 00             	movzbl (%rax),%eax
+    2179:	84 c0                	test   %al,%al
+    217b:	75 da                	jne    2157 <printf+0x246>
+    217d:	eb 3b                	jmp    21ba <printf+0x2a9>
+      } else if (c == '%') {
+    217f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    2183:	75 14                	jne    2199 <printf+0x288>
+        putc(fd, c);
+    2185:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2188:	0f be d0             	movsbl %al,%edx
+    218b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    218e:	89 d6                	mov    %edx,%esi
+    2190:	89 c7                	mov    %eax,%edi
+    2192:	e8 b8 fb ff ff       	call   1d4f <putc>
+    2197:	eb 21                	jmp    21ba <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2199:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    219c:	be 25 00 00 00       	mov    $0x25,%esi
+    21a1:	89 c7                	mov    %eax,%edi
+    21a3:	e8 a7 fb ff ff       	call   1d4f <putc>
+        putc(fd, c);
+    21a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    21ab:	0f be d0             	movsbl %al,%edx
+    21ae:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    21b1:	89 d6                	mov    %edx,%esi
+    21b3:	89 c7                	mov    %eax,%edi
+    21b5:	e8 95 fb ff ff       	call   1d4f <putc>
+      }
+      state = 0;
+    21ba:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    21c1:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    21c5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    21c8:	48 63 d0             	movslq %eax,%rdx
+    21cb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    21cf:	48 01 d0             	add    %rdx,%rax
+    21d2:	0f b6 00             	movzbl (%rax),%eax
+    21d5:	84 c0                	test   %al,%al
+    21d7:	0f 85 7d fd ff ff    	jne    1f5a <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    21dd:	90                   	nop
+    21de:	90                   	nop
+    21df:	c9                   	leave
+    21e0:	c3                   	ret
+
+00000000000021e1 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+    21e1:	55                   	push   %rbp
+    21e2:	48 89 e5             	mov    %rsp,%rbp
+    21e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21e9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    21ec:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+    21ef:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    21f3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    21f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    21f9:	48 89 ce             	mov    %rcx,%rsi
+    21fc:	48 89 f7             	mov    %rsi,%rdi
+    21ff:	89 d1                	mov    %edx,%ecx
+    2201:	fc                   	cld
+    2202:	f3 aa                	rep stos %al,%es:(%rdi)
+    2204:	89 ca                	mov    %ecx,%edx
+    2206:	48 89 fe             	mov    %rdi,%rsi
+    2209:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    220d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+    2210:	90                   	nop
+    2211:	5d                   	pop    %rbp
+    2212:	c3                   	ret
+
+0000000000002213 <strcpy>:
+char *strcpy(char *s, char *t) {
+    2213:	55                   	push   %rbp
+    2214:	48 89 e5             	mov    %rsp,%rbp
+    2217:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    221b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    221f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2223:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2227:	90                   	nop
+    2228:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    222c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2230:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2234:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2238:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    223c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2240:	0f b6 12             	movzbl (%rdx),%edx
+    2243:	88 10                	mov    %dl,(%rax)
+    2245:	0f b6 00             	movzbl (%rax),%eax
+    2248:	84 c0                	test   %al,%al
+    224a:	75 dc                	jne    2228 <strcpy+0x15>
+  return os;
+    224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2250:	5d                   	pop    %rbp
+    2251:	c3                   	ret
+
+0000000000002252 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2252:	55                   	push   %rbp
+    2253:	48 89 e5             	mov    %rsp,%rbp
+    2256:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    225a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    225e:	eb 0a                	jmp    226a <strcmp+0x18>
+    p++, q++;
+    2260:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2265:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    226a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    226e:	0f b6 00             	movzbl (%rax),%eax
+    2271:	84 c0                	test   %al,%al
+    2273:	74 12                	je     2287 <strcmp+0x35>
+    2275:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2279:	0f b6 10             	movzbl (%rax),%edx
+    227c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2280:	0f b6 00             	movzbl (%rax),%eax
+    2283:	38 c2                	cmp    %al,%dl
+    2285:	74 d9                	je     2260 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2287:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    228b:	0f b6 00             	movzbl (%rax),%eax
+    228e:	0f b6 d0             	movzbl %al,%edx
+    2291:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2295:	0f b6 00             	movzbl (%rax),%eax
+    2298:	0f b6 c0             	movzbl %al,%eax
+    229b:	29 c2                	sub    %eax,%edx
+    229d:	89 d0                	mov    %edx,%eax
+}
+    229f:	5d                   	pop    %rbp
+    22a0:	c3                   	ret
+
+00000000000022a1 <strlen>:
+uint strlen(char *s) {
+    22a1:	55                   	push   %rbp
+    22a2:	48 89 e5             	mov    %rsp,%rbp
+    22a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    22a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    22b0:	eb 04                	jmp    22b6 <strlen+0x15>
+    22b2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    22b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22b9:	48 63 d0             	movslq %eax,%rdx
+    22bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22c0:	48 01 d0             	add    %rdx,%rax
+    22c3:	0f b6 00             	movzbl (%rax),%eax
+    22c6:	84 c0                	test   %al,%al
+    22c8:	75 e8                	jne    22b2 <strlen+0x11>
+  return n;
+    22ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    22cd:	5d                   	pop    %rbp
+    22ce:	c3                   	ret
+
+00000000000022cf <memset>:
+void *memset(void *dst, int c, uint n) {
+    22cf:	55                   	push   %rbp
+    22d0:	48 89 e5             	mov    %rsp,%rbp
+    22d3:	48 83 ec 10          	sub    $0x10,%rsp
+    22d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22db:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    22de:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    22e1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    22e4:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    22e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22eb:	89 ce                	mov    %ecx,%esi
+    22ed:	48 89 c7             	mov    %rax,%rdi
+    22f0:	e8 ec fe ff ff       	call   21e1 <stosb>
+  return dst;
+    22f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    22f9:	c9                   	leave
+    22fa:	c3                   	ret
+
+00000000000022fb <strchr>:
+char *strchr(const char *s, char c) {
+    22fb:	55                   	push   %rbp
+    22fc:	48 89 e5             	mov    %rsp,%rbp
+    22ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2303:	89 f0                	mov    %esi,%eax
+    2305:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    2308:	eb 17                	jmp    2321 <strchr+0x26>
+    if (*s == c)
+    230a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230e:	0f b6 00             	movzbl (%rax),%eax
+    2311:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    2314:	75 06                	jne    231c <strchr+0x21>
+      return (char *)s;
+    2316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    231a:	eb 15                	jmp    2331 <strchr+0x36>
+  for (; *s; s++)
+    231c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2325:	0f b6 00             	movzbl (%rax),%eax
+    2328:	84 c0                	test   %al,%al
+    232a:	75 de                	jne    230a <strchr+0xf>
+  return 0;
+    232c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2331:	5d                   	pop    %rbp
+    2332:	c3                   	ret
+
+0000000000002333 <gets>:
+char *gets(char *buf, int max) {
+    2333:	55                   	push   %rbp
+    2334:	48 89 e5             	mov    %rsp,%rbp
+    2337:	48 83 ec 20          	sub    $0x20,%rsp
+    233b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    233f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    2342:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2349:	eb 48                	jmp    2393 <gets+0x60>
+    cc = read(0, &c, 1);
+    234b:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    234f:	ba 01 00 00 00       	mov    $0x1,%edx
+    2354:	48 89 c6             	mov    %rax,%rsi
+    2357:	bf 00 00 00 00       	mov    $0x0,%edi
+    235c:	e8 6f 01 00 00       	call   24d0 <read>
+    2361:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2364:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2368:	7e 36                	jle    23a0 <gets+0x6d>
+    buf[i++] = c;
+    236a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    236d:	8d 50 01             	lea    0x1(%rax),%edx
+    2370:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2373:	48 63 d0             	movslq %eax,%rdx
+    2376:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    237a:	48 01 c2             	add    %rax,%rdx
+    237d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2381:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2383:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2387:	3c 0a                	cmp    $0xa,%al
+    2389:	74 16                	je     23a1 <gets+0x6e>
+    238b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    238f:	3c 0d                	cmp    $0xd,%al
+    2391:	74 0e                	je     23a1 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2393:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2396:	83 c0 01             	add    $0x1,%eax
+    2399:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    239c:	7f ad                	jg     234b <gets+0x18>
+    239e:	eb 01                	jmp    23a1 <gets+0x6e>
+      break;
+    23a0:	90                   	nop
+  }
+  buf[i] = '\0';
+    23a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23a4:	48 63 d0             	movslq %eax,%rdx
+    23a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23ab:	48 01 d0             	add    %rdx,%rax
+    23ae:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    23b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    23b5:	c9                   	leave
+    23b6:	c3                   	ret
+
+00000000000023b7 <stat>:
+
+int stat(char *n, struct stat *st) {
+    23b7:	55                   	push   %rbp
+    23b8:	48 89 e5             	mov    %rsp,%rbp
+    23bb:	48 83 ec 20          	sub    $0x20,%rsp
+    23bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    23c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    23c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23cb:	be 00 00 00 00       	mov    $0x0,%esi
+    23d0:	48 89 c7             	mov    %rax,%rdi
+    23d3:	e8 20 01 00 00       	call   24f8 <open>
+    23d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    23db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    23df:	79 07                	jns    23e8 <stat+0x31>
+    return -1;
+    23e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    23e6:	eb 21                	jmp    2409 <stat+0x52>
+  r = fstat(fd, st);
+    23e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    23ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23ef:	48 89 d6             	mov    %rdx,%rsi
+    23f2:	89 c7                	mov    %eax,%edi
+    23f4:	e8 17 01 00 00       	call   2510 <fstat>
+    23f9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    23fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23ff:	89 c7                	mov    %eax,%edi
+    2401:	e8 da 00 00 00       	call   24e0 <close>
+  return r;
+    2406:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    2409:	c9                   	leave
+    240a:	c3                   	ret
+
+000000000000240b <atoi>:
+
+int atoi(const char *s) {
+    240b:	55                   	push   %rbp
+    240c:	48 89 e5             	mov    %rsp,%rbp
+    240f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    2413:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    241a:	eb 28                	jmp    2444 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    241c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    241f:	89 d0                	mov    %edx,%eax
+    2421:	c1 e0 02             	shl    $0x2,%eax
+    2424:	01 d0                	add    %edx,%eax
+    2426:	01 c0                	add    %eax,%eax
+    2428:	89 c1                	mov    %eax,%ecx
+    242a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    242e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    2432:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2436:	0f b6 00             	movzbl (%rax),%eax
+    2439:	0f be c0             	movsbl %al,%eax
+    243c:	01 c8                	add    %ecx,%eax
+    243e:	83 e8 30             	sub    $0x30,%eax
+    2441:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2444:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2448:	0f b6 00             	movzbl (%rax),%eax
+    244b:	3c 2f                	cmp    $0x2f,%al
+    244d:	7e 0b                	jle    245a <atoi+0x4f>
+    244f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2453:	0f b6 00             	movzbl (%rax),%eax
+    2456:	3c 39                	cmp    $0x39,%al
+    2458:	7e c2                	jle    241c <atoi+0x11>
+  return n;
+    245a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    245d:	5d                   	pop    %rbp
+    245e:	c3                   	ret
+
+000000000000245f <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    245f:	55                   	push   %rbp
+    2460:	48 89 e5             	mov    %rsp,%rbp
+    2463:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2467:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    246b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    246e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2472:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    2476:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    247a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    247e:	eb 1d                	jmp    249d <memmove+0x3e>
+    *dst++ = *src++;
+    2480:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2484:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2488:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    248c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2490:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2494:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    2498:	0f b6 12             	movzbl (%rdx),%edx
+    249b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    249d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    24a0:	8d 50 ff             	lea    -0x1(%rax),%edx
+    24a3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    24a6:	85 c0                	test   %eax,%eax
+    24a8:	7f d6                	jg     2480 <memmove+0x21>
+  return vdst;
+    24aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24ae:	5d                   	pop    %rbp
+    24af:	c3                   	ret
+
+00000000000024b0 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    24b0:	b8 01 00 00 00       	mov    $0x1,%eax
+    24b5:	cd 40                	int    $0x40
+    24b7:	c3                   	ret
+
+00000000000024b8 <exit>:
+SYSCALL(exit)
+    24b8:	b8 02 00 00 00       	mov    $0x2,%eax
+    24bd:	cd 40                	int    $0x40
+    24bf:	c3                   	ret
+
+00000000000024c0 <wait>:
+SYSCALL(wait)
+    24c0:	b8 03 00 00 00       	mov    $0x3,%eax
+    24c5:	cd 40                	int    $0x40
+    24c7:	c3                   	ret
+
+00000000000024c8 <pipe>:
+SYSCALL(pipe)
+    24c8:	b8 04 00 00 00       	mov    $0x4,%eax
+    24cd:	cd 40                	int    $0x40
+    24cf:	c3                   	ret
+
+00000000000024d0 <read>:
+SYSCALL(read)
+    24d0:	b8 05 00 00 00       	mov    $0x5,%eax
+    24d5:	cd 40                	int    $0x40
+    24d7:	c3                   	ret
+
+00000000000024d8 <write>:
+SYSCALL(write)
+    24d8:	b8 10 00 00 00       	mov    $0x10,%eax
+    24dd:	cd 40                	int    $0x40
+    24df:	c3                   	ret
+
+00000000000024e0 <close>:
+SYSCALL(close)
+    24e0:	b8 15 00 00 00       	mov    $0x15,%eax
+    24e5:	cd 40                	int    $0x40
+    24e7:	c3                   	ret
+
+00000000000024e8 <kill>:
+SYSCALL(kill)
+    24e8:	b8 06 00 00 00       	mov    $0x6,%eax
+    24ed:	cd 40                	int    $0x40
+    24ef:	c3                   	ret
+
+00000000000024f0 <exec>:
+SYSCALL(exec)
+    24f0:	b8 07 00 00 00       	mov    $0x7,%eax
+    24f5:	cd 40                	int    $0x40
+    24f7:	c3                   	ret
+
+00000000000024f8 <open>:
+SYSCALL(open)
+    24f8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    24fd:	cd 40                	int    $0x40
+    24ff:	c3                   	ret
+
+0000000000002500 <mknod>:
+SYSCALL(mknod)
+    2500:	b8 11 00 00 00       	mov    $0x11,%eax
+    2505:	cd 40                	int    $0x40
+    2507:	c3                   	ret
+
+0000000000002508 <unlink>:
+SYSCALL(unlink)
+    2508:	b8 12 00 00 00       	mov    $0x12,%eax
+    250d:	cd 40                	int    $0x40
+    250f:	c3                   	ret
+
+0000000000002510 <fstat>:
+SYSCALL(fstat)
+    2510:	b8 08 00 00 00       	mov    $0x8,%eax
+    2515:	cd 40                	int    $0x40
+    2517:	c3                   	ret
+
+0000000000002518 <link>:
+SYSCALL(link)
+    2518:	b8 13 00 00 00       	mov    $0x13,%eax
+    251d:	cd 40                	int    $0x40
+    251f:	c3                   	ret
+
+0000000000002520 <mkdir>:
+SYSCALL(mkdir)
+    2520:	b8 14 00 00 00       	mov    $0x14,%eax
+    2525:	cd 40                	int    $0x40
+    2527:	c3                   	ret
+
+0000000000002528 <chdir>:
+SYSCALL(chdir)
+    2528:	b8 09 00 00 00       	mov    $0x9,%eax
+    252d:	cd 40                	int    $0x40
+    252f:	c3                   	ret
+
+0000000000002530 <dup>:
+SYSCALL(dup)
+    2530:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2535:	cd 40                	int    $0x40
+    2537:	c3                   	ret
+
+0000000000002538 <getpid>:
+SYSCALL(getpid)
+    2538:	b8 0b 00 00 00       	mov    $0xb,%eax
+    253d:	cd 40                	int    $0x40
+    253f:	c3                   	ret
+
+0000000000002540 <sbrk>:
+SYSCALL(sbrk)
+    2540:	b8 0c 00 00 00       	mov    $0xc,%eax
+    2545:	cd 40                	int    $0x40
+    2547:	c3                   	ret
+
+0000000000002548 <sleep>:
+SYSCALL(sleep)
+    2548:	b8 0d 00 00 00       	mov    $0xd,%eax
+    254d:	cd 40                	int    $0x40
+    254f:	c3                   	ret
+
+0000000000002550 <uptime>:
+SYSCALL(uptime)
+    2550:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2555:	cd 40                	int    $0x40
+    2557:	c3                   	ret
+
+0000000000002558 <sysinfo>:
+SYSCALL(sysinfo)
+    2558:	b8 16 00 00 00       	mov    $0x16,%eax
+    255d:	cd 40                	int    $0x40
+    255f:	c3                   	ret
+
+0000000000002560 <crashn>:
+SYSCALL(crashn)
+    2560:	b8 17 00 00 00       	mov    $0x17,%eax
+    2565:	cd 40                	int    $0x40
+    2567:	c3                   	ret
+
+0000000000002568 <mmap>:
+SYSCALL(mmap)
+    2568:	b8 18 00 00 00       	mov    $0x18,%eax
+    256d:	cd 40                	int    $0x40
+    256f:	c3                   	ret
+
+0000000000002570 <munmap>:
+SYSCALL(munmap)
+    2570:	b8 19 00 00 00       	mov    $0x19,%eax
+    2575:	cd 40                	int    $0x40
+    2577:	c3                   	ret
+
+0000000000002578 <preface>:
+.globl preface
+preface:
+    call main
+    2578:	e8 83 da ff ff       	call   0 <main>
+    mov %rax, %rdi
+    257d:	48 89 c7             	mov    %rax,%rdi
+    call exit
+    2580:	e8 33 ff ff ff       	call   24b8 <exit>
+
+0000000000002585 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    2585:	55                   	push   %rbp
+    2586:	48 89 e5             	mov    %rsp,%rbp
+    2589:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    258d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2591:	48 83 e8 10          	sub    $0x10,%rax
+    2595:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2599:	48 8b 05 c0 0e 00 00 	mov    0xec0(%rip),%rax        # 3460 <freep>
+    25a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25a4:	eb 2f                	jmp    25d5 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    25a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25aa:	48 8b 00             	mov    (%rax),%rax
+    25ad:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    25b1:	72 17                	jb     25ca <free+0x45>
+    25b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25b7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    25bb:	72 2f                	jb     25ec <free+0x67>
+    25bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25c1:	48 8b 00             	mov    (%rax),%rax
+    25c4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    25c8:	72 22                	jb     25ec <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    25ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25ce:	48 8b 00             	mov    (%rax),%rax
+    25d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25d9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    25dd:	73 c7                	jae    25a6 <free+0x21>
+    25df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25e3:	48 8b 00             	mov    (%rax),%rax
+    25e6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    25ea:	73 ba                	jae    25a6 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    25ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25f0:	8b 40 08             	mov    0x8(%rax),%eax
+    25f3:	89 c0                	mov    %eax,%eax
+    25f5:	48 c1 e0 04          	shl    $0x4,%rax
+    25f9:	48 89 c2             	mov    %rax,%rdx
+    25fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2600:	48 01 c2             	add    %rax,%rdx
+    2603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2607:	48 8b 00             	mov    (%rax),%rax
+    260a:	48 39 c2             	cmp    %rax,%rdx
+    260d:	75 2d                	jne    263c <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    260f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2613:	8b 50 08             	mov    0x8(%rax),%edx
+    2616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    261a:	48 8b 00             	mov    (%rax),%rax
+    261d:	8b 40 08             	mov    0x8(%rax),%eax
+    2620:	01 c2                	add    %eax,%edx
+    2622:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2626:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2629:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    262d:	48 8b 00             	mov    (%rax),%rax
+    2630:	48 8b 10             	mov    (%rax),%rdx
+    2633:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2637:	48 89 10             	mov    %rdx,(%rax)
+    263a:	eb 0e                	jmp    264a <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    263c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2640:	48 8b 10             	mov    (%rax),%rdx
+    2643:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2647:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    264a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    264e:	8b 40 08             	mov    0x8(%rax),%eax
+    2651:	89 c0                	mov    %eax,%eax
+    2653:	48 c1 e0 04          	shl    $0x4,%rax
+    2657:	48 89 c2             	mov    %rax,%rdx
+    265a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    265e:	48 01 d0             	add    %rdx,%rax
+    2661:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2665:	75 27                	jne    268e <free+0x109>
+    p->s.size += bp->s.size;
+    2667:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    266b:	8b 50 08             	mov    0x8(%rax),%edx
+    266e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2672:	8b 40 08             	mov    0x8(%rax),%eax
+    2675:	01 c2                	add    %eax,%edx
+    2677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    267b:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    267e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2682:	48 8b 10             	mov    (%rax),%rdx
+    2685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2689:	48 89 10             	mov    %rdx,(%rax)
+    268c:	eb 0b                	jmp    2699 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    268e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2692:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2696:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    2699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    269d:	48 89 05 bc 0d 00 00 	mov    %rax,0xdbc(%rip)        # 3460 <freep>
+}
+    26a4:	90                   	nop
+    26a5:	5d                   	pop    %rbp
+    26a6:	c3                   	ret
+
+00000000000026a7 <morecore>:
+
+static Header *morecore(uint nu) {
+    26a7:	55                   	push   %rbp
+    26a8:	48 89 e5             	mov    %rsp,%rbp
+    26ab:	48 83 ec 20          	sub    $0x20,%rsp
+    26af:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    26b2:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    26b9:	77 07                	ja     26c2 <morecore+0x1b>
+    nu = 4096;
+    26bb:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    26c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    26c5:	c1 e0 04             	shl    $0x4,%eax
+    26c8:	89 c7                	mov    %eax,%edi
+    26ca:	e8 71 fe ff ff       	call   2540 <sbrk>
+    26cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    26d3:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    26d8:	75 07                	jne    26e1 <morecore+0x3a>
+    return 0;
+    26da:	b8 00 00 00 00       	mov    $0x0,%eax
+    26df:	eb 29                	jmp    270a <morecore+0x63>
+  hp = (Header *)p;
+    26e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    26e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26ed:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    26f0:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    26f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26f7:	48 83 c0 10          	add    $0x10,%rax
+    26fb:	48 89 c7             	mov    %rax,%rdi
+    26fe:	e8 82 fe ff ff       	call   2585 <free>
+  return freep;
+    2703:	48 8b 05 56 0d 00 00 	mov    0xd56(%rip),%rax        # 3460 <freep>
+}
+    270a:	c9                   	leave
+    270b:	c3                   	ret
+
+000000000000270c <malloc>:
+
+void *malloc(uint nbytes) {
+    270c:	55                   	push   %rbp
+    270d:	48 89 e5             	mov    %rsp,%rbp
+    2710:	48 83 ec 30          	sub    $0x30,%rsp
+    2714:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    2717:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    271a:	48 83 c0 0f          	add    $0xf,%rax
+    271e:	48 c1 e8 04          	shr    $0x4,%rax
+    2722:	83 c0 01             	add    $0x1,%eax
+    2725:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    2728:	48 8b 05 31 0d 00 00 	mov    0xd31(%rip),%rax        # 3460 <freep>
+    272f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2733:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2738:	75 2e                	jne    2768 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    273a:	48 8d 05 0f 0d 00 00 	lea    0xd0f(%rip),%rax        # 3450 <base>
+    2741:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2745:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2749:	48 89 05 10 0d 00 00 	mov    %rax,0xd10(%rip)        # 3460 <freep>
+    2750:	48 8b 05 09 0d 00 00 	mov    0xd09(%rip),%rax        # 3460 <freep>
+    2757:	48 89 05 f2 0c 00 00 	mov    %rax,0xcf2(%rip)        # 3450 <base>
+    base.s.size = 0;
+    275e:	c7 05 f0 0c 00 00 00 	movl   $0x0,0xcf0(%rip)        # 3458 <base+0x8>
+    2765:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    276c:	48 8b 00             	mov    (%rax),%rax
+    276f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2777:	8b 40 08             	mov    0x8(%rax),%eax
+    277a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    277d:	72 5f                	jb     27de <malloc+0xd2>
+      if (p->s.size == nunits)
+    277f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2783:	8b 40 08             	mov    0x8(%rax),%eax
+    2786:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    2789:	75 10                	jne    279b <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    278b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    278f:	48 8b 10             	mov    (%rax),%rdx
+    2792:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2796:	48 89 10             	mov    %rdx,(%rax)
+    2799:	eb 2e                	jmp    27c9 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    279b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    279f:	8b 40 08             	mov    0x8(%rax),%eax
+    27a2:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    27a5:	89 c2                	mov    %eax,%edx
+    27a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27ab:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    27ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b2:	8b 40 08             	mov    0x8(%rax),%eax
+    27b5:	89 c0                	mov    %eax,%eax
+    27b7:	48 c1 e0 04          	shl    $0x4,%rax
+    27bb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    27bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27c3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    27c6:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    27c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27cd:	48 89 05 8c 0c 00 00 	mov    %rax,0xc8c(%rip)        # 3460 <freep>
+      return (void *)(p + 1);
+    27d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27d8:	48 83 c0 10          	add    $0x10,%rax
+    27dc:	eb 41                	jmp    281f <malloc+0x113>
+    }
+    if (p == freep)
+    27de:	48 8b 05 7b 0c 00 00 	mov    0xc7b(%rip),%rax        # 3460 <freep>
+    27e5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    27e9:	75 1c                	jne    2807 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    27eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    27ee:	89 c7                	mov    %eax,%edi
+    27f0:	e8 b2 fe ff ff       	call   26a7 <morecore>
+    27f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    27f9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    27fe:	75 07                	jne    2807 <malloc+0xfb>
+        return 0;
+    2800:	b8 00 00 00 00       	mov    $0x0,%eax
+    2805:	eb 18                	jmp    281f <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2807:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    280b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    280f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2813:	48 8b 00             	mov    (%rax),%rax
+    2816:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    281a:	e9 54 ff ff ff       	jmp    2773 <malloc+0x67>
+  }
+    281f:	c9                   	leave
+    2820:	c3                   	ret
@@ -0,0 +1,2878 @@
+
+out/user/_lab3test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void sbrklazytest(void);
+void growstacktest(void);
+void growstacktest_edgecase(void);
+void copyonwriteforktest(void);
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  memtest();
+       f:	e8 3a 00 00 00       	call   4e <memtest>
+  sbrktest();
+      14:	e8 91 01 00 00       	call   1aa <sbrktest>
+  sbrklazytest();
+      19:	e8 b3 08 00 00       	call   8d1 <sbrklazytest>
+  growstacktest();
+      1e:	e8 b2 0c 00 00       	call   cd5 <growstacktest>
+  growstacktest_edgecase();
+      23:	e8 da 0e 00 00       	call   f02 <growstacktest_edgecase>
+  copyonwriteforktest();
+      28:	e8 f5 10 00 00       	call   1122 <copyonwriteforktest>
+
+  printf(stdout, "lab3 tests passed!!\n");
+      2d:	8b 05 1d 2a 00 00    	mov    0x2a1d(%rip),%eax        # 2a50 <stdout>
+      33:	48 8d 15 56 1f 00 00 	lea    0x1f56(%rip),%rdx        # 1f90 <malloc+0x11b>
+      3a:	48 89 d6             	mov    %rdx,%rsi
+      3d:	89 c7                	mov    %eax,%edi
+      3f:	b8 00 00 00 00       	mov    $0x0,%eax
+      44:	e8 31 16 00 00       	call   167a <printf>
+
+  exit();
+      49:	e8 d3 1b 00 00       	call   1c21 <exit>
+
+000000000000004e <memtest>:
+  return 0;
+}
+
+void memtest() {
+      4e:	55                   	push   %rbp
+      4f:	48 89 e5             	mov    %rsp,%rbp
+      52:	48 83 ec 20          	sub    $0x20,%rsp
+  void *m1, *m2;
+  int pid;
+  int i;
+
+  printf(stdout, "memtest\n");
+      56:	8b 05 f4 29 00 00    	mov    0x29f4(%rip),%eax        # 2a50 <stdout>
+      5c:	48 8d 15 42 1f 00 00 	lea    0x1f42(%rip),%rdx        # 1fa5 <malloc+0x130>
+      63:	48 89 d6             	mov    %rdx,%rsi
+      66:	89 c7                	mov    %eax,%edi
+      68:	b8 00 00 00 00       	mov    $0x0,%eax
+      6d:	e8 08 16 00 00       	call   167a <printf>
+  if ((pid = fork()) == 0) {
+      72:	e8 a2 1b 00 00       	call   1c19 <fork>
+      77:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+      7e:	0f 85 02 01 00 00    	jne    186 <memtest+0x138>
+    m1 = 0;
+      84:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+      8b:	00 
+    for (i = 0; i < 10; i++) {
+      8c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      93:	eb 25                	jmp    ba <memtest+0x6c>
+      m2 = malloc(10001);
+      95:	bf 11 27 00 00       	mov    $0x2711,%edi
+      9a:	e8 d6 1d 00 00       	call   1e75 <malloc>
+      9f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      *(char **)m2 = m1;
+      a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+      ab:	48 89 10             	mov    %rdx,(%rax)
+      m1 = m2;
+      ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (i = 0; i < 10; i++) {
+      b6:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      ba:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+      be:	7e d5                	jle    95 <memtest+0x47>
+    }
+    while (m1) {
+      c0:	eb 1f                	jmp    e1 <memtest+0x93>
+      m2 = *(char **)m1;
+      c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      c6:	48 8b 00             	mov    (%rax),%rax
+      c9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      free(m1);
+      cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      d1:	48 89 c7             	mov    %rax,%rdi
+      d4:	e8 15 1c 00 00       	call   1cee <free>
+      m1 = m2;
+      d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    while (m1) {
+      e1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      e6:	75 da                	jne    c2 <memtest+0x74>
+    }
+    m1 = malloc(1024 * 20);
+      e8:	bf 00 50 00 00       	mov    $0x5000,%edi
+      ed:	e8 83 1d 00 00       	call   1e75 <malloc>
+      f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (m1 == 0) {
+      f6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      fb:	75 5c                	jne    159 <memtest+0x10b>
+      error("couldn't allocate mem?!!\n");
+      fd:	8b 05 4d 29 00 00    	mov    0x294d(%rip),%eax        # 2a50 <stdout>
+     103:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     108:	48 8d 0d 9f 1e 00 00 	lea    0x1e9f(%rip),%rcx        # 1fae <malloc+0x139>
+     10f:	48 89 ce             	mov    %rcx,%rsi
+     112:	89 c7                	mov    %eax,%edi
+     114:	b8 00 00 00 00       	mov    $0x0,%eax
+     119:	e8 5c 15 00 00       	call   167a <printf>
+     11e:	8b 05 2c 29 00 00    	mov    0x292c(%rip),%eax        # 2a50 <stdout>
+     124:	48 8d 15 95 1e 00 00 	lea    0x1e95(%rip),%rdx        # 1fc0 <malloc+0x14b>
+     12b:	48 89 d6             	mov    %rdx,%rsi
+     12e:	89 c7                	mov    %eax,%edi
+     130:	b8 00 00 00 00       	mov    $0x0,%eax
+     135:	e8 40 15 00 00       	call   167a <printf>
+     13a:	8b 05 10 29 00 00    	mov    0x2910(%rip),%eax        # 2a50 <stdout>
+     140:	48 8d 15 93 1e 00 00 	lea    0x1e93(%rip),%rdx        # 1fda <malloc+0x165>
+     147:	48 89 d6             	mov    %rdx,%rsi
+     14a:	89 c7                	mov    %eax,%edi
+     14c:	b8 00 00 00 00       	mov    $0x0,%eax
+     151:	e8 24 15 00 00       	call   167a <printf>
+     156:	90                   	nop
+     157:	eb fd                	jmp    156 <memtest+0x108>
+    }
+    free(m1);
+     159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     15d:	48 89 c7             	mov    %rax,%rdi
+     160:	e8 89 1b 00 00       	call   1cee <free>
+    printf(stdout, "mem ok\n");
+     165:	8b 05 e5 28 00 00    	mov    0x28e5(%rip),%eax        # 2a50 <stdout>
+     16b:	48 8d 15 6a 1e 00 00 	lea    0x1e6a(%rip),%rdx        # 1fdc <malloc+0x167>
+     172:	48 89 d6             	mov    %rdx,%rsi
+     175:	89 c7                	mov    %eax,%edi
+     177:	b8 00 00 00 00       	mov    $0x0,%eax
+     17c:	e8 f9 14 00 00       	call   167a <printf>
+    exit();
+     181:	e8 9b 1a 00 00       	call   1c21 <exit>
+  } else {
+    wait();
+     186:	e8 9e 1a 00 00       	call   1c29 <wait>
+  }
+  printf(stdout, "memtest passed\n");
+     18b:	8b 05 bf 28 00 00    	mov    0x28bf(%rip),%eax        # 2a50 <stdout>
+     191:	48 8d 15 4c 1e 00 00 	lea    0x1e4c(%rip),%rdx        # 1fe4 <malloc+0x16f>
+     198:	48 89 d6             	mov    %rdx,%rsi
+     19b:	89 c7                	mov    %eax,%edi
+     19d:	b8 00 00 00 00       	mov    $0x0,%eax
+     1a2:	e8 d3 14 00 00       	call   167a <printf>
+}
+     1a7:	90                   	nop
+     1a8:	c9                   	leave
+     1a9:	c3                   	ret
+
+00000000000001aa <sbrktest>:
+
+void sbrktest(void) {
+     1aa:	55                   	push   %rbp
+     1ab:	48 89 e5             	mov    %rsp,%rbp
+     1ae:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  int pid, free_pages;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p;
+  uint64_t amt;
+  struct sys_info info;
+
+  printf(stdout, "sbrktest\n");
+     1b5:	8b 05 95 28 00 00    	mov    0x2895(%rip),%eax        # 2a50 <stdout>
+     1bb:	48 8d 15 32 1e 00 00 	lea    0x1e32(%rip),%rdx        # 1ff4 <malloc+0x17f>
+     1c2:	48 89 d6             	mov    %rdx,%rsi
+     1c5:	89 c7                	mov    %eax,%edi
+     1c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     1cc:	e8 a9 14 00 00       	call   167a <printf>
+  oldbrk = sbrk(0);
+     1d1:	bf 00 00 00 00       	mov    $0x0,%edi
+     1d6:	e8 ce 1a 00 00       	call   1ca9 <sbrk>
+     1db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+     1df:	bf 00 00 00 00       	mov    $0x0,%edi
+     1e4:	e8 c0 1a 00 00       	call   1ca9 <sbrk>
+     1e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  int i;
+  for (i = 0; i < 5000; i++) {
+     1ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     1f4:	e9 96 00 00 00       	jmp    28f <sbrktest+0xe5>
+    b = sbrk(1);
+     1f9:	bf 01 00 00 00       	mov    $0x1,%edi
+     1fe:	e8 a6 1a 00 00       	call   1ca9 <sbrk>
+     203:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    if (b != a) {
+     207:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     20b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     20f:	74 67                	je     278 <sbrktest+0xce>
+      error("sbrk test failed %d %x %x\n", i, a, b);
+     211:	8b 05 39 28 00 00    	mov    0x2839(%rip),%eax        # 2a50 <stdout>
+     217:	ba 59 00 00 00       	mov    $0x59,%edx
+     21c:	48 8d 0d 8b 1d 00 00 	lea    0x1d8b(%rip),%rcx        # 1fae <malloc+0x139>
+     223:	48 89 ce             	mov    %rcx,%rsi
+     226:	89 c7                	mov    %eax,%edi
+     228:	b8 00 00 00 00       	mov    $0x0,%eax
+     22d:	e8 48 14 00 00       	call   167a <printf>
+     232:	8b 05 18 28 00 00    	mov    0x2818(%rip),%eax        # 2a50 <stdout>
+     238:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+     23c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     240:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     243:	49 89 f0             	mov    %rsi,%r8
+     246:	48 8d 35 b1 1d 00 00 	lea    0x1db1(%rip),%rsi        # 1ffe <malloc+0x189>
+     24d:	89 c7                	mov    %eax,%edi
+     24f:	b8 00 00 00 00       	mov    $0x0,%eax
+     254:	e8 21 14 00 00       	call   167a <printf>
+     259:	8b 05 f1 27 00 00    	mov    0x27f1(%rip),%eax        # 2a50 <stdout>
+     25f:	48 8d 15 74 1d 00 00 	lea    0x1d74(%rip),%rdx        # 1fda <malloc+0x165>
+     266:	48 89 d6             	mov    %rdx,%rsi
+     269:	89 c7                	mov    %eax,%edi
+     26b:	b8 00 00 00 00       	mov    $0x0,%eax
+     270:	e8 05 14 00 00       	call   167a <printf>
+     275:	90                   	nop
+     276:	eb fd                	jmp    275 <sbrktest+0xcb>
+    }
+    *b = 1;
+     278:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     27c:	c6 00 01             	movb   $0x1,(%rax)
+    a = b + 1;
+     27f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     283:	48 83 c0 01          	add    $0x1,%rax
+     287:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for (i = 0; i < 5000; i++) {
+     28b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     28f:	81 7d f4 87 13 00 00 	cmpl   $0x1387,-0xc(%rbp)
+     296:	0f 8e 5d ff ff ff    	jle    1f9 <sbrktest+0x4f>
+  }
+  pid = fork();
+     29c:	e8 78 19 00 00       	call   1c19 <fork>
+     2a1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid < 0) {
+     2a4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     2a8:	79 5c                	jns    306 <sbrktest+0x15c>
+    error("sbrk test fork failed\n");
+     2aa:	8b 05 a0 27 00 00    	mov    0x27a0(%rip),%eax        # 2a50 <stdout>
+     2b0:	ba 60 00 00 00       	mov    $0x60,%edx
+     2b5:	48 8d 0d f2 1c 00 00 	lea    0x1cf2(%rip),%rcx        # 1fae <malloc+0x139>
+     2bc:	48 89 ce             	mov    %rcx,%rsi
+     2bf:	89 c7                	mov    %eax,%edi
+     2c1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c6:	e8 af 13 00 00       	call   167a <printf>
+     2cb:	8b 05 7f 27 00 00    	mov    0x277f(%rip),%eax        # 2a50 <stdout>
+     2d1:	48 8d 15 41 1d 00 00 	lea    0x1d41(%rip),%rdx        # 2019 <malloc+0x1a4>
+     2d8:	48 89 d6             	mov    %rdx,%rsi
+     2db:	89 c7                	mov    %eax,%edi
+     2dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e2:	e8 93 13 00 00       	call   167a <printf>
+     2e7:	8b 05 63 27 00 00    	mov    0x2763(%rip),%eax        # 2a50 <stdout>
+     2ed:	48 8d 15 e6 1c 00 00 	lea    0x1ce6(%rip),%rdx        # 1fda <malloc+0x165>
+     2f4:	48 89 d6             	mov    %rdx,%rsi
+     2f7:	89 c7                	mov    %eax,%edi
+     2f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     2fe:	e8 77 13 00 00       	call   167a <printf>
+     303:	90                   	nop
+     304:	eb fd                	jmp    303 <sbrktest+0x159>
+  }
+  c = sbrk(1);
+     306:	bf 01 00 00 00       	mov    $0x1,%edi
+     30b:	e8 99 19 00 00       	call   1ca9 <sbrk>
+     310:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  c = sbrk(1);
+     314:	bf 01 00 00 00       	mov    $0x1,%edi
+     319:	e8 8b 19 00 00       	call   1ca9 <sbrk>
+     31e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if (c != a + 1) {
+     322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     326:	48 83 c0 01          	add    $0x1,%rax
+     32a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     32e:	74 5c                	je     38c <sbrktest+0x1e2>
+    error("sbrk test failed post-fork\n");
+     330:	8b 05 1a 27 00 00    	mov    0x271a(%rip),%eax        # 2a50 <stdout>
+     336:	ba 65 00 00 00       	mov    $0x65,%edx
+     33b:	48 8d 0d 6c 1c 00 00 	lea    0x1c6c(%rip),%rcx        # 1fae <malloc+0x139>
+     342:	48 89 ce             	mov    %rcx,%rsi
+     345:	89 c7                	mov    %eax,%edi
+     347:	b8 00 00 00 00       	mov    $0x0,%eax
+     34c:	e8 29 13 00 00       	call   167a <printf>
+     351:	8b 05 f9 26 00 00    	mov    0x26f9(%rip),%eax        # 2a50 <stdout>
+     357:	48 8d 15 d2 1c 00 00 	lea    0x1cd2(%rip),%rdx        # 2030 <malloc+0x1bb>
+     35e:	48 89 d6             	mov    %rdx,%rsi
+     361:	89 c7                	mov    %eax,%edi
+     363:	b8 00 00 00 00       	mov    $0x0,%eax
+     368:	e8 0d 13 00 00       	call   167a <printf>
+     36d:	8b 05 dd 26 00 00    	mov    0x26dd(%rip),%eax        # 2a50 <stdout>
+     373:	48 8d 15 60 1c 00 00 	lea    0x1c60(%rip),%rdx        # 1fda <malloc+0x165>
+     37a:	48 89 d6             	mov    %rdx,%rsi
+     37d:	89 c7                	mov    %eax,%edi
+     37f:	b8 00 00 00 00       	mov    $0x0,%eax
+     384:	e8 f1 12 00 00       	call   167a <printf>
+     389:	90                   	nop
+     38a:	eb fd                	jmp    389 <sbrktest+0x1df>
+  }
+  if (pid == 0)
+     38c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     390:	75 05                	jne    397 <sbrktest+0x1ed>
+    exit();
+     392:	e8 8a 18 00 00       	call   1c21 <exit>
+  wait();
+     397:	e8 8d 18 00 00       	call   1c29 <wait>
+
+  // can one grow address space to something big?
+#define BIG (1 * 1024 * 1024)
+  a = sbrk(0);
+     39c:	bf 00 00 00 00       	mov    $0x0,%edi
+     3a1:	e8 03 19 00 00       	call   1ca9 <sbrk>
+     3a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  amt = (BIG) - (uint64_t)a;
+     3aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3ae:	ba 00 00 10 00       	mov    $0x100000,%edx
+     3b3:	48 29 c2             	sub    %rax,%rdx
+     3b6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  p = sbrk(amt);
+     3ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     3be:	89 c7                	mov    %eax,%edi
+     3c0:	e8 e4 18 00 00       	call   1ca9 <sbrk>
+     3c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (p != a) {
+     3c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     3cd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     3d1:	74 5c                	je     42f <sbrktest+0x285>
+    error("sbrk test failed to grow big address space; enough phys mem?\n");
+     3d3:	8b 05 77 26 00 00    	mov    0x2677(%rip),%eax        # 2a50 <stdout>
+     3d9:	ba 71 00 00 00       	mov    $0x71,%edx
+     3de:	48 8d 0d c9 1b 00 00 	lea    0x1bc9(%rip),%rcx        # 1fae <malloc+0x139>
+     3e5:	48 89 ce             	mov    %rcx,%rsi
+     3e8:	89 c7                	mov    %eax,%edi
+     3ea:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ef:	e8 86 12 00 00       	call   167a <printf>
+     3f4:	8b 05 56 26 00 00    	mov    0x2656(%rip),%eax        # 2a50 <stdout>
+     3fa:	48 8d 15 4f 1c 00 00 	lea    0x1c4f(%rip),%rdx        # 2050 <malloc+0x1db>
+     401:	48 89 d6             	mov    %rdx,%rsi
+     404:	89 c7                	mov    %eax,%edi
+     406:	b8 00 00 00 00       	mov    $0x0,%eax
+     40b:	e8 6a 12 00 00       	call   167a <printf>
+     410:	8b 05 3a 26 00 00    	mov    0x263a(%rip),%eax        # 2a50 <stdout>
+     416:	48 8d 15 bd 1b 00 00 	lea    0x1bbd(%rip),%rdx        # 1fda <malloc+0x165>
+     41d:	48 89 d6             	mov    %rdx,%rsi
+     420:	89 c7                	mov    %eax,%edi
+     422:	b8 00 00 00 00       	mov    $0x0,%eax
+     427:	e8 4e 12 00 00       	call   167a <printf>
+     42c:	90                   	nop
+     42d:	eb fd                	jmp    42c <sbrktest+0x282>
+  }
+  lastaddr = (char *)(BIG - 1);
+     42f:	48 c7 45 c0 ff ff 0f 	movq   $0xfffff,-0x40(%rbp)
+     436:	00 
+  *lastaddr = 99;
+     437:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     43b:	c6 00 63             	movb   $0x63,(%rax)
+
+  // can we read the kernel's memory?
+  printf(stdout, "pids 4-43 (6-45 if ran after sh) should be killed with trap 14 err 5\n");
+     43e:	8b 05 0c 26 00 00    	mov    0x260c(%rip),%eax        # 2a50 <stdout>
+     444:	48 8d 15 45 1c 00 00 	lea    0x1c45(%rip),%rdx        # 2090 <malloc+0x21b>
+     44b:	48 89 d6             	mov    %rdx,%rsi
+     44e:	89 c7                	mov    %eax,%edi
+     450:	b8 00 00 00 00       	mov    $0x0,%eax
+     455:	e8 20 12 00 00       	call   167a <printf>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     45a:	48 c7 45 f8 00 00 00 	movq   $0xffffffff80000000,-0x8(%rbp)
+     461:	80 
+     462:	e9 04 01 00 00       	jmp    56b <sbrktest+0x3c1>
+    pid = fork();
+     467:	e8 ad 17 00 00       	call   1c19 <fork>
+     46c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (pid < 0) {
+     46f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     473:	79 5c                	jns    4d1 <sbrktest+0x327>
+      error("fork failed\n");
+     475:	8b 05 d5 25 00 00    	mov    0x25d5(%rip),%eax        # 2a50 <stdout>
+     47b:	ba 7b 00 00 00       	mov    $0x7b,%edx
+     480:	48 8d 0d 27 1b 00 00 	lea    0x1b27(%rip),%rcx        # 1fae <malloc+0x139>
+     487:	48 89 ce             	mov    %rcx,%rsi
+     48a:	89 c7                	mov    %eax,%edi
+     48c:	b8 00 00 00 00       	mov    $0x0,%eax
+     491:	e8 e4 11 00 00       	call   167a <printf>
+     496:	8b 05 b4 25 00 00    	mov    0x25b4(%rip),%eax        # 2a50 <stdout>
+     49c:	48 8d 15 33 1c 00 00 	lea    0x1c33(%rip),%rdx        # 20d6 <malloc+0x261>
+     4a3:	48 89 d6             	mov    %rdx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 c8 11 00 00       	call   167a <printf>
+     4b2:	8b 05 98 25 00 00    	mov    0x2598(%rip),%eax        # 2a50 <stdout>
+     4b8:	48 8d 15 1b 1b 00 00 	lea    0x1b1b(%rip),%rdx        # 1fda <malloc+0x165>
+     4bf:	48 89 d6             	mov    %rdx,%rsi
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c9:	e8 ac 11 00 00       	call   167a <printf>
+     4ce:	90                   	nop
+     4cf:	eb fd                	jmp    4ce <sbrktest+0x324>
+    }
+    if (pid == 0) {
+     4d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     4d5:	0f 85 83 00 00 00    	jne    55e <sbrktest+0x3b4>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+     4db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4df:	0f b6 00             	movzbl (%rax),%eax
+     4e2:	0f be c8             	movsbl %al,%ecx
+     4e5:	8b 05 65 25 00 00    	mov    0x2565(%rip),%eax        # 2a50 <stdout>
+     4eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     4ef:	48 8d 35 ed 1b 00 00 	lea    0x1bed(%rip),%rsi        # 20e3 <malloc+0x26e>
+     4f6:	89 c7                	mov    %eax,%edi
+     4f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fd:	e8 78 11 00 00       	call   167a <printf>
+      error("a bad process is not killed!");
+     502:	8b 05 48 25 00 00    	mov    0x2548(%rip),%eax        # 2a50 <stdout>
+     508:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     50d:	48 8d 0d 9a 1a 00 00 	lea    0x1a9a(%rip),%rcx        # 1fae <malloc+0x139>
+     514:	48 89 ce             	mov    %rcx,%rsi
+     517:	89 c7                	mov    %eax,%edi
+     519:	b8 00 00 00 00       	mov    $0x0,%eax
+     51e:	e8 57 11 00 00       	call   167a <printf>
+     523:	8b 05 27 25 00 00    	mov    0x2527(%rip),%eax        # 2a50 <stdout>
+     529:	48 8d 15 cc 1b 00 00 	lea    0x1bcc(%rip),%rdx        # 20fc <malloc+0x287>
+     530:	48 89 d6             	mov    %rdx,%rsi
+     533:	89 c7                	mov    %eax,%edi
+     535:	b8 00 00 00 00       	mov    $0x0,%eax
+     53a:	e8 3b 11 00 00       	call   167a <printf>
+     53f:	8b 05 0b 25 00 00    	mov    0x250b(%rip),%eax        # 2a50 <stdout>
+     545:	48 8d 15 8e 1a 00 00 	lea    0x1a8e(%rip),%rdx        # 1fda <malloc+0x165>
+     54c:	48 89 d6             	mov    %rdx,%rsi
+     54f:	89 c7                	mov    %eax,%edi
+     551:	b8 00 00 00 00       	mov    $0x0,%eax
+     556:	e8 1f 11 00 00       	call   167a <printf>
+     55b:	90                   	nop
+     55c:	eb fd                	jmp    55b <sbrktest+0x3b1>
+    }
+    wait();
+     55e:	e8 c6 16 00 00       	call   1c29 <wait>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     563:	48 81 45 f8 50 c3 00 	addq   $0xc350,-0x8(%rbp)
+     56a:	00 
+     56b:	48 81 7d f8 7f 84 1e 	cmpq   $0xffffffff801e847f,-0x8(%rbp)
+     572:	80 
+     573:	0f 86 ee fe ff ff    	jbe    467 <sbrktest+0x2bd>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if (fork() == 0) {
+     579:	e8 9b 16 00 00       	call   1c19 <fork>
+     57e:	85 c0                	test   %eax,%eax
+     580:	0f 85 e8 00 00 00    	jne    66e <sbrktest+0x4c4>
+    do {
+      sysinfo(&info);
+     586:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     58d:	48 89 c7             	mov    %rax,%rdi
+     590:	e8 2c 17 00 00       	call   1cc1 <sysinfo>
+      free_pages = info.free_pages;
+     595:	8b 85 60 ff ff ff    	mov    -0xa0(%rbp),%eax
+     59b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+      // printf(stdout, "free pages before sbrk: %d\n", free_pages);
+      c = sbrk(BIG);
+     59e:	bf 00 00 10 00       	mov    $0x100000,%edi
+     5a3:	e8 01 17 00 00       	call   1ca9 <sbrk>
+     5a8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    } while ((c = sbrk(BIG)) != (char *) -1);
+     5ac:	bf 00 00 10 00       	mov    $0x100000,%edi
+     5b1:	e8 f3 16 00 00       	call   1ca9 <sbrk>
+     5b6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+     5ba:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     5bf:	75 c5                	jne    586 <sbrktest+0x3dc>
+    sysinfo(&info);
+     5c1:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+     5c8:	48 89 c7             	mov    %rax,%rdi
+     5cb:	e8 f1 16 00 00       	call   1cc1 <sysinfo>
+    printf(stdout, "free pages after out-of-memory(shouldn't be 0): %d\n", info.free_pages);
+     5d0:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+     5d6:	8b 05 74 24 00 00    	mov    0x2474(%rip),%eax        # 2a50 <stdout>
+     5dc:	48 8d 0d 3d 1b 00 00 	lea    0x1b3d(%rip),%rcx        # 2120 <malloc+0x2ab>
+     5e3:	48 89 ce             	mov    %rcx,%rsi
+     5e6:	89 c7                	mov    %eax,%edi
+     5e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ed:	e8 88 10 00 00       	call   167a <printf>
+
+    // if those failed allocations freed up the pages they did allocate,
+    // we'll be able to allocate here
+    c = sbrk(4096);
+     5f2:	bf 00 10 00 00       	mov    $0x1000,%edi
+     5f7:	e8 ad 16 00 00       	call   1ca9 <sbrk>
+     5fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (free_pages != 0 && c == (char *) -1) {
+     600:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+     604:	74 63                	je     669 <sbrktest+0x4bf>
+     606:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     60b:	75 5c                	jne    669 <sbrktest+0x4bf>
+      error("failed sbrk leaked memory. Uncomment lines 136 for more information.\n");
+     60d:	8b 05 3d 24 00 00    	mov    0x243d(%rip),%eax        # 2a50 <stdout>
+     613:	ba 94 00 00 00       	mov    $0x94,%edx
+     618:	48 8d 0d 8f 19 00 00 	lea    0x198f(%rip),%rcx        # 1fae <malloc+0x139>
+     61f:	48 89 ce             	mov    %rcx,%rsi
+     622:	89 c7                	mov    %eax,%edi
+     624:	b8 00 00 00 00       	mov    $0x0,%eax
+     629:	e8 4c 10 00 00       	call   167a <printf>
+     62e:	8b 05 1c 24 00 00    	mov    0x241c(%rip),%eax        # 2a50 <stdout>
+     634:	48 8d 15 1d 1b 00 00 	lea    0x1b1d(%rip),%rdx        # 2158 <malloc+0x2e3>
+     63b:	48 89 d6             	mov    %rdx,%rsi
+     63e:	89 c7                	mov    %eax,%edi
+     640:	b8 00 00 00 00       	mov    $0x0,%eax
+     645:	e8 30 10 00 00       	call   167a <printf>
+     64a:	8b 05 00 24 00 00    	mov    0x2400(%rip),%eax        # 2a50 <stdout>
+     650:	48 8d 15 83 19 00 00 	lea    0x1983(%rip),%rdx        # 1fda <malloc+0x165>
+     657:	48 89 d6             	mov    %rdx,%rsi
+     65a:	89 c7                	mov    %eax,%edi
+     65c:	b8 00 00 00 00       	mov    $0x0,%eax
+     661:	e8 14 10 00 00       	call   167a <printf>
+     666:	90                   	nop
+     667:	eb fd                	jmp    666 <sbrktest+0x4bc>
+    }
+    exit();
+     669:	e8 b3 15 00 00       	call   1c21 <exit>
+  } else {
+    wait();
+     66e:	e8 b6 15 00 00       	call   1c29 <wait>
+  }
+
+  char *d = sbrk(0);
+     673:	bf 00 00 00 00       	mov    $0x0,%edi
+     678:	e8 2c 16 00 00       	call   1ca9 <sbrk>
+     67d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if (d > oldbrk) {
+     681:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     685:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     689:	0f 83 23 02 00 00    	jae    8b2 <sbrktest+0x708>
+    if (sbrk(-(d - oldbrk)) != d)
+     68f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     693:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+     697:	89 c7                	mov    %eax,%edi
+     699:	e8 0b 16 00 00       	call   1ca9 <sbrk>
+     69e:	48 39 45 b8          	cmp    %rax,-0x48(%rbp)
+     6a2:	74 5c                	je     700 <sbrktest+0x556>
+      error("sbrk negative number doesn't return prev break\n");
+     6a4:	8b 05 a6 23 00 00    	mov    0x23a6(%rip),%eax        # 2a50 <stdout>
+     6aa:	ba 9e 00 00 00       	mov    $0x9e,%edx
+     6af:	48 8d 0d f8 18 00 00 	lea    0x18f8(%rip),%rcx        # 1fae <malloc+0x139>
+     6b6:	48 89 ce             	mov    %rcx,%rsi
+     6b9:	89 c7                	mov    %eax,%edi
+     6bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c0:	e8 b5 0f 00 00       	call   167a <printf>
+     6c5:	8b 05 85 23 00 00    	mov    0x2385(%rip),%eax        # 2a50 <stdout>
+     6cb:	48 8d 15 ce 1a 00 00 	lea    0x1ace(%rip),%rdx        # 21a0 <malloc+0x32b>
+     6d2:	48 89 d6             	mov    %rdx,%rsi
+     6d5:	89 c7                	mov    %eax,%edi
+     6d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6dc:	e8 99 0f 00 00       	call   167a <printf>
+     6e1:	8b 05 69 23 00 00    	mov    0x2369(%rip),%eax        # 2a50 <stdout>
+     6e7:	48 8d 15 ec 18 00 00 	lea    0x18ec(%rip),%rdx        # 1fda <malloc+0x165>
+     6ee:	48 89 d6             	mov    %rdx,%rsi
+     6f1:	89 c7                	mov    %eax,%edi
+     6f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f8:	e8 7d 0f 00 00       	call   167a <printf>
+     6fd:	90                   	nop
+     6fe:	eb fd                	jmp    6fd <sbrktest+0x553>
+
+    // OPTIONAL TESTS FOR SBRK DECREMENT
+    if (sbrk(0) == oldbrk) {
+     700:	bf 00 00 00 00       	mov    $0x0,%edi
+     705:	e8 9f 15 00 00       	call   1ca9 <sbrk>
+     70a:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     70e:	0f 85 9e 01 00 00    	jne    8b2 <sbrktest+0x708>
+      printf(stdout, "Good job! sbrk decrement implemented!\n");
+     714:	8b 05 36 23 00 00    	mov    0x2336(%rip),%eax        # 2a50 <stdout>
+     71a:	48 8d 15 af 1a 00 00 	lea    0x1aaf(%rip),%rdx        # 21d0 <malloc+0x35b>
+     721:	48 89 d6             	mov    %rdx,%rsi
+     724:	89 c7                	mov    %eax,%edi
+     726:	b8 00 00 00 00       	mov    $0x0,%eax
+     72b:	e8 4a 0f 00 00       	call   167a <printf>
+      if (sbrk(-1) != oldbrk) {
+     730:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+     735:	e8 6f 15 00 00       	call   1ca9 <sbrk>
+     73a:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     73e:	74 5c                	je     79c <sbrktest+0x5f2>
+        error("sbrk decrement more than allocated should do nothing\n");
+     740:	8b 05 0a 23 00 00    	mov    0x230a(%rip),%eax        # 2a50 <stdout>
+     746:	ba a4 00 00 00       	mov    $0xa4,%edx
+     74b:	48 8d 0d 5c 18 00 00 	lea    0x185c(%rip),%rcx        # 1fae <malloc+0x139>
+     752:	48 89 ce             	mov    %rcx,%rsi
+     755:	89 c7                	mov    %eax,%edi
+     757:	b8 00 00 00 00       	mov    $0x0,%eax
+     75c:	e8 19 0f 00 00       	call   167a <printf>
+     761:	8b 05 e9 22 00 00    	mov    0x22e9(%rip),%eax        # 2a50 <stdout>
+     767:	48 8d 15 8a 1a 00 00 	lea    0x1a8a(%rip),%rdx        # 21f8 <malloc+0x383>
+     76e:	48 89 d6             	mov    %rdx,%rsi
+     771:	89 c7                	mov    %eax,%edi
+     773:	b8 00 00 00 00       	mov    $0x0,%eax
+     778:	e8 fd 0e 00 00       	call   167a <printf>
+     77d:	8b 05 cd 22 00 00    	mov    0x22cd(%rip),%eax        # 2a50 <stdout>
+     783:	48 8d 15 50 18 00 00 	lea    0x1850(%rip),%rdx        # 1fda <malloc+0x165>
+     78a:	48 89 d6             	mov    %rdx,%rsi
+     78d:	89 c7                	mov    %eax,%edi
+     78f:	b8 00 00 00 00       	mov    $0x0,%eax
+     794:	e8 e1 0e 00 00       	call   167a <printf>
+     799:	90                   	nop
+     79a:	eb fd                	jmp    799 <sbrktest+0x5ef>
+      }
+      sbrk(10);
+     79c:	bf 0a 00 00 00       	mov    $0xa,%edi
+     7a1:	e8 03 15 00 00       	call   1ca9 <sbrk>
+      char *newbrk = sbrk(0);
+     7a6:	bf 00 00 00 00       	mov    $0x0,%edi
+     7ab:	e8 f9 14 00 00       	call   1ca9 <sbrk>
+     7b0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+      if (sbrk(-100) != newbrk) {
+     7b4:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     7b9:	e8 eb 14 00 00       	call   1ca9 <sbrk>
+     7be:	48 39 45 b0          	cmp    %rax,-0x50(%rbp)
+     7c2:	74 5c                	je     820 <sbrktest+0x676>
+        error("sbrk decrement more than allocated should do nothing\n");
+     7c4:	8b 05 86 22 00 00    	mov    0x2286(%rip),%eax        # 2a50 <stdout>
+     7ca:	ba a9 00 00 00       	mov    $0xa9,%edx
+     7cf:	48 8d 0d d8 17 00 00 	lea    0x17d8(%rip),%rcx        # 1fae <malloc+0x139>
+     7d6:	48 89 ce             	mov    %rcx,%rsi
+     7d9:	89 c7                	mov    %eax,%edi
+     7db:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e0:	e8 95 0e 00 00       	call   167a <printf>
+     7e5:	8b 05 65 22 00 00    	mov    0x2265(%rip),%eax        # 2a50 <stdout>
+     7eb:	48 8d 15 06 1a 00 00 	lea    0x1a06(%rip),%rdx        # 21f8 <malloc+0x383>
+     7f2:	48 89 d6             	mov    %rdx,%rsi
+     7f5:	89 c7                	mov    %eax,%edi
+     7f7:	b8 00 00 00 00       	mov    $0x0,%eax
+     7fc:	e8 79 0e 00 00       	call   167a <printf>
+     801:	8b 05 49 22 00 00    	mov    0x2249(%rip),%eax        # 2a50 <stdout>
+     807:	48 8d 15 cc 17 00 00 	lea    0x17cc(%rip),%rdx        # 1fda <malloc+0x165>
+     80e:	48 89 d6             	mov    %rdx,%rsi
+     811:	89 c7                	mov    %eax,%edi
+     813:	b8 00 00 00 00       	mov    $0x0,%eax
+     818:	e8 5d 0e 00 00       	call   167a <printf>
+     81d:	90                   	nop
+     81e:	eb fd                	jmp    81d <sbrktest+0x673>
+      }
+      sbrk(-10);
+     820:	bf f6 ff ff ff       	mov    $0xfffffff6,%edi
+     825:	e8 7f 14 00 00       	call   1ca9 <sbrk>
+      if (sbrk(0) != oldbrk) {
+     82a:	bf 00 00 00 00       	mov    $0x0,%edi
+     82f:	e8 75 14 00 00       	call   1ca9 <sbrk>
+     834:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     838:	74 5c                	je     896 <sbrktest+0x6ec>
+        error("not releasing all heap memoery\n");
+     83a:	8b 05 10 22 00 00    	mov    0x2210(%rip),%eax        # 2a50 <stdout>
+     840:	ba ad 00 00 00       	mov    $0xad,%edx
+     845:	48 8d 0d 62 17 00 00 	lea    0x1762(%rip),%rcx        # 1fae <malloc+0x139>
+     84c:	48 89 ce             	mov    %rcx,%rsi
+     84f:	89 c7                	mov    %eax,%edi
+     851:	b8 00 00 00 00       	mov    $0x0,%eax
+     856:	e8 1f 0e 00 00       	call   167a <printf>
+     85b:	8b 05 ef 21 00 00    	mov    0x21ef(%rip),%eax        # 2a50 <stdout>
+     861:	48 8d 15 c8 19 00 00 	lea    0x19c8(%rip),%rdx        # 2230 <malloc+0x3bb>
+     868:	48 89 d6             	mov    %rdx,%rsi
+     86b:	89 c7                	mov    %eax,%edi
+     86d:	b8 00 00 00 00       	mov    $0x0,%eax
+     872:	e8 03 0e 00 00       	call   167a <printf>
+     877:	8b 05 d3 21 00 00    	mov    0x21d3(%rip),%eax        # 2a50 <stdout>
+     87d:	48 8d 15 56 17 00 00 	lea    0x1756(%rip),%rdx        # 1fda <malloc+0x165>
+     884:	48 89 d6             	mov    %rdx,%rsi
+     887:	89 c7                	mov    %eax,%edi
+     889:	b8 00 00 00 00       	mov    $0x0,%eax
+     88e:	e8 e7 0d 00 00       	call   167a <printf>
+     893:	90                   	nop
+     894:	eb fd                	jmp    893 <sbrktest+0x6e9>
+      }
+      printf(stdout, "sbrk decrement test passed!\n");
+     896:	8b 05 b4 21 00 00    	mov    0x21b4(%rip),%eax        # 2a50 <stdout>
+     89c:	48 8d 15 ad 19 00 00 	lea    0x19ad(%rip),%rdx        # 2250 <malloc+0x3db>
+     8a3:	48 89 d6             	mov    %rdx,%rsi
+     8a6:	89 c7                	mov    %eax,%edi
+     8a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ad:	e8 c8 0d 00 00       	call   167a <printf>
+    }
+  }
+
+  printf(stdout, "sbrktest passed\n");
+     8b2:	8b 05 98 21 00 00    	mov    0x2198(%rip),%eax        # 2a50 <stdout>
+     8b8:	48 8d 15 ae 19 00 00 	lea    0x19ae(%rip),%rdx        # 226d <malloc+0x3f8>
+     8bf:	48 89 d6             	mov    %rdx,%rsi
+     8c2:	89 c7                	mov    %eax,%edi
+     8c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     8c9:	e8 ac 0d 00 00       	call   167a <printf>
+}
+     8ce:	90                   	nop
+     8cf:	c9                   	leave
+     8d0:	c3                   	ret
+
+00000000000008d1 <sbrklazytest>:
+
+void sbrklazytest(void) {
+     8d1:	55                   	push   %rbp
+     8d2:	48 89 e5             	mov    %rsp,%rbp
+     8d5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  struct sys_info info1, info2, info3;
+  int npg = 64;
+     8dc:	c7 45 f8 40 00 00 00 	movl   $0x40,-0x8(%rbp)
+  char *a;
+  int i, pid;
+
+  printf(stdout, "sbrklazytest\n");
+     8e3:	8b 05 67 21 00 00    	mov    0x2167(%rip),%eax        # 2a50 <stdout>
+     8e9:	48 8d 15 8e 19 00 00 	lea    0x198e(%rip),%rdx        # 227e <malloc+0x409>
+     8f0:	48 89 d6             	mov    %rdx,%rsi
+     8f3:	89 c7                	mov    %eax,%edi
+     8f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     8fa:	e8 7b 0d 00 00       	call   167a <printf>
+
+  // growing the heap takes no pages until they are touched
+  sysinfo(&info1);
+     8ff:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+     903:	48 89 c7             	mov    %rax,%rdi
+     906:	e8 b6 13 00 00       	call   1cc1 <sysinfo>
+  a = sbrk(npg * 4096);
+     90b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     90e:	c1 e0 0c             	shl    $0xc,%eax
+     911:	89 c7                	mov    %eax,%edi
+     913:	e8 91 13 00 00       	call   1ca9 <sbrk>
+     918:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  sysinfo(&info2);
+     91c:	48 8d 85 5c ff ff ff 	lea    -0xa4(%rbp),%rax
+     923:	48 89 c7             	mov    %rax,%rdi
+     926:	e8 96 13 00 00       	call   1cc1 <sysinfo>
+  if (a == (char *) -1)
+     92b:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     930:	75 5c                	jne    98e <sbrklazytest+0xbd>
+    error("sbrk failed\n");
+     932:	8b 05 18 21 00 00    	mov    0x2118(%rip),%eax        # 2a50 <stdout>
+     938:	ba c3 00 00 00       	mov    $0xc3,%edx
+     93d:	48 8d 0d 6a 16 00 00 	lea    0x166a(%rip),%rcx        # 1fae <malloc+0x139>
+     944:	48 89 ce             	mov    %rcx,%rsi
+     947:	89 c7                	mov    %eax,%edi
+     949:	b8 00 00 00 00       	mov    $0x0,%eax
+     94e:	e8 27 0d 00 00       	call   167a <printf>
+     953:	8b 05 f7 20 00 00    	mov    0x20f7(%rip),%eax        # 2a50 <stdout>
+     959:	48 8d 15 2c 19 00 00 	lea    0x192c(%rip),%rdx        # 228c <malloc+0x417>
+     960:	48 89 d6             	mov    %rdx,%rsi
+     963:	89 c7                	mov    %eax,%edi
+     965:	b8 00 00 00 00       	mov    $0x0,%eax
+     96a:	e8 0b 0d 00 00       	call   167a <printf>
+     96f:	8b 05 db 20 00 00    	mov    0x20db(%rip),%eax        # 2a50 <stdout>
+     975:	48 8d 15 5e 16 00 00 	lea    0x165e(%rip),%rdx        # 1fda <malloc+0x165>
+     97c:	48 89 d6             	mov    %rdx,%rsi
+     97f:	89 c7                	mov    %eax,%edi
+     981:	b8 00 00 00 00       	mov    $0x0,%eax
+     986:	e8 ef 0c 00 00       	call   167a <printf>
+     98b:	90                   	nop
+     98c:	eb fd                	jmp    98b <sbrklazytest+0xba>
+  if (info2.free_pages != info1.free_pages)
+     98e:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+     994:	8b 45 ac             	mov    -0x54(%rbp),%eax
+     997:	39 c2                	cmp    %eax,%edx
+     999:	74 67                	je     a02 <sbrklazytest+0x131>
+    error("sbrk took %d pages before they were touched",
+     99b:	8b 05 af 20 00 00    	mov    0x20af(%rip),%eax        # 2a50 <stdout>
+     9a1:	ba c5 00 00 00       	mov    $0xc5,%edx
+     9a6:	48 8d 0d 01 16 00 00 	lea    0x1601(%rip),%rcx        # 1fae <malloc+0x139>
+     9ad:	48 89 ce             	mov    %rcx,%rsi
+     9b0:	89 c7                	mov    %eax,%edi
+     9b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b7:	e8 be 0c 00 00       	call   167a <printf>
+     9bc:	8b 55 ac             	mov    -0x54(%rbp),%edx
+     9bf:	8b 85 64 ff ff ff    	mov    -0x9c(%rbp),%eax
+     9c5:	29 c2                	sub    %eax,%edx
+     9c7:	8b 05 83 20 00 00    	mov    0x2083(%rip),%eax        # 2a50 <stdout>
+     9cd:	48 8d 0d cc 18 00 00 	lea    0x18cc(%rip),%rcx        # 22a0 <malloc+0x42b>
+     9d4:	48 89 ce             	mov    %rcx,%rsi
+     9d7:	89 c7                	mov    %eax,%edi
+     9d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     9de:	e8 97 0c 00 00       	call   167a <printf>
+     9e3:	8b 05 67 20 00 00    	mov    0x2067(%rip),%eax        # 2a50 <stdout>
+     9e9:	48 8d 15 ea 15 00 00 	lea    0x15ea(%rip),%rdx        # 1fda <malloc+0x165>
+     9f0:	48 89 d6             	mov    %rdx,%rsi
+     9f3:	89 c7                	mov    %eax,%edi
+     9f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9fa:	e8 7b 0c 00 00       	call   167a <printf>
+     9ff:	90                   	nop
+     a00:	eb fd                	jmp    9ff <sbrklazytest+0x12e>
+          info1.free_pages - info2.free_pages);
+
+  // the old break may share a page with earlier heap, so only the
+  // last page is sure to be new
+  a[(npg - 1) * 4096] = 2;
+     a02:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a05:	83 e8 01             	sub    $0x1,%eax
+     a08:	c1 e0 0c             	shl    $0xc,%eax
+     a0b:	48 63 d0             	movslq %eax,%rdx
+     a0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a12:	48 01 d0             	add    %rdx,%rax
+     a15:	c6 00 02             	movb   $0x2,(%rax)
+  sysinfo(&info3);
+     a18:	48 8d 85 14 ff ff ff 	lea    -0xec(%rbp),%rax
+     a1f:	48 89 c7             	mov    %rax,%rdi
+     a22:	e8 9a 12 00 00       	call   1cc1 <sysinfo>
+  if (info2.free_pages - info3.free_pages < 1)
+     a27:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+     a2d:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+     a33:	29 c2                	sub    %eax,%edx
+     a35:	85 d2                	test   %edx,%edx
+     a37:	7f 5c                	jg     a95 <sbrklazytest+0x1c4>
+    error("touching a heap page took no page");
+     a39:	8b 05 11 20 00 00    	mov    0x2011(%rip),%eax        # 2a50 <stdout>
+     a3f:	ba cd 00 00 00       	mov    $0xcd,%edx
+     a44:	48 8d 0d 63 15 00 00 	lea    0x1563(%rip),%rcx        # 1fae <malloc+0x139>
+     a4b:	48 89 ce             	mov    %rcx,%rsi
+     a4e:	89 c7                	mov    %eax,%edi
+     a50:	b8 00 00 00 00       	mov    $0x0,%eax
+     a55:	e8 20 0c 00 00       	call   167a <printf>
+     a5a:	8b 05 f0 1f 00 00    	mov    0x1ff0(%rip),%eax        # 2a50 <stdout>
+     a60:	48 8d 15 69 18 00 00 	lea    0x1869(%rip),%rdx        # 22d0 <malloc+0x45b>
+     a67:	48 89 d6             	mov    %rdx,%rsi
+     a6a:	89 c7                	mov    %eax,%edi
+     a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+     a71:	e8 04 0c 00 00       	call   167a <printf>
+     a76:	8b 05 d4 1f 00 00    	mov    0x1fd4(%rip),%eax        # 2a50 <stdout>
+     a7c:	48 8d 15 57 15 00 00 	lea    0x1557(%rip),%rdx        # 1fda <malloc+0x165>
+     a83:	48 89 d6             	mov    %rdx,%rsi
+     a86:	89 c7                	mov    %eax,%edi
+     a88:	b8 00 00 00 00       	mov    $0x0,%eax
+     a8d:	e8 e8 0b 00 00       	call   167a <printf>
+     a92:	90                   	nop
+     a93:	eb fd                	jmp    a92 <sbrklazytest+0x1c1>
+  a[0] = 1;
+     a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a99:	c6 00 01             	movb   $0x1,(%rax)
+
+  // a child sees the pages the parent touched, and zeroes in the rest
+  pid = fork();
+     a9c:	e8 78 11 00 00       	call   1c19 <fork>
+     aa1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (pid < 0) {
+     aa4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     aa8:	79 5c                	jns    b06 <sbrklazytest+0x235>
+    error("fork failed\n");
+     aaa:	8b 05 a0 1f 00 00    	mov    0x1fa0(%rip),%eax        # 2a50 <stdout>
+     ab0:	ba d3 00 00 00       	mov    $0xd3,%edx
+     ab5:	48 8d 0d f2 14 00 00 	lea    0x14f2(%rip),%rcx        # 1fae <malloc+0x139>
+     abc:	48 89 ce             	mov    %rcx,%rsi
+     abf:	89 c7                	mov    %eax,%edi
+     ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac6:	e8 af 0b 00 00       	call   167a <printf>
+     acb:	8b 05 7f 1f 00 00    	mov    0x1f7f(%rip),%eax        # 2a50 <stdout>
+     ad1:	48 8d 15 fe 15 00 00 	lea    0x15fe(%rip),%rdx        # 20d6 <malloc+0x261>
+     ad8:	48 89 d6             	mov    %rdx,%rsi
+     adb:	89 c7                	mov    %eax,%edi
+     add:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae2:	e8 93 0b 00 00       	call   167a <printf>
+     ae7:	8b 05 63 1f 00 00    	mov    0x1f63(%rip),%eax        # 2a50 <stdout>
+     aed:	48 8d 15 e6 14 00 00 	lea    0x14e6(%rip),%rdx        # 1fda <malloc+0x165>
+     af4:	48 89 d6             	mov    %rdx,%rsi
+     af7:	89 c7                	mov    %eax,%edi
+     af9:	b8 00 00 00 00       	mov    $0x0,%eax
+     afe:	e8 77 0b 00 00       	call   167a <printf>
+     b03:	90                   	nop
+     b04:	eb fd                	jmp    b03 <sbrklazytest+0x232>
+  }
+  if (pid == 0) {
+     b06:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     b0a:	0f 85 2b 01 00 00    	jne    c3b <sbrklazytest+0x36a>
+    if (a[0] != 1 || a[(npg - 1) * 4096] != 2)
+     b10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b14:	0f b6 00             	movzbl (%rax),%eax
+     b17:	3c 01                	cmp    $0x1,%al
+     b19:	75 1a                	jne    b35 <sbrklazytest+0x264>
+     b1b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b1e:	83 e8 01             	sub    $0x1,%eax
+     b21:	c1 e0 0c             	shl    $0xc,%eax
+     b24:	48 63 d0             	movslq %eax,%rdx
+     b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b2b:	48 01 d0             	add    %rdx,%rax
+     b2e:	0f b6 00             	movzbl (%rax),%eax
+     b31:	3c 02                	cmp    $0x2,%al
+     b33:	74 5c                	je     b91 <sbrklazytest+0x2c0>
+      error("child doesn't see the parent's heap writes");
+     b35:	8b 05 15 1f 00 00    	mov    0x1f15(%rip),%eax        # 2a50 <stdout>
+     b3b:	ba d7 00 00 00       	mov    $0xd7,%edx
+     b40:	48 8d 0d 67 14 00 00 	lea    0x1467(%rip),%rcx        # 1fae <malloc+0x139>
+     b47:	48 89 ce             	mov    %rcx,%rsi
+     b4a:	89 c7                	mov    %eax,%edi
+     b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b51:	e8 24 0b 00 00       	call   167a <printf>
+     b56:	8b 05 f4 1e 00 00    	mov    0x1ef4(%rip),%eax        # 2a50 <stdout>
+     b5c:	48 8d 15 95 17 00 00 	lea    0x1795(%rip),%rdx        # 22f8 <malloc+0x483>
+     b63:	48 89 d6             	mov    %rdx,%rsi
+     b66:	89 c7                	mov    %eax,%edi
+     b68:	b8 00 00 00 00       	mov    $0x0,%eax
+     b6d:	e8 08 0b 00 00       	call   167a <printf>
+     b72:	8b 05 d8 1e 00 00    	mov    0x1ed8(%rip),%eax        # 2a50 <stdout>
+     b78:	48 8d 15 5b 14 00 00 	lea    0x145b(%rip),%rdx        # 1fda <malloc+0x165>
+     b7f:	48 89 d6             	mov    %rdx,%rsi
+     b82:	89 c7                	mov    %eax,%edi
+     b84:	b8 00 00 00 00       	mov    $0x0,%eax
+     b89:	e8 ec 0a 00 00       	call   167a <printf>
+     b8e:	90                   	nop
+     b8f:	eb fd                	jmp    b8e <sbrklazytest+0x2bd>
+    for (i = 4096; i < (npg - 1) * 4096; i++)
+     b91:	c7 45 fc 00 10 00 00 	movl   $0x1000,-0x4(%rbp)
+     b98:	e9 87 00 00 00       	jmp    c24 <sbrklazytest+0x353>
+      if (a[i] != 0)
+     b9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ba0:	48 63 d0             	movslq %eax,%rdx
+     ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ba7:	48 01 d0             	add    %rdx,%rax
+     baa:	0f b6 00             	movzbl (%rax),%eax
+     bad:	84 c0                	test   %al,%al
+     baf:	74 6f                	je     c20 <sbrklazytest+0x34f>
+        error("untouched heap byte %d is %d in the child", i, a[i]);
+     bb1:	8b 05 99 1e 00 00    	mov    0x1e99(%rip),%eax        # 2a50 <stdout>
+     bb7:	ba da 00 00 00       	mov    $0xda,%edx
+     bbc:	48 8d 0d eb 13 00 00 	lea    0x13eb(%rip),%rcx        # 1fae <malloc+0x139>
+     bc3:	48 89 ce             	mov    %rcx,%rsi
+     bc6:	89 c7                	mov    %eax,%edi
+     bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     bcd:	e8 a8 0a 00 00       	call   167a <printf>
+     bd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bd5:	48 63 d0             	movslq %eax,%rdx
+     bd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bdc:	48 01 d0             	add    %rdx,%rax
+     bdf:	0f b6 00             	movzbl (%rax),%eax
+     be2:	0f be c8             	movsbl %al,%ecx
+     be5:	8b 05 65 1e 00 00    	mov    0x1e65(%rip),%eax        # 2a50 <stdout>
+     beb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     bee:	48 8d 35 33 17 00 00 	lea    0x1733(%rip),%rsi        # 2328 <malloc+0x4b3>
+     bf5:	89 c7                	mov    %eax,%edi
+     bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+     bfc:	e8 79 0a 00 00       	call   167a <printf>
+     c01:	8b 05 49 1e 00 00    	mov    0x1e49(%rip),%eax        # 2a50 <stdout>
+     c07:	48 8d 15 cc 13 00 00 	lea    0x13cc(%rip),%rdx        # 1fda <malloc+0x165>
+     c0e:	48 89 d6             	mov    %rdx,%rsi
+     c11:	89 c7                	mov    %eax,%edi
+     c13:	b8 00 00 00 00       	mov    $0x0,%eax
+     c18:	e8 5d 0a 00 00       	call   167a <printf>
+     c1d:	90                   	nop
+     c1e:	eb fd                	jmp    c1d <sbrklazytest+0x34c>
+    for (i = 4096; i < (npg - 1) * 4096; i++)
+     c20:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c24:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c27:	83 e8 01             	sub    $0x1,%eax
+     c2a:	c1 e0 0c             	shl    $0xc,%eax
+     c2d:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     c30:	0f 8c 67 ff ff ff    	jl     b9d <sbrklazytest+0x2cc>
+    exit();
+     c36:	e8 e6 0f 00 00       	call   1c21 <exit>
+  }
+  wait();
+     c3b:	e8 e9 0f 00 00       	call   1c29 <wait>
+
+  if (sbrk(-(npg * 4096)) == (char *) -1)
+     c40:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     c43:	b8 00 00 00 00       	mov    $0x0,%eax
+     c48:	29 d0                	sub    %edx,%eax
+     c4a:	c1 e0 0c             	shl    $0xc,%eax
+     c4d:	89 c7                	mov    %eax,%edi
+     c4f:	e8 55 10 00 00       	call   1ca9 <sbrk>
+     c54:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+     c58:	75 5c                	jne    cb6 <sbrklazytest+0x3e5>
+    error("sbrk couldn't shrink the heap\n");
+     c5a:	8b 05 f0 1d 00 00    	mov    0x1df0(%rip),%eax        # 2a50 <stdout>
+     c60:	ba e0 00 00 00       	mov    $0xe0,%edx
+     c65:	48 8d 0d 42 13 00 00 	lea    0x1342(%rip),%rcx        # 1fae <malloc+0x139>
+     c6c:	48 89 ce             	mov    %rcx,%rsi
+     c6f:	89 c7                	mov    %eax,%edi
+     c71:	b8 00 00 00 00       	mov    $0x0,%eax
+     c76:	e8 ff 09 00 00       	call   167a <printf>
+     c7b:	8b 05 cf 1d 00 00    	mov    0x1dcf(%rip),%eax        # 2a50 <stdout>
+     c81:	48 8d 15 d0 16 00 00 	lea    0x16d0(%rip),%rdx        # 2358 <malloc+0x4e3>
+     c88:	48 89 d6             	mov    %rdx,%rsi
+     c8b:	89 c7                	mov    %eax,%edi
+     c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c92:	e8 e3 09 00 00       	call   167a <printf>
+     c97:	8b 05 b3 1d 00 00    	mov    0x1db3(%rip),%eax        # 2a50 <stdout>
+     c9d:	48 8d 15 36 13 00 00 	lea    0x1336(%rip),%rdx        # 1fda <malloc+0x165>
+     ca4:	48 89 d6             	mov    %rdx,%rsi
+     ca7:	89 c7                	mov    %eax,%edi
+     ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+     cae:	e8 c7 09 00 00       	call   167a <printf>
+     cb3:	90                   	nop
+     cb4:	eb fd                	jmp    cb3 <sbrklazytest+0x3e2>
+  printf(stdout, "sbrklazytest passed\n");
+     cb6:	8b 05 94 1d 00 00    	mov    0x1d94(%rip),%eax        # 2a50 <stdout>
+     cbc:	48 8d 15 b4 16 00 00 	lea    0x16b4(%rip),%rdx        # 2377 <malloc+0x502>
+     cc3:	48 89 d6             	mov    %rdx,%rsi
+     cc6:	89 c7                	mov    %eax,%edi
+     cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ccd:	e8 a8 09 00 00       	call   167a <printf>
+}
+     cd2:	90                   	nop
+     cd3:	c9                   	leave
+     cd4:	c3                   	ret
+
+0000000000000cd5 <growstacktest>:
+
+void growstacktest() {
+     cd5:	55                   	push   %rbp
+     cd6:	48 89 e5             	mov    %rsp,%rbp
+     cd9:	41 57                	push   %r15
+     cdb:	41 56                	push   %r14
+     cdd:	41 55                	push   %r13
+     cdf:	41 54                	push   %r12
+     ce1:	53                   	push   %rbx
+     ce2:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+     ce9:	48 89 e0             	mov    %rsp,%rax
+     cec:	48 89 c3             	mov    %rax,%rbx
+  int i;
+  struct sys_info info1, info2;
+  printf(stdout, "growstacktest\n");
+     cef:	8b 05 5b 1d 00 00    	mov    0x1d5b(%rip),%eax        # 2a50 <stdout>
+     cf5:	48 8d 15 90 16 00 00 	lea    0x1690(%rip),%rdx        # 238c <malloc+0x517>
+     cfc:	48 89 d6             	mov    %rdx,%rsi
+     cff:	89 c7                	mov    %eax,%edi
+     d01:	b8 00 00 00 00       	mov    $0x0,%eax
+     d06:	e8 6f 09 00 00       	call   167a <printf>
+  sysinfo(&info1);
+     d0b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+     d12:	48 89 c7             	mov    %rax,%rdi
+     d15:	e8 a7 0f 00 00       	call   1cc1 <sysinfo>
+
+  printf(stdout, "pages_in_use before stack allocation = %d\n",
+     d1a:	8b 95 70 ff ff ff    	mov    -0x90(%rbp),%edx
+     d20:	8b 05 2a 1d 00 00    	mov    0x1d2a(%rip),%eax        # 2a50 <stdout>
+     d26:	48 8d 0d 73 16 00 00 	lea    0x1673(%rip),%rcx        # 23a0 <malloc+0x52b>
+     d2d:	48 89 ce             	mov    %rcx,%rsi
+     d30:	89 c7                	mov    %eax,%edi
+     d32:	b8 00 00 00 00       	mov    $0x0,%eax
+     d37:	e8 3e 09 00 00       	call   167a <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before stack allocation = %d\n",
+     d3c:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+     d42:	8b 05 08 1d 00 00    	mov    0x1d08(%rip),%eax        # 2a50 <stdout>
+     d48:	48 8d 0d 81 16 00 00 	lea    0x1681(%rip),%rcx        # 23d0 <malloc+0x55b>
+     d4f:	48 89 ce             	mov    %rcx,%rsi
+     d52:	89 c7                	mov    %eax,%edi
+     d54:	b8 00 00 00 00       	mov    $0x0,%eax
+     d59:	e8 1c 09 00 00       	call   167a <printf>
+         info1.pages_in_swap);
+
+  int page8 = 8 * 4096;
+     d5e:	c7 45 c8 00 80 00 00 	movl   $0x8000,-0x38(%rbp)
+  char buf[page8];
+     d65:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     d68:	48 63 d0             	movslq %eax,%rdx
+     d6b:	48 83 ea 01          	sub    $0x1,%rdx
+     d6f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     d73:	48 63 d0             	movslq %eax,%rdx
+     d76:	49 89 d6             	mov    %rdx,%r14
+     d79:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     d7f:	48 63 d0             	movslq %eax,%rdx
+     d82:	49 89 d4             	mov    %rdx,%r12
+     d85:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     d8b:	48 98                	cltq
+     d8d:	ba 10 00 00 00       	mov    $0x10,%edx
+     d92:	48 83 ea 01          	sub    $0x1,%rdx
+     d96:	48 01 d0             	add    %rdx,%rax
+     d99:	be 10 00 00 00       	mov    $0x10,%esi
+     d9e:	ba 00 00 00 00       	mov    $0x0,%edx
+     da3:	48 f7 f6             	div    %rsi
+     da6:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     daa:	48 29 c4             	sub    %rax,%rsp
+     dad:	48 89 e0             	mov    %rsp,%rax
+     db0:	48 83 c0 00          	add    $0x0,%rax
+     db4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  for (i = 0; i < 8; i++) {
+     db8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+     dbf:	eb 3a                	jmp    dfb <growstacktest+0x126>
+    buf[i * 4096] = 'a';
+     dc1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     dc4:	c1 e0 0c             	shl    $0xc,%eax
+     dc7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     dcb:	48 98                	cltq
+     dcd:	c6 04 02 61          	movb   $0x61,(%rdx,%rax,1)
+    buf[i * 4096 - 1] = buf[i * 4096];
+     dd1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     dd4:	c1 e0 0c             	shl    $0xc,%eax
+     dd7:	89 c1                	mov    %eax,%ecx
+     dd9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     ddc:	c1 e0 0c             	shl    $0xc,%eax
+     ddf:	8d 70 ff             	lea    -0x1(%rax),%esi
+     de2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     de6:	48 63 c1             	movslq %ecx,%rax
+     de9:	0f b6 0c 02          	movzbl (%rdx,%rax,1),%ecx
+     ded:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     df1:	48 63 c6             	movslq %esi,%rax
+     df4:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  for (i = 0; i < 8; i++) {
+     df7:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+     dfb:	83 7d cc 07          	cmpl   $0x7,-0x34(%rbp)
+     dff:	7e c0                	jle    dc1 <growstacktest+0xec>
+  }
+  sysinfo(&info2);
+     e01:	48 8d 85 28 ff ff ff 	lea    -0xd8(%rbp),%rax
+     e08:	48 89 c7             	mov    %rax,%rdi
+     e0b:	e8 b1 0e 00 00       	call   1cc1 <sysinfo>
+
+  printf(stdout, "pages_in_use after stack allocation = %d\n",
+     e10:	8b 95 28 ff ff ff    	mov    -0xd8(%rbp),%edx
+     e16:	8b 05 34 1c 00 00    	mov    0x1c34(%rip),%eax        # 2a50 <stdout>
+     e1c:	48 8d 0d dd 15 00 00 	lea    0x15dd(%rip),%rcx        # 2400 <malloc+0x58b>
+     e23:	48 89 ce             	mov    %rcx,%rsi
+     e26:	89 c7                	mov    %eax,%edi
+     e28:	b8 00 00 00 00       	mov    $0x0,%eax
+     e2d:	e8 48 08 00 00       	call   167a <printf>
+         info2.pages_in_use);
+  printf(stdout, "pages_in_swap after stack allocation = %d\n",
+     e32:	8b 95 2c ff ff ff    	mov    -0xd4(%rbp),%edx
+     e38:	8b 05 12 1c 00 00    	mov    0x1c12(%rip),%eax        # 2a50 <stdout>
+     e3e:	48 8d 0d eb 15 00 00 	lea    0x15eb(%rip),%rcx        # 2430 <malloc+0x5bb>
+     e45:	48 89 ce             	mov    %rcx,%rsi
+     e48:	89 c7                	mov    %eax,%edi
+     e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4f:	e8 26 08 00 00       	call   167a <printf>
+         info2.pages_in_swap);
+
+  // if grow ustack on-demand is implemented, then the 8 pages are allocated at
+  // run-time
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     e54:	8b 95 28 ff ff ff    	mov    -0xd8(%rbp),%edx
+     e5a:	8b 85 70 ff ff ff    	mov    -0x90(%rbp),%eax
+     e60:	29 c2                	sub    %eax,%edx
+     e62:	8b 85 74 ff ff ff    	mov    -0x8c(%rbp),%eax
+     e68:	01 c2                	add    %eax,%edx
+          info2.pages_in_swap !=
+     e6a:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     e70:	29 c2                	sub    %eax,%edx
+     e72:	83 fa 08             	cmp    $0x8,%edx
+     e75:	74 5c                	je     ed3 <growstacktest+0x1fe>
+      8)
+    error("user stack is not growing");
+     e77:	8b 05 d3 1b 00 00    	mov    0x1bd3(%rip),%eax        # 2a50 <stdout>
+     e7d:	ba 01 01 00 00       	mov    $0x101,%edx
+     e82:	48 8d 0d 25 11 00 00 	lea    0x1125(%rip),%rcx        # 1fae <malloc+0x139>
+     e89:	48 89 ce             	mov    %rcx,%rsi
+     e8c:	89 c7                	mov    %eax,%edi
+     e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e93:	e8 e2 07 00 00       	call   167a <printf>
+     e98:	8b 05 b2 1b 00 00    	mov    0x1bb2(%rip),%eax        # 2a50 <stdout>
+     e9e:	48 8d 15 b6 15 00 00 	lea    0x15b6(%rip),%rdx        # 245b <malloc+0x5e6>
+     ea5:	48 89 d6             	mov    %rdx,%rsi
+     ea8:	89 c7                	mov    %eax,%edi
+     eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+     eaf:	e8 c6 07 00 00       	call   167a <printf>
+     eb4:	8b 05 96 1b 00 00    	mov    0x1b96(%rip),%eax        # 2a50 <stdout>
+     eba:	48 8d 15 19 11 00 00 	lea    0x1119(%rip),%rdx        # 1fda <malloc+0x165>
+     ec1:	48 89 d6             	mov    %rdx,%rsi
+     ec4:	89 c7                	mov    %eax,%edi
+     ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+     ecb:	e8 aa 07 00 00       	call   167a <printf>
+     ed0:	90                   	nop
+     ed1:	eb fd                	jmp    ed0 <growstacktest+0x1fb>
+
+  printf(stdout, "growstacktest passed\n");
+     ed3:	8b 05 77 1b 00 00    	mov    0x1b77(%rip),%eax        # 2a50 <stdout>
+     ed9:	48 8d 15 95 15 00 00 	lea    0x1595(%rip),%rdx        # 2475 <malloc+0x600>
+     ee0:	48 89 d6             	mov    %rdx,%rsi
+     ee3:	89 c7                	mov    %eax,%edi
+     ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eea:	e8 8b 07 00 00       	call   167a <printf>
+     eef:	48 89 dc             	mov    %rbx,%rsp
+}
+     ef2:	90                   	nop
+     ef3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     ef7:	5b                   	pop    %rbx
+     ef8:	41 5c                	pop    %r12
+     efa:	41 5d                	pop    %r13
+     efc:	41 5e                	pop    %r14
+     efe:	41 5f                	pop    %r15
+     f00:	5d                   	pop    %rbp
+     f01:	c3                   	ret
+
+0000000000000f02 <growstacktest_edgecase>:
+
+void growstacktest_edgecase() {
+     f02:	55                   	push   %rbp
+     f03:	48 89 e5             	mov    %rsp,%rbp
+     f06:	48 83 ec 20          	sub    $0x20,%rsp
+  printf(stdout, "growstacktest_edgecase\n");
+     f0a:	8b 05 40 1b 00 00    	mov    0x1b40(%rip),%eax        # 2a50 <stdout>
+     f10:	48 8d 15 74 15 00 00 	lea    0x1574(%rip),%rdx        # 248b <malloc+0x616>
+     f17:	48 89 d6             	mov    %rdx,%rsi
+     f1a:	89 c7                	mov    %eax,%edi
+     f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+     f21:	e8 54 07 00 00       	call   167a <printf>
+  printf(stdout, "next 2 processes should be killed with trap 14 err 6\n");
+     f26:	8b 05 24 1b 00 00    	mov    0x1b24(%rip),%eax        # 2a50 <stdout>
+     f2c:	48 8d 15 75 15 00 00 	lea    0x1575(%rip),%rdx        # 24a8 <malloc+0x633>
+     f33:	48 89 d6             	mov    %rdx,%rsi
+     f36:	89 c7                	mov    %eax,%edi
+     f38:	b8 00 00 00 00       	mov    $0x0,%eax
+     f3d:	e8 38 07 00 00       	call   167a <printf>
+
+  int pid = fork();
+     f42:	e8 d2 0c 00 00       	call   1c19 <fork>
+     f47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+     f4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f4e:	75 6b                	jne    fbb <growstacktest_edgecase+0xb9>
+    char *buf = (char *) STACKBASE - 11 * 4096;
+     f50:	48 c7 45 e8 00 50 ff 	movq   $0x7fff5000,-0x18(%rbp)
+     f57:	7f 
+    // can we get 11 pages on the stack?
+    *buf = 0;
+     f58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f5c:	c6 00 00             	movb   $0x0,(%rax)
+    error("we can get 11 pages on stack");
+     f5f:	8b 05 eb 1a 00 00    	mov    0x1aeb(%rip),%eax        # 2a50 <stdout>
+     f65:	ba 0f 01 00 00       	mov    $0x10f,%edx
+     f6a:	48 8d 0d 3d 10 00 00 	lea    0x103d(%rip),%rcx        # 1fae <malloc+0x139>
+     f71:	48 89 ce             	mov    %rcx,%rsi
+     f74:	89 c7                	mov    %eax,%edi
+     f76:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7b:	e8 fa 06 00 00       	call   167a <printf>
+     f80:	8b 05 ca 1a 00 00    	mov    0x1aca(%rip),%eax        # 2a50 <stdout>
+     f86:	48 8d 15 51 15 00 00 	lea    0x1551(%rip),%rdx        # 24de <malloc+0x669>
+     f8d:	48 89 d6             	mov    %rdx,%rsi
+     f90:	89 c7                	mov    %eax,%edi
+     f92:	b8 00 00 00 00       	mov    $0x0,%eax
+     f97:	e8 de 06 00 00       	call   167a <printf>
+     f9c:	8b 05 ae 1a 00 00    	mov    0x1aae(%rip),%eax        # 2a50 <stdout>
+     fa2:	48 8d 15 31 10 00 00 	lea    0x1031(%rip),%rdx        # 1fda <malloc+0x165>
+     fa9:	48 89 d6             	mov    %rdx,%rsi
+     fac:	89 c7                	mov    %eax,%edi
+     fae:	b8 00 00 00 00       	mov    $0x0,%eax
+     fb3:	e8 c2 06 00 00       	call   167a <printf>
+     fb8:	90                   	nop
+     fb9:	eb fd                	jmp    fb8 <growstacktest_edgecase+0xb6>
+  } else if (pid < 0) {
+     fbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     fbf:	79 5c                	jns    101d <growstacktest_edgecase+0x11b>
+    error("fork() failed!\n");
+     fc1:	8b 05 89 1a 00 00    	mov    0x1a89(%rip),%eax        # 2a50 <stdout>
+     fc7:	ba 11 01 00 00       	mov    $0x111,%edx
+     fcc:	48 8d 0d db 0f 00 00 	lea    0xfdb(%rip),%rcx        # 1fae <malloc+0x139>
+     fd3:	48 89 ce             	mov    %rcx,%rsi
+     fd6:	89 c7                	mov    %eax,%edi
+     fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+     fdd:	e8 98 06 00 00       	call   167a <printf>
+     fe2:	8b 05 68 1a 00 00    	mov    0x1a68(%rip),%eax        # 2a50 <stdout>
+     fe8:	48 8d 15 0c 15 00 00 	lea    0x150c(%rip),%rdx        # 24fb <malloc+0x686>
+     fef:	48 89 d6             	mov    %rdx,%rsi
+     ff2:	89 c7                	mov    %eax,%edi
+     ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff9:	e8 7c 06 00 00       	call   167a <printf>
+     ffe:	8b 05 4c 1a 00 00    	mov    0x1a4c(%rip),%eax        # 2a50 <stdout>
+    1004:	48 8d 15 cf 0f 00 00 	lea    0xfcf(%rip),%rdx        # 1fda <malloc+0x165>
+    100b:	48 89 d6             	mov    %rdx,%rsi
+    100e:	89 c7                	mov    %eax,%edi
+    1010:	b8 00 00 00 00       	mov    $0x0,%eax
+    1015:	e8 60 06 00 00       	call   167a <printf>
+    101a:	90                   	nop
+    101b:	eb fd                	jmp    101a <growstacktest_edgecase+0x118>
+  } else {
+    wait();
+    101d:	e8 07 0c 00 00       	call   1c29 <wait>
+  }
+
+  pid = fork();
+    1022:	e8 f2 0b 00 00       	call   1c19 <fork>
+    1027:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+    102a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    102e:	75 6c                	jne    109c <growstacktest_edgecase+0x19a>
+    char *buf = (char *) STACKBASE;
+    1030:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1035:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    // can the stack grow upwards?
+    *buf = 0;
+    1039:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    103d:	c6 00 00             	movb   $0x0,(%rax)
+    error("stack can grow upwards!");
+    1040:	8b 05 0a 1a 00 00    	mov    0x1a0a(%rip),%eax        # 2a50 <stdout>
+    1046:	ba 1b 01 00 00       	mov    $0x11b,%edx
+    104b:	48 8d 0d 5c 0f 00 00 	lea    0xf5c(%rip),%rcx        # 1fae <malloc+0x139>
+    1052:	48 89 ce             	mov    %rcx,%rsi
+    1055:	89 c7                	mov    %eax,%edi
+    1057:	b8 00 00 00 00       	mov    $0x0,%eax
+    105c:	e8 19 06 00 00       	call   167a <printf>
+    1061:	8b 05 e9 19 00 00    	mov    0x19e9(%rip),%eax        # 2a50 <stdout>
+    1067:	48 8d 15 9d 14 00 00 	lea    0x149d(%rip),%rdx        # 250b <malloc+0x696>
+    106e:	48 89 d6             	mov    %rdx,%rsi
+    1071:	89 c7                	mov    %eax,%edi
+    1073:	b8 00 00 00 00       	mov    $0x0,%eax
+    1078:	e8 fd 05 00 00       	call   167a <printf>
+    107d:	8b 05 cd 19 00 00    	mov    0x19cd(%rip),%eax        # 2a50 <stdout>
+    1083:	48 8d 15 50 0f 00 00 	lea    0xf50(%rip),%rdx        # 1fda <malloc+0x165>
+    108a:	48 89 d6             	mov    %rdx,%rsi
+    108d:	89 c7                	mov    %eax,%edi
+    108f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1094:	e8 e1 05 00 00       	call   167a <printf>
+    1099:	90                   	nop
+    109a:	eb fd                	jmp    1099 <growstacktest_edgecase+0x197>
+  } else if (pid < 0) {
+    109c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    10a0:	79 5c                	jns    10fe <growstacktest_edgecase+0x1fc>
+    error("fork() failed!\n");
+    10a2:	8b 05 a8 19 00 00    	mov    0x19a8(%rip),%eax        # 2a50 <stdout>
+    10a8:	ba 1d 01 00 00       	mov    $0x11d,%edx
+    10ad:	48 8d 0d fa 0e 00 00 	lea    0xefa(%rip),%rcx        # 1fae <malloc+0x139>
+    10b4:	48 89 ce             	mov    %rcx,%rsi
+    10b7:	89 c7                	mov    %eax,%edi
+    10b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    10be:	e8 b7 05 00 00       	call   167a <printf>
+    10c3:	8b 05 87 19 00 00    	mov    0x1987(%rip),%eax        # 2a50 <stdout>
+    10c9:	48 8d 15 2b 14 00 00 	lea    0x142b(%rip),%rdx        # 24fb <malloc+0x686>
+    10d0:	48 89 d6             	mov    %rdx,%rsi
+    10d3:	89 c7                	mov    %eax,%edi
+    10d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10da:	e8 9b 05 00 00       	call   167a <printf>
+    10df:	8b 05 6b 19 00 00    	mov    0x196b(%rip),%eax        # 2a50 <stdout>
+    10e5:	48 8d 15 ee 0e 00 00 	lea    0xeee(%rip),%rdx        # 1fda <malloc+0x165>
+    10ec:	48 89 d6             	mov    %rdx,%rsi
+    10ef:	89 c7                	mov    %eax,%edi
+    10f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f6:	e8 7f 05 00 00       	call   167a <printf>
+    10fb:	90                   	nop
+    10fc:	eb fd                	jmp    10fb <growstacktest_edgecase+0x1f9>
+  } else {
+    wait();
+    10fe:	e8 26 0b 00 00       	call   1c29 <wait>
+  }
+
+  printf(stdout, "growstacktest_edgecase passed\n");
+    1103:	8b 05 47 19 00 00    	mov    0x1947(%rip),%eax        # 2a50 <stdout>
+    1109:	48 8d 15 18 14 00 00 	lea    0x1418(%rip),%rdx        # 2528 <malloc+0x6b3>
+    1110:	48 89 d6             	mov    %rdx,%rsi
+    1113:	89 c7                	mov    %eax,%edi
+    1115:	b8 00 00 00 00       	mov    $0x0,%eax
+    111a:	e8 5b 05 00 00       	call   167a <printf>
+}
+    111f:	90                   	nop
+    1120:	c9                   	leave
+    1121:	c3                   	ret
+
+0000000000001122 <copyonwriteforktest>:
+
+void copyonwriteforktest() {
+    1122:	55                   	push   %rbp
+    1123:	48 89 e5             	mov    %rsp,%rbp
+    1126:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  struct sys_info info1, info2, info3, info4;
+  int page200 = 200 * 4096;
+    112d:	c7 45 f4 00 80 0c 00 	movl   $0xc8000,-0xc(%rbp)
+  char *a = sbrk(page200);
+    1134:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1137:	89 c7                	mov    %eax,%edi
+    1139:	e8 6b 0b 00 00       	call   1ca9 <sbrk>
+    113e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  char b;
+  int j;
+
+  a[0] = 0;
+    1142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1146:	c6 00 00             	movb   $0x0,(%rax)
+  printf(stdout, "copyonwriteforktest\n");
+    1149:	8b 05 01 19 00 00    	mov    0x1901(%rip),%eax        # 2a50 <stdout>
+    114f:	48 8d 15 f1 13 00 00 	lea    0x13f1(%rip),%rdx        # 2547 <malloc+0x6d2>
+    1156:	48 89 d6             	mov    %rdx,%rsi
+    1159:	89 c7                	mov    %eax,%edi
+    115b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1160:	e8 15 05 00 00       	call   167a <printf>
+  sysinfo(&info1);
+    1165:	48 8d 45 9c          	lea    -0x64(%rbp),%rax
+    1169:	48 89 c7             	mov    %rax,%rdi
+    116c:	e8 50 0b 00 00       	call   1cc1 <sysinfo>
+  printf(stdout, "pages_in_use before copy-on-write fork = %d\n",
+    1171:	8b 55 9c             	mov    -0x64(%rbp),%edx
+    1174:	8b 05 d6 18 00 00    	mov    0x18d6(%rip),%eax        # 2a50 <stdout>
+    117a:	48 8d 0d df 13 00 00 	lea    0x13df(%rip),%rcx        # 2560 <malloc+0x6eb>
+    1181:	48 89 ce             	mov    %rcx,%rsi
+    1184:	89 c7                	mov    %eax,%edi
+    1186:	b8 00 00 00 00       	mov    $0x0,%eax
+    118b:	e8 ea 04 00 00       	call   167a <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before copy-on-write fork = %d\n",
+    1190:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1193:	8b 05 b7 18 00 00    	mov    0x18b7(%rip),%eax        # 2a50 <stdout>
+    1199:	48 8d 0d f0 13 00 00 	lea    0x13f0(%rip),%rcx        # 2590 <malloc+0x71b>
+    11a0:	48 89 ce             	mov    %rcx,%rsi
+    11a3:	89 c7                	mov    %eax,%edi
+    11a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    11aa:	e8 cb 04 00 00       	call   167a <printf>
+         info1.pages_in_swap);
+  int pid = fork();
+    11af:	e8 65 0a 00 00       	call   1c19 <fork>
+    11b4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid == 0) {
+    11b7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    11bb:	75 0f                	jne    11cc <copyonwriteforktest+0xaa>
+    sleep(100);
+    11bd:	bf 64 00 00 00       	mov    $0x64,%edi
+    11c2:	e8 ea 0a 00 00       	call   1cb1 <sleep>
+    exit();
+    11c7:	e8 55 0a 00 00       	call   1c21 <exit>
+  } else {
+    sysinfo(&info2);
+    11cc:	48 8d 85 54 ff ff ff 	lea    -0xac(%rbp),%rax
+    11d3:	48 89 c7             	mov    %rax,%rdi
+    11d6:	e8 e6 0a 00 00       	call   1cc1 <sysinfo>
+    printf(stdout, "pages_in_use after copy-on-write fork = %d\n",
+    11db:	8b 95 54 ff ff ff    	mov    -0xac(%rbp),%edx
+    11e1:	8b 05 69 18 00 00    	mov    0x1869(%rip),%eax        # 2a50 <stdout>
+    11e7:	48 8d 0d d2 13 00 00 	lea    0x13d2(%rip),%rcx        # 25c0 <malloc+0x74b>
+    11ee:	48 89 ce             	mov    %rcx,%rsi
+    11f1:	89 c7                	mov    %eax,%edi
+    11f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11f8:	e8 7d 04 00 00       	call   167a <printf>
+           info2.pages_in_use);
+    printf(stdout, "pages_in_swap after copy-on-write fork = %d\n",
+    11fd:	8b 95 58 ff ff ff    	mov    -0xa8(%rbp),%edx
+    1203:	8b 05 47 18 00 00    	mov    0x1847(%rip),%eax        # 2a50 <stdout>
+    1209:	48 8d 0d e0 13 00 00 	lea    0x13e0(%rip),%rcx        # 25f0 <malloc+0x77b>
+    1210:	48 89 ce             	mov    %rcx,%rsi
+    1213:	89 c7                	mov    %eax,%edi
+    1215:	b8 00 00 00 00       	mov    $0x0,%eax
+    121a:	e8 5b 04 00 00       	call   167a <printf>
+           info2.pages_in_swap);
+
+    // if copy-on-write is implemented, there is no way a new process can take
+    // more than 100 pages
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+    121f:	8b 95 54 ff ff ff    	mov    -0xac(%rbp),%edx
+    1225:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1228:	29 c2                	sub    %eax,%edx
+    122a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    122d:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+    122f:	8b 85 58 ff ff ff    	mov    -0xa8(%rbp),%eax
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+    1235:	29 c2                	sub    %eax,%edx
+    1237:	83 fa 64             	cmp    $0x64,%edx
+    123a:	7e 5c                	jle    1298 <copyonwriteforktest+0x176>
+        100)
+      error("too much memory is used for fork");
+    123c:	8b 05 0e 18 00 00    	mov    0x180e(%rip),%eax        # 2a50 <stdout>
+    1242:	ba 43 01 00 00       	mov    $0x143,%edx
+    1247:	48 8d 0d 60 0d 00 00 	lea    0xd60(%rip),%rcx        # 1fae <malloc+0x139>
+    124e:	48 89 ce             	mov    %rcx,%rsi
+    1251:	89 c7                	mov    %eax,%edi
+    1253:	b8 00 00 00 00       	mov    $0x0,%eax
+    1258:	e8 1d 04 00 00       	call   167a <printf>
+    125d:	8b 05 ed 17 00 00    	mov    0x17ed(%rip),%eax        # 2a50 <stdout>
+    1263:	48 8d 15 b6 13 00 00 	lea    0x13b6(%rip),%rdx        # 2620 <malloc+0x7ab>
+    126a:	48 89 d6             	mov    %rdx,%rsi
+    126d:	89 c7                	mov    %eax,%edi
+    126f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1274:	e8 01 04 00 00       	call   167a <printf>
+    1279:	8b 05 d1 17 00 00    	mov    0x17d1(%rip),%eax        # 2a50 <stdout>
+    127f:	48 8d 15 54 0d 00 00 	lea    0xd54(%rip),%rdx        # 1fda <malloc+0x165>
+    1286:	48 89 d6             	mov    %rdx,%rsi
+    1289:	89 c7                	mov    %eax,%edi
+    128b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1290:	e8 e5 03 00 00       	call   167a <printf>
+    1295:	90                   	nop
+    1296:	eb fd                	jmp    1295 <copyonwriteforktest+0x173>
+
+    for (j = 0; j < 200; j++) {
+    1298:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    129f:	eb 1a                	jmp    12bb <copyonwriteforktest+0x199>
+      b = a[j * 4096];
+    12a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12a4:	c1 e0 0c             	shl    $0xc,%eax
+    12a7:	48 63 d0             	movslq %eax,%rdx
+    12aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ae:	48 01 d0             	add    %rdx,%rax
+    12b1:	0f b6 00             	movzbl (%rax),%eax
+    12b4:	88 45 ff             	mov    %al,-0x1(%rbp)
+    for (j = 0; j < 200; j++) {
+    12b7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    12bb:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    12c2:	7e dd                	jle    12a1 <copyonwriteforktest+0x17f>
+    }
+
+    sysinfo(&info3);
+    12c4:	48 8d 85 0c ff ff ff 	lea    -0xf4(%rbp),%rax
+    12cb:	48 89 c7             	mov    %rax,%rdi
+    12ce:	e8 ee 09 00 00       	call   1cc1 <sysinfo>
+    printf(stdout, "pages_in_use after read = %d\n", info3.pages_in_use);
+    12d3:	8b 95 0c ff ff ff    	mov    -0xf4(%rbp),%edx
+    12d9:	8b 05 71 17 00 00    	mov    0x1771(%rip),%eax        # 2a50 <stdout>
+    12df:	48 8d 0d 5b 13 00 00 	lea    0x135b(%rip),%rcx        # 2641 <malloc+0x7cc>
+    12e6:	48 89 ce             	mov    %rcx,%rsi
+    12e9:	89 c7                	mov    %eax,%edi
+    12eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f0:	e8 85 03 00 00       	call   167a <printf>
+    printf(stdout, "pages_in_swap after read = %d\n", info3.pages_in_swap);
+    12f5:	8b 95 10 ff ff ff    	mov    -0xf0(%rbp),%edx
+    12fb:	8b 05 4f 17 00 00    	mov    0x174f(%rip),%eax        # 2a50 <stdout>
+    1301:	48 8d 0d 58 13 00 00 	lea    0x1358(%rip),%rcx        # 2660 <malloc+0x7eb>
+    1308:	48 89 ce             	mov    %rcx,%rsi
+    130b:	89 c7                	mov    %eax,%edi
+    130d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1312:	e8 63 03 00 00       	call   167a <printf>
+
+    // Read should not increase the amount of memory allocated
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+    1317:	8b 95 0c ff ff ff    	mov    -0xf4(%rbp),%edx
+    131d:	8b 85 54 ff ff ff    	mov    -0xac(%rbp),%eax
+    1323:	29 c2                	sub    %eax,%edx
+    1325:	8b 85 10 ff ff ff    	mov    -0xf0(%rbp),%eax
+    132b:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+    132d:	8b 85 58 ff ff ff    	mov    -0xa8(%rbp),%eax
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+    1333:	29 c2                	sub    %eax,%edx
+    1335:	83 fa 64             	cmp    $0x64,%edx
+    1338:	7e 5c                	jle    1396 <copyonwriteforktest+0x274>
+        100)
+      error("too much memory is used for read");
+    133a:	8b 05 10 17 00 00    	mov    0x1710(%rip),%eax        # 2a50 <stdout>
+    1340:	ba 51 01 00 00       	mov    $0x151,%edx
+    1345:	48 8d 0d 62 0c 00 00 	lea    0xc62(%rip),%rcx        # 1fae <malloc+0x139>
+    134c:	48 89 ce             	mov    %rcx,%rsi
+    134f:	89 c7                	mov    %eax,%edi
+    1351:	b8 00 00 00 00       	mov    $0x0,%eax
+    1356:	e8 1f 03 00 00       	call   167a <printf>
+    135b:	8b 05 ef 16 00 00    	mov    0x16ef(%rip),%eax        # 2a50 <stdout>
+    1361:	48 8d 15 18 13 00 00 	lea    0x1318(%rip),%rdx        # 2680 <malloc+0x80b>
+    1368:	48 89 d6             	mov    %rdx,%rsi
+    136b:	89 c7                	mov    %eax,%edi
+    136d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1372:	e8 03 03 00 00       	call   167a <printf>
+    1377:	8b 05 d3 16 00 00    	mov    0x16d3(%rip),%eax        # 2a50 <stdout>
+    137d:	48 8d 15 56 0c 00 00 	lea    0xc56(%rip),%rdx        # 1fda <malloc+0x165>
+    1384:	48 89 d6             	mov    %rdx,%rsi
+    1387:	89 c7                	mov    %eax,%edi
+    1389:	b8 00 00 00 00       	mov    $0x0,%eax
+    138e:	e8 e7 02 00 00       	call   167a <printf>
+    1393:	90                   	nop
+    1394:	eb fd                	jmp    1393 <copyonwriteforktest+0x271>
+
+    for (j = 0; j < 200; j++) {
+    1396:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    139d:	eb 1a                	jmp    13b9 <copyonwriteforktest+0x297>
+      a[j * 4096] = b;
+    139f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    13a2:	c1 e0 0c             	shl    $0xc,%eax
+    13a5:	48 63 d0             	movslq %eax,%rdx
+    13a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13ac:	48 01 c2             	add    %rax,%rdx
+    13af:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    13b3:	88 02                	mov    %al,(%rdx)
+    for (j = 0; j < 200; j++) {
+    13b5:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    13b9:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    13c0:	7e dd                	jle    139f <copyonwriteforktest+0x27d>
+    }
+
+    sysinfo(&info4);
+    13c2:	48 8d 85 c4 fe ff ff 	lea    -0x13c(%rbp),%rax
+    13c9:	48 89 c7             	mov    %rax,%rdi
+    13cc:	e8 f0 08 00 00       	call   1cc1 <sysinfo>
+    printf(stdout, "pages_in_use after write = %d\n", info4.pages_in_use);
+    13d1:	8b 95 c4 fe ff ff    	mov    -0x13c(%rbp),%edx
+    13d7:	8b 05 73 16 00 00    	mov    0x1673(%rip),%eax        # 2a50 <stdout>
+    13dd:	48 8d 0d c4 12 00 00 	lea    0x12c4(%rip),%rcx        # 26a8 <malloc+0x833>
+    13e4:	48 89 ce             	mov    %rcx,%rsi
+    13e7:	89 c7                	mov    %eax,%edi
+    13e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    13ee:	e8 87 02 00 00       	call   167a <printf>
+    printf(stdout, "pages_in_swap after write = %d\n", info4.pages_in_swap);
+    13f3:	8b 95 c8 fe ff ff    	mov    -0x138(%rbp),%edx
+    13f9:	8b 05 51 16 00 00    	mov    0x1651(%rip),%eax        # 2a50 <stdout>
+    13ff:	48 8d 0d c2 12 00 00 	lea    0x12c2(%rip),%rcx        # 26c8 <malloc+0x853>
+    1406:	48 89 ce             	mov    %rcx,%rsi
+    1409:	89 c7                	mov    %eax,%edi
+    140b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1410:	e8 65 02 00 00       	call   167a <printf>
+
+    // Write should allocate the 200 pages of memory
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    1415:	8b 95 c4 fe ff ff    	mov    -0x13c(%rbp),%edx
+    141b:	8b 85 0c ff ff ff    	mov    -0xf4(%rbp),%eax
+    1421:	29 c2                	sub    %eax,%edx
+    1423:	8b 85 c8 fe ff ff    	mov    -0x138(%rbp),%eax
+    1429:	01 c2                	add    %eax,%edx
+            info3.pages_in_swap <
+    142b:	8b 85 10 ff ff ff    	mov    -0xf0(%rbp),%eax
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    1431:	29 c2                	sub    %eax,%edx
+    1433:	83 fa 63             	cmp    $0x63,%edx
+    1436:	7f 5c                	jg     1494 <copyonwriteforktest+0x372>
+        100)
+      error("too less memory is used for write");
+    1438:	8b 05 12 16 00 00    	mov    0x1612(%rip),%eax        # 2a50 <stdout>
+    143e:	ba 5f 01 00 00       	mov    $0x15f,%edx
+    1443:	48 8d 0d 64 0b 00 00 	lea    0xb64(%rip),%rcx        # 1fae <malloc+0x139>
+    144a:	48 89 ce             	mov    %rcx,%rsi
+    144d:	89 c7                	mov    %eax,%edi
+    144f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1454:	e8 21 02 00 00       	call   167a <printf>
+    1459:	8b 05 f1 15 00 00    	mov    0x15f1(%rip),%eax        # 2a50 <stdout>
+    145f:	48 8d 15 82 12 00 00 	lea    0x1282(%rip),%rdx        # 26e8 <malloc+0x873>
+    1466:	48 89 d6             	mov    %rdx,%rsi
+    1469:	89 c7                	mov    %eax,%edi
+    146b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1470:	e8 05 02 00 00       	call   167a <printf>
+    1475:	8b 05 d5 15 00 00    	mov    0x15d5(%rip),%eax        # 2a50 <stdout>
+    147b:	48 8d 15 58 0b 00 00 	lea    0xb58(%rip),%rdx        # 1fda <malloc+0x165>
+    1482:	48 89 d6             	mov    %rdx,%rsi
+    1485:	89 c7                	mov    %eax,%edi
+    1487:	b8 00 00 00 00       	mov    $0x0,%eax
+    148c:	e8 e9 01 00 00       	call   167a <printf>
+    1491:	90                   	nop
+    1492:	eb fd                	jmp    1491 <copyonwriteforktest+0x36f>
+
+    wait();
+    1494:	e8 90 07 00 00       	call   1c29 <wait>
+  }
+
+  printf(stdout, "copyonwriteforktest passed\n");
+    1499:	8b 05 b1 15 00 00    	mov    0x15b1(%rip),%eax        # 2a50 <stdout>
+    149f:	48 8d 15 64 12 00 00 	lea    0x1264(%rip),%rdx        # 270a <malloc+0x895>
+    14a6:	48 89 d6             	mov    %rdx,%rsi
+    14a9:	89 c7                	mov    %eax,%edi
+    14ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    14b0:	e8 c5 01 00 00       	call   167a <printf>
+}
+    14b5:	90                   	nop
+    14b6:	c9                   	leave
+    14b7:	c3                   	ret
+
+00000000000014b8 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    14b8:	55                   	push   %rbp
+    14b9:	48 89 e5             	mov    %rsp,%rbp
+    14bc:	48 83 ec 10          	sub    $0x10,%rsp
+    14c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    14c3:	89 f0                	mov    %esi,%eax
+    14c5:	88 45 f8             	mov    %al,-0x8(%rbp)
+    14c8:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    14cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14cf:	ba 01 00 00 00       	mov    $0x1,%edx
+    14d4:	48 89 ce             	mov    %rcx,%rsi
+    14d7:	89 c7                	mov    %eax,%edi
+    14d9:	e8 63 07 00 00       	call   1c41 <write>
+    14de:	90                   	nop
+    14df:	c9                   	leave
+    14e0:	c3                   	ret
+
+00000000000014e1 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    14e1:	55                   	push   %rbp
+    14e2:	48 89 e5             	mov    %rsp,%rbp
+    14e5:	48 83 ec 40          	sub    $0x40,%rsp
+    14e9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    14ec:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    14ef:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    14f2:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    14f5:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    14f9:	74 1f                	je     151a <printint64+0x39>
+    14fb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    14fe:	c1 e8 1f             	shr    $0x1f,%eax
+    1501:	0f b6 c0             	movzbl %al,%eax
+    1504:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1507:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    150b:	74 0d                	je     151a <printint64+0x39>
+    x = -xx;
+    150d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1510:	f7 d8                	neg    %eax
+    1512:	48 98                	cltq
+    1514:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1518:	eb 09                	jmp    1523 <printint64+0x42>
+  else
+    x = xx;
+    151a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    151d:	48 98                	cltq
+    151f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1523:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    152a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    152d:	48 63 c8             	movslq %eax,%rcx
+    1530:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1534:	ba 00 00 00 00       	mov    $0x0,%edx
+    1539:	48 f7 f1             	div    %rcx
+    153c:	48 89 d1             	mov    %rdx,%rcx
+    153f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1542:	8d 50 01             	lea    0x1(%rax),%edx
+    1545:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1548:	48 8d 15 11 15 00 00 	lea    0x1511(%rip),%rdx        # 2a60 <digits.1>
+    154f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1553:	48 98                	cltq
+    1555:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1559:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    155c:	48 63 f0             	movslq %eax,%rsi
+    155f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1563:	ba 00 00 00 00       	mov    $0x0,%edx
+    1568:	48 f7 f6             	div    %rsi
+    156b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    156f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1574:	75 b4                	jne    152a <printint64+0x49>
+
+  if (sgn)
+    1576:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    157a:	74 2b                	je     15a7 <printint64+0xc6>
+    buf[i++] = '-';
+    157c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    157f:	8d 50 01             	lea    0x1(%rax),%edx
+    1582:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1585:	48 98                	cltq
+    1587:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    158c:	eb 19                	jmp    15a7 <printint64+0xc6>
+    putc(fd, buf[i]);
+    158e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1591:	48 98                	cltq
+    1593:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1598:	0f be d0             	movsbl %al,%edx
+    159b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    159e:	89 d6                	mov    %edx,%esi
+    15a0:	89 c7                	mov    %eax,%edi
+    15a2:	e8 11 ff ff ff       	call   14b8 <putc>
+  while (--i >= 0)
+    15a7:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    15ab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    15af:	79 dd                	jns    158e <printint64+0xad>
+}
+    15b1:	90                   	nop
+    15b2:	90                   	nop
+    15b3:	c9                   	leave
+    15b4:	c3                   	ret
+
+00000000000015b5 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    15b5:	55                   	push   %rbp
+    15b6:	48 89 e5             	mov    %rsp,%rbp
+    15b9:	48 83 ec 30          	sub    $0x30,%rsp
+    15bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    15c0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    15c3:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    15c6:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    15c9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    15d0:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    15d4:	74 17                	je     15ed <printint+0x38>
+    15d6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    15da:	79 11                	jns    15ed <printint+0x38>
+    neg = 1;
+    15dc:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    15e3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    15e6:	f7 d8                	neg    %eax
+    15e8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    15eb:	eb 06                	jmp    15f3 <printint+0x3e>
+  } else {
+    x = xx;
+    15ed:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    15f0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    15f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    15fa:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    15fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1600:	ba 00 00 00 00       	mov    $0x0,%edx
+    1605:	f7 f1                	div    %ecx
+    1607:	89 d1                	mov    %edx,%ecx
+    1609:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    160c:	8d 50 01             	lea    0x1(%rax),%edx
+    160f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1612:	89 c9                	mov    %ecx,%ecx
+    1614:	48 8d 15 65 14 00 00 	lea    0x1465(%rip),%rdx        # 2a80 <digits.0>
+    161b:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    161f:	48 98                	cltq
+    1621:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1625:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1628:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    162b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1630:	f7 f6                	div    %esi
+    1632:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1635:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1639:	75 bf                	jne    15fa <printint+0x45>
+  if (neg)
+    163b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    163f:	74 2b                	je     166c <printint+0xb7>
+    buf[i++] = '-';
+    1641:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1644:	8d 50 01             	lea    0x1(%rax),%edx
+    1647:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    164a:	48 98                	cltq
+    164c:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1651:	eb 19                	jmp    166c <printint+0xb7>
+    putc(fd, buf[i]);
+    1653:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1656:	48 98                	cltq
+    1658:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    165d:	0f be d0             	movsbl %al,%edx
+    1660:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1663:	89 d6                	mov    %edx,%esi
+    1665:	89 c7                	mov    %eax,%edi
+    1667:	e8 4c fe ff ff       	call   14b8 <putc>
+  while (--i >= 0)
+    166c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1670:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1674:	79 dd                	jns    1653 <printint+0x9e>
+}
+    1676:	90                   	nop
+    1677:	90                   	nop
+    1678:	c9                   	leave
+    1679:	c3                   	ret
+
+000000000000167a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    167a:	55                   	push   %rbp
+    167b:	48 89 e5             	mov    %rsp,%rbp
+    167e:	48 83 ec 70          	sub    $0x70,%rsp
+    1682:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1685:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1689:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    168d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1691:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1695:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1699:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    16a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    16a4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    16a8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    16ac:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    16b0:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    16b7:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    16be:	e9 6b 02 00 00       	jmp    192e <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    16c3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    16c6:	48 63 d0             	movslq %eax,%rdx
+    16c9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    16cd:	48 01 d0             	add    %rdx,%rax
+    16d0:	0f b6 00             	movzbl (%rax),%eax
+    16d3:	0f be c0             	movsbl %al,%eax
+    16d6:	25 ff 00 00 00       	and    $0xff,%eax
+    16db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    16de:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    16e2:	75 30                	jne    1714 <printf+0x9a>
+      if (c == '%') {
+    16e4:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    16e8:	75 13                	jne    16fd <printf+0x83>
+        state = '%';
+    16ea:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    16f1:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    16f8:	e9 2d 02 00 00       	jmp    192a <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    16fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1700:	0f be d0             	movsbl %al,%edx
+    1703:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1706:	89 d6                	mov    %edx,%esi
+    1708:	89 c7                	mov    %eax,%edi
+    170a:	e8 a9 fd ff ff       	call   14b8 <putc>
+    170f:	e9 16 02 00 00       	jmp    192a <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    1714:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1718:	0f 85 0c 02 00 00    	jne    192a <printf+0x2b0>
+      if (c == 'l') {
+    171e:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1722:	75 0c                	jne    1730 <printf+0xb6>
+        lflag = 1;
+    1724:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    172b:	e9 fa 01 00 00       	jmp    192a <printf+0x2b0>
+      } else if (c == 'd') {
+    1730:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1734:	0f 85 95 00 00 00    	jne    17cf <printf+0x155>
+        if (lflag == 1)
+    173a:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    173e:	75 49                	jne    1789 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1740:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1743:	83 f8 2f             	cmp    $0x2f,%eax
+    1746:	77 17                	ja     175f <printf+0xe5>
+    1748:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    174c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    174f:	89 d2                	mov    %edx,%edx
+    1751:	48 01 d0             	add    %rdx,%rax
+    1754:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1757:	83 c2 08             	add    $0x8,%edx
+    175a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    175d:	eb 0c                	jmp    176b <printf+0xf1>
+    175f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1763:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1767:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    176b:	48 8b 00             	mov    (%rax),%rax
+    176e:	89 c6                	mov    %eax,%esi
+    1770:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1773:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1778:	ba 0a 00 00 00       	mov    $0xa,%edx
+    177d:	89 c7                	mov    %eax,%edi
+    177f:	e8 5d fd ff ff       	call   14e1 <printint64>
+    1784:	e9 9a 01 00 00       	jmp    1923 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1789:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    178c:	83 f8 2f             	cmp    $0x2f,%eax
+    178f:	77 17                	ja     17a8 <printf+0x12e>
+    1791:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1795:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1798:	89 d2                	mov    %edx,%edx
+    179a:	48 01 d0             	add    %rdx,%rax
+    179d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17a0:	83 c2 08             	add    $0x8,%edx
+    17a3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    17a6:	eb 0c                	jmp    17b4 <printf+0x13a>
+    17a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    17ac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    17b0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    17b4:	8b 30                	mov    (%rax),%esi
+    17b6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    17b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+    17be:	ba 0a 00 00 00       	mov    $0xa,%edx
+    17c3:	89 c7                	mov    %eax,%edi
+    17c5:	e8 eb fd ff ff       	call   15b5 <printint>
+    17ca:	e9 54 01 00 00       	jmp    1923 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    17cf:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    17d3:	74 0a                	je     17df <printf+0x165>
+    17d5:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    17d9:	0f 85 95 00 00 00    	jne    1874 <printf+0x1fa>
+        if (lflag == 1)
+    17df:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    17e3:	75 49                	jne    182e <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    17e5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    17e8:	83 f8 2f             	cmp    $0x2f,%eax
+    17eb:	77 17                	ja     1804 <printf+0x18a>
+    17ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    17f1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17f4:	89 d2                	mov    %edx,%edx
+    17f6:	48 01 d0             	add    %rdx,%rax
+    17f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17fc:	83 c2 08             	add    $0x8,%edx
+    17ff:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1802:	eb 0c                	jmp    1810 <printf+0x196>
+    1804:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1808:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    180c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1810:	48 8b 00             	mov    (%rax),%rax
+    1813:	89 c6                	mov    %eax,%esi
+    1815:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1818:	b9 00 00 00 00       	mov    $0x0,%ecx
+    181d:	ba 10 00 00 00       	mov    $0x10,%edx
+    1822:	89 c7                	mov    %eax,%edi
+    1824:	e8 b8 fc ff ff       	call   14e1 <printint64>
+        if (lflag == 1)
+    1829:	e9 f5 00 00 00       	jmp    1923 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    182e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1831:	83 f8 2f             	cmp    $0x2f,%eax
+    1834:	77 17                	ja     184d <printf+0x1d3>
+    1836:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    183a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    183d:	89 d2                	mov    %edx,%edx
+    183f:	48 01 d0             	add    %rdx,%rax
+    1842:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1845:	83 c2 08             	add    $0x8,%edx
+    1848:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    184b:	eb 0c                	jmp    1859 <printf+0x1df>
+    184d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1851:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1855:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1859:	8b 30                	mov    (%rax),%esi
+    185b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    185e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1863:	ba 10 00 00 00       	mov    $0x10,%edx
+    1868:	89 c7                	mov    %eax,%edi
+    186a:	e8 46 fd ff ff       	call   15b5 <printint>
+        if (lflag == 1)
+    186f:	e9 af 00 00 00       	jmp    1923 <printf+0x2a9>
+      } else if (c == 's') {
+    1874:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1878:	75 6e                	jne    18e8 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    187a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    187d:	83 f8 2f             	cmp    $0x2f,%eax
+    1880:	77 17                	ja     1899 <printf+0x21f>
+    1882:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1886:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1889:	89 d2                	mov    %edx,%edx
+    188b:	48 01 d0             	add    %rdx,%rax
+    188e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1891:	83 c2 08             	add    $0x8,%edx
+    1894:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1897:	eb 0c                	jmp    18a5 <printf+0x22b>
+    1899:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    189d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    18a1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    18a5:	48 8b 00             	mov    (%rax),%rax
+    18a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    18ac:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    18b1:	75 28                	jne    18db <printf+0x261>
+          s = "(null)";
+    18b3:	48 8d 05 6c 0e 00 00 	lea    0xe6c(%rip),%rax        # 2726 <malloc+0x8b1>
+    18ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    18be:	eb 1b                	jmp    18db <printf+0x261>
+          putc(fd, *s);
+    18c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    18c4:	0f b6 00             	movzbl (%rax),%eax
+    18c7:	0f be d0             	movsbl %al,%edx
+    18ca:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    18cd:	89 d6                	mov    %edx,%esi
+    18cf:	89 c7                	mov    %eax,%edi
+    18d1:	e8 e2 fb ff ff       	call   14b8 <putc>
+        for (; *s; s++)
+    18d6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    18db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    18df:	0f b6 00             	movzbl (%rax),%eax
+    18e2:	84 c0                	test   %al,%al
+    18e4:	75 da                	jne    18c0 <printf+0x246>
+    18e6:	eb 3b                	jmp    1923 <printf+0x2a9>
+      } else if (c == '%') {
+    18e8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    18ec:	75 14                	jne    1902 <printf+0x288>
+        putc(fd, c);
+    18ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    18f1:	0f be d0             	movsbl %al,%edx
+    18f4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    18f7:	89 d6                	mov    %edx,%esi
+    18f9:	89 c7                	mov    %eax,%edi
+    18fb:	e8 b8 fb ff ff       	call   14b8 <putc>
+    1900:	eb 21                	jmp    1923 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1902:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1905:	be 25 00 00 00       	mov    $0x25,%esi
+    190a:	89 c7                	mov    %eax,%edi
+    190c:	e8 a7 fb ff ff       	call   14b8 <putc>
+        putc(fd, c);
+    1911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1914:	0f be d0             	movsbl %al,%edx
+    1917:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    191a:	89 d6                	mov    %edx,%esi
+    191c:	89 c7                	mov    %eax,%edi
+    191e:	e8 95 fb ff ff       	call   14b8 <putc>
+      }
+      state = 0;
+    1923:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    192a:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    192e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1931:	48 63 d0             	movslq %eax,%rdx
+    1934:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1938:	48 01 d0             	add    %rdx,%rax
+    193b:	0f b6 00             	movzbl (%rax),%eax
+    193e:	84 c0                	test   %al,%al
+    1940:	0f 85 7d fd ff ff    	jne    16c3 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1946:	90                   	nop
+    1947:	90                   	nop
+    1948:	c9                   	leave
+    1949:	c3                   	ret
+
+000000000000194a <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+    194a:	55                   	push   %rbp
+    194b:	48 89 e5             	mov    %rsp,%rbp
+    194e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1952:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1955:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+    1958:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    195c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    195f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1962:	48 89 ce             	mov    %rcx,%rsi
+    1965:	48 89 f7             	mov    %rsi,%rdi
+    1968:	89 d1                	mov    %edx,%ecx
+    196a:	fc                   	cld
+    196b:	f3 aa                	rep stos %al,%es:(%rdi)
+    196d:	89 ca                	mov    %ecx,%edx
+    196f:	48 89 fe             	mov    %rdi,%rsi
+    1972:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1976:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+    1979:	90                   	nop
+    197a:	5d                   	pop    %rbp
+    197b:	c3                   	ret
+
+000000000000197c <strcpy>:
+char *strcpy(char *s, char *t) {
+    197c:	55                   	push   %rbp
+    197d:	48 89 e5             	mov    %rsp,%rbp
+    1980:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1984:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1988:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    198c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1990:	90                   	nop
+    1991:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1995:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1999:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    199d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19a1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    19a5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    19a9:	0f b6 12             	movzbl (%rdx),%edx
+    19ac:	88 10                	mov    %dl,(%rax)
+    19ae:	0f b6 00             	movzbl (%rax),%eax
+    19b1:	84 c0                	test   %al,%al
+    19b3:	75 dc                	jne    1991 <strcpy+0x15>
+  return os;
+    19b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    19b9:	5d                   	pop    %rbp
+    19ba:	c3                   	ret
+
+00000000000019bb <strcmp>:
+int strcmp(const char *p, const char *q) {
+    19bb:	55                   	push   %rbp
+    19bc:	48 89 e5             	mov    %rsp,%rbp
+    19bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    19c7:	eb 0a                	jmp    19d3 <strcmp+0x18>
+    p++, q++;
+    19c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    19ce:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    19d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d7:	0f b6 00             	movzbl (%rax),%eax
+    19da:	84 c0                	test   %al,%al
+    19dc:	74 12                	je     19f0 <strcmp+0x35>
+    19de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e2:	0f b6 10             	movzbl (%rax),%edx
+    19e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19e9:	0f b6 00             	movzbl (%rax),%eax
+    19ec:	38 c2                	cmp    %al,%dl
+    19ee:	74 d9                	je     19c9 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    19f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19f4:	0f b6 00             	movzbl (%rax),%eax
+    19f7:	0f b6 d0             	movzbl %al,%edx
+    19fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19fe:	0f b6 00             	movzbl (%rax),%eax
+    1a01:	0f b6 c0             	movzbl %al,%eax
+    1a04:	29 c2                	sub    %eax,%edx
+    1a06:	89 d0                	mov    %edx,%eax
+}
+    1a08:	5d                   	pop    %rbp
+    1a09:	c3                   	ret
+
+0000000000001a0a <strlen>:
+uint strlen(char *s) {
+    1a0a:	55                   	push   %rbp
+    1a0b:	48 89 e5             	mov    %rsp,%rbp
+    1a0e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1a12:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a19:	eb 04                	jmp    1a1f <strlen+0x15>
+    1a1b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a22:	48 63 d0             	movslq %eax,%rdx
+    1a25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a29:	48 01 d0             	add    %rdx,%rax
+    1a2c:	0f b6 00             	movzbl (%rax),%eax
+    1a2f:	84 c0                	test   %al,%al
+    1a31:	75 e8                	jne    1a1b <strlen+0x11>
+  return n;
+    1a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1a36:	5d                   	pop    %rbp
+    1a37:	c3                   	ret
+
+0000000000001a38 <memset>:
+void *memset(void *dst, int c, uint n) {
+    1a38:	55                   	push   %rbp
+    1a39:	48 89 e5             	mov    %rsp,%rbp
+    1a3c:	48 83 ec 10          	sub    $0x10,%rsp
+    1a40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a44:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1a47:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1a4a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1a4d:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1a50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a54:	89 ce                	mov    %ecx,%esi
+    1a56:	48 89 c7             	mov    %rax,%rdi
+    1a59:	e8 ec fe ff ff       	call   194a <stosb>
+  return dst;
+    1a5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a62:	c9                   	leave
+    1a63:	c3                   	ret
+
+0000000000001a64 <strchr>:
+char *strchr(const char *s, char c) {
+    1a64:	55                   	push   %rbp
+    1a65:	48 89 e5             	mov    %rsp,%rbp
+    1a68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a6c:	89 f0                	mov    %esi,%eax
+    1a6e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1a71:	eb 17                	jmp    1a8a <strchr+0x26>
+    if (*s == c)
+    1a73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a77:	0f b6 00             	movzbl (%rax),%eax
+    1a7a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1a7d:	75 06                	jne    1a85 <strchr+0x21>
+      return (char *)s;
+    1a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a83:	eb 15                	jmp    1a9a <strchr+0x36>
+  for (; *s; s++)
+    1a85:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a8e:	0f b6 00             	movzbl (%rax),%eax
+    1a91:	84 c0                	test   %al,%al
+    1a93:	75 de                	jne    1a73 <strchr+0xf>
+  return 0;
+    1a95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a9a:	5d                   	pop    %rbp
+    1a9b:	c3                   	ret
+
+0000000000001a9c <gets>:
+char *gets(char *buf, int max) {
+    1a9c:	55                   	push   %rbp
+    1a9d:	48 89 e5             	mov    %rsp,%rbp
+    1aa0:	48 83 ec 20          	sub    $0x20,%rsp
+    1aa4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1aa8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    1aab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ab2:	eb 48                	jmp    1afc <gets+0x60>
+    cc = read(0, &c, 1);
+    1ab4:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1ab8:	ba 01 00 00 00       	mov    $0x1,%edx
+    1abd:	48 89 c6             	mov    %rax,%rsi
+    1ac0:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ac5:	e8 6f 01 00 00       	call   1c39 <read>
+    1aca:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1acd:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1ad1:	7e 36                	jle    1b09 <gets+0x6d>
+    buf[i++] = c;
+    1ad3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ad6:	8d 50 01             	lea    0x1(%rax),%edx
+    1ad9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1adc:	48 63 d0             	movslq %eax,%rdx
+    1adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae3:	48 01 c2             	add    %rax,%rdx
+    1ae6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1aea:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1aec:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1af0:	3c 0a                	cmp    $0xa,%al
+    1af2:	74 16                	je     1b0a <gets+0x6e>
+    1af4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1af8:	3c 0d                	cmp    $0xd,%al
+    1afa:	74 0e                	je     1b0a <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1afc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aff:	83 c0 01             	add    $0x1,%eax
+    1b02:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1b05:	7f ad                	jg     1ab4 <gets+0x18>
+    1b07:	eb 01                	jmp    1b0a <gets+0x6e>
+      break;
+    1b09:	90                   	nop
+  }
+  buf[i] = '\0';
+    1b0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b0d:	48 63 d0             	movslq %eax,%rdx
+    1b10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b14:	48 01 d0             	add    %rdx,%rax
+    1b17:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1b1e:	c9                   	leave
+    1b1f:	c3                   	ret
+
+0000000000001b20 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1b20:	55                   	push   %rbp
+    1b21:	48 89 e5             	mov    %rsp,%rbp
+    1b24:	48 83 ec 20          	sub    $0x20,%rsp
+    1b28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b2c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1b30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b34:	be 00 00 00 00       	mov    $0x0,%esi
+    1b39:	48 89 c7             	mov    %rax,%rdi
+    1b3c:	e8 20 01 00 00       	call   1c61 <open>
+    1b41:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    1b44:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1b48:	79 07                	jns    1b51 <stat+0x31>
+    return -1;
+    1b4a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b4f:	eb 21                	jmp    1b72 <stat+0x52>
+  r = fstat(fd, st);
+    1b51:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1b55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b58:	48 89 d6             	mov    %rdx,%rsi
+    1b5b:	89 c7                	mov    %eax,%edi
+    1b5d:	e8 17 01 00 00       	call   1c79 <fstat>
+    1b62:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1b65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b68:	89 c7                	mov    %eax,%edi
+    1b6a:	e8 da 00 00 00       	call   1c49 <close>
+  return r;
+    1b6f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1b72:	c9                   	leave
+    1b73:	c3                   	ret
+
+0000000000001b74 <atoi>:
+
+int atoi(const char *s) {
+    1b74:	55                   	push   %rbp
+    1b75:	48 89 e5             	mov    %rsp,%rbp
+    1b78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1b7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1b83:	eb 28                	jmp    1bad <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1b85:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b88:	89 d0                	mov    %edx,%eax
+    1b8a:	c1 e0 02             	shl    $0x2,%eax
+    1b8d:	01 d0                	add    %edx,%eax
+    1b8f:	01 c0                	add    %eax,%eax
+    1b91:	89 c1                	mov    %eax,%ecx
+    1b93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b97:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1b9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1b9f:	0f b6 00             	movzbl (%rax),%eax
+    1ba2:	0f be c0             	movsbl %al,%eax
+    1ba5:	01 c8                	add    %ecx,%eax
+    1ba7:	83 e8 30             	sub    $0x30,%eax
+    1baa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb1:	0f b6 00             	movzbl (%rax),%eax
+    1bb4:	3c 2f                	cmp    $0x2f,%al
+    1bb6:	7e 0b                	jle    1bc3 <atoi+0x4f>
+    1bb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bbc:	0f b6 00             	movzbl (%rax),%eax
+    1bbf:	3c 39                	cmp    $0x39,%al
+    1bc1:	7e c2                	jle    1b85 <atoi+0x11>
+  return n;
+    1bc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1bc6:	5d                   	pop    %rbp
+    1bc7:	c3                   	ret
+
+0000000000001bc8 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1bc8:	55                   	push   %rbp
+    1bc9:	48 89 e5             	mov    %rsp,%rbp
+    1bcc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bd0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1bd4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1bd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bdb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1bdf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1be3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    1be7:	eb 1d                	jmp    1c06 <memmove+0x3e>
+    *dst++ = *src++;
+    1be9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1bed:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1bf1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1bfd:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1c01:	0f b6 12             	movzbl (%rdx),%edx
+    1c04:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    1c06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c09:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1c0c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1c0f:	85 c0                	test   %eax,%eax
+    1c11:	7f d6                	jg     1be9 <memmove+0x21>
+  return vdst;
+    1c13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c17:	5d                   	pop    %rbp
+    1c18:	c3                   	ret
+
+0000000000001c19 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    1c19:	b8 01 00 00 00       	mov    $0x1,%eax
+    1c1e:	cd 40                	int    $0x40
+    1c20:	c3                   	ret
+
+0000000000001c21 <exit>:
+SYSCALL(exit)
+    1c21:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c26:	cd 40                	int    $0x40
+    1c28:	c3                   	ret
+
+0000000000001c29 <wait>:
+SYSCALL(wait)
+    1c29:	b8 03 00 00 00       	mov    $0x3,%eax
+    1c2e:	cd 40                	int    $0x40
+    1c30:	c3                   	ret
+
+0000000000001c31 <pipe>:
+SYSCALL(pipe)
+    1c31:	b8 04 00 00 00       	mov    $0x4,%eax
+    1c36:	cd 40                	int    $0x40
+    1c38:	c3                   	ret
+
+0000000000001c39 <read>:
+SYSCALL(read)
+    1c39:	b8 05 00 00 00       	mov    $0x5,%eax
+    1c3e:	cd 40                	int    $0x40
+    1c40:	c3                   	ret
+
+0000000000001c41 <write>:
+SYSCALL(write)
+    1c41:	b8 10 00 00 00       	mov    $0x10,%eax
+    1c46:	cd 40                	int    $0x40
+    1c48:	c3                   	ret
+
+0000000000001c49 <close>:
+SYSCALL(close)
+    1c49:	b8 15 00 00 00       	mov    $0x15,%eax
+    1c4e:	cd 40                	int    $0x40
+    1c50:	c3                   	ret
+
+0000000000001c51 <kill>:
+SYSCALL(kill)
+    1c51:	b8 06 00 00 00       	mov    $0x6,%eax
+    1c56:	cd 40                	int    $0x40
+    1c58:	c3                   	ret
+
+0000000000001c59 <exec>:
+SYSCALL(exec)
+    1c59:	b8 07 00 00 00       	mov    $0x7,%eax
+    1c5e:	cd 40                	int    $0x40
+    1c60:	c3                   	ret
+
+0000000000001c61 <open>:
+SYSCALL(open)
+    1c61:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1c66:	cd 40                	int    $0x40
+    1c68:	c3                   	ret
+
+0000000000001c69 <mknod>:
+SYSCALL(mknod)
+    1c69:	b8 11 00 00 00       	mov    $0x11,%eax
+    1c6e:	cd 40                	int    $0x40
+    1c70:	c3                   	ret
+
+0000000000001c71 <unlink>:
+SYSCALL(unlink)
+    1c71:	b8 12 00 00 00       	mov    $0x12,%eax
+    1c76:	cd 40                	int    $0x40
+    1c78:	c3                   	ret
+
+0000000000001c79 <fstat>:
+SYSCALL(fstat)
+    1c79:	b8 08 00 00 00       	mov    $0x8,%eax
+    1c7e:	cd 40                	int    $0x40
+    1c80:	c3                   	ret
+
+0000000000001c81 <link>:
+SYSCALL(link)
+    1c81:	b8 13 00 00 00       	mov    $0x13,%eax
+    1c86:	cd 40                	int    $0x40
+    1c88:	c3                   	ret
+
+0000000000001c89 <mkdir>:
+SYSCALL(mkdir)
+    1c89:	b8 14 00 00 00       	mov    $0x14,%eax
+    1c8e:	cd 40                	int    $0x40
+    1c90:	c3                   	ret
+
+0000000000001c91 <chdir>:
+SYSCALL(chdir)
+    1c91:	b8 09 00 00 00       	mov    $0x9,%eax
+    1c96:	cd 40                	int    $0x40
+    1c98:	c3                   	ret
+
+0000000000001c99 <dup>:
+SYSCALL(dup)
+    1c99:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1c9e:	cd 40                	int    $0x40
+    1ca0:	c3                   	ret
+
+0000000000001ca1 <getpid>:
+SYSCALL(getpid)
+    1ca1:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1ca6:	cd 40                	int    $0x40
+    1ca8:	c3                   	ret
+
+0000000000001ca9 <sbrk>:
+SYSCALL(sbrk)
+    1ca9:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1cae:	cd 40                	int    $0x40
+    1cb0:	c3                   	ret
+
+0000000000001cb1 <sleep>:
+SYSCALL(sleep)
+    1cb1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1cb6:	cd 40                	int    $0x40
+    1cb8:	c3                   	ret
+
+0000000000001cb9 <uptime>:
+SYSCALL(uptime)
+    1cb9:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1cbe:	cd 40                	int    $0x40
+    1cc0:	c3                   	ret
+
+0000000000001cc1 <sysinfo>:
+SYSCALL(sysinfo)
+    1cc1:	b8 16 00 00 00       	mov    $0x16,%eax
+    1cc6:	cd 40                	int    $0x40
+    1cc8:	c3                   	ret
+
+0000000000001cc9 <crashn>:
+SYSCALL(crashn)
+    1cc9:	b8 17 00 00 00       	mov    $0x17,%eax
+    1cce:	cd 40                	int    $0x40
+    1cd0:	c3                   	ret
+
+0000000000001cd1 <mmap>:
+SYSCALL(mmap)
+    1cd1:	b8 18 00 00 00       	mov    $0x18,%eax
+    1cd6:	cd 40                	int    $0x40
+    1cd8:	c3                   	ret
+
+0000000000001cd9 <munmap>:
+SYSCALL(munmap)
+    1cd9:	b8 19 00 00 00       	mov    $0x19,%eax
+    1cde:	cd 40                	int    $0x40
+    1ce0:	c3                   	ret
+
+0000000000001ce1 <preface>:
+.globl preface
+preface:
+    call main
+    1ce1:	e8 1a e3 ff ff       	call   0 <main>
+    mov %rax, %rdi
+    1ce6:	48 89 c7             	mov    %rax,%rdi
+    call exit
+    1ce9:	e8 33 ff ff ff       	call   1c21 <exit>
+
+0000000000001cee <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    1cee:	55                   	push   %rbp
+    1cef:	48 89 e5             	mov    %rsp,%rbp
+    1cf2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    1cf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cfa:	48 83 e8 10          	sub    $0x10,%rax
+    1cfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d02:	48 8b 05 a7 0d 00 00 	mov    0xda7(%rip),%rax        # 2ab0 <freep>
+    1d09:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d0d:	eb 2f                	jmp    1d3e <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1d0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d13:	48 8b 00             	mov    (%rax),%rax
+    1d16:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d1a:	72 17                	jb     1d33 <free+0x45>
+    1d1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d20:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d24:	72 2f                	jb     1d55 <free+0x67>
+    1d26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d2a:	48 8b 00             	mov    (%rax),%rax
+    1d2d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d31:	72 22                	jb     1d55 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d37:	48 8b 00             	mov    (%rax),%rax
+    1d3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d42:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d46:	73 c7                	jae    1d0f <free+0x21>
+    1d48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d4c:	48 8b 00             	mov    (%rax),%rax
+    1d4f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d53:	73 ba                	jae    1d0f <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    1d55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d59:	8b 40 08             	mov    0x8(%rax),%eax
+    1d5c:	89 c0                	mov    %eax,%eax
+    1d5e:	48 c1 e0 04          	shl    $0x4,%rax
+    1d62:	48 89 c2             	mov    %rax,%rdx
+    1d65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d69:	48 01 c2             	add    %rax,%rdx
+    1d6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d70:	48 8b 00             	mov    (%rax),%rax
+    1d73:	48 39 c2             	cmp    %rax,%rdx
+    1d76:	75 2d                	jne    1da5 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    1d78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d7c:	8b 50 08             	mov    0x8(%rax),%edx
+    1d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d83:	48 8b 00             	mov    (%rax),%rax
+    1d86:	8b 40 08             	mov    0x8(%rax),%eax
+    1d89:	01 c2                	add    %eax,%edx
+    1d8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d8f:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1d92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d96:	48 8b 00             	mov    (%rax),%rax
+    1d99:	48 8b 10             	mov    (%rax),%rdx
+    1d9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1da0:	48 89 10             	mov    %rdx,(%rax)
+    1da3:	eb 0e                	jmp    1db3 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1da5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da9:	48 8b 10             	mov    (%rax),%rdx
+    1dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db0:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    1db3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1db7:	8b 40 08             	mov    0x8(%rax),%eax
+    1dba:	89 c0                	mov    %eax,%eax
+    1dbc:	48 c1 e0 04          	shl    $0x4,%rax
+    1dc0:	48 89 c2             	mov    %rax,%rdx
+    1dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dc7:	48 01 d0             	add    %rdx,%rax
+    1dca:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1dce:	75 27                	jne    1df7 <free+0x109>
+    p->s.size += bp->s.size;
+    1dd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd4:	8b 50 08             	mov    0x8(%rax),%edx
+    1dd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ddb:	8b 40 08             	mov    0x8(%rax),%eax
+    1dde:	01 c2                	add    %eax,%edx
+    1de0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de4:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1deb:	48 8b 10             	mov    (%rax),%rdx
+    1dee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1df2:	48 89 10             	mov    %rdx,(%rax)
+    1df5:	eb 0b                	jmp    1e02 <free+0x114>
+  } else
+    p->s.ptr = bp;
+    1df7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dfb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1dff:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1e02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e06:	48 89 05 a3 0c 00 00 	mov    %rax,0xca3(%rip)        # 2ab0 <freep>
+}
+    1e0d:	90                   	nop
+    1e0e:	5d                   	pop    %rbp
+    1e0f:	c3                   	ret
+
+0000000000001e10 <morecore>:
+
+static Header *morecore(uint nu) {
+    1e10:	55                   	push   %rbp
+    1e11:	48 89 e5             	mov    %rsp,%rbp
+    1e14:	48 83 ec 20          	sub    $0x20,%rsp
+    1e18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    1e1b:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1e22:	77 07                	ja     1e2b <morecore+0x1b>
+    nu = 4096;
+    1e24:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1e2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e2e:	c1 e0 04             	shl    $0x4,%eax
+    1e31:	89 c7                	mov    %eax,%edi
+    1e33:	e8 71 fe ff ff       	call   1ca9 <sbrk>
+    1e38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    1e3c:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1e41:	75 07                	jne    1e4a <morecore+0x3a>
+    return 0;
+    1e43:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e48:	eb 29                	jmp    1e73 <morecore+0x63>
+  hp = (Header *)p;
+    1e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e4e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1e52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e56:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1e59:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    1e5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e60:	48 83 c0 10          	add    $0x10,%rax
+    1e64:	48 89 c7             	mov    %rax,%rdi
+    1e67:	e8 82 fe ff ff       	call   1cee <free>
+  return freep;
+    1e6c:	48 8b 05 3d 0c 00 00 	mov    0xc3d(%rip),%rax        # 2ab0 <freep>
+}
+    1e73:	c9                   	leave
+    1e74:	c3                   	ret
+
+0000000000001e75 <malloc>:
+
+void *malloc(uint nbytes) {
+    1e75:	55                   	push   %rbp
+    1e76:	48 89 e5             	mov    %rsp,%rbp
+    1e79:	48 83 ec 30          	sub    $0x30,%rsp
+    1e7d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    1e80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e83:	48 83 c0 0f          	add    $0xf,%rax
+    1e87:	48 c1 e8 04          	shr    $0x4,%rax
+    1e8b:	83 c0 01             	add    $0x1,%eax
+    1e8e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    1e91:	48 8b 05 18 0c 00 00 	mov    0xc18(%rip),%rax        # 2ab0 <freep>
+    1e98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e9c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ea1:	75 2e                	jne    1ed1 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    1ea3:	48 8d 05 f6 0b 00 00 	lea    0xbf6(%rip),%rax        # 2aa0 <base>
+    1eaa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1eae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb2:	48 89 05 f7 0b 00 00 	mov    %rax,0xbf7(%rip)        # 2ab0 <freep>
+    1eb9:	48 8b 05 f0 0b 00 00 	mov    0xbf0(%rip),%rax        # 2ab0 <freep>
+    1ec0:	48 89 05 d9 0b 00 00 	mov    %rax,0xbd9(%rip)        # 2aa0 <base>
+    base.s.size = 0;
+    1ec7:	c7 05 d7 0b 00 00 00 	movl   $0x0,0xbd7(%rip)        # 2aa8 <base+0x8>
+    1ece:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1ed1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ed5:	48 8b 00             	mov    (%rax),%rax
+    1ed8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee0:	8b 40 08             	mov    0x8(%rax),%eax
+    1ee3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1ee6:	72 5f                	jb     1f47 <malloc+0xd2>
+      if (p->s.size == nunits)
+    1ee8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eec:	8b 40 08             	mov    0x8(%rax),%eax
+    1eef:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1ef2:	75 10                	jne    1f04 <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    1ef4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef8:	48 8b 10             	mov    (%rax),%rdx
+    1efb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eff:	48 89 10             	mov    %rdx,(%rax)
+    1f02:	eb 2e                	jmp    1f32 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    1f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f08:	8b 40 08             	mov    0x8(%rax),%eax
+    1f0b:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1f0e:	89 c2                	mov    %eax,%edx
+    1f10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f14:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1f17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1b:	8b 40 08             	mov    0x8(%rax),%eax
+    1f1e:	89 c0                	mov    %eax,%eax
+    1f20:	48 c1 e0 04          	shl    $0x4,%rax
+    1f24:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f2c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1f2f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1f32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f36:	48 89 05 73 0b 00 00 	mov    %rax,0xb73(%rip)        # 2ab0 <freep>
+      return (void *)(p + 1);
+    1f3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f41:	48 83 c0 10          	add    $0x10,%rax
+    1f45:	eb 41                	jmp    1f88 <malloc+0x113>
+    }
+    if (p == freep)
+    1f47:	48 8b 05 62 0b 00 00 	mov    0xb62(%rip),%rax        # 2ab0 <freep>
+    1f4e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f52:	75 1c                	jne    1f70 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    1f54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f57:	89 c7                	mov    %eax,%edi
+    1f59:	e8 b2 fe ff ff       	call   1e10 <morecore>
+    1f5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f62:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1f67:	75 07                	jne    1f70 <malloc+0xfb>
+        return 0;
+    1f69:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f6e:	eb 18                	jmp    1f88 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f7c:	48 8b 00             	mov    (%rax),%rax
+    1f7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1f83:	e9 54 ff ff ff       	jmp    1edc <malloc+0x67>
+  }
+    1f88:	c9                   	leave
+    1f89:	c3                   	ret
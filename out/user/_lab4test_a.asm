@@ -0,0 +1,3559 @@
+
+out/user/_lab4test_a:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <overwrite>:
+      while (1)                                                                \
+        ;                                                                      \
+    }                                                                          \
+  } while (0)
+
+void overwrite(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  printf(stdout, "overwrite...\n");
+       8:	8b 05 42 37 00 00    	mov    0x3742(%rip),%eax        # 3750 <stdout>
+       e:	48 8d 15 a3 2b 00 00 	lea    0x2ba3(%rip),%rdx        # 2bb8 <malloc+0x118>
+      15:	48 89 d6             	mov    %rdx,%rsi
+      18:	89 c7                	mov    %eax,%edi
+      1a:	b8 00 00 00 00       	mov    $0x0,%eax
+      1f:	e8 81 22 00 00       	call   22a5 <printf>
+  strcpy(buf, "lab5 is the last 451 lab\n");
+      24:	48 8d 05 9b 2b 00 00 	lea    0x2b9b(%rip),%rax        # 2bc6 <malloc+0x126>
+      2b:	48 89 c6             	mov    %rax,%rsi
+      2e:	48 8d 05 6b 37 00 00 	lea    0x376b(%rip),%rax        # 37a0 <buf>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 6a 25 00 00       	call   25a7 <strcpy>
+  fd = open("small.txt", O_RDWR);
+      3d:	be 02 00 00 00       	mov    $0x2,%esi
+      42:	48 8d 05 97 2b 00 00 	lea    0x2b97(%rip),%rax        # 2be0 <malloc+0x140>
+      49:	48 89 c7             	mov    %rax,%rdi
+      4c:	e8 3b 28 00 00       	call   288c <open>
+      51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      58:	79 5e                	jns    b8 <overwrite+0xb8>
+    error("Could not open small.txt with RW permissions");
+      5a:	8b 05 f0 36 00 00    	mov    0x36f0(%rip),%eax        # 3750 <stdout>
+      60:	ba 28 00 00 00       	mov    $0x28,%edx
+      65:	48 8d 0d 7e 2b 00 00 	lea    0x2b7e(%rip),%rcx        # 2bea <malloc+0x14a>
+      6c:	48 89 ce             	mov    %rcx,%rsi
+      6f:	89 c7                	mov    %eax,%edi
+      71:	b8 00 00 00 00       	mov    $0x0,%eax
+      76:	e8 2a 22 00 00       	call   22a5 <printf>
+      7b:	8b 05 cf 36 00 00    	mov    0x36cf(%rip),%eax        # 3750 <stdout>
+      81:	48 8d 15 78 2b 00 00 	lea    0x2b78(%rip),%rdx        # 2c00 <malloc+0x160>
+      88:	48 89 d6             	mov    %rdx,%rsi
+      8b:	89 c7                	mov    %eax,%edi
+      8d:	b8 00 00 00 00       	mov    $0x0,%eax
+      92:	e8 0e 22 00 00       	call   22a5 <printf>
+      97:	8b 05 b3 36 00 00    	mov    0x36b3(%rip),%eax        # 3750 <stdout>
+      9d:	48 8d 15 89 2b 00 00 	lea    0x2b89(%rip),%rdx        # 2c2d <malloc+0x18d>
+      a4:	48 89 d6             	mov    %rdx,%rsi
+      a7:	89 c7                	mov    %eax,%edi
+      a9:	b8 00 00 00 00       	mov    $0x0,%eax
+      ae:	e8 f2 21 00 00       	call   22a5 <printf>
+      b3:	e8 94 27 00 00       	call   284c <exit>
+  }
+  // overwrite the original data.
+  int n = write(fd, buf, strlen(buf) + 1);
+      b8:	48 8d 05 e1 36 00 00 	lea    0x36e1(%rip),%rax        # 37a0 <buf>
+      bf:	48 89 c7             	mov    %rax,%rdi
+      c2:	e8 6e 25 00 00       	call   2635 <strlen>
+      c7:	83 c0 01             	add    $0x1,%eax
+      ca:	89 c2                	mov    %eax,%edx
+      cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      cf:	48 8d 0d ca 36 00 00 	lea    0x36ca(%rip),%rcx        # 37a0 <buf>
+      d6:	48 89 ce             	mov    %rcx,%rsi
+      d9:	89 c7                	mov    %eax,%edi
+      db:	e8 8c 27 00 00       	call   286c <write>
+      e0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != strlen(buf) + 1) {
+      e3:	48 8d 05 b6 36 00 00 	lea    0x36b6(%rip),%rax        # 37a0 <buf>
+      ea:	48 89 c7             	mov    %rax,%rdi
+      ed:	e8 43 25 00 00       	call   2635 <strlen>
+      f2:	8d 50 01             	lea    0x1(%rax),%edx
+      f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f8:	39 c2                	cmp    %eax,%edx
+      fa:	74 74                	je     170 <overwrite+0x170>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+      fc:	8b 05 4e 36 00 00    	mov    0x364e(%rip),%eax        # 3750 <stdout>
+     102:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     107:	48 8d 0d dc 2a 00 00 	lea    0x2adc(%rip),%rcx        # 2bea <malloc+0x14a>
+     10e:	48 89 ce             	mov    %rcx,%rsi
+     111:	89 c7                	mov    %eax,%edi
+     113:	b8 00 00 00 00       	mov    $0x0,%eax
+     118:	e8 88 21 00 00       	call   22a5 <printf>
+     11d:	48 8d 05 7c 36 00 00 	lea    0x367c(%rip),%rax        # 37a0 <buf>
+     124:	48 89 c7             	mov    %rax,%rdi
+     127:	e8 09 25 00 00       	call   2635 <strlen>
+     12c:	8d 70 01             	lea    0x1(%rax),%esi
+     12f:	8b 05 1b 36 00 00    	mov    0x361b(%rip),%eax        # 3750 <stdout>
+     135:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     138:	89 d1                	mov    %edx,%ecx
+     13a:	89 f2                	mov    %esi,%edx
+     13c:	48 8d 35 ed 2a 00 00 	lea    0x2aed(%rip),%rsi        # 2c30 <malloc+0x190>
+     143:	89 c7                	mov    %eax,%edi
+     145:	b8 00 00 00 00       	mov    $0x0,%eax
+     14a:	e8 56 21 00 00       	call   22a5 <printf>
+     14f:	8b 05 fb 35 00 00    	mov    0x35fb(%rip),%eax        # 3750 <stdout>
+     155:	48 8d 15 d1 2a 00 00 	lea    0x2ad1(%rip),%rdx        # 2c2d <malloc+0x18d>
+     15c:	48 89 d6             	mov    %rdx,%rsi
+     15f:	89 c7                	mov    %eax,%edi
+     161:	b8 00 00 00 00       	mov    $0x0,%eax
+     166:	e8 3a 21 00 00       	call   22a5 <printf>
+     16b:	e8 dc 26 00 00       	call   284c <exit>
+  }
+  close(fd);
+     170:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     173:	89 c7                	mov    %eax,%edi
+     175:	e8 fa 26 00 00       	call   2874 <close>
+
+  fd = open("small.txt", O_RDONLY);
+     17a:	be 00 00 00 00       	mov    $0x0,%esi
+     17f:	48 8d 05 5a 2a 00 00 	lea    0x2a5a(%rip),%rax        # 2be0 <malloc+0x140>
+     186:	48 89 c7             	mov    %rax,%rdi
+     189:	e8 fe 26 00 00       	call   288c <open>
+     18e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  read(fd, buf, 50);
+     191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     194:	ba 32 00 00 00       	mov    $0x32,%edx
+     199:	48 8d 0d 00 36 00 00 	lea    0x3600(%rip),%rcx        # 37a0 <buf>
+     1a0:	48 89 ce             	mov    %rcx,%rsi
+     1a3:	89 c7                	mov    %eax,%edi
+     1a5:	e8 ba 26 00 00       	call   2864 <read>
+
+  if (strcmp(buf, "lab5 is the last 451 lab\n") != 0)
+     1aa:	48 8d 05 15 2a 00 00 	lea    0x2a15(%rip),%rax        # 2bc6 <malloc+0x126>
+     1b1:	48 89 c6             	mov    %rax,%rsi
+     1b4:	48 8d 05 e5 35 00 00 	lea    0x35e5(%rip),%rax        # 37a0 <buf>
+     1bb:	48 89 c7             	mov    %rax,%rdi
+     1be:	e8 23 24 00 00       	call   25e6 <strcmp>
+     1c3:	85 c0                	test   %eax,%eax
+     1c5:	74 65                	je     22c <overwrite+0x22c>
+    error("file content was not 'lab5 is the last 451 lab', was: '%s'", buf);
+     1c7:	8b 05 83 35 00 00    	mov    0x3583(%rip),%eax        # 3750 <stdout>
+     1cd:	ba 35 00 00 00       	mov    $0x35,%edx
+     1d2:	48 8d 0d 11 2a 00 00 	lea    0x2a11(%rip),%rcx        # 2bea <malloc+0x14a>
+     1d9:	48 89 ce             	mov    %rcx,%rsi
+     1dc:	89 c7                	mov    %eax,%edi
+     1de:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e3:	e8 bd 20 00 00       	call   22a5 <printf>
+     1e8:	8b 05 62 35 00 00    	mov    0x3562(%rip),%eax        # 3750 <stdout>
+     1ee:	48 8d 15 ab 35 00 00 	lea    0x35ab(%rip),%rdx        # 37a0 <buf>
+     1f5:	48 8d 0d 6c 2a 00 00 	lea    0x2a6c(%rip),%rcx        # 2c68 <malloc+0x1c8>
+     1fc:	48 89 ce             	mov    %rcx,%rsi
+     1ff:	89 c7                	mov    %eax,%edi
+     201:	b8 00 00 00 00       	mov    $0x0,%eax
+     206:	e8 9a 20 00 00       	call   22a5 <printf>
+     20b:	8b 05 3f 35 00 00    	mov    0x353f(%rip),%eax        # 3750 <stdout>
+     211:	48 8d 15 15 2a 00 00 	lea    0x2a15(%rip),%rdx        # 2c2d <malloc+0x18d>
+     218:	48 89 d6             	mov    %rdx,%rsi
+     21b:	89 c7                	mov    %eax,%edi
+     21d:	b8 00 00 00 00       	mov    $0x0,%eax
+     222:	e8 7e 20 00 00       	call   22a5 <printf>
+     227:	e8 20 26 00 00       	call   284c <exit>
+
+  close(fd);
+     22c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     22f:	89 c7                	mov    %eax,%edi
+     231:	e8 3e 26 00 00       	call   2874 <close>
+
+  printf(stdout, "overwrite ok\n");
+     236:	8b 05 14 35 00 00    	mov    0x3514(%rip),%eax        # 3750 <stdout>
+     23c:	48 8d 15 60 2a 00 00 	lea    0x2a60(%rip),%rdx        # 2ca3 <malloc+0x203>
+     243:	48 89 d6             	mov    %rdx,%rsi
+     246:	89 c7                	mov    %eax,%edi
+     248:	b8 00 00 00 00       	mov    $0x0,%eax
+     24d:	e8 53 20 00 00       	call   22a5 <printf>
+}
+     252:	90                   	nop
+     253:	c9                   	leave
+     254:	c3                   	ret
+
+0000000000000255 <append>:
+
+void append(void) {
+     255:	55                   	push   %rbp
+     256:	48 89 e5             	mov    %rsp,%rbp
+     259:	41 57                	push   %r15
+     25b:	41 56                	push   %r14
+     25d:	41 55                	push   %r13
+     25f:	41 54                	push   %r12
+     261:	53                   	push   %rbx
+     262:	48 83 ec 28          	sub    $0x28,%rsp
+     266:	48 89 e0             	mov    %rsp,%rax
+     269:	48 89 c3             	mov    %rax,%rbx
+  int fd;
+  int old_size;
+
+  printf(stdout, "append...\n");
+     26c:	8b 05 de 34 00 00    	mov    0x34de(%rip),%eax        # 3750 <stdout>
+     272:	48 8d 15 38 2a 00 00 	lea    0x2a38(%rip),%rdx        # 2cb1 <malloc+0x211>
+     279:	48 89 d6             	mov    %rdx,%rsi
+     27c:	89 c7                	mov    %eax,%edi
+     27e:	b8 00 00 00 00       	mov    $0x0,%eax
+     283:	e8 1d 20 00 00       	call   22a5 <printf>
+
+  old_size = strlen(buf);
+     288:	48 8d 05 11 35 00 00 	lea    0x3511(%rip),%rax        # 37a0 <buf>
+     28f:	48 89 c7             	mov    %rax,%rdi
+     292:	e8 9e 23 00 00       	call   2635 <strlen>
+     297:	89 45 cc             	mov    %eax,-0x34(%rbp)
+
+  fd = open("small.txt", O_RDWR);
+     29a:	be 02 00 00 00       	mov    $0x2,%esi
+     29f:	48 8d 05 3a 29 00 00 	lea    0x293a(%rip),%rax        # 2be0 <malloc+0x140>
+     2a6:	48 89 c7             	mov    %rax,%rdi
+     2a9:	e8 de 25 00 00       	call   288c <open>
+     2ae:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  if (fd < 0) {
+     2b1:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+     2b5:	79 5e                	jns    315 <append+0xc0>
+    error("Could not open small.txt with RW permissions");
+     2b7:	8b 05 93 34 00 00    	mov    0x3493(%rip),%eax        # 3750 <stdout>
+     2bd:	ba 46 00 00 00       	mov    $0x46,%edx
+     2c2:	48 8d 0d 21 29 00 00 	lea    0x2921(%rip),%rcx        # 2bea <malloc+0x14a>
+     2c9:	48 89 ce             	mov    %rcx,%rsi
+     2cc:	89 c7                	mov    %eax,%edi
+     2ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d3:	e8 cd 1f 00 00       	call   22a5 <printf>
+     2d8:	8b 05 72 34 00 00    	mov    0x3472(%rip),%eax        # 3750 <stdout>
+     2de:	48 8d 15 1b 29 00 00 	lea    0x291b(%rip),%rdx        # 2c00 <malloc+0x160>
+     2e5:	48 89 d6             	mov    %rdx,%rsi
+     2e8:	89 c7                	mov    %eax,%edi
+     2ea:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ef:	e8 b1 1f 00 00       	call   22a5 <printf>
+     2f4:	8b 05 56 34 00 00    	mov    0x3456(%rip),%eax        # 3750 <stdout>
+     2fa:	48 8d 15 2c 29 00 00 	lea    0x292c(%rip),%rdx        # 2c2d <malloc+0x18d>
+     301:	48 89 d6             	mov    %rdx,%rsi
+     304:	89 c7                	mov    %eax,%edi
+     306:	b8 00 00 00 00       	mov    $0x0,%eax
+     30b:	e8 95 1f 00 00       	call   22a5 <printf>
+     310:	e8 37 25 00 00       	call   284c <exit>
+  }
+
+  // Advance the fd offset to 1 less than the size of file.
+  char garbo[old_size];
+     315:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     318:	48 63 d0             	movslq %eax,%rdx
+     31b:	48 83 ea 01          	sub    $0x1,%rdx
+     31f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     323:	48 63 d0             	movslq %eax,%rdx
+     326:	49 89 d6             	mov    %rdx,%r14
+     329:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     32f:	48 63 d0             	movslq %eax,%rdx
+     332:	49 89 d4             	mov    %rdx,%r12
+     335:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     33b:	48 98                	cltq
+     33d:	ba 10 00 00 00       	mov    $0x10,%edx
+     342:	48 83 ea 01          	sub    $0x1,%rdx
+     346:	48 01 d0             	add    %rdx,%rax
+     349:	b9 10 00 00 00       	mov    $0x10,%ecx
+     34e:	ba 00 00 00 00       	mov    $0x0,%edx
+     353:	48 f7 f1             	div    %rcx
+     356:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     35a:	48 29 c4             	sub    %rax,%rsp
+     35d:	48 89 e0             	mov    %rsp,%rax
+     360:	48 83 c0 00          	add    $0x0,%rax
+     364:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  int n = read(fd, &garbo, old_size - 1);
+     368:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     36b:	8d 50 ff             	lea    -0x1(%rax),%edx
+     36e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+     372:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     375:	48 89 ce             	mov    %rcx,%rsi
+     378:	89 c7                	mov    %eax,%edi
+     37a:	e8 e5 24 00 00       	call   2864 <read>
+     37f:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != old_size - 1) {
+     382:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     385:	83 e8 01             	sub    $0x1,%eax
+     388:	39 45 b4             	cmp    %eax,-0x4c(%rbp)
+     38b:	74 5e                	je     3eb <append+0x196>
+    error("read failed");
+     38d:	8b 05 bd 33 00 00    	mov    0x33bd(%rip),%eax        # 3750 <stdout>
+     393:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     398:	48 8d 0d 4b 28 00 00 	lea    0x284b(%rip),%rcx        # 2bea <malloc+0x14a>
+     39f:	48 89 ce             	mov    %rcx,%rsi
+     3a2:	89 c7                	mov    %eax,%edi
+     3a4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3a9:	e8 f7 1e 00 00       	call   22a5 <printf>
+     3ae:	8b 05 9c 33 00 00    	mov    0x339c(%rip),%eax        # 3750 <stdout>
+     3b4:	48 8d 15 01 29 00 00 	lea    0x2901(%rip),%rdx        # 2cbc <malloc+0x21c>
+     3bb:	48 89 d6             	mov    %rdx,%rsi
+     3be:	89 c7                	mov    %eax,%edi
+     3c0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c5:	e8 db 1e 00 00       	call   22a5 <printf>
+     3ca:	8b 05 80 33 00 00    	mov    0x3380(%rip),%eax        # 3750 <stdout>
+     3d0:	48 8d 15 56 28 00 00 	lea    0x2856(%rip),%rdx        # 2c2d <malloc+0x18d>
+     3d7:	48 89 d6             	mov    %rdx,%rsi
+     3da:	89 c7                	mov    %eax,%edi
+     3dc:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e1:	e8 bf 1e 00 00       	call   22a5 <printf>
+     3e6:	e8 61 24 00 00       	call   284c <exit>
+  }
+  strcpy(buf, ", but this is just the beginning :(\n");
+     3eb:	48 8d 05 d6 28 00 00 	lea    0x28d6(%rip),%rax        # 2cc8 <malloc+0x228>
+     3f2:	48 89 c6             	mov    %rax,%rsi
+     3f5:	48 8d 05 a4 33 00 00 	lea    0x33a4(%rip),%rax        # 37a0 <buf>
+     3fc:	48 89 c7             	mov    %rax,%rdi
+     3ff:	e8 a3 21 00 00       	call   25a7 <strcpy>
+
+  // overwrite the last char, and append data.
+  n = write(fd, buf, strlen(buf) + 1);
+     404:	48 8d 05 95 33 00 00 	lea    0x3395(%rip),%rax        # 37a0 <buf>
+     40b:	48 89 c7             	mov    %rax,%rdi
+     40e:	e8 22 22 00 00       	call   2635 <strlen>
+     413:	83 c0 01             	add    $0x1,%eax
+     416:	89 c2                	mov    %eax,%edx
+     418:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     41b:	48 8d 0d 7e 33 00 00 	lea    0x337e(%rip),%rcx        # 37a0 <buf>
+     422:	48 89 ce             	mov    %rcx,%rsi
+     425:	89 c7                	mov    %eax,%edi
+     427:	e8 40 24 00 00       	call   286c <write>
+     42c:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != strlen(buf) + 1) {
+     42f:	48 8d 05 6a 33 00 00 	lea    0x336a(%rip),%rax        # 37a0 <buf>
+     436:	48 89 c7             	mov    %rax,%rdi
+     439:	e8 f7 21 00 00       	call   2635 <strlen>
+     43e:	8d 50 01             	lea    0x1(%rax),%edx
+     441:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+     444:	39 c2                	cmp    %eax,%edx
+     446:	74 74                	je     4bc <append+0x267>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+     448:	8b 05 02 33 00 00    	mov    0x3302(%rip),%eax        # 3750 <stdout>
+     44e:	ba 54 00 00 00       	mov    $0x54,%edx
+     453:	48 8d 0d 90 27 00 00 	lea    0x2790(%rip),%rcx        # 2bea <malloc+0x14a>
+     45a:	48 89 ce             	mov    %rcx,%rsi
+     45d:	89 c7                	mov    %eax,%edi
+     45f:	b8 00 00 00 00       	mov    $0x0,%eax
+     464:	e8 3c 1e 00 00       	call   22a5 <printf>
+     469:	48 8d 05 30 33 00 00 	lea    0x3330(%rip),%rax        # 37a0 <buf>
+     470:	48 89 c7             	mov    %rax,%rdi
+     473:	e8 bd 21 00 00       	call   2635 <strlen>
+     478:	8d 70 01             	lea    0x1(%rax),%esi
+     47b:	8b 05 cf 32 00 00    	mov    0x32cf(%rip),%eax        # 3750 <stdout>
+     481:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+     484:	89 d1                	mov    %edx,%ecx
+     486:	89 f2                	mov    %esi,%edx
+     488:	48 8d 35 a1 27 00 00 	lea    0x27a1(%rip),%rsi        # 2c30 <malloc+0x190>
+     48f:	89 c7                	mov    %eax,%edi
+     491:	b8 00 00 00 00       	mov    $0x0,%eax
+     496:	e8 0a 1e 00 00       	call   22a5 <printf>
+     49b:	8b 05 af 32 00 00    	mov    0x32af(%rip),%eax        # 3750 <stdout>
+     4a1:	48 8d 15 85 27 00 00 	lea    0x2785(%rip),%rdx        # 2c2d <malloc+0x18d>
+     4a8:	48 89 d6             	mov    %rdx,%rsi
+     4ab:	89 c7                	mov    %eax,%edi
+     4ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b2:	e8 ee 1d 00 00       	call   22a5 <printf>
+     4b7:	e8 90 23 00 00       	call   284c <exit>
+  }
+  close(fd);
+     4bc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4bf:	89 c7                	mov    %eax,%edi
+     4c1:	e8 ae 23 00 00       	call   2874 <close>
+
+  fd = open("small.txt", O_RDWR);
+     4c6:	be 02 00 00 00       	mov    $0x2,%esi
+     4cb:	48 8d 05 0e 27 00 00 	lea    0x270e(%rip),%rax        # 2be0 <malloc+0x140>
+     4d2:	48 89 c7             	mov    %rax,%rdi
+     4d5:	e8 b2 23 00 00       	call   288c <open>
+     4da:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  read(fd, buf, 62);
+     4dd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4e0:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     4e5:	48 8d 0d b4 32 00 00 	lea    0x32b4(%rip),%rcx        # 37a0 <buf>
+     4ec:	48 89 ce             	mov    %rcx,%rsi
+     4ef:	89 c7                	mov    %eax,%edi
+     4f1:	e8 6e 23 00 00       	call   2864 <read>
+
+  // If the content hasn't changed, then the dinode size is not being
+  // updated for the file.
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+     4f6:	48 8d 05 f3 27 00 00 	lea    0x27f3(%rip),%rax        # 2cf0 <malloc+0x250>
+     4fd:	48 89 c6             	mov    %rax,%rsi
+     500:	48 8d 05 99 32 00 00 	lea    0x3299(%rip),%rax        # 37a0 <buf>
+     507:	48 89 c7             	mov    %rax,%rdi
+     50a:	e8 d7 20 00 00       	call   25e6 <strcmp>
+     50f:	85 c0                	test   %eax,%eax
+     511:	74 65                	je     578 <append+0x323>
+    error("file content did not match expected, was: '%s'", buf);
+     513:	8b 05 37 32 00 00    	mov    0x3237(%rip),%eax        # 3750 <stdout>
+     519:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     51e:	48 8d 0d c5 26 00 00 	lea    0x26c5(%rip),%rcx        # 2bea <malloc+0x14a>
+     525:	48 89 ce             	mov    %rcx,%rsi
+     528:	89 c7                	mov    %eax,%edi
+     52a:	b8 00 00 00 00       	mov    $0x0,%eax
+     52f:	e8 71 1d 00 00       	call   22a5 <printf>
+     534:	8b 05 16 32 00 00    	mov    0x3216(%rip),%eax        # 3750 <stdout>
+     53a:	48 8d 15 5f 32 00 00 	lea    0x325f(%rip),%rdx        # 37a0 <buf>
+     541:	48 8d 0d e8 27 00 00 	lea    0x27e8(%rip),%rcx        # 2d30 <malloc+0x290>
+     548:	48 89 ce             	mov    %rcx,%rsi
+     54b:	89 c7                	mov    %eax,%edi
+     54d:	b8 00 00 00 00       	mov    $0x0,%eax
+     552:	e8 4e 1d 00 00       	call   22a5 <printf>
+     557:	8b 05 f3 31 00 00    	mov    0x31f3(%rip),%eax        # 3750 <stdout>
+     55d:	48 8d 15 c9 26 00 00 	lea    0x26c9(%rip),%rdx        # 2c2d <malloc+0x18d>
+     564:	48 89 d6             	mov    %rdx,%rsi
+     567:	89 c7                	mov    %eax,%edi
+     569:	b8 00 00 00 00       	mov    $0x0,%eax
+     56e:	e8 32 1d 00 00       	call   22a5 <printf>
+     573:	e8 d4 22 00 00       	call   284c <exit>
+
+  close(fd);
+     578:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     57b:	89 c7                	mov    %eax,%edi
+     57d:	e8 f2 22 00 00       	call   2874 <close>
+
+  printf(stdout, "append ok\n");
+     582:	8b 05 c8 31 00 00    	mov    0x31c8(%rip),%eax        # 3750 <stdout>
+     588:	48 8d 15 d0 27 00 00 	lea    0x27d0(%rip),%rdx        # 2d5f <malloc+0x2bf>
+     58f:	48 89 d6             	mov    %rdx,%rsi
+     592:	89 c7                	mov    %eax,%edi
+     594:	b8 00 00 00 00       	mov    $0x0,%eax
+     599:	e8 07 1d 00 00       	call   22a5 <printf>
+     59e:	48 89 dc             	mov    %rbx,%rsp
+}
+     5a1:	90                   	nop
+     5a2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     5a6:	5b                   	pop    %rbx
+     5a7:	41 5c                	pop    %r12
+     5a9:	41 5d                	pop    %r13
+     5ab:	41 5e                	pop    %r14
+     5ad:	41 5f                	pop    %r15
+     5af:	5d                   	pop    %rbp
+     5b0:	c3                   	ret
+
+00000000000005b1 <filecreation>:
+
+
+// Creates a new file.
+// Writes 1 byte to it, reads 1 byte from it.
+void filecreation(void) {
+     5b1:	55                   	push   %rbp
+     5b2:	48 89 e5             	mov    %rsp,%rbp
+     5b5:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, n;
+  printf(1, "filecreation...\n");
+     5b9:	48 8d 05 aa 27 00 00 	lea    0x27aa(%rip),%rax        # 2d6a <malloc+0x2ca>
+     5c0:	48 89 c6             	mov    %rax,%rsi
+     5c3:	bf 01 00 00 00       	mov    $0x1,%edi
+     5c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cd:	e8 d3 1c 00 00       	call   22a5 <printf>
+
+  if ((fd = open("create.txt", O_CREATE|O_RDWR)) < 0)
+     5d2:	be 02 02 00 00       	mov    $0x202,%esi
+     5d7:	48 8d 05 9d 27 00 00 	lea    0x279d(%rip),%rax        # 2d7b <malloc+0x2db>
+     5de:	48 89 c7             	mov    %rax,%rdi
+     5e1:	e8 a6 22 00 00       	call   288c <open>
+     5e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     5e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5ed:	79 5e                	jns    64d <filecreation+0x9c>
+    error("create 'create.txt' failed");
+     5ef:	8b 05 5b 31 00 00    	mov    0x315b(%rip),%eax        # 3750 <stdout>
+     5f5:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     5fa:	48 8d 0d e9 25 00 00 	lea    0x25e9(%rip),%rcx        # 2bea <malloc+0x14a>
+     601:	48 89 ce             	mov    %rcx,%rsi
+     604:	89 c7                	mov    %eax,%edi
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	e8 95 1c 00 00       	call   22a5 <printf>
+     610:	8b 05 3a 31 00 00    	mov    0x313a(%rip),%eax        # 3750 <stdout>
+     616:	48 8d 15 69 27 00 00 	lea    0x2769(%rip),%rdx        # 2d86 <malloc+0x2e6>
+     61d:	48 89 d6             	mov    %rdx,%rsi
+     620:	89 c7                	mov    %eax,%edi
+     622:	b8 00 00 00 00       	mov    $0x0,%eax
+     627:	e8 79 1c 00 00       	call   22a5 <printf>
+     62c:	8b 05 1e 31 00 00    	mov    0x311e(%rip),%eax        # 3750 <stdout>
+     632:	48 8d 15 f4 25 00 00 	lea    0x25f4(%rip),%rdx        # 2c2d <malloc+0x18d>
+     639:	48 89 d6             	mov    %rdx,%rsi
+     63c:	89 c7                	mov    %eax,%edi
+     63e:	b8 00 00 00 00       	mov    $0x0,%eax
+     643:	e8 5d 1c 00 00       	call   22a5 <printf>
+     648:	e8 ff 21 00 00       	call   284c <exit>
+
+  close(fd);
+     64d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     650:	89 c7                	mov    %eax,%edi
+     652:	e8 1d 22 00 00       	call   2874 <close>
+
+  // Reopen and write 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     657:	be 02 00 00 00       	mov    $0x2,%esi
+     65c:	48 8d 05 18 27 00 00 	lea    0x2718(%rip),%rax        # 2d7b <malloc+0x2db>
+     663:	48 89 c7             	mov    %rax,%rdi
+     666:	e8 21 22 00 00       	call   288c <open>
+     66b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     66e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     672:	79 5e                	jns    6d2 <filecreation+0x121>
+    error("open 'create.txt' after creation failed");
+     674:	8b 05 d6 30 00 00    	mov    0x30d6(%rip),%eax        # 3750 <stdout>
+     67a:	ba 73 00 00 00       	mov    $0x73,%edx
+     67f:	48 8d 0d 64 25 00 00 	lea    0x2564(%rip),%rcx        # 2bea <malloc+0x14a>
+     686:	48 89 ce             	mov    %rcx,%rsi
+     689:	89 c7                	mov    %eax,%edi
+     68b:	b8 00 00 00 00       	mov    $0x0,%eax
+     690:	e8 10 1c 00 00       	call   22a5 <printf>
+     695:	8b 05 b5 30 00 00    	mov    0x30b5(%rip),%eax        # 3750 <stdout>
+     69b:	48 8d 15 06 27 00 00 	lea    0x2706(%rip),%rdx        # 2da8 <malloc+0x308>
+     6a2:	48 89 d6             	mov    %rdx,%rsi
+     6a5:	89 c7                	mov    %eax,%edi
+     6a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ac:	e8 f4 1b 00 00       	call   22a5 <printf>
+     6b1:	8b 05 99 30 00 00    	mov    0x3099(%rip),%eax        # 3750 <stdout>
+     6b7:	48 8d 15 6f 25 00 00 	lea    0x256f(%rip),%rdx        # 2c2d <malloc+0x18d>
+     6be:	48 89 d6             	mov    %rdx,%rsi
+     6c1:	89 c7                	mov    %eax,%edi
+     6c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c8:	e8 d8 1b 00 00       	call   22a5 <printf>
+     6cd:	e8 7a 21 00 00       	call   284c <exit>
+  memset(buf, 1, 1);
+     6d2:	ba 01 00 00 00       	mov    $0x1,%edx
+     6d7:	be 01 00 00 00       	mov    $0x1,%esi
+     6dc:	48 8d 05 bd 30 00 00 	lea    0x30bd(%rip),%rax        # 37a0 <buf>
+     6e3:	48 89 c7             	mov    %rax,%rdi
+     6e6:	e8 78 1f 00 00       	call   2663 <memset>
+  n = write(fd, buf, 1);
+     6eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6ee:	ba 01 00 00 00       	mov    $0x1,%edx
+     6f3:	48 8d 0d a6 30 00 00 	lea    0x30a6(%rip),%rcx        # 37a0 <buf>
+     6fa:	48 89 ce             	mov    %rcx,%rsi
+     6fd:	89 c7                	mov    %eax,%edi
+     6ff:	e8 68 21 00 00       	call   286c <write>
+     704:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     707:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     70b:	74 5e                	je     76b <filecreation+0x1ba>
+    error("error writing to created file.\n");
+     70d:	8b 05 3d 30 00 00    	mov    0x303d(%rip),%eax        # 3750 <stdout>
+     713:	ba 77 00 00 00       	mov    $0x77,%edx
+     718:	48 8d 0d cb 24 00 00 	lea    0x24cb(%rip),%rcx        # 2bea <malloc+0x14a>
+     71f:	48 89 ce             	mov    %rcx,%rsi
+     722:	89 c7                	mov    %eax,%edi
+     724:	b8 00 00 00 00       	mov    $0x0,%eax
+     729:	e8 77 1b 00 00       	call   22a5 <printf>
+     72e:	8b 05 1c 30 00 00    	mov    0x301c(%rip),%eax        # 3750 <stdout>
+     734:	48 8d 15 95 26 00 00 	lea    0x2695(%rip),%rdx        # 2dd0 <malloc+0x330>
+     73b:	48 89 d6             	mov    %rdx,%rsi
+     73e:	89 c7                	mov    %eax,%edi
+     740:	b8 00 00 00 00       	mov    $0x0,%eax
+     745:	e8 5b 1b 00 00       	call   22a5 <printf>
+     74a:	8b 05 00 30 00 00    	mov    0x3000(%rip),%eax        # 3750 <stdout>
+     750:	48 8d 15 d6 24 00 00 	lea    0x24d6(%rip),%rdx        # 2c2d <malloc+0x18d>
+     757:	48 89 d6             	mov    %rdx,%rsi
+     75a:	89 c7                	mov    %eax,%edi
+     75c:	b8 00 00 00 00       	mov    $0x0,%eax
+     761:	e8 3f 1b 00 00       	call   22a5 <printf>
+     766:	e8 e1 20 00 00       	call   284c <exit>
+  }
+  close(fd);
+     76b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     76e:	89 c7                	mov    %eax,%edi
+     770:	e8 ff 20 00 00       	call   2874 <close>
+
+
+  // Reopen and read 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     775:	be 02 00 00 00       	mov    $0x2,%esi
+     77a:	48 8d 05 fa 25 00 00 	lea    0x25fa(%rip),%rax        # 2d7b <malloc+0x2db>
+     781:	48 89 c7             	mov    %rax,%rdi
+     784:	e8 03 21 00 00       	call   288c <open>
+     789:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     78c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     790:	79 5e                	jns    7f0 <filecreation+0x23f>
+    error("open 'create.txt' after creation failed");
+     792:	8b 05 b8 2f 00 00    	mov    0x2fb8(%rip),%eax        # 3750 <stdout>
+     798:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     79d:	48 8d 0d 46 24 00 00 	lea    0x2446(%rip),%rcx        # 2bea <malloc+0x14a>
+     7a4:	48 89 ce             	mov    %rcx,%rsi
+     7a7:	89 c7                	mov    %eax,%edi
+     7a9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ae:	e8 f2 1a 00 00       	call   22a5 <printf>
+     7b3:	8b 05 97 2f 00 00    	mov    0x2f97(%rip),%eax        # 3750 <stdout>
+     7b9:	48 8d 15 e8 25 00 00 	lea    0x25e8(%rip),%rdx        # 2da8 <malloc+0x308>
+     7c0:	48 89 d6             	mov    %rdx,%rsi
+     7c3:	89 c7                	mov    %eax,%edi
+     7c5:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ca:	e8 d6 1a 00 00       	call   22a5 <printf>
+     7cf:	8b 05 7b 2f 00 00    	mov    0x2f7b(%rip),%eax        # 3750 <stdout>
+     7d5:	48 8d 15 51 24 00 00 	lea    0x2451(%rip),%rdx        # 2c2d <malloc+0x18d>
+     7dc:	48 89 d6             	mov    %rdx,%rsi
+     7df:	89 c7                	mov    %eax,%edi
+     7e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e6:	e8 ba 1a 00 00       	call   22a5 <printf>
+     7eb:	e8 5c 20 00 00       	call   284c <exit>
+  memset(buf, 0, 1);
+     7f0:	ba 01 00 00 00       	mov    $0x1,%edx
+     7f5:	be 00 00 00 00       	mov    $0x0,%esi
+     7fa:	48 8d 05 9f 2f 00 00 	lea    0x2f9f(%rip),%rax        # 37a0 <buf>
+     801:	48 89 c7             	mov    %rax,%rdi
+     804:	e8 5a 1e 00 00       	call   2663 <memset>
+  n = read(fd, buf, 1);
+     809:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     80c:	ba 01 00 00 00       	mov    $0x1,%edx
+     811:	48 8d 0d 88 2f 00 00 	lea    0x2f88(%rip),%rcx        # 37a0 <buf>
+     818:	48 89 ce             	mov    %rcx,%rsi
+     81b:	89 c7                	mov    %eax,%edi
+     81d:	e8 42 20 00 00       	call   2864 <read>
+     822:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     825:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     829:	74 5e                	je     889 <filecreation+0x2d8>
+    error("error reading from created file.\n");
+     82b:	8b 05 1f 2f 00 00    	mov    0x2f1f(%rip),%eax        # 3750 <stdout>
+     831:	ba 82 00 00 00       	mov    $0x82,%edx
+     836:	48 8d 0d ad 23 00 00 	lea    0x23ad(%rip),%rcx        # 2bea <malloc+0x14a>
+     83d:	48 89 ce             	mov    %rcx,%rsi
+     840:	89 c7                	mov    %eax,%edi
+     842:	b8 00 00 00 00       	mov    $0x0,%eax
+     847:	e8 59 1a 00 00       	call   22a5 <printf>
+     84c:	8b 05 fe 2e 00 00    	mov    0x2efe(%rip),%eax        # 3750 <stdout>
+     852:	48 8d 15 97 25 00 00 	lea    0x2597(%rip),%rdx        # 2df0 <malloc+0x350>
+     859:	48 89 d6             	mov    %rdx,%rsi
+     85c:	89 c7                	mov    %eax,%edi
+     85e:	b8 00 00 00 00       	mov    $0x0,%eax
+     863:	e8 3d 1a 00 00       	call   22a5 <printf>
+     868:	8b 05 e2 2e 00 00    	mov    0x2ee2(%rip),%eax        # 3750 <stdout>
+     86e:	48 8d 15 b8 23 00 00 	lea    0x23b8(%rip),%rdx        # 2c2d <malloc+0x18d>
+     875:	48 89 d6             	mov    %rdx,%rsi
+     878:	89 c7                	mov    %eax,%edi
+     87a:	b8 00 00 00 00       	mov    $0x0,%eax
+     87f:	e8 21 1a 00 00       	call   22a5 <printf>
+     884:	e8 c3 1f 00 00       	call   284c <exit>
+  }
+
+  // Ensure read got the correct value.
+  assert(buf[0] == 1);
+     889:	0f b6 05 10 2f 00 00 	movzbl 0x2f10(%rip),%eax        # 37a0 <buf>
+     890:	3c 01                	cmp    $0x1,%al
+     892:	74 2b                	je     8bf <filecreation+0x30e>
+     894:	8b 05 b6 2e 00 00    	mov    0x2eb6(%rip),%eax        # 3750 <stdout>
+     89a:	48 8d 15 71 25 00 00 	lea    0x2571(%rip),%rdx        # 2e12 <malloc+0x372>
+     8a1:	48 89 d1             	mov    %rdx,%rcx
+     8a4:	ba 86 00 00 00       	mov    $0x86,%edx
+     8a9:	48 8d 35 70 25 00 00 	lea    0x2570(%rip),%rsi        # 2e20 <malloc+0x380>
+     8b0:	89 c7                	mov    %eax,%edi
+     8b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b7:	e8 e9 19 00 00       	call   22a5 <printf>
+     8bc:	90                   	nop
+     8bd:	eb fd                	jmp    8bc <filecreation+0x30b>
+
+  printf(1, "filecreation ok\n");
+     8bf:	48 8d 05 7a 25 00 00 	lea    0x257a(%rip),%rax        # 2e40 <malloc+0x3a0>
+     8c6:	48 89 c6             	mov    %rax,%rsi
+     8c9:	bf 01 00 00 00       	mov    $0x1,%edi
+     8ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d3:	e8 cd 19 00 00       	call   22a5 <printf>
+
+}
+     8d8:	90                   	nop
+     8d9:	c9                   	leave
+     8da:	c3                   	ret
+
+00000000000008db <onefile>:
+
+
+// Creates a file, writes and reads data.
+// Data is written and read by 500 bytes to try
+// and catch errors in writing.
+void onefile(void) {
+     8db:	55                   	push   %rbp
+     8dc:	48 89 e5             	mov    %rsp,%rbp
+     8df:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i, j;
+  printf(1, "onefile...\n");
+     8e3:	48 8d 05 67 25 00 00 	lea    0x2567(%rip),%rax        # 2e51 <malloc+0x3b1>
+     8ea:	48 89 c6             	mov    %rax,%rsi
+     8ed:	bf 01 00 00 00       	mov    $0x1,%edi
+     8f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f7:	e8 a9 19 00 00       	call   22a5 <printf>
+
+  if ((fd = open("onefile.txt", O_CREATE|O_RDWR)) < 0)
+     8fc:	be 02 02 00 00       	mov    $0x202,%esi
+     901:	48 8d 05 55 25 00 00 	lea    0x2555(%rip),%rax        # 2e5d <malloc+0x3bd>
+     908:	48 89 c7             	mov    %rax,%rdi
+     90b:	e8 7c 1f 00 00       	call   288c <open>
+     910:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     913:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     917:	79 5e                	jns    977 <onefile+0x9c>
+    error("create 'onefile.txt' failed");
+     919:	8b 05 31 2e 00 00    	mov    0x2e31(%rip),%eax        # 3750 <stdout>
+     91f:	ba 95 00 00 00       	mov    $0x95,%edx
+     924:	48 8d 0d bf 22 00 00 	lea    0x22bf(%rip),%rcx        # 2bea <malloc+0x14a>
+     92b:	48 89 ce             	mov    %rcx,%rsi
+     92e:	89 c7                	mov    %eax,%edi
+     930:	b8 00 00 00 00       	mov    $0x0,%eax
+     935:	e8 6b 19 00 00       	call   22a5 <printf>
+     93a:	8b 05 10 2e 00 00    	mov    0x2e10(%rip),%eax        # 3750 <stdout>
+     940:	48 8d 15 22 25 00 00 	lea    0x2522(%rip),%rdx        # 2e69 <malloc+0x3c9>
+     947:	48 89 d6             	mov    %rdx,%rsi
+     94a:	89 c7                	mov    %eax,%edi
+     94c:	b8 00 00 00 00       	mov    $0x0,%eax
+     951:	e8 4f 19 00 00       	call   22a5 <printf>
+     956:	8b 05 f4 2d 00 00    	mov    0x2df4(%rip),%eax        # 3750 <stdout>
+     95c:	48 8d 15 ca 22 00 00 	lea    0x22ca(%rip),%rdx        # 2c2d <malloc+0x18d>
+     963:	48 89 d6             	mov    %rdx,%rsi
+     966:	89 c7                	mov    %eax,%edi
+     968:	b8 00 00 00 00       	mov    $0x0,%eax
+     96d:	e8 33 19 00 00       	call   22a5 <printf>
+     972:	e8 d5 1e 00 00       	call   284c <exit>
+
+  close(fd);
+     977:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     97a:	89 c7                	mov    %eax,%edi
+     97c:	e8 f3 1e 00 00       	call   2874 <close>
+  if ((fd = open("onefile.txt", O_RDWR)) < 0)
+     981:	be 02 00 00 00       	mov    $0x2,%esi
+     986:	48 8d 05 d0 24 00 00 	lea    0x24d0(%rip),%rax        # 2e5d <malloc+0x3bd>
+     98d:	48 89 c7             	mov    %rax,%rdi
+     990:	e8 f7 1e 00 00       	call   288c <open>
+     995:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     998:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     99c:	79 5e                	jns    9fc <onefile+0x121>
+    error("open 'onefile.txt' after creation failed");
+     99e:	8b 05 ac 2d 00 00    	mov    0x2dac(%rip),%eax        # 3750 <stdout>
+     9a4:	ba 99 00 00 00       	mov    $0x99,%edx
+     9a9:	48 8d 0d 3a 22 00 00 	lea    0x223a(%rip),%rcx        # 2bea <malloc+0x14a>
+     9b0:	48 89 ce             	mov    %rcx,%rsi
+     9b3:	89 c7                	mov    %eax,%edi
+     9b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ba:	e8 e6 18 00 00       	call   22a5 <printf>
+     9bf:	8b 05 8b 2d 00 00    	mov    0x2d8b(%rip),%eax        # 3750 <stdout>
+     9c5:	48 8d 15 bc 24 00 00 	lea    0x24bc(%rip),%rdx        # 2e88 <malloc+0x3e8>
+     9cc:	48 89 d6             	mov    %rdx,%rsi
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 ca 18 00 00       	call   22a5 <printf>
+     9db:	8b 05 6f 2d 00 00    	mov    0x2d6f(%rip),%eax        # 3750 <stdout>
+     9e1:	48 8d 15 45 22 00 00 	lea    0x2245(%rip),%rdx        # 2c2d <malloc+0x18d>
+     9e8:	48 89 d6             	mov    %rdx,%rsi
+     9eb:	89 c7                	mov    %eax,%edi
+     9ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f2:	e8 ae 18 00 00       	call   22a5 <printf>
+     9f7:	e8 50 1e 00 00       	call   284c <exit>
+
+
+  memset(buf, 0, sizeof(buf));
+     9fc:	ba 00 20 00 00       	mov    $0x2000,%edx
+     a01:	be 00 00 00 00       	mov    $0x0,%esi
+     a06:	48 8d 05 93 2d 00 00 	lea    0x2d93(%rip),%rax        # 37a0 <buf>
+     a0d:	48 89 c7             	mov    %rax,%rdi
+     a10:	e8 4e 1c 00 00       	call   2663 <memset>
+  for (i = 0; i < 10; i++) {
+     a15:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a1c:	eb 36                	jmp    a54 <onefile+0x179>
+    memset(buf, i, 500);
+     a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a21:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     a26:	89 c6                	mov    %eax,%esi
+     a28:	48 8d 05 71 2d 00 00 	lea    0x2d71(%rip),%rax        # 37a0 <buf>
+     a2f:	48 89 c7             	mov    %rax,%rdi
+     a32:	e8 2c 1c 00 00       	call   2663 <memset>
+    write(fd, buf, 500);
+     a37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a3a:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     a3f:	48 8d 0d 5a 2d 00 00 	lea    0x2d5a(%rip),%rcx        # 37a0 <buf>
+     a46:	48 89 ce             	mov    %rcx,%rsi
+     a49:	89 c7                	mov    %eax,%edi
+     a4b:	e8 1c 1e 00 00       	call   286c <write>
+  for (i = 0; i < 10; i++) {
+     a50:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a54:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     a58:	7e c4                	jle    a1e <onefile+0x143>
+  }
+  close(fd);
+     a5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a5d:	89 c7                	mov    %eax,%edi
+     a5f:	e8 10 1e 00 00       	call   2874 <close>
+  if ((fd = open("onefile.txt", O_RDONLY)) < 0)
+     a64:	be 00 00 00 00       	mov    $0x0,%esi
+     a69:	48 8d 05 ed 23 00 00 	lea    0x23ed(%rip),%rax        # 2e5d <malloc+0x3bd>
+     a70:	48 89 c7             	mov    %rax,%rdi
+     a73:	e8 14 1e 00 00       	call   288c <open>
+     a78:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a7b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     a7f:	79 5e                	jns    adf <onefile+0x204>
+    error("couldn't reopen 'onefile.txt'");
+     a81:	8b 05 c9 2c 00 00    	mov    0x2cc9(%rip),%eax        # 3750 <stdout>
+     a87:	ba a3 00 00 00       	mov    $0xa3,%edx
+     a8c:	48 8d 0d 57 21 00 00 	lea    0x2157(%rip),%rcx        # 2bea <malloc+0x14a>
+     a93:	48 89 ce             	mov    %rcx,%rsi
+     a96:	89 c7                	mov    %eax,%edi
+     a98:	b8 00 00 00 00       	mov    $0x0,%eax
+     a9d:	e8 03 18 00 00       	call   22a5 <printf>
+     aa2:	8b 05 a8 2c 00 00    	mov    0x2ca8(%rip),%eax        # 3750 <stdout>
+     aa8:	48 8d 15 02 24 00 00 	lea    0x2402(%rip),%rdx        # 2eb1 <malloc+0x411>
+     aaf:	48 89 d6             	mov    %rdx,%rsi
+     ab2:	89 c7                	mov    %eax,%edi
+     ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ab9:	e8 e7 17 00 00       	call   22a5 <printf>
+     abe:	8b 05 8c 2c 00 00    	mov    0x2c8c(%rip),%eax        # 3750 <stdout>
+     ac4:	48 8d 15 62 21 00 00 	lea    0x2162(%rip),%rdx        # 2c2d <malloc+0x18d>
+     acb:	48 89 d6             	mov    %rdx,%rsi
+     ace:	89 c7                	mov    %eax,%edi
+     ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad5:	e8 cb 17 00 00       	call   22a5 <printf>
+     ada:	e8 6d 1d 00 00       	call   284c <exit>
+
+  memset(buf, 0, sizeof(buf));
+     adf:	ba 00 20 00 00       	mov    $0x2000,%edx
+     ae4:	be 00 00 00 00       	mov    $0x0,%esi
+     ae9:	48 8d 05 b0 2c 00 00 	lea    0x2cb0(%rip),%rax        # 37a0 <buf>
+     af0:	48 89 c7             	mov    %rax,%rdi
+     af3:	e8 6b 1b 00 00       	call   2663 <memset>
+  for (i = 0; i < 10; i++) {
+     af8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     aff:	e9 de 00 00 00       	jmp    be2 <onefile+0x307>
+    if (read(fd, buf, 500) != 500)
+     b04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b07:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     b0c:	48 8d 0d 8d 2c 00 00 	lea    0x2c8d(%rip),%rcx        # 37a0 <buf>
+     b13:	48 89 ce             	mov    %rcx,%rsi
+     b16:	89 c7                	mov    %eax,%edi
+     b18:	e8 47 1d 00 00       	call   2864 <read>
+     b1d:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     b22:	74 61                	je     b85 <onefile+0x2aa>
+      error("couldn't read the bytes for iteration %d", i);
+     b24:	8b 05 26 2c 00 00    	mov    0x2c26(%rip),%eax        # 3750 <stdout>
+     b2a:	ba a8 00 00 00       	mov    $0xa8,%edx
+     b2f:	48 8d 0d b4 20 00 00 	lea    0x20b4(%rip),%rcx        # 2bea <malloc+0x14a>
+     b36:	48 89 ce             	mov    %rcx,%rsi
+     b39:	89 c7                	mov    %eax,%edi
+     b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b40:	e8 60 17 00 00       	call   22a5 <printf>
+     b45:	8b 05 05 2c 00 00    	mov    0x2c05(%rip),%eax        # 3750 <stdout>
+     b4b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     b4e:	48 8d 0d 7b 23 00 00 	lea    0x237b(%rip),%rcx        # 2ed0 <malloc+0x430>
+     b55:	48 89 ce             	mov    %rcx,%rsi
+     b58:	89 c7                	mov    %eax,%edi
+     b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     b5f:	e8 41 17 00 00       	call   22a5 <printf>
+     b64:	8b 05 e6 2b 00 00    	mov    0x2be6(%rip),%eax        # 3750 <stdout>
+     b6a:	48 8d 15 bc 20 00 00 	lea    0x20bc(%rip),%rdx        # 2c2d <malloc+0x18d>
+     b71:	48 89 d6             	mov    %rdx,%rsi
+     b74:	89 c7                	mov    %eax,%edi
+     b76:	b8 00 00 00 00       	mov    $0x0,%eax
+     b7b:	e8 25 17 00 00       	call   22a5 <printf>
+     b80:	e8 c7 1c 00 00       	call   284c <exit>
+
+    for (j = 0; j < 500; j++) {
+     b85:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     b8c:	eb 47                	jmp    bd5 <onefile+0x2fa>
+      assert(i == buf[j]);
+     b8e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b91:	48 98                	cltq
+     b93:	48 8d 15 06 2c 00 00 	lea    0x2c06(%rip),%rdx        # 37a0 <buf>
+     b9a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     b9e:	0f be c0             	movsbl %al,%eax
+     ba1:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     ba4:	74 2b                	je     bd1 <onefile+0x2f6>
+     ba6:	8b 05 a4 2b 00 00    	mov    0x2ba4(%rip),%eax        # 3750 <stdout>
+     bac:	48 8d 15 46 23 00 00 	lea    0x2346(%rip),%rdx        # 2ef9 <malloc+0x459>
+     bb3:	48 89 d1             	mov    %rdx,%rcx
+     bb6:	ba ab 00 00 00       	mov    $0xab,%edx
+     bbb:	48 8d 35 5e 22 00 00 	lea    0x225e(%rip),%rsi        # 2e20 <malloc+0x380>
+     bc2:	89 c7                	mov    %eax,%edi
+     bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc9:	e8 d7 16 00 00       	call   22a5 <printf>
+     bce:	90                   	nop
+     bcf:	eb fd                	jmp    bce <onefile+0x2f3>
+    for (j = 0; j < 500; j++) {
+     bd1:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     bd5:	81 7d f8 f3 01 00 00 	cmpl   $0x1f3,-0x8(%rbp)
+     bdc:	7e b0                	jle    b8e <onefile+0x2b3>
+  for (i = 0; i < 10; i++) {
+     bde:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     be2:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     be6:	0f 8e 18 ff ff ff    	jle    b04 <onefile+0x229>
+    }
+  }
+
+  printf(1, "onefile ok\n");
+     bec:	48 8d 05 12 23 00 00 	lea    0x2312(%rip),%rax        # 2f05 <malloc+0x465>
+     bf3:	48 89 c6             	mov    %rax,%rsi
+     bf6:	bf 01 00 00 00       	mov    $0x1,%edi
+     bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+     c00:	e8 a0 16 00 00       	call   22a5 <printf>
+}
+     c05:	90                   	nop
+     c06:	c9                   	leave
+     c07:	c3                   	ret
+
+0000000000000c08 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test concurrent block allocation.
+void fourfiles(void) {
+     c08:	55                   	push   %rbp
+     c09:	48 89 e5             	mov    %rsp,%rbp
+     c0c:	48 83 ec 50          	sub    $0x50,%rsp
+  int fd, pid, i, j, n, total, pi;
+  int num = 4;
+     c10:	c7 45 ec 04 00 00 00 	movl   $0x4,-0x14(%rbp)
+  char *names[] = {"f0", "f1", "f2", "f3"};
+     c17:	48 8d 05 f3 22 00 00 	lea    0x22f3(%rip),%rax        # 2f11 <malloc+0x471>
+     c1e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+     c22:	48 8d 05 eb 22 00 00 	lea    0x22eb(%rip),%rax        # 2f14 <malloc+0x474>
+     c29:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+     c2d:	48 8d 05 e3 22 00 00 	lea    0x22e3(%rip),%rax        # 2f17 <malloc+0x477>
+     c34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+     c38:	48 8d 05 db 22 00 00 	lea    0x22db(%rip),%rax        # 2f1a <malloc+0x47a>
+     c3f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  char *fname;
+
+  printf(1, "fourfiles...\n");
+     c43:	48 8d 05 d3 22 00 00 	lea    0x22d3(%rip),%rax        # 2f1d <malloc+0x47d>
+     c4a:	48 89 c6             	mov    %rax,%rsi
+     c4d:	bf 01 00 00 00       	mov    $0x1,%edi
+     c52:	b8 00 00 00 00       	mov    $0x0,%eax
+     c57:	e8 49 16 00 00       	call   22a5 <printf>
+
+  for (pi = 0; pi < num; pi++) {
+     c5c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     c63:	e9 c1 01 00 00       	jmp    e29 <fourfiles+0x221>
+    fname = names[pi];
+     c68:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c6b:	48 98                	cltq
+     c6d:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+     c72:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    pid = fork();
+     c76:	e8 c9 1b 00 00       	call   2844 <fork>
+     c7b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+    if (pid < 0) {
+     c7e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+     c82:	79 5e                	jns    ce2 <fourfiles+0xda>
+      error("fork failed.");
+     c84:	8b 05 c6 2a 00 00    	mov    0x2ac6(%rip),%eax        # 3750 <stdout>
+     c8a:	ba c0 00 00 00       	mov    $0xc0,%edx
+     c8f:	48 8d 0d 54 1f 00 00 	lea    0x1f54(%rip),%rcx        # 2bea <malloc+0x14a>
+     c96:	48 89 ce             	mov    %rcx,%rsi
+     c99:	89 c7                	mov    %eax,%edi
+     c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca0:	e8 00 16 00 00       	call   22a5 <printf>
+     ca5:	8b 05 a5 2a 00 00    	mov    0x2aa5(%rip),%eax        # 3750 <stdout>
+     cab:	48 8d 15 79 22 00 00 	lea    0x2279(%rip),%rdx        # 2f2b <malloc+0x48b>
+     cb2:	48 89 d6             	mov    %rdx,%rsi
+     cb5:	89 c7                	mov    %eax,%edi
+     cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbc:	e8 e4 15 00 00       	call   22a5 <printf>
+     cc1:	8b 05 89 2a 00 00    	mov    0x2a89(%rip),%eax        # 3750 <stdout>
+     cc7:	48 8d 15 5f 1f 00 00 	lea    0x1f5f(%rip),%rdx        # 2c2d <malloc+0x18d>
+     cce:	48 89 d6             	mov    %rdx,%rsi
+     cd1:	89 c7                	mov    %eax,%edi
+     cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd8:	e8 c8 15 00 00       	call   22a5 <printf>
+     cdd:	e8 6a 1b 00 00       	call   284c <exit>
+    }
+
+    if (pid == 0) {
+     ce2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+     ce6:	0f 85 39 01 00 00    	jne    e25 <fourfiles+0x21d>
+      fd = open(fname, O_CREATE | O_RDWR);
+     cec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     cf0:	be 02 02 00 00       	mov    $0x202,%esi
+     cf5:	48 89 c7             	mov    %rax,%rdi
+     cf8:	e8 8f 1b 00 00       	call   288c <open>
+     cfd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+      if (fd < 0) {
+     d00:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     d04:	79 5e                	jns    d64 <fourfiles+0x15c>
+        error("create failed\n");
+     d06:	8b 05 44 2a 00 00    	mov    0x2a44(%rip),%eax        # 3750 <stdout>
+     d0c:	ba c6 00 00 00       	mov    $0xc6,%edx
+     d11:	48 8d 0d d2 1e 00 00 	lea    0x1ed2(%rip),%rcx        # 2bea <malloc+0x14a>
+     d18:	48 89 ce             	mov    %rcx,%rsi
+     d1b:	89 c7                	mov    %eax,%edi
+     d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d22:	e8 7e 15 00 00       	call   22a5 <printf>
+     d27:	8b 05 23 2a 00 00    	mov    0x2a23(%rip),%eax        # 3750 <stdout>
+     d2d:	48 8d 15 04 22 00 00 	lea    0x2204(%rip),%rdx        # 2f38 <malloc+0x498>
+     d34:	48 89 d6             	mov    %rdx,%rsi
+     d37:	89 c7                	mov    %eax,%edi
+     d39:	b8 00 00 00 00       	mov    $0x0,%eax
+     d3e:	e8 62 15 00 00       	call   22a5 <printf>
+     d43:	8b 05 07 2a 00 00    	mov    0x2a07(%rip),%eax        # 3750 <stdout>
+     d49:	48 8d 15 dd 1e 00 00 	lea    0x1edd(%rip),%rdx        # 2c2d <malloc+0x18d>
+     d50:	48 89 d6             	mov    %rdx,%rsi
+     d53:	89 c7                	mov    %eax,%edi
+     d55:	b8 00 00 00 00       	mov    $0x0,%eax
+     d5a:	e8 46 15 00 00       	call   22a5 <printf>
+     d5f:	e8 e8 1a 00 00       	call   284c <exit>
+      }
+
+      memset(buf, '0' + pi, 512);
+     d64:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d67:	83 c0 30             	add    $0x30,%eax
+     d6a:	ba 00 02 00 00       	mov    $0x200,%edx
+     d6f:	89 c6                	mov    %eax,%esi
+     d71:	48 8d 05 28 2a 00 00 	lea    0x2a28(%rip),%rax        # 37a0 <buf>
+     d78:	48 89 c7             	mov    %rax,%rdi
+     d7b:	e8 e3 18 00 00       	call   2663 <memset>
+      for (i = 0; i < 12; i++) {
+     d80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d87:	e9 8a 00 00 00       	jmp    e16 <fourfiles+0x20e>
+        if ((n = write(fd, buf, 500)) != 500) {
+     d8c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d8f:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     d94:	48 8d 0d 05 2a 00 00 	lea    0x2a05(%rip),%rcx        # 37a0 <buf>
+     d9b:	48 89 ce             	mov    %rcx,%rsi
+     d9e:	89 c7                	mov    %eax,%edi
+     da0:	e8 c7 1a 00 00       	call   286c <write>
+     da5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+     da8:	81 7d d8 f4 01 00 00 	cmpl   $0x1f4,-0x28(%rbp)
+     daf:	74 61                	je     e12 <fourfiles+0x20a>
+          error("write failed %d\n", n);
+     db1:	8b 05 99 29 00 00    	mov    0x2999(%rip),%eax        # 3750 <stdout>
+     db7:	ba cc 00 00 00       	mov    $0xcc,%edx
+     dbc:	48 8d 0d 27 1e 00 00 	lea    0x1e27(%rip),%rcx        # 2bea <malloc+0x14a>
+     dc3:	48 89 ce             	mov    %rcx,%rsi
+     dc6:	89 c7                	mov    %eax,%edi
+     dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dcd:	e8 d3 14 00 00       	call   22a5 <printf>
+     dd2:	8b 05 78 29 00 00    	mov    0x2978(%rip),%eax        # 3750 <stdout>
+     dd8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     ddb:	48 8d 0d 65 21 00 00 	lea    0x2165(%rip),%rcx        # 2f47 <malloc+0x4a7>
+     de2:	48 89 ce             	mov    %rcx,%rsi
+     de5:	89 c7                	mov    %eax,%edi
+     de7:	b8 00 00 00 00       	mov    $0x0,%eax
+     dec:	e8 b4 14 00 00       	call   22a5 <printf>
+     df1:	8b 05 59 29 00 00    	mov    0x2959(%rip),%eax        # 3750 <stdout>
+     df7:	48 8d 15 2f 1e 00 00 	lea    0x1e2f(%rip),%rdx        # 2c2d <malloc+0x18d>
+     dfe:	48 89 d6             	mov    %rdx,%rsi
+     e01:	89 c7                	mov    %eax,%edi
+     e03:	b8 00 00 00 00       	mov    $0x0,%eax
+     e08:	e8 98 14 00 00       	call   22a5 <printf>
+     e0d:	e8 3a 1a 00 00       	call   284c <exit>
+      for (i = 0; i < 12; i++) {
+     e12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e16:	83 7d fc 0b          	cmpl   $0xb,-0x4(%rbp)
+     e1a:	0f 8e 6c ff ff ff    	jle    d8c <fourfiles+0x184>
+        }
+      }
+      exit();
+     e20:	e8 27 1a 00 00       	call   284c <exit>
+  for (pi = 0; pi < num; pi++) {
+     e25:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     e29:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e2c:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     e2f:	0f 8c 33 fe ff ff    	jl     c68 <fourfiles+0x60>
+    }
+  }
+
+  for (pi = 0; pi < num; pi++) {
+     e35:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     e3c:	eb 09                	jmp    e47 <fourfiles+0x23f>
+    wait();
+     e3e:	e8 11 1a 00 00       	call   2854 <wait>
+  for (pi = 0; pi < num; pi++) {
+     e43:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     e47:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e4a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     e4d:	7c ef                	jl     e3e <fourfiles+0x236>
+  }
+
+  for (i = 0; i < num; i++) {
+     e4f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e56:	e9 ef 01 00 00       	jmp    104a <fourfiles+0x442>
+    fname = names[i];
+     e5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e5e:	48 98                	cltq
+     e60:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+     e65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    fd = open(fname, O_RDONLY);
+     e69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e6d:	be 00 00 00 00       	mov    $0x0,%esi
+     e72:	48 89 c7             	mov    %rax,%rdi
+     e75:	e8 12 1a 00 00       	call   288c <open>
+     e7a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (fd < 0) {
+     e7d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e81:	79 62                	jns    ee5 <fourfiles+0x2dd>
+      error("file open failed for fname=%s\n", fname);
+     e83:	8b 05 c7 28 00 00    	mov    0x28c7(%rip),%eax        # 3750 <stdout>
+     e89:	ba db 00 00 00       	mov    $0xdb,%edx
+     e8e:	48 8d 0d 55 1d 00 00 	lea    0x1d55(%rip),%rcx        # 2bea <malloc+0x14a>
+     e95:	48 89 ce             	mov    %rcx,%rsi
+     e98:	89 c7                	mov    %eax,%edi
+     e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9f:	e8 01 14 00 00       	call   22a5 <printf>
+     ea4:	8b 05 a6 28 00 00    	mov    0x28a6(%rip),%eax        # 3750 <stdout>
+     eaa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     eae:	48 8d 0d a3 20 00 00 	lea    0x20a3(%rip),%rcx        # 2f58 <malloc+0x4b8>
+     eb5:	48 89 ce             	mov    %rcx,%rsi
+     eb8:	89 c7                	mov    %eax,%edi
+     eba:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebf:	e8 e1 13 00 00       	call   22a5 <printf>
+     ec4:	8b 05 86 28 00 00    	mov    0x2886(%rip),%eax        # 3750 <stdout>
+     eca:	48 8d 15 5c 1d 00 00 	lea    0x1d5c(%rip),%rdx        # 2c2d <malloc+0x18d>
+     ed1:	48 89 d6             	mov    %rdx,%rsi
+     ed4:	89 c7                	mov    %eax,%edi
+     ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+     edb:	e8 c5 13 00 00       	call   22a5 <printf>
+     ee0:	e8 67 19 00 00       	call   284c <exit>
+    }
+    total = 0;
+     ee5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+     eec:	e9 b3 00 00 00       	jmp    fa4 <fourfiles+0x39c>
+      for (j = 0; j < n; j++) {
+     ef1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     ef8:	e9 95 00 00 00       	jmp    f92 <fourfiles+0x38a>
+        if (buf[j] != '0' + i) {
+     efd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f00:	48 98                	cltq
+     f02:	48 8d 15 97 28 00 00 	lea    0x2897(%rip),%rdx        # 37a0 <buf>
+     f09:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     f0d:	0f be d0             	movsbl %al,%edx
+     f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f13:	83 c0 30             	add    $0x30,%eax
+     f16:	39 c2                	cmp    %eax,%edx
+     f18:	74 74                	je     f8e <fourfiles+0x386>
+          error("wrong char, was %d should be %d\n", buf[j], '0' + i);
+     f1a:	8b 05 30 28 00 00    	mov    0x2830(%rip),%eax        # 3750 <stdout>
+     f20:	ba e1 00 00 00       	mov    $0xe1,%edx
+     f25:	48 8d 0d be 1c 00 00 	lea    0x1cbe(%rip),%rcx        # 2bea <malloc+0x14a>
+     f2c:	48 89 ce             	mov    %rcx,%rsi
+     f2f:	89 c7                	mov    %eax,%edi
+     f31:	b8 00 00 00 00       	mov    $0x0,%eax
+     f36:	e8 6a 13 00 00       	call   22a5 <printf>
+     f3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f3e:	8d 48 30             	lea    0x30(%rax),%ecx
+     f41:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f44:	48 98                	cltq
+     f46:	48 8d 15 53 28 00 00 	lea    0x2853(%rip),%rdx        # 37a0 <buf>
+     f4d:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     f51:	0f be d0             	movsbl %al,%edx
+     f54:	8b 05 f6 27 00 00    	mov    0x27f6(%rip),%eax        # 3750 <stdout>
+     f5a:	48 8d 35 17 20 00 00 	lea    0x2017(%rip),%rsi        # 2f78 <malloc+0x4d8>
+     f61:	89 c7                	mov    %eax,%edi
+     f63:	b8 00 00 00 00       	mov    $0x0,%eax
+     f68:	e8 38 13 00 00       	call   22a5 <printf>
+     f6d:	8b 05 dd 27 00 00    	mov    0x27dd(%rip),%eax        # 3750 <stdout>
+     f73:	48 8d 15 b3 1c 00 00 	lea    0x1cb3(%rip),%rdx        # 2c2d <malloc+0x18d>
+     f7a:	48 89 d6             	mov    %rdx,%rsi
+     f7d:	89 c7                	mov    %eax,%edi
+     f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f84:	e8 1c 13 00 00       	call   22a5 <printf>
+     f89:	e8 be 18 00 00       	call   284c <exit>
+      for (j = 0; j < n; j++) {
+     f8e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     f92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f95:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     f98:	0f 8c 5f ff ff ff    	jl     efd <fourfiles+0x2f5>
+        }
+      }
+      total += n;
+     f9e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     fa1:	01 45 f4             	add    %eax,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+     fa4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fa7:	ba 00 20 00 00       	mov    $0x2000,%edx
+     fac:	48 8d 0d ed 27 00 00 	lea    0x27ed(%rip),%rcx        # 37a0 <buf>
+     fb3:	48 89 ce             	mov    %rcx,%rsi
+     fb6:	89 c7                	mov    %eax,%edi
+     fb8:	e8 a7 18 00 00       	call   2864 <read>
+     fbd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+     fc0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     fc4:	0f 8f 27 ff ff ff    	jg     ef1 <fourfiles+0x2e9>
+    }
+    close(fd);
+     fca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fcd:	89 c7                	mov    %eax,%edi
+     fcf:	e8 a0 18 00 00       	call   2874 <close>
+    if (total != 12 * 500) {
+     fd4:	81 7d f4 70 17 00 00 	cmpl   $0x1770,-0xc(%rbp)
+     fdb:	74 69                	je     1046 <fourfiles+0x43e>
+      error("wrong length i:%d, wanted:%d, %d\n", i, 12 * 500, total);
+     fdd:	8b 05 6d 27 00 00    	mov    0x276d(%rip),%eax        # 3750 <stdout>
+     fe3:	ba e8 00 00 00       	mov    $0xe8,%edx
+     fe8:	48 8d 0d fb 1b 00 00 	lea    0x1bfb(%rip),%rcx        # 2bea <malloc+0x14a>
+     fef:	48 89 ce             	mov    %rcx,%rsi
+     ff2:	89 c7                	mov    %eax,%edi
+     ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff9:	e8 a7 12 00 00       	call   22a5 <printf>
+     ffe:	8b 05 4c 27 00 00    	mov    0x274c(%rip),%eax        # 3750 <stdout>
+    1004:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1007:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    100a:	41 89 c8             	mov    %ecx,%r8d
+    100d:	b9 70 17 00 00       	mov    $0x1770,%ecx
+    1012:	48 8d 35 87 1f 00 00 	lea    0x1f87(%rip),%rsi        # 2fa0 <malloc+0x500>
+    1019:	89 c7                	mov    %eax,%edi
+    101b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1020:	e8 80 12 00 00       	call   22a5 <printf>
+    1025:	8b 05 25 27 00 00    	mov    0x2725(%rip),%eax        # 3750 <stdout>
+    102b:	48 8d 15 fb 1b 00 00 	lea    0x1bfb(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1032:	48 89 d6             	mov    %rdx,%rsi
+    1035:	89 c7                	mov    %eax,%edi
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+    103c:	e8 64 12 00 00       	call   22a5 <printf>
+    1041:	e8 06 18 00 00       	call   284c <exit>
+  for (i = 0; i < num; i++) {
+    1046:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    104a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    104d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1050:	0f 8c 05 fe ff ff    	jl     e5b <fourfiles+0x253>
+    }
+  }
+
+  printf(1, "fourfiles ok\n");
+    1056:	48 8d 05 65 1f 00 00 	lea    0x1f65(%rip),%rax        # 2fc2 <malloc+0x522>
+    105d:	48 89 c6             	mov    %rax,%rsi
+    1060:	bf 01 00 00 00       	mov    $0x1,%edi
+    1065:	b8 00 00 00 00       	mov    $0x0,%eax
+    106a:	e8 36 12 00 00       	call   22a5 <printf>
+}
+    106f:	90                   	nop
+    1070:	c9                   	leave
+    1071:	c3                   	ret
+
+0000000000001072 <simpledelete>:
+
+void simpledelete() {
+    1072:	55                   	push   %rbp
+    1073:	48 89 e5             	mov    %rsp,%rbp
+    1076:	48 83 ec 70          	sub    $0x70,%rsp
+  printf(1, "Starting delete test...\n");
+    107a:	48 8d 05 4f 1f 00 00 	lea    0x1f4f(%rip),%rax        # 2fd0 <malloc+0x530>
+    1081:	48 89 c6             	mov    %rax,%rsi
+    1084:	bf 01 00 00 00       	mov    $0x1,%edi
+    1089:	b8 00 00 00 00       	mov    $0x0,%eax
+    108e:	e8 12 12 00 00       	call   22a5 <printf>
+  // Check a couple cases of things you should never be able to delete
+  if (unlink("file_not_existing") != -1) {
+    1093:	48 8d 05 4f 1f 00 00 	lea    0x1f4f(%rip),%rax        # 2fe9 <malloc+0x549>
+    109a:	48 89 c7             	mov    %rax,%rdi
+    109d:	e8 fa 17 00 00       	call   289c <unlink>
+    10a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10a5:	74 5e                	je     1105 <simpledelete+0x93>
+    error("Able to delete file that doesn't exist");
+    10a7:	8b 05 a3 26 00 00    	mov    0x26a3(%rip),%eax        # 3750 <stdout>
+    10ad:	ba f3 00 00 00       	mov    $0xf3,%edx
+    10b2:	48 8d 0d 31 1b 00 00 	lea    0x1b31(%rip),%rcx        # 2bea <malloc+0x14a>
+    10b9:	48 89 ce             	mov    %rcx,%rsi
+    10bc:	89 c7                	mov    %eax,%edi
+    10be:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c3:	e8 dd 11 00 00       	call   22a5 <printf>
+    10c8:	8b 05 82 26 00 00    	mov    0x2682(%rip),%eax        # 3750 <stdout>
+    10ce:	48 8d 15 2b 1f 00 00 	lea    0x1f2b(%rip),%rdx        # 3000 <malloc+0x560>
+    10d5:	48 89 d6             	mov    %rdx,%rsi
+    10d8:	89 c7                	mov    %eax,%edi
+    10da:	b8 00 00 00 00       	mov    $0x0,%eax
+    10df:	e8 c1 11 00 00       	call   22a5 <printf>
+    10e4:	8b 05 66 26 00 00    	mov    0x2666(%rip),%eax        # 3750 <stdout>
+    10ea:	48 8d 15 3c 1b 00 00 	lea    0x1b3c(%rip),%rdx        # 2c2d <malloc+0x18d>
+    10f1:	48 89 d6             	mov    %rdx,%rsi
+    10f4:	89 c7                	mov    %eax,%edi
+    10f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10fb:	e8 a5 11 00 00       	call   22a5 <printf>
+    1100:	e8 47 17 00 00       	call   284c <exit>
+  }
+  if (unlink("..") != -1 || unlink(".") != -1)
+    1105:	48 8d 05 1b 1f 00 00 	lea    0x1f1b(%rip),%rax        # 3027 <malloc+0x587>
+    110c:	48 89 c7             	mov    %rax,%rdi
+    110f:	e8 88 17 00 00       	call   289c <unlink>
+    1114:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1117:	75 14                	jne    112d <simpledelete+0xbb>
+    1119:	48 8d 05 0a 1f 00 00 	lea    0x1f0a(%rip),%rax        # 302a <malloc+0x58a>
+    1120:	48 89 c7             	mov    %rax,%rdi
+    1123:	e8 74 17 00 00       	call   289c <unlink>
+    1128:	83 f8 ff             	cmp    $0xffffffff,%eax
+    112b:	74 5e                	je     118b <simpledelete+0x119>
+    error("Able to unlink directories");
+    112d:	8b 05 1d 26 00 00    	mov    0x261d(%rip),%eax        # 3750 <stdout>
+    1133:	ba f6 00 00 00       	mov    $0xf6,%edx
+    1138:	48 8d 0d ab 1a 00 00 	lea    0x1aab(%rip),%rcx        # 2bea <malloc+0x14a>
+    113f:	48 89 ce             	mov    %rcx,%rsi
+    1142:	89 c7                	mov    %eax,%edi
+    1144:	b8 00 00 00 00       	mov    $0x0,%eax
+    1149:	e8 57 11 00 00       	call   22a5 <printf>
+    114e:	8b 05 fc 25 00 00    	mov    0x25fc(%rip),%eax        # 3750 <stdout>
+    1154:	48 8d 15 d1 1e 00 00 	lea    0x1ed1(%rip),%rdx        # 302c <malloc+0x58c>
+    115b:	48 89 d6             	mov    %rdx,%rsi
+    115e:	89 c7                	mov    %eax,%edi
+    1160:	b8 00 00 00 00       	mov    $0x0,%eax
+    1165:	e8 3b 11 00 00       	call   22a5 <printf>
+    116a:	8b 05 e0 25 00 00    	mov    0x25e0(%rip),%eax        # 3750 <stdout>
+    1170:	48 8d 15 b6 1a 00 00 	lea    0x1ab6(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1177:	48 89 d6             	mov    %rdx,%rsi
+    117a:	89 c7                	mov    %eax,%edi
+    117c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1181:	e8 1f 11 00 00       	call   22a5 <printf>
+    1186:	e8 c1 16 00 00       	call   284c <exit>
+
+  // Can't delete open file (in this process or another)
+  char* name = "some_other_file";
+    118b:	48 8d 05 b5 1e 00 00 	lea    0x1eb5(%rip),%rax        # 3047 <malloc+0x5a7>
+    1192:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int fd = open(name, O_RDWR | O_CREATE);
+    1196:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    119a:	be 02 02 00 00       	mov    $0x202,%esi
+    119f:	48 89 c7             	mov    %rax,%rdi
+    11a2:	e8 e5 16 00 00       	call   288c <open>
+    11a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    11aa:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    11ae:	75 5e                	jne    120e <simpledelete+0x19c>
+    error("Unable to create file");
+    11b0:	8b 05 9a 25 00 00    	mov    0x259a(%rip),%eax        # 3750 <stdout>
+    11b6:	ba fc 00 00 00       	mov    $0xfc,%edx
+    11bb:	48 8d 0d 28 1a 00 00 	lea    0x1a28(%rip),%rcx        # 2bea <malloc+0x14a>
+    11c2:	48 89 ce             	mov    %rcx,%rsi
+    11c5:	89 c7                	mov    %eax,%edi
+    11c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cc:	e8 d4 10 00 00       	call   22a5 <printf>
+    11d1:	8b 05 79 25 00 00    	mov    0x2579(%rip),%eax        # 3750 <stdout>
+    11d7:	48 8d 15 79 1e 00 00 	lea    0x1e79(%rip),%rdx        # 3057 <malloc+0x5b7>
+    11de:	48 89 d6             	mov    %rdx,%rsi
+    11e1:	89 c7                	mov    %eax,%edi
+    11e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11e8:	e8 b8 10 00 00       	call   22a5 <printf>
+    11ed:	8b 05 5d 25 00 00    	mov    0x255d(%rip),%eax        # 3750 <stdout>
+    11f3:	48 8d 15 33 1a 00 00 	lea    0x1a33(%rip),%rdx        # 2c2d <malloc+0x18d>
+    11fa:	48 89 d6             	mov    %rdx,%rsi
+    11fd:	89 c7                	mov    %eax,%edi
+    11ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1204:	e8 9c 10 00 00       	call   22a5 <printf>
+    1209:	e8 3e 16 00 00       	call   284c <exit>
+  if (unlink(name) != -1)
+    120e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1212:	48 89 c7             	mov    %rax,%rdi
+    1215:	e8 82 16 00 00       	call   289c <unlink>
+    121a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    121d:	74 5e                	je     127d <simpledelete+0x20b>
+    error("Able to delete file that's currently open");
+    121f:	8b 05 2b 25 00 00    	mov    0x252b(%rip),%eax        # 3750 <stdout>
+    1225:	ba fe 00 00 00       	mov    $0xfe,%edx
+    122a:	48 8d 0d b9 19 00 00 	lea    0x19b9(%rip),%rcx        # 2bea <malloc+0x14a>
+    1231:	48 89 ce             	mov    %rcx,%rsi
+    1234:	89 c7                	mov    %eax,%edi
+    1236:	b8 00 00 00 00       	mov    $0x0,%eax
+    123b:	e8 65 10 00 00       	call   22a5 <printf>
+    1240:	8b 05 0a 25 00 00    	mov    0x250a(%rip),%eax        # 3750 <stdout>
+    1246:	48 8d 15 23 1e 00 00 	lea    0x1e23(%rip),%rdx        # 3070 <malloc+0x5d0>
+    124d:	48 89 d6             	mov    %rdx,%rsi
+    1250:	89 c7                	mov    %eax,%edi
+    1252:	b8 00 00 00 00       	mov    $0x0,%eax
+    1257:	e8 49 10 00 00       	call   22a5 <printf>
+    125c:	8b 05 ee 24 00 00    	mov    0x24ee(%rip),%eax        # 3750 <stdout>
+    1262:	48 8d 15 c4 19 00 00 	lea    0x19c4(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1269:	48 89 d6             	mov    %rdx,%rsi
+    126c:	89 c7                	mov    %eax,%edi
+    126e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1273:	e8 2d 10 00 00       	call   22a5 <printf>
+    1278:	e8 cf 15 00 00       	call   284c <exit>
+  if (close(fd) == -1)
+    127d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1280:	89 c7                	mov    %eax,%edi
+    1282:	e8 ed 15 00 00       	call   2874 <close>
+    1287:	83 f8 ff             	cmp    $0xffffffff,%eax
+    128a:	75 5e                	jne    12ea <simpledelete+0x278>
+      error("Unable to close file");
+    128c:	8b 05 be 24 00 00    	mov    0x24be(%rip),%eax        # 3750 <stdout>
+    1292:	ba 00 01 00 00       	mov    $0x100,%edx
+    1297:	48 8d 0d 4c 19 00 00 	lea    0x194c(%rip),%rcx        # 2bea <malloc+0x14a>
+    129e:	48 89 ce             	mov    %rcx,%rsi
+    12a1:	89 c7                	mov    %eax,%edi
+    12a3:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a8:	e8 f8 0f 00 00       	call   22a5 <printf>
+    12ad:	8b 05 9d 24 00 00    	mov    0x249d(%rip),%eax        # 3750 <stdout>
+    12b3:	48 8d 15 e0 1d 00 00 	lea    0x1de0(%rip),%rdx        # 309a <malloc+0x5fa>
+    12ba:	48 89 d6             	mov    %rdx,%rsi
+    12bd:	89 c7                	mov    %eax,%edi
+    12bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    12c4:	e8 dc 0f 00 00       	call   22a5 <printf>
+    12c9:	8b 05 81 24 00 00    	mov    0x2481(%rip),%eax        # 3750 <stdout>
+    12cf:	48 8d 15 57 19 00 00 	lea    0x1957(%rip),%rdx        # 2c2d <malloc+0x18d>
+    12d6:	48 89 d6             	mov    %rdx,%rsi
+    12d9:	89 c7                	mov    %eax,%edi
+    12db:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e0:	e8 c0 0f 00 00       	call   22a5 <printf>
+    12e5:	e8 62 15 00 00       	call   284c <exit>
+
+  int pid = fork();
+    12ea:	e8 55 15 00 00       	call   2844 <fork>
+    12ef:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  if (pid == 0) {
+    12f2:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+    12f6:	75 20                	jne    1318 <simpledelete+0x2a6>
+    open(name, O_RDWR);
+    12f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12fc:	be 02 00 00 00       	mov    $0x2,%esi
+    1301:	48 89 c7             	mov    %rax,%rdi
+    1304:	e8 83 15 00 00       	call   288c <open>
+    sleep(999999999);
+    1309:	bf ff c9 9a 3b       	mov    $0x3b9ac9ff,%edi
+    130e:	e8 c9 15 00 00       	call   28dc <sleep>
+    exit();
+    1313:	e8 34 15 00 00       	call   284c <exit>
+  } else {
+    sleep(20); // Should be enough time
+    1318:	bf 14 00 00 00       	mov    $0x14,%edi
+    131d:	e8 ba 15 00 00       	call   28dc <sleep>
+    if (unlink(name) != -1)
+    1322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1326:	48 89 c7             	mov    %rax,%rdi
+    1329:	e8 6e 15 00 00       	call   289c <unlink>
+    132e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1331:	74 5e                	je     1391 <simpledelete+0x31f>
+      error("Able to delete file that's open in another process");
+    1333:	8b 05 17 24 00 00    	mov    0x2417(%rip),%eax        # 3750 <stdout>
+    1339:	ba 0a 01 00 00       	mov    $0x10a,%edx
+    133e:	48 8d 0d a5 18 00 00 	lea    0x18a5(%rip),%rcx        # 2bea <malloc+0x14a>
+    1345:	48 89 ce             	mov    %rcx,%rsi
+    1348:	89 c7                	mov    %eax,%edi
+    134a:	b8 00 00 00 00       	mov    $0x0,%eax
+    134f:	e8 51 0f 00 00       	call   22a5 <printf>
+    1354:	8b 05 f6 23 00 00    	mov    0x23f6(%rip),%eax        # 3750 <stdout>
+    135a:	48 8d 15 4f 1d 00 00 	lea    0x1d4f(%rip),%rdx        # 30b0 <malloc+0x610>
+    1361:	48 89 d6             	mov    %rdx,%rsi
+    1364:	89 c7                	mov    %eax,%edi
+    1366:	b8 00 00 00 00       	mov    $0x0,%eax
+    136b:	e8 35 0f 00 00       	call   22a5 <printf>
+    1370:	8b 05 da 23 00 00    	mov    0x23da(%rip),%eax        # 3750 <stdout>
+    1376:	48 8d 15 b0 18 00 00 	lea    0x18b0(%rip),%rdx        # 2c2d <malloc+0x18d>
+    137d:	48 89 d6             	mov    %rdx,%rsi
+    1380:	89 c7                	mov    %eax,%edi
+    1382:	b8 00 00 00 00       	mov    $0x0,%eax
+    1387:	e8 19 0f 00 00       	call   22a5 <printf>
+    138c:	e8 bb 14 00 00       	call   284c <exit>
+    kill(pid);
+    1391:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1394:	89 c7                	mov    %eax,%edi
+    1396:	e8 e1 14 00 00       	call   287c <kill>
+    wait();
+    139b:	e8 b4 14 00 00       	call   2854 <wait>
+  }
+  if (unlink(name) == -1)
+    13a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a4:	48 89 c7             	mov    %rax,%rdi
+    13a7:	e8 f0 14 00 00       	call   289c <unlink>
+    13ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13af:	75 5e                	jne    140f <simpledelete+0x39d>
+    error("Unable to delete file once all references closed");
+    13b1:	8b 05 99 23 00 00    	mov    0x2399(%rip),%eax        # 3750 <stdout>
+    13b7:	ba 0f 01 00 00       	mov    $0x10f,%edx
+    13bc:	48 8d 0d 27 18 00 00 	lea    0x1827(%rip),%rcx        # 2bea <malloc+0x14a>
+    13c3:	48 89 ce             	mov    %rcx,%rsi
+    13c6:	89 c7                	mov    %eax,%edi
+    13c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13cd:	e8 d3 0e 00 00       	call   22a5 <printf>
+    13d2:	8b 05 78 23 00 00    	mov    0x2378(%rip),%eax        # 3750 <stdout>
+    13d8:	48 8d 15 09 1d 00 00 	lea    0x1d09(%rip),%rdx        # 30e8 <malloc+0x648>
+    13df:	48 89 d6             	mov    %rdx,%rsi
+    13e2:	89 c7                	mov    %eax,%edi
+    13e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e9:	e8 b7 0e 00 00       	call   22a5 <printf>
+    13ee:	8b 05 5c 23 00 00    	mov    0x235c(%rip),%eax        # 3750 <stdout>
+    13f4:	48 8d 15 32 18 00 00 	lea    0x1832(%rip),%rdx        # 2c2d <malloc+0x18d>
+    13fb:	48 89 d6             	mov    %rdx,%rsi
+    13fe:	89 c7                	mov    %eax,%edi
+    1400:	b8 00 00 00 00       	mov    $0x0,%eax
+    1405:	e8 9b 0e 00 00       	call   22a5 <printf>
+    140a:	e8 3d 14 00 00       	call   284c <exit>
+  if (open(name, O_RDWR) != -1)
+    140f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1413:	be 02 00 00 00       	mov    $0x2,%esi
+    1418:	48 89 c7             	mov    %rax,%rdi
+    141b:	e8 6c 14 00 00       	call   288c <open>
+    1420:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1423:	74 5e                	je     1483 <simpledelete+0x411>
+    error("Able to open already-deleted file");
+    1425:	8b 05 25 23 00 00    	mov    0x2325(%rip),%eax        # 3750 <stdout>
+    142b:	ba 11 01 00 00       	mov    $0x111,%edx
+    1430:	48 8d 0d b3 17 00 00 	lea    0x17b3(%rip),%rcx        # 2bea <malloc+0x14a>
+    1437:	48 89 ce             	mov    %rcx,%rsi
+    143a:	89 c7                	mov    %eax,%edi
+    143c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1441:	e8 5f 0e 00 00       	call   22a5 <printf>
+    1446:	8b 05 04 23 00 00    	mov    0x2304(%rip),%eax        # 3750 <stdout>
+    144c:	48 8d 15 cd 1c 00 00 	lea    0x1ccd(%rip),%rdx        # 3120 <malloc+0x680>
+    1453:	48 89 d6             	mov    %rdx,%rsi
+    1456:	89 c7                	mov    %eax,%edi
+    1458:	b8 00 00 00 00       	mov    $0x0,%eax
+    145d:	e8 43 0e 00 00       	call   22a5 <printf>
+    1462:	8b 05 e8 22 00 00    	mov    0x22e8(%rip),%eax        # 3750 <stdout>
+    1468:	48 8d 15 be 17 00 00 	lea    0x17be(%rip),%rdx        # 2c2d <malloc+0x18d>
+    146f:	48 89 d6             	mov    %rdx,%rsi
+    1472:	89 c7                	mov    %eax,%edi
+    1474:	b8 00 00 00 00       	mov    $0x0,%eax
+    1479:	e8 27 0e 00 00       	call   22a5 <printf>
+    147e:	e8 c9 13 00 00       	call   284c <exit>
+
+  printf(1, "  delete open ok\n");
+    1483:	48 8d 05 b8 1c 00 00 	lea    0x1cb8(%rip),%rax        # 3142 <malloc+0x6a2>
+    148a:	48 89 c6             	mov    %rax,%rsi
+    148d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1492:	b8 00 00 00 00       	mov    $0x0,%eax
+    1497:	e8 09 0e 00 00       	call   22a5 <printf>
+
+  // Make sure deleting one file doesn't interfere with other open ones
+  char* n1 = "small.txt";
+    149c:	48 8d 05 3d 17 00 00 	lea    0x173d(%rip),%rax        # 2be0 <malloc+0x140>
+    14a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  char* n2 = "arbitrary";
+    14a7:	48 8d 05 a6 1c 00 00 	lea    0x1ca6(%rip),%rax        # 3154 <malloc+0x6b4>
+    14ae:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  int fdn1 = open(n1, O_RDWR);
+    14b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b6:	be 02 00 00 00       	mov    $0x2,%esi
+    14bb:	48 89 c7             	mov    %rax,%rdi
+    14be:	e8 c9 13 00 00       	call   288c <open>
+    14c3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  int fdn2 = open(n2, O_RDWR | O_CREATE);
+    14c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    14ca:	be 02 02 00 00       	mov    $0x202,%esi
+    14cf:	48 89 c7             	mov    %rax,%rdi
+    14d2:	e8 b5 13 00 00       	call   288c <open>
+    14d7:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  if (fdn1 == -1 || fdn2 == -1)
+    14da:	83 7d d4 ff          	cmpl   $0xffffffff,-0x2c(%rbp)
+    14de:	74 06                	je     14e6 <simpledelete+0x474>
+    14e0:	83 7d d0 ff          	cmpl   $0xffffffff,-0x30(%rbp)
+    14e4:	75 5e                	jne    1544 <simpledelete+0x4d2>
+    error("error opening files");
+    14e6:	8b 05 64 22 00 00    	mov    0x2264(%rip),%eax        # 3750 <stdout>
+    14ec:	ba 1b 01 00 00       	mov    $0x11b,%edx
+    14f1:	48 8d 0d f2 16 00 00 	lea    0x16f2(%rip),%rcx        # 2bea <malloc+0x14a>
+    14f8:	48 89 ce             	mov    %rcx,%rsi
+    14fb:	89 c7                	mov    %eax,%edi
+    14fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1502:	e8 9e 0d 00 00       	call   22a5 <printf>
+    1507:	8b 05 43 22 00 00    	mov    0x2243(%rip),%eax        # 3750 <stdout>
+    150d:	48 8d 15 4a 1c 00 00 	lea    0x1c4a(%rip),%rdx        # 315e <malloc+0x6be>
+    1514:	48 89 d6             	mov    %rdx,%rsi
+    1517:	89 c7                	mov    %eax,%edi
+    1519:	b8 00 00 00 00       	mov    $0x0,%eax
+    151e:	e8 82 0d 00 00       	call   22a5 <printf>
+    1523:	8b 05 27 22 00 00    	mov    0x2227(%rip),%eax        # 3750 <stdout>
+    1529:	48 8d 15 fd 16 00 00 	lea    0x16fd(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1530:	48 89 d6             	mov    %rdx,%rsi
+    1533:	89 c7                	mov    %eax,%edi
+    1535:	b8 00 00 00 00       	mov    $0x0,%eax
+    153a:	e8 66 0d 00 00       	call   22a5 <printf>
+    153f:	e8 08 13 00 00       	call   284c <exit>
+  if (close(fdn2) == -1)
+    1544:	8b 45 d0             	mov    -0x30(%rbp),%eax
+    1547:	89 c7                	mov    %eax,%edi
+    1549:	e8 26 13 00 00       	call   2874 <close>
+    154e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1551:	75 5e                	jne    15b1 <simpledelete+0x53f>
+    error("error closing arbitrary");
+    1553:	8b 05 f7 21 00 00    	mov    0x21f7(%rip),%eax        # 3750 <stdout>
+    1559:	ba 1d 01 00 00       	mov    $0x11d,%edx
+    155e:	48 8d 0d 85 16 00 00 	lea    0x1685(%rip),%rcx        # 2bea <malloc+0x14a>
+    1565:	48 89 ce             	mov    %rcx,%rsi
+    1568:	89 c7                	mov    %eax,%edi
+    156a:	b8 00 00 00 00       	mov    $0x0,%eax
+    156f:	e8 31 0d 00 00       	call   22a5 <printf>
+    1574:	8b 05 d6 21 00 00    	mov    0x21d6(%rip),%eax        # 3750 <stdout>
+    157a:	48 8d 15 f1 1b 00 00 	lea    0x1bf1(%rip),%rdx        # 3172 <malloc+0x6d2>
+    1581:	48 89 d6             	mov    %rdx,%rsi
+    1584:	89 c7                	mov    %eax,%edi
+    1586:	b8 00 00 00 00       	mov    $0x0,%eax
+    158b:	e8 15 0d 00 00       	call   22a5 <printf>
+    1590:	8b 05 ba 21 00 00    	mov    0x21ba(%rip),%eax        # 3750 <stdout>
+    1596:	48 8d 15 90 16 00 00 	lea    0x1690(%rip),%rdx        # 2c2d <malloc+0x18d>
+    159d:	48 89 d6             	mov    %rdx,%rsi
+    15a0:	89 c7                	mov    %eax,%edi
+    15a2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15a7:	e8 f9 0c 00 00       	call   22a5 <printf>
+    15ac:	e8 9b 12 00 00       	call   284c <exit>
+  if (unlink(n2) == -1)
+    15b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15b5:	48 89 c7             	mov    %rax,%rdi
+    15b8:	e8 df 12 00 00       	call   289c <unlink>
+    15bd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15c0:	75 5e                	jne    1620 <simpledelete+0x5ae>
+    error("error unlinking arbitrary");
+    15c2:	8b 05 88 21 00 00    	mov    0x2188(%rip),%eax        # 3750 <stdout>
+    15c8:	ba 1f 01 00 00       	mov    $0x11f,%edx
+    15cd:	48 8d 0d 16 16 00 00 	lea    0x1616(%rip),%rcx        # 2bea <malloc+0x14a>
+    15d4:	48 89 ce             	mov    %rcx,%rsi
+    15d7:	89 c7                	mov    %eax,%edi
+    15d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    15de:	e8 c2 0c 00 00       	call   22a5 <printf>
+    15e3:	8b 05 67 21 00 00    	mov    0x2167(%rip),%eax        # 3750 <stdout>
+    15e9:	48 8d 15 9a 1b 00 00 	lea    0x1b9a(%rip),%rdx        # 318a <malloc+0x6ea>
+    15f0:	48 89 d6             	mov    %rdx,%rsi
+    15f3:	89 c7                	mov    %eax,%edi
+    15f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    15fa:	e8 a6 0c 00 00       	call   22a5 <printf>
+    15ff:	8b 05 4b 21 00 00    	mov    0x214b(%rip),%eax        # 3750 <stdout>
+    1605:	48 8d 15 21 16 00 00 	lea    0x1621(%rip),%rdx        # 2c2d <malloc+0x18d>
+    160c:	48 89 d6             	mov    %rdx,%rsi
+    160f:	89 c7                	mov    %eax,%edi
+    1611:	b8 00 00 00 00       	mov    $0x0,%eax
+    1616:	e8 8a 0c 00 00       	call   22a5 <printf>
+    161b:	e8 2c 12 00 00       	call   284c <exit>
+  if (read(fdn1, buf, 62) == -1)
+    1620:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+    1623:	ba 3e 00 00 00       	mov    $0x3e,%edx
+    1628:	48 8d 0d 71 21 00 00 	lea    0x2171(%rip),%rcx        # 37a0 <buf>
+    162f:	48 89 ce             	mov    %rcx,%rsi
+    1632:	89 c7                	mov    %eax,%edi
+    1634:	e8 2b 12 00 00       	call   2864 <read>
+    1639:	83 f8 ff             	cmp    $0xffffffff,%eax
+    163c:	75 5e                	jne    169c <simpledelete+0x62a>
+    error("couldn't read from small after unlink");
+    163e:	8b 05 0c 21 00 00    	mov    0x210c(%rip),%eax        # 3750 <stdout>
+    1644:	ba 21 01 00 00       	mov    $0x121,%edx
+    1649:	48 8d 0d 9a 15 00 00 	lea    0x159a(%rip),%rcx        # 2bea <malloc+0x14a>
+    1650:	48 89 ce             	mov    %rcx,%rsi
+    1653:	89 c7                	mov    %eax,%edi
+    1655:	b8 00 00 00 00       	mov    $0x0,%eax
+    165a:	e8 46 0c 00 00       	call   22a5 <printf>
+    165f:	8b 05 eb 20 00 00    	mov    0x20eb(%rip),%eax        # 3750 <stdout>
+    1665:	48 8d 15 3c 1b 00 00 	lea    0x1b3c(%rip),%rdx        # 31a8 <malloc+0x708>
+    166c:	48 89 d6             	mov    %rdx,%rsi
+    166f:	89 c7                	mov    %eax,%edi
+    1671:	b8 00 00 00 00       	mov    $0x0,%eax
+    1676:	e8 2a 0c 00 00       	call   22a5 <printf>
+    167b:	8b 05 cf 20 00 00    	mov    0x20cf(%rip),%eax        # 3750 <stdout>
+    1681:	48 8d 15 a5 15 00 00 	lea    0x15a5(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1688:	48 89 d6             	mov    %rdx,%rsi
+    168b:	89 c7                	mov    %eax,%edi
+    168d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1692:	e8 0e 0c 00 00       	call   22a5 <printf>
+    1697:	e8 b0 11 00 00       	call   284c <exit>
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+    169c:	48 8d 05 4d 16 00 00 	lea    0x164d(%rip),%rax        # 2cf0 <malloc+0x250>
+    16a3:	48 89 c6             	mov    %rax,%rsi
+    16a6:	48 8d 05 f3 20 00 00 	lea    0x20f3(%rip),%rax        # 37a0 <buf>
+    16ad:	48 89 c7             	mov    %rax,%rdi
+    16b0:	e8 31 0f 00 00       	call   25e6 <strcmp>
+    16b5:	85 c0                	test   %eax,%eax
+    16b7:	74 65                	je     171e <simpledelete+0x6ac>
+    error("file content did not match expected after unlink, was: '%s'", buf);
+    16b9:	8b 05 91 20 00 00    	mov    0x2091(%rip),%eax        # 3750 <stdout>
+    16bf:	ba 23 01 00 00       	mov    $0x123,%edx
+    16c4:	48 8d 0d 1f 15 00 00 	lea    0x151f(%rip),%rcx        # 2bea <malloc+0x14a>
+    16cb:	48 89 ce             	mov    %rcx,%rsi
+    16ce:	89 c7                	mov    %eax,%edi
+    16d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    16d5:	e8 cb 0b 00 00       	call   22a5 <printf>
+    16da:	8b 05 70 20 00 00    	mov    0x2070(%rip),%eax        # 3750 <stdout>
+    16e0:	48 8d 15 b9 20 00 00 	lea    0x20b9(%rip),%rdx        # 37a0 <buf>
+    16e7:	48 8d 0d e2 1a 00 00 	lea    0x1ae2(%rip),%rcx        # 31d0 <malloc+0x730>
+    16ee:	48 89 ce             	mov    %rcx,%rsi
+    16f1:	89 c7                	mov    %eax,%edi
+    16f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f8:	e8 a8 0b 00 00       	call   22a5 <printf>
+    16fd:	8b 05 4d 20 00 00    	mov    0x204d(%rip),%eax        # 3750 <stdout>
+    1703:	48 8d 15 23 15 00 00 	lea    0x1523(%rip),%rdx        # 2c2d <malloc+0x18d>
+    170a:	48 89 d6             	mov    %rdx,%rsi
+    170d:	89 c7                	mov    %eax,%edi
+    170f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1714:	e8 8c 0b 00 00       	call   22a5 <printf>
+    1719:	e8 2e 11 00 00       	call   284c <exit>
+
+  // Check inum usage/reuse and ordering
+  struct stat ss;
+  int fd1 = open("df1", O_RDWR | O_CREATE);
+    171e:	be 02 02 00 00       	mov    $0x202,%esi
+    1723:	48 8d 05 e2 1a 00 00 	lea    0x1ae2(%rip),%rax        # 320c <malloc+0x76c>
+    172a:	48 89 c7             	mov    %rax,%rdi
+    172d:	e8 5a 11 00 00       	call   288c <open>
+    1732:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  if (fd1 == -1)
+    1735:	83 7d cc ff          	cmpl   $0xffffffff,-0x34(%rbp)
+    1739:	75 5e                	jne    1799 <simpledelete+0x727>
+    error("Unable to open df1");
+    173b:	8b 05 0f 20 00 00    	mov    0x200f(%rip),%eax        # 3750 <stdout>
+    1741:	ba 29 01 00 00       	mov    $0x129,%edx
+    1746:	48 8d 0d 9d 14 00 00 	lea    0x149d(%rip),%rcx        # 2bea <malloc+0x14a>
+    174d:	48 89 ce             	mov    %rcx,%rsi
+    1750:	89 c7                	mov    %eax,%edi
+    1752:	b8 00 00 00 00       	mov    $0x0,%eax
+    1757:	e8 49 0b 00 00       	call   22a5 <printf>
+    175c:	8b 05 ee 1f 00 00    	mov    0x1fee(%rip),%eax        # 3750 <stdout>
+    1762:	48 8d 15 a7 1a 00 00 	lea    0x1aa7(%rip),%rdx        # 3210 <malloc+0x770>
+    1769:	48 89 d6             	mov    %rdx,%rsi
+    176c:	89 c7                	mov    %eax,%edi
+    176e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1773:	e8 2d 0b 00 00       	call   22a5 <printf>
+    1778:	8b 05 d2 1f 00 00    	mov    0x1fd2(%rip),%eax        # 3750 <stdout>
+    177e:	48 8d 15 a8 14 00 00 	lea    0x14a8(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1785:	48 89 d6             	mov    %rdx,%rsi
+    1788:	89 c7                	mov    %eax,%edi
+    178a:	b8 00 00 00 00       	mov    $0x0,%eax
+    178f:	e8 11 0b 00 00       	call   22a5 <printf>
+    1794:	e8 b3 10 00 00       	call   284c <exit>
+  if (fstat(fd1, &ss) == -1)
+    1799:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    179d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    17a0:	48 89 d6             	mov    %rdx,%rsi
+    17a3:	89 c7                	mov    %eax,%edi
+    17a5:	e8 fa 10 00 00       	call   28a4 <fstat>
+    17aa:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17ad:	75 5e                	jne    180d <simpledelete+0x79b>
+    error("Unable to stat open df1");
+    17af:	8b 05 9b 1f 00 00    	mov    0x1f9b(%rip),%eax        # 3750 <stdout>
+    17b5:	ba 2b 01 00 00       	mov    $0x12b,%edx
+    17ba:	48 8d 0d 29 14 00 00 	lea    0x1429(%rip),%rcx        # 2bea <malloc+0x14a>
+    17c1:	48 89 ce             	mov    %rcx,%rsi
+    17c4:	89 c7                	mov    %eax,%edi
+    17c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    17cb:	e8 d5 0a 00 00       	call   22a5 <printf>
+    17d0:	8b 05 7a 1f 00 00    	mov    0x1f7a(%rip),%eax        # 3750 <stdout>
+    17d6:	48 8d 15 46 1a 00 00 	lea    0x1a46(%rip),%rdx        # 3223 <malloc+0x783>
+    17dd:	48 89 d6             	mov    %rdx,%rsi
+    17e0:	89 c7                	mov    %eax,%edi
+    17e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    17e7:	e8 b9 0a 00 00       	call   22a5 <printf>
+    17ec:	8b 05 5e 1f 00 00    	mov    0x1f5e(%rip),%eax        # 3750 <stdout>
+    17f2:	48 8d 15 34 14 00 00 	lea    0x1434(%rip),%rdx        # 2c2d <malloc+0x18d>
+    17f9:	48 89 d6             	mov    %rdx,%rsi
+    17fc:	89 c7                	mov    %eax,%edi
+    17fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1803:	e8 9d 0a 00 00       	call   22a5 <printf>
+    1808:	e8 3f 10 00 00       	call   284c <exit>
+  int in1 = ss.ino;
+    180d:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1810:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  int fd2 = open("df2", O_RDWR | O_CREATE);
+    1813:	be 02 02 00 00       	mov    $0x202,%esi
+    1818:	48 8d 05 1c 1a 00 00 	lea    0x1a1c(%rip),%rax        # 323b <malloc+0x79b>
+    181f:	48 89 c7             	mov    %rax,%rdi
+    1822:	e8 65 10 00 00       	call   288c <open>
+    1827:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+  if (fd2 == -1)
+    182a:	83 7d c4 ff          	cmpl   $0xffffffff,-0x3c(%rbp)
+    182e:	75 5e                	jne    188e <simpledelete+0x81c>
+    error("Unable to open df2");
+    1830:	8b 05 1a 1f 00 00    	mov    0x1f1a(%rip),%eax        # 3750 <stdout>
+    1836:	ba 2f 01 00 00       	mov    $0x12f,%edx
+    183b:	48 8d 0d a8 13 00 00 	lea    0x13a8(%rip),%rcx        # 2bea <malloc+0x14a>
+    1842:	48 89 ce             	mov    %rcx,%rsi
+    1845:	89 c7                	mov    %eax,%edi
+    1847:	b8 00 00 00 00       	mov    $0x0,%eax
+    184c:	e8 54 0a 00 00       	call   22a5 <printf>
+    1851:	8b 05 f9 1e 00 00    	mov    0x1ef9(%rip),%eax        # 3750 <stdout>
+    1857:	48 8d 15 e1 19 00 00 	lea    0x19e1(%rip),%rdx        # 323f <malloc+0x79f>
+    185e:	48 89 d6             	mov    %rdx,%rsi
+    1861:	89 c7                	mov    %eax,%edi
+    1863:	b8 00 00 00 00       	mov    $0x0,%eax
+    1868:	e8 38 0a 00 00       	call   22a5 <printf>
+    186d:	8b 05 dd 1e 00 00    	mov    0x1edd(%rip),%eax        # 3750 <stdout>
+    1873:	48 8d 15 b3 13 00 00 	lea    0x13b3(%rip),%rdx        # 2c2d <malloc+0x18d>
+    187a:	48 89 d6             	mov    %rdx,%rsi
+    187d:	89 c7                	mov    %eax,%edi
+    187f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1884:	e8 1c 0a 00 00       	call   22a5 <printf>
+    1889:	e8 be 0f 00 00       	call   284c <exit>
+  if (fstat(fd2, &ss) == -1)
+    188e:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1892:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1895:	48 89 d6             	mov    %rdx,%rsi
+    1898:	89 c7                	mov    %eax,%edi
+    189a:	e8 05 10 00 00       	call   28a4 <fstat>
+    189f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18a2:	75 5e                	jne    1902 <simpledelete+0x890>
+    error("Unable to stat open df2");
+    18a4:	8b 05 a6 1e 00 00    	mov    0x1ea6(%rip),%eax        # 3750 <stdout>
+    18aa:	ba 31 01 00 00       	mov    $0x131,%edx
+    18af:	48 8d 0d 34 13 00 00 	lea    0x1334(%rip),%rcx        # 2bea <malloc+0x14a>
+    18b6:	48 89 ce             	mov    %rcx,%rsi
+    18b9:	89 c7                	mov    %eax,%edi
+    18bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    18c0:	e8 e0 09 00 00       	call   22a5 <printf>
+    18c5:	8b 05 85 1e 00 00    	mov    0x1e85(%rip),%eax        # 3750 <stdout>
+    18cb:	48 8d 15 80 19 00 00 	lea    0x1980(%rip),%rdx        # 3252 <malloc+0x7b2>
+    18d2:	48 89 d6             	mov    %rdx,%rsi
+    18d5:	89 c7                	mov    %eax,%edi
+    18d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    18dc:	e8 c4 09 00 00       	call   22a5 <printf>
+    18e1:	8b 05 69 1e 00 00    	mov    0x1e69(%rip),%eax        # 3750 <stdout>
+    18e7:	48 8d 15 3f 13 00 00 	lea    0x133f(%rip),%rdx        # 2c2d <malloc+0x18d>
+    18ee:	48 89 d6             	mov    %rdx,%rsi
+    18f1:	89 c7                	mov    %eax,%edi
+    18f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    18f8:	e8 a8 09 00 00       	call   22a5 <printf>
+    18fd:	e8 4a 0f 00 00       	call   284c <exit>
+  int in2 = ss.ino;
+    1902:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1905:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  if (close(fd1) == -1)
+    1908:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    190b:	89 c7                	mov    %eax,%edi
+    190d:	e8 62 0f 00 00       	call   2874 <close>
+    1912:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1915:	75 5e                	jne    1975 <simpledelete+0x903>
+    error("unable to close df1");
+    1917:	8b 05 33 1e 00 00    	mov    0x1e33(%rip),%eax        # 3750 <stdout>
+    191d:	ba 34 01 00 00       	mov    $0x134,%edx
+    1922:	48 8d 0d c1 12 00 00 	lea    0x12c1(%rip),%rcx        # 2bea <malloc+0x14a>
+    1929:	48 89 ce             	mov    %rcx,%rsi
+    192c:	89 c7                	mov    %eax,%edi
+    192e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1933:	e8 6d 09 00 00       	call   22a5 <printf>
+    1938:	8b 05 12 1e 00 00    	mov    0x1e12(%rip),%eax        # 3750 <stdout>
+    193e:	48 8d 15 25 19 00 00 	lea    0x1925(%rip),%rdx        # 326a <malloc+0x7ca>
+    1945:	48 89 d6             	mov    %rdx,%rsi
+    1948:	89 c7                	mov    %eax,%edi
+    194a:	b8 00 00 00 00       	mov    $0x0,%eax
+    194f:	e8 51 09 00 00       	call   22a5 <printf>
+    1954:	8b 05 f6 1d 00 00    	mov    0x1df6(%rip),%eax        # 3750 <stdout>
+    195a:	48 8d 15 cc 12 00 00 	lea    0x12cc(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1961:	48 89 d6             	mov    %rdx,%rsi
+    1964:	89 c7                	mov    %eax,%edi
+    1966:	b8 00 00 00 00       	mov    $0x0,%eax
+    196b:	e8 35 09 00 00       	call   22a5 <printf>
+    1970:	e8 d7 0e 00 00       	call   284c <exit>
+  if (unlink("df1") == -1)
+    1975:	48 8d 05 90 18 00 00 	lea    0x1890(%rip),%rax        # 320c <malloc+0x76c>
+    197c:	48 89 c7             	mov    %rax,%rdi
+    197f:	e8 18 0f 00 00       	call   289c <unlink>
+    1984:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1987:	75 5e                	jne    19e7 <simpledelete+0x975>
+    error("unable to unlink df1");
+    1989:	8b 05 c1 1d 00 00    	mov    0x1dc1(%rip),%eax        # 3750 <stdout>
+    198f:	ba 36 01 00 00       	mov    $0x136,%edx
+    1994:	48 8d 0d 4f 12 00 00 	lea    0x124f(%rip),%rcx        # 2bea <malloc+0x14a>
+    199b:	48 89 ce             	mov    %rcx,%rsi
+    199e:	89 c7                	mov    %eax,%edi
+    19a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    19a5:	e8 fb 08 00 00       	call   22a5 <printf>
+    19aa:	8b 05 a0 1d 00 00    	mov    0x1da0(%rip),%eax        # 3750 <stdout>
+    19b0:	48 8d 15 c7 18 00 00 	lea    0x18c7(%rip),%rdx        # 327e <malloc+0x7de>
+    19b7:	48 89 d6             	mov    %rdx,%rsi
+    19ba:	89 c7                	mov    %eax,%edi
+    19bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    19c1:	e8 df 08 00 00       	call   22a5 <printf>
+    19c6:	8b 05 84 1d 00 00    	mov    0x1d84(%rip),%eax        # 3750 <stdout>
+    19cc:	48 8d 15 5a 12 00 00 	lea    0x125a(%rip),%rdx        # 2c2d <malloc+0x18d>
+    19d3:	48 89 d6             	mov    %rdx,%rsi
+    19d6:	89 c7                	mov    %eax,%edi
+    19d8:	b8 00 00 00 00       	mov    $0x0,%eax
+    19dd:	e8 c3 08 00 00       	call   22a5 <printf>
+    19e2:	e8 65 0e 00 00       	call   284c <exit>
+  int fd3 = open("df3", O_RDWR | O_CREATE);
+    19e7:	be 02 02 00 00       	mov    $0x202,%esi
+    19ec:	48 8d 05 a0 18 00 00 	lea    0x18a0(%rip),%rax        # 3293 <malloc+0x7f3>
+    19f3:	48 89 c7             	mov    %rax,%rdi
+    19f6:	e8 91 0e 00 00       	call   288c <open>
+    19fb:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  if (fd3 == -1)
+    19fe:	83 7d bc ff          	cmpl   $0xffffffff,-0x44(%rbp)
+    1a02:	75 5e                	jne    1a62 <simpledelete+0x9f0>
+    error("Unable to open df3");
+    1a04:	8b 05 46 1d 00 00    	mov    0x1d46(%rip),%eax        # 3750 <stdout>
+    1a0a:	ba 39 01 00 00       	mov    $0x139,%edx
+    1a0f:	48 8d 0d d4 11 00 00 	lea    0x11d4(%rip),%rcx        # 2bea <malloc+0x14a>
+    1a16:	48 89 ce             	mov    %rcx,%rsi
+    1a19:	89 c7                	mov    %eax,%edi
+    1a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a20:	e8 80 08 00 00       	call   22a5 <printf>
+    1a25:	8b 05 25 1d 00 00    	mov    0x1d25(%rip),%eax        # 3750 <stdout>
+    1a2b:	48 8d 15 65 18 00 00 	lea    0x1865(%rip),%rdx        # 3297 <malloc+0x7f7>
+    1a32:	48 89 d6             	mov    %rdx,%rsi
+    1a35:	89 c7                	mov    %eax,%edi
+    1a37:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a3c:	e8 64 08 00 00       	call   22a5 <printf>
+    1a41:	8b 05 09 1d 00 00    	mov    0x1d09(%rip),%eax        # 3750 <stdout>
+    1a47:	48 8d 15 df 11 00 00 	lea    0x11df(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1a4e:	48 89 d6             	mov    %rdx,%rsi
+    1a51:	89 c7                	mov    %eax,%edi
+    1a53:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a58:	e8 48 08 00 00       	call   22a5 <printf>
+    1a5d:	e8 ea 0d 00 00       	call   284c <exit>
+  if (fstat(fd3, &ss) == -1)
+    1a62:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1a66:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    1a69:	48 89 d6             	mov    %rdx,%rsi
+    1a6c:	89 c7                	mov    %eax,%edi
+    1a6e:	e8 31 0e 00 00       	call   28a4 <fstat>
+    1a73:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a76:	75 5e                	jne    1ad6 <simpledelete+0xa64>
+    error("Unable to stat open file");
+    1a78:	8b 05 d2 1c 00 00    	mov    0x1cd2(%rip),%eax        # 3750 <stdout>
+    1a7e:	ba 3b 01 00 00       	mov    $0x13b,%edx
+    1a83:	48 8d 0d 60 11 00 00 	lea    0x1160(%rip),%rcx        # 2bea <malloc+0x14a>
+    1a8a:	48 89 ce             	mov    %rcx,%rsi
+    1a8d:	89 c7                	mov    %eax,%edi
+    1a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a94:	e8 0c 08 00 00       	call   22a5 <printf>
+    1a99:	8b 05 b1 1c 00 00    	mov    0x1cb1(%rip),%eax        # 3750 <stdout>
+    1a9f:	48 8d 15 04 18 00 00 	lea    0x1804(%rip),%rdx        # 32aa <malloc+0x80a>
+    1aa6:	48 89 d6             	mov    %rdx,%rsi
+    1aa9:	89 c7                	mov    %eax,%edi
+    1aab:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab0:	e8 f0 07 00 00       	call   22a5 <printf>
+    1ab5:	8b 05 95 1c 00 00    	mov    0x1c95(%rip),%eax        # 3750 <stdout>
+    1abb:	48 8d 15 6b 11 00 00 	lea    0x116b(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1ac2:	48 89 d6             	mov    %rdx,%rsi
+    1ac5:	89 c7                	mov    %eax,%edi
+    1ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1acc:	e8 d4 07 00 00       	call   22a5 <printf>
+    1ad1:	e8 76 0d 00 00       	call   284c <exit>
+  int in3 = ss.ino;
+    1ad6:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  if (in3 != in1 || in3 == in2)
+    1adc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1adf:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    1ae2:	75 08                	jne    1aec <simpledelete+0xa7a>
+    1ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1ae7:	3b 45 c0             	cmp    -0x40(%rbp),%eax
+    1aea:	75 5e                	jne    1b4a <simpledelete+0xad8>
+    error("File allocation does not reuse inums");
+    1aec:	8b 05 5e 1c 00 00    	mov    0x1c5e(%rip),%eax        # 3750 <stdout>
+    1af2:	ba 3e 01 00 00       	mov    $0x13e,%edx
+    1af7:	48 8d 0d ec 10 00 00 	lea    0x10ec(%rip),%rcx        # 2bea <malloc+0x14a>
+    1afe:	48 89 ce             	mov    %rcx,%rsi
+    1b01:	89 c7                	mov    %eax,%edi
+    1b03:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b08:	e8 98 07 00 00       	call   22a5 <printf>
+    1b0d:	8b 05 3d 1c 00 00    	mov    0x1c3d(%rip),%eax        # 3750 <stdout>
+    1b13:	48 8d 15 ae 17 00 00 	lea    0x17ae(%rip),%rdx        # 32c8 <malloc+0x828>
+    1b1a:	48 89 d6             	mov    %rdx,%rsi
+    1b1d:	89 c7                	mov    %eax,%edi
+    1b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b24:	e8 7c 07 00 00       	call   22a5 <printf>
+    1b29:	8b 05 21 1c 00 00    	mov    0x1c21(%rip),%eax        # 3750 <stdout>
+    1b2f:	48 8d 15 f7 10 00 00 	lea    0x10f7(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1b36:	48 89 d6             	mov    %rdx,%rsi
+    1b39:	89 c7                	mov    %eax,%edi
+    1b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b40:	e8 60 07 00 00       	call   22a5 <printf>
+    1b45:	e8 02 0d 00 00       	call   284c <exit>
+  int fd4 = open("df4", O_RDWR | O_CREATE);
+    1b4a:	be 02 02 00 00       	mov    $0x202,%esi
+    1b4f:	48 8d 05 97 17 00 00 	lea    0x1797(%rip),%rax        # 32ed <malloc+0x84d>
+    1b56:	48 89 c7             	mov    %rax,%rdi
+    1b59:	e8 2e 0d 00 00       	call   288c <open>
+    1b5e:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (fd4 == -1)
+    1b61:	83 7d b4 ff          	cmpl   $0xffffffff,-0x4c(%rbp)
+    1b65:	75 5e                	jne    1bc5 <simpledelete+0xb53>
+    error("Unable to open df4");
+    1b67:	8b 05 e3 1b 00 00    	mov    0x1be3(%rip),%eax        # 3750 <stdout>
+    1b6d:	ba 41 01 00 00       	mov    $0x141,%edx
+    1b72:	48 8d 0d 71 10 00 00 	lea    0x1071(%rip),%rcx        # 2bea <malloc+0x14a>
+    1b79:	48 89 ce             	mov    %rcx,%rsi
+    1b7c:	89 c7                	mov    %eax,%edi
+    1b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b83:	e8 1d 07 00 00       	call   22a5 <printf>
+    1b88:	8b 05 c2 1b 00 00    	mov    0x1bc2(%rip),%eax        # 3750 <stdout>
+    1b8e:	48 8d 15 5c 17 00 00 	lea    0x175c(%rip),%rdx        # 32f1 <malloc+0x851>
+    1b95:	48 89 d6             	mov    %rdx,%rsi
+    1b98:	89 c7                	mov    %eax,%edi
+    1b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b9f:	e8 01 07 00 00       	call   22a5 <printf>
+    1ba4:	8b 05 a6 1b 00 00    	mov    0x1ba6(%rip),%eax        # 3750 <stdout>
+    1baa:	48 8d 15 7c 10 00 00 	lea    0x107c(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1bb1:	48 89 d6             	mov    %rdx,%rsi
+    1bb4:	89 c7                	mov    %eax,%edi
+    1bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bbb:	e8 e5 06 00 00       	call   22a5 <printf>
+    1bc0:	e8 87 0c 00 00       	call   284c <exit>
+  if (fstat(fd4, &ss) == -1)
+    1bc5:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1bc9:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    1bcc:	48 89 d6             	mov    %rdx,%rsi
+    1bcf:	89 c7                	mov    %eax,%edi
+    1bd1:	e8 ce 0c 00 00       	call   28a4 <fstat>
+    1bd6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bd9:	75 5e                	jne    1c39 <simpledelete+0xbc7>
+    error("Unable to stat open file");
+    1bdb:	8b 05 6f 1b 00 00    	mov    0x1b6f(%rip),%eax        # 3750 <stdout>
+    1be1:	ba 43 01 00 00       	mov    $0x143,%edx
+    1be6:	48 8d 0d fd 0f 00 00 	lea    0xffd(%rip),%rcx        # 2bea <malloc+0x14a>
+    1bed:	48 89 ce             	mov    %rcx,%rsi
+    1bf0:	89 c7                	mov    %eax,%edi
+    1bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf7:	e8 a9 06 00 00       	call   22a5 <printf>
+    1bfc:	8b 05 4e 1b 00 00    	mov    0x1b4e(%rip),%eax        # 3750 <stdout>
+    1c02:	48 8d 15 a1 16 00 00 	lea    0x16a1(%rip),%rdx        # 32aa <malloc+0x80a>
+    1c09:	48 89 d6             	mov    %rdx,%rsi
+    1c0c:	89 c7                	mov    %eax,%edi
+    1c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c13:	e8 8d 06 00 00       	call   22a5 <printf>
+    1c18:	8b 05 32 1b 00 00    	mov    0x1b32(%rip),%eax        # 3750 <stdout>
+    1c1e:	48 8d 15 08 10 00 00 	lea    0x1008(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1c25:	48 89 d6             	mov    %rdx,%rsi
+    1c28:	89 c7                	mov    %eax,%edi
+    1c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c2f:	e8 71 06 00 00       	call   22a5 <printf>
+    1c34:	e8 13 0c 00 00       	call   284c <exit>
+  int in4 = ss.ino;
+    1c39:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1c3c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  if (in4 == in3 || in4 == in1 || in4 != in2 + 1)
+    1c3f:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    1c42:	3b 45 b8             	cmp    -0x48(%rbp),%eax
+    1c45:	74 13                	je     1c5a <simpledelete+0xbe8>
+    1c47:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    1c4a:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    1c4d:	74 0b                	je     1c5a <simpledelete+0xbe8>
+    1c4f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+    1c52:	83 c0 01             	add    $0x1,%eax
+    1c55:	39 45 b0             	cmp    %eax,-0x50(%rbp)
+    1c58:	74 5e                	je     1cb8 <simpledelete+0xc46>
+    error("File allocation improperly finds inums");
+    1c5a:	8b 05 f0 1a 00 00    	mov    0x1af0(%rip),%eax        # 3750 <stdout>
+    1c60:	ba 46 01 00 00       	mov    $0x146,%edx
+    1c65:	48 8d 0d 7e 0f 00 00 	lea    0xf7e(%rip),%rcx        # 2bea <malloc+0x14a>
+    1c6c:	48 89 ce             	mov    %rcx,%rsi
+    1c6f:	89 c7                	mov    %eax,%edi
+    1c71:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c76:	e8 2a 06 00 00       	call   22a5 <printf>
+    1c7b:	8b 05 cf 1a 00 00    	mov    0x1acf(%rip),%eax        # 3750 <stdout>
+    1c81:	48 8d 15 80 16 00 00 	lea    0x1680(%rip),%rdx        # 3308 <malloc+0x868>
+    1c88:	48 89 d6             	mov    %rdx,%rsi
+    1c8b:	89 c7                	mov    %eax,%edi
+    1c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c92:	e8 0e 06 00 00       	call   22a5 <printf>
+    1c97:	8b 05 b3 1a 00 00    	mov    0x1ab3(%rip),%eax        # 3750 <stdout>
+    1c9d:	48 8d 15 89 0f 00 00 	lea    0xf89(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1ca4:	48 89 d6             	mov    %rdx,%rsi
+    1ca7:	89 c7                	mov    %eax,%edi
+    1ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cae:	e8 f2 05 00 00       	call   22a5 <printf>
+    1cb3:	e8 94 0b 00 00       	call   284c <exit>
+  if (close(fd2) != 0 || close(fd3) != 0 || close(fd4) != 0 || unlink("df2") != 0 || unlink("df3") != 0 || unlink("df4") != 0)
+    1cb8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1cbb:	89 c7                	mov    %eax,%edi
+    1cbd:	e8 b2 0b 00 00       	call   2874 <close>
+    1cc2:	85 c0                	test   %eax,%eax
+    1cc4:	75 55                	jne    1d1b <simpledelete+0xca9>
+    1cc6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    1cc9:	89 c7                	mov    %eax,%edi
+    1ccb:	e8 a4 0b 00 00       	call   2874 <close>
+    1cd0:	85 c0                	test   %eax,%eax
+    1cd2:	75 47                	jne    1d1b <simpledelete+0xca9>
+    1cd4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    1cd7:	89 c7                	mov    %eax,%edi
+    1cd9:	e8 96 0b 00 00       	call   2874 <close>
+    1cde:	85 c0                	test   %eax,%eax
+    1ce0:	75 39                	jne    1d1b <simpledelete+0xca9>
+    1ce2:	48 8d 05 52 15 00 00 	lea    0x1552(%rip),%rax        # 323b <malloc+0x79b>
+    1ce9:	48 89 c7             	mov    %rax,%rdi
+    1cec:	e8 ab 0b 00 00       	call   289c <unlink>
+    1cf1:	85 c0                	test   %eax,%eax
+    1cf3:	75 26                	jne    1d1b <simpledelete+0xca9>
+    1cf5:	48 8d 05 97 15 00 00 	lea    0x1597(%rip),%rax        # 3293 <malloc+0x7f3>
+    1cfc:	48 89 c7             	mov    %rax,%rdi
+    1cff:	e8 98 0b 00 00       	call   289c <unlink>
+    1d04:	85 c0                	test   %eax,%eax
+    1d06:	75 13                	jne    1d1b <simpledelete+0xca9>
+    1d08:	48 8d 05 de 15 00 00 	lea    0x15de(%rip),%rax        # 32ed <malloc+0x84d>
+    1d0f:	48 89 c7             	mov    %rax,%rdi
+    1d12:	e8 85 0b 00 00       	call   289c <unlink>
+    1d17:	85 c0                	test   %eax,%eax
+    1d19:	74 5e                	je     1d79 <simpledelete+0xd07>
+    error("Unable to clean up after inum allocation test");
+    1d1b:	8b 05 2f 1a 00 00    	mov    0x1a2f(%rip),%eax        # 3750 <stdout>
+    1d21:	ba 48 01 00 00       	mov    $0x148,%edx
+    1d26:	48 8d 0d bd 0e 00 00 	lea    0xebd(%rip),%rcx        # 2bea <malloc+0x14a>
+    1d2d:	48 89 ce             	mov    %rcx,%rsi
+    1d30:	89 c7                	mov    %eax,%edi
+    1d32:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d37:	e8 69 05 00 00       	call   22a5 <printf>
+    1d3c:	8b 05 0e 1a 00 00    	mov    0x1a0e(%rip),%eax        # 3750 <stdout>
+    1d42:	48 8d 15 e7 15 00 00 	lea    0x15e7(%rip),%rdx        # 3330 <malloc+0x890>
+    1d49:	48 89 d6             	mov    %rdx,%rsi
+    1d4c:	89 c7                	mov    %eax,%edi
+    1d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d53:	e8 4d 05 00 00       	call   22a5 <printf>
+    1d58:	8b 05 f2 19 00 00    	mov    0x19f2(%rip),%eax        # 3750 <stdout>
+    1d5e:	48 8d 15 c8 0e 00 00 	lea    0xec8(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1d65:	48 89 d6             	mov    %rdx,%rsi
+    1d68:	89 c7                	mov    %eax,%edi
+    1d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d6f:	e8 31 05 00 00       	call   22a5 <printf>
+    1d74:	e8 d3 0a 00 00       	call   284c <exit>
+
+  // You should not be able to read from a deleted file
+  for (int i = 0; i < 8; ++i)
+    1d79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d80:	eb 1b                	jmp    1d9d <simpledelete+0xd2b>
+    buf[i] = i + 1;
+    1d82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d85:	83 c0 01             	add    $0x1,%eax
+    1d88:	89 c1                	mov    %eax,%ecx
+    1d8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d8d:	48 98                	cltq
+    1d8f:	48 8d 15 0a 1a 00 00 	lea    0x1a0a(%rip),%rdx        # 37a0 <buf>
+    1d96:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    1d99:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1d9d:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1da1:	7e df                	jle    1d82 <simpledelete+0xd10>
+  fd = open("file", O_RDWR | O_CREATE);
+    1da3:	be 02 02 00 00       	mov    $0x202,%esi
+    1da8:	48 8d 05 af 15 00 00 	lea    0x15af(%rip),%rax        # 335e <malloc+0x8be>
+    1daf:	48 89 c7             	mov    %rax,%rdi
+    1db2:	e8 d5 0a 00 00       	call   288c <open>
+    1db7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1 || write(fd, buf, 8) != 8)
+    1dba:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    1dbe:	74 1e                	je     1dde <simpledelete+0xd6c>
+    1dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1dc3:	ba 08 00 00 00       	mov    $0x8,%edx
+    1dc8:	48 8d 0d d1 19 00 00 	lea    0x19d1(%rip),%rcx        # 37a0 <buf>
+    1dcf:	48 89 ce             	mov    %rcx,%rsi
+    1dd2:	89 c7                	mov    %eax,%edi
+    1dd4:	e8 93 0a 00 00       	call   286c <write>
+    1dd9:	83 f8 08             	cmp    $0x8,%eax
+    1ddc:	74 5e                	je     1e3c <simpledelete+0xdca>
+    error("Unable to open/write to file");
+    1dde:	8b 05 6c 19 00 00    	mov    0x196c(%rip),%eax        # 3750 <stdout>
+    1de4:	ba 4f 01 00 00       	mov    $0x14f,%edx
+    1de9:	48 8d 0d fa 0d 00 00 	lea    0xdfa(%rip),%rcx        # 2bea <malloc+0x14a>
+    1df0:	48 89 ce             	mov    %rcx,%rsi
+    1df3:	89 c7                	mov    %eax,%edi
+    1df5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dfa:	e8 a6 04 00 00       	call   22a5 <printf>
+    1dff:	8b 05 4b 19 00 00    	mov    0x194b(%rip),%eax        # 3750 <stdout>
+    1e05:	48 8d 15 57 15 00 00 	lea    0x1557(%rip),%rdx        # 3363 <malloc+0x8c3>
+    1e0c:	48 89 d6             	mov    %rdx,%rsi
+    1e0f:	89 c7                	mov    %eax,%edi
+    1e11:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e16:	e8 8a 04 00 00       	call   22a5 <printf>
+    1e1b:	8b 05 2f 19 00 00    	mov    0x192f(%rip),%eax        # 3750 <stdout>
+    1e21:	48 8d 15 05 0e 00 00 	lea    0xe05(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1e28:	48 89 d6             	mov    %rdx,%rsi
+    1e2b:	89 c7                	mov    %eax,%edi
+    1e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e32:	e8 6e 04 00 00       	call   22a5 <printf>
+    1e37:	e8 10 0a 00 00       	call   284c <exit>
+  for (int i = 0; i < 8; ++i)
+    1e3c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1e43:	eb 14                	jmp    1e59 <simpledelete+0xde7>
+    buf[i] = 0;
+    1e45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e48:	48 98                	cltq
+    1e4a:	48 8d 15 4f 19 00 00 	lea    0x194f(%rip),%rdx        # 37a0 <buf>
+    1e51:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    1e55:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1e59:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+    1e5d:	7e e6                	jle    1e45 <simpledelete+0xdd3>
+  if (close(fd) != 0 || unlink("file") != 0)
+    1e5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e62:	89 c7                	mov    %eax,%edi
+    1e64:	e8 0b 0a 00 00       	call   2874 <close>
+    1e69:	85 c0                	test   %eax,%eax
+    1e6b:	75 13                	jne    1e80 <simpledelete+0xe0e>
+    1e6d:	48 8d 05 ea 14 00 00 	lea    0x14ea(%rip),%rax        # 335e <malloc+0x8be>
+    1e74:	48 89 c7             	mov    %rax,%rdi
+    1e77:	e8 20 0a 00 00       	call   289c <unlink>
+    1e7c:	85 c0                	test   %eax,%eax
+    1e7e:	74 5e                	je     1ede <simpledelete+0xe6c>
+    error("Unable to clean up file (1)");
+    1e80:	8b 05 ca 18 00 00    	mov    0x18ca(%rip),%eax        # 3750 <stdout>
+    1e86:	ba 53 01 00 00       	mov    $0x153,%edx
+    1e8b:	48 8d 0d 58 0d 00 00 	lea    0xd58(%rip),%rcx        # 2bea <malloc+0x14a>
+    1e92:	48 89 ce             	mov    %rcx,%rsi
+    1e95:	89 c7                	mov    %eax,%edi
+    1e97:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e9c:	e8 04 04 00 00       	call   22a5 <printf>
+    1ea1:	8b 05 a9 18 00 00    	mov    0x18a9(%rip),%eax        # 3750 <stdout>
+    1ea7:	48 8d 15 d2 14 00 00 	lea    0x14d2(%rip),%rdx        # 3380 <malloc+0x8e0>
+    1eae:	48 89 d6             	mov    %rdx,%rsi
+    1eb1:	89 c7                	mov    %eax,%edi
+    1eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eb8:	e8 e8 03 00 00       	call   22a5 <printf>
+    1ebd:	8b 05 8d 18 00 00    	mov    0x188d(%rip),%eax        # 3750 <stdout>
+    1ec3:	48 8d 15 63 0d 00 00 	lea    0xd63(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1eca:	48 89 d6             	mov    %rdx,%rsi
+    1ecd:	89 c7                	mov    %eax,%edi
+    1ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ed4:	e8 cc 03 00 00       	call   22a5 <printf>
+    1ed9:	e8 6e 09 00 00       	call   284c <exit>
+  fd = open("file", O_RDWR | O_CREATE);
+    1ede:	be 02 02 00 00       	mov    $0x202,%esi
+    1ee3:	48 8d 05 74 14 00 00 	lea    0x1474(%rip),%rax        # 335e <malloc+0x8be>
+    1eea:	48 89 c7             	mov    %rax,%rdi
+    1eed:	e8 9a 09 00 00       	call   288c <open>
+    1ef2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    1ef5:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    1ef9:	75 5e                	jne    1f59 <simpledelete+0xee7>
+    error("Unable to reopen file");
+    1efb:	8b 05 4f 18 00 00    	mov    0x184f(%rip),%eax        # 3750 <stdout>
+    1f01:	ba 56 01 00 00       	mov    $0x156,%edx
+    1f06:	48 8d 0d dd 0c 00 00 	lea    0xcdd(%rip),%rcx        # 2bea <malloc+0x14a>
+    1f0d:	48 89 ce             	mov    %rcx,%rsi
+    1f10:	89 c7                	mov    %eax,%edi
+    1f12:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f17:	e8 89 03 00 00       	call   22a5 <printf>
+    1f1c:	8b 05 2e 18 00 00    	mov    0x182e(%rip),%eax        # 3750 <stdout>
+    1f22:	48 8d 15 73 14 00 00 	lea    0x1473(%rip),%rdx        # 339c <malloc+0x8fc>
+    1f29:	48 89 d6             	mov    %rdx,%rsi
+    1f2c:	89 c7                	mov    %eax,%edi
+    1f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f33:	e8 6d 03 00 00       	call   22a5 <printf>
+    1f38:	8b 05 12 18 00 00    	mov    0x1812(%rip),%eax        # 3750 <stdout>
+    1f3e:	48 8d 15 e8 0c 00 00 	lea    0xce8(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1f45:	48 89 d6             	mov    %rdx,%rsi
+    1f48:	89 c7                	mov    %eax,%edi
+    1f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f4f:	e8 51 03 00 00       	call   22a5 <printf>
+    1f54:	e8 f3 08 00 00       	call   284c <exit>
+  int r = read(fd, buf, 8);
+    1f59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f5c:	ba 08 00 00 00       	mov    $0x8,%edx
+    1f61:	48 8d 0d 38 18 00 00 	lea    0x1838(%rip),%rcx        # 37a0 <buf>
+    1f68:	48 89 ce             	mov    %rcx,%rsi
+    1f6b:	89 c7                	mov    %eax,%edi
+    1f6d:	e8 f2 08 00 00       	call   2864 <read>
+    1f72:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  if (r > 0)
+    1f75:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+    1f79:	7e 5e                	jle    1fd9 <simpledelete+0xf67>
+    error("Able to read from fresh file");
+    1f7b:	8b 05 cf 17 00 00    	mov    0x17cf(%rip),%eax        # 3750 <stdout>
+    1f81:	ba 59 01 00 00       	mov    $0x159,%edx
+    1f86:	48 8d 0d 5d 0c 00 00 	lea    0xc5d(%rip),%rcx        # 2bea <malloc+0x14a>
+    1f8d:	48 89 ce             	mov    %rcx,%rsi
+    1f90:	89 c7                	mov    %eax,%edi
+    1f92:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f97:	e8 09 03 00 00       	call   22a5 <printf>
+    1f9c:	8b 05 ae 17 00 00    	mov    0x17ae(%rip),%eax        # 3750 <stdout>
+    1fa2:	48 8d 15 09 14 00 00 	lea    0x1409(%rip),%rdx        # 33b2 <malloc+0x912>
+    1fa9:	48 89 d6             	mov    %rdx,%rsi
+    1fac:	89 c7                	mov    %eax,%edi
+    1fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb3:	e8 ed 02 00 00       	call   22a5 <printf>
+    1fb8:	8b 05 92 17 00 00    	mov    0x1792(%rip),%eax        # 3750 <stdout>
+    1fbe:	48 8d 15 68 0c 00 00 	lea    0xc68(%rip),%rdx        # 2c2d <malloc+0x18d>
+    1fc5:	48 89 d6             	mov    %rdx,%rsi
+    1fc8:	89 c7                	mov    %eax,%edi
+    1fca:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fcf:	e8 d1 02 00 00       	call   22a5 <printf>
+    1fd4:	e8 73 08 00 00       	call   284c <exit>
+  if (close(fd) != 0 || unlink("file") != 0)
+    1fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1fdc:	89 c7                	mov    %eax,%edi
+    1fde:	e8 91 08 00 00       	call   2874 <close>
+    1fe3:	85 c0                	test   %eax,%eax
+    1fe5:	75 13                	jne    1ffa <simpledelete+0xf88>
+    1fe7:	48 8d 05 70 13 00 00 	lea    0x1370(%rip),%rax        # 335e <malloc+0x8be>
+    1fee:	48 89 c7             	mov    %rax,%rdi
+    1ff1:	e8 a6 08 00 00       	call   289c <unlink>
+    1ff6:	85 c0                	test   %eax,%eax
+    1ff8:	74 5e                	je     2058 <simpledelete+0xfe6>
+    error("Unable to clean up file");
+    1ffa:	8b 05 50 17 00 00    	mov    0x1750(%rip),%eax        # 3750 <stdout>
+    2000:	ba 5b 01 00 00       	mov    $0x15b,%edx
+    2005:	48 8d 0d de 0b 00 00 	lea    0xbde(%rip),%rcx        # 2bea <malloc+0x14a>
+    200c:	48 89 ce             	mov    %rcx,%rsi
+    200f:	89 c7                	mov    %eax,%edi
+    2011:	b8 00 00 00 00       	mov    $0x0,%eax
+    2016:	e8 8a 02 00 00       	call   22a5 <printf>
+    201b:	8b 05 2f 17 00 00    	mov    0x172f(%rip),%eax        # 3750 <stdout>
+    2021:	48 8d 15 a7 13 00 00 	lea    0x13a7(%rip),%rdx        # 33cf <malloc+0x92f>
+    2028:	48 89 d6             	mov    %rdx,%rsi
+    202b:	89 c7                	mov    %eax,%edi
+    202d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2032:	e8 6e 02 00 00       	call   22a5 <printf>
+    2037:	8b 05 13 17 00 00    	mov    0x1713(%rip),%eax        # 3750 <stdout>
+    203d:	48 8d 15 e9 0b 00 00 	lea    0xbe9(%rip),%rdx        # 2c2d <malloc+0x18d>
+    2044:	48 89 d6             	mov    %rdx,%rsi
+    2047:	89 c7                	mov    %eax,%edi
+    2049:	b8 00 00 00 00       	mov    $0x0,%eax
+    204e:	e8 52 02 00 00       	call   22a5 <printf>
+    2053:	e8 f4 07 00 00       	call   284c <exit>
+  printf(1, "  simple deletion ok\n");
+    2058:	48 8d 05 88 13 00 00 	lea    0x1388(%rip),%rax        # 33e7 <malloc+0x947>
+    205f:	48 89 c6             	mov    %rax,%rsi
+    2062:	bf 01 00 00 00       	mov    $0x1,%edi
+    2067:	b8 00 00 00 00       	mov    $0x0,%eax
+    206c:	e8 34 02 00 00       	call   22a5 <printf>
+}
+    2071:	90                   	nop
+    2072:	c9                   	leave
+    2073:	c3                   	ret
+
+0000000000002074 <main>:
+
+int main(int argc, char *argv[]) {
+    2074:	55                   	push   %rbp
+    2075:	48 89 e5             	mov    %rsp,%rbp
+    2078:	48 83 ec 10          	sub    $0x10,%rsp
+    207c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    207f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab4test_a starting\n");
+    2083:	8b 05 c7 16 00 00    	mov    0x16c7(%rip),%eax        # 3750 <stdout>
+    2089:	48 8d 15 6d 13 00 00 	lea    0x136d(%rip),%rdx        # 33fd <malloc+0x95d>
+    2090:	48 89 d6             	mov    %rdx,%rsi
+    2093:	89 c7                	mov    %eax,%edi
+    2095:	b8 00 00 00 00       	mov    $0x0,%eax
+    209a:	e8 06 02 00 00       	call   22a5 <printf>
+  overwrite();
+    209f:	e8 5c df ff ff       	call   0 <overwrite>
+  append();
+    20a4:	e8 ac e1 ff ff       	call   255 <append>
+  filecreation();
+    20a9:	e8 03 e5 ff ff       	call   5b1 <filecreation>
+  onefile();
+    20ae:	e8 28 e8 ff ff       	call   8db <onefile>
+  fourfiles();
+    20b3:	e8 50 eb ff ff       	call   c08 <fourfiles>
+  simpledelete();
+    20b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    20bd:	e8 b0 ef ff ff       	call   1072 <simpledelete>
+  printf(stdout, "lab4test_a passed!\n");
+    20c2:	8b 05 88 16 00 00    	mov    0x1688(%rip),%eax        # 3750 <stdout>
+    20c8:	48 8d 15 43 13 00 00 	lea    0x1343(%rip),%rdx        # 3412 <malloc+0x972>
+    20cf:	48 89 d6             	mov    %rdx,%rsi
+    20d2:	89 c7                	mov    %eax,%edi
+    20d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    20d9:	e8 c7 01 00 00       	call   22a5 <printf>
+  exit();
+    20de:	e8 69 07 00 00       	call   284c <exit>
+
+00000000000020e3 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    20e3:	55                   	push   %rbp
+    20e4:	48 89 e5             	mov    %rsp,%rbp
+    20e7:	48 83 ec 10          	sub    $0x10,%rsp
+    20eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    20ee:	89 f0                	mov    %esi,%eax
+    20f0:	88 45 f8             	mov    %al,-0x8(%rbp)
+    20f3:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    20f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20fa:	ba 01 00 00 00       	mov    $0x1,%edx
+    20ff:	48 89 ce             	mov    %rcx,%rsi
+    2102:	89 c7                	mov    %eax,%edi
+    2104:	e8 63 07 00 00       	call   286c <write>
+    2109:	90                   	nop
+    210a:	c9                   	leave
+    210b:	c3                   	ret
+
+000000000000210c <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    210c:	55                   	push   %rbp
+    210d:	48 89 e5             	mov    %rsp,%rbp
+    2110:	48 83 ec 40          	sub    $0x40,%rsp
+    2114:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    2117:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    211a:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    211d:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    2120:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    2124:	74 1f                	je     2145 <printint64+0x39>
+    2126:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    2129:	c1 e8 1f             	shr    $0x1f,%eax
+    212c:	0f b6 c0             	movzbl %al,%eax
+    212f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    2132:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    2136:	74 0d                	je     2145 <printint64+0x39>
+    x = -xx;
+    2138:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    213b:	f7 d8                	neg    %eax
+    213d:	48 98                	cltq
+    213f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2143:	eb 09                	jmp    214e <printint64+0x42>
+  else
+    x = xx;
+    2145:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    2148:	48 98                	cltq
+    214a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    214e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    2155:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2158:	48 63 c8             	movslq %eax,%rcx
+    215b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    215f:	ba 00 00 00 00       	mov    $0x0,%edx
+    2164:	48 f7 f1             	div    %rcx
+    2167:	48 89 d1             	mov    %rdx,%rcx
+    216a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    216d:	8d 50 01             	lea    0x1(%rax),%edx
+    2170:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2173:	48 8d 15 e6 15 00 00 	lea    0x15e6(%rip),%rdx        # 3760 <digits.1>
+    217a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    217e:	48 98                	cltq
+    2180:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2184:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2187:	48 63 f0             	movslq %eax,%rsi
+    218a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    218e:	ba 00 00 00 00       	mov    $0x0,%edx
+    2193:	48 f7 f6             	div    %rsi
+    2196:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    219a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    219f:	75 b4                	jne    2155 <printint64+0x49>
+
+  if (sgn)
+    21a1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    21a5:	74 2b                	je     21d2 <printint64+0xc6>
+    buf[i++] = '-';
+    21a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21aa:	8d 50 01             	lea    0x1(%rax),%edx
+    21ad:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    21b0:	48 98                	cltq
+    21b2:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    21b7:	eb 19                	jmp    21d2 <printint64+0xc6>
+    putc(fd, buf[i]);
+    21b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21bc:	48 98                	cltq
+    21be:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    21c3:	0f be d0             	movsbl %al,%edx
+    21c6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    21c9:	89 d6                	mov    %edx,%esi
+    21cb:	89 c7                	mov    %eax,%edi
+    21cd:	e8 11 ff ff ff       	call   20e3 <putc>
+  while (--i >= 0)
+    21d2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    21d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    21da:	79 dd                	jns    21b9 <printint64+0xad>
+}
+    21dc:	90                   	nop
+    21dd:	90                   	nop
+    21de:	c9                   	leave
+    21df:	c3                   	ret
+
+00000000000021e0 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    21e0:	55                   	push   %rbp
+    21e1:	48 89 e5             	mov    %rsp,%rbp
+    21e4:	48 83 ec 30          	sub    $0x30,%rsp
+    21e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    21eb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    21ee:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    21f1:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    21f4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    21fb:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    21ff:	74 17                	je     2218 <printint+0x38>
+    2201:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    2205:	79 11                	jns    2218 <printint+0x38>
+    neg = 1;
+    2207:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    220e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2211:	f7 d8                	neg    %eax
+    2213:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2216:	eb 06                	jmp    221e <printint+0x3e>
+  } else {
+    x = xx;
+    2218:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    221b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    221e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    2225:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    2228:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    222b:	ba 00 00 00 00       	mov    $0x0,%edx
+    2230:	f7 f1                	div    %ecx
+    2232:	89 d1                	mov    %edx,%ecx
+    2234:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2237:	8d 50 01             	lea    0x1(%rax),%edx
+    223a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    223d:	89 c9                	mov    %ecx,%ecx
+    223f:	48 8d 15 3a 15 00 00 	lea    0x153a(%rip),%rdx        # 3780 <digits.0>
+    2246:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    224a:	48 98                	cltq
+    224c:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2250:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    2253:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2256:	ba 00 00 00 00       	mov    $0x0,%edx
+    225b:	f7 f6                	div    %esi
+    225d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2260:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    2264:	75 bf                	jne    2225 <printint+0x45>
+  if (neg)
+    2266:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    226a:	74 2b                	je     2297 <printint+0xb7>
+    buf[i++] = '-';
+    226c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    226f:	8d 50 01             	lea    0x1(%rax),%edx
+    2272:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2275:	48 98                	cltq
+    2277:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    227c:	eb 19                	jmp    2297 <printint+0xb7>
+    putc(fd, buf[i]);
+    227e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2281:	48 98                	cltq
+    2283:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    2288:	0f be d0             	movsbl %al,%edx
+    228b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    228e:	89 d6                	mov    %edx,%esi
+    2290:	89 c7                	mov    %eax,%edi
+    2292:	e8 4c fe ff ff       	call   20e3 <putc>
+  while (--i >= 0)
+    2297:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    229b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    229f:	79 dd                	jns    227e <printint+0x9e>
+}
+    22a1:	90                   	nop
+    22a2:	90                   	nop
+    22a3:	c9                   	leave
+    22a4:	c3                   	ret
+
+00000000000022a5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    22a5:	55                   	push   %rbp
+    22a6:	48 89 e5             	mov    %rsp,%rbp
+    22a9:	48 83 ec 70          	sub    $0x70,%rsp
+    22ad:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    22b0:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    22b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    22b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    22bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    22c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    22c4:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    22cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    22cf:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    22d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22d7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    22db:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    22e2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    22e9:	e9 6b 02 00 00       	jmp    2559 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    22ee:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    22f1:	48 63 d0             	movslq %eax,%rdx
+    22f4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    22f8:	48 01 d0             	add    %rdx,%rax
+    22fb:	0f b6 00             	movzbl (%rax),%eax
+    22fe:	0f be c0             	movsbl %al,%eax
+    2301:	25 ff 00 00 00       	and    $0xff,%eax
+    2306:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    2309:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    230d:	75 30                	jne    233f <printf+0x9a>
+      if (c == '%') {
+    230f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    2313:	75 13                	jne    2328 <printf+0x83>
+        state = '%';
+    2315:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    231c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    2323:	e9 2d 02 00 00       	jmp    2555 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    2328:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    232b:	0f be d0             	movsbl %al,%edx
+    232e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2331:	89 d6                	mov    %edx,%esi
+    2333:	89 c7                	mov    %eax,%edi
+    2335:	e8 a9 fd ff ff       	call   20e3 <putc>
+    233a:	e9 16 02 00 00       	jmp    2555 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    233f:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    2343:	0f 85 0c 02 00 00    	jne    2555 <printf+0x2b0>
+      if (c == 'l') {
+    2349:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    234d:	75 0c                	jne    235b <printf+0xb6>
+        lflag = 1;
+    234f:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    2356:	e9 fa 01 00 00       	jmp    2555 <printf+0x2b0>
+      } else if (c == 'd') {
+    235b:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    235f:	0f 85 95 00 00 00    	jne    23fa <printf+0x155>
+        if (lflag == 1)
+    2365:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2369:	75 49                	jne    23b4 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    236b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    236e:	83 f8 2f             	cmp    $0x2f,%eax
+    2371:	77 17                	ja     238a <printf+0xe5>
+    2373:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2377:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    237a:	89 d2                	mov    %edx,%edx
+    237c:	48 01 d0             	add    %rdx,%rax
+    237f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2382:	83 c2 08             	add    $0x8,%edx
+    2385:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2388:	eb 0c                	jmp    2396 <printf+0xf1>
+    238a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    238e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2392:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2396:	48 8b 00             	mov    (%rax),%rax
+    2399:	89 c6                	mov    %eax,%esi
+    239b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    239e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    23a3:	ba 0a 00 00 00       	mov    $0xa,%edx
+    23a8:	89 c7                	mov    %eax,%edi
+    23aa:	e8 5d fd ff ff       	call   210c <printint64>
+    23af:	e9 9a 01 00 00       	jmp    254e <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    23b4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    23b7:	83 f8 2f             	cmp    $0x2f,%eax
+    23ba:	77 17                	ja     23d3 <printf+0x12e>
+    23bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    23c0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    23c3:	89 d2                	mov    %edx,%edx
+    23c5:	48 01 d0             	add    %rdx,%rax
+    23c8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    23cb:	83 c2 08             	add    $0x8,%edx
+    23ce:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    23d1:	eb 0c                	jmp    23df <printf+0x13a>
+    23d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    23d7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    23db:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    23df:	8b 30                	mov    (%rax),%esi
+    23e1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    23e4:	b9 01 00 00 00       	mov    $0x1,%ecx
+    23e9:	ba 0a 00 00 00       	mov    $0xa,%edx
+    23ee:	89 c7                	mov    %eax,%edi
+    23f0:	e8 eb fd ff ff       	call   21e0 <printint>
+    23f5:	e9 54 01 00 00       	jmp    254e <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    23fa:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    23fe:	74 0a                	je     240a <printf+0x165>
+    2400:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    2404:	0f 85 95 00 00 00    	jne    249f <printf+0x1fa>
+        if (lflag == 1)
+    240a:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    240e:	75 49                	jne    2459 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    2410:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2413:	83 f8 2f             	cmp    $0x2f,%eax
+    2416:	77 17                	ja     242f <printf+0x18a>
+    2418:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    241c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    241f:	89 d2                	mov    %edx,%edx
+    2421:	48 01 d0             	add    %rdx,%rax
+    2424:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2427:	83 c2 08             	add    $0x8,%edx
+    242a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    242d:	eb 0c                	jmp    243b <printf+0x196>
+    242f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2433:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2437:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    243b:	48 8b 00             	mov    (%rax),%rax
+    243e:	89 c6                	mov    %eax,%esi
+    2440:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2443:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2448:	ba 10 00 00 00       	mov    $0x10,%edx
+    244d:	89 c7                	mov    %eax,%edi
+    244f:	e8 b8 fc ff ff       	call   210c <printint64>
+        if (lflag == 1)
+    2454:	e9 f5 00 00 00       	jmp    254e <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    2459:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    245c:	83 f8 2f             	cmp    $0x2f,%eax
+    245f:	77 17                	ja     2478 <printf+0x1d3>
+    2461:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2465:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2468:	89 d2                	mov    %edx,%edx
+    246a:	48 01 d0             	add    %rdx,%rax
+    246d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2470:	83 c2 08             	add    $0x8,%edx
+    2473:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2476:	eb 0c                	jmp    2484 <printf+0x1df>
+    2478:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    247c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2480:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2484:	8b 30                	mov    (%rax),%esi
+    2486:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2489:	b9 00 00 00 00       	mov    $0x0,%ecx
+    248e:	ba 10 00 00 00       	mov    $0x10,%edx
+    2493:	89 c7                	mov    %eax,%edi
+    2495:	e8 46 fd ff ff       	call   21e0 <printint>
+        if (lflag == 1)
+    249a:	e9 af 00 00 00       	jmp    254e <printf+0x2a9>
+      } else if (c == 's') {
+    249f:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    24a3:	75 6e                	jne    2513 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    24a5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    24a8:	83 f8 2f             	cmp    $0x2f,%eax
+    24ab:	77 17                	ja     24c4 <printf+0x21f>
+    24ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    24b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    24b4:	89 d2                	mov    %edx,%edx
+    24b6:	48 01 d0             	add    %rdx,%rax
+    24b9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    24bc:	83 c2 08             	add    $0x8,%edx
+    24bf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    24c2:	eb 0c                	jmp    24d0 <printf+0x22b>
+    24c4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    24c8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    24cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    24d0:	48 8b 00             	mov    (%rax),%rax
+    24d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    24d7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    24dc:	75 28                	jne    2506 <printf+0x261>
+          s = "(null)";
+    24de:	48 8d 05 41 0f 00 00 	lea    0xf41(%rip),%rax        # 3426 <malloc+0x986>
+    24e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    24e9:	eb 1b                	jmp    2506 <printf+0x261>
+          putc(fd, *s);
+    24eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    24ef:	0f b6 00             	movzbl (%rax),%eax
+    24f2:	0f be d0             	movsbl %al,%edx
+    24f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    24f8:	89 d6                	mov    %edx,%esi
+    24fa:	89 c7                	mov    %eax,%edi
+    24fc:	e8 e2 fb ff ff       	call   20e3 <putc>
+        for (; *s; s++)
+    2501:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    2506:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    250a:	0f b6 00             	movzbl (%rax),%eax
+    250d:	84 c0                	test   %al,%al
+    250f:	75 da                	jne    24eb <printf+0x246>
+    2511:	eb 3b                	jmp    254e <printf+0x2a9>
+      } else if (c == '%') {
+    2513:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    2517:	75 14                	jne    252d <printf+0x288>
+        putc(fd, c);
+    2519:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    251c:	0f be d0             	movsbl %al,%edx
+    251f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2522:	89 d6                	mov    %edx,%esi
+    2524:	89 c7                	mov    %eax,%edi
+    2526:	e8 b8 fb ff ff       	call   20e3 <putc>
+    252b:	eb 21                	jmp    254e <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    252d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2530:	be 25 00 00 00       	mov    $0x25,%esi
+    2535:	89 c7                	mov    %eax,%edi
+    2537:	e8 a7 fb ff ff       	call   20e3 <putc>
+        putc(fd, c);
+    253c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    253f:	0f be d0             	movsbl %al,%edx
+    2542:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2545:	89 d6                	mov    %edx,%esi
+    2547:	89 c7                	mov    %eax,%edi
+    2549:	e8 95 fb ff ff       	call   20e3 <putc>
+      }
+      state = 0;
+    254e:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    2555:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    2559:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    255c:	48 63 d0             	movslq %eax,%rdx
+    255f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2563:	48 01 d0             	add    %rdx,%rax
+    2566:	0f b6 00             	movzbl (%rax),%eax
+    2569:	84 c0                	test   %al,%al
+    256b:	0f 85 7d fd ff ff    	jne    22ee <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    2571:	90                   	nop
+    2572:	90                   	nop
+    2573:	c9                   	leave
+    2574:	c3                   	ret
+
+0000000000002575 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+    2575:	55                   	push   %rbp
+    2576:	48 89 e5             	mov    %rsp,%rbp
+    2579:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    257d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2580:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+    2583:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2587:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    258a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    258d:	48 89 ce             	mov    %rcx,%rsi
+    2590:	48 89 f7             	mov    %rsi,%rdi
+    2593:	89 d1                	mov    %edx,%ecx
+    2595:	fc                   	cld
+    2596:	f3 aa                	rep stos %al,%es:(%rdi)
+    2598:	89 ca                	mov    %ecx,%edx
+    259a:	48 89 fe             	mov    %rdi,%rsi
+    259d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    25a1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+    25a4:	90                   	nop
+    25a5:	5d                   	pop    %rbp
+    25a6:	c3                   	ret
+
+00000000000025a7 <strcpy>:
+char *strcpy(char *s, char *t) {
+    25a7:	55                   	push   %rbp
+    25a8:	48 89 e5             	mov    %rsp,%rbp
+    25ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    25b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    25bb:	90                   	nop
+    25bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    25c0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    25c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    25c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25cc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    25d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    25d4:	0f b6 12             	movzbl (%rdx),%edx
+    25d7:	88 10                	mov    %dl,(%rax)
+    25d9:	0f b6 00             	movzbl (%rax),%eax
+    25dc:	84 c0                	test   %al,%al
+    25de:	75 dc                	jne    25bc <strcpy+0x15>
+  return os;
+    25e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    25e4:	5d                   	pop    %rbp
+    25e5:	c3                   	ret
+
+00000000000025e6 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    25e6:	55                   	push   %rbp
+    25e7:	48 89 e5             	mov    %rsp,%rbp
+    25ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    25f2:	eb 0a                	jmp    25fe <strcmp+0x18>
+    p++, q++;
+    25f4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    25f9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    25fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2602:	0f b6 00             	movzbl (%rax),%eax
+    2605:	84 c0                	test   %al,%al
+    2607:	74 12                	je     261b <strcmp+0x35>
+    2609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    260d:	0f b6 10             	movzbl (%rax),%edx
+    2610:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2614:	0f b6 00             	movzbl (%rax),%eax
+    2617:	38 c2                	cmp    %al,%dl
+    2619:	74 d9                	je     25f4 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    261b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    261f:	0f b6 00             	movzbl (%rax),%eax
+    2622:	0f b6 d0             	movzbl %al,%edx
+    2625:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2629:	0f b6 00             	movzbl (%rax),%eax
+    262c:	0f b6 c0             	movzbl %al,%eax
+    262f:	29 c2                	sub    %eax,%edx
+    2631:	89 d0                	mov    %edx,%eax
+}
+    2633:	5d                   	pop    %rbp
+    2634:	c3                   	ret
+
+0000000000002635 <strlen>:
+uint strlen(char *s) {
+    2635:	55                   	push   %rbp
+    2636:	48 89 e5             	mov    %rsp,%rbp
+    2639:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    263d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2644:	eb 04                	jmp    264a <strlen+0x15>
+    2646:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    264a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    264d:	48 63 d0             	movslq %eax,%rdx
+    2650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2654:	48 01 d0             	add    %rdx,%rax
+    2657:	0f b6 00             	movzbl (%rax),%eax
+    265a:	84 c0                	test   %al,%al
+    265c:	75 e8                	jne    2646 <strlen+0x11>
+  return n;
+    265e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2661:	5d                   	pop    %rbp
+    2662:	c3                   	ret
+
+0000000000002663 <memset>:
+void *memset(void *dst, int c, uint n) {
+    2663:	55                   	push   %rbp
+    2664:	48 89 e5             	mov    %rsp,%rbp
+    2667:	48 83 ec 10          	sub    $0x10,%rsp
+    266b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    266f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2672:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    2675:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2678:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    267b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    267f:	89 ce                	mov    %ecx,%esi
+    2681:	48 89 c7             	mov    %rax,%rdi
+    2684:	e8 ec fe ff ff       	call   2575 <stosb>
+  return dst;
+    2689:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    268d:	c9                   	leave
+    268e:	c3                   	ret
+
+000000000000268f <strchr>:
+char *strchr(const char *s, char c) {
+    268f:	55                   	push   %rbp
+    2690:	48 89 e5             	mov    %rsp,%rbp
+    2693:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2697:	89 f0                	mov    %esi,%eax
+    2699:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    269c:	eb 17                	jmp    26b5 <strchr+0x26>
+    if (*s == c)
+    269e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26a2:	0f b6 00             	movzbl (%rax),%eax
+    26a5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    26a8:	75 06                	jne    26b0 <strchr+0x21>
+      return (char *)s;
+    26aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ae:	eb 15                	jmp    26c5 <strchr+0x36>
+  for (; *s; s++)
+    26b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    26b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26b9:	0f b6 00             	movzbl (%rax),%eax
+    26bc:	84 c0                	test   %al,%al
+    26be:	75 de                	jne    269e <strchr+0xf>
+  return 0;
+    26c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    26c5:	5d                   	pop    %rbp
+    26c6:	c3                   	ret
+
+00000000000026c7 <gets>:
+char *gets(char *buf, int max) {
+    26c7:	55                   	push   %rbp
+    26c8:	48 89 e5             	mov    %rsp,%rbp
+    26cb:	48 83 ec 20          	sub    $0x20,%rsp
+    26cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    26d3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    26d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    26dd:	eb 48                	jmp    2727 <gets+0x60>
+    cc = read(0, &c, 1);
+    26df:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    26e3:	ba 01 00 00 00       	mov    $0x1,%edx
+    26e8:	48 89 c6             	mov    %rax,%rsi
+    26eb:	bf 00 00 00 00       	mov    $0x0,%edi
+    26f0:	e8 6f 01 00 00       	call   2864 <read>
+    26f5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    26f8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    26fc:	7e 36                	jle    2734 <gets+0x6d>
+    buf[i++] = c;
+    26fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2701:	8d 50 01             	lea    0x1(%rax),%edx
+    2704:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2707:	48 63 d0             	movslq %eax,%rdx
+    270a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    270e:	48 01 c2             	add    %rax,%rdx
+    2711:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2715:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2717:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    271b:	3c 0a                	cmp    $0xa,%al
+    271d:	74 16                	je     2735 <gets+0x6e>
+    271f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2723:	3c 0d                	cmp    $0xd,%al
+    2725:	74 0e                	je     2735 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2727:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    272a:	83 c0 01             	add    $0x1,%eax
+    272d:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2730:	7f ad                	jg     26df <gets+0x18>
+    2732:	eb 01                	jmp    2735 <gets+0x6e>
+      break;
+    2734:	90                   	nop
+  }
+  buf[i] = '\0';
+    2735:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2738:	48 63 d0             	movslq %eax,%rdx
+    273b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    273f:	48 01 d0             	add    %rdx,%rax
+    2742:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2745:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2749:	c9                   	leave
+    274a:	c3                   	ret
+
+000000000000274b <stat>:
+
+int stat(char *n, struct stat *st) {
+    274b:	55                   	push   %rbp
+    274c:	48 89 e5             	mov    %rsp,%rbp
+    274f:	48 83 ec 20          	sub    $0x20,%rsp
+    2753:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2757:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    275b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    275f:	be 00 00 00 00       	mov    $0x0,%esi
+    2764:	48 89 c7             	mov    %rax,%rdi
+    2767:	e8 20 01 00 00       	call   288c <open>
+    276c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    276f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2773:	79 07                	jns    277c <stat+0x31>
+    return -1;
+    2775:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    277a:	eb 21                	jmp    279d <stat+0x52>
+  r = fstat(fd, st);
+    277c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2780:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2783:	48 89 d6             	mov    %rdx,%rsi
+    2786:	89 c7                	mov    %eax,%edi
+    2788:	e8 17 01 00 00       	call   28a4 <fstat>
+    278d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    2790:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2793:	89 c7                	mov    %eax,%edi
+    2795:	e8 da 00 00 00       	call   2874 <close>
+  return r;
+    279a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    279d:	c9                   	leave
+    279e:	c3                   	ret
+
+000000000000279f <atoi>:
+
+int atoi(const char *s) {
+    279f:	55                   	push   %rbp
+    27a0:	48 89 e5             	mov    %rsp,%rbp
+    27a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    27a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    27ae:	eb 28                	jmp    27d8 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    27b0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    27b3:	89 d0                	mov    %edx,%eax
+    27b5:	c1 e0 02             	shl    $0x2,%eax
+    27b8:	01 d0                	add    %edx,%eax
+    27ba:	01 c0                	add    %eax,%eax
+    27bc:	89 c1                	mov    %eax,%ecx
+    27be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27c2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    27c6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    27ca:	0f b6 00             	movzbl (%rax),%eax
+    27cd:	0f be c0             	movsbl %al,%eax
+    27d0:	01 c8                	add    %ecx,%eax
+    27d2:	83 e8 30             	sub    $0x30,%eax
+    27d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    27d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27dc:	0f b6 00             	movzbl (%rax),%eax
+    27df:	3c 2f                	cmp    $0x2f,%al
+    27e1:	7e 0b                	jle    27ee <atoi+0x4f>
+    27e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27e7:	0f b6 00             	movzbl (%rax),%eax
+    27ea:	3c 39                	cmp    $0x39,%al
+    27ec:	7e c2                	jle    27b0 <atoi+0x11>
+  return n;
+    27ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    27f1:	5d                   	pop    %rbp
+    27f2:	c3                   	ret
+
+00000000000027f3 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    27f3:	55                   	push   %rbp
+    27f4:	48 89 e5             	mov    %rsp,%rbp
+    27f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    27ff:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2802:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2806:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    280a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    280e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    2812:	eb 1d                	jmp    2831 <memmove+0x3e>
+    *dst++ = *src++;
+    2814:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2818:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    281c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2820:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2824:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2828:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    282c:	0f b6 12             	movzbl (%rdx),%edx
+    282f:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    2831:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2834:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2837:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    283a:	85 c0                	test   %eax,%eax
+    283c:	7f d6                	jg     2814 <memmove+0x21>
+  return vdst;
+    283e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2842:	5d                   	pop    %rbp
+    2843:	c3                   	ret
+
+0000000000002844 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    2844:	b8 01 00 00 00       	mov    $0x1,%eax
+    2849:	cd 40                	int    $0x40
+    284b:	c3                   	ret
+
+000000000000284c <exit>:
+SYSCALL(exit)
+    284c:	b8 02 00 00 00       	mov    $0x2,%eax
+    2851:	cd 40                	int    $0x40
+    2853:	c3                   	ret
+
+0000000000002854 <wait>:
+SYSCALL(wait)
+    2854:	b8 03 00 00 00       	mov    $0x3,%eax
+    2859:	cd 40                	int    $0x40
+    285b:	c3                   	ret
+
+000000000000285c <pipe>:
+SYSCALL(pipe)
+    285c:	b8 04 00 00 00       	mov    $0x4,%eax
+    2861:	cd 40                	int    $0x40
+    2863:	c3                   	ret
+
+0000000000002864 <read>:
+SYSCALL(read)
+    2864:	b8 05 00 00 00       	mov    $0x5,%eax
+    2869:	cd 40                	int    $0x40
+    286b:	c3                   	ret
+
+000000000000286c <write>:
+SYSCALL(write)
+    286c:	b8 10 00 00 00       	mov    $0x10,%eax
+    2871:	cd 40                	int    $0x40
+    2873:	c3                   	ret
+
+0000000000002874 <close>:
+SYSCALL(close)
+    2874:	b8 15 00 00 00       	mov    $0x15,%eax
+    2879:	cd 40                	int    $0x40
+    287b:	c3                   	ret
+
+000000000000287c <kill>:
+SYSCALL(kill)
+    287c:	b8 06 00 00 00       	mov    $0x6,%eax
+    2881:	cd 40                	int    $0x40
+    2883:	c3                   	ret
+
+0000000000002884 <exec>:
+SYSCALL(exec)
+    2884:	b8 07 00 00 00       	mov    $0x7,%eax
+    2889:	cd 40                	int    $0x40
+    288b:	c3                   	ret
+
+000000000000288c <open>:
+SYSCALL(open)
+    288c:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2891:	cd 40                	int    $0x40
+    2893:	c3                   	ret
+
+0000000000002894 <mknod>:
+SYSCALL(mknod)
+    2894:	b8 11 00 00 00       	mov    $0x11,%eax
+    2899:	cd 40                	int    $0x40
+    289b:	c3                   	ret
+
+000000000000289c <unlink>:
+SYSCALL(unlink)
+    289c:	b8 12 00 00 00       	mov    $0x12,%eax
+    28a1:	cd 40                	int    $0x40
+    28a3:	c3                   	ret
+
+00000000000028a4 <fstat>:
+SYSCALL(fstat)
+    28a4:	b8 08 00 00 00       	mov    $0x8,%eax
+    28a9:	cd 40                	int    $0x40
+    28ab:	c3                   	ret
+
+00000000000028ac <link>:
+SYSCALL(link)
+    28ac:	b8 13 00 00 00       	mov    $0x13,%eax
+    28b1:	cd 40                	int    $0x40
+    28b3:	c3                   	ret
+
+00000000000028b4 <mkdir>:
+SYSCALL(mkdir)
+    28b4:	b8 14 00 00 00       	mov    $0x14,%eax
+    28b9:	cd 40                	int    $0x40
+    28bb:	c3                   	ret
+
+00000000000028bc <chdir>:
+SYSCALL(chdir)
+    28bc:	b8 09 00 00 00       	mov    $0x9,%eax
+    28c1:	cd 40                	int    $0x40
+    28c3:	c3                   	ret
+
+00000000000028c4 <dup>:
+SYSCALL(dup)
+    28c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    28c9:	cd 40                	int    $0x40
+    28cb:	c3                   	ret
+
+00000000000028cc <getpid>:
+SYSCALL(getpid)
+    28cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+    28d1:	cd 40                	int    $0x40
+    28d3:	c3                   	ret
+
+00000000000028d4 <sbrk>:
+SYSCALL(sbrk)
+    28d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+    28d9:	cd 40                	int    $0x40
+    28db:	c3                   	ret
+
+00000000000028dc <sleep>:
+SYSCALL(sleep)
+    28dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+    28e1:	cd 40                	int    $0x40
+    28e3:	c3                   	ret
+
+00000000000028e4 <uptime>:
+SYSCALL(uptime)
+    28e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+    28e9:	cd 40                	int    $0x40
+    28eb:	c3                   	ret
+
+00000000000028ec <sysinfo>:
+SYSCALL(sysinfo)
+    28ec:	b8 16 00 00 00       	mov    $0x16,%eax
+    28f1:	cd 40                	int    $0x40
+    28f3:	c3                   	ret
+
+00000000000028f4 <crashn>:
+SYSCALL(crashn)
+    28f4:	b8 17 00 00 00       	mov    $0x17,%eax
+    28f9:	cd 40                	int    $0x40
+    28fb:	c3                   	ret
+
+00000000000028fc <mmap>:
+SYSCALL(mmap)
+    28fc:	b8 18 00 00 00       	mov    $0x18,%eax
+    2901:	cd 40                	int    $0x40
+    2903:	c3                   	ret
+
+0000000000002904 <munmap>:
+SYSCALL(munmap)
+    2904:	b8 19 00 00 00       	mov    $0x19,%eax
+    2909:	cd 40                	int    $0x40
+    290b:	c3                   	ret
+
+000000000000290c <preface>:
+.globl preface
+preface:
+    call main
+    290c:	e8 63 f7 ff ff       	call   2074 <main>
+    mov %rax, %rdi
+    2911:	48 89 c7             	mov    %rax,%rdi
+    call exit
+    2914:	e8 33 ff ff ff       	call   284c <exit>
+
+0000000000002919 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    2919:	55                   	push   %rbp
+    291a:	48 89 e5             	mov    %rsp,%rbp
+    291d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    2921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2925:	48 83 e8 10          	sub    $0x10,%rax
+    2929:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    292d:	48 8b 05 7c 2e 00 00 	mov    0x2e7c(%rip),%rax        # 57b0 <freep>
+    2934:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2938:	eb 2f                	jmp    2969 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    293a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    293e:	48 8b 00             	mov    (%rax),%rax
+    2941:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2945:	72 17                	jb     295e <free+0x45>
+    2947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    294b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    294f:	72 2f                	jb     2980 <free+0x67>
+    2951:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2955:	48 8b 00             	mov    (%rax),%rax
+    2958:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    295c:	72 22                	jb     2980 <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    295e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2962:	48 8b 00             	mov    (%rax),%rax
+    2965:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2969:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    296d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2971:	73 c7                	jae    293a <free+0x21>
+    2973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2977:	48 8b 00             	mov    (%rax),%rax
+    297a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    297e:	73 ba                	jae    293a <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    2980:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2984:	8b 40 08             	mov    0x8(%rax),%eax
+    2987:	89 c0                	mov    %eax,%eax
+    2989:	48 c1 e0 04          	shl    $0x4,%rax
+    298d:	48 89 c2             	mov    %rax,%rdx
+    2990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2994:	48 01 c2             	add    %rax,%rdx
+    2997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    299b:	48 8b 00             	mov    (%rax),%rax
+    299e:	48 39 c2             	cmp    %rax,%rdx
+    29a1:	75 2d                	jne    29d0 <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    29a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29a7:	8b 50 08             	mov    0x8(%rax),%edx
+    29aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ae:	48 8b 00             	mov    (%rax),%rax
+    29b1:	8b 40 08             	mov    0x8(%rax),%eax
+    29b4:	01 c2                	add    %eax,%edx
+    29b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29ba:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    29bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29c1:	48 8b 00             	mov    (%rax),%rax
+    29c4:	48 8b 10             	mov    (%rax),%rdx
+    29c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29cb:	48 89 10             	mov    %rdx,(%rax)
+    29ce:	eb 0e                	jmp    29de <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    29d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29d4:	48 8b 10             	mov    (%rax),%rdx
+    29d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29db:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    29de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29e2:	8b 40 08             	mov    0x8(%rax),%eax
+    29e5:	89 c0                	mov    %eax,%eax
+    29e7:	48 c1 e0 04          	shl    $0x4,%rax
+    29eb:	48 89 c2             	mov    %rax,%rdx
+    29ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29f2:	48 01 d0             	add    %rdx,%rax
+    29f5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    29f9:	75 27                	jne    2a22 <free+0x109>
+    p->s.size += bp->s.size;
+    29fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ff:	8b 50 08             	mov    0x8(%rax),%edx
+    2a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a06:	8b 40 08             	mov    0x8(%rax),%eax
+    2a09:	01 c2                	add    %eax,%edx
+    2a0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a0f:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a16:	48 8b 10             	mov    (%rax),%rdx
+    2a19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a1d:	48 89 10             	mov    %rdx,(%rax)
+    2a20:	eb 0b                	jmp    2a2d <free+0x114>
+  } else
+    p->s.ptr = bp;
+    2a22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a2a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    2a2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a31:	48 89 05 78 2d 00 00 	mov    %rax,0x2d78(%rip)        # 57b0 <freep>
+}
+    2a38:	90                   	nop
+    2a39:	5d                   	pop    %rbp
+    2a3a:	c3                   	ret
+
+0000000000002a3b <morecore>:
+
+static Header *morecore(uint nu) {
+    2a3b:	55                   	push   %rbp
+    2a3c:	48 89 e5             	mov    %rsp,%rbp
+    2a3f:	48 83 ec 20          	sub    $0x20,%rsp
+    2a43:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    2a46:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    2a4d:	77 07                	ja     2a56 <morecore+0x1b>
+    nu = 4096;
+    2a4f:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    2a56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2a59:	c1 e0 04             	shl    $0x4,%eax
+    2a5c:	89 c7                	mov    %eax,%edi
+    2a5e:	e8 71 fe ff ff       	call   28d4 <sbrk>
+    2a63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    2a67:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2a6c:	75 07                	jne    2a75 <morecore+0x3a>
+    return 0;
+    2a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a73:	eb 29                	jmp    2a9e <morecore+0x63>
+  hp = (Header *)p;
+    2a75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a79:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    2a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a81:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2a84:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    2a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a8b:	48 83 c0 10          	add    $0x10,%rax
+    2a8f:	48 89 c7             	mov    %rax,%rdi
+    2a92:	e8 82 fe ff ff       	call   2919 <free>
+  return freep;
+    2a97:	48 8b 05 12 2d 00 00 	mov    0x2d12(%rip),%rax        # 57b0 <freep>
+}
+    2a9e:	c9                   	leave
+    2a9f:	c3                   	ret
+
+0000000000002aa0 <malloc>:
+
+void *malloc(uint nbytes) {
+    2aa0:	55                   	push   %rbp
+    2aa1:	48 89 e5             	mov    %rsp,%rbp
+    2aa4:	48 83 ec 30          	sub    $0x30,%rsp
+    2aa8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    2aab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2aae:	48 83 c0 0f          	add    $0xf,%rax
+    2ab2:	48 c1 e8 04          	shr    $0x4,%rax
+    2ab6:	83 c0 01             	add    $0x1,%eax
+    2ab9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    2abc:	48 8b 05 ed 2c 00 00 	mov    0x2ced(%rip),%rax        # 57b0 <freep>
+    2ac3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2ac7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2acc:	75 2e                	jne    2afc <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    2ace:	48 8d 05 cb 2c 00 00 	lea    0x2ccb(%rip),%rax        # 57a0 <base>
+    2ad5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2ad9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2add:	48 89 05 cc 2c 00 00 	mov    %rax,0x2ccc(%rip)        # 57b0 <freep>
+    2ae4:	48 8b 05 c5 2c 00 00 	mov    0x2cc5(%rip),%rax        # 57b0 <freep>
+    2aeb:	48 89 05 ae 2c 00 00 	mov    %rax,0x2cae(%rip)        # 57a0 <base>
+    base.s.size = 0;
+    2af2:	c7 05 ac 2c 00 00 00 	movl   $0x0,0x2cac(%rip)        # 57a8 <base+0x8>
+    2af9:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2afc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b00:	48 8b 00             	mov    (%rax),%rax
+    2b03:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b0b:	8b 40 08             	mov    0x8(%rax),%eax
+    2b0e:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    2b11:	72 5f                	jb     2b72 <malloc+0xd2>
+      if (p->s.size == nunits)
+    2b13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b17:	8b 40 08             	mov    0x8(%rax),%eax
+    2b1a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    2b1d:	75 10                	jne    2b2f <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    2b1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b23:	48 8b 10             	mov    (%rax),%rdx
+    2b26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b2a:	48 89 10             	mov    %rdx,(%rax)
+    2b2d:	eb 2e                	jmp    2b5d <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    2b2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b33:	8b 40 08             	mov    0x8(%rax),%eax
+    2b36:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    2b39:	89 c2                	mov    %eax,%edx
+    2b3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b3f:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    2b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b46:	8b 40 08             	mov    0x8(%rax),%eax
+    2b49:	89 c0                	mov    %eax,%eax
+    2b4b:	48 c1 e0 04          	shl    $0x4,%rax
+    2b4f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    2b53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b57:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2b5a:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    2b5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b61:	48 89 05 48 2c 00 00 	mov    %rax,0x2c48(%rip)        # 57b0 <freep>
+      return (void *)(p + 1);
+    2b68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6c:	48 83 c0 10          	add    $0x10,%rax
+    2b70:	eb 41                	jmp    2bb3 <malloc+0x113>
+    }
+    if (p == freep)
+    2b72:	48 8b 05 37 2c 00 00 	mov    0x2c37(%rip),%rax        # 57b0 <freep>
+    2b79:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2b7d:	75 1c                	jne    2b9b <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    2b7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2b82:	89 c7                	mov    %eax,%edi
+    2b84:	e8 b2 fe ff ff       	call   2a3b <morecore>
+    2b89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2b8d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2b92:	75 07                	jne    2b9b <malloc+0xfb>
+        return 0;
+    2b94:	b8 00 00 00 00       	mov    $0x0,%eax
+    2b99:	eb 18                	jmp    2bb3 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    2b9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ba7:	48 8b 00             	mov    (%rax),%rax
+    2baa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    2bae:	e9 54 ff ff ff       	jmp    2b07 <malloc+0x67>
+  }
+    2bb3:	c9                   	leave
+    2bb4:	c3                   	ret
@@ -0,0 +1,2596 @@
+
+out/user/_lab5test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void privatetest(void);
+void forktest(void);
+void munmaptest(void);
+void unlinktest(void);
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  makefile();
+       f:	e8 7f 00 00 00       	call   93 <makefile>
+  sharetest();
+      14:	e8 77 05 00 00       	call   590 <sharetest>
+  privatetest();
+      19:	e8 f2 08 00 00       	call   910 <privatetest>
+  forktest();
+      1e:	e8 ea 0a 00 00       	call   b0d <forktest>
+  munmaptest();
+      23:	e8 d3 0d 00 00       	call   dfb <munmaptest>
+  unlinktest();
+      28:	e8 10 10 00 00       	call   103d <unlinktest>
+
+  printf(stdout, "lab5 tests passed!!\n");
+      2d:	8b 05 6d 23 00 00    	mov    0x236d(%rip),%eax        # 23a0 <stdout>
+      33:	48 8d 15 87 1c 00 00 	lea    0x1c87(%rip),%rdx        # 1cc1 <malloc+0x124>
+      3a:	48 89 d6             	mov    %rdx,%rsi
+      3d:	89 c7                	mov    %eax,%edi
+      3f:	b8 00 00 00 00       	mov    $0x0,%eax
+      44:	e8 59 13 00 00       	call   13a2 <printf>
+
+  exit();
+      49:	e8 fb 18 00 00       	call   1949 <exit>
+
+000000000000004e <pattern>:
+  return 0;
+}
+
+// Byte i of the test file.
+char pattern(int i) {
+      4e:	55                   	push   %rbp
+      4f:	48 89 e5             	mov    %rsp,%rbp
+      52:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return 'a' + (i / PGSIZE + i) % 26;
+      55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      58:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+      5e:	85 c0                	test   %eax,%eax
+      60:	0f 48 c2             	cmovs  %edx,%eax
+      63:	c1 f8 0c             	sar    $0xc,%eax
+      66:	89 c2                	mov    %eax,%edx
+      68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      6b:	01 d0                	add    %edx,%eax
+      6d:	48 63 d0             	movslq %eax,%rdx
+      70:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+      77:	48 c1 ea 20          	shr    $0x20,%rdx
+      7b:	c1 fa 03             	sar    $0x3,%edx
+      7e:	89 c1                	mov    %eax,%ecx
+      80:	c1 f9 1f             	sar    $0x1f,%ecx
+      83:	29 ca                	sub    %ecx,%edx
+      85:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+      88:	29 c8                	sub    %ecx,%eax
+      8a:	89 c2                	mov    %eax,%edx
+      8c:	89 d0                	mov    %edx,%eax
+      8e:	83 c0 61             	add    $0x61,%eax
+}
+      91:	5d                   	pop    %rbp
+      92:	c3                   	ret
+
+0000000000000093 <makefile>:
+
+void makefile(void) {
+      93:	55                   	push   %rbp
+      94:	48 89 e5             	mov    %rsp,%rbp
+      97:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+
+  for (i = 0; i < sizeof(buf); i++)
+      9b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      a2:	eb 1e                	jmp    c2 <makefile+0x2f>
+    buf[i] = pattern(i);
+      a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a7:	89 c7                	mov    %eax,%edi
+      a9:	e8 a0 ff ff ff       	call   4e <pattern>
+      ae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      b1:	48 63 d2             	movslq %edx,%rdx
+      b4:	48 8d 0d 45 23 00 00 	lea    0x2345(%rip),%rcx        # 2400 <buf>
+      bb:	88 04 0a             	mov    %al,(%rdx,%rcx,1)
+  for (i = 0; i < sizeof(buf); i++)
+      be:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      c5:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+      ca:	76 d8                	jbe    a4 <makefile+0x11>
+  if ((fd = open(file_name, O_CREATE | O_RDWR)) < 0)
+      cc:	48 8b 05 d5 22 00 00 	mov    0x22d5(%rip),%rax        # 23a8 <file_name>
+      d3:	be 02 02 00 00       	mov    $0x202,%esi
+      d8:	48 89 c7             	mov    %rax,%rdi
+      db:	e8 a9 18 00 00       	call   1989 <open>
+      e0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      e3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      e7:	79 63                	jns    14c <makefile+0xb9>
+    error("couldn't create %s", file_name);
+      e9:	8b 05 b1 22 00 00    	mov    0x22b1(%rip),%eax        # 23a0 <stdout>
+      ef:	ba 37 00 00 00       	mov    $0x37,%edx
+      f4:	48 8d 0d db 1b 00 00 	lea    0x1bdb(%rip),%rcx        # 1cd6 <malloc+0x139>
+      fb:	48 89 ce             	mov    %rcx,%rsi
+      fe:	89 c7                	mov    %eax,%edi
+     100:	b8 00 00 00 00       	mov    $0x0,%eax
+     105:	e8 98 12 00 00       	call   13a2 <printf>
+     10a:	48 8b 15 97 22 00 00 	mov    0x2297(%rip),%rdx        # 23a8 <file_name>
+     111:	8b 05 89 22 00 00    	mov    0x2289(%rip),%eax        # 23a0 <stdout>
+     117:	48 8d 0d ca 1b 00 00 	lea    0x1bca(%rip),%rcx        # 1ce8 <malloc+0x14b>
+     11e:	48 89 ce             	mov    %rcx,%rsi
+     121:	89 c7                	mov    %eax,%edi
+     123:	b8 00 00 00 00       	mov    $0x0,%eax
+     128:	e8 75 12 00 00       	call   13a2 <printf>
+     12d:	8b 05 6d 22 00 00    	mov    0x226d(%rip),%eax        # 23a0 <stdout>
+     133:	48 8d 15 c1 1b 00 00 	lea    0x1bc1(%rip),%rdx        # 1cfb <malloc+0x15e>
+     13a:	48 89 d6             	mov    %rdx,%rsi
+     13d:	89 c7                	mov    %eax,%edi
+     13f:	b8 00 00 00 00       	mov    $0x0,%eax
+     144:	e8 59 12 00 00       	call   13a2 <printf>
+     149:	90                   	nop
+     14a:	eb fd                	jmp    149 <makefile+0xb6>
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+     14c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     14f:	ba 00 20 00 00       	mov    $0x2000,%edx
+     154:	48 8d 0d a5 22 00 00 	lea    0x22a5(%rip),%rcx        # 2400 <buf>
+     15b:	48 89 ce             	mov    %rcx,%rsi
+     15e:	89 c7                	mov    %eax,%edi
+     160:	e8 04 18 00 00       	call   1969 <write>
+     165:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     16a:	74 63                	je     1cf <makefile+0x13c>
+    error("couldn't write %s", file_name);
+     16c:	8b 05 2e 22 00 00    	mov    0x222e(%rip),%eax        # 23a0 <stdout>
+     172:	ba 39 00 00 00       	mov    $0x39,%edx
+     177:	48 8d 0d 58 1b 00 00 	lea    0x1b58(%rip),%rcx        # 1cd6 <malloc+0x139>
+     17e:	48 89 ce             	mov    %rcx,%rsi
+     181:	89 c7                	mov    %eax,%edi
+     183:	b8 00 00 00 00       	mov    $0x0,%eax
+     188:	e8 15 12 00 00       	call   13a2 <printf>
+     18d:	48 8b 15 14 22 00 00 	mov    0x2214(%rip),%rdx        # 23a8 <file_name>
+     194:	8b 05 06 22 00 00    	mov    0x2206(%rip),%eax        # 23a0 <stdout>
+     19a:	48 8d 0d 5c 1b 00 00 	lea    0x1b5c(%rip),%rcx        # 1cfd <malloc+0x160>
+     1a1:	48 89 ce             	mov    %rcx,%rsi
+     1a4:	89 c7                	mov    %eax,%edi
+     1a6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ab:	e8 f2 11 00 00       	call   13a2 <printf>
+     1b0:	8b 05 ea 21 00 00    	mov    0x21ea(%rip),%eax        # 23a0 <stdout>
+     1b6:	48 8d 15 3e 1b 00 00 	lea    0x1b3e(%rip),%rdx        # 1cfb <malloc+0x15e>
+     1bd:	48 89 d6             	mov    %rdx,%rsi
+     1c0:	89 c7                	mov    %eax,%edi
+     1c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c7:	e8 d6 11 00 00       	call   13a2 <printf>
+     1cc:	90                   	nop
+     1cd:	eb fd                	jmp    1cc <makefile+0x139>
+  close(fd);
+     1cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1d2:	89 c7                	mov    %eax,%edi
+     1d4:	e8 98 17 00 00       	call   1971 <close>
+}
+     1d9:	90                   	nop
+     1da:	c9                   	leave
+     1db:	c3                   	ret
+
+00000000000001dc <checkfile>:
+
+// Does the file still hold the pattern?
+void checkfile(void) {
+     1dc:	55                   	push   %rbp
+     1dd:	48 89 e5             	mov    %rsp,%rbp
+     1e0:	53                   	push   %rbx
+     1e1:	48 83 ec 18          	sub    $0x18,%rsp
+  int fd, i;
+
+  if ((fd = open(file_name, O_RDONLY)) < 0)
+     1e5:	48 8b 05 bc 21 00 00 	mov    0x21bc(%rip),%rax        # 23a8 <file_name>
+     1ec:	be 00 00 00 00       	mov    $0x0,%esi
+     1f1:	48 89 c7             	mov    %rax,%rdi
+     1f4:	e8 90 17 00 00       	call   1989 <open>
+     1f9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+     1fc:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     200:	79 63                	jns    265 <checkfile+0x89>
+    error("couldn't open %s", file_name);
+     202:	8b 05 98 21 00 00    	mov    0x2198(%rip),%eax        # 23a0 <stdout>
+     208:	ba 42 00 00 00       	mov    $0x42,%edx
+     20d:	48 8d 0d c2 1a 00 00 	lea    0x1ac2(%rip),%rcx        # 1cd6 <malloc+0x139>
+     214:	48 89 ce             	mov    %rcx,%rsi
+     217:	89 c7                	mov    %eax,%edi
+     219:	b8 00 00 00 00       	mov    $0x0,%eax
+     21e:	e8 7f 11 00 00       	call   13a2 <printf>
+     223:	48 8b 15 7e 21 00 00 	mov    0x217e(%rip),%rdx        # 23a8 <file_name>
+     22a:	8b 05 70 21 00 00    	mov    0x2170(%rip),%eax        # 23a0 <stdout>
+     230:	48 8d 0d d8 1a 00 00 	lea    0x1ad8(%rip),%rcx        # 1d0f <malloc+0x172>
+     237:	48 89 ce             	mov    %rcx,%rsi
+     23a:	89 c7                	mov    %eax,%edi
+     23c:	b8 00 00 00 00       	mov    $0x0,%eax
+     241:	e8 5c 11 00 00       	call   13a2 <printf>
+     246:	8b 05 54 21 00 00    	mov    0x2154(%rip),%eax        # 23a0 <stdout>
+     24c:	48 8d 15 a8 1a 00 00 	lea    0x1aa8(%rip),%rdx        # 1cfb <malloc+0x15e>
+     253:	48 89 d6             	mov    %rdx,%rsi
+     256:	89 c7                	mov    %eax,%edi
+     258:	b8 00 00 00 00       	mov    $0x0,%eax
+     25d:	e8 40 11 00 00       	call   13a2 <printf>
+     262:	90                   	nop
+     263:	eb fd                	jmp    262 <checkfile+0x86>
+  if (read(fd, buf, sizeof(buf)) != sizeof(buf))
+     265:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     268:	ba 00 20 00 00       	mov    $0x2000,%edx
+     26d:	48 8d 0d 8c 21 00 00 	lea    0x218c(%rip),%rcx        # 2400 <buf>
+     274:	48 89 ce             	mov    %rcx,%rsi
+     277:	89 c7                	mov    %eax,%edi
+     279:	e8 e3 16 00 00       	call   1961 <read>
+     27e:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     283:	74 63                	je     2e8 <checkfile+0x10c>
+    error("couldn't read %s", file_name);
+     285:	8b 05 15 21 00 00    	mov    0x2115(%rip),%eax        # 23a0 <stdout>
+     28b:	ba 44 00 00 00       	mov    $0x44,%edx
+     290:	48 8d 0d 3f 1a 00 00 	lea    0x1a3f(%rip),%rcx        # 1cd6 <malloc+0x139>
+     297:	48 89 ce             	mov    %rcx,%rsi
+     29a:	89 c7                	mov    %eax,%edi
+     29c:	b8 00 00 00 00       	mov    $0x0,%eax
+     2a1:	e8 fc 10 00 00       	call   13a2 <printf>
+     2a6:	48 8b 15 fb 20 00 00 	mov    0x20fb(%rip),%rdx        # 23a8 <file_name>
+     2ad:	8b 05 ed 20 00 00    	mov    0x20ed(%rip),%eax        # 23a0 <stdout>
+     2b3:	48 8d 0d 66 1a 00 00 	lea    0x1a66(%rip),%rcx        # 1d20 <malloc+0x183>
+     2ba:	48 89 ce             	mov    %rcx,%rsi
+     2bd:	89 c7                	mov    %eax,%edi
+     2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c4:	e8 d9 10 00 00       	call   13a2 <printf>
+     2c9:	8b 05 d1 20 00 00    	mov    0x20d1(%rip),%eax        # 23a0 <stdout>
+     2cf:	48 8d 15 25 1a 00 00 	lea    0x1a25(%rip),%rdx        # 1cfb <malloc+0x15e>
+     2d6:	48 89 d6             	mov    %rdx,%rsi
+     2d9:	89 c7                	mov    %eax,%edi
+     2db:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e0:	e8 bd 10 00 00       	call   13a2 <printf>
+     2e5:	90                   	nop
+     2e6:	eb fd                	jmp    2e5 <checkfile+0x109>
+  close(fd);
+     2e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     2eb:	89 c7                	mov    %eax,%edi
+     2ed:	e8 7f 16 00 00       	call   1971 <close>
+  for (i = 0; i < sizeof(buf); i++)
+     2f2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     2f9:	e9 a1 00 00 00       	jmp    39f <checkfile+0x1c3>
+    if (buf[i] != pattern(i))
+     2fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     301:	48 98                	cltq
+     303:	48 8d 15 f6 20 00 00 	lea    0x20f6(%rip),%rdx        # 2400 <buf>
+     30a:	0f b6 1c 10          	movzbl (%rax,%rdx,1),%ebx
+     30e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     311:	89 c7                	mov    %eax,%edi
+     313:	e8 36 fd ff ff       	call   4e <pattern>
+     318:	38 c3                	cmp    %al,%bl
+     31a:	74 7f                	je     39b <checkfile+0x1bf>
+      error("file byte %d is %d, should be %d", i, buf[i], pattern(i));
+     31c:	8b 05 7e 20 00 00    	mov    0x207e(%rip),%eax        # 23a0 <stdout>
+     322:	ba 48 00 00 00       	mov    $0x48,%edx
+     327:	48 8d 0d a8 19 00 00 	lea    0x19a8(%rip),%rcx        # 1cd6 <malloc+0x139>
+     32e:	48 89 ce             	mov    %rcx,%rsi
+     331:	89 c7                	mov    %eax,%edi
+     333:	b8 00 00 00 00       	mov    $0x0,%eax
+     338:	e8 65 10 00 00       	call   13a2 <printf>
+     33d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     340:	89 c7                	mov    %eax,%edi
+     342:	e8 07 fd ff ff       	call   4e <pattern>
+     347:	0f be f0             	movsbl %al,%esi
+     34a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     34d:	48 98                	cltq
+     34f:	48 8d 15 aa 20 00 00 	lea    0x20aa(%rip),%rdx        # 2400 <buf>
+     356:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     35a:	0f be c8             	movsbl %al,%ecx
+     35d:	8b 05 3d 20 00 00    	mov    0x203d(%rip),%eax        # 23a0 <stdout>
+     363:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     366:	41 89 f0             	mov    %esi,%r8d
+     369:	48 8d 35 c8 19 00 00 	lea    0x19c8(%rip),%rsi        # 1d38 <malloc+0x19b>
+     370:	89 c7                	mov    %eax,%edi
+     372:	b8 00 00 00 00       	mov    $0x0,%eax
+     377:	e8 26 10 00 00       	call   13a2 <printf>
+     37c:	8b 05 1e 20 00 00    	mov    0x201e(%rip),%eax        # 23a0 <stdout>
+     382:	48 8d 15 72 19 00 00 	lea    0x1972(%rip),%rdx        # 1cfb <malloc+0x15e>
+     389:	48 89 d6             	mov    %rdx,%rsi
+     38c:	89 c7                	mov    %eax,%edi
+     38e:	b8 00 00 00 00       	mov    $0x0,%eax
+     393:	e8 0a 10 00 00       	call   13a2 <printf>
+     398:	90                   	nop
+     399:	eb fd                	jmp    398 <checkfile+0x1bc>
+  for (i = 0; i < sizeof(buf); i++)
+     39b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     39f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     3a2:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+     3a7:	0f 86 51 ff ff ff    	jbe    2fe <checkfile+0x122>
+}
+     3ad:	90                   	nop
+     3ae:	90                   	nop
+     3af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     3b3:	c9                   	leave
+     3b4:	c3                   	ret
+
+00000000000003b5 <mapfile>:
+
+// Maps the test file and checks the mapping holds the pattern.
+char *mapfile(int prot) {
+     3b5:	55                   	push   %rbp
+     3b6:	48 89 e5             	mov    %rsp,%rbp
+     3b9:	53                   	push   %rbx
+     3ba:	48 83 ec 28          	sub    $0x28,%rsp
+     3be:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  char *p;
+  int fd, i;
+
+  if ((fd = open(file_name, O_RDONLY)) < 0)
+     3c1:	48 8b 05 e0 1f 00 00 	mov    0x1fe0(%rip),%rax        # 23a8 <file_name>
+     3c8:	be 00 00 00 00       	mov    $0x0,%esi
+     3cd:	48 89 c7             	mov    %rax,%rdi
+     3d0:	e8 b4 15 00 00       	call   1989 <open>
+     3d5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+     3d8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     3dc:	79 63                	jns    441 <mapfile+0x8c>
+    error("couldn't open %s", file_name);
+     3de:	8b 05 bc 1f 00 00    	mov    0x1fbc(%rip),%eax        # 23a0 <stdout>
+     3e4:	ba 51 00 00 00       	mov    $0x51,%edx
+     3e9:	48 8d 0d e6 18 00 00 	lea    0x18e6(%rip),%rcx        # 1cd6 <malloc+0x139>
+     3f0:	48 89 ce             	mov    %rcx,%rsi
+     3f3:	89 c7                	mov    %eax,%edi
+     3f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3fa:	e8 a3 0f 00 00       	call   13a2 <printf>
+     3ff:	48 8b 15 a2 1f 00 00 	mov    0x1fa2(%rip),%rdx        # 23a8 <file_name>
+     406:	8b 05 94 1f 00 00    	mov    0x1f94(%rip),%eax        # 23a0 <stdout>
+     40c:	48 8d 0d fc 18 00 00 	lea    0x18fc(%rip),%rcx        # 1d0f <malloc+0x172>
+     413:	48 89 ce             	mov    %rcx,%rsi
+     416:	89 c7                	mov    %eax,%edi
+     418:	b8 00 00 00 00       	mov    $0x0,%eax
+     41d:	e8 80 0f 00 00       	call   13a2 <printf>
+     422:	8b 05 78 1f 00 00    	mov    0x1f78(%rip),%eax        # 23a0 <stdout>
+     428:	48 8d 15 cc 18 00 00 	lea    0x18cc(%rip),%rdx        # 1cfb <malloc+0x15e>
+     42f:	48 89 d6             	mov    %rdx,%rsi
+     432:	89 c7                	mov    %eax,%edi
+     434:	b8 00 00 00 00       	mov    $0x0,%eax
+     439:	e8 64 0f 00 00       	call   13a2 <printf>
+     43e:	90                   	nop
+     43f:	eb fd                	jmp    43e <mapfile+0x89>
+  if ((p = mmap(fd, 0, sizeof(buf), prot)) == (char *)-1)
+     441:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     444:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     447:	89 d1                	mov    %edx,%ecx
+     449:	ba 00 20 00 00       	mov    $0x2000,%edx
+     44e:	be 00 00 00 00       	mov    $0x0,%esi
+     453:	89 c7                	mov    %eax,%edi
+     455:	e8 9f 15 00 00       	call   19f9 <mmap>
+     45a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     45e:	48 83 7d e0 ff       	cmpq   $0xffffffffffffffff,-0x20(%rbp)
+     463:	75 5c                	jne    4c1 <mapfile+0x10c>
+    error("mmap failed");
+     465:	8b 05 35 1f 00 00    	mov    0x1f35(%rip),%eax        # 23a0 <stdout>
+     46b:	ba 53 00 00 00       	mov    $0x53,%edx
+     470:	48 8d 0d 5f 18 00 00 	lea    0x185f(%rip),%rcx        # 1cd6 <malloc+0x139>
+     477:	48 89 ce             	mov    %rcx,%rsi
+     47a:	89 c7                	mov    %eax,%edi
+     47c:	b8 00 00 00 00       	mov    $0x0,%eax
+     481:	e8 1c 0f 00 00       	call   13a2 <printf>
+     486:	8b 05 14 1f 00 00    	mov    0x1f14(%rip),%eax        # 23a0 <stdout>
+     48c:	48 8d 15 c6 18 00 00 	lea    0x18c6(%rip),%rdx        # 1d59 <malloc+0x1bc>
+     493:	48 89 d6             	mov    %rdx,%rsi
+     496:	89 c7                	mov    %eax,%edi
+     498:	b8 00 00 00 00       	mov    $0x0,%eax
+     49d:	e8 00 0f 00 00       	call   13a2 <printf>
+     4a2:	8b 05 f8 1e 00 00    	mov    0x1ef8(%rip),%eax        # 23a0 <stdout>
+     4a8:	48 8d 15 4c 18 00 00 	lea    0x184c(%rip),%rdx        # 1cfb <malloc+0x15e>
+     4af:	48 89 d6             	mov    %rdx,%rsi
+     4b2:	89 c7                	mov    %eax,%edi
+     4b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b9:	e8 e4 0e 00 00       	call   13a2 <printf>
+     4be:	90                   	nop
+     4bf:	eb fd                	jmp    4be <mapfile+0x109>
+  close(fd);
+     4c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     4c4:	89 c7                	mov    %eax,%edi
+     4c6:	e8 a6 14 00 00       	call   1971 <close>
+  for (i = 0; i < sizeof(buf); i++)
+     4cb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     4d2:	e9 a1 00 00 00       	jmp    578 <mapfile+0x1c3>
+    if (p[i] != pattern(i))
+     4d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4da:	48 63 d0             	movslq %eax,%rdx
+     4dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     4e1:	48 01 d0             	add    %rdx,%rax
+     4e4:	0f b6 18             	movzbl (%rax),%ebx
+     4e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4ea:	89 c7                	mov    %eax,%edi
+     4ec:	e8 5d fb ff ff       	call   4e <pattern>
+     4f1:	38 c3                	cmp    %al,%bl
+     4f3:	74 7f                	je     574 <mapfile+0x1bf>
+      error("mapped byte %d is %d, should be %d", i, p[i], pattern(i));
+     4f5:	8b 05 a5 1e 00 00    	mov    0x1ea5(%rip),%eax        # 23a0 <stdout>
+     4fb:	ba 57 00 00 00       	mov    $0x57,%edx
+     500:	48 8d 0d cf 17 00 00 	lea    0x17cf(%rip),%rcx        # 1cd6 <malloc+0x139>
+     507:	48 89 ce             	mov    %rcx,%rsi
+     50a:	89 c7                	mov    %eax,%edi
+     50c:	b8 00 00 00 00       	mov    $0x0,%eax
+     511:	e8 8c 0e 00 00       	call   13a2 <printf>
+     516:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     519:	89 c7                	mov    %eax,%edi
+     51b:	e8 2e fb ff ff       	call   4e <pattern>
+     520:	0f be f0             	movsbl %al,%esi
+     523:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     526:	48 63 d0             	movslq %eax,%rdx
+     529:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     52d:	48 01 d0             	add    %rdx,%rax
+     530:	0f b6 00             	movzbl (%rax),%eax
+     533:	0f be c8             	movsbl %al,%ecx
+     536:	8b 05 64 1e 00 00    	mov    0x1e64(%rip),%eax        # 23a0 <stdout>
+     53c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     53f:	41 89 f0             	mov    %esi,%r8d
+     542:	48 8d 35 1f 18 00 00 	lea    0x181f(%rip),%rsi        # 1d68 <malloc+0x1cb>
+     549:	89 c7                	mov    %eax,%edi
+     54b:	b8 00 00 00 00       	mov    $0x0,%eax
+     550:	e8 4d 0e 00 00       	call   13a2 <printf>
+     555:	8b 05 45 1e 00 00    	mov    0x1e45(%rip),%eax        # 23a0 <stdout>
+     55b:	48 8d 15 99 17 00 00 	lea    0x1799(%rip),%rdx        # 1cfb <malloc+0x15e>
+     562:	48 89 d6             	mov    %rdx,%rsi
+     565:	89 c7                	mov    %eax,%edi
+     567:	b8 00 00 00 00       	mov    $0x0,%eax
+     56c:	e8 31 0e 00 00       	call   13a2 <printf>
+     571:	90                   	nop
+     572:	eb fd                	jmp    571 <mapfile+0x1bc>
+  for (i = 0; i < sizeof(buf); i++)
+     574:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     578:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     57b:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+     580:	0f 86 51 ff ff ff    	jbe    4d7 <mapfile+0x122>
+  return p;
+     586:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+     58a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     58e:	c9                   	leave
+     58f:	c3                   	ret
+
+0000000000000590 <sharetest>:
+
+// Two processes that map the file share the page cache's frames, so
+// a write() by one shows up in the other's mapping.
+void sharetest(void) {
+     590:	55                   	push   %rbp
+     591:	48 89 e5             	mov    %rsp,%rbp
+     594:	48 83 ec 30          	sub    $0x30,%rsp
+  int toparent[2], tochild[2], fd, pid;
+  char *p, c;
+
+  printf(stdout, "sharetest\n");
+     598:	8b 05 02 1e 00 00    	mov    0x1e02(%rip),%eax        # 23a0 <stdout>
+     59e:	48 8d 15 e6 17 00 00 	lea    0x17e6(%rip),%rdx        # 1d8b <malloc+0x1ee>
+     5a5:	48 89 d6             	mov    %rdx,%rsi
+     5a8:	89 c7                	mov    %eax,%edi
+     5aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     5af:	e8 ee 0d 00 00       	call   13a2 <printf>
+  if (pipe(toparent) < 0 || pipe(tochild) < 0)
+     5b4:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+     5b8:	48 89 c7             	mov    %rax,%rdi
+     5bb:	e8 99 13 00 00       	call   1959 <pipe>
+     5c0:	85 c0                	test   %eax,%eax
+     5c2:	78 10                	js     5d4 <sharetest+0x44>
+     5c4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     5c8:	48 89 c7             	mov    %rax,%rdi
+     5cb:	e8 89 13 00 00       	call   1959 <pipe>
+     5d0:	85 c0                	test   %eax,%eax
+     5d2:	79 5c                	jns    630 <sharetest+0xa0>
+    error("pipe failed");
+     5d4:	8b 05 c6 1d 00 00    	mov    0x1dc6(%rip),%eax        # 23a0 <stdout>
+     5da:	ba 63 00 00 00       	mov    $0x63,%edx
+     5df:	48 8d 0d f0 16 00 00 	lea    0x16f0(%rip),%rcx        # 1cd6 <malloc+0x139>
+     5e6:	48 89 ce             	mov    %rcx,%rsi
+     5e9:	89 c7                	mov    %eax,%edi
+     5eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f0:	e8 ad 0d 00 00       	call   13a2 <printf>
+     5f5:	8b 05 a5 1d 00 00    	mov    0x1da5(%rip),%eax        # 23a0 <stdout>
+     5fb:	48 8d 15 94 17 00 00 	lea    0x1794(%rip),%rdx        # 1d96 <malloc+0x1f9>
+     602:	48 89 d6             	mov    %rdx,%rsi
+     605:	89 c7                	mov    %eax,%edi
+     607:	b8 00 00 00 00       	mov    $0x0,%eax
+     60c:	e8 91 0d 00 00       	call   13a2 <printf>
+     611:	8b 05 89 1d 00 00    	mov    0x1d89(%rip),%eax        # 23a0 <stdout>
+     617:	48 8d 15 dd 16 00 00 	lea    0x16dd(%rip),%rdx        # 1cfb <malloc+0x15e>
+     61e:	48 89 d6             	mov    %rdx,%rsi
+     621:	89 c7                	mov    %eax,%edi
+     623:	b8 00 00 00 00       	mov    $0x0,%eax
+     628:	e8 75 0d 00 00       	call   13a2 <printf>
+     62d:	90                   	nop
+     62e:	eb fd                	jmp    62d <sharetest+0x9d>
+  if ((pid = fork()) < 0)
+     630:	e8 0c 13 00 00       	call   1941 <fork>
+     635:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     638:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     63c:	79 5c                	jns    69a <sharetest+0x10a>
+    error("fork failed");
+     63e:	8b 05 5c 1d 00 00    	mov    0x1d5c(%rip),%eax        # 23a0 <stdout>
+     644:	ba 65 00 00 00       	mov    $0x65,%edx
+     649:	48 8d 0d 86 16 00 00 	lea    0x1686(%rip),%rcx        # 1cd6 <malloc+0x139>
+     650:	48 89 ce             	mov    %rcx,%rsi
+     653:	89 c7                	mov    %eax,%edi
+     655:	b8 00 00 00 00       	mov    $0x0,%eax
+     65a:	e8 43 0d 00 00       	call   13a2 <printf>
+     65f:	8b 05 3b 1d 00 00    	mov    0x1d3b(%rip),%eax        # 23a0 <stdout>
+     665:	48 8d 15 36 17 00 00 	lea    0x1736(%rip),%rdx        # 1da2 <malloc+0x205>
+     66c:	48 89 d6             	mov    %rdx,%rsi
+     66f:	89 c7                	mov    %eax,%edi
+     671:	b8 00 00 00 00       	mov    $0x0,%eax
+     676:	e8 27 0d 00 00       	call   13a2 <printf>
+     67b:	8b 05 1f 1d 00 00    	mov    0x1d1f(%rip),%eax        # 23a0 <stdout>
+     681:	48 8d 15 73 16 00 00 	lea    0x1673(%rip),%rdx        # 1cfb <malloc+0x15e>
+     688:	48 89 d6             	mov    %rdx,%rsi
+     68b:	89 c7                	mov    %eax,%edi
+     68d:	b8 00 00 00 00       	mov    $0x0,%eax
+     692:	e8 0b 0d 00 00       	call   13a2 <printf>
+     697:	90                   	nop
+     698:	eb fd                	jmp    697 <sharetest+0x107>
+  if (pid == 0) {
+     69a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     69e:	0f 85 d1 00 00 00    	jne    775 <sharetest+0x1e5>
+    p = mapfile(PROT_READ);
+     6a4:	bf 01 00 00 00       	mov    $0x1,%edi
+     6a9:	e8 07 fd ff ff       	call   3b5 <mapfile>
+     6ae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    write(toparent[1], "m", 1);
+     6b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6b5:	ba 01 00 00 00       	mov    $0x1,%edx
+     6ba:	48 8d 0d ed 16 00 00 	lea    0x16ed(%rip),%rcx        # 1dae <malloc+0x211>
+     6c1:	48 89 ce             	mov    %rcx,%rsi
+     6c4:	89 c7                	mov    %eax,%edi
+     6c6:	e8 9e 12 00 00       	call   1969 <write>
+    read(tochild[0], &c, 1);
+     6cb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     6ce:	48 8d 4d df          	lea    -0x21(%rbp),%rcx
+     6d2:	ba 01 00 00 00       	mov    $0x1,%edx
+     6d7:	48 89 ce             	mov    %rcx,%rsi
+     6da:	89 c7                	mov    %eax,%edi
+     6dc:	e8 80 12 00 00       	call   1961 <read>
+    if (p[0] != 'X' || p[PGSIZE] != 'Y')
+     6e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6e5:	0f b6 00             	movzbl (%rax),%eax
+     6e8:	3c 58                	cmp    $0x58,%al
+     6ea:	75 11                	jne    6fd <sharetest+0x16d>
+     6ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6f0:	48 05 00 10 00 00    	add    $0x1000,%rax
+     6f6:	0f b6 00             	movzbl (%rax),%eax
+     6f9:	3c 59                	cmp    $0x59,%al
+     6fb:	74 73                	je     770 <sharetest+0x1e0>
+      error("mapping doesn't see write(): %d %d", p[0], p[PGSIZE]);
+     6fd:	8b 05 9d 1c 00 00    	mov    0x1c9d(%rip),%eax        # 23a0 <stdout>
+     703:	ba 6b 00 00 00       	mov    $0x6b,%edx
+     708:	48 8d 0d c7 15 00 00 	lea    0x15c7(%rip),%rcx        # 1cd6 <malloc+0x139>
+     70f:	48 89 ce             	mov    %rcx,%rsi
+     712:	89 c7                	mov    %eax,%edi
+     714:	b8 00 00 00 00       	mov    $0x0,%eax
+     719:	e8 84 0c 00 00       	call   13a2 <printf>
+     71e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     722:	48 05 00 10 00 00    	add    $0x1000,%rax
+     728:	0f b6 00             	movzbl (%rax),%eax
+     72b:	0f be c8             	movsbl %al,%ecx
+     72e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     732:	0f b6 00             	movzbl (%rax),%eax
+     735:	0f be d0             	movsbl %al,%edx
+     738:	8b 05 62 1c 00 00    	mov    0x1c62(%rip),%eax        # 23a0 <stdout>
+     73e:	48 8d 35 6b 16 00 00 	lea    0x166b(%rip),%rsi        # 1db0 <malloc+0x213>
+     745:	89 c7                	mov    %eax,%edi
+     747:	b8 00 00 00 00       	mov    $0x0,%eax
+     74c:	e8 51 0c 00 00       	call   13a2 <printf>
+     751:	8b 05 49 1c 00 00    	mov    0x1c49(%rip),%eax        # 23a0 <stdout>
+     757:	48 8d 15 9d 15 00 00 	lea    0x159d(%rip),%rdx        # 1cfb <malloc+0x15e>
+     75e:	48 89 d6             	mov    %rdx,%rsi
+     761:	89 c7                	mov    %eax,%edi
+     763:	b8 00 00 00 00       	mov    $0x0,%eax
+     768:	e8 35 0c 00 00       	call   13a2 <printf>
+     76d:	90                   	nop
+     76e:	eb fd                	jmp    76d <sharetest+0x1dd>
+    exit();
+     770:	e8 d4 11 00 00       	call   1949 <exit>
+  }
+
+  // wait for the child to map the file, then write it
+  read(toparent[0], &c, 1);
+     775:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     778:	48 8d 4d df          	lea    -0x21(%rbp),%rcx
+     77c:	ba 01 00 00 00       	mov    $0x1,%edx
+     781:	48 89 ce             	mov    %rcx,%rsi
+     784:	89 c7                	mov    %eax,%edi
+     786:	e8 d6 11 00 00       	call   1961 <read>
+  if ((fd = open(file_name, O_RDWR)) < 0)
+     78b:	48 8b 05 16 1c 00 00 	mov    0x1c16(%rip),%rax        # 23a8 <file_name>
+     792:	be 02 00 00 00       	mov    $0x2,%esi
+     797:	48 89 c7             	mov    %rax,%rdi
+     79a:	e8 ea 11 00 00       	call   1989 <open>
+     79f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     7a2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     7a6:	79 63                	jns    80b <sharetest+0x27b>
+    error("couldn't open %s", file_name);
+     7a8:	8b 05 f2 1b 00 00    	mov    0x1bf2(%rip),%eax        # 23a0 <stdout>
+     7ae:	ba 72 00 00 00       	mov    $0x72,%edx
+     7b3:	48 8d 0d 1c 15 00 00 	lea    0x151c(%rip),%rcx        # 1cd6 <malloc+0x139>
+     7ba:	48 89 ce             	mov    %rcx,%rsi
+     7bd:	89 c7                	mov    %eax,%edi
+     7bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c4:	e8 d9 0b 00 00       	call   13a2 <printf>
+     7c9:	48 8b 15 d8 1b 00 00 	mov    0x1bd8(%rip),%rdx        # 23a8 <file_name>
+     7d0:	8b 05 ca 1b 00 00    	mov    0x1bca(%rip),%eax        # 23a0 <stdout>
+     7d6:	48 8d 0d 32 15 00 00 	lea    0x1532(%rip),%rcx        # 1d0f <malloc+0x172>
+     7dd:	48 89 ce             	mov    %rcx,%rsi
+     7e0:	89 c7                	mov    %eax,%edi
+     7e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e7:	e8 b6 0b 00 00       	call   13a2 <printf>
+     7ec:	8b 05 ae 1b 00 00    	mov    0x1bae(%rip),%eax        # 23a0 <stdout>
+     7f2:	48 8d 15 02 15 00 00 	lea    0x1502(%rip),%rdx        # 1cfb <malloc+0x15e>
+     7f9:	48 89 d6             	mov    %rdx,%rsi
+     7fc:	89 c7                	mov    %eax,%edi
+     7fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     803:	e8 9a 0b 00 00       	call   13a2 <printf>
+     808:	90                   	nop
+     809:	eb fd                	jmp    808 <sharetest+0x278>
+  buf[0] = 'X';
+     80b:	c6 05 ee 1b 00 00 58 	movb   $0x58,0x1bee(%rip)        # 2400 <buf>
+  buf[PGSIZE] = 'Y';
+     812:	c6 05 e7 2b 00 00 59 	movb   $0x59,0x2be7(%rip)        # 3400 <buf+0x1000>
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+     819:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     81c:	ba 00 20 00 00       	mov    $0x2000,%edx
+     821:	48 8d 0d d8 1b 00 00 	lea    0x1bd8(%rip),%rcx        # 2400 <buf>
+     828:	48 89 ce             	mov    %rcx,%rsi
+     82b:	89 c7                	mov    %eax,%edi
+     82d:	e8 37 11 00 00       	call   1969 <write>
+     832:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     837:	74 63                	je     89c <sharetest+0x30c>
+    error("couldn't write %s", file_name);
+     839:	8b 05 61 1b 00 00    	mov    0x1b61(%rip),%eax        # 23a0 <stdout>
+     83f:	ba 76 00 00 00       	mov    $0x76,%edx
+     844:	48 8d 0d 8b 14 00 00 	lea    0x148b(%rip),%rcx        # 1cd6 <malloc+0x139>
+     84b:	48 89 ce             	mov    %rcx,%rsi
+     84e:	89 c7                	mov    %eax,%edi
+     850:	b8 00 00 00 00       	mov    $0x0,%eax
+     855:	e8 48 0b 00 00       	call   13a2 <printf>
+     85a:	48 8b 15 47 1b 00 00 	mov    0x1b47(%rip),%rdx        # 23a8 <file_name>
+     861:	8b 05 39 1b 00 00    	mov    0x1b39(%rip),%eax        # 23a0 <stdout>
+     867:	48 8d 0d 8f 14 00 00 	lea    0x148f(%rip),%rcx        # 1cfd <malloc+0x160>
+     86e:	48 89 ce             	mov    %rcx,%rsi
+     871:	89 c7                	mov    %eax,%edi
+     873:	b8 00 00 00 00       	mov    $0x0,%eax
+     878:	e8 25 0b 00 00       	call   13a2 <printf>
+     87d:	8b 05 1d 1b 00 00    	mov    0x1b1d(%rip),%eax        # 23a0 <stdout>
+     883:	48 8d 15 71 14 00 00 	lea    0x1471(%rip),%rdx        # 1cfb <malloc+0x15e>
+     88a:	48 89 d6             	mov    %rdx,%rsi
+     88d:	89 c7                	mov    %eax,%edi
+     88f:	b8 00 00 00 00       	mov    $0x0,%eax
+     894:	e8 09 0b 00 00       	call   13a2 <printf>
+     899:	90                   	nop
+     89a:	eb fd                	jmp    899 <sharetest+0x309>
+  close(fd);
+     89c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     89f:	89 c7                	mov    %eax,%edi
+     8a1:	e8 cb 10 00 00       	call   1971 <close>
+  write(tochild[1], "w", 1);
+     8a6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8a9:	ba 01 00 00 00       	mov    $0x1,%edx
+     8ae:	48 8d 0d 1e 15 00 00 	lea    0x151e(%rip),%rcx        # 1dd3 <malloc+0x236>
+     8b5:	48 89 ce             	mov    %rcx,%rsi
+     8b8:	89 c7                	mov    %eax,%edi
+     8ba:	e8 aa 10 00 00       	call   1969 <write>
+  wait();
+     8bf:	e8 8d 10 00 00       	call   1951 <wait>
+  close(toparent[0]);
+     8c4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8c7:	89 c7                	mov    %eax,%edi
+     8c9:	e8 a3 10 00 00       	call   1971 <close>
+  close(toparent[1]);
+     8ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8d1:	89 c7                	mov    %eax,%edi
+     8d3:	e8 99 10 00 00       	call   1971 <close>
+  close(tochild[0]);
+     8d8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     8db:	89 c7                	mov    %eax,%edi
+     8dd:	e8 8f 10 00 00       	call   1971 <close>
+  close(tochild[1]);
+     8e2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8e5:	89 c7                	mov    %eax,%edi
+     8e7:	e8 85 10 00 00       	call   1971 <close>
+
+  makefile();
+     8ec:	e8 a2 f7 ff ff       	call   93 <makefile>
+  printf(stdout, "sharetest passed\n");
+     8f1:	8b 05 a9 1a 00 00    	mov    0x1aa9(%rip),%eax        # 23a0 <stdout>
+     8f7:	48 8d 15 d7 14 00 00 	lea    0x14d7(%rip),%rdx        # 1dd5 <malloc+0x238>
+     8fe:	48 89 d6             	mov    %rdx,%rsi
+     901:	89 c7                	mov    %eax,%edi
+     903:	b8 00 00 00 00       	mov    $0x0,%eax
+     908:	e8 95 0a 00 00       	call   13a2 <printf>
+}
+     90d:	90                   	nop
+     90e:	c9                   	leave
+     90f:	c3                   	ret
+
+0000000000000910 <privatetest>:
+
+// Writes to a PROT_WRITE mapping are private to the process.
+void privatetest(void) {
+     910:	55                   	push   %rbp
+     911:	48 89 e5             	mov    %rsp,%rbp
+     914:	53                   	push   %rbx
+     915:	48 83 ec 18          	sub    $0x18,%rsp
+  char *p, *q;
+
+  printf(stdout, "privatetest\n");
+     919:	8b 05 81 1a 00 00    	mov    0x1a81(%rip),%eax        # 23a0 <stdout>
+     91f:	48 8d 15 c1 14 00 00 	lea    0x14c1(%rip),%rdx        # 1de7 <malloc+0x24a>
+     926:	48 89 d6             	mov    %rdx,%rsi
+     929:	89 c7                	mov    %eax,%edi
+     92b:	b8 00 00 00 00       	mov    $0x0,%eax
+     930:	e8 6d 0a 00 00       	call   13a2 <printf>
+  p = mapfile(PROT_READ | PROT_WRITE);
+     935:	bf 03 00 00 00       	mov    $0x3,%edi
+     93a:	e8 76 fa ff ff       	call   3b5 <mapfile>
+     93f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  q = mapfile(PROT_READ);
+     943:	bf 01 00 00 00       	mov    $0x1,%edi
+     948:	e8 68 fa ff ff       	call   3b5 <mapfile>
+     94d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  p[0] = 'P';
+     951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     955:	c6 00 50             	movb   $0x50,(%rax)
+  p[PGSIZE + 1] = 'Q';
+     958:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     95c:	48 05 01 10 00 00    	add    $0x1001,%rax
+     962:	c6 00 51             	movb   $0x51,(%rax)
+  if (p[0] != 'P' || p[PGSIZE + 1] != 'Q')
+     965:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     969:	0f b6 00             	movzbl (%rax),%eax
+     96c:	3c 50                	cmp    $0x50,%al
+     96e:	75 11                	jne    981 <privatetest+0x71>
+     970:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     974:	48 05 01 10 00 00    	add    $0x1001,%rax
+     97a:	0f b6 00             	movzbl (%rax),%eax
+     97d:	3c 51                	cmp    $0x51,%al
+     97f:	74 5c                	je     9dd <privatetest+0xcd>
+    error("writes to the mapping were lost");
+     981:	8b 05 19 1a 00 00    	mov    0x1a19(%rip),%eax        # 23a0 <stdout>
+     987:	ba 8d 00 00 00       	mov    $0x8d,%edx
+     98c:	48 8d 0d 43 13 00 00 	lea    0x1343(%rip),%rcx        # 1cd6 <malloc+0x139>
+     993:	48 89 ce             	mov    %rcx,%rsi
+     996:	89 c7                	mov    %eax,%edi
+     998:	b8 00 00 00 00       	mov    $0x0,%eax
+     99d:	e8 00 0a 00 00       	call   13a2 <printf>
+     9a2:	8b 05 f8 19 00 00    	mov    0x19f8(%rip),%eax        # 23a0 <stdout>
+     9a8:	48 8d 15 49 14 00 00 	lea    0x1449(%rip),%rdx        # 1df8 <malloc+0x25b>
+     9af:	48 89 d6             	mov    %rdx,%rsi
+     9b2:	89 c7                	mov    %eax,%edi
+     9b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b9:	e8 e4 09 00 00       	call   13a2 <printf>
+     9be:	8b 05 dc 19 00 00    	mov    0x19dc(%rip),%eax        # 23a0 <stdout>
+     9c4:	48 8d 15 30 13 00 00 	lea    0x1330(%rip),%rdx        # 1cfb <malloc+0x15e>
+     9cb:	48 89 d6             	mov    %rdx,%rsi
+     9ce:	89 c7                	mov    %eax,%edi
+     9d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d5:	e8 c8 09 00 00       	call   13a2 <printf>
+     9da:	90                   	nop
+     9db:	eb fd                	jmp    9da <privatetest+0xca>
+  if (q[0] != pattern(0) || q[PGSIZE + 1] != pattern(PGSIZE + 1))
+     9dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     9e1:	0f b6 18             	movzbl (%rax),%ebx
+     9e4:	bf 00 00 00 00       	mov    $0x0,%edi
+     9e9:	e8 60 f6 ff ff       	call   4e <pattern>
+     9ee:	38 c3                	cmp    %al,%bl
+     9f0:	75 1b                	jne    a0d <privatetest+0xfd>
+     9f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     9f6:	48 05 01 10 00 00    	add    $0x1001,%rax
+     9fc:	0f b6 18             	movzbl (%rax),%ebx
+     9ff:	bf 01 10 00 00       	mov    $0x1001,%edi
+     a04:	e8 45 f6 ff ff       	call   4e <pattern>
+     a09:	38 c3                	cmp    %al,%bl
+     a0b:	74 5c                	je     a69 <privatetest+0x159>
+    error("writes to a mapping reached another mapping");
+     a0d:	8b 05 8d 19 00 00    	mov    0x198d(%rip),%eax        # 23a0 <stdout>
+     a13:	ba 8f 00 00 00       	mov    $0x8f,%edx
+     a18:	48 8d 0d b7 12 00 00 	lea    0x12b7(%rip),%rcx        # 1cd6 <malloc+0x139>
+     a1f:	48 89 ce             	mov    %rcx,%rsi
+     a22:	89 c7                	mov    %eax,%edi
+     a24:	b8 00 00 00 00       	mov    $0x0,%eax
+     a29:	e8 74 09 00 00       	call   13a2 <printf>
+     a2e:	8b 05 6c 19 00 00    	mov    0x196c(%rip),%eax        # 23a0 <stdout>
+     a34:	48 8d 15 dd 13 00 00 	lea    0x13dd(%rip),%rdx        # 1e18 <malloc+0x27b>
+     a3b:	48 89 d6             	mov    %rdx,%rsi
+     a3e:	89 c7                	mov    %eax,%edi
+     a40:	b8 00 00 00 00       	mov    $0x0,%eax
+     a45:	e8 58 09 00 00       	call   13a2 <printf>
+     a4a:	8b 05 50 19 00 00    	mov    0x1950(%rip),%eax        # 23a0 <stdout>
+     a50:	48 8d 15 a4 12 00 00 	lea    0x12a4(%rip),%rdx        # 1cfb <malloc+0x15e>
+     a57:	48 89 d6             	mov    %rdx,%rsi
+     a5a:	89 c7                	mov    %eax,%edi
+     a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+     a61:	e8 3c 09 00 00       	call   13a2 <printf>
+     a66:	90                   	nop
+     a67:	eb fd                	jmp    a66 <privatetest+0x156>
+  if (munmap(p) < 0 || munmap(q) < 0)
+     a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a6d:	48 89 c7             	mov    %rax,%rdi
+     a70:	e8 8c 0f 00 00       	call   1a01 <munmap>
+     a75:	85 c0                	test   %eax,%eax
+     a77:	78 10                	js     a89 <privatetest+0x179>
+     a79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     a7d:	48 89 c7             	mov    %rax,%rdi
+     a80:	e8 7c 0f 00 00       	call   1a01 <munmap>
+     a85:	85 c0                	test   %eax,%eax
+     a87:	79 5c                	jns    ae5 <privatetest+0x1d5>
+    error("munmap failed");
+     a89:	8b 05 11 19 00 00    	mov    0x1911(%rip),%eax        # 23a0 <stdout>
+     a8f:	ba 91 00 00 00       	mov    $0x91,%edx
+     a94:	48 8d 0d 3b 12 00 00 	lea    0x123b(%rip),%rcx        # 1cd6 <malloc+0x139>
+     a9b:	48 89 ce             	mov    %rcx,%rsi
+     a9e:	89 c7                	mov    %eax,%edi
+     aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa5:	e8 f8 08 00 00       	call   13a2 <printf>
+     aaa:	8b 05 f0 18 00 00    	mov    0x18f0(%rip),%eax        # 23a0 <stdout>
+     ab0:	48 8d 15 8d 13 00 00 	lea    0x138d(%rip),%rdx        # 1e44 <malloc+0x2a7>
+     ab7:	48 89 d6             	mov    %rdx,%rsi
+     aba:	89 c7                	mov    %eax,%edi
+     abc:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac1:	e8 dc 08 00 00       	call   13a2 <printf>
+     ac6:	8b 05 d4 18 00 00    	mov    0x18d4(%rip),%eax        # 23a0 <stdout>
+     acc:	48 8d 15 28 12 00 00 	lea    0x1228(%rip),%rdx        # 1cfb <malloc+0x15e>
+     ad3:	48 89 d6             	mov    %rdx,%rsi
+     ad6:	89 c7                	mov    %eax,%edi
+     ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+     add:	e8 c0 08 00 00       	call   13a2 <printf>
+     ae2:	90                   	nop
+     ae3:	eb fd                	jmp    ae2 <privatetest+0x1d2>
+  checkfile();
+     ae5:	e8 f2 f6 ff ff       	call   1dc <checkfile>
+  printf(stdout, "privatetest passed\n");
+     aea:	8b 05 b0 18 00 00    	mov    0x18b0(%rip),%eax        # 23a0 <stdout>
+     af0:	48 8d 15 5b 13 00 00 	lea    0x135b(%rip),%rdx        # 1e52 <malloc+0x2b5>
+     af7:	48 89 d6             	mov    %rdx,%rsi
+     afa:	89 c7                	mov    %eax,%edi
+     afc:	b8 00 00 00 00       	mov    $0x0,%eax
+     b01:	e8 9c 08 00 00       	call   13a2 <printf>
+}
+     b06:	90                   	nop
+     b07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b0b:	c9                   	leave
+     b0c:	c3                   	ret
+
+0000000000000b0d <forktest>:
+
+// A child keeps its parent's mappings, and its writes stay its own.
+void forktest(void) {
+     b0d:	55                   	push   %rbp
+     b0e:	48 89 e5             	mov    %rsp,%rbp
+     b11:	53                   	push   %rbx
+     b12:	48 83 ec 28          	sub    $0x28,%rsp
+  char *p;
+  int i, pid;
+
+  printf(stdout, "forktest\n");
+     b16:	8b 05 84 18 00 00    	mov    0x1884(%rip),%eax        # 23a0 <stdout>
+     b1c:	48 8d 15 43 13 00 00 	lea    0x1343(%rip),%rdx        # 1e66 <malloc+0x2c9>
+     b23:	48 89 d6             	mov    %rdx,%rsi
+     b26:	89 c7                	mov    %eax,%edi
+     b28:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2d:	e8 70 08 00 00       	call   13a2 <printf>
+  p = mapfile(PROT_READ | PROT_WRITE);
+     b32:	bf 03 00 00 00       	mov    $0x3,%edi
+     b37:	e8 79 f8 ff ff       	call   3b5 <mapfile>
+     b3c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  p[0] = 'F';
+     b40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     b44:	c6 00 46             	movb   $0x46,(%rax)
+  if ((pid = fork()) < 0)
+     b47:	e8 f5 0d 00 00       	call   1941 <fork>
+     b4c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+     b4f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     b53:	79 5c                	jns    bb1 <forktest+0xa4>
+    error("fork failed");
+     b55:	8b 05 45 18 00 00    	mov    0x1845(%rip),%eax        # 23a0 <stdout>
+     b5b:	ba 9f 00 00 00       	mov    $0x9f,%edx
+     b60:	48 8d 0d 6f 11 00 00 	lea    0x116f(%rip),%rcx        # 1cd6 <malloc+0x139>
+     b67:	48 89 ce             	mov    %rcx,%rsi
+     b6a:	89 c7                	mov    %eax,%edi
+     b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b71:	e8 2c 08 00 00       	call   13a2 <printf>
+     b76:	8b 05 24 18 00 00    	mov    0x1824(%rip),%eax        # 23a0 <stdout>
+     b7c:	48 8d 15 1f 12 00 00 	lea    0x121f(%rip),%rdx        # 1da2 <malloc+0x205>
+     b83:	48 89 d6             	mov    %rdx,%rsi
+     b86:	89 c7                	mov    %eax,%edi
+     b88:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8d:	e8 10 08 00 00       	call   13a2 <printf>
+     b92:	8b 05 08 18 00 00    	mov    0x1808(%rip),%eax        # 23a0 <stdout>
+     b98:	48 8d 15 5c 11 00 00 	lea    0x115c(%rip),%rdx        # 1cfb <malloc+0x15e>
+     b9f:	48 89 d6             	mov    %rdx,%rsi
+     ba2:	89 c7                	mov    %eax,%edi
+     ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ba9:	e8 f4 07 00 00       	call   13a2 <printf>
+     bae:	90                   	nop
+     baf:	eb fd                	jmp    bae <forktest+0xa1>
+  if (pid == 0) {
+     bb1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     bb5:	0f 85 32 01 00 00    	jne    ced <forktest+0x1e0>
+    if (p[0] != 'F')
+     bbb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     bbf:	0f b6 00             	movzbl (%rax),%eax
+     bc2:	3c 46                	cmp    $0x46,%al
+     bc4:	74 5c                	je     c22 <forktest+0x115>
+      error("child doesn't see the parent's write");
+     bc6:	8b 05 d4 17 00 00    	mov    0x17d4(%rip),%eax        # 23a0 <stdout>
+     bcc:	ba a2 00 00 00       	mov    $0xa2,%edx
+     bd1:	48 8d 0d fe 10 00 00 	lea    0x10fe(%rip),%rcx        # 1cd6 <malloc+0x139>
+     bd8:	48 89 ce             	mov    %rcx,%rsi
+     bdb:	89 c7                	mov    %eax,%edi
+     bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+     be2:	e8 bb 07 00 00       	call   13a2 <printf>
+     be7:	8b 05 b3 17 00 00    	mov    0x17b3(%rip),%eax        # 23a0 <stdout>
+     bed:	48 8d 15 7c 12 00 00 	lea    0x127c(%rip),%rdx        # 1e70 <malloc+0x2d3>
+     bf4:	48 89 d6             	mov    %rdx,%rsi
+     bf7:	89 c7                	mov    %eax,%edi
+     bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+     bfe:	e8 9f 07 00 00       	call   13a2 <printf>
+     c03:	8b 05 97 17 00 00    	mov    0x1797(%rip),%eax        # 23a0 <stdout>
+     c09:	48 8d 15 eb 10 00 00 	lea    0x10eb(%rip),%rdx        # 1cfb <malloc+0x15e>
+     c10:	48 89 d6             	mov    %rdx,%rsi
+     c13:	89 c7                	mov    %eax,%edi
+     c15:	b8 00 00 00 00       	mov    $0x0,%eax
+     c1a:	e8 83 07 00 00       	call   13a2 <printf>
+     c1f:	90                   	nop
+     c20:	eb fd                	jmp    c1f <forktest+0x112>
+    for (i = 1; i < sizeof(buf); i++)
+     c22:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+     c29:	e9 a1 00 00 00       	jmp    ccf <forktest+0x1c2>
+      if (p[i] != pattern(i))
+     c2e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c31:	48 63 d0             	movslq %eax,%rdx
+     c34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     c38:	48 01 d0             	add    %rdx,%rax
+     c3b:	0f b6 18             	movzbl (%rax),%ebx
+     c3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c41:	89 c7                	mov    %eax,%edi
+     c43:	e8 06 f4 ff ff       	call   4e <pattern>
+     c48:	38 c3                	cmp    %al,%bl
+     c4a:	74 7f                	je     ccb <forktest+0x1be>
+        error("child mapped byte %d is %d, should be %d", i, p[i], pattern(i));
+     c4c:	8b 05 4e 17 00 00    	mov    0x174e(%rip),%eax        # 23a0 <stdout>
+     c52:	ba a5 00 00 00       	mov    $0xa5,%edx
+     c57:	48 8d 0d 78 10 00 00 	lea    0x1078(%rip),%rcx        # 1cd6 <malloc+0x139>
+     c5e:	48 89 ce             	mov    %rcx,%rsi
+     c61:	89 c7                	mov    %eax,%edi
+     c63:	b8 00 00 00 00       	mov    $0x0,%eax
+     c68:	e8 35 07 00 00       	call   13a2 <printf>
+     c6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c70:	89 c7                	mov    %eax,%edi
+     c72:	e8 d7 f3 ff ff       	call   4e <pattern>
+     c77:	0f be f0             	movsbl %al,%esi
+     c7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c7d:	48 63 d0             	movslq %eax,%rdx
+     c80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     c84:	48 01 d0             	add    %rdx,%rax
+     c87:	0f b6 00             	movzbl (%rax),%eax
+     c8a:	0f be c8             	movsbl %al,%ecx
+     c8d:	8b 05 0d 17 00 00    	mov    0x170d(%rip),%eax        # 23a0 <stdout>
+     c93:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c96:	41 89 f0             	mov    %esi,%r8d
+     c99:	48 8d 35 f8 11 00 00 	lea    0x11f8(%rip),%rsi        # 1e98 <malloc+0x2fb>
+     ca0:	89 c7                	mov    %eax,%edi
+     ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca7:	e8 f6 06 00 00       	call   13a2 <printf>
+     cac:	8b 05 ee 16 00 00    	mov    0x16ee(%rip),%eax        # 23a0 <stdout>
+     cb2:	48 8d 15 42 10 00 00 	lea    0x1042(%rip),%rdx        # 1cfb <malloc+0x15e>
+     cb9:	48 89 d6             	mov    %rdx,%rsi
+     cbc:	89 c7                	mov    %eax,%edi
+     cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc3:	e8 da 06 00 00       	call   13a2 <printf>
+     cc8:	90                   	nop
+     cc9:	eb fd                	jmp    cc8 <forktest+0x1bb>
+    for (i = 1; i < sizeof(buf); i++)
+     ccb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     ccf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     cd2:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+     cd7:	0f 86 51 ff ff ff    	jbe    c2e <forktest+0x121>
+    p[1] = 'C';
+     cdd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     ce1:	48 83 c0 01          	add    $0x1,%rax
+     ce5:	c6 00 43             	movb   $0x43,(%rax)
+    exit();
+     ce8:	e8 5c 0c 00 00       	call   1949 <exit>
+  }
+  wait();
+     ced:	e8 5f 0c 00 00       	call   1951 <wait>
+  if (p[1] != pattern(1))
+     cf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     cf6:	48 83 c0 01          	add    $0x1,%rax
+     cfa:	0f b6 18             	movzbl (%rax),%ebx
+     cfd:	bf 01 00 00 00       	mov    $0x1,%edi
+     d02:	e8 47 f3 ff ff       	call   4e <pattern>
+     d07:	38 c3                	cmp    %al,%bl
+     d09:	74 5c                	je     d67 <forktest+0x25a>
+    error("child's write reached the parent");
+     d0b:	8b 05 8f 16 00 00    	mov    0x168f(%rip),%eax        # 23a0 <stdout>
+     d11:	ba ab 00 00 00       	mov    $0xab,%edx
+     d16:	48 8d 0d b9 0f 00 00 	lea    0xfb9(%rip),%rcx        # 1cd6 <malloc+0x139>
+     d1d:	48 89 ce             	mov    %rcx,%rsi
+     d20:	89 c7                	mov    %eax,%edi
+     d22:	b8 00 00 00 00       	mov    $0x0,%eax
+     d27:	e8 76 06 00 00       	call   13a2 <printf>
+     d2c:	8b 05 6e 16 00 00    	mov    0x166e(%rip),%eax        # 23a0 <stdout>
+     d32:	48 8d 15 8f 11 00 00 	lea    0x118f(%rip),%rdx        # 1ec8 <malloc+0x32b>
+     d39:	48 89 d6             	mov    %rdx,%rsi
+     d3c:	89 c7                	mov    %eax,%edi
+     d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     d43:	e8 5a 06 00 00       	call   13a2 <printf>
+     d48:	8b 05 52 16 00 00    	mov    0x1652(%rip),%eax        # 23a0 <stdout>
+     d4e:	48 8d 15 a6 0f 00 00 	lea    0xfa6(%rip),%rdx        # 1cfb <malloc+0x15e>
+     d55:	48 89 d6             	mov    %rdx,%rsi
+     d58:	89 c7                	mov    %eax,%edi
+     d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d5f:	e8 3e 06 00 00       	call   13a2 <printf>
+     d64:	90                   	nop
+     d65:	eb fd                	jmp    d64 <forktest+0x257>
+  if (munmap(p) < 0)
+     d67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     d6b:	48 89 c7             	mov    %rax,%rdi
+     d6e:	e8 8e 0c 00 00       	call   1a01 <munmap>
+     d73:	85 c0                	test   %eax,%eax
+     d75:	79 5c                	jns    dd3 <forktest+0x2c6>
+    error("munmap failed");
+     d77:	8b 05 23 16 00 00    	mov    0x1623(%rip),%eax        # 23a0 <stdout>
+     d7d:	ba ad 00 00 00       	mov    $0xad,%edx
+     d82:	48 8d 0d 4d 0f 00 00 	lea    0xf4d(%rip),%rcx        # 1cd6 <malloc+0x139>
+     d89:	48 89 ce             	mov    %rcx,%rsi
+     d8c:	89 c7                	mov    %eax,%edi
+     d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+     d93:	e8 0a 06 00 00       	call   13a2 <printf>
+     d98:	8b 05 02 16 00 00    	mov    0x1602(%rip),%eax        # 23a0 <stdout>
+     d9e:	48 8d 15 9f 10 00 00 	lea    0x109f(%rip),%rdx        # 1e44 <malloc+0x2a7>
+     da5:	48 89 d6             	mov    %rdx,%rsi
+     da8:	89 c7                	mov    %eax,%edi
+     daa:	b8 00 00 00 00       	mov    $0x0,%eax
+     daf:	e8 ee 05 00 00       	call   13a2 <printf>
+     db4:	8b 05 e6 15 00 00    	mov    0x15e6(%rip),%eax        # 23a0 <stdout>
+     dba:	48 8d 15 3a 0f 00 00 	lea    0xf3a(%rip),%rdx        # 1cfb <malloc+0x15e>
+     dc1:	48 89 d6             	mov    %rdx,%rsi
+     dc4:	89 c7                	mov    %eax,%edi
+     dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+     dcb:	e8 d2 05 00 00       	call   13a2 <printf>
+     dd0:	90                   	nop
+     dd1:	eb fd                	jmp    dd0 <forktest+0x2c3>
+  checkfile();
+     dd3:	e8 04 f4 ff ff       	call   1dc <checkfile>
+  printf(stdout, "forktest passed\n");
+     dd8:	8b 05 c2 15 00 00    	mov    0x15c2(%rip),%eax        # 23a0 <stdout>
+     dde:	48 8d 15 04 11 00 00 	lea    0x1104(%rip),%rdx        # 1ee9 <malloc+0x34c>
+     de5:	48 89 d6             	mov    %rdx,%rsi
+     de8:	89 c7                	mov    %eax,%edi
+     dea:	b8 00 00 00 00       	mov    $0x0,%eax
+     def:	e8 ae 05 00 00       	call   13a2 <printf>
+}
+     df4:	90                   	nop
+     df5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     df9:	c9                   	leave
+     dfa:	c3                   	ret
+
+0000000000000dfb <munmaptest>:
+
+// munmap drops the mapping: touching it afterwards faults.
+void munmaptest(void) {
+     dfb:	55                   	push   %rbp
+     dfc:	48 89 e5             	mov    %rsp,%rbp
+     dff:	48 83 ec 10          	sub    $0x10,%rsp
+  char *p;
+  int pid;
+
+  printf(stdout, "munmaptest\n");
+     e03:	8b 05 97 15 00 00    	mov    0x1597(%rip),%eax        # 23a0 <stdout>
+     e09:	48 8d 15 ea 10 00 00 	lea    0x10ea(%rip),%rdx        # 1efa <malloc+0x35d>
+     e10:	48 89 d6             	mov    %rdx,%rsi
+     e13:	89 c7                	mov    %eax,%edi
+     e15:	b8 00 00 00 00       	mov    $0x0,%eax
+     e1a:	e8 83 05 00 00       	call   13a2 <printf>
+  p = mapfile(PROT_READ);
+     e1f:	bf 01 00 00 00       	mov    $0x1,%edi
+     e24:	e8 8c f5 ff ff       	call   3b5 <mapfile>
+     e29:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (munmap(p) < 0)
+     e2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e31:	48 89 c7             	mov    %rax,%rdi
+     e34:	e8 c8 0b 00 00       	call   1a01 <munmap>
+     e39:	85 c0                	test   %eax,%eax
+     e3b:	79 5c                	jns    e99 <munmaptest+0x9e>
+    error("munmap failed");
+     e3d:	8b 05 5d 15 00 00    	mov    0x155d(%rip),%eax        # 23a0 <stdout>
+     e43:	ba ba 00 00 00       	mov    $0xba,%edx
+     e48:	48 8d 0d 87 0e 00 00 	lea    0xe87(%rip),%rcx        # 1cd6 <malloc+0x139>
+     e4f:	48 89 ce             	mov    %rcx,%rsi
+     e52:	89 c7                	mov    %eax,%edi
+     e54:	b8 00 00 00 00       	mov    $0x0,%eax
+     e59:	e8 44 05 00 00       	call   13a2 <printf>
+     e5e:	8b 05 3c 15 00 00    	mov    0x153c(%rip),%eax        # 23a0 <stdout>
+     e64:	48 8d 15 d9 0f 00 00 	lea    0xfd9(%rip),%rdx        # 1e44 <malloc+0x2a7>
+     e6b:	48 89 d6             	mov    %rdx,%rsi
+     e6e:	89 c7                	mov    %eax,%edi
+     e70:	b8 00 00 00 00       	mov    $0x0,%eax
+     e75:	e8 28 05 00 00       	call   13a2 <printf>
+     e7a:	8b 05 20 15 00 00    	mov    0x1520(%rip),%eax        # 23a0 <stdout>
+     e80:	48 8d 15 74 0e 00 00 	lea    0xe74(%rip),%rdx        # 1cfb <malloc+0x15e>
+     e87:	48 89 d6             	mov    %rdx,%rsi
+     e8a:	89 c7                	mov    %eax,%edi
+     e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     e91:	e8 0c 05 00 00       	call   13a2 <printf>
+     e96:	90                   	nop
+     e97:	eb fd                	jmp    e96 <munmaptest+0x9b>
+  if (munmap(p) != -1)
+     e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e9d:	48 89 c7             	mov    %rax,%rdi
+     ea0:	e8 5c 0b 00 00       	call   1a01 <munmap>
+     ea5:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ea8:	74 5c                	je     f06 <munmaptest+0x10b>
+    error("munmap of an unmapped address succeeded");
+     eaa:	8b 05 f0 14 00 00    	mov    0x14f0(%rip),%eax        # 23a0 <stdout>
+     eb0:	ba bc 00 00 00       	mov    $0xbc,%edx
+     eb5:	48 8d 0d 1a 0e 00 00 	lea    0xe1a(%rip),%rcx        # 1cd6 <malloc+0x139>
+     ebc:	48 89 ce             	mov    %rcx,%rsi
+     ebf:	89 c7                	mov    %eax,%edi
+     ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec6:	e8 d7 04 00 00       	call   13a2 <printf>
+     ecb:	8b 05 cf 14 00 00    	mov    0x14cf(%rip),%eax        # 23a0 <stdout>
+     ed1:	48 8d 15 30 10 00 00 	lea    0x1030(%rip),%rdx        # 1f08 <malloc+0x36b>
+     ed8:	48 89 d6             	mov    %rdx,%rsi
+     edb:	89 c7                	mov    %eax,%edi
+     edd:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee2:	e8 bb 04 00 00       	call   13a2 <printf>
+     ee7:	8b 05 b3 14 00 00    	mov    0x14b3(%rip),%eax        # 23a0 <stdout>
+     eed:	48 8d 15 07 0e 00 00 	lea    0xe07(%rip),%rdx        # 1cfb <malloc+0x15e>
+     ef4:	48 89 d6             	mov    %rdx,%rsi
+     ef7:	89 c7                	mov    %eax,%edi
+     ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+     efe:	e8 9f 04 00 00       	call   13a2 <printf>
+     f03:	90                   	nop
+     f04:	eb fd                	jmp    f03 <munmaptest+0x108>
+
+  printf(stdout, "next process should be killed with trap 14 err 4\n");
+     f06:	8b 05 94 14 00 00    	mov    0x1494(%rip),%eax        # 23a0 <stdout>
+     f0c:	48 8d 15 1d 10 00 00 	lea    0x101d(%rip),%rdx        # 1f30 <malloc+0x393>
+     f13:	48 89 d6             	mov    %rdx,%rsi
+     f16:	89 c7                	mov    %eax,%edi
+     f18:	b8 00 00 00 00       	mov    $0x0,%eax
+     f1d:	e8 80 04 00 00       	call   13a2 <printf>
+  if ((pid = fork()) < 0)
+     f22:	e8 1a 0a 00 00       	call   1941 <fork>
+     f27:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     f2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     f2e:	79 5c                	jns    f8c <munmaptest+0x191>
+    error("fork failed");
+     f30:	8b 05 6a 14 00 00    	mov    0x146a(%rip),%eax        # 23a0 <stdout>
+     f36:	ba c0 00 00 00       	mov    $0xc0,%edx
+     f3b:	48 8d 0d 94 0d 00 00 	lea    0xd94(%rip),%rcx        # 1cd6 <malloc+0x139>
+     f42:	48 89 ce             	mov    %rcx,%rsi
+     f45:	89 c7                	mov    %eax,%edi
+     f47:	b8 00 00 00 00       	mov    $0x0,%eax
+     f4c:	e8 51 04 00 00       	call   13a2 <printf>
+     f51:	8b 05 49 14 00 00    	mov    0x1449(%rip),%eax        # 23a0 <stdout>
+     f57:	48 8d 15 44 0e 00 00 	lea    0xe44(%rip),%rdx        # 1da2 <malloc+0x205>
+     f5e:	48 89 d6             	mov    %rdx,%rsi
+     f61:	89 c7                	mov    %eax,%edi
+     f63:	b8 00 00 00 00       	mov    $0x0,%eax
+     f68:	e8 35 04 00 00       	call   13a2 <printf>
+     f6d:	8b 05 2d 14 00 00    	mov    0x142d(%rip),%eax        # 23a0 <stdout>
+     f73:	48 8d 15 81 0d 00 00 	lea    0xd81(%rip),%rdx        # 1cfb <malloc+0x15e>
+     f7a:	48 89 d6             	mov    %rdx,%rsi
+     f7d:	89 c7                	mov    %eax,%edi
+     f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f84:	e8 19 04 00 00       	call   13a2 <printf>
+     f89:	90                   	nop
+     f8a:	eb fd                	jmp    f89 <munmaptest+0x18e>
+  if (pid == 0) {
+     f8c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     f90:	0f 85 83 00 00 00    	jne    1019 <munmaptest+0x21e>
+    printf(stdout, "oops could read %x = %x\n", p, *p);
+     f96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f9a:	0f b6 00             	movzbl (%rax),%eax
+     f9d:	0f be c8             	movsbl %al,%ecx
+     fa0:	8b 05 fa 13 00 00    	mov    0x13fa(%rip),%eax        # 23a0 <stdout>
+     fa6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     faa:	48 8d 35 b1 0f 00 00 	lea    0xfb1(%rip),%rsi        # 1f62 <malloc+0x3c5>
+     fb1:	89 c7                	mov    %eax,%edi
+     fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+     fb8:	e8 e5 03 00 00       	call   13a2 <printf>
+    error("unmapped page is still readable");
+     fbd:	8b 05 dd 13 00 00    	mov    0x13dd(%rip),%eax        # 23a0 <stdout>
+     fc3:	ba c3 00 00 00       	mov    $0xc3,%edx
+     fc8:	48 8d 0d 07 0d 00 00 	lea    0xd07(%rip),%rcx        # 1cd6 <malloc+0x139>
+     fcf:	48 89 ce             	mov    %rcx,%rsi
+     fd2:	89 c7                	mov    %eax,%edi
+     fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd9:	e8 c4 03 00 00       	call   13a2 <printf>
+     fde:	8b 05 bc 13 00 00    	mov    0x13bc(%rip),%eax        # 23a0 <stdout>
+     fe4:	48 8d 15 95 0f 00 00 	lea    0xf95(%rip),%rdx        # 1f80 <malloc+0x3e3>
+     feb:	48 89 d6             	mov    %rdx,%rsi
+     fee:	89 c7                	mov    %eax,%edi
+     ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff5:	e8 a8 03 00 00       	call   13a2 <printf>
+     ffa:	8b 05 a0 13 00 00    	mov    0x13a0(%rip),%eax        # 23a0 <stdout>
+    1000:	48 8d 15 f4 0c 00 00 	lea    0xcf4(%rip),%rdx        # 1cfb <malloc+0x15e>
+    1007:	48 89 d6             	mov    %rdx,%rsi
+    100a:	89 c7                	mov    %eax,%edi
+    100c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1011:	e8 8c 03 00 00       	call   13a2 <printf>
+    1016:	90                   	nop
+    1017:	eb fd                	jmp    1016 <munmaptest+0x21b>
+  }
+  wait();
+    1019:	e8 33 09 00 00       	call   1951 <wait>
+  printf(stdout, "munmaptest passed\n");
+    101e:	8b 05 7c 13 00 00    	mov    0x137c(%rip),%eax        # 23a0 <stdout>
+    1024:	48 8d 15 75 0f 00 00 	lea    0xf75(%rip),%rdx        # 1fa0 <malloc+0x403>
+    102b:	48 89 d6             	mov    %rdx,%rsi
+    102e:	89 c7                	mov    %eax,%edi
+    1030:	b8 00 00 00 00       	mov    $0x0,%eax
+    1035:	e8 68 03 00 00       	call   13a2 <printf>
+}
+    103a:	90                   	nop
+    103b:	c9                   	leave
+    103c:	c3                   	ret
+
+000000000000103d <unlinktest>:
+
+// A mapped file can't be unlinked until it is unmapped.
+void unlinktest(void) {
+    103d:	55                   	push   %rbp
+    103e:	48 89 e5             	mov    %rsp,%rbp
+    1041:	48 83 ec 10          	sub    $0x10,%rsp
+  char *p;
+
+  printf(stdout, "unlinktest\n");
+    1045:	8b 05 55 13 00 00    	mov    0x1355(%rip),%eax        # 23a0 <stdout>
+    104b:	48 8d 15 61 0f 00 00 	lea    0xf61(%rip),%rdx        # 1fb3 <malloc+0x416>
+    1052:	48 89 d6             	mov    %rdx,%rsi
+    1055:	89 c7                	mov    %eax,%edi
+    1057:	b8 00 00 00 00       	mov    $0x0,%eax
+    105c:	e8 41 03 00 00       	call   13a2 <printf>
+  p = mapfile(PROT_READ);
+    1061:	bf 01 00 00 00       	mov    $0x1,%edi
+    1066:	e8 4a f3 ff ff       	call   3b5 <mapfile>
+    106b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (unlink(file_name) != -1)
+    106f:	48 8b 05 32 13 00 00 	mov    0x1332(%rip),%rax        # 23a8 <file_name>
+    1076:	48 89 c7             	mov    %rax,%rdi
+    1079:	e8 1b 09 00 00       	call   1999 <unlink>
+    107e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1081:	74 5c                	je     10df <unlinktest+0xa2>
+    error("unlinked a mapped file");
+    1083:	8b 05 17 13 00 00    	mov    0x1317(%rip),%eax        # 23a0 <stdout>
+    1089:	ba d0 00 00 00       	mov    $0xd0,%edx
+    108e:	48 8d 0d 41 0c 00 00 	lea    0xc41(%rip),%rcx        # 1cd6 <malloc+0x139>
+    1095:	48 89 ce             	mov    %rcx,%rsi
+    1098:	89 c7                	mov    %eax,%edi
+    109a:	b8 00 00 00 00       	mov    $0x0,%eax
+    109f:	e8 fe 02 00 00       	call   13a2 <printf>
+    10a4:	8b 05 f6 12 00 00    	mov    0x12f6(%rip),%eax        # 23a0 <stdout>
+    10aa:	48 8d 15 0e 0f 00 00 	lea    0xf0e(%rip),%rdx        # 1fbf <malloc+0x422>
+    10b1:	48 89 d6             	mov    %rdx,%rsi
+    10b4:	89 c7                	mov    %eax,%edi
+    10b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bb:	e8 e2 02 00 00       	call   13a2 <printf>
+    10c0:	8b 05 da 12 00 00    	mov    0x12da(%rip),%eax        # 23a0 <stdout>
+    10c6:	48 8d 15 2e 0c 00 00 	lea    0xc2e(%rip),%rdx        # 1cfb <malloc+0x15e>
+    10cd:	48 89 d6             	mov    %rdx,%rsi
+    10d0:	89 c7                	mov    %eax,%edi
+    10d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d7:	e8 c6 02 00 00       	call   13a2 <printf>
+    10dc:	90                   	nop
+    10dd:	eb fd                	jmp    10dc <unlinktest+0x9f>
+  if (munmap(p) < 0)
+    10df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10e3:	48 89 c7             	mov    %rax,%rdi
+    10e6:	e8 16 09 00 00       	call   1a01 <munmap>
+    10eb:	85 c0                	test   %eax,%eax
+    10ed:	79 5c                	jns    114b <unlinktest+0x10e>
+    error("munmap failed");
+    10ef:	8b 05 ab 12 00 00    	mov    0x12ab(%rip),%eax        # 23a0 <stdout>
+    10f5:	ba d2 00 00 00       	mov    $0xd2,%edx
+    10fa:	48 8d 0d d5 0b 00 00 	lea    0xbd5(%rip),%rcx        # 1cd6 <malloc+0x139>
+    1101:	48 89 ce             	mov    %rcx,%rsi
+    1104:	89 c7                	mov    %eax,%edi
+    1106:	b8 00 00 00 00       	mov    $0x0,%eax
+    110b:	e8 92 02 00 00       	call   13a2 <printf>
+    1110:	8b 05 8a 12 00 00    	mov    0x128a(%rip),%eax        # 23a0 <stdout>
+    1116:	48 8d 15 27 0d 00 00 	lea    0xd27(%rip),%rdx        # 1e44 <malloc+0x2a7>
+    111d:	48 89 d6             	mov    %rdx,%rsi
+    1120:	89 c7                	mov    %eax,%edi
+    1122:	b8 00 00 00 00       	mov    $0x0,%eax
+    1127:	e8 76 02 00 00       	call   13a2 <printf>
+    112c:	8b 05 6e 12 00 00    	mov    0x126e(%rip),%eax        # 23a0 <stdout>
+    1132:	48 8d 15 c2 0b 00 00 	lea    0xbc2(%rip),%rdx        # 1cfb <malloc+0x15e>
+    1139:	48 89 d6             	mov    %rdx,%rsi
+    113c:	89 c7                	mov    %eax,%edi
+    113e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1143:	e8 5a 02 00 00       	call   13a2 <printf>
+    1148:	90                   	nop
+    1149:	eb fd                	jmp    1148 <unlinktest+0x10b>
+  if (unlink(file_name) < 0)
+    114b:	48 8b 05 56 12 00 00 	mov    0x1256(%rip),%rax        # 23a8 <file_name>
+    1152:	48 89 c7             	mov    %rax,%rdi
+    1155:	e8 3f 08 00 00       	call   1999 <unlink>
+    115a:	85 c0                	test   %eax,%eax
+    115c:	79 63                	jns    11c1 <unlinktest+0x184>
+    error("couldn't unlink %s after munmap", file_name);
+    115e:	8b 05 3c 12 00 00    	mov    0x123c(%rip),%eax        # 23a0 <stdout>
+    1164:	ba d4 00 00 00       	mov    $0xd4,%edx
+    1169:	48 8d 0d 66 0b 00 00 	lea    0xb66(%rip),%rcx        # 1cd6 <malloc+0x139>
+    1170:	48 89 ce             	mov    %rcx,%rsi
+    1173:	89 c7                	mov    %eax,%edi
+    1175:	b8 00 00 00 00       	mov    $0x0,%eax
+    117a:	e8 23 02 00 00       	call   13a2 <printf>
+    117f:	48 8b 15 22 12 00 00 	mov    0x1222(%rip),%rdx        # 23a8 <file_name>
+    1186:	8b 05 14 12 00 00    	mov    0x1214(%rip),%eax        # 23a0 <stdout>
+    118c:	48 8d 0d 45 0e 00 00 	lea    0xe45(%rip),%rcx        # 1fd8 <malloc+0x43b>
+    1193:	48 89 ce             	mov    %rcx,%rsi
+    1196:	89 c7                	mov    %eax,%edi
+    1198:	b8 00 00 00 00       	mov    $0x0,%eax
+    119d:	e8 00 02 00 00       	call   13a2 <printf>
+    11a2:	8b 05 f8 11 00 00    	mov    0x11f8(%rip),%eax        # 23a0 <stdout>
+    11a8:	48 8d 15 4c 0b 00 00 	lea    0xb4c(%rip),%rdx        # 1cfb <malloc+0x15e>
+    11af:	48 89 d6             	mov    %rdx,%rsi
+    11b2:	89 c7                	mov    %eax,%edi
+    11b4:	b8 00 00 00 00       	mov    $0x0,%eax
+    11b9:	e8 e4 01 00 00       	call   13a2 <printf>
+    11be:	90                   	nop
+    11bf:	eb fd                	jmp    11be <unlinktest+0x181>
+  printf(stdout, "unlinktest passed\n");
+    11c1:	8b 05 d9 11 00 00    	mov    0x11d9(%rip),%eax        # 23a0 <stdout>
+    11c7:	48 8d 15 2a 0e 00 00 	lea    0xe2a(%rip),%rdx        # 1ff8 <malloc+0x45b>
+    11ce:	48 89 d6             	mov    %rdx,%rsi
+    11d1:	89 c7                	mov    %eax,%edi
+    11d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d8:	e8 c5 01 00 00       	call   13a2 <printf>
+}
+    11dd:	90                   	nop
+    11de:	c9                   	leave
+    11df:	c3                   	ret
+
+00000000000011e0 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+    11e0:	55                   	push   %rbp
+    11e1:	48 89 e5             	mov    %rsp,%rbp
+    11e4:	48 83 ec 10          	sub    $0x10,%rsp
+    11e8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    11eb:	89 f0                	mov    %esi,%eax
+    11ed:	88 45 f8             	mov    %al,-0x8(%rbp)
+    11f0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    11f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11f7:	ba 01 00 00 00       	mov    $0x1,%edx
+    11fc:	48 89 ce             	mov    %rcx,%rsi
+    11ff:	89 c7                	mov    %eax,%edi
+    1201:	e8 63 07 00 00       	call   1969 <write>
+    1206:	90                   	nop
+    1207:	c9                   	leave
+    1208:	c3                   	ret
+
+0000000000001209 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+    1209:	55                   	push   %rbp
+    120a:	48 89 e5             	mov    %rsp,%rbp
+    120d:	48 83 ec 40          	sub    $0x40,%rsp
+    1211:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1214:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1217:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    121a:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    121d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1221:	74 1f                	je     1242 <printint64+0x39>
+    1223:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1226:	c1 e8 1f             	shr    $0x1f,%eax
+    1229:	0f b6 c0             	movzbl %al,%eax
+    122c:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    122f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1233:	74 0d                	je     1242 <printint64+0x39>
+    x = -xx;
+    1235:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1238:	f7 d8                	neg    %eax
+    123a:	48 98                	cltq
+    123c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1240:	eb 09                	jmp    124b <printint64+0x42>
+  else
+    x = xx;
+    1242:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1245:	48 98                	cltq
+    1247:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    124b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1252:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1255:	48 63 c8             	movslq %eax,%rcx
+    1258:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    125c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1261:	48 f7 f1             	div    %rcx
+    1264:	48 89 d1             	mov    %rdx,%rcx
+    1267:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    126a:	8d 50 01             	lea    0x1(%rax),%edx
+    126d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1270:	48 8d 15 39 11 00 00 	lea    0x1139(%rip),%rdx        # 23b0 <digits.1>
+    1277:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    127b:	48 98                	cltq
+    127d:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1281:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1284:	48 63 f0             	movslq %eax,%rsi
+    1287:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    128b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1290:	48 f7 f6             	div    %rsi
+    1293:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1297:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    129c:	75 b4                	jne    1252 <printint64+0x49>
+
+  if (sgn)
+    129e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    12a2:	74 2b                	je     12cf <printint64+0xc6>
+    buf[i++] = '-';
+    12a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12a7:	8d 50 01             	lea    0x1(%rax),%edx
+    12aa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12ad:	48 98                	cltq
+    12af:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    12b4:	eb 19                	jmp    12cf <printint64+0xc6>
+    putc(fd, buf[i]);
+    12b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12b9:	48 98                	cltq
+    12bb:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    12c0:	0f be d0             	movsbl %al,%edx
+    12c3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    12c6:	89 d6                	mov    %edx,%esi
+    12c8:	89 c7                	mov    %eax,%edi
+    12ca:	e8 11 ff ff ff       	call   11e0 <putc>
+  while (--i >= 0)
+    12cf:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    12d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    12d7:	79 dd                	jns    12b6 <printint64+0xad>
+}
+    12d9:	90                   	nop
+    12da:	90                   	nop
+    12db:	c9                   	leave
+    12dc:	c3                   	ret
+
+00000000000012dd <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    12dd:	55                   	push   %rbp
+    12de:	48 89 e5             	mov    %rsp,%rbp
+    12e1:	48 83 ec 30          	sub    $0x30,%rsp
+    12e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    12e8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    12eb:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    12ee:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    12f1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    12f8:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    12fc:	74 17                	je     1315 <printint+0x38>
+    12fe:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1302:	79 11                	jns    1315 <printint+0x38>
+    neg = 1;
+    1304:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    130b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    130e:	f7 d8                	neg    %eax
+    1310:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1313:	eb 06                	jmp    131b <printint+0x3e>
+  } else {
+    x = xx;
+    1315:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1318:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    131b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1322:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1325:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1328:	ba 00 00 00 00       	mov    $0x0,%edx
+    132d:	f7 f1                	div    %ecx
+    132f:	89 d1                	mov    %edx,%ecx
+    1331:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1334:	8d 50 01             	lea    0x1(%rax),%edx
+    1337:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    133a:	89 c9                	mov    %ecx,%ecx
+    133c:	48 8d 15 8d 10 00 00 	lea    0x108d(%rip),%rdx        # 23d0 <digits.0>
+    1343:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1347:	48 98                	cltq
+    1349:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    134d:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1350:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1353:	ba 00 00 00 00       	mov    $0x0,%edx
+    1358:	f7 f6                	div    %esi
+    135a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    135d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1361:	75 bf                	jne    1322 <printint+0x45>
+  if (neg)
+    1363:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1367:	74 2b                	je     1394 <printint+0xb7>
+    buf[i++] = '-';
+    1369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    136c:	8d 50 01             	lea    0x1(%rax),%edx
+    136f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1372:	48 98                	cltq
+    1374:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1379:	eb 19                	jmp    1394 <printint+0xb7>
+    putc(fd, buf[i]);
+    137b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    137e:	48 98                	cltq
+    1380:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1385:	0f be d0             	movsbl %al,%edx
+    1388:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    138b:	89 d6                	mov    %edx,%esi
+    138d:	89 c7                	mov    %eax,%edi
+    138f:	e8 4c fe ff ff       	call   11e0 <putc>
+  while (--i >= 0)
+    1394:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1398:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    139c:	79 dd                	jns    137b <printint+0x9e>
+}
+    139e:	90                   	nop
+    139f:	90                   	nop
+    13a0:	c9                   	leave
+    13a1:	c3                   	ret
+
+00000000000013a2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    13a2:	55                   	push   %rbp
+    13a3:	48 89 e5             	mov    %rsp,%rbp
+    13a6:	48 83 ec 70          	sub    $0x70,%rsp
+    13aa:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    13ad:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    13b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    13b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    13b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    13bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    13c1:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    13c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    13cc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    13d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    13d4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    13d8:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    13df:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    13e6:	e9 6b 02 00 00       	jmp    1656 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    13eb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    13ee:	48 63 d0             	movslq %eax,%rdx
+    13f1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    13f5:	48 01 d0             	add    %rdx,%rax
+    13f8:	0f b6 00             	movzbl (%rax),%eax
+    13fb:	0f be c0             	movsbl %al,%eax
+    13fe:	25 ff 00 00 00       	and    $0xff,%eax
+    1403:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1406:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    140a:	75 30                	jne    143c <printf+0x9a>
+      if (c == '%') {
+    140c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1410:	75 13                	jne    1425 <printf+0x83>
+        state = '%';
+    1412:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1419:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1420:	e9 2d 02 00 00       	jmp    1652 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1425:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1428:	0f be d0             	movsbl %al,%edx
+    142b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    142e:	89 d6                	mov    %edx,%esi
+    1430:	89 c7                	mov    %eax,%edi
+    1432:	e8 a9 fd ff ff       	call   11e0 <putc>
+    1437:	e9 16 02 00 00       	jmp    1652 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+    143c:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1440:	0f 85 0c 02 00 00    	jne    1652 <printf+0x2b0>
+      if (c == 'l') {
+    1446:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    144a:	75 0c                	jne    1458 <printf+0xb6>
+        lflag = 1;
+    144c:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1453:	e9 fa 01 00 00       	jmp    1652 <printf+0x2b0>
+      } else if (c == 'd') {
+    1458:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    145c:	0f 85 95 00 00 00    	jne    14f7 <printf+0x155>
+        if (lflag == 1)
+    1462:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1466:	75 49                	jne    14b1 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1468:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    146b:	83 f8 2f             	cmp    $0x2f,%eax
+    146e:	77 17                	ja     1487 <printf+0xe5>
+    1470:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1474:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1477:	89 d2                	mov    %edx,%edx
+    1479:	48 01 d0             	add    %rdx,%rax
+    147c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    147f:	83 c2 08             	add    $0x8,%edx
+    1482:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1485:	eb 0c                	jmp    1493 <printf+0xf1>
+    1487:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    148b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    148f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1493:	48 8b 00             	mov    (%rax),%rax
+    1496:	89 c6                	mov    %eax,%esi
+    1498:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    149b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    14a0:	ba 0a 00 00 00       	mov    $0xa,%edx
+    14a5:	89 c7                	mov    %eax,%edi
+    14a7:	e8 5d fd ff ff       	call   1209 <printint64>
+    14ac:	e9 9a 01 00 00       	jmp    164b <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    14b1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    14b4:	83 f8 2f             	cmp    $0x2f,%eax
+    14b7:	77 17                	ja     14d0 <printf+0x12e>
+    14b9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    14bd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14c0:	89 d2                	mov    %edx,%edx
+    14c2:	48 01 d0             	add    %rdx,%rax
+    14c5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14c8:	83 c2 08             	add    $0x8,%edx
+    14cb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    14ce:	eb 0c                	jmp    14dc <printf+0x13a>
+    14d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    14d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    14d8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    14dc:	8b 30                	mov    (%rax),%esi
+    14de:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    14e6:	ba 0a 00 00 00       	mov    $0xa,%edx
+    14eb:	89 c7                	mov    %eax,%edi
+    14ed:	e8 eb fd ff ff       	call   12dd <printint>
+    14f2:	e9 54 01 00 00       	jmp    164b <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+    14f7:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    14fb:	74 0a                	je     1507 <printf+0x165>
+    14fd:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1501:	0f 85 95 00 00 00    	jne    159c <printf+0x1fa>
+        if (lflag == 1)
+    1507:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    150b:	75 49                	jne    1556 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    150d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1510:	83 f8 2f             	cmp    $0x2f,%eax
+    1513:	77 17                	ja     152c <printf+0x18a>
+    1515:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1519:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    151c:	89 d2                	mov    %edx,%edx
+    151e:	48 01 d0             	add    %rdx,%rax
+    1521:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1524:	83 c2 08             	add    $0x8,%edx
+    1527:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    152a:	eb 0c                	jmp    1538 <printf+0x196>
+    152c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1530:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1534:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1538:	48 8b 00             	mov    (%rax),%rax
+    153b:	89 c6                	mov    %eax,%esi
+    153d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1540:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1545:	ba 10 00 00 00       	mov    $0x10,%edx
+    154a:	89 c7                	mov    %eax,%edi
+    154c:	e8 b8 fc ff ff       	call   1209 <printint64>
+        if (lflag == 1)
+    1551:	e9 f5 00 00 00       	jmp    164b <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1556:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1559:	83 f8 2f             	cmp    $0x2f,%eax
+    155c:	77 17                	ja     1575 <printf+0x1d3>
+    155e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1562:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1565:	89 d2                	mov    %edx,%edx
+    1567:	48 01 d0             	add    %rdx,%rax
+    156a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    156d:	83 c2 08             	add    $0x8,%edx
+    1570:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1573:	eb 0c                	jmp    1581 <printf+0x1df>
+    1575:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1579:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    157d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1581:	8b 30                	mov    (%rax),%esi
+    1583:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1586:	b9 00 00 00 00       	mov    $0x0,%ecx
+    158b:	ba 10 00 00 00       	mov    $0x10,%edx
+    1590:	89 c7                	mov    %eax,%edi
+    1592:	e8 46 fd ff ff       	call   12dd <printint>
+        if (lflag == 1)
+    1597:	e9 af 00 00 00       	jmp    164b <printf+0x2a9>
+      } else if (c == 's') {
+    159c:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    15a0:	75 6e                	jne    1610 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    15a2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    15a5:	83 f8 2f             	cmp    $0x2f,%eax
+    15a8:	77 17                	ja     15c1 <printf+0x21f>
+    15aa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    15ae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15b1:	89 d2                	mov    %edx,%edx
+    15b3:	48 01 d0             	add    %rdx,%rax
+    15b6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15b9:	83 c2 08             	add    $0x8,%edx
+    15bc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    15bf:	eb 0c                	jmp    15cd <printf+0x22b>
+    15c1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    15c5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    15c9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    15cd:	48 8b 00             	mov    (%rax),%rax
+    15d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    15d4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    15d9:	75 28                	jne    1603 <printf+0x261>
+          s = "(null)";
+    15db:	48 8d 05 29 0a 00 00 	lea    0xa29(%rip),%rax        # 200b <malloc+0x46e>
+    15e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    15e6:	eb 1b                	jmp    1603 <printf+0x261>
+          putc(fd, *s);
+    15e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    15ec:	0f b6 00             	movzbl (%rax),%eax
+    15ef:	0f be d0             	movsbl %al,%edx
+    15f2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    15f5:	89 d6                	mov    %edx,%esi
+    15f7:	89 c7                	mov    %eax,%edi
+    15f9:	e8 e2 fb ff ff       	call   11e0 <putc>
+        for (; *s; s++)
+    15fe:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1603:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1607:	0f b6 00             	movzbl (%rax),%eax
+    160a:	84 c0                	test   %al,%al
+    160c:	75 da                	jne    15e8 <printf+0x246>
+    160e:	eb 3b                	jmp    164b <printf+0x2a9>
+      } else if (c == '%') {
+    1610:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1614:	75 14                	jne    162a <printf+0x288>
+        putc(fd, c);
+    1616:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1619:	0f be d0             	movsbl %al,%edx
+    161c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    161f:	89 d6                	mov    %edx,%esi
+    1621:	89 c7                	mov    %eax,%edi
+    1623:	e8 b8 fb ff ff       	call   11e0 <putc>
+    1628:	eb 21                	jmp    164b <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    162a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    162d:	be 25 00 00 00       	mov    $0x25,%esi
+    1632:	89 c7                	mov    %eax,%edi
+    1634:	e8 a7 fb ff ff       	call   11e0 <putc>
+        putc(fd, c);
+    1639:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    163c:	0f be d0             	movsbl %al,%edx
+    163f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1642:	89 d6                	mov    %edx,%esi
+    1644:	89 c7                	mov    %eax,%edi
+    1646:	e8 95 fb ff ff       	call   11e0 <putc>
+      }
+      state = 0;
+    164b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1652:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1656:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1659:	48 63 d0             	movslq %eax,%rdx
+    165c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1660:	48 01 d0             	add    %rdx,%rax
+    1663:	0f b6 00             	movzbl (%rax),%eax
+    1666:	84 c0                	test   %al,%al
+    1668:	0f 85 7d fd ff ff    	jne    13eb <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    166e:	90                   	nop
+    166f:	90                   	nop
+    1670:	c9                   	leave
+    1671:	c3                   	ret
+
+0000000000001672 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+    1672:	55                   	push   %rbp
+    1673:	48 89 e5             	mov    %rsp,%rbp
+    1676:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    167a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    167d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+    1680:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1684:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1687:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    168a:	48 89 ce             	mov    %rcx,%rsi
+    168d:	48 89 f7             	mov    %rsi,%rdi
+    1690:	89 d1                	mov    %edx,%ecx
+    1692:	fc                   	cld
+    1693:	f3 aa                	rep stos %al,%es:(%rdi)
+    1695:	89 ca                	mov    %ecx,%edx
+    1697:	48 89 fe             	mov    %rdi,%rsi
+    169a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    169e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+    16a1:	90                   	nop
+    16a2:	5d                   	pop    %rbp
+    16a3:	c3                   	ret
+
+00000000000016a4 <strcpy>:
+char *strcpy(char *s, char *t) {
+    16a4:	55                   	push   %rbp
+    16a5:	48 89 e5             	mov    %rsp,%rbp
+    16a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    16b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    16b8:	90                   	nop
+    16b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    16bd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    16c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    16c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    16cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    16d1:	0f b6 12             	movzbl (%rdx),%edx
+    16d4:	88 10                	mov    %dl,(%rax)
+    16d6:	0f b6 00             	movzbl (%rax),%eax
+    16d9:	84 c0                	test   %al,%al
+    16db:	75 dc                	jne    16b9 <strcpy+0x15>
+  return os;
+    16dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    16e1:	5d                   	pop    %rbp
+    16e2:	c3                   	ret
+
+00000000000016e3 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    16e3:	55                   	push   %rbp
+    16e4:	48 89 e5             	mov    %rsp,%rbp
+    16e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    16ef:	eb 0a                	jmp    16fb <strcmp+0x18>
+    p++, q++;
+    16f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    16f6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    16fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ff:	0f b6 00             	movzbl (%rax),%eax
+    1702:	84 c0                	test   %al,%al
+    1704:	74 12                	je     1718 <strcmp+0x35>
+    1706:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    170a:	0f b6 10             	movzbl (%rax),%edx
+    170d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1711:	0f b6 00             	movzbl (%rax),%eax
+    1714:	38 c2                	cmp    %al,%dl
+    1716:	74 d9                	je     16f1 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    171c:	0f b6 00             	movzbl (%rax),%eax
+    171f:	0f b6 d0             	movzbl %al,%edx
+    1722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1726:	0f b6 00             	movzbl (%rax),%eax
+    1729:	0f b6 c0             	movzbl %al,%eax
+    172c:	29 c2                	sub    %eax,%edx
+    172e:	89 d0                	mov    %edx,%eax
+}
+    1730:	5d                   	pop    %rbp
+    1731:	c3                   	ret
+
+0000000000001732 <strlen>:
+uint strlen(char *s) {
+    1732:	55                   	push   %rbp
+    1733:	48 89 e5             	mov    %rsp,%rbp
+    1736:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    173a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1741:	eb 04                	jmp    1747 <strlen+0x15>
+    1743:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1747:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    174a:	48 63 d0             	movslq %eax,%rdx
+    174d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1751:	48 01 d0             	add    %rdx,%rax
+    1754:	0f b6 00             	movzbl (%rax),%eax
+    1757:	84 c0                	test   %al,%al
+    1759:	75 e8                	jne    1743 <strlen+0x11>
+  return n;
+    175b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    175e:	5d                   	pop    %rbp
+    175f:	c3                   	ret
+
+0000000000001760 <memset>:
+void *memset(void *dst, int c, uint n) {
+    1760:	55                   	push   %rbp
+    1761:	48 89 e5             	mov    %rsp,%rbp
+    1764:	48 83 ec 10          	sub    $0x10,%rsp
+    1768:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    176c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    176f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1772:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1775:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177c:	89 ce                	mov    %ecx,%esi
+    177e:	48 89 c7             	mov    %rax,%rdi
+    1781:	e8 ec fe ff ff       	call   1672 <stosb>
+  return dst;
+    1786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    178a:	c9                   	leave
+    178b:	c3                   	ret
+
+000000000000178c <strchr>:
+char *strchr(const char *s, char c) {
+    178c:	55                   	push   %rbp
+    178d:	48 89 e5             	mov    %rsp,%rbp
+    1790:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1794:	89 f0                	mov    %esi,%eax
+    1796:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1799:	eb 17                	jmp    17b2 <strchr+0x26>
+    if (*s == c)
+    179b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179f:	0f b6 00             	movzbl (%rax),%eax
+    17a2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    17a5:	75 06                	jne    17ad <strchr+0x21>
+      return (char *)s;
+    17a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ab:	eb 15                	jmp    17c2 <strchr+0x36>
+  for (; *s; s++)
+    17ad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    17b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b6:	0f b6 00             	movzbl (%rax),%eax
+    17b9:	84 c0                	test   %al,%al
+    17bb:	75 de                	jne    179b <strchr+0xf>
+  return 0;
+    17bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17c2:	5d                   	pop    %rbp
+    17c3:	c3                   	ret
+
+00000000000017c4 <gets>:
+char *gets(char *buf, int max) {
+    17c4:	55                   	push   %rbp
+    17c5:	48 89 e5             	mov    %rsp,%rbp
+    17c8:	48 83 ec 20          	sub    $0x20,%rsp
+    17cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17d0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+    17d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    17da:	eb 48                	jmp    1824 <gets+0x60>
+    cc = read(0, &c, 1);
+    17dc:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    17e0:	ba 01 00 00 00       	mov    $0x1,%edx
+    17e5:	48 89 c6             	mov    %rax,%rsi
+    17e8:	bf 00 00 00 00       	mov    $0x0,%edi
+    17ed:	e8 6f 01 00 00       	call   1961 <read>
+    17f2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    17f5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    17f9:	7e 36                	jle    1831 <gets+0x6d>
+    buf[i++] = c;
+    17fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17fe:	8d 50 01             	lea    0x1(%rax),%edx
+    1801:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1804:	48 63 d0             	movslq %eax,%rdx
+    1807:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    180b:	48 01 c2             	add    %rax,%rdx
+    180e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1812:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1814:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1818:	3c 0a                	cmp    $0xa,%al
+    181a:	74 16                	je     1832 <gets+0x6e>
+    181c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1820:	3c 0d                	cmp    $0xd,%al
+    1822:	74 0e                	je     1832 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1824:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1827:	83 c0 01             	add    $0x1,%eax
+    182a:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    182d:	7f ad                	jg     17dc <gets+0x18>
+    182f:	eb 01                	jmp    1832 <gets+0x6e>
+      break;
+    1831:	90                   	nop
+  }
+  buf[i] = '\0';
+    1832:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1835:	48 63 d0             	movslq %eax,%rdx
+    1838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    183c:	48 01 d0             	add    %rdx,%rax
+    183f:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1842:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1846:	c9                   	leave
+    1847:	c3                   	ret
+
+0000000000001848 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1848:	55                   	push   %rbp
+    1849:	48 89 e5             	mov    %rsp,%rbp
+    184c:	48 83 ec 20          	sub    $0x20,%rsp
+    1850:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1854:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1858:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    185c:	be 00 00 00 00       	mov    $0x0,%esi
+    1861:	48 89 c7             	mov    %rax,%rdi
+    1864:	e8 20 01 00 00       	call   1989 <open>
+    1869:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+    186c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1870:	79 07                	jns    1879 <stat+0x31>
+    return -1;
+    1872:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1877:	eb 21                	jmp    189a <stat+0x52>
+  r = fstat(fd, st);
+    1879:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    187d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1880:	48 89 d6             	mov    %rdx,%rsi
+    1883:	89 c7                	mov    %eax,%edi
+    1885:	e8 17 01 00 00       	call   19a1 <fstat>
+    188a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    188d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1890:	89 c7                	mov    %eax,%edi
+    1892:	e8 da 00 00 00       	call   1971 <close>
+  return r;
+    1897:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    189a:	c9                   	leave
+    189b:	c3                   	ret
+
+000000000000189c <atoi>:
+
+int atoi(const char *s) {
+    189c:	55                   	push   %rbp
+    189d:	48 89 e5             	mov    %rsp,%rbp
+    18a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    18a4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    18ab:	eb 28                	jmp    18d5 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    18ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    18b0:	89 d0                	mov    %edx,%eax
+    18b2:	c1 e0 02             	shl    $0x2,%eax
+    18b5:	01 d0                	add    %edx,%eax
+    18b7:	01 c0                	add    %eax,%eax
+    18b9:	89 c1                	mov    %eax,%ecx
+    18bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18bf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    18c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    18c7:	0f b6 00             	movzbl (%rax),%eax
+    18ca:	0f be c0             	movsbl %al,%eax
+    18cd:	01 c8                	add    %ecx,%eax
+    18cf:	83 e8 30             	sub    $0x30,%eax
+    18d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    18d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18d9:	0f b6 00             	movzbl (%rax),%eax
+    18dc:	3c 2f                	cmp    $0x2f,%al
+    18de:	7e 0b                	jle    18eb <atoi+0x4f>
+    18e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e4:	0f b6 00             	movzbl (%rax),%eax
+    18e7:	3c 39                	cmp    $0x39,%al
+    18e9:	7e c2                	jle    18ad <atoi+0x11>
+  return n;
+    18eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    18ee:	5d                   	pop    %rbp
+    18ef:	c3                   	ret
+
+00000000000018f0 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    18f0:	55                   	push   %rbp
+    18f1:	48 89 e5             	mov    %rsp,%rbp
+    18f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    18fc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    18ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1903:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1907:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    190b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+    190f:	eb 1d                	jmp    192e <memmove+0x3e>
+    *dst++ = *src++;
+    1911:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1915:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1919:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    191d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1921:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1925:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1929:	0f b6 12             	movzbl (%rdx),%edx
+    192c:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+    192e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1931:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1934:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1937:	85 c0                	test   %eax,%eax
+    1939:	7f d6                	jg     1911 <memmove+0x21>
+  return vdst;
+    193b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193f:	5d                   	pop    %rbp
+    1940:	c3                   	ret
+
+0000000000001941 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+    1941:	b8 01 00 00 00       	mov    $0x1,%eax
+    1946:	cd 40                	int    $0x40
+    1948:	c3                   	ret
+
+0000000000001949 <exit>:
+SYSCALL(exit)
+    1949:	b8 02 00 00 00       	mov    $0x2,%eax
+    194e:	cd 40                	int    $0x40
+    1950:	c3                   	ret
+
+0000000000001951 <wait>:
+SYSCALL(wait)
+    1951:	b8 03 00 00 00       	mov    $0x3,%eax
+    1956:	cd 40                	int    $0x40
+    1958:	c3                   	ret
+
+0000000000001959 <pipe>:
+SYSCALL(pipe)
+    1959:	b8 04 00 00 00       	mov    $0x4,%eax
+    195e:	cd 40                	int    $0x40
+    1960:	c3                   	ret
+
+0000000000001961 <read>:
+SYSCALL(read)
+    1961:	b8 05 00 00 00       	mov    $0x5,%eax
+    1966:	cd 40                	int    $0x40
+    1968:	c3                   	ret
+
+0000000000001969 <write>:
+SYSCALL(write)
+    1969:	b8 10 00 00 00       	mov    $0x10,%eax
+    196e:	cd 40                	int    $0x40
+    1970:	c3                   	ret
+
+0000000000001971 <close>:
+SYSCALL(close)
+    1971:	b8 15 00 00 00       	mov    $0x15,%eax
+    1976:	cd 40                	int    $0x40
+    1978:	c3                   	ret
+
+0000000000001979 <kill>:
+SYSCALL(kill)
+    1979:	b8 06 00 00 00       	mov    $0x6,%eax
+    197e:	cd 40                	int    $0x40
+    1980:	c3                   	ret
+
+0000000000001981 <exec>:
+SYSCALL(exec)
+    1981:	b8 07 00 00 00       	mov    $0x7,%eax
+    1986:	cd 40                	int    $0x40
+    1988:	c3                   	ret
+
+0000000000001989 <open>:
+SYSCALL(open)
+    1989:	b8 0f 00 00 00       	mov    $0xf,%eax
+    198e:	cd 40                	int    $0x40
+    1990:	c3                   	ret
+
+0000000000001991 <mknod>:
+SYSCALL(mknod)
+    1991:	b8 11 00 00 00       	mov    $0x11,%eax
+    1996:	cd 40                	int    $0x40
+    1998:	c3                   	ret
+
+0000000000001999 <unlink>:
+SYSCALL(unlink)
+    1999:	b8 12 00 00 00       	mov    $0x12,%eax
+    199e:	cd 40                	int    $0x40
+    19a0:	c3                   	ret
+
+00000000000019a1 <fstat>:
+SYSCALL(fstat)
+    19a1:	b8 08 00 00 00       	mov    $0x8,%eax
+    19a6:	cd 40                	int    $0x40
+    19a8:	c3                   	ret
+
+00000000000019a9 <link>:
+SYSCALL(link)
+    19a9:	b8 13 00 00 00       	mov    $0x13,%eax
+    19ae:	cd 40                	int    $0x40
+    19b0:	c3                   	ret
+
+00000000000019b1 <mkdir>:
+SYSCALL(mkdir)
+    19b1:	b8 14 00 00 00       	mov    $0x14,%eax
+    19b6:	cd 40                	int    $0x40
+    19b8:	c3                   	ret
+
+00000000000019b9 <chdir>:
+SYSCALL(chdir)
+    19b9:	b8 09 00 00 00       	mov    $0x9,%eax
+    19be:	cd 40                	int    $0x40
+    19c0:	c3                   	ret
+
+00000000000019c1 <dup>:
+SYSCALL(dup)
+    19c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19c6:	cd 40                	int    $0x40
+    19c8:	c3                   	ret
+
+00000000000019c9 <getpid>:
+SYSCALL(getpid)
+    19c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19ce:	cd 40                	int    $0x40
+    19d0:	c3                   	ret
+
+00000000000019d1 <sbrk>:
+SYSCALL(sbrk)
+    19d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19d6:	cd 40                	int    $0x40
+    19d8:	c3                   	ret
+
+00000000000019d9 <sleep>:
+SYSCALL(sleep)
+    19d9:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19de:	cd 40                	int    $0x40
+    19e0:	c3                   	ret
+
+00000000000019e1 <uptime>:
+SYSCALL(uptime)
+    19e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+    19e6:	cd 40                	int    $0x40
+    19e8:	c3                   	ret
+
+00000000000019e9 <sysinfo>:
+SYSCALL(sysinfo)
+    19e9:	b8 16 00 00 00       	mov    $0x16,%eax
+    19ee:	cd 40                	int    $0x40
+    19f0:	c3                   	ret
+
+00000000000019f1 <crashn>:
+SYSCALL(crashn)
+    19f1:	b8 17 00 00 00       	mov    $0x17,%eax
+    19f6:	cd 40                	int    $0x40
+    19f8:	c3                   	ret
+
+00000000000019f9 <mmap>:
+SYSCALL(mmap)
+    19f9:	b8 18 00 00 00       	mov    $0x18,%eax
+    19fe:	cd 40                	int    $0x40
+    1a00:	c3                   	ret
+
+0000000000001a01 <munmap>:
+SYSCALL(munmap)
+    1a01:	b8 19 00 00 00       	mov    $0x19,%eax
+    1a06:	cd 40                	int    $0x40
+    1a08:	c3                   	ret
+
+0000000000001a09 <preface>:
+.globl preface
+preface:
+    call main
+    1a09:	e8 f2 e5 ff ff       	call   0 <main>
+    mov %rax, %rdi
+    1a0e:	48 89 c7             	mov    %rax,%rdi
+    call exit
+    1a11:	e8 33 ff ff ff       	call   1949 <exit>
+
+0000000000001a16 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+    1a16:	55                   	push   %rbp
+    1a17:	48 89 e5             	mov    %rsp,%rbp
+    1a1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+    1a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a22:	48 83 e8 10          	sub    $0x10,%rax
+    1a26:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a2a:	48 8b 05 df 29 00 00 	mov    0x29df(%rip),%rax        # 4410 <freep>
+    1a31:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a35:	eb 2f                	jmp    1a66 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1a37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a3b:	48 8b 00             	mov    (%rax),%rax
+    1a3e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a42:	72 17                	jb     1a5b <free+0x45>
+    1a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a48:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a4c:	72 2f                	jb     1a7d <free+0x67>
+    1a4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a52:	48 8b 00             	mov    (%rax),%rax
+    1a55:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a59:	72 22                	jb     1a7d <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a5f:	48 8b 00             	mov    (%rax),%rax
+    1a62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a6a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a6e:	73 c7                	jae    1a37 <free+0x21>
+    1a70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a74:	48 8b 00             	mov    (%rax),%rax
+    1a77:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a7b:	73 ba                	jae    1a37 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+    1a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a81:	8b 40 08             	mov    0x8(%rax),%eax
+    1a84:	89 c0                	mov    %eax,%eax
+    1a86:	48 c1 e0 04          	shl    $0x4,%rax
+    1a8a:	48 89 c2             	mov    %rax,%rdx
+    1a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a91:	48 01 c2             	add    %rax,%rdx
+    1a94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a98:	48 8b 00             	mov    (%rax),%rax
+    1a9b:	48 39 c2             	cmp    %rax,%rdx
+    1a9e:	75 2d                	jne    1acd <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+    1aa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa4:	8b 50 08             	mov    0x8(%rax),%edx
+    1aa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aab:	48 8b 00             	mov    (%rax),%rax
+    1aae:	8b 40 08             	mov    0x8(%rax),%eax
+    1ab1:	01 c2                	add    %eax,%edx
+    1ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab7:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1aba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1abe:	48 8b 00             	mov    (%rax),%rax
+    1ac1:	48 8b 10             	mov    (%rax),%rdx
+    1ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ac8:	48 89 10             	mov    %rdx,(%rax)
+    1acb:	eb 0e                	jmp    1adb <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad1:	48 8b 10             	mov    (%rax),%rdx
+    1ad4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad8:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+    1adb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1adf:	8b 40 08             	mov    0x8(%rax),%eax
+    1ae2:	89 c0                	mov    %eax,%eax
+    1ae4:	48 c1 e0 04          	shl    $0x4,%rax
+    1ae8:	48 89 c2             	mov    %rax,%rdx
+    1aeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aef:	48 01 d0             	add    %rdx,%rax
+    1af2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1af6:	75 27                	jne    1b1f <free+0x109>
+    p->s.size += bp->s.size;
+    1af8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1afc:	8b 50 08             	mov    0x8(%rax),%edx
+    1aff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b03:	8b 40 08             	mov    0x8(%rax),%eax
+    1b06:	01 c2                	add    %eax,%edx
+    1b08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b0c:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1b0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b13:	48 8b 10             	mov    (%rax),%rdx
+    1b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1a:	48 89 10             	mov    %rdx,(%rax)
+    1b1d:	eb 0b                	jmp    1b2a <free+0x114>
+  } else
+    p->s.ptr = bp;
+    1b1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b23:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b27:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1b2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b2e:	48 89 05 db 28 00 00 	mov    %rax,0x28db(%rip)        # 4410 <freep>
+}
+    1b35:	90                   	nop
+    1b36:	5d                   	pop    %rbp
+    1b37:	c3                   	ret
+
+0000000000001b38 <morecore>:
+
+static Header *morecore(uint nu) {
+    1b38:	55                   	push   %rbp
+    1b39:	48 89 e5             	mov    %rsp,%rbp
+    1b3c:	48 83 ec 20          	sub    $0x20,%rsp
+    1b40:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+    1b43:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1b4a:	77 07                	ja     1b53 <morecore+0x1b>
+    nu = 4096;
+    1b4c:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1b53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b56:	c1 e0 04             	shl    $0x4,%eax
+    1b59:	89 c7                	mov    %eax,%edi
+    1b5b:	e8 71 fe ff ff       	call   19d1 <sbrk>
+    1b60:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+    1b64:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1b69:	75 07                	jne    1b72 <morecore+0x3a>
+    return 0;
+    1b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b70:	eb 29                	jmp    1b9b <morecore+0x63>
+  hp = (Header *)p;
+    1b72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1b7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b7e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b81:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+    1b84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b88:	48 83 c0 10          	add    $0x10,%rax
+    1b8c:	48 89 c7             	mov    %rax,%rdi
+    1b8f:	e8 82 fe ff ff       	call   1a16 <free>
+  return freep;
+    1b94:	48 8b 05 75 28 00 00 	mov    0x2875(%rip),%rax        # 4410 <freep>
+}
+    1b9b:	c9                   	leave
+    1b9c:	c3                   	ret
+
+0000000000001b9d <malloc>:
+
+void *malloc(uint nbytes) {
+    1b9d:	55                   	push   %rbp
+    1b9e:	48 89 e5             	mov    %rsp,%rbp
+    1ba1:	48 83 ec 30          	sub    $0x30,%rsp
+    1ba5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    1ba8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bab:	48 83 c0 0f          	add    $0xf,%rax
+    1baf:	48 c1 e8 04          	shr    $0x4,%rax
+    1bb3:	83 c0 01             	add    $0x1,%eax
+    1bb6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+    1bb9:	48 8b 05 50 28 00 00 	mov    0x2850(%rip),%rax        # 4410 <freep>
+    1bc0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bc4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1bc9:	75 2e                	jne    1bf9 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+    1bcb:	48 8d 05 2e 28 00 00 	lea    0x282e(%rip),%rax        # 4400 <base>
+    1bd2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bda:	48 89 05 2f 28 00 00 	mov    %rax,0x282f(%rip)        # 4410 <freep>
+    1be1:	48 8b 05 28 28 00 00 	mov    0x2828(%rip),%rax        # 4410 <freep>
+    1be8:	48 89 05 11 28 00 00 	mov    %rax,0x2811(%rip)        # 4400 <base>
+    base.s.size = 0;
+    1bef:	c7 05 0f 28 00 00 00 	movl   $0x0,0x280f(%rip)        # 4408 <base+0x8>
+    1bf6:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1bf9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bfd:	48 8b 00             	mov    (%rax),%rax
+    1c00:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c08:	8b 40 08             	mov    0x8(%rax),%eax
+    1c0b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1c0e:	72 5f                	jb     1c6f <malloc+0xd2>
+      if (p->s.size == nunits)
+    1c10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c14:	8b 40 08             	mov    0x8(%rax),%eax
+    1c17:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1c1a:	75 10                	jne    1c2c <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+    1c1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c20:	48 8b 10             	mov    (%rax),%rdx
+    1c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c27:	48 89 10             	mov    %rdx,(%rax)
+    1c2a:	eb 2e                	jmp    1c5a <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+    1c2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c30:	8b 40 08             	mov    0x8(%rax),%eax
+    1c33:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1c36:	89 c2                	mov    %eax,%edx
+    1c38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3c:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c43:	8b 40 08             	mov    0x8(%rax),%eax
+    1c46:	89 c0                	mov    %eax,%eax
+    1c48:	48 c1 e0 04          	shl    $0x4,%rax
+    1c4c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1c50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c54:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c57:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1c5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c5e:	48 89 05 ab 27 00 00 	mov    %rax,0x27ab(%rip)        # 4410 <freep>
+      return (void *)(p + 1);
+    1c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c69:	48 83 c0 10          	add    $0x10,%rax
+    1c6d:	eb 41                	jmp    1cb0 <malloc+0x113>
+    }
+    if (p == freep)
+    1c6f:	48 8b 05 9a 27 00 00 	mov    0x279a(%rip),%rax        # 4410 <freep>
+    1c76:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1c7a:	75 1c                	jne    1c98 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+    1c7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c7f:	89 c7                	mov    %eax,%edi
+    1c81:	e8 b2 fe ff ff       	call   1b38 <morecore>
+    1c86:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c8a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c8f:	75 07                	jne    1c98 <malloc+0xfb>
+        return 0;
+    1c91:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c96:	eb 18                	jmp    1cb0 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+    1c98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca4:	48 8b 00             	mov    (%rax),%rax
+    1ca7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+    1cab:	e9 54 ff ff ff       	jmp    1c04 <malloc+0x67>
+  }
+    1cb0:	c9                   	leave
+    1cb1:	c3                   	ret
@@ -0,0 +1,1381 @@
+
+out/user/_stressfs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <fcntl.h>
+#include <fs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 81 ec 30 02 00 00 	sub    $0x230,%rsp
+   b:	89 bd dc fd ff ff    	mov    %edi,-0x224(%rbp)
+  11:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+  int fd, i;
+  char path[] = "stressfs0";
+  18:	48 b8 73 74 72 65 73 	movabs $0x7366737365727473,%rax
+  1f:	73 66 73 
+  22:	48 89 45 ee          	mov    %rax,-0x12(%rbp)
+  26:	66 c7 45 f6 30 00    	movw   $0x30,-0xa(%rbp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  2c:	48 8d 05 ff 0b 00 00 	lea    0xbff(%rip),%rax        # c32 <malloc+0x115>
+  33:	48 89 c6             	mov    %rax,%rsi
+  36:	bf 01 00 00 00       	mov    $0x1,%edi
+  3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  40:	e8 dd 02 00 00       	call   322 <printf>
+  memset(data, 'a', sizeof(data));
+  45:	48 8d 85 ee fd ff ff 	lea    -0x212(%rbp),%rax
+  4c:	ba 00 02 00 00       	mov    $0x200,%edx
+  51:	be 61 00 00 00       	mov    $0x61,%esi
+  56:	48 89 c7             	mov    %rax,%rdi
+  59:	e8 82 06 00 00       	call   6e0 <memset>
+
+  for (i = 0; i < 4; i++)
+  5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  65:	eb 0d                	jmp    74 <main+0x74>
+    if (fork() > 0)
+  67:	e8 55 08 00 00       	call   8c1 <fork>
+  6c:	85 c0                	test   %eax,%eax
+  6e:	7f 0c                	jg     7c <main+0x7c>
+  for (i = 0; i < 4; i++)
+  70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  74:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+  78:	7e ed                	jle    67 <main+0x67>
+  7a:	eb 01                	jmp    7d <main+0x7d>
+      break;
+  7c:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80:	89 c2                	mov    %eax,%edx
+  82:	48 8d 05 bc 0b 00 00 	lea    0xbbc(%rip),%rax        # c45 <malloc+0x128>
+  89:	48 89 c6             	mov    %rax,%rsi
+  8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  91:	b8 00 00 00 00       	mov    $0x0,%eax
+  96:	e8 87 02 00 00       	call   322 <printf>
+
+  path[8] += i;
+  9b:	0f b6 45 f6          	movzbl -0xa(%rbp),%eax
+  9f:	89 c2                	mov    %eax,%edx
+  a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  a4:	01 d0                	add    %edx,%eax
+  a6:	88 45 f6             	mov    %al,-0xa(%rbp)
+  fd = open(path, O_CREATE | O_RDWR);
+  a9:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+  ad:	be 02 02 00 00       	mov    $0x202,%esi
+  b2:	48 89 c7             	mov    %rax,%rdi
+  b5:	e8 4f 08 00 00       	call   909 <open>
+  ba:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (i = 0; i < 20; i++)
+  bd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  c4:	eb 1d                	jmp    e3 <main+0xe3>
+    //    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  c6:	48 8d 8d ee fd ff ff 	lea    -0x212(%rbp),%rcx
+  cd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  d0:	ba 00 02 00 00       	mov    $0x200,%edx
+  d5:	48 89 ce             	mov    %rcx,%rsi
+  d8:	89 c7                	mov    %eax,%edi
+  da:	e8 0a 08 00 00       	call   8e9 <write>
+  for (i = 0; i < 20; i++)
+  df:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  e3:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+  e7:	7e dd                	jle    c6 <main+0xc6>
+  close(fd);
+  e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  ec:	89 c7                	mov    %eax,%edi
+  ee:	e8 fe 07 00 00       	call   8f1 <close>
+
+  printf(1, "read\n");
+  f3:	48 8d 05 55 0b 00 00 	lea    0xb55(%rip),%rax        # c4f <malloc+0x132>
+  fa:	48 89 c6             	mov    %rax,%rsi
+  fd:	bf 01 00 00 00       	mov    $0x1,%edi
+ 102:	b8 00 00 00 00       	mov    $0x0,%eax
+ 107:	e8 16 02 00 00       	call   322 <printf>
+
+  fd = open(path, O_RDONLY);
+ 10c:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+ 110:	be 00 00 00 00       	mov    $0x0,%esi
+ 115:	48 89 c7             	mov    %rax,%rdi
+ 118:	e8 ec 07 00 00       	call   909 <open>
+ 11d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (i = 0; i < 20; i++)
+ 120:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 127:	eb 1d                	jmp    146 <main+0x146>
+    read(fd, data, sizeof(data));
+ 129:	48 8d 8d ee fd ff ff 	lea    -0x212(%rbp),%rcx
+ 130:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 133:	ba 00 02 00 00       	mov    $0x200,%edx
+ 138:	48 89 ce             	mov    %rcx,%rsi
+ 13b:	89 c7                	mov    %eax,%edi
+ 13d:	e8 9f 07 00 00       	call   8e1 <read>
+  for (i = 0; i < 20; i++)
+ 142:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 146:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+ 14a:	7e dd                	jle    129 <main+0x129>
+  close(fd);
+ 14c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 14f:	89 c7                	mov    %eax,%edi
+ 151:	e8 9b 07 00 00       	call   8f1 <close>
+
+  wait();
+ 156:	e8 76 07 00 00       	call   8d1 <wait>
+
+  exit();
+ 15b:	e8 69 07 00 00       	call   8c9 <exit>
+
+0000000000000160 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 160:	55                   	push   %rbp
+ 161:	48 89 e5             	mov    %rsp,%rbp
+ 164:	48 83 ec 10          	sub    $0x10,%rsp
+ 168:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 16b:	89 f0                	mov    %esi,%eax
+ 16d:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 170:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 174:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 177:	ba 01 00 00 00       	mov    $0x1,%edx
+ 17c:	48 89 ce             	mov    %rcx,%rsi
+ 17f:	89 c7                	mov    %eax,%edi
+ 181:	e8 63 07 00 00       	call   8e9 <write>
+ 186:	90                   	nop
+ 187:	c9                   	leave
+ 188:	c3                   	ret
+
+0000000000000189 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 189:	55                   	push   %rbp
+ 18a:	48 89 e5             	mov    %rsp,%rbp
+ 18d:	48 83 ec 40          	sub    $0x40,%rsp
+ 191:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 194:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 197:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 19a:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 19d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1a1:	74 1f                	je     1c2 <printint64+0x39>
+ 1a3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1a6:	c1 e8 1f             	shr    $0x1f,%eax
+ 1a9:	0f b6 c0             	movzbl %al,%eax
+ 1ac:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 1af:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1b3:	74 0d                	je     1c2 <printint64+0x39>
+    x = -xx;
+ 1b5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1b8:	f7 d8                	neg    %eax
+ 1ba:	48 98                	cltq
+ 1bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 1c0:	eb 09                	jmp    1cb <printint64+0x42>
+  else
+    x = xx;
+ 1c2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1c5:	48 98                	cltq
+ 1c7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 1cb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1d2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1d5:	48 63 c8             	movslq %eax,%rcx
+ 1d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1e1:	48 f7 f1             	div    %rcx
+ 1e4:	48 89 d1             	mov    %rdx,%rcx
+ 1e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1ea:	8d 50 01             	lea    0x1(%rax),%edx
+ 1ed:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1f0:	48 8d 15 c9 0c 00 00 	lea    0xcc9(%rip),%rdx        # ec0 <digits.1>
+ 1f7:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1fb:	48 98                	cltq
+ 1fd:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 201:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 204:	48 63 f0             	movslq %eax,%rsi
+ 207:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 20b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 210:	48 f7 f6             	div    %rsi
+ 213:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 217:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 21c:	75 b4                	jne    1d2 <printint64+0x49>
+
+  if (sgn)
+ 21e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 222:	74 2b                	je     24f <printint64+0xc6>
+    buf[i++] = '-';
+ 224:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 227:	8d 50 01             	lea    0x1(%rax),%edx
+ 22a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 22d:	48 98                	cltq
+ 22f:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 234:	eb 19                	jmp    24f <printint64+0xc6>
+    putc(fd, buf[i]);
+ 236:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 239:	48 98                	cltq
+ 23b:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 240:	0f be d0             	movsbl %al,%edx
+ 243:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 246:	89 d6                	mov    %edx,%esi
+ 248:	89 c7                	mov    %eax,%edi
+ 24a:	e8 11 ff ff ff       	call   160 <putc>
+  while (--i >= 0)
+ 24f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 253:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 257:	79 dd                	jns    236 <printint64+0xad>
+}
+ 259:	90                   	nop
+ 25a:	90                   	nop
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+
+000000000000025d <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 25d:	55                   	push   %rbp
+ 25e:	48 89 e5             	mov    %rsp,%rbp
+ 261:	48 83 ec 30          	sub    $0x30,%rsp
+ 265:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 268:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 26b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 26e:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 271:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 278:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 27c:	74 17                	je     295 <printint+0x38>
+ 27e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 282:	79 11                	jns    295 <printint+0x38>
+    neg = 1;
+ 284:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 28b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 28e:	f7 d8                	neg    %eax
+ 290:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 293:	eb 06                	jmp    29b <printint+0x3e>
+  } else {
+    x = xx;
+ 295:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 298:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 29b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 2a2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 2a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2ad:	f7 f1                	div    %ecx
+ 2af:	89 d1                	mov    %edx,%ecx
+ 2b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2b4:	8d 50 01             	lea    0x1(%rax),%edx
+ 2b7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2ba:	89 c9                	mov    %ecx,%ecx
+ 2bc:	48 8d 15 1d 0c 00 00 	lea    0xc1d(%rip),%rdx        # ee0 <digits.0>
+ 2c3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 2c7:	48 98                	cltq
+ 2c9:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 2cd:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 2d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2d3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2d8:	f7 f6                	div    %esi
+ 2da:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 2dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 2e1:	75 bf                	jne    2a2 <printint+0x45>
+  if (neg)
+ 2e3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 2e7:	74 2b                	je     314 <printint+0xb7>
+    buf[i++] = '-';
+ 2e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2ec:	8d 50 01             	lea    0x1(%rax),%edx
+ 2ef:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2f2:	48 98                	cltq
+ 2f4:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 2f9:	eb 19                	jmp    314 <printint+0xb7>
+    putc(fd, buf[i]);
+ 2fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2fe:	48 98                	cltq
+ 300:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 305:	0f be d0             	movsbl %al,%edx
+ 308:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 30b:	89 d6                	mov    %edx,%esi
+ 30d:	89 c7                	mov    %eax,%edi
+ 30f:	e8 4c fe ff ff       	call   160 <putc>
+  while (--i >= 0)
+ 314:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 318:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 31c:	79 dd                	jns    2fb <printint+0x9e>
+}
+ 31e:	90                   	nop
+ 31f:	90                   	nop
+ 320:	c9                   	leave
+ 321:	c3                   	ret
+
+0000000000000322 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 322:	55                   	push   %rbp
+ 323:	48 89 e5             	mov    %rsp,%rbp
+ 326:	48 83 ec 70          	sub    $0x70,%rsp
+ 32a:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 32d:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 331:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 335:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 339:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 33d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 341:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 348:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 34c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 350:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 354:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 358:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 35f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 366:	e9 6b 02 00 00       	jmp    5d6 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 36b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 36e:	48 63 d0             	movslq %eax,%rdx
+ 371:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 375:	48 01 d0             	add    %rdx,%rax
+ 378:	0f b6 00             	movzbl (%rax),%eax
+ 37b:	0f be c0             	movsbl %al,%eax
+ 37e:	25 ff 00 00 00       	and    $0xff,%eax
+ 383:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 386:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 38a:	75 30                	jne    3bc <printf+0x9a>
+      if (c == '%') {
+ 38c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 390:	75 13                	jne    3a5 <printf+0x83>
+        state = '%';
+ 392:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 399:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 3a0:	e9 2d 02 00 00       	jmp    5d2 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 3a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 3a8:	0f be d0             	movsbl %al,%edx
+ 3ab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3ae:	89 d6                	mov    %edx,%esi
+ 3b0:	89 c7                	mov    %eax,%edi
+ 3b2:	e8 a9 fd ff ff       	call   160 <putc>
+ 3b7:	e9 16 02 00 00       	jmp    5d2 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 3bc:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 3c0:	0f 85 0c 02 00 00    	jne    5d2 <printf+0x2b0>
+      if (c == 'l') {
+ 3c6:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 3ca:	75 0c                	jne    3d8 <printf+0xb6>
+        lflag = 1;
+ 3cc:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 3d3:	e9 fa 01 00 00       	jmp    5d2 <printf+0x2b0>
+      } else if (c == 'd') {
+ 3d8:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 3dc:	0f 85 95 00 00 00    	jne    477 <printf+0x155>
+        if (lflag == 1)
+ 3e2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3e6:	75 49                	jne    431 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 3e8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3eb:	83 f8 2f             	cmp    $0x2f,%eax
+ 3ee:	77 17                	ja     407 <printf+0xe5>
+ 3f0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3f4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3f7:	89 d2                	mov    %edx,%edx
+ 3f9:	48 01 d0             	add    %rdx,%rax
+ 3fc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3ff:	83 c2 08             	add    $0x8,%edx
+ 402:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 405:	eb 0c                	jmp    413 <printf+0xf1>
+ 407:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 40b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 40f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 413:	48 8b 00             	mov    (%rax),%rax
+ 416:	89 c6                	mov    %eax,%esi
+ 418:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 41b:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 420:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 425:	89 c7                	mov    %eax,%edi
+ 427:	e8 5d fd ff ff       	call   189 <printint64>
+ 42c:	e9 9a 01 00 00       	jmp    5cb <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 431:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 434:	83 f8 2f             	cmp    $0x2f,%eax
+ 437:	77 17                	ja     450 <printf+0x12e>
+ 439:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 43d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 440:	89 d2                	mov    %edx,%edx
+ 442:	48 01 d0             	add    %rdx,%rax
+ 445:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 448:	83 c2 08             	add    $0x8,%edx
+ 44b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 44e:	eb 0c                	jmp    45c <printf+0x13a>
+ 450:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 454:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 458:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 45c:	8b 30                	mov    (%rax),%esi
+ 45e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 461:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 466:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 46b:	89 c7                	mov    %eax,%edi
+ 46d:	e8 eb fd ff ff       	call   25d <printint>
+ 472:	e9 54 01 00 00       	jmp    5cb <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 477:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 47b:	74 0a                	je     487 <printf+0x165>
+ 47d:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 481:	0f 85 95 00 00 00    	jne    51c <printf+0x1fa>
+        if (lflag == 1)
+ 487:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 48b:	75 49                	jne    4d6 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 48d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 490:	83 f8 2f             	cmp    $0x2f,%eax
+ 493:	77 17                	ja     4ac <printf+0x18a>
+ 495:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 499:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 49c:	89 d2                	mov    %edx,%edx
+ 49e:	48 01 d0             	add    %rdx,%rax
+ 4a1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4a4:	83 c2 08             	add    $0x8,%edx
+ 4a7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4aa:	eb 0c                	jmp    4b8 <printf+0x196>
+ 4ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4b4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4b8:	48 8b 00             	mov    (%rax),%rax
+ 4bb:	89 c6                	mov    %eax,%esi
+ 4bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4c5:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4ca:	89 c7                	mov    %eax,%edi
+ 4cc:	e8 b8 fc ff ff       	call   189 <printint64>
+        if (lflag == 1)
+ 4d1:	e9 f5 00 00 00       	jmp    5cb <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 4d6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4d9:	83 f8 2f             	cmp    $0x2f,%eax
+ 4dc:	77 17                	ja     4f5 <printf+0x1d3>
+ 4de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4e2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4e5:	89 d2                	mov    %edx,%edx
+ 4e7:	48 01 d0             	add    %rdx,%rax
+ 4ea:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4ed:	83 c2 08             	add    $0x8,%edx
+ 4f0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4f3:	eb 0c                	jmp    501 <printf+0x1df>
+ 4f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4f9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4fd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 501:	8b 30                	mov    (%rax),%esi
+ 503:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 506:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 50b:	ba 10 00 00 00       	mov    $0x10,%edx
+ 510:	89 c7                	mov    %eax,%edi
+ 512:	e8 46 fd ff ff       	call   25d <printint>
+        if (lflag == 1)
+ 517:	e9 af 00 00 00       	jmp    5cb <printf+0x2a9>
+      } else if (c == 's') {
+ 51c:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 520:	75 6e                	jne    590 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 522:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 525:	83 f8 2f             	cmp    $0x2f,%eax
+ 528:	77 17                	ja     541 <printf+0x21f>
+ 52a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 52e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 531:	89 d2                	mov    %edx,%edx
+ 533:	48 01 d0             	add    %rdx,%rax
+ 536:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 539:	83 c2 08             	add    $0x8,%edx
+ 53c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 53f:	eb 0c                	jmp    54d <printf+0x22b>
+ 541:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 545:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 549:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 54d:	48 8b 00             	mov    (%rax),%rax
+ 550:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 554:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 559:	75 28                	jne    583 <printf+0x261>
+          s = "(null)";
+ 55b:	48 8d 05 f3 06 00 00 	lea    0x6f3(%rip),%rax        # c55 <malloc+0x138>
+ 562:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 566:	eb 1b                	jmp    583 <printf+0x261>
+          putc(fd, *s);
+ 568:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 56c:	0f b6 00             	movzbl (%rax),%eax
+ 56f:	0f be d0             	movsbl %al,%edx
+ 572:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 575:	89 d6                	mov    %edx,%esi
+ 577:	89 c7                	mov    %eax,%edi
+ 579:	e8 e2 fb ff ff       	call   160 <putc>
+        for (; *s; s++)
+ 57e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 583:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 587:	0f b6 00             	movzbl (%rax),%eax
+ 58a:	84 c0                	test   %al,%al
+ 58c:	75 da                	jne    568 <printf+0x246>
+ 58e:	eb 3b                	jmp    5cb <printf+0x2a9>
+      } else if (c == '%') {
+ 590:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 594:	75 14                	jne    5aa <printf+0x288>
+        putc(fd, c);
+ 596:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 599:	0f be d0             	movsbl %al,%edx
+ 59c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 59f:	89 d6                	mov    %edx,%esi
+ 5a1:	89 c7                	mov    %eax,%edi
+ 5a3:	e8 b8 fb ff ff       	call   160 <putc>
+ 5a8:	eb 21                	jmp    5cb <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5aa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5ad:	be 25 00 00 00       	mov    $0x25,%esi
+ 5b2:	89 c7                	mov    %eax,%edi
+ 5b4:	e8 a7 fb ff ff       	call   160 <putc>
+        putc(fd, c);
+ 5b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 5bc:	0f be d0             	movsbl %al,%edx
+ 5bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5c2:	89 d6                	mov    %edx,%esi
+ 5c4:	89 c7                	mov    %eax,%edi
+ 5c6:	e8 95 fb ff ff       	call   160 <putc>
+      }
+      state = 0;
+ 5cb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 5d2:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 5d6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5d9:	48 63 d0             	movslq %eax,%rdx
+ 5dc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5e0:	48 01 d0             	add    %rdx,%rax
+ 5e3:	0f b6 00             	movzbl (%rax),%eax
+ 5e6:	84 c0                	test   %al,%al
+ 5e8:	0f 85 7d fd ff ff    	jne    36b <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 5ee:	90                   	nop
+ 5ef:	90                   	nop
+ 5f0:	c9                   	leave
+ 5f1:	c3                   	ret
+
+00000000000005f2 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+ 5f2:	55                   	push   %rbp
+ 5f3:	48 89 e5             	mov    %rsp,%rbp
+ 5f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5fd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+ 600:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 604:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 607:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 60a:	48 89 ce             	mov    %rcx,%rsi
+ 60d:	48 89 f7             	mov    %rsi,%rdi
+ 610:	89 d1                	mov    %edx,%ecx
+ 612:	fc                   	cld
+ 613:	f3 aa                	rep stos %al,%es:(%rdi)
+ 615:	89 ca                	mov    %ecx,%edx
+ 617:	48 89 fe             	mov    %rdi,%rsi
+ 61a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 61e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+ 621:	90                   	nop
+ 622:	5d                   	pop    %rbp
+ 623:	c3                   	ret
+
+0000000000000624 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 624:	55                   	push   %rbp
+ 625:	48 89 e5             	mov    %rsp,%rbp
+ 628:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 62c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 630:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 634:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 638:	90                   	nop
+ 639:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 63d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 641:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 649:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 64d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 651:	0f b6 12             	movzbl (%rdx),%edx
+ 654:	88 10                	mov    %dl,(%rax)
+ 656:	0f b6 00             	movzbl (%rax),%eax
+ 659:	84 c0                	test   %al,%al
+ 65b:	75 dc                	jne    639 <strcpy+0x15>
+  return os;
+ 65d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 661:	5d                   	pop    %rbp
+ 662:	c3                   	ret
+
+0000000000000663 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 663:	55                   	push   %rbp
+ 664:	48 89 e5             	mov    %rsp,%rbp
+ 667:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 66b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 66f:	eb 0a                	jmp    67b <strcmp+0x18>
+    p++, q++;
+ 671:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 676:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 67b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 67f:	0f b6 00             	movzbl (%rax),%eax
+ 682:	84 c0                	test   %al,%al
+ 684:	74 12                	je     698 <strcmp+0x35>
+ 686:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 68a:	0f b6 10             	movzbl (%rax),%edx
+ 68d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 691:	0f b6 00             	movzbl (%rax),%eax
+ 694:	38 c2                	cmp    %al,%dl
+ 696:	74 d9                	je     671 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 698:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 69c:	0f b6 00             	movzbl (%rax),%eax
+ 69f:	0f b6 d0             	movzbl %al,%edx
+ 6a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 6a6:	0f b6 00             	movzbl (%rax),%eax
+ 6a9:	0f b6 c0             	movzbl %al,%eax
+ 6ac:	29 c2                	sub    %eax,%edx
+ 6ae:	89 d0                	mov    %edx,%eax
+}
+ 6b0:	5d                   	pop    %rbp
+ 6b1:	c3                   	ret
+
+00000000000006b2 <strlen>:
+uint strlen(char *s) {
+ 6b2:	55                   	push   %rbp
+ 6b3:	48 89 e5             	mov    %rsp,%rbp
+ 6b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 6ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 6c1:	eb 04                	jmp    6c7 <strlen+0x15>
+ 6c3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 6c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6ca:	48 63 d0             	movslq %eax,%rdx
+ 6cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d1:	48 01 d0             	add    %rdx,%rax
+ 6d4:	0f b6 00             	movzbl (%rax),%eax
+ 6d7:	84 c0                	test   %al,%al
+ 6d9:	75 e8                	jne    6c3 <strlen+0x11>
+  return n;
+ 6db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 6de:	5d                   	pop    %rbp
+ 6df:	c3                   	ret
+
+00000000000006e0 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 6e0:	55                   	push   %rbp
+ 6e1:	48 89 e5             	mov    %rsp,%rbp
+ 6e4:	48 83 ec 10          	sub    $0x10,%rsp
+ 6e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6ec:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 6ef:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 6f2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6f5:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 6f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6fc:	89 ce                	mov    %ecx,%esi
+ 6fe:	48 89 c7             	mov    %rax,%rdi
+ 701:	e8 ec fe ff ff       	call   5f2 <stosb>
+  return dst;
+ 706:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+
+000000000000070c <strchr>:
+char *strchr(const char *s, char c) {
+ 70c:	55                   	push   %rbp
+ 70d:	48 89 e5             	mov    %rsp,%rbp
+ 710:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 714:	89 f0                	mov    %esi,%eax
+ 716:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 719:	eb 17                	jmp    732 <strchr+0x26>
+    if (*s == c)
+ 71b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 71f:	0f b6 00             	movzbl (%rax),%eax
+ 722:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 725:	75 06                	jne    72d <strchr+0x21>
+      return (char *)s;
+ 727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 72b:	eb 15                	jmp    742 <strchr+0x36>
+  for (; *s; s++)
+ 72d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 736:	0f b6 00             	movzbl (%rax),%eax
+ 739:	84 c0                	test   %al,%al
+ 73b:	75 de                	jne    71b <strchr+0xf>
+  return 0;
+ 73d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 742:	5d                   	pop    %rbp
+ 743:	c3                   	ret
+
+0000000000000744 <gets>:
+char *gets(char *buf, int max) {
+ 744:	55                   	push   %rbp
+ 745:	48 89 e5             	mov    %rsp,%rbp
+ 748:	48 83 ec 20          	sub    $0x20,%rsp
+ 74c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 750:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 753:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 75a:	eb 48                	jmp    7a4 <gets+0x60>
+    cc = read(0, &c, 1);
+ 75c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 760:	ba 01 00 00 00       	mov    $0x1,%edx
+ 765:	48 89 c6             	mov    %rax,%rsi
+ 768:	bf 00 00 00 00       	mov    $0x0,%edi
+ 76d:	e8 6f 01 00 00       	call   8e1 <read>
+ 772:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 775:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 779:	7e 36                	jle    7b1 <gets+0x6d>
+    buf[i++] = c;
+ 77b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 77e:	8d 50 01             	lea    0x1(%rax),%edx
+ 781:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 784:	48 63 d0             	movslq %eax,%rdx
+ 787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78b:	48 01 c2             	add    %rax,%rdx
+ 78e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 792:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 794:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 798:	3c 0a                	cmp    $0xa,%al
+ 79a:	74 16                	je     7b2 <gets+0x6e>
+ 79c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 7a0:	3c 0d                	cmp    $0xd,%al
+ 7a2:	74 0e                	je     7b2 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 7a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7a7:	83 c0 01             	add    $0x1,%eax
+ 7aa:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 7ad:	7f ad                	jg     75c <gets+0x18>
+ 7af:	eb 01                	jmp    7b2 <gets+0x6e>
+      break;
+ 7b1:	90                   	nop
+  }
+  buf[i] = '\0';
+ 7b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7b5:	48 63 d0             	movslq %eax,%rdx
+ 7b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7bc:	48 01 d0             	add    %rdx,%rax
+ 7bf:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 7c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 7c6:	c9                   	leave
+ 7c7:	c3                   	ret
+
+00000000000007c8 <stat>:
+
+int stat(char *n, struct stat *st) {
+ 7c8:	55                   	push   %rbp
+ 7c9:	48 89 e5             	mov    %rsp,%rbp
+ 7cc:	48 83 ec 20          	sub    $0x20,%rsp
+ 7d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7dc:	be 00 00 00 00       	mov    $0x0,%esi
+ 7e1:	48 89 c7             	mov    %rax,%rdi
+ 7e4:	e8 20 01 00 00       	call   909 <open>
+ 7e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 7ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7f0:	79 07                	jns    7f9 <stat+0x31>
+    return -1;
+ 7f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7f7:	eb 21                	jmp    81a <stat+0x52>
+  r = fstat(fd, st);
+ 7f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 7fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 800:	48 89 d6             	mov    %rdx,%rsi
+ 803:	89 c7                	mov    %eax,%edi
+ 805:	e8 17 01 00 00       	call   921 <fstat>
+ 80a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 80d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 810:	89 c7                	mov    %eax,%edi
+ 812:	e8 da 00 00 00       	call   8f1 <close>
+  return r;
+ 817:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 81a:	c9                   	leave
+ 81b:	c3                   	ret
+
+000000000000081c <atoi>:
+
+int atoi(const char *s) {
+ 81c:	55                   	push   %rbp
+ 81d:	48 89 e5             	mov    %rsp,%rbp
+ 820:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 824:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 82b:	eb 28                	jmp    855 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 82d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 830:	89 d0                	mov    %edx,%eax
+ 832:	c1 e0 02             	shl    $0x2,%eax
+ 835:	01 d0                	add    %edx,%eax
+ 837:	01 c0                	add    %eax,%eax
+ 839:	89 c1                	mov    %eax,%ecx
+ 83b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 83f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 843:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 847:	0f b6 00             	movzbl (%rax),%eax
+ 84a:	0f be c0             	movsbl %al,%eax
+ 84d:	01 c8                	add    %ecx,%eax
+ 84f:	83 e8 30             	sub    $0x30,%eax
+ 852:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 859:	0f b6 00             	movzbl (%rax),%eax
+ 85c:	3c 2f                	cmp    $0x2f,%al
+ 85e:	7e 0b                	jle    86b <atoi+0x4f>
+ 860:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 864:	0f b6 00             	movzbl (%rax),%eax
+ 867:	3c 39                	cmp    $0x39,%al
+ 869:	7e c2                	jle    82d <atoi+0x11>
+  return n;
+ 86b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 86e:	5d                   	pop    %rbp
+ 86f:	c3                   	ret
+
+0000000000000870 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 870:	55                   	push   %rbp
+ 871:	48 89 e5             	mov    %rsp,%rbp
+ 874:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 878:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 87c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 87f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 883:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 887:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 88b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 88f:	eb 1d                	jmp    8ae <memmove+0x3e>
+    *dst++ = *src++;
+ 891:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 895:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 899:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 89d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8a1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 8a5:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 8a9:	0f b6 12             	movzbl (%rdx),%edx
+ 8ac:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 8ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 8b1:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 8b4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 8b7:	85 c0                	test   %eax,%eax
+ 8b9:	7f d6                	jg     891 <memmove+0x21>
+  return vdst;
+ 8bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8bf:	5d                   	pop    %rbp
+ 8c0:	c3                   	ret
+
+00000000000008c1 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 8c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 8c6:	cd 40                	int    $0x40
+ 8c8:	c3                   	ret
+
+00000000000008c9 <exit>:
+SYSCALL(exit)
+ 8c9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8ce:	cd 40                	int    $0x40
+ 8d0:	c3                   	ret
+
+00000000000008d1 <wait>:
+SYSCALL(wait)
+ 8d1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 8d6:	cd 40                	int    $0x40
+ 8d8:	c3                   	ret
+
+00000000000008d9 <pipe>:
+SYSCALL(pipe)
+ 8d9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8de:	cd 40                	int    $0x40
+ 8e0:	c3                   	ret
+
+00000000000008e1 <read>:
+SYSCALL(read)
+ 8e1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8e6:	cd 40                	int    $0x40
+ 8e8:	c3                   	ret
+
+00000000000008e9 <write>:
+SYSCALL(write)
+ 8e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8ee:	cd 40                	int    $0x40
+ 8f0:	c3                   	ret
+
+00000000000008f1 <close>:
+SYSCALL(close)
+ 8f1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8f6:	cd 40                	int    $0x40
+ 8f8:	c3                   	ret
+
+00000000000008f9 <kill>:
+SYSCALL(kill)
+ 8f9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8fe:	cd 40                	int    $0x40
+ 900:	c3                   	ret
+
+0000000000000901 <exec>:
+SYSCALL(exec)
+ 901:	b8 07 00 00 00       	mov    $0x7,%eax
+ 906:	cd 40                	int    $0x40
+ 908:	c3                   	ret
+
+0000000000000909 <open>:
+SYSCALL(open)
+ 909:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 90e:	cd 40                	int    $0x40
+ 910:	c3                   	ret
+
+0000000000000911 <mknod>:
+SYSCALL(mknod)
+ 911:	b8 11 00 00 00       	mov    $0x11,%eax
+ 916:	cd 40                	int    $0x40
+ 918:	c3                   	ret
+
+0000000000000919 <unlink>:
+SYSCALL(unlink)
+ 919:	b8 12 00 00 00       	mov    $0x12,%eax
+ 91e:	cd 40                	int    $0x40
+ 920:	c3                   	ret
+
+0000000000000921 <fstat>:
+SYSCALL(fstat)
+ 921:	b8 08 00 00 00       	mov    $0x8,%eax
+ 926:	cd 40                	int    $0x40
+ 928:	c3                   	ret
+
+0000000000000929 <link>:
+SYSCALL(link)
+ 929:	b8 13 00 00 00       	mov    $0x13,%eax
+ 92e:	cd 40                	int    $0x40
+ 930:	c3                   	ret
+
+0000000000000931 <mkdir>:
+SYSCALL(mkdir)
+ 931:	b8 14 00 00 00       	mov    $0x14,%eax
+ 936:	cd 40                	int    $0x40
+ 938:	c3                   	ret
+
+0000000000000939 <chdir>:
+SYSCALL(chdir)
+ 939:	b8 09 00 00 00       	mov    $0x9,%eax
+ 93e:	cd 40                	int    $0x40
+ 940:	c3                   	ret
+
+0000000000000941 <dup>:
+SYSCALL(dup)
+ 941:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 946:	cd 40                	int    $0x40
+ 948:	c3                   	ret
+
+0000000000000949 <getpid>:
+SYSCALL(getpid)
+ 949:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 94e:	cd 40                	int    $0x40
+ 950:	c3                   	ret
+
+0000000000000951 <sbrk>:
+SYSCALL(sbrk)
+ 951:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 956:	cd 40                	int    $0x40
+ 958:	c3                   	ret
+
+0000000000000959 <sleep>:
+SYSCALL(sleep)
+ 959:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 95e:	cd 40                	int    $0x40
+ 960:	c3                   	ret
+
+0000000000000961 <uptime>:
+SYSCALL(uptime)
+ 961:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 966:	cd 40                	int    $0x40
+ 968:	c3                   	ret
+
+0000000000000969 <sysinfo>:
+SYSCALL(sysinfo)
+ 969:	b8 16 00 00 00       	mov    $0x16,%eax
+ 96e:	cd 40                	int    $0x40
+ 970:	c3                   	ret
+
+0000000000000971 <crashn>:
+SYSCALL(crashn)
+ 971:	b8 17 00 00 00       	mov    $0x17,%eax
+ 976:	cd 40                	int    $0x40
+ 978:	c3                   	ret
+
+0000000000000979 <mmap>:
+SYSCALL(mmap)
+ 979:	b8 18 00 00 00       	mov    $0x18,%eax
+ 97e:	cd 40                	int    $0x40
+ 980:	c3                   	ret
+
+0000000000000981 <munmap>:
+SYSCALL(munmap)
+ 981:	b8 19 00 00 00       	mov    $0x19,%eax
+ 986:	cd 40                	int    $0x40
+ 988:	c3                   	ret
+
+0000000000000989 <preface>:
+.globl preface
+preface:
+    call main
+ 989:	e8 72 f6 ff ff       	call   0 <main>
+    mov %rax, %rdi
+ 98e:	48 89 c7             	mov    %rax,%rdi
+    call exit
+ 991:	e8 33 ff ff ff       	call   8c9 <exit>
+
+0000000000000996 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 996:	55                   	push   %rbp
+ 997:	48 89 e5             	mov    %rsp,%rbp
+ 99a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 99e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 9a2:	48 83 e8 10          	sub    $0x10,%rax
+ 9a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9aa:	48 8b 05 5f 05 00 00 	mov    0x55f(%rip),%rax        # f10 <freep>
+ 9b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9b5:	eb 2f                	jmp    9e6 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9bb:	48 8b 00             	mov    (%rax),%rax
+ 9be:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9c2:	72 17                	jb     9db <free+0x45>
+ 9c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9c8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9cc:	72 2f                	jb     9fd <free+0x67>
+ 9ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d2:	48 8b 00             	mov    (%rax),%rax
+ 9d5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9d9:	72 22                	jb     9fd <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9df:	48 8b 00             	mov    (%rax),%rax
+ 9e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ea:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9ee:	73 c7                	jae    9b7 <free+0x21>
+ 9f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9f4:	48 8b 00             	mov    (%rax),%rax
+ 9f7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9fb:	73 ba                	jae    9b7 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 9fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a01:	8b 40 08             	mov    0x8(%rax),%eax
+ a04:	89 c0                	mov    %eax,%eax
+ a06:	48 c1 e0 04          	shl    $0x4,%rax
+ a0a:	48 89 c2             	mov    %rax,%rdx
+ a0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a11:	48 01 c2             	add    %rax,%rdx
+ a14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a18:	48 8b 00             	mov    (%rax),%rax
+ a1b:	48 39 c2             	cmp    %rax,%rdx
+ a1e:	75 2d                	jne    a4d <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ a20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a24:	8b 50 08             	mov    0x8(%rax),%edx
+ a27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a2b:	48 8b 00             	mov    (%rax),%rax
+ a2e:	8b 40 08             	mov    0x8(%rax),%eax
+ a31:	01 c2                	add    %eax,%edx
+ a33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a37:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a3e:	48 8b 00             	mov    (%rax),%rax
+ a41:	48 8b 10             	mov    (%rax),%rdx
+ a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a48:	48 89 10             	mov    %rdx,(%rax)
+ a4b:	eb 0e                	jmp    a5b <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a51:	48 8b 10             	mov    (%rax),%rdx
+ a54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a58:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5f:	8b 40 08             	mov    0x8(%rax),%eax
+ a62:	89 c0                	mov    %eax,%eax
+ a64:	48 c1 e0 04          	shl    $0x4,%rax
+ a68:	48 89 c2             	mov    %rax,%rdx
+ a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6f:	48 01 d0             	add    %rdx,%rax
+ a72:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a76:	75 27                	jne    a9f <free+0x109>
+    p->s.size += bp->s.size;
+ a78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a7c:	8b 50 08             	mov    0x8(%rax),%edx
+ a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a83:	8b 40 08             	mov    0x8(%rax),%eax
+ a86:	01 c2                	add    %eax,%edx
+ a88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a8c:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a93:	48 8b 10             	mov    (%rax),%rdx
+ a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a9a:	48 89 10             	mov    %rdx,(%rax)
+ a9d:	eb 0b                	jmp    aaa <free+0x114>
+  } else
+    p->s.ptr = bp;
+ a9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aa3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ aa7:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ aaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aae:	48 89 05 5b 04 00 00 	mov    %rax,0x45b(%rip)        # f10 <freep>
+}
+ ab5:	90                   	nop
+ ab6:	5d                   	pop    %rbp
+ ab7:	c3                   	ret
+
+0000000000000ab8 <morecore>:
+
+static Header *morecore(uint nu) {
+ ab8:	55                   	push   %rbp
+ ab9:	48 89 e5             	mov    %rsp,%rbp
+ abc:	48 83 ec 20          	sub    $0x20,%rsp
+ ac0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ ac3:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ aca:	77 07                	ja     ad3 <morecore+0x1b>
+    nu = 4096;
+ acc:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ ad3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ad6:	c1 e0 04             	shl    $0x4,%eax
+ ad9:	89 c7                	mov    %eax,%edi
+ adb:	e8 71 fe ff ff       	call   951 <sbrk>
+ ae0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ ae4:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ ae9:	75 07                	jne    af2 <morecore+0x3a>
+    return 0;
+ aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+ af0:	eb 29                	jmp    b1b <morecore+0x63>
+  hp = (Header *)p;
+ af2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ af6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ afa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ afe:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b01:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b08:	48 83 c0 10          	add    $0x10,%rax
+ b0c:	48 89 c7             	mov    %rax,%rdi
+ b0f:	e8 82 fe ff ff       	call   996 <free>
+  return freep;
+ b14:	48 8b 05 f5 03 00 00 	mov    0x3f5(%rip),%rax        # f10 <freep>
+}
+ b1b:	c9                   	leave
+ b1c:	c3                   	ret
+
+0000000000000b1d <malloc>:
+
+void *malloc(uint nbytes) {
+ b1d:	55                   	push   %rbp
+ b1e:	48 89 e5             	mov    %rsp,%rbp
+ b21:	48 83 ec 30          	sub    $0x30,%rsp
+ b25:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ b28:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b2b:	48 83 c0 0f          	add    $0xf,%rax
+ b2f:	48 c1 e8 04          	shr    $0x4,%rax
+ b33:	83 c0 01             	add    $0x1,%eax
+ b36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ b39:	48 8b 05 d0 03 00 00 	mov    0x3d0(%rip),%rax        # f10 <freep>
+ b40:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b44:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b49:	75 2e                	jne    b79 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ b4b:	48 8d 05 ae 03 00 00 	lea    0x3ae(%rip),%rax        # f00 <base>
+ b52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b5a:	48 89 05 af 03 00 00 	mov    %rax,0x3af(%rip)        # f10 <freep>
+ b61:	48 8b 05 a8 03 00 00 	mov    0x3a8(%rip),%rax        # f10 <freep>
+ b68:	48 89 05 91 03 00 00 	mov    %rax,0x391(%rip)        # f00 <base>
+    base.s.size = 0;
+ b6f:	c7 05 8f 03 00 00 00 	movl   $0x0,0x38f(%rip)        # f08 <base+0x8>
+ b76:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b7d:	48 8b 00             	mov    (%rax),%rax
+ b80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b88:	8b 40 08             	mov    0x8(%rax),%eax
+ b8b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ b8e:	72 5f                	jb     bef <malloc+0xd2>
+      if (p->s.size == nunits)
+ b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b94:	8b 40 08             	mov    0x8(%rax),%eax
+ b97:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ b9a:	75 10                	jne    bac <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ b9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba0:	48 8b 10             	mov    (%rax),%rdx
+ ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba7:	48 89 10             	mov    %rdx,(%rax)
+ baa:	eb 2e                	jmp    bda <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ bac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bb0:	8b 40 08             	mov    0x8(%rax),%eax
+ bb3:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ bb6:	89 c2                	mov    %eax,%edx
+ bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bbc:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ bbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc3:	8b 40 08             	mov    0x8(%rax),%eax
+ bc6:	89 c0                	mov    %eax,%eax
+ bc8:	48 c1 e0 04          	shl    $0x4,%rax
+ bcc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ bd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bd7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bde:	48 89 05 2b 03 00 00 	mov    %rax,0x32b(%rip)        # f10 <freep>
+      return (void *)(p + 1);
+ be5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be9:	48 83 c0 10          	add    $0x10,%rax
+ bed:	eb 41                	jmp    c30 <malloc+0x113>
+    }
+    if (p == freep)
+ bef:	48 8b 05 1a 03 00 00 	mov    0x31a(%rip),%rax        # f10 <freep>
+ bf6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bfa:	75 1c                	jne    c18 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ bfc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ bff:	89 c7                	mov    %eax,%edi
+ c01:	e8 b2 fe ff ff       	call   ab8 <morecore>
+ c06:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c0a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ c0f:	75 07                	jne    c18 <malloc+0xfb>
+        return 0;
+ c11:	b8 00 00 00 00       	mov    $0x0,%eax
+ c16:	eb 18                	jmp    c30 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ c18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c1c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c24:	48 8b 00             	mov    (%rax),%rax
+ c27:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ c2b:	e9 54 ff ff ff       	jmp    b84 <malloc+0x67>
+  }
+ c30:	c9                   	leave
+ c31:	c3                   	ret
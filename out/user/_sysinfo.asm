@@ -0,0 +1,1352 @@
+
+out/user/_sysinfo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <fs.h>
+#include <stat.h>
+#include <sysinfo.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 60          	sub    $0x60,%rsp
+   8:	89 7d ac             	mov    %edi,-0x54(%rbp)
+   b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  struct sys_info info;
+  sysinfo(&info);
+   f:	48 8d 45 b4          	lea    -0x4c(%rbp),%rax
+  13:	48 89 c7             	mov    %rax,%rdi
+  16:	e8 20 09 00 00       	call   93b <sysinfo>
+
+  printf(1, "pages_in_use = %d\n", info.pages_in_use);
+  1b:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  1e:	89 c2                	mov    %eax,%edx
+  20:	48 8d 05 dd 0b 00 00 	lea    0xbdd(%rip),%rax        # c04 <malloc+0x115>
+  27:	48 89 c6             	mov    %rax,%rsi
+  2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  34:	e8 bb 02 00 00       	call   2f4 <printf>
+  printf(1, "pages_in_swap = %d\n", info.pages_in_swap);
+  39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  3c:	89 c2                	mov    %eax,%edx
+  3e:	48 8d 05 d2 0b 00 00 	lea    0xbd2(%rip),%rax        # c17 <malloc+0x128>
+  45:	48 89 c6             	mov    %rax,%rsi
+  48:	bf 01 00 00 00       	mov    $0x1,%edi
+  4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  52:	e8 9d 02 00 00       	call   2f4 <printf>
+  printf(1, "free_pages = %d\n", info.free_pages);
+  57:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  5a:	89 c2                	mov    %eax,%edx
+  5c:	48 8d 05 c8 0b 00 00 	lea    0xbc8(%rip),%rax        # c2b <malloc+0x13c>
+  63:	48 89 c6             	mov    %rax,%rsi
+  66:	bf 01 00 00 00       	mov    $0x1,%edi
+  6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  70:	e8 7f 02 00 00       	call   2f4 <printf>
+  printf(1, "num_page_faults = %d\n", info.num_page_faults);
+  75:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  78:	89 c2                	mov    %eax,%edx
+  7a:	48 8d 05 bb 0b 00 00 	lea    0xbbb(%rip),%rax        # c3c <malloc+0x14d>
+  81:	48 89 c6             	mov    %rax,%rsi
+  84:	bf 01 00 00 00       	mov    $0x1,%edi
+  89:	b8 00 00 00 00       	mov    $0x0,%eax
+  8e:	e8 61 02 00 00       	call   2f4 <printf>
+  printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  93:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  96:	89 c2                	mov    %eax,%edx
+  98:	48 8d 05 b3 0b 00 00 	lea    0xbb3(%rip),%rax        # c52 <malloc+0x163>
+  9f:	48 89 c6             	mov    %rax,%rsi
+  a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  ac:	e8 43 02 00 00       	call   2f4 <printf>
+  printf(1, "num_bcache_hits = %d\n", info.num_bcache_hits);
+  b1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  b4:	89 c2                	mov    %eax,%edx
+  b6:	48 8d 05 aa 0b 00 00 	lea    0xbaa(%rip),%rax        # c67 <malloc+0x178>
+  bd:	48 89 c6             	mov    %rax,%rsi
+  c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  ca:	e8 25 02 00 00       	call   2f4 <printf>
+  printf(1, "num_bcache_misses = %d\n", info.num_bcache_misses);
+  cf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  d2:	89 c2                	mov    %eax,%edx
+  d4:	48 8d 05 a2 0b 00 00 	lea    0xba2(%rip),%rax        # c7d <malloc+0x18e>
+  db:	48 89 c6             	mov    %rax,%rsi
+  de:	bf 01 00 00 00       	mov    $0x1,%edi
+  e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  e8:	e8 07 02 00 00       	call   2f4 <printf>
+  for (int i = 0; i < NORDER; i++)
+  ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  f4:	eb 31                	jmp    127 <main+0x127>
+    printf(1, "free_blocks[%d] = %d\n", i, info.free_blocks[i]);
+  f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  f9:	48 98                	cltq
+  fb:	48 83 c0 04          	add    $0x4,%rax
+  ff:	8b 54 85 c0          	mov    -0x40(%rbp,%rax,4),%edx
+ 103:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 106:	89 d1                	mov    %edx,%ecx
+ 108:	89 c2                	mov    %eax,%edx
+ 10a:	48 8d 05 84 0b 00 00 	lea    0xb84(%rip),%rax        # c95 <malloc+0x1a6>
+ 111:	48 89 c6             	mov    %rax,%rsi
+ 114:	bf 01 00 00 00       	mov    $0x1,%edi
+ 119:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11e:	e8 d1 01 00 00       	call   2f4 <printf>
+  for (int i = 0; i < NORDER; i++)
+ 123:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 127:	83 7d fc 0a          	cmpl   $0xa,-0x4(%rbp)
+ 12b:	7e c9                	jle    f6 <main+0xf6>
+
+  exit();
+ 12d:	e8 69 07 00 00       	call   89b <exit>
+
+0000000000000132 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 132:	55                   	push   %rbp
+ 133:	48 89 e5             	mov    %rsp,%rbp
+ 136:	48 83 ec 10          	sub    $0x10,%rsp
+ 13a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 13d:	89 f0                	mov    %esi,%eax
+ 13f:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 142:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 146:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 149:	ba 01 00 00 00       	mov    $0x1,%edx
+ 14e:	48 89 ce             	mov    %rcx,%rsi
+ 151:	89 c7                	mov    %eax,%edi
+ 153:	e8 63 07 00 00       	call   8bb <write>
+ 158:	90                   	nop
+ 159:	c9                   	leave
+ 15a:	c3                   	ret
+
+000000000000015b <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 15b:	55                   	push   %rbp
+ 15c:	48 89 e5             	mov    %rsp,%rbp
+ 15f:	48 83 ec 40          	sub    $0x40,%rsp
+ 163:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 166:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 169:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 16c:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 16f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 173:	74 1f                	je     194 <printint64+0x39>
+ 175:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 178:	c1 e8 1f             	shr    $0x1f,%eax
+ 17b:	0f b6 c0             	movzbl %al,%eax
+ 17e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 181:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 185:	74 0d                	je     194 <printint64+0x39>
+    x = -xx;
+ 187:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 18a:	f7 d8                	neg    %eax
+ 18c:	48 98                	cltq
+ 18e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 192:	eb 09                	jmp    19d <printint64+0x42>
+  else
+    x = xx;
+ 194:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 197:	48 98                	cltq
+ 199:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 19d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 1a4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1a7:	48 63 c8             	movslq %eax,%rcx
+ 1aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1ae:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1b3:	48 f7 f1             	div    %rcx
+ 1b6:	48 89 d1             	mov    %rdx,%rcx
+ 1b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1bc:	8d 50 01             	lea    0x1(%rax),%edx
+ 1bf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1c2:	48 8d 15 47 0d 00 00 	lea    0xd47(%rip),%rdx        # f10 <digits.1>
+ 1c9:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1cd:	48 98                	cltq
+ 1cf:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 1d3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1d6:	48 63 f0             	movslq %eax,%rsi
+ 1d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1dd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1e2:	48 f7 f6             	div    %rsi
+ 1e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 1e9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 1ee:	75 b4                	jne    1a4 <printint64+0x49>
+
+  if (sgn)
+ 1f0:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1f4:	74 2b                	je     221 <printint64+0xc6>
+    buf[i++] = '-';
+ 1f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f9:	8d 50 01             	lea    0x1(%rax),%edx
+ 1fc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ff:	48 98                	cltq
+ 201:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 206:	eb 19                	jmp    221 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 208:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 20b:	48 98                	cltq
+ 20d:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 212:	0f be d0             	movsbl %al,%edx
+ 215:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 218:	89 d6                	mov    %edx,%esi
+ 21a:	89 c7                	mov    %eax,%edi
+ 21c:	e8 11 ff ff ff       	call   132 <putc>
+  while (--i >= 0)
+ 221:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 225:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 229:	79 dd                	jns    208 <printint64+0xad>
+}
+ 22b:	90                   	nop
+ 22c:	90                   	nop
+ 22d:	c9                   	leave
+ 22e:	c3                   	ret
+
+000000000000022f <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 22f:	55                   	push   %rbp
+ 230:	48 89 e5             	mov    %rsp,%rbp
+ 233:	48 83 ec 30          	sub    $0x30,%rsp
+ 237:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 23a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 23d:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 240:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 243:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 24a:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 24e:	74 17                	je     267 <printint+0x38>
+ 250:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 254:	79 11                	jns    267 <printint+0x38>
+    neg = 1;
+ 256:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 25d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 260:	f7 d8                	neg    %eax
+ 262:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 265:	eb 06                	jmp    26d <printint+0x3e>
+  } else {
+    x = xx;
+ 267:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 26a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 26d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 274:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 277:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 27a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 27f:	f7 f1                	div    %ecx
+ 281:	89 d1                	mov    %edx,%ecx
+ 283:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 286:	8d 50 01             	lea    0x1(%rax),%edx
+ 289:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 28c:	89 c9                	mov    %ecx,%ecx
+ 28e:	48 8d 15 9b 0c 00 00 	lea    0xc9b(%rip),%rdx        # f30 <digits.0>
+ 295:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 299:	48 98                	cltq
+ 29b:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 29f:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 2a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2a5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2aa:	f7 f6                	div    %esi
+ 2ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 2af:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 2b3:	75 bf                	jne    274 <printint+0x45>
+  if (neg)
+ 2b5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 2b9:	74 2b                	je     2e6 <printint+0xb7>
+    buf[i++] = '-';
+ 2bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2be:	8d 50 01             	lea    0x1(%rax),%edx
+ 2c1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2c4:	48 98                	cltq
+ 2c6:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 2cb:	eb 19                	jmp    2e6 <printint+0xb7>
+    putc(fd, buf[i]);
+ 2cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2d0:	48 98                	cltq
+ 2d2:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 2d7:	0f be d0             	movsbl %al,%edx
+ 2da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 2dd:	89 d6                	mov    %edx,%esi
+ 2df:	89 c7                	mov    %eax,%edi
+ 2e1:	e8 4c fe ff ff       	call   132 <putc>
+  while (--i >= 0)
+ 2e6:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 2ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2ee:	79 dd                	jns    2cd <printint+0x9e>
+}
+ 2f0:	90                   	nop
+ 2f1:	90                   	nop
+ 2f2:	c9                   	leave
+ 2f3:	c3                   	ret
+
+00000000000002f4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 2f4:	55                   	push   %rbp
+ 2f5:	48 89 e5             	mov    %rsp,%rbp
+ 2f8:	48 83 ec 70          	sub    $0x70,%rsp
+ 2fc:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 2ff:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 303:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 307:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 30b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 30f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 313:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 31a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 31e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 322:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 326:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 32a:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 331:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 338:	e9 6b 02 00 00       	jmp    5a8 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 33d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 340:	48 63 d0             	movslq %eax,%rdx
+ 343:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 347:	48 01 d0             	add    %rdx,%rax
+ 34a:	0f b6 00             	movzbl (%rax),%eax
+ 34d:	0f be c0             	movsbl %al,%eax
+ 350:	25 ff 00 00 00       	and    $0xff,%eax
+ 355:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 358:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 35c:	75 30                	jne    38e <printf+0x9a>
+      if (c == '%') {
+ 35e:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 362:	75 13                	jne    377 <printf+0x83>
+        state = '%';
+ 364:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 36b:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 372:	e9 2d 02 00 00       	jmp    5a4 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 377:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 37a:	0f be d0             	movsbl %al,%edx
+ 37d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 380:	89 d6                	mov    %edx,%esi
+ 382:	89 c7                	mov    %eax,%edi
+ 384:	e8 a9 fd ff ff       	call   132 <putc>
+ 389:	e9 16 02 00 00       	jmp    5a4 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 38e:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 392:	0f 85 0c 02 00 00    	jne    5a4 <printf+0x2b0>
+      if (c == 'l') {
+ 398:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 39c:	75 0c                	jne    3aa <printf+0xb6>
+        lflag = 1;
+ 39e:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 3a5:	e9 fa 01 00 00       	jmp    5a4 <printf+0x2b0>
+      } else if (c == 'd') {
+ 3aa:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 3ae:	0f 85 95 00 00 00    	jne    449 <printf+0x155>
+        if (lflag == 1)
+ 3b4:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3b8:	75 49                	jne    403 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 3ba:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3bd:	83 f8 2f             	cmp    $0x2f,%eax
+ 3c0:	77 17                	ja     3d9 <printf+0xe5>
+ 3c2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3c6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3c9:	89 d2                	mov    %edx,%edx
+ 3cb:	48 01 d0             	add    %rdx,%rax
+ 3ce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3d1:	83 c2 08             	add    $0x8,%edx
+ 3d4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3d7:	eb 0c                	jmp    3e5 <printf+0xf1>
+ 3d9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3dd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3e1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3e5:	48 8b 00             	mov    (%rax),%rax
+ 3e8:	89 c6                	mov    %eax,%esi
+ 3ea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3f2:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3f7:	89 c7                	mov    %eax,%edi
+ 3f9:	e8 5d fd ff ff       	call   15b <printint64>
+ 3fe:	e9 9a 01 00 00       	jmp    59d <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 403:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 406:	83 f8 2f             	cmp    $0x2f,%eax
+ 409:	77 17                	ja     422 <printf+0x12e>
+ 40b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 40f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 412:	89 d2                	mov    %edx,%edx
+ 414:	48 01 d0             	add    %rdx,%rax
+ 417:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 41a:	83 c2 08             	add    $0x8,%edx
+ 41d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 420:	eb 0c                	jmp    42e <printf+0x13a>
+ 422:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 426:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 42a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 42e:	8b 30                	mov    (%rax),%esi
+ 430:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 433:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 438:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 43d:	89 c7                	mov    %eax,%edi
+ 43f:	e8 eb fd ff ff       	call   22f <printint>
+ 444:	e9 54 01 00 00       	jmp    59d <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 449:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 44d:	74 0a                	je     459 <printf+0x165>
+ 44f:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 453:	0f 85 95 00 00 00    	jne    4ee <printf+0x1fa>
+        if (lflag == 1)
+ 459:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 45d:	75 49                	jne    4a8 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 45f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 462:	83 f8 2f             	cmp    $0x2f,%eax
+ 465:	77 17                	ja     47e <printf+0x18a>
+ 467:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 46b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 46e:	89 d2                	mov    %edx,%edx
+ 470:	48 01 d0             	add    %rdx,%rax
+ 473:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 476:	83 c2 08             	add    $0x8,%edx
+ 479:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 47c:	eb 0c                	jmp    48a <printf+0x196>
+ 47e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 482:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 486:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 48a:	48 8b 00             	mov    (%rax),%rax
+ 48d:	89 c6                	mov    %eax,%esi
+ 48f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 492:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 497:	ba 10 00 00 00       	mov    $0x10,%edx
+ 49c:	89 c7                	mov    %eax,%edi
+ 49e:	e8 b8 fc ff ff       	call   15b <printint64>
+        if (lflag == 1)
+ 4a3:	e9 f5 00 00 00       	jmp    59d <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 4a8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4ab:	83 f8 2f             	cmp    $0x2f,%eax
+ 4ae:	77 17                	ja     4c7 <printf+0x1d3>
+ 4b0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4b4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4b7:	89 d2                	mov    %edx,%edx
+ 4b9:	48 01 d0             	add    %rdx,%rax
+ 4bc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4bf:	83 c2 08             	add    $0x8,%edx
+ 4c2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4c5:	eb 0c                	jmp    4d3 <printf+0x1df>
+ 4c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4cb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4cf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4d3:	8b 30                	mov    (%rax),%esi
+ 4d5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4dd:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4e2:	89 c7                	mov    %eax,%edi
+ 4e4:	e8 46 fd ff ff       	call   22f <printint>
+        if (lflag == 1)
+ 4e9:	e9 af 00 00 00       	jmp    59d <printf+0x2a9>
+      } else if (c == 's') {
+ 4ee:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 4f2:	75 6e                	jne    562 <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 4f4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4f7:	83 f8 2f             	cmp    $0x2f,%eax
+ 4fa:	77 17                	ja     513 <printf+0x21f>
+ 4fc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 500:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 503:	89 d2                	mov    %edx,%edx
+ 505:	48 01 d0             	add    %rdx,%rax
+ 508:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 50b:	83 c2 08             	add    $0x8,%edx
+ 50e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 511:	eb 0c                	jmp    51f <printf+0x22b>
+ 513:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 517:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 51b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 51f:	48 8b 00             	mov    (%rax),%rax
+ 522:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 526:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 52b:	75 28                	jne    555 <printf+0x261>
+          s = "(null)";
+ 52d:	48 8d 05 77 07 00 00 	lea    0x777(%rip),%rax        # cab <malloc+0x1bc>
+ 534:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 538:	eb 1b                	jmp    555 <printf+0x261>
+          putc(fd, *s);
+ 53a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 53e:	0f b6 00             	movzbl (%rax),%eax
+ 541:	0f be d0             	movsbl %al,%edx
+ 544:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 547:	89 d6                	mov    %edx,%esi
+ 549:	89 c7                	mov    %eax,%edi
+ 54b:	e8 e2 fb ff ff       	call   132 <putc>
+        for (; *s; s++)
+ 550:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 555:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 559:	0f b6 00             	movzbl (%rax),%eax
+ 55c:	84 c0                	test   %al,%al
+ 55e:	75 da                	jne    53a <printf+0x246>
+ 560:	eb 3b                	jmp    59d <printf+0x2a9>
+      } else if (c == '%') {
+ 562:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 566:	75 14                	jne    57c <printf+0x288>
+        putc(fd, c);
+ 568:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 56b:	0f be d0             	movsbl %al,%edx
+ 56e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 571:	89 d6                	mov    %edx,%esi
+ 573:	89 c7                	mov    %eax,%edi
+ 575:	e8 b8 fb ff ff       	call   132 <putc>
+ 57a:	eb 21                	jmp    59d <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 57c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 57f:	be 25 00 00 00       	mov    $0x25,%esi
+ 584:	89 c7                	mov    %eax,%edi
+ 586:	e8 a7 fb ff ff       	call   132 <putc>
+        putc(fd, c);
+ 58b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 58e:	0f be d0             	movsbl %al,%edx
+ 591:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 594:	89 d6                	mov    %edx,%esi
+ 596:	89 c7                	mov    %eax,%edi
+ 598:	e8 95 fb ff ff       	call   132 <putc>
+      }
+      state = 0;
+ 59d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 5a4:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 5a8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5ab:	48 63 d0             	movslq %eax,%rdx
+ 5ae:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5b2:	48 01 d0             	add    %rdx,%rax
+ 5b5:	0f b6 00             	movzbl (%rax),%eax
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	0f 85 7d fd ff ff    	jne    33d <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 5c0:	90                   	nop
+ 5c1:	90                   	nop
+ 5c2:	c9                   	leave
+ 5c3:	c3                   	ret
+
+00000000000005c4 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+ 5c4:	55                   	push   %rbp
+ 5c5:	48 89 e5             	mov    %rsp,%rbp
+ 5c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5cf:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+ 5d2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 5d6:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 5d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 5dc:	48 89 ce             	mov    %rcx,%rsi
+ 5df:	48 89 f7             	mov    %rsi,%rdi
+ 5e2:	89 d1                	mov    %edx,%ecx
+ 5e4:	fc                   	cld
+ 5e5:	f3 aa                	rep stos %al,%es:(%rdi)
+ 5e7:	89 ca                	mov    %ecx,%edx
+ 5e9:	48 89 fe             	mov    %rdi,%rsi
+ 5ec:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 5f0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+ 5f3:	90                   	nop
+ 5f4:	5d                   	pop    %rbp
+ 5f5:	c3                   	ret
+
+00000000000005f6 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 5f6:	55                   	push   %rbp
+ 5f7:	48 89 e5             	mov    %rsp,%rbp
+ 5fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 5fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 602:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 606:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 60a:	90                   	nop
+ 60b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 60f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 613:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 617:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 61b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 61f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 623:	0f b6 12             	movzbl (%rdx),%edx
+ 626:	88 10                	mov    %dl,(%rax)
+ 628:	0f b6 00             	movzbl (%rax),%eax
+ 62b:	84 c0                	test   %al,%al
+ 62d:	75 dc                	jne    60b <strcpy+0x15>
+  return os;
+ 62f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 633:	5d                   	pop    %rbp
+ 634:	c3                   	ret
+
+0000000000000635 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 635:	55                   	push   %rbp
+ 636:	48 89 e5             	mov    %rsp,%rbp
+ 639:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 63d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 641:	eb 0a                	jmp    64d <strcmp+0x18>
+    p++, q++;
+ 643:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 648:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 64d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 651:	0f b6 00             	movzbl (%rax),%eax
+ 654:	84 c0                	test   %al,%al
+ 656:	74 12                	je     66a <strcmp+0x35>
+ 658:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 65c:	0f b6 10             	movzbl (%rax),%edx
+ 65f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 663:	0f b6 00             	movzbl (%rax),%eax
+ 666:	38 c2                	cmp    %al,%dl
+ 668:	74 d9                	je     643 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 66a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 66e:	0f b6 00             	movzbl (%rax),%eax
+ 671:	0f b6 d0             	movzbl %al,%edx
+ 674:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 678:	0f b6 00             	movzbl (%rax),%eax
+ 67b:	0f b6 c0             	movzbl %al,%eax
+ 67e:	29 c2                	sub    %eax,%edx
+ 680:	89 d0                	mov    %edx,%eax
+}
+ 682:	5d                   	pop    %rbp
+ 683:	c3                   	ret
+
+0000000000000684 <strlen>:
+uint strlen(char *s) {
+ 684:	55                   	push   %rbp
+ 685:	48 89 e5             	mov    %rsp,%rbp
+ 688:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 68c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 693:	eb 04                	jmp    699 <strlen+0x15>
+ 695:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 699:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 69c:	48 63 d0             	movslq %eax,%rdx
+ 69f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6a3:	48 01 d0             	add    %rdx,%rax
+ 6a6:	0f b6 00             	movzbl (%rax),%eax
+ 6a9:	84 c0                	test   %al,%al
+ 6ab:	75 e8                	jne    695 <strlen+0x11>
+  return n;
+ 6ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 6b0:	5d                   	pop    %rbp
+ 6b1:	c3                   	ret
+
+00000000000006b2 <memset>:
+void *memset(void *dst, int c, uint n) {
+ 6b2:	55                   	push   %rbp
+ 6b3:	48 89 e5             	mov    %rsp,%rbp
+ 6b6:	48 83 ec 10          	sub    $0x10,%rsp
+ 6ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6be:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 6c1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 6c4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6c7:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 6ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6ce:	89 ce                	mov    %ecx,%esi
+ 6d0:	48 89 c7             	mov    %rax,%rdi
+ 6d3:	e8 ec fe ff ff       	call   5c4 <stosb>
+  return dst;
+ 6d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6dc:	c9                   	leave
+ 6dd:	c3                   	ret
+
+00000000000006de <strchr>:
+char *strchr(const char *s, char c) {
+ 6de:	55                   	push   %rbp
+ 6df:	48 89 e5             	mov    %rsp,%rbp
+ 6e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6e6:	89 f0                	mov    %esi,%eax
+ 6e8:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 6eb:	eb 17                	jmp    704 <strchr+0x26>
+    if (*s == c)
+ 6ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6f1:	0f b6 00             	movzbl (%rax),%eax
+ 6f4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 6f7:	75 06                	jne    6ff <strchr+0x21>
+      return (char *)s;
+ 6f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6fd:	eb 15                	jmp    714 <strchr+0x36>
+  for (; *s; s++)
+ 6ff:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 704:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 708:	0f b6 00             	movzbl (%rax),%eax
+ 70b:	84 c0                	test   %al,%al
+ 70d:	75 de                	jne    6ed <strchr+0xf>
+  return 0;
+ 70f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 714:	5d                   	pop    %rbp
+ 715:	c3                   	ret
+
+0000000000000716 <gets>:
+char *gets(char *buf, int max) {
+ 716:	55                   	push   %rbp
+ 717:	48 89 e5             	mov    %rsp,%rbp
+ 71a:	48 83 ec 20          	sub    $0x20,%rsp
+ 71e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 722:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 725:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 72c:	eb 48                	jmp    776 <gets+0x60>
+    cc = read(0, &c, 1);
+ 72e:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 732:	ba 01 00 00 00       	mov    $0x1,%edx
+ 737:	48 89 c6             	mov    %rax,%rsi
+ 73a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 73f:	e8 6f 01 00 00       	call   8b3 <read>
+ 744:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 747:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 74b:	7e 36                	jle    783 <gets+0x6d>
+    buf[i++] = c;
+ 74d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 750:	8d 50 01             	lea    0x1(%rax),%edx
+ 753:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 756:	48 63 d0             	movslq %eax,%rdx
+ 759:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 75d:	48 01 c2             	add    %rax,%rdx
+ 760:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 764:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 766:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 76a:	3c 0a                	cmp    $0xa,%al
+ 76c:	74 16                	je     784 <gets+0x6e>
+ 76e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 772:	3c 0d                	cmp    $0xd,%al
+ 774:	74 0e                	je     784 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 776:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 779:	83 c0 01             	add    $0x1,%eax
+ 77c:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 77f:	7f ad                	jg     72e <gets+0x18>
+ 781:	eb 01                	jmp    784 <gets+0x6e>
+      break;
+ 783:	90                   	nop
+  }
+  buf[i] = '\0';
+ 784:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 787:	48 63 d0             	movslq %eax,%rdx
+ 78a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78e:	48 01 d0             	add    %rdx,%rax
+ 791:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 794:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 798:	c9                   	leave
+ 799:	c3                   	ret
+
+000000000000079a <stat>:
+
+int stat(char *n, struct stat *st) {
+ 79a:	55                   	push   %rbp
+ 79b:	48 89 e5             	mov    %rsp,%rbp
+ 79e:	48 83 ec 20          	sub    $0x20,%rsp
+ 7a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7ae:	be 00 00 00 00       	mov    $0x0,%esi
+ 7b3:	48 89 c7             	mov    %rax,%rdi
+ 7b6:	e8 20 01 00 00       	call   8db <open>
+ 7bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 7be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7c2:	79 07                	jns    7cb <stat+0x31>
+    return -1;
+ 7c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7c9:	eb 21                	jmp    7ec <stat+0x52>
+  r = fstat(fd, st);
+ 7cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 7cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7d2:	48 89 d6             	mov    %rdx,%rsi
+ 7d5:	89 c7                	mov    %eax,%edi
+ 7d7:	e8 17 01 00 00       	call   8f3 <fstat>
+ 7dc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 7df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7e2:	89 c7                	mov    %eax,%edi
+ 7e4:	e8 da 00 00 00       	call   8c3 <close>
+  return r;
+ 7e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 7ec:	c9                   	leave
+ 7ed:	c3                   	ret
+
+00000000000007ee <atoi>:
+
+int atoi(const char *s) {
+ 7ee:	55                   	push   %rbp
+ 7ef:	48 89 e5             	mov    %rsp,%rbp
+ 7f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 7f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 7fd:	eb 28                	jmp    827 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 7ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 802:	89 d0                	mov    %edx,%eax
+ 804:	c1 e0 02             	shl    $0x2,%eax
+ 807:	01 d0                	add    %edx,%eax
+ 809:	01 c0                	add    %eax,%eax
+ 80b:	89 c1                	mov    %eax,%ecx
+ 80d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 811:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 815:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 819:	0f b6 00             	movzbl (%rax),%eax
+ 81c:	0f be c0             	movsbl %al,%eax
+ 81f:	01 c8                	add    %ecx,%eax
+ 821:	83 e8 30             	sub    $0x30,%eax
+ 824:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 827:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 82b:	0f b6 00             	movzbl (%rax),%eax
+ 82e:	3c 2f                	cmp    $0x2f,%al
+ 830:	7e 0b                	jle    83d <atoi+0x4f>
+ 832:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 836:	0f b6 00             	movzbl (%rax),%eax
+ 839:	3c 39                	cmp    $0x39,%al
+ 83b:	7e c2                	jle    7ff <atoi+0x11>
+  return n;
+ 83d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 840:	5d                   	pop    %rbp
+ 841:	c3                   	ret
+
+0000000000000842 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 842:	55                   	push   %rbp
+ 843:	48 89 e5             	mov    %rsp,%rbp
+ 846:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 84a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 84e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 855:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 859:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 85d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 861:	eb 1d                	jmp    880 <memmove+0x3e>
+    *dst++ = *src++;
+ 863:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 867:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 86b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 86f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 873:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 877:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 87b:	0f b6 12             	movzbl (%rdx),%edx
+ 87e:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 880:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 883:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 886:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 889:	85 c0                	test   %eax,%eax
+ 88b:	7f d6                	jg     863 <memmove+0x21>
+  return vdst;
+ 88d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 891:	5d                   	pop    %rbp
+ 892:	c3                   	ret
+
+0000000000000893 <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 893:	b8 01 00 00 00       	mov    $0x1,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+000000000000089b <exit>:
+SYSCALL(exit)
+ 89b:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+00000000000008a3 <wait>:
+SYSCALL(wait)
+ 8a3:	b8 03 00 00 00       	mov    $0x3,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+00000000000008ab <pipe>:
+SYSCALL(pipe)
+ 8ab:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+00000000000008b3 <read>:
+SYSCALL(read)
+ 8b3:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+00000000000008bb <write>:
+SYSCALL(write)
+ 8bb:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+00000000000008c3 <close>:
+SYSCALL(close)
+ 8c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+00000000000008cb <kill>:
+SYSCALL(kill)
+ 8cb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+00000000000008d3 <exec>:
+SYSCALL(exec)
+ 8d3:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+00000000000008db <open>:
+SYSCALL(open)
+ 8db:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+00000000000008e3 <mknod>:
+SYSCALL(mknod)
+ 8e3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+00000000000008eb <unlink>:
+SYSCALL(unlink)
+ 8eb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+00000000000008f3 <fstat>:
+SYSCALL(fstat)
+ 8f3:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+00000000000008fb <link>:
+SYSCALL(link)
+ 8fb:	b8 13 00 00 00       	mov    $0x13,%eax
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+0000000000000903 <mkdir>:
+SYSCALL(mkdir)
+ 903:	b8 14 00 00 00       	mov    $0x14,%eax
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+000000000000090b <chdir>:
+SYSCALL(chdir)
+ 90b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 910:	cd 40                	int    $0x40
+ 912:	c3                   	ret
+
+0000000000000913 <dup>:
+SYSCALL(dup)
+ 913:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+000000000000091b <getpid>:
+SYSCALL(getpid)
+ 91b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+0000000000000923 <sbrk>:
+SYSCALL(sbrk)
+ 923:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+000000000000092b <sleep>:
+SYSCALL(sleep)
+ 92b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+0000000000000933 <uptime>:
+SYSCALL(uptime)
+ 933:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+000000000000093b <sysinfo>:
+SYSCALL(sysinfo)
+ 93b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+0000000000000943 <crashn>:
+SYSCALL(crashn)
+ 943:	b8 17 00 00 00       	mov    $0x17,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+000000000000094b <mmap>:
+SYSCALL(mmap)
+ 94b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+0000000000000953 <munmap>:
+SYSCALL(munmap)
+ 953:	b8 19 00 00 00       	mov    $0x19,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+000000000000095b <preface>:
+.globl preface
+preface:
+    call main
+ 95b:	e8 a0 f6 ff ff       	call   0 <main>
+    mov %rax, %rdi
+ 960:	48 89 c7             	mov    %rax,%rdi
+    call exit
+ 963:	e8 33 ff ff ff       	call   89b <exit>
+
+0000000000000968 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ 968:	55                   	push   %rbp
+ 969:	48 89 e5             	mov    %rsp,%rbp
+ 96c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ 970:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 974:	48 83 e8 10          	sub    $0x10,%rax
+ 978:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	48 8b 05 dd 05 00 00 	mov    0x5dd(%rip),%rax        # f60 <freep>
+ 983:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 987:	eb 2f                	jmp    9b8 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 98d:	48 8b 00             	mov    (%rax),%rax
+ 990:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 994:	72 17                	jb     9ad <free+0x45>
+ 996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 99a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 99e:	72 2f                	jb     9cf <free+0x67>
+ 9a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9a4:	48 8b 00             	mov    (%rax),%rax
+ 9a7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9ab:	72 22                	jb     9cf <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b1:	48 8b 00             	mov    (%rax),%rax
+ 9b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9bc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9c0:	73 c7                	jae    989 <free+0x21>
+ 9c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9c6:	48 8b 00             	mov    (%rax),%rax
+ 9c9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9cd:	73 ba                	jae    989 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ 9cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9d3:	8b 40 08             	mov    0x8(%rax),%eax
+ 9d6:	89 c0                	mov    %eax,%eax
+ 9d8:	48 c1 e0 04          	shl    $0x4,%rax
+ 9dc:	48 89 c2             	mov    %rax,%rdx
+ 9df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9e3:	48 01 c2             	add    %rax,%rdx
+ 9e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ea:	48 8b 00             	mov    (%rax),%rax
+ 9ed:	48 39 c2             	cmp    %rax,%rdx
+ 9f0:	75 2d                	jne    a1f <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ 9f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f6:	8b 50 08             	mov    0x8(%rax),%edx
+ 9f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9fd:	48 8b 00             	mov    (%rax),%rax
+ a00:	8b 40 08             	mov    0x8(%rax),%eax
+ a03:	01 c2                	add    %eax,%edx
+ a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a09:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a10:	48 8b 00             	mov    (%rax),%rax
+ a13:	48 8b 10             	mov    (%rax),%rdx
+ a16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a1a:	48 89 10             	mov    %rdx,(%rax)
+ a1d:	eb 0e                	jmp    a2d <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a23:	48 8b 10             	mov    (%rax),%rdx
+ a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a2a:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ a2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a31:	8b 40 08             	mov    0x8(%rax),%eax
+ a34:	89 c0                	mov    %eax,%eax
+ a36:	48 c1 e0 04          	shl    $0x4,%rax
+ a3a:	48 89 c2             	mov    %rax,%rdx
+ a3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a41:	48 01 d0             	add    %rdx,%rax
+ a44:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a48:	75 27                	jne    a71 <free+0x109>
+    p->s.size += bp->s.size;
+ a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a4e:	8b 50 08             	mov    0x8(%rax),%edx
+ a51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a55:	8b 40 08             	mov    0x8(%rax),%eax
+ a58:	01 c2                	add    %eax,%edx
+ a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5e:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a65:	48 8b 10             	mov    (%rax),%rdx
+ a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6c:	48 89 10             	mov    %rdx,(%rax)
+ a6f:	eb 0b                	jmp    a7c <free+0x114>
+  } else
+    p->s.ptr = bp;
+ a71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a79:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a80:	48 89 05 d9 04 00 00 	mov    %rax,0x4d9(%rip)        # f60 <freep>
+}
+ a87:	90                   	nop
+ a88:	5d                   	pop    %rbp
+ a89:	c3                   	ret
+
+0000000000000a8a <morecore>:
+
+static Header *morecore(uint nu) {
+ a8a:	55                   	push   %rbp
+ a8b:	48 89 e5             	mov    %rsp,%rbp
+ a8e:	48 83 ec 20          	sub    $0x20,%rsp
+ a92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ a95:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a9c:	77 07                	ja     aa5 <morecore+0x1b>
+    nu = 4096;
+ a9e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ aa5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ aa8:	c1 e0 04             	shl    $0x4,%eax
+ aab:	89 c7                	mov    %eax,%edi
+ aad:	e8 71 fe ff ff       	call   923 <sbrk>
+ ab2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ ab6:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ abb:	75 07                	jne    ac4 <morecore+0x3a>
+    return 0;
+ abd:	b8 00 00 00 00       	mov    $0x0,%eax
+ ac2:	eb 29                	jmp    aed <morecore+0x63>
+  hp = (Header *)p;
+ ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ acc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ad0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ad3:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ ad6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ada:	48 83 c0 10          	add    $0x10,%rax
+ ade:	48 89 c7             	mov    %rax,%rdi
+ ae1:	e8 82 fe ff ff       	call   968 <free>
+  return freep;
+ ae6:	48 8b 05 73 04 00 00 	mov    0x473(%rip),%rax        # f60 <freep>
+}
+ aed:	c9                   	leave
+ aee:	c3                   	ret
+
+0000000000000aef <malloc>:
+
+void *malloc(uint nbytes) {
+ aef:	55                   	push   %rbp
+ af0:	48 89 e5             	mov    %rsp,%rbp
+ af3:	48 83 ec 30          	sub    $0x30,%rsp
+ af7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ afa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ afd:	48 83 c0 0f          	add    $0xf,%rax
+ b01:	48 c1 e8 04          	shr    $0x4,%rax
+ b05:	83 c0 01             	add    $0x1,%eax
+ b08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ b0b:	48 8b 05 4e 04 00 00 	mov    0x44e(%rip),%rax        # f60 <freep>
+ b12:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b16:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b1b:	75 2e                	jne    b4b <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ b1d:	48 8d 05 2c 04 00 00 	lea    0x42c(%rip),%rax        # f50 <base>
+ b24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b2c:	48 89 05 2d 04 00 00 	mov    %rax,0x42d(%rip)        # f60 <freep>
+ b33:	48 8b 05 26 04 00 00 	mov    0x426(%rip),%rax        # f60 <freep>
+ b3a:	48 89 05 0f 04 00 00 	mov    %rax,0x40f(%rip)        # f50 <base>
+    base.s.size = 0;
+ b41:	c7 05 0d 04 00 00 00 	movl   $0x0,0x40d(%rip)        # f58 <base+0x8>
+ b48:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ b4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b4f:	48 8b 00             	mov    (%rax),%rax
+ b52:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ b56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b5a:	8b 40 08             	mov    0x8(%rax),%eax
+ b5d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ b60:	72 5f                	jb     bc1 <malloc+0xd2>
+      if (p->s.size == nunits)
+ b62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b66:	8b 40 08             	mov    0x8(%rax),%eax
+ b69:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ b6c:	75 10                	jne    b7e <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b72:	48 8b 10             	mov    (%rax),%rdx
+ b75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b79:	48 89 10             	mov    %rdx,(%rax)
+ b7c:	eb 2e                	jmp    bac <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ b7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b82:	8b 40 08             	mov    0x8(%rax),%eax
+ b85:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ b88:	89 c2                	mov    %eax,%edx
+ b8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b8e:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ b91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b95:	8b 40 08             	mov    0x8(%rax),%eax
+ b98:	89 c0                	mov    %eax,%eax
+ b9a:	48 c1 e0 04          	shl    $0x4,%rax
+ b9e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ ba2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ba6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ba9:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ bac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bb0:	48 89 05 a9 03 00 00 	mov    %rax,0x3a9(%rip)        # f60 <freep>
+      return (void *)(p + 1);
+ bb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bbb:	48 83 c0 10          	add    $0x10,%rax
+ bbf:	eb 41                	jmp    c02 <malloc+0x113>
+    }
+    if (p == freep)
+ bc1:	48 8b 05 98 03 00 00 	mov    0x398(%rip),%rax        # f60 <freep>
+ bc8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ bcc:	75 1c                	jne    bea <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ bce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ bd1:	89 c7                	mov    %eax,%edi
+ bd3:	e8 b2 fe ff ff       	call   a8a <morecore>
+ bd8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ bdc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ be1:	75 07                	jne    bea <malloc+0xfb>
+        return 0;
+ be3:	b8 00 00 00 00       	mov    $0x0,%eax
+ be8:	eb 18                	jmp    c02 <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ bf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf6:	48 8b 00             	mov    (%rax),%rax
+ bf9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ bfd:	e9 54 ff ff ff       	jmp    b56 <malloc+0x67>
+  }
+ c02:	c9                   	leave
+ c03:	c3                   	ret
@@ -0,0 +1,1445 @@
+
+out/user/_wc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <wc>:
+#include <stat.h>
+#include <user.h>
+
+char buf[512];
+
+void wc(int fd, char *name) {
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 30          	sub    $0x30,%rsp
+   8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+   b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  16:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  19:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  1f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  inword = 0;
+  22:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+  29:	eb 74                	jmp    9f <wc+0x9f>
+    for (i = 0; i < n; i++) {
+  2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  32:	eb 63                	jmp    97 <wc+0x97>
+      c++;
+  34:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+      if (buf[i] == '\n')
+  38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3b:	48 98                	cltq
+  3d:	48 8d 15 9c 0f 00 00 	lea    0xf9c(%rip),%rdx        # fe0 <buf>
+  44:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  48:	3c 0a                	cmp    $0xa,%al
+  4a:	75 04                	jne    50 <wc+0x50>
+        l++;
+  4c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+      if (strchr(" \r\t\n\v", buf[i]))
+  50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  53:	48 98                	cltq
+  55:	48 8d 15 84 0f 00 00 	lea    0xf84(%rip),%rdx        # fe0 <buf>
+  5c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  60:	0f be c0             	movsbl %al,%eax
+  63:	89 c6                	mov    %eax,%esi
+  65:	48 8d 05 64 0c 00 00 	lea    0xc64(%rip),%rax        # cd0 <malloc+0x115>
+  6c:	48 89 c7             	mov    %rax,%rdi
+  6f:	e8 36 07 00 00       	call   7aa <strchr>
+  74:	48 85 c0             	test   %rax,%rax
+  77:	74 09                	je     82 <wc+0x82>
+        inword = 0;
+  79:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80:	eb 11                	jmp    93 <wc+0x93>
+      else if (!inword) {
+  82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  86:	75 0b                	jne    93 <wc+0x93>
+        w++;
+  88:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+        inword = 1;
+  8c:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+    for (i = 0; i < n; i++) {
+  93:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  9a:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  9d:	7c 95                	jl     34 <wc+0x34>
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+  9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  a2:	ba 00 02 00 00       	mov    $0x200,%edx
+  a7:	48 8d 0d 32 0f 00 00 	lea    0xf32(%rip),%rcx        # fe0 <buf>
+  ae:	48 89 ce             	mov    %rcx,%rsi
+  b1:	89 c7                	mov    %eax,%edi
+  b3:	e8 c7 08 00 00       	call   97f <read>
+  b8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  bb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  bf:	0f 8f 66 ff ff ff    	jg     2b <wc+0x2b>
+      }
+    }
+  }
+  if (n < 0) {
+  c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  c9:	79 1e                	jns    e9 <wc+0xe9>
+    printf(1, "wc: read error\n");
+  cb:	48 8d 05 04 0c 00 00 	lea    0xc04(%rip),%rax        # cd6 <malloc+0x11b>
+  d2:	48 89 c6             	mov    %rax,%rsi
+  d5:	bf 01 00 00 00       	mov    $0x1,%edi
+  da:	b8 00 00 00 00       	mov    $0x0,%eax
+  df:	e8 dc 02 00 00       	call   3c0 <printf>
+    exit();
+  e4:	e8 7e 08 00 00       	call   967 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  e9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  ed:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+  f0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  f3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  f6:	49 89 f1             	mov    %rsi,%r9
+  f9:	41 89 c8             	mov    %ecx,%r8d
+  fc:	89 d1                	mov    %edx,%ecx
+  fe:	89 c2                	mov    %eax,%edx
+ 100:	48 8d 05 df 0b 00 00 	lea    0xbdf(%rip),%rax        # ce6 <malloc+0x12b>
+ 107:	48 89 c6             	mov    %rax,%rsi
+ 10a:	bf 01 00 00 00       	mov    $0x1,%edi
+ 10f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 114:	e8 a7 02 00 00       	call   3c0 <printf>
+}
+ 119:	90                   	nop
+ 11a:	c9                   	leave
+ 11b:	c3                   	ret
+
+000000000000011c <main>:
+
+int main(int argc, char *argv[]) {
+ 11c:	55                   	push   %rbp
+ 11d:	48 89 e5             	mov    %rsp,%rbp
+ 120:	48 83 ec 20          	sub    $0x20,%rsp
+ 124:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ 127:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if (argc <= 1) {
+ 12b:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+ 12f:	7f 19                	jg     14a <main+0x2e>
+    wc(0, "");
+ 131:	48 8d 05 bb 0b 00 00 	lea    0xbbb(%rip),%rax        # cf3 <malloc+0x138>
+ 138:	48 89 c6             	mov    %rax,%rsi
+ 13b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 140:	e8 bb fe ff ff       	call   0 <wc>
+    exit();
+ 145:	e8 1d 08 00 00       	call   967 <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+ 14a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+ 151:	e9 97 00 00 00       	jmp    1ed <main+0xd1>
+    if ((fd = open(argv[i], 0)) < 0) {
+ 156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 159:	48 98                	cltq
+ 15b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 162:	00 
+ 163:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 167:	48 01 d0             	add    %rdx,%rax
+ 16a:	48 8b 00             	mov    (%rax),%rax
+ 16d:	be 00 00 00 00       	mov    $0x0,%esi
+ 172:	48 89 c7             	mov    %rax,%rdi
+ 175:	e8 2d 08 00 00       	call   9a7 <open>
+ 17a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ 17d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 181:	79 38                	jns    1bb <main+0x9f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 183:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 186:	48 98                	cltq
+ 188:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 18f:	00 
+ 190:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 194:	48 01 d0             	add    %rdx,%rax
+ 197:	48 8b 00             	mov    (%rax),%rax
+ 19a:	48 89 c2             	mov    %rax,%rdx
+ 19d:	48 8d 05 50 0b 00 00 	lea    0xb50(%rip),%rax        # cf4 <malloc+0x139>
+ 1a4:	48 89 c6             	mov    %rax,%rsi
+ 1a7:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1ac:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1b1:	e8 0a 02 00 00       	call   3c0 <printf>
+      exit();
+ 1b6:	e8 ac 07 00 00       	call   967 <exit>
+    }
+    wc(fd, argv[i]);
+ 1bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1be:	48 98                	cltq
+ 1c0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 1c7:	00 
+ 1c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 1cc:	48 01 d0             	add    %rdx,%rax
+ 1cf:	48 8b 10             	mov    (%rax),%rdx
+ 1d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 1d5:	48 89 d6             	mov    %rdx,%rsi
+ 1d8:	89 c7                	mov    %eax,%edi
+ 1da:	e8 21 fe ff ff       	call   0 <wc>
+    close(fd);
+ 1df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 1e2:	89 c7                	mov    %eax,%edi
+ 1e4:	e8 a6 07 00 00       	call   98f <close>
+  for (i = 1; i < argc; i++) {
+ 1e9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 1ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f0:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ 1f3:	0f 8c 5d ff ff ff    	jl     156 <main+0x3a>
+  }
+  exit();
+ 1f9:	e8 69 07 00 00       	call   967 <exit>
+
+00000000000001fe <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { write(fd, &c, 1); }
+ 1fe:	55                   	push   %rbp
+ 1ff:	48 89 e5             	mov    %rsp,%rbp
+ 202:	48 83 ec 10          	sub    $0x10,%rsp
+ 206:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 209:	89 f0                	mov    %esi,%eax
+ 20b:	88 45 f8             	mov    %al,-0x8(%rbp)
+ 20e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 215:	ba 01 00 00 00       	mov    $0x1,%edx
+ 21a:	48 89 ce             	mov    %rcx,%rsi
+ 21d:	89 c7                	mov    %eax,%edi
+ 21f:	e8 63 07 00 00       	call   987 <write>
+ 224:	90                   	nop
+ 225:	c9                   	leave
+ 226:	c3                   	ret
+
+0000000000000227 <printint64>:
+
+static void printint64(int fd, int xx, int base, int sgn) {
+ 227:	55                   	push   %rbp
+ 228:	48 89 e5             	mov    %rsp,%rbp
+ 22b:	48 83 ec 40          	sub    $0x40,%rsp
+ 22f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 232:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 235:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 238:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+ 23b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 23f:	74 1f                	je     260 <printint64+0x39>
+ 241:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 244:	c1 e8 1f             	shr    $0x1f,%eax
+ 247:	0f b6 c0             	movzbl %al,%eax
+ 24a:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 24d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 251:	74 0d                	je     260 <printint64+0x39>
+    x = -xx;
+ 253:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 256:	f7 d8                	neg    %eax
+ 258:	48 98                	cltq
+ 25a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 25e:	eb 09                	jmp    269 <printint64+0x42>
+  else
+    x = xx;
+ 260:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 263:	48 98                	cltq
+ 265:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 269:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 270:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 273:	48 63 c8             	movslq %eax,%rcx
+ 276:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 27a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 27f:	48 f7 f1             	div    %rcx
+ 282:	48 89 d1             	mov    %rdx,%rcx
+ 285:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 288:	8d 50 01             	lea    0x1(%rax),%edx
+ 28b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 28e:	48 8d 15 fb 0c 00 00 	lea    0xcfb(%rip),%rdx        # f90 <digits.1>
+ 295:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 299:	48 98                	cltq
+ 29b:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 29f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2a2:	48 63 f0             	movslq %eax,%rsi
+ 2a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 2a9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2ae:	48 f7 f6             	div    %rsi
+ 2b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 2b5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 2ba:	75 b4                	jne    270 <printint64+0x49>
+
+  if (sgn)
+ 2bc:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2c0:	74 2b                	je     2ed <printint64+0xc6>
+    buf[i++] = '-';
+ 2c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2c5:	8d 50 01             	lea    0x1(%rax),%edx
+ 2c8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2cb:	48 98                	cltq
+ 2cd:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 2d2:	eb 19                	jmp    2ed <printint64+0xc6>
+    putc(fd, buf[i]);
+ 2d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2d7:	48 98                	cltq
+ 2d9:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 2de:	0f be d0             	movsbl %al,%edx
+ 2e1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 2e4:	89 d6                	mov    %edx,%esi
+ 2e6:	89 c7                	mov    %eax,%edi
+ 2e8:	e8 11 ff ff ff       	call   1fe <putc>
+  while (--i >= 0)
+ 2ed:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 2f1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2f5:	79 dd                	jns    2d4 <printint64+0xad>
+}
+ 2f7:	90                   	nop
+ 2f8:	90                   	nop
+ 2f9:	c9                   	leave
+ 2fa:	c3                   	ret
+
+00000000000002fb <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+ 2fb:	55                   	push   %rbp
+ 2fc:	48 89 e5             	mov    %rsp,%rbp
+ 2ff:	48 83 ec 30          	sub    $0x30,%rsp
+ 303:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 306:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 309:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 30c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 30f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+ 316:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 31a:	74 17                	je     333 <printint+0x38>
+ 31c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 320:	79 11                	jns    333 <printint+0x38>
+    neg = 1;
+ 322:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 329:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 32c:	f7 d8                	neg    %eax
+ 32e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 331:	eb 06                	jmp    339 <printint+0x3e>
+  } else {
+    x = xx;
+ 333:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 336:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 339:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+ 340:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 343:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 346:	ba 00 00 00 00       	mov    $0x0,%edx
+ 34b:	f7 f1                	div    %ecx
+ 34d:	89 d1                	mov    %edx,%ecx
+ 34f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 352:	8d 50 01             	lea    0x1(%rax),%edx
+ 355:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 358:	89 c9                	mov    %ecx,%ecx
+ 35a:	48 8d 15 4f 0c 00 00 	lea    0xc4f(%rip),%rdx        # fb0 <digits.0>
+ 361:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 365:	48 98                	cltq
+ 367:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+ 36b:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 36e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 371:	ba 00 00 00 00       	mov    $0x0,%edx
+ 376:	f7 f6                	div    %esi
+ 378:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 37b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 37f:	75 bf                	jne    340 <printint+0x45>
+  if (neg)
+ 381:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 385:	74 2b                	je     3b2 <printint+0xb7>
+    buf[i++] = '-';
+ 387:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 38a:	8d 50 01             	lea    0x1(%rax),%edx
+ 38d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 390:	48 98                	cltq
+ 392:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+ 397:	eb 19                	jmp    3b2 <printint+0xb7>
+    putc(fd, buf[i]);
+ 399:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 39c:	48 98                	cltq
+ 39e:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 3a3:	0f be d0             	movsbl %al,%edx
+ 3a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 3a9:	89 d6                	mov    %edx,%esi
+ 3ab:	89 c7                	mov    %eax,%edi
+ 3ad:	e8 4c fe ff ff       	call   1fe <putc>
+  while (--i >= 0)
+ 3b2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 3b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 3ba:	79 dd                	jns    399 <printint+0x9e>
+}
+ 3bc:	90                   	nop
+ 3bd:	90                   	nop
+ 3be:	c9                   	leave
+ 3bf:	c3                   	ret
+
+00000000000003c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+ 3c0:	55                   	push   %rbp
+ 3c1:	48 89 e5             	mov    %rsp,%rbp
+ 3c4:	48 83 ec 70          	sub    $0x70,%rsp
+ 3c8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 3cb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 3cf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 3d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 3d7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 3db:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+ 3df:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 3e6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 3ea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 3ee:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 3f2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 3f6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 3fd:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 404:	e9 6b 02 00 00       	jmp    674 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 409:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 40c:	48 63 d0             	movslq %eax,%rdx
+ 40f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 413:	48 01 d0             	add    %rdx,%rax
+ 416:	0f b6 00             	movzbl (%rax),%eax
+ 419:	0f be c0             	movsbl %al,%eax
+ 41c:	25 ff 00 00 00       	and    $0xff,%eax
+ 421:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+ 424:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 428:	75 30                	jne    45a <printf+0x9a>
+      if (c == '%') {
+ 42a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 42e:	75 13                	jne    443 <printf+0x83>
+        state = '%';
+ 430:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 437:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 43e:	e9 2d 02 00 00       	jmp    670 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 443:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 446:	0f be d0             	movsbl %al,%edx
+ 449:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 44c:	89 d6                	mov    %edx,%esi
+ 44e:	89 c7                	mov    %eax,%edi
+ 450:	e8 a9 fd ff ff       	call   1fe <putc>
+ 455:	e9 16 02 00 00       	jmp    670 <printf+0x2b0>
+      }
+    } else if (state == '%') {
+ 45a:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 45e:	0f 85 0c 02 00 00    	jne    670 <printf+0x2b0>
+      if (c == 'l') {
+ 464:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 468:	75 0c                	jne    476 <printf+0xb6>
+        lflag = 1;
+ 46a:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 471:	e9 fa 01 00 00       	jmp    670 <printf+0x2b0>
+      } else if (c == 'd') {
+ 476:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 47a:	0f 85 95 00 00 00    	jne    515 <printf+0x155>
+        if (lflag == 1)
+ 480:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 484:	75 49                	jne    4cf <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 486:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 489:	83 f8 2f             	cmp    $0x2f,%eax
+ 48c:	77 17                	ja     4a5 <printf+0xe5>
+ 48e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 492:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 495:	89 d2                	mov    %edx,%edx
+ 497:	48 01 d0             	add    %rdx,%rax
+ 49a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 49d:	83 c2 08             	add    $0x8,%edx
+ 4a0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4a3:	eb 0c                	jmp    4b1 <printf+0xf1>
+ 4a5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4a9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4ad:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4b1:	48 8b 00             	mov    (%rax),%rax
+ 4b4:	89 c6                	mov    %eax,%esi
+ 4b6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4be:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 4c3:	89 c7                	mov    %eax,%edi
+ 4c5:	e8 5d fd ff ff       	call   227 <printint64>
+ 4ca:	e9 9a 01 00 00       	jmp    669 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+ 4cf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4d2:	83 f8 2f             	cmp    $0x2f,%eax
+ 4d5:	77 17                	ja     4ee <printf+0x12e>
+ 4d7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4db:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4de:	89 d2                	mov    %edx,%edx
+ 4e0:	48 01 d0             	add    %rdx,%rax
+ 4e3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4e6:	83 c2 08             	add    $0x8,%edx
+ 4e9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4ec:	eb 0c                	jmp    4fa <printf+0x13a>
+ 4ee:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4f2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4f6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4fa:	8b 30                	mov    (%rax),%esi
+ 4fc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 504:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 509:	89 c7                	mov    %eax,%edi
+ 50b:	e8 eb fd ff ff       	call   2fb <printint>
+ 510:	e9 54 01 00 00       	jmp    669 <printf+0x2a9>
+      } else if (c == 'x' || c == 'p') {
+ 515:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 519:	74 0a                	je     525 <printf+0x165>
+ 51b:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 51f:	0f 85 95 00 00 00    	jne    5ba <printf+0x1fa>
+        if (lflag == 1)
+ 525:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 529:	75 49                	jne    574 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 52b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 52e:	83 f8 2f             	cmp    $0x2f,%eax
+ 531:	77 17                	ja     54a <printf+0x18a>
+ 533:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 537:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 53a:	89 d2                	mov    %edx,%edx
+ 53c:	48 01 d0             	add    %rdx,%rax
+ 53f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 542:	83 c2 08             	add    $0x8,%edx
+ 545:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 548:	eb 0c                	jmp    556 <printf+0x196>
+ 54a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 54e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 552:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 556:	48 8b 00             	mov    (%rax),%rax
+ 559:	89 c6                	mov    %eax,%esi
+ 55b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 55e:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 563:	ba 10 00 00 00       	mov    $0x10,%edx
+ 568:	89 c7                	mov    %eax,%edi
+ 56a:	e8 b8 fc ff ff       	call   227 <printint64>
+        if (lflag == 1)
+ 56f:	e9 f5 00 00 00       	jmp    669 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 574:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 577:	83 f8 2f             	cmp    $0x2f,%eax
+ 57a:	77 17                	ja     593 <printf+0x1d3>
+ 57c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 580:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 583:	89 d2                	mov    %edx,%edx
+ 585:	48 01 d0             	add    %rdx,%rax
+ 588:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 58b:	83 c2 08             	add    $0x8,%edx
+ 58e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 591:	eb 0c                	jmp    59f <printf+0x1df>
+ 593:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 597:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 59b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 59f:	8b 30                	mov    (%rax),%esi
+ 5a1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 5a9:	ba 10 00 00 00       	mov    $0x10,%edx
+ 5ae:	89 c7                	mov    %eax,%edi
+ 5b0:	e8 46 fd ff ff       	call   2fb <printint>
+        if (lflag == 1)
+ 5b5:	e9 af 00 00 00       	jmp    669 <printf+0x2a9>
+      } else if (c == 's') {
+ 5ba:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 5be:	75 6e                	jne    62e <printf+0x26e>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+ 5c0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 5c3:	83 f8 2f             	cmp    $0x2f,%eax
+ 5c6:	77 17                	ja     5df <printf+0x21f>
+ 5c8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 5cc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 5cf:	89 d2                	mov    %edx,%edx
+ 5d1:	48 01 d0             	add    %rdx,%rax
+ 5d4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 5d7:	83 c2 08             	add    $0x8,%edx
+ 5da:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 5dd:	eb 0c                	jmp    5eb <printf+0x22b>
+ 5df:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 5e3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 5e7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 5eb:	48 8b 00             	mov    (%rax),%rax
+ 5ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 5f2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 5f7:	75 28                	jne    621 <printf+0x261>
+          s = "(null)";
+ 5f9:	48 8d 05 08 07 00 00 	lea    0x708(%rip),%rax        # d08 <malloc+0x14d>
+ 600:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+ 604:	eb 1b                	jmp    621 <printf+0x261>
+          putc(fd, *s);
+ 606:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 60a:	0f b6 00             	movzbl (%rax),%eax
+ 60d:	0f be d0             	movsbl %al,%edx
+ 610:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 613:	89 d6                	mov    %edx,%esi
+ 615:	89 c7                	mov    %eax,%edi
+ 617:	e8 e2 fb ff ff       	call   1fe <putc>
+        for (; *s; s++)
+ 61c:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 621:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 625:	0f b6 00             	movzbl (%rax),%eax
+ 628:	84 c0                	test   %al,%al
+ 62a:	75 da                	jne    606 <printf+0x246>
+ 62c:	eb 3b                	jmp    669 <printf+0x2a9>
+      } else if (c == '%') {
+ 62e:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 632:	75 14                	jne    648 <printf+0x288>
+        putc(fd, c);
+ 634:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 637:	0f be d0             	movsbl %al,%edx
+ 63a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 63d:	89 d6                	mov    %edx,%esi
+ 63f:	89 c7                	mov    %eax,%edi
+ 641:	e8 b8 fb ff ff       	call   1fe <putc>
+ 646:	eb 21                	jmp    669 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 648:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 64b:	be 25 00 00 00       	mov    $0x25,%esi
+ 650:	89 c7                	mov    %eax,%edi
+ 652:	e8 a7 fb ff ff       	call   1fe <putc>
+        putc(fd, c);
+ 657:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 65a:	0f be d0             	movsbl %al,%edx
+ 65d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 660:	89 d6                	mov    %edx,%esi
+ 662:	89 c7                	mov    %eax,%edi
+ 664:	e8 95 fb ff ff       	call   1fe <putc>
+      }
+      state = 0;
+ 669:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+ 670:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 674:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 677:	48 63 d0             	movslq %eax,%rdx
+ 67a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 67e:	48 01 d0             	add    %rdx,%rax
+ 681:	0f b6 00             	movzbl (%rax),%eax
+ 684:	84 c0                	test   %al,%al
+ 686:	0f 85 7d fd ff ff    	jne    409 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 68c:	90                   	nop
+ 68d:	90                   	nop
+ 68e:	c9                   	leave
+ 68f:	c3                   	ret
+
+0000000000000690 <stosb>:
+char *gets(char *buf, int max) {
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    cc = read(0, &c, 1);
+ 690:	55                   	push   %rbp
+ 691:	48 89 e5             	mov    %rsp,%rbp
+ 694:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 698:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 69b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    if (cc < 1)
+ 69e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 6a2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 6a8:	48 89 ce             	mov    %rcx,%rsi
+ 6ab:	48 89 f7             	mov    %rsi,%rdi
+ 6ae:	89 d1                	mov    %edx,%ecx
+ 6b0:	fc                   	cld
+ 6b1:	f3 aa                	rep stos %al,%es:(%rdi)
+ 6b3:	89 ca                	mov    %ecx,%edx
+ 6b5:	48 89 fe             	mov    %rdi,%rsi
+ 6b8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 6bc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      break;
+    buf[i++] = c;
+    if (c == '\n' || c == '\r')
+      break;
+ 6bf:	90                   	nop
+ 6c0:	5d                   	pop    %rbp
+ 6c1:	c3                   	ret
+
+00000000000006c2 <strcpy>:
+char *strcpy(char *s, char *t) {
+ 6c2:	55                   	push   %rbp
+ 6c3:	48 89 e5             	mov    %rsp,%rbp
+ 6c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 6ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 6ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+ 6d6:	90                   	nop
+ 6d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 6db:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 6df:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 6e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6e7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 6eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 6ef:	0f b6 12             	movzbl (%rdx),%edx
+ 6f2:	88 10                	mov    %dl,(%rax)
+ 6f4:	0f b6 00             	movzbl (%rax),%eax
+ 6f7:	84 c0                	test   %al,%al
+ 6f9:	75 dc                	jne    6d7 <strcpy+0x15>
+  return os;
+ 6fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6ff:	5d                   	pop    %rbp
+ 700:	c3                   	ret
+
+0000000000000701 <strcmp>:
+int strcmp(const char *p, const char *q) {
+ 701:	55                   	push   %rbp
+ 702:	48 89 e5             	mov    %rsp,%rbp
+ 705:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 709:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+ 70d:	eb 0a                	jmp    719 <strcmp+0x18>
+    p++, q++;
+ 70f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 714:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+ 719:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 71d:	0f b6 00             	movzbl (%rax),%eax
+ 720:	84 c0                	test   %al,%al
+ 722:	74 12                	je     736 <strcmp+0x35>
+ 724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 728:	0f b6 10             	movzbl (%rax),%edx
+ 72b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 72f:	0f b6 00             	movzbl (%rax),%eax
+ 732:	38 c2                	cmp    %al,%dl
+ 734:	74 d9                	je     70f <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 736:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 73a:	0f b6 00             	movzbl (%rax),%eax
+ 73d:	0f b6 d0             	movzbl %al,%edx
+ 740:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 744:	0f b6 00             	movzbl (%rax),%eax
+ 747:	0f b6 c0             	movzbl %al,%eax
+ 74a:	29 c2                	sub    %eax,%edx
+ 74c:	89 d0                	mov    %edx,%eax
+}
+ 74e:	5d                   	pop    %rbp
+ 74f:	c3                   	ret
+
+0000000000000750 <strlen>:
+uint strlen(char *s) {
+ 750:	55                   	push   %rbp
+ 751:	48 89 e5             	mov    %rsp,%rbp
+ 754:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+ 758:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 75f:	eb 04                	jmp    765 <strlen+0x15>
+ 761:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 765:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 768:	48 63 d0             	movslq %eax,%rdx
+ 76b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 76f:	48 01 d0             	add    %rdx,%rax
+ 772:	0f b6 00             	movzbl (%rax),%eax
+ 775:	84 c0                	test   %al,%al
+ 777:	75 e8                	jne    761 <strlen+0x11>
+  return n;
+ 779:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 77c:	5d                   	pop    %rbp
+ 77d:	c3                   	ret
+
+000000000000077e <memset>:
+void *memset(void *dst, int c, uint n) {
+ 77e:	55                   	push   %rbp
+ 77f:	48 89 e5             	mov    %rsp,%rbp
+ 782:	48 83 ec 10          	sub    $0x10,%rsp
+ 786:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 78a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 78d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 790:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 793:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 796:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 79a:	89 ce                	mov    %ecx,%esi
+ 79c:	48 89 c7             	mov    %rax,%rdi
+ 79f:	e8 ec fe ff ff       	call   690 <stosb>
+  return dst;
+ 7a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 7a8:	c9                   	leave
+ 7a9:	c3                   	ret
+
+00000000000007aa <strchr>:
+char *strchr(const char *s, char c) {
+ 7aa:	55                   	push   %rbp
+ 7ab:	48 89 e5             	mov    %rsp,%rbp
+ 7ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 7b2:	89 f0                	mov    %esi,%eax
+ 7b4:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+ 7b7:	eb 17                	jmp    7d0 <strchr+0x26>
+    if (*s == c)
+ 7b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7bd:	0f b6 00             	movzbl (%rax),%eax
+ 7c0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 7c3:	75 06                	jne    7cb <strchr+0x21>
+      return (char *)s;
+ 7c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7c9:	eb 15                	jmp    7e0 <strchr+0x36>
+  for (; *s; s++)
+ 7cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 7d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7d4:	0f b6 00             	movzbl (%rax),%eax
+ 7d7:	84 c0                	test   %al,%al
+ 7d9:	75 de                	jne    7b9 <strchr+0xf>
+  return 0;
+ 7db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 7e0:	5d                   	pop    %rbp
+ 7e1:	c3                   	ret
+
+00000000000007e2 <gets>:
+char *gets(char *buf, int max) {
+ 7e2:	55                   	push   %rbp
+ 7e3:	48 89 e5             	mov    %rsp,%rbp
+ 7e6:	48 83 ec 20          	sub    $0x20,%rsp
+ 7ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7ee:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  for (i = 0; i + 1 < max;) {
+ 7f1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 7f8:	eb 48                	jmp    842 <gets+0x60>
+    cc = read(0, &c, 1);
+ 7fa:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 7fe:	ba 01 00 00 00       	mov    $0x1,%edx
+ 803:	48 89 c6             	mov    %rax,%rsi
+ 806:	bf 00 00 00 00       	mov    $0x0,%edi
+ 80b:	e8 6f 01 00 00       	call   97f <read>
+ 810:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+ 813:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 817:	7e 36                	jle    84f <gets+0x6d>
+    buf[i++] = c;
+ 819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 81c:	8d 50 01             	lea    0x1(%rax),%edx
+ 81f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 822:	48 63 d0             	movslq %eax,%rdx
+ 825:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 829:	48 01 c2             	add    %rax,%rdx
+ 82c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 830:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+ 832:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 836:	3c 0a                	cmp    $0xa,%al
+ 838:	74 16                	je     850 <gets+0x6e>
+ 83a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 83e:	3c 0d                	cmp    $0xd,%al
+ 840:	74 0e                	je     850 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+ 842:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 845:	83 c0 01             	add    $0x1,%eax
+ 848:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 84b:	7f ad                	jg     7fa <gets+0x18>
+ 84d:	eb 01                	jmp    850 <gets+0x6e>
+      break;
+ 84f:	90                   	nop
+  }
+  buf[i] = '\0';
+ 850:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 853:	48 63 d0             	movslq %eax,%rdx
+ 856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 85a:	48 01 d0             	add    %rdx,%rax
+ 85d:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 860:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 864:	c9                   	leave
+ 865:	c3                   	ret
+
+0000000000000866 <stat>:
+
+int stat(char *n, struct stat *st) {
+ 866:	55                   	push   %rbp
+ 867:	48 89 e5             	mov    %rsp,%rbp
+ 86a:	48 83 ec 20          	sub    $0x20,%rsp
+ 86e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 872:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 87a:	be 00 00 00 00       	mov    $0x0,%esi
+ 87f:	48 89 c7             	mov    %rax,%rdi
+ 882:	e8 20 01 00 00       	call   9a7 <open>
+ 887:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+ 88a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 88e:	79 07                	jns    897 <stat+0x31>
+    return -1;
+ 890:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 895:	eb 21                	jmp    8b8 <stat+0x52>
+  r = fstat(fd, st);
+ 897:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 89b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 89e:	48 89 d6             	mov    %rdx,%rsi
+ 8a1:	89 c7                	mov    %eax,%edi
+ 8a3:	e8 17 01 00 00       	call   9bf <fstat>
+ 8a8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 8ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 8ae:	89 c7                	mov    %eax,%edi
+ 8b0:	e8 da 00 00 00       	call   98f <close>
+  return r;
+ 8b5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 8b8:	c9                   	leave
+ 8b9:	c3                   	ret
+
+00000000000008ba <atoi>:
+
+int atoi(const char *s) {
+ 8ba:	55                   	push   %rbp
+ 8bb:	48 89 e5             	mov    %rsp,%rbp
+ 8be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 8c2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 8c9:	eb 28                	jmp    8f3 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+ 8cb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 8ce:	89 d0                	mov    %edx,%eax
+ 8d0:	c1 e0 02             	shl    $0x2,%eax
+ 8d3:	01 d0                	add    %edx,%eax
+ 8d5:	01 c0                	add    %eax,%eax
+ 8d7:	89 c1                	mov    %eax,%ecx
+ 8d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 8e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 8e5:	0f b6 00             	movzbl (%rax),%eax
+ 8e8:	0f be c0             	movsbl %al,%eax
+ 8eb:	01 c8                	add    %ecx,%eax
+ 8ed:	83 e8 30             	sub    $0x30,%eax
+ 8f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+ 8f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8f7:	0f b6 00             	movzbl (%rax),%eax
+ 8fa:	3c 2f                	cmp    $0x2f,%al
+ 8fc:	7e 0b                	jle    909 <atoi+0x4f>
+ 8fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 902:	0f b6 00             	movzbl (%rax),%eax
+ 905:	3c 39                	cmp    $0x39,%al
+ 907:	7e c2                	jle    8cb <atoi+0x11>
+  return n;
+ 909:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 90c:	5d                   	pop    %rbp
+ 90d:	c3                   	ret
+
+000000000000090e <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+ 90e:	55                   	push   %rbp
+ 90f:	48 89 e5             	mov    %rsp,%rbp
+ 912:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 916:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 91a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 91d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 921:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 925:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 929:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (n-- > 0)
+ 92d:	eb 1d                	jmp    94c <memmove+0x3e>
+    *dst++ = *src++;
+ 92f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 933:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 937:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 93b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 93f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 943:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 947:	0f b6 12             	movzbl (%rdx),%edx
+ 94a:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+ 94c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 94f:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 952:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 955:	85 c0                	test   %eax,%eax
+ 957:	7f d6                	jg     92f <memmove+0x21>
+  return vdst;
+ 959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 95d:	5d                   	pop    %rbp
+ 95e:	c3                   	ret
+
+000000000000095f <fork>:
+  name:                                                                        \
+  movl $SYS_##name, % eax;                                                     \
+  int $TRAP_SYSCALL;                                                           \
+  ret
+
+SYSCALL(fork)
+ 95f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 964:	cd 40                	int    $0x40
+ 966:	c3                   	ret
+
+0000000000000967 <exit>:
+SYSCALL(exit)
+ 967:	b8 02 00 00 00       	mov    $0x2,%eax
+ 96c:	cd 40                	int    $0x40
+ 96e:	c3                   	ret
+
+000000000000096f <wait>:
+SYSCALL(wait)
+ 96f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 974:	cd 40                	int    $0x40
+ 976:	c3                   	ret
+
+0000000000000977 <pipe>:
+SYSCALL(pipe)
+ 977:	b8 04 00 00 00       	mov    $0x4,%eax
+ 97c:	cd 40                	int    $0x40
+ 97e:	c3                   	ret
+
+000000000000097f <read>:
+SYSCALL(read)
+ 97f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 984:	cd 40                	int    $0x40
+ 986:	c3                   	ret
+
+0000000000000987 <write>:
+SYSCALL(write)
+ 987:	b8 10 00 00 00       	mov    $0x10,%eax
+ 98c:	cd 40                	int    $0x40
+ 98e:	c3                   	ret
+
+000000000000098f <close>:
+SYSCALL(close)
+ 98f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 994:	cd 40                	int    $0x40
+ 996:	c3                   	ret
+
+0000000000000997 <kill>:
+SYSCALL(kill)
+ 997:	b8 06 00 00 00       	mov    $0x6,%eax
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+000000000000099f <exec>:
+SYSCALL(exec)
+ 99f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 9a4:	cd 40                	int    $0x40
+ 9a6:	c3                   	ret
+
+00000000000009a7 <open>:
+SYSCALL(open)
+ 9a7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 9ac:	cd 40                	int    $0x40
+ 9ae:	c3                   	ret
+
+00000000000009af <mknod>:
+SYSCALL(mknod)
+ 9af:	b8 11 00 00 00       	mov    $0x11,%eax
+ 9b4:	cd 40                	int    $0x40
+ 9b6:	c3                   	ret
+
+00000000000009b7 <unlink>:
+SYSCALL(unlink)
+ 9b7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 9bc:	cd 40                	int    $0x40
+ 9be:	c3                   	ret
+
+00000000000009bf <fstat>:
+SYSCALL(fstat)
+ 9bf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9c4:	cd 40                	int    $0x40
+ 9c6:	c3                   	ret
+
+00000000000009c7 <link>:
+SYSCALL(link)
+ 9c7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9cc:	cd 40                	int    $0x40
+ 9ce:	c3                   	ret
+
+00000000000009cf <mkdir>:
+SYSCALL(mkdir)
+ 9cf:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9d4:	cd 40                	int    $0x40
+ 9d6:	c3                   	ret
+
+00000000000009d7 <chdir>:
+SYSCALL(chdir)
+ 9d7:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9dc:	cd 40                	int    $0x40
+ 9de:	c3                   	ret
+
+00000000000009df <dup>:
+SYSCALL(dup)
+ 9df:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9e4:	cd 40                	int    $0x40
+ 9e6:	c3                   	ret
+
+00000000000009e7 <getpid>:
+SYSCALL(getpid)
+ 9e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9ec:	cd 40                	int    $0x40
+ 9ee:	c3                   	ret
+
+00000000000009ef <sbrk>:
+SYSCALL(sbrk)
+ 9ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9f4:	cd 40                	int    $0x40
+ 9f6:	c3                   	ret
+
+00000000000009f7 <sleep>:
+SYSCALL(sleep)
+ 9f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9fc:	cd 40                	int    $0x40
+ 9fe:	c3                   	ret
+
+00000000000009ff <uptime>:
+SYSCALL(uptime)
+ 9ff:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a04:	cd 40                	int    $0x40
+ a06:	c3                   	ret
+
+0000000000000a07 <sysinfo>:
+SYSCALL(sysinfo)
+ a07:	b8 16 00 00 00       	mov    $0x16,%eax
+ a0c:	cd 40                	int    $0x40
+ a0e:	c3                   	ret
+
+0000000000000a0f <crashn>:
+SYSCALL(crashn)
+ a0f:	b8 17 00 00 00       	mov    $0x17,%eax
+ a14:	cd 40                	int    $0x40
+ a16:	c3                   	ret
+
+0000000000000a17 <mmap>:
+SYSCALL(mmap)
+ a17:	b8 18 00 00 00       	mov    $0x18,%eax
+ a1c:	cd 40                	int    $0x40
+ a1e:	c3                   	ret
+
+0000000000000a1f <munmap>:
+SYSCALL(munmap)
+ a1f:	b8 19 00 00 00       	mov    $0x19,%eax
+ a24:	cd 40                	int    $0x40
+ a26:	c3                   	ret
+
+0000000000000a27 <preface>:
+.globl preface
+preface:
+    call main
+ a27:	e8 f0 f6 ff ff       	call   11c <main>
+    mov %rax, %rdi
+ a2c:	48 89 c7             	mov    %rax,%rdi
+    call exit
+ a2f:	e8 33 ff ff ff       	call   967 <exit>
+
+0000000000000a34 <free>:
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+void free(void *ap) {
+ a34:	55                   	push   %rbp
+ a35:	48 89 e5             	mov    %rsp,%rbp
+ a38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header *)ap - 1;
+ a3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a40:	48 83 e8 10          	sub    $0x10,%rax
+ a44:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a48:	48 8b 05 a1 07 00 00 	mov    0x7a1(%rip),%rax        # 11f0 <freep>
+ a4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ a53:	eb 2f                	jmp    a84 <free+0x50>
+    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a59:	48 8b 00             	mov    (%rax),%rax
+ a5c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a60:	72 17                	jb     a79 <free+0x45>
+ a62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a66:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a6a:	72 2f                	jb     a9b <free+0x67>
+ a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a70:	48 8b 00             	mov    (%rax),%rax
+ a73:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a77:	72 22                	jb     a9b <free+0x67>
+  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a7d:	48 8b 00             	mov    (%rax),%rax
+ a80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a88:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a8c:	73 c7                	jae    a55 <free+0x21>
+ a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a92:	48 8b 00             	mov    (%rax),%rax
+ a95:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a99:	73 ba                	jae    a55 <free+0x21>
+      break;
+  if (bp + bp->s.size == p->s.ptr) {
+ a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a9f:	8b 40 08             	mov    0x8(%rax),%eax
+ aa2:	89 c0                	mov    %eax,%eax
+ aa4:	48 c1 e0 04          	shl    $0x4,%rax
+ aa8:	48 89 c2             	mov    %rax,%rdx
+ aab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ aaf:	48 01 c2             	add    %rax,%rdx
+ ab2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab6:	48 8b 00             	mov    (%rax),%rax
+ ab9:	48 39 c2             	cmp    %rax,%rdx
+ abc:	75 2d                	jne    aeb <free+0xb7>
+    bp->s.size += p->s.ptr->s.size;
+ abe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ac2:	8b 50 08             	mov    0x8(%rax),%edx
+ ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac9:	48 8b 00             	mov    (%rax),%rax
+ acc:	8b 40 08             	mov    0x8(%rax),%eax
+ acf:	01 c2                	add    %eax,%edx
+ ad1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ad5:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ad8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ adc:	48 8b 00             	mov    (%rax),%rax
+ adf:	48 8b 10             	mov    (%rax),%rdx
+ ae2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae6:	48 89 10             	mov    %rdx,(%rax)
+ ae9:	eb 0e                	jmp    af9 <free+0xc5>
+  } else
+    bp->s.ptr = p->s.ptr;
+ aeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aef:	48 8b 10             	mov    (%rax),%rdx
+ af2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ af6:	48 89 10             	mov    %rdx,(%rax)
+  if (p + p->s.size == bp) {
+ af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ afd:	8b 40 08             	mov    0x8(%rax),%eax
+ b00:	89 c0                	mov    %eax,%eax
+ b02:	48 c1 e0 04          	shl    $0x4,%rax
+ b06:	48 89 c2             	mov    %rax,%rdx
+ b09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b0d:	48 01 d0             	add    %rdx,%rax
+ b10:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b14:	75 27                	jne    b3d <free+0x109>
+    p->s.size += bp->s.size;
+ b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b1a:	8b 50 08             	mov    0x8(%rax),%edx
+ b1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b21:	8b 40 08             	mov    0x8(%rax),%eax
+ b24:	01 c2                	add    %eax,%edx
+ b26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b2a:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b31:	48 8b 10             	mov    (%rax),%rdx
+ b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b38:	48 89 10             	mov    %rdx,(%rax)
+ b3b:	eb 0b                	jmp    b48 <free+0x114>
+  } else
+    p->s.ptr = bp;
+ b3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b41:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ b45:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4c:	48 89 05 9d 06 00 00 	mov    %rax,0x69d(%rip)        # 11f0 <freep>
+}
+ b53:	90                   	nop
+ b54:	5d                   	pop    %rbp
+ b55:	c3                   	ret
+
+0000000000000b56 <morecore>:
+
+static Header *morecore(uint nu) {
+ b56:	55                   	push   %rbp
+ b57:	48 89 e5             	mov    %rsp,%rbp
+ b5a:	48 83 ec 20          	sub    $0x20,%rsp
+ b5e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if (nu < 4096)
+ b61:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ b68:	77 07                	ja     b71 <morecore+0x1b>
+    nu = 4096;
+ b6a:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ b71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b74:	c1 e0 04             	shl    $0x4,%eax
+ b77:	89 c7                	mov    %eax,%edi
+ b79:	e8 71 fe ff ff       	call   9ef <sbrk>
+ b7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (p == (char *)-1)
+ b82:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b87:	75 07                	jne    b90 <morecore+0x3a>
+    return 0;
+ b89:	b8 00 00 00 00       	mov    $0x0,%eax
+ b8e:	eb 29                	jmp    bb9 <morecore+0x63>
+  hp = (Header *)p;
+ b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ b98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b9c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b9f:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void *)(hp + 1));
+ ba2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba6:	48 83 c0 10          	add    $0x10,%rax
+ baa:	48 89 c7             	mov    %rax,%rdi
+ bad:	e8 82 fe ff ff       	call   a34 <free>
+  return freep;
+ bb2:	48 8b 05 37 06 00 00 	mov    0x637(%rip),%rax        # 11f0 <freep>
+}
+ bb9:	c9                   	leave
+ bba:	c3                   	ret
+
+0000000000000bbb <malloc>:
+
+void *malloc(uint nbytes) {
+ bbb:	55                   	push   %rbp
+ bbc:	48 89 e5             	mov    %rsp,%rbp
+ bbf:	48 83 ec 30          	sub    $0x30,%rsp
+ bc3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+ bc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ bc9:	48 83 c0 0f          	add    $0xf,%rax
+ bcd:	48 c1 e8 04          	shr    $0x4,%rax
+ bd1:	83 c0 01             	add    $0x1,%eax
+ bd4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if ((prevp = freep) == 0) {
+ bd7:	48 8b 05 12 06 00 00 	mov    0x612(%rip),%rax        # 11f0 <freep>
+ bde:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ be2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ be7:	75 2e                	jne    c17 <malloc+0x5c>
+    base.s.ptr = freep = prevp = &base;
+ be9:	48 8d 05 f0 05 00 00 	lea    0x5f0(%rip),%rax        # 11e0 <base>
+ bf0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ bf4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bf8:	48 89 05 f1 05 00 00 	mov    %rax,0x5f1(%rip)        # 11f0 <freep>
+ bff:	48 8b 05 ea 05 00 00 	mov    0x5ea(%rip),%rax        # 11f0 <freep>
+ c06:	48 89 05 d3 05 00 00 	mov    %rax,0x5d3(%rip)        # 11e0 <base>
+    base.s.size = 0;
+ c0d:	c7 05 d1 05 00 00 00 	movl   $0x0,0x5d1(%rip)        # 11e8 <base+0x8>
+ c14:	00 00 00 
+  }
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ c17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c1b:	48 8b 00             	mov    (%rax),%rax
+ c1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ c22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c26:	8b 40 08             	mov    0x8(%rax),%eax
+ c29:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ c2c:	72 5f                	jb     c8d <malloc+0xd2>
+      if (p->s.size == nunits)
+ c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c32:	8b 40 08             	mov    0x8(%rax),%eax
+ c35:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ c38:	75 10                	jne    c4a <malloc+0x8f>
+        prevp->s.ptr = p->s.ptr;
+ c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c3e:	48 8b 10             	mov    (%rax),%rdx
+ c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c45:	48 89 10             	mov    %rdx,(%rax)
+ c48:	eb 2e                	jmp    c78 <malloc+0xbd>
+      else {
+        p->s.size -= nunits;
+ c4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c4e:	8b 40 08             	mov    0x8(%rax),%eax
+ c51:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ c54:	89 c2                	mov    %eax,%edx
+ c56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c5a:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ c5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c61:	8b 40 08             	mov    0x8(%rax),%eax
+ c64:	89 c0                	mov    %eax,%eax
+ c66:	48 c1 e0 04          	shl    $0x4,%rax
+ c6a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ c6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c72:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c75:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ c78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c7c:	48 89 05 6d 05 00 00 	mov    %rax,0x56d(%rip)        # 11f0 <freep>
+      return (void *)(p + 1);
+ c83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c87:	48 83 c0 10          	add    $0x10,%rax
+ c8b:	eb 41                	jmp    cce <malloc+0x113>
+    }
+    if (p == freep)
+ c8d:	48 8b 05 5c 05 00 00 	mov    0x55c(%rip),%rax        # 11f0 <freep>
+ c94:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c98:	75 1c                	jne    cb6 <malloc+0xfb>
+      if ((p = morecore(nunits)) == 0)
+ c9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c9d:	89 c7                	mov    %eax,%edi
+ c9f:	e8 b2 fe ff ff       	call   b56 <morecore>
+ ca4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ ca8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ cad:	75 07                	jne    cb6 <malloc+0xfb>
+        return 0;
+ caf:	b8 00 00 00 00       	mov    $0x0,%eax
+ cb4:	eb 18                	jmp    cce <malloc+0x113>
+  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
+ cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ cbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc2:	48 8b 00             	mov    (%rax),%rax
+ cc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (p->s.size >= nunits) {
+ cc9:	e9 54 ff ff ff       	jmp    c22 <malloc+0x67>
+  }
+ cce:	c9                   	leave
+ ccf:	c3                   	ret
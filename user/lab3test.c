@@ -21,6 +21,7 @@ int stdout = 1;
 
 void memtest(void);
 void sbrktest(void);
+void sbrklazytest(void);
 void growstacktest(void);
 void growstacktest_edgecase(void);
 void copyonwriteforktest(void);
@@ -28,6 +29,7 @@ void copyonwriteforktest(void);
 int main(int argc, char *argv[]) {
   memtest();
   sbrktest();
+  sbrklazytest();
   growstacktest();
   growstacktest_edgecase();
   copyonwriteforktest();
@@ -177,6 +179,52 @@ void sbrktest(void) {
   printf(stdout, "sbrktest passed\n");
 }
 
+void sbrklazytest(void) {
+  struct sys_info info1, info2, info3;
+  int npg = 64;
+  char *a;
+  int i, pid;
+
+  printf(stdout, "sbrklazytest\n");
+
+  // growing the heap takes no pages until they are touched
+  sysinfo(&info1);
+  a = sbrk(npg * 4096);
+  sysinfo(&info2);
+  if (a == (char *) -1)
+    error("sbrk failed\n");
+  if (info2.free_pages != info1.free_pages)
+    error("sbrk took %d pages before they were touched",
+          info1.free_pages - info2.free_pages);
+
+  // the old break may share a page with earlier heap, so only the
+  // last page is sure to be new
+  a[(npg - 1) * 4096] = 2;
+  sysinfo(&info3);
+  if (info2.free_pages - info3.free_pages < 1)
+    error("touching a heap page took no page");
+  a[0] = 1;
+
+  // a child sees the pages the parent touched, and zeroes in the rest
+  pid = fork();
+  if (pid < 0) {
+    error("fork failed\n");
+  }
+  if (pid == 0) {
+    if (a[0] != 1 || a[(npg - 1) * 4096] != 2)
+      error("child doesn't see the parent's heap writes");
+    for (i = 4096; i < (npg - 1) * 4096; i++)
+      if (a[i] != 0)
+        error("untouched heap byte %d is %d in the child", i, a[i]);
+    exit();
+  }
+  wait();
+
+  if (sbrk(-(npg * 4096)) == (char *) -1)
+    error("sbrk couldn't shrink the heap\n");
+  printf(stdout, "sbrklazytest passed\n");
+}
+
 void growstacktest() {
   int i;
   struct sys_info info1, info2;
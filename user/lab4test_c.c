@@ -11,9 +11,9 @@
 char buf[8192];
 int stdout = 1;
 char* file_name = "newfile.txt";
-int ROOT_DIR_START_SIZE = 400;
+int ROOT_DIR_START_SIZE = 416;
 int DIRENT_SIZE = 16;
-int INUM_START = 24;
+int INUM_START = 25;
 
 #define error(msg, ...)                                                        \
   do {                                                                         \
@@ -0,0 +1,214 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <user.h>
+
+#define error(msg, ...)                                                        \
+  do {                                                                         \
+    printf(stdout, "ERROR (line %d): ", __LINE__);                             \
+    printf(stdout, msg, ##__VA_ARGS__);                                        \
+    printf(stdout, "\n");                                                      \
+    while (1) {                                                                \
+    }                                                                          \
+  } while (0)
+
+#define PGSIZE 4096
+#define NPAGE 2
+
+int stdout = 1;
+char *file_name = "mmapfile";
+char buf[NPAGE * PGSIZE];
+
+void makefile(void);
+void checkfile(void);
+void sharetest(void);
+void privatetest(void);
+void forktest(void);
+void munmaptest(void);
+void unlinktest(void);
+
+int main(int argc, char *argv[]) {
+  makefile();
+  sharetest();
+  privatetest();
+  forktest();
+  munmaptest();
+  unlinktest();
+
+  printf(stdout, "lab5 tests passed!!\n");
+
+  exit();
+  return 0;
+}
+
+// Byte i of the test file.
+char pattern(int i) {
+  return 'a' + (i / PGSIZE + i) % 26;
+}
+
+void makefile(void) {
+  int fd, i;
+
+  for (i = 0; i < sizeof(buf); i++)
+    buf[i] = pattern(i);
+  if ((fd = open(file_name, O_CREATE | O_RDWR)) < 0)
+    error("couldn't create %s", file_name);
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+    error("couldn't write %s", file_name);
+  close(fd);
+}
+
+// Does the file still hold the pattern?
+void checkfile(void) {
+  int fd, i;
+
+  if ((fd = open(file_name, O_RDONLY)) < 0)
+    error("couldn't open %s", file_name);
+  if (read(fd, buf, sizeof(buf)) != sizeof(buf))
+    error("couldn't read %s", file_name);
+  close(fd);
+  for (i = 0; i < sizeof(buf); i++)
+    if (buf[i] != pattern(i))
+      error("file byte %d is %d, should be %d", i, buf[i], pattern(i));
+}
+
+// Maps the test file and checks the mapping holds the pattern.
+char *mapfile(int prot) {
+  char *p;
+  int fd, i;
+
+  if ((fd = open(file_name, O_RDONLY)) < 0)
+    error("couldn't open %s", file_name);
+  if ((p = mmap(fd, 0, sizeof(buf), prot)) == (char *)-1)
+    error("mmap failed");
+  close(fd);
+  for (i = 0; i < sizeof(buf); i++)
+    if (p[i] != pattern(i))
+      error("mapped byte %d is %d, should be %d", i, p[i], pattern(i));
+  return p;
+}
+
+// Two processes that map the file share the page cache's frames, so
+// a write() by one shows up in the other's mapping.
+void sharetest(void) {
+  int toparent[2], tochild[2], fd, pid;
+  char *p, c;
+
+  printf(stdout, "sharetest\n");
+  if (pipe(toparent) < 0 || pipe(tochild) < 0)
+    error("pipe failed");
+  if ((pid = fork()) < 0)
+    error("fork failed");
+  if (pid == 0) {
+    p = mapfile(PROT_READ);
+    write(toparent[1], "m", 1);
+    read(tochild[0], &c, 1);
+    if (p[0] != 'X' || p[PGSIZE] != 'Y')
+      error("mapping doesn't see write(): %d %d", p[0], p[PGSIZE]);
+    exit();
+  }
+
+  // wait for the child to map the file, then write it
+  read(toparent[0], &c, 1);
+  if ((fd = open(file_name, O_RDWR)) < 0)
+    error("couldn't open %s", file_name);
+  buf[0] = 'X';
+  buf[PGSIZE] = 'Y';
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+    error("couldn't write %s", file_name);
+  close(fd);
+  write(tochild[1], "w", 1);
+  wait();
+  close(toparent[0]);
+  close(toparent[1]);
+  close(tochild[0]);
+  close(tochild[1]);
+
+  makefile();
+  printf(stdout, "sharetest passed\n");
+}
+
+// Writes to a PROT_WRITE mapping are private to the process.
+void privatetest(void) {
+  char *p, *q;
+
+  printf(stdout, "privatetest\n");
+  p = mapfile(PROT_READ | PROT_WRITE);
+  q = mapfile(PROT_READ);
+  p[0] = 'P';
+  p[PGSIZE + 1] = 'Q';
+  if (p[0] != 'P' || p[PGSIZE + 1] != 'Q')
+    error("writes to the mapping were lost");
+  if (q[0] != pattern(0) || q[PGSIZE + 1] != pattern(PGSIZE + 1))
+    error("writes to a mapping reached another mapping");
+  if (munmap(p) < 0 || munmap(q) < 0)
+    error("munmap failed");
+  checkfile();
+  printf(stdout, "privatetest passed\n");
+}
+
+// A child keeps its parent's mappings, and its writes stay its own.
+void forktest(void) {
+  char *p;
+  int i, pid;
+
+  printf(stdout, "forktest\n");
+  p = mapfile(PROT_READ | PROT_WRITE);
+  p[0] = 'F';
+  if ((pid = fork()) < 0)
+    error("fork failed");
+  if (pid == 0) {
+    if (p[0] != 'F')
+      error("child doesn't see the parent's write");
+    for (i = 1; i < sizeof(buf); i++)
+      if (p[i] != pattern(i))
+        error("child mapped byte %d is %d, should be %d", i, p[i], pattern(i));
+    p[1] = 'C';
+    exit();
+  }
+  wait();
+  if (p[1] != pattern(1))
+    error("child's write reached the parent");
+  if (munmap(p) < 0)
+    error("munmap failed");
+  checkfile();
+  printf(stdout, "forktest passed\n");
+}
+
+// munmap drops the mapping: touching it afterwards faults.
+void munmaptest(void) {
+  char *p;
+  int pid;
+
+  printf(stdout, "munmaptest\n");
+  p = mapfile(PROT_READ);
+  if (munmap(p) < 0)
+    error("munmap failed");
+  if (munmap(p) != -1)
+    error("munmap of an unmapped address succeeded");
+
+  printf(stdout, "next process should be killed with trap 14 err 4\n");
+  if ((pid = fork()) < 0)
+    error("fork failed");
+  if (pid == 0) {
+    printf(stdout, "oops could read %x = %x\n", p, *p);
+    error("unmapped page is still readable");
+  }
+  wait();
+  printf(stdout, "munmaptest passed\n");
+}
+
+// A mapped file can't be unlinked until it is unmapped.
+void unlinktest(void) {
+  char *p;
+
+  printf(stdout, "unlinktest\n");
+  p = mapfile(PROT_READ);
+  if (unlink(file_name) != -1)
+    error("unlinked a mapped file");
+  if (munmap(p) < 0)
+    error("munmap failed");
+  if (unlink(file_name) < 0)
+    error("couldn't unlink %s after munmap", file_name);
+  printf(stdout, "unlinktest passed\n");
+}
@@ -13,6 +13,10 @@ int main(int argc, char *argv[]) {
   printf(1, "free_pages = %d\n", info.free_pages);
   printf(1, "num_page_faults = %d\n", info.num_page_faults);
   printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  printf(1, "num_bcache_hits = %d\n", info.num_bcache_hits);
+  printf(1, "num_bcache_misses = %d\n", info.num_bcache_misses);
+  for (int i = 0; i < NORDER; i++)
+    printf(1, "free_blocks[%d] = %d\n", i, info.free_blocks[i]);
 
   exit();
 }